@@ -7,6 +7,7 @@
 #include "crypto/ecc.h"
 #include "crypto/x509.h"
 #include "crypto/hash.h"
+#include "crypto/hash_pool.h"
 #include "crypto/rng.h"
 #include "crypto/rsa.h"
 #include "riot/riot_key_manager.h"
@@ -16,6 +17,41 @@
 #include "attestation_master.h"
 
 
+/**
+ * Get the hash engine to use for an attestation operation.  If the manager was initialized with a
+ * hash pool, an engine is acquired from the pool and must be returned with
+ * {@link attestation_release_hash}.
+ *
+ * @param attestation The attestation manager to utilize.
+ * @param hash Output for the hash engine to use.
+ *
+ * @return 0 if a hash engine is available or an error code.
+ */
+static int attestation_acquire_hash (struct attestation_master *attestation,
+	struct hash_engine **hash)
+{
+	if (attestation->pool != NULL) {
+		return hash_pool_acquire_engine (attestation->pool, 0, hash);
+	}
+
+	*hash = attestation->hash;
+	return 0;
+}
+
+/**
+ * Finish using a hash engine obtained from {@link attestation_acquire_hash}.
+ *
+ * @param attestation The attestation manager to utilize.
+ * @param hash The hash engine being released.
+ */
+static void attestation_release_hash (struct attestation_master *attestation,
+	struct hash_engine *hash)
+{
+	if (attestation->pool != NULL) {
+		hash_pool_release_engine (attestation->pool, hash);
+	}
+}
+
 /**
  * Load and authenticate certifcate chain then return leaf DER public key.
  *
@@ -168,6 +204,7 @@ static int attestation_get_chain_digests (struct attestation_master *attestation
 	uint8_t device_num, struct attestation_chain_digest *digests)
 {
 	struct device_manager_cert_chain chain;
+	struct hash_engine *hash;
 	uint8_t i_cert;
 	int status;
 
@@ -182,21 +219,30 @@ static int attestation_get_chain_digests (struct attestation_master *attestation
 		return ATTESTATION_NO_MEMORY;
 	}
 
+	status = attestation_acquire_hash (attestation, &hash);
+	if (status != 0) {
+		platform_free (digests->digest);
+
+		return status;
+	}
+
 	for (i_cert = 0; i_cert < chain.num_cert; ++i_cert) {
 		if ((chain.cert[i_cert].cert == NULL) || (chain.cert[i_cert].length == 0)) {
 			continue;
 		}
 
-		status = attestation->hash->calculate_sha256 (attestation->hash, chain.cert[i_cert].cert,
-			chain.cert[i_cert].length, &digests->digest[i_cert * SHA256_HASH_LENGTH],
-			SHA256_HASH_LENGTH);
+		status = hash->calculate_sha256 (hash, chain.cert[i_cert].cert, chain.cert[i_cert].length,
+			&digests->digest[i_cert * SHA256_HASH_LENGTH], SHA256_HASH_LENGTH);
 		if (status != 0) {
+			attestation_release_hash (attestation, hash);
 			platform_free (digests->digest);
 
 			return status;
 		}
 	}
 
+	attestation_release_hash (attestation, hash);
+
 	digests->digest_len = SHA256_HASH_LENGTH;
 	digests->num_cert = chain.num_cert;
 
@@ -337,6 +383,7 @@ static int attestation_process_challenge_response (struct attestation_master *at
 	uint8_t *buf, size_t buf_len, uint8_t eid)
 {
 	struct device_manager_cert_chain chain;
+	struct hash_engine *hash;
 	uint8_t challenge[ATTESTATION_NONCE_LEN + 2];
 	uint8_t digest[SHA256_HASH_LENGTH];
 	int device_num;
@@ -379,26 +426,33 @@ static int attestation_process_challenge_response (struct attestation_master *at
 	memcpy (&challenge, (uint8_t*) &attestation->challenge[device_num],
 		sizeof (struct attestation_challenge));
 
-	status = attestation->hash->start_sha256 (attestation->hash);
+	status = attestation_acquire_hash (attestation, &hash);
 	if (status != 0) {
 		return status;
 	}
 
-	status = attestation->hash->update (attestation->hash, challenge, sizeof (challenge));
+	status = hash->start_sha256 (hash);
+	if (status != 0) {
+		goto hash_release;
+	}
+
+	status = hash->update (hash, challenge, sizeof (challenge));
 	if (status != 0) {
 		goto hash_cancel;
 	}
 
-	status = attestation->hash->update (attestation->hash, buf, buf_len - sig_len);
+	status = hash->update (hash, buf, buf_len - sig_len);
 	if (status != 0) {
 		goto hash_cancel;
 	}
 
-	status = attestation->hash->finish (attestation->hash, digest, SHA256_HASH_LENGTH);
+	status = hash->finish (hash, digest, SHA256_HASH_LENGTH);
 	if (status != 0) {
 		goto hash_cancel;
 	}
 
+	attestation_release_hash (attestation, hash);
+
 	if (key_type == X509_PUBLIC_KEY_ECC) {
 		struct ecc_public_key ecc_key;
 
@@ -441,17 +495,20 @@ static int attestation_process_challenge_response (struct attestation_master *at
 	return status;
 
 hash_cancel:
-	attestation->hash->cancel (attestation->hash);
+	hash->cancel (hash);
+hash_release:
+	attestation_release_hash (attestation, hash);
 
 	return status;
 }
 
 /**
- * Initialize an master attestation manager.
+ * Initialize the common components of a master attestation manager.
  *
  * @param attestation Master attestation manager instance to initialize.
  * @param riot RIoT key manager.
- * @param hash The hash engine to utilize.
+ * @param hash The dedicated hash engine to utilize.  Null if engines come from a pool.
+ * @param pool The pool to acquire hash engines from.  Null if there is a dedicated engine.
  * @param ecc The ECC engine to utilize.
  * @param rsa The RSA engine to utilize.
  * @param x509 The x509 engine to utilize.
@@ -461,13 +518,13 @@ hash_cancel:
  *
  * @return Initialization status, 0 if success or an error code.
  */
-int attestation_master_init (struct attestation_master *attestation,
-	struct riot_key_manager *riot, struct hash_engine *hash, struct ecc_engine *ecc,
-	struct rsa_engine *rsa, struct x509_engine *x509, struct rng_engine *rng,
-	struct device_manager *device_manager, uint8_t protocol_version)
+static int attestation_master_init_common (struct attestation_master *attestation,
+	struct riot_key_manager *riot, struct hash_engine *hash, struct hash_pool *pool,
+	struct ecc_engine *ecc, struct rsa_engine *rsa, struct x509_engine *x509,
+	struct rng_engine *rng, struct device_manager *device_manager, uint8_t protocol_version)
 {
-	if ((attestation == NULL) || (riot == NULL) || (hash == NULL) || (x509 == NULL) ||
-		(rng == NULL) || (device_manager == NULL) || (ecc == NULL)) {
+	if ((attestation == NULL) || (riot == NULL) || (x509 == NULL) || (rng == NULL) ||
+		(device_manager == NULL) || (ecc == NULL)) {
 		return ATTESTATION_INVALID_ARGUMENT;
 	}
 
@@ -481,6 +538,7 @@ int attestation_master_init (struct attestation_master *attestation,
 
 	attestation->riot = riot;
 	attestation->hash = hash;
+	attestation->pool = pool;
 	attestation->ecc = ecc;
 	attestation->rsa = rsa;
 	attestation->x509 = x509;
@@ -496,6 +554,64 @@ int attestation_master_init (struct attestation_master *attestation,
 	return 0;
 }
 
+/**
+ * Initialize an master attestation manager.
+ *
+ * @param attestation Master attestation manager instance to initialize.
+ * @param riot RIoT key manager.
+ * @param hash The hash engine to utilize.
+ * @param ecc The ECC engine to utilize.
+ * @param rsa The RSA engine to utilize.
+ * @param x509 The x509 engine to utilize.
+ * @param rng The RNG engine to utilize.
+ * @param device_manager Device manager table.
+ * @param protocol_version Cerberus protocol version
+ *
+ * @return Initialization status, 0 if success or an error code.
+ */
+int attestation_master_init (struct attestation_master *attestation,
+	struct riot_key_manager *riot, struct hash_engine *hash, struct ecc_engine *ecc,
+	struct rsa_engine *rsa, struct x509_engine *x509, struct rng_engine *rng,
+	struct device_manager *device_manager, uint8_t protocol_version)
+{
+	if (hash == NULL) {
+		return ATTESTATION_INVALID_ARGUMENT;
+	}
+
+	return attestation_master_init_common (attestation, riot, hash, NULL, ecc, rsa, x509, rng,
+		device_manager, protocol_version);
+}
+
+/**
+ * Initialize a master attestation manager that acquires a hash engine from a pool for each
+ * operation.  Engines are only held while hashing, so certificate digests and challenge responses
+ * for different devices can be processed in parallel with other users of the pool.
+ *
+ * @param attestation Master attestation manager instance to initialize.
+ * @param riot RIoT key manager.
+ * @param pool The pool to acquire hash engines from.
+ * @param ecc The ECC engine to utilize.
+ * @param rsa The RSA engine to utilize.
+ * @param x509 The x509 engine to utilize.
+ * @param rng The RNG engine to utilize.
+ * @param device_manager Device manager table.
+ * @param protocol_version Cerberus protocol version
+ *
+ * @return Initialization status, 0 if success or an error code.
+ */
+int attestation_master_init_pool (struct attestation_master *attestation,
+	struct riot_key_manager *riot, struct hash_pool *pool, struct ecc_engine *ecc,
+	struct rsa_engine *rsa, struct x509_engine *x509, struct rng_engine *rng,
+	struct device_manager *device_manager, uint8_t protocol_version)
+{
+	if (pool == NULL) {
+		return ATTESTATION_INVALID_ARGUMENT;
+	}
+
+	return attestation_master_init_common (attestation, riot, NULL, pool, ecc, rsa, x509, rng,
+		device_manager, protocol_version);
+}
+
 /**
  * Release master attestation manager
  *
@@ -10,6 +10,7 @@
 #include "crypto/ecc.h"
 #include "crypto/rsa.h"
 #include "crypto/hash.h"
+#include "crypto/hash_pool.h"
 #include "crypto/x509.h"
 #include "crypto/rng.h"
 #include "riot/riot_key_manager.h"
@@ -73,6 +74,7 @@ struct attestation_master {
 		size_t buf_len, uint8_t eid);
 
 	struct hash_engine *hash;					   		/**< The hashing engine for attestation authentication operations. */
+	struct hash_pool *pool;								/**< Pool of hash engines to use instead of a dedicated engine. */
 	struct ecc_engine *ecc;						  		/**< The ECC engine for attestation authentication operations. */
 	struct x509_engine *x509;					   		/**< The X509 engine for attestation authentication operations. */
 	struct rng_engine *rng;						   		/**< The RNG engine for attestation authentication operations. */
@@ -88,6 +90,10 @@ int attestation_master_init (struct attestation_master *attestation,
 	struct riot_key_manager *riot, struct hash_engine *hash, struct ecc_engine *ecc,
 	struct rsa_engine *rsa, struct x509_engine *x509, struct rng_engine *rng,
 	struct device_manager *device_manager, uint8_t protocol_version);
+int attestation_master_init_pool (struct attestation_master *attestation,
+	struct riot_key_manager *riot, struct hash_pool *pool, struct ecc_engine *ecc,
+	struct rsa_engine *rsa, struct x509_engine *x509, struct rng_engine *rng,
+	struct device_manager *device_manager, uint8_t protocol_version);
 
 void attestation_master_release (struct attestation_master *attestation);
 
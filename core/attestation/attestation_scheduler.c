@@ -0,0 +1,901 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "platform.h"
+#include "attestation_scheduler.h"
+#include "common/type_cast.h"
+#include "cmd_interface/cerberus_protocol.h"
+#include "cmd_interface/cerberus_protocol_required_commands.h"
+#include "cmd_interface/cerberus_protocol_master_commands.h"
+
+
+/**
+ * Buffer space needed to packetize any attestation request.  Every request fits in a single packet.
+ */
+#define	ATTESTATION_SCHEDULER_REQUEST_BUFFER_LEN		\
+	MCTP_BASE_PROTOCOL_MESSAGE_LEN (1, sizeof (struct cerberus_protocol_challenge))
+
+
+#ifdef CMD_ENABLE_ISSUE_REQUEST
+/**
+ * Find the attestation context for a device.  The scheduler lock must be held.
+ *
+ * @param scheduler The scheduler to query.
+ * @param eid The EID of the device.
+ *
+ * @return The device context or null if the device is not being attested.
+ */
+static struct attestation_scheduler_device* attestation_scheduler_find_device (
+	struct attestation_scheduler *scheduler, uint8_t eid)
+{
+	size_t i;
+
+	for (i = 0; i < scheduler->num_devices; i++) {
+		if ((scheduler->devices[i].state != ATTESTATION_SCHEDULER_STATE_IDLE) &&
+			(scheduler->devices[i].eid == eid)) {
+			return &scheduler->devices[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Determine if a device has completed attestation.
+ *
+ * @param device The device to check.
+ *
+ * @return true if there is no more work for the device.
+ */
+static bool attestation_scheduler_is_device_done (struct attestation_scheduler_device *device)
+{
+	return ((device->state == ATTESTATION_SCHEDULER_STATE_IDLE) ||
+		(device->state == ATTESTATION_SCHEDULER_STATE_AUTHENTICATED) ||
+		(device->state == ATTESTATION_SCHEDULER_STATE_FAILED));
+}
+
+/**
+ * Release the verification slot reserved by a device.  The scheduler lock must be held.
+ *
+ * @param scheduler The scheduler that owns the slot.
+ * @param device The device that reserved the slot.
+ */
+static void attestation_scheduler_release_slot (struct attestation_scheduler *scheduler,
+	struct attestation_scheduler_device *device)
+{
+	if (device->slot >= 0) {
+		scheduler->verify[device->slot].in_use = false;
+		device->slot = -1;
+	}
+}
+
+/**
+ * Reserve a verification slot for a device.  The scheduler lock must be held.
+ *
+ * @param scheduler The scheduler that owns the slots.
+ * @param device The device that needs a slot.
+ *
+ * @return true if a slot was reserved for the device.
+ */
+static bool attestation_scheduler_reserve_slot (struct attestation_scheduler *scheduler,
+	struct attestation_scheduler_device *device)
+{
+	int i;
+
+	if (device->slot >= 0) {
+		return true;
+	}
+
+	for (i = 0; i < ATTESTATION_SCHEDULER_MAX_VERIFY; i++) {
+		if (!scheduler->verify[i].in_use) {
+			scheduler->verify[i].in_use = true;
+			scheduler->verify[i].length = 0;
+			device->slot = i;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Mark attestation of a device as failed.  The scheduler lock must be held, but not the
+ * attestation lock.
+ *
+ * @param scheduler The scheduler attesting the device.
+ * @param device The device that failed attestation.
+ * @param status The reason for the failure.
+ */
+static void attestation_scheduler_fail_device (struct attestation_scheduler *scheduler,
+	struct attestation_scheduler_device *device, int status)
+{
+	int device_num = device - scheduler->devices;
+
+	attestation_scheduler_release_slot (scheduler, device);
+
+	device->state = ATTESTATION_SCHEDULER_STATE_FAILED;
+	device->status = status;
+
+	platform_mutex_lock (&scheduler->attestation_lock);
+
+	if (device_manager_get_device_state (scheduler->device_mgr, device_num) ==
+		DEVICE_MANAGER_AUTHENTICATED) {
+		device_manager_update_device_state (scheduler->device_mgr, device_num,
+			DEVICE_MANAGER_AVAILABLE);
+	}
+
+	platform_mutex_unlock (&scheduler->attestation_lock);
+}
+
+/**
+ * Determine if the response to a request will span multiple packets.
+ *
+ * @param state The state that sends the request.
+ *
+ * @return true if the response needs multiple packets.
+ */
+static bool attestation_scheduler_is_multi_packet (uint8_t state)
+{
+	switch (state) {
+		case ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE:
+			return true;
+
+#ifdef ATTESTATION_SUPPORT_RSA_CHALLENGE
+		case ATTESTATION_SCHEDULER_STATE_CHALLENGE:
+			return true;
+#endif
+
+		default:
+			return false;
+	}
+}
+
+/**
+ * Update the scheduler after a request to a device is no longer in flight.  The scheduler lock
+ * must be held.
+ *
+ * @param scheduler The scheduler attesting the device.
+ * @param device The device whose request has completed.
+ */
+static void attestation_scheduler_request_done (struct attestation_scheduler *scheduler,
+	struct attestation_scheduler_device *device)
+{
+	scheduler->in_flight--;
+
+	if (scheduler->multi_packet == device) {
+		scheduler->multi_packet = NULL;
+	}
+}
+
+/**
+ * Determine if a request can be sent to a device.  The scheduler lock must be held.
+ *
+ * A request whose response spans multiple packets must be the only request in flight, since
+ * responses on the channel are reassembled in a single buffer.  Challenges are only sent when a
+ * verification slot can be reserved for the response.
+ *
+ * @param scheduler The scheduler attesting the device.
+ * @param device The device to check.
+ *
+ * @return true if the request for the current device state can be sent.
+ */
+static bool attestation_scheduler_can_send (struct attestation_scheduler *scheduler,
+	struct attestation_scheduler_device *device)
+{
+	if ((device->state != ATTESTATION_SCHEDULER_STATE_GET_DIGESTS) &&
+		(device->state != ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE) &&
+		(device->state != ATTESTATION_SCHEDULER_STATE_CHALLENGE)) {
+		return false;
+	}
+
+	if ((scheduler->multi_packet != NULL) ||
+		(scheduler->in_flight >= ATTESTATION_SCHEDULER_MAX_IN_FLIGHT)) {
+		return false;
+	}
+
+	if (attestation_scheduler_is_multi_packet (device->state) && (scheduler->in_flight != 0)) {
+		return false;
+	}
+
+	return ((device->state != ATTESTATION_SCHEDULER_STATE_CHALLENGE) ||
+		attestation_scheduler_reserve_slot (scheduler, device));
+}
+
+/**
+ * Move a device to the next state after a request could not be completed.  The request will be
+ * retried if the device has not run out of retries.  The scheduler lock must be held.
+ *
+ * @param scheduler The scheduler attesting the device.
+ * @param device The device whose request failed.
+ * @param retry_state The state that will send the request again.
+ * @param status The reason the request failed.
+ */
+static void attestation_scheduler_retry_request (struct attestation_scheduler *scheduler,
+	struct attestation_scheduler_device *device, uint8_t retry_state, int status)
+{
+	if (device->retries != 0) {
+		device->retries--;
+		device->state = retry_state;
+		attestation_scheduler_release_slot (scheduler, device);
+	}
+	else {
+		attestation_scheduler_fail_device (scheduler, device, status);
+	}
+}
+
+/**
+ * Get the state that will send the request a device is waiting on.
+ *
+ * @param state The current waiting state of the device.
+ *
+ * @return The state to send the request.
+ */
+static uint8_t attestation_scheduler_get_request_state (uint8_t state)
+{
+	switch (state) {
+		case ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS:
+			return ATTESTATION_SCHEDULER_STATE_GET_DIGESTS;
+
+		case ATTESTATION_SCHEDULER_STATE_WAIT_CERTIFICATE:
+			return ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE;
+
+		default:
+			return ATTESTATION_SCHEDULER_STATE_CHALLENGE;
+	}
+}
+
+/**
+ * Determine if a device is waiting for a response.
+ *
+ * @param state The current state of the device.
+ *
+ * @return true if the device is waiting for a response.
+ */
+static bool attestation_scheduler_is_waiting (uint8_t state)
+{
+	return ((state == ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS) ||
+		(state == ATTESTATION_SCHEDULER_STATE_WAIT_CERTIFICATE) ||
+		(state == ATTESTATION_SCHEDULER_STATE_WAIT_CHALLENGE));
+}
+
+/**
+ * Claim a device to process a response.  The device must be waiting for the response that was
+ * received.  The scheduler lock must be held.
+ *
+ * @param scheduler The scheduler attesting the device.
+ * @param eid EID of the device that sent the response.
+ * @param state The state the device must be in to accept the response.
+ *
+ * @return The device that will process the response or null if the response is not expected.
+ */
+static struct attestation_scheduler_device* attestation_scheduler_claim_device (
+	struct attestation_scheduler *scheduler, uint8_t eid, uint8_t state)
+{
+	struct attestation_scheduler_device *device;
+
+	device = attestation_scheduler_find_device (scheduler, eid);
+	if ((device == NULL) || (device->state != state)) {
+		return NULL;
+	}
+
+	device->state = ATTESTATION_SCHEDULER_STATE_PROCESSING;
+	device->retries = ATTESTATION_SCHEDULER_MAX_RETRIES;
+	attestation_scheduler_request_done (scheduler, device);
+
+	return device;
+}
+
+/**
+ * Generate the request that needs to be sent to a device.  The attestation lock must be held.
+ *
+ * @param scheduler The scheduler attesting the device.
+ * @param device The device to generate the request for.
+ * @param state The request state of the device.
+ * @param buf Output buffer for the request.
+ * @param buf_len Length of the output buffer.
+ *
+ * @return Length of the request or an error code.
+ */
+static int attestation_scheduler_generate_request (struct attestation_scheduler *scheduler,
+	struct attestation_scheduler_device *device, uint8_t state, uint8_t *buf, size_t buf_len)
+{
+	switch (state) {
+		case ATTESTATION_SCHEDULER_STATE_GET_DIGESTS:
+			return cerberus_protocol_generate_get_certificate_digest_request (
+				ATTESTATION_RIOT_SLOT_NUM, ATTESTATION_KEY_EXCHANGE_NONE, buf, buf_len);
+
+		case ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE:
+			return cerberus_protocol_generate_get_certificate_request (ATTESTATION_RIOT_SLOT_NUM,
+				device->cert_num, buf, buf_len, 0, 0);
+
+		default:
+			return cerberus_protocol_generate_challenge_request (scheduler->attestation,
+				device->eid, ATTESTATION_RIOT_SLOT_NUM, buf, buf_len);
+	}
+}
+
+/**
+ * Send the next request to a device.  The device is moved to the waiting state before the request
+ * is sent so a response is never missed.  The scheduler lock must be held and will be released
+ * while the request is sent.
+ *
+ * @param scheduler The scheduler attesting the device.
+ * @param device The device to send the request to.
+ */
+static void attestation_scheduler_send_request (struct attestation_scheduler *scheduler,
+	struct attestation_scheduler_device *device)
+{
+	uint8_t request[sizeof (struct cerberus_protocol_challenge)];
+	uint8_t msg_buffer[ATTESTATION_SCHEDULER_REQUEST_BUFFER_LEN];
+	uint8_t state = device->state;
+	uint32_t timeout;
+	int status;
+
+	if (state == ATTESTATION_SCHEDULER_STATE_CHALLENGE) {
+		timeout = device_manager_get_crypto_timeout_by_eid (scheduler->device_mgr, device->eid);
+	}
+	else {
+		timeout = device_manager_get_reponse_timeout_by_eid (scheduler->device_mgr, device->eid);
+	}
+
+	/* Each waiting state immediately follows the state that sends the request. */
+	device->state = state + 1;
+	platform_init_timeout (timeout, &device->timeout);
+	scheduler->in_flight++;
+
+	if (attestation_scheduler_is_multi_packet (state)) {
+		scheduler->multi_packet = device;
+	}
+
+	platform_mutex_unlock (&scheduler->lock);
+
+	platform_mutex_lock (&scheduler->attestation_lock);
+	status = attestation_scheduler_generate_request (scheduler, device, state, request,
+		sizeof (request));
+	platform_mutex_unlock (&scheduler->attestation_lock);
+
+	if (!ROT_IS_ERROR (status)) {
+		status = mctp_interface_send_request (scheduler->mctp, scheduler->channel, device->addr,
+			device->eid, request, status, msg_buffer, sizeof (msg_buffer));
+	}
+
+	platform_mutex_lock (&scheduler->lock);
+
+	if (ROT_IS_ERROR (status) && (device->state == (state + 1))) {
+		attestation_scheduler_request_done (scheduler, device);
+
+		if (status == MCTP_BASE_PROTOCOL_TOO_MANY_REQUESTS) {
+			/* Try again once other requests have completed. */
+			attestation_scheduler_release_slot (scheduler, device);
+			device->state = state;
+		}
+		else {
+			attestation_scheduler_retry_request (scheduler, device, state, status);
+		}
+	}
+}
+
+/**
+ * Notification handler for certificate digest responses.
+ *
+ * @param observer The scheduler receiving the notification.
+ * @param response The response that was received.
+ */
+static void attestation_scheduler_on_get_digest_response (
+	struct cerberus_protocol_observer *observer, struct cmd_interface_msg *response)
+{
+	struct attestation_scheduler *scheduler =
+		TO_DERIVED_TYPE (observer, struct attestation_scheduler, base_observer);
+	struct cerberus_protocol_get_certificate_digest_response *rsp =
+		(struct cerberus_protocol_get_certificate_digest_response*) response->data;
+	struct attestation_scheduler_device *device;
+	struct attestation_chain_digest digests;
+	int status;
+
+	platform_mutex_lock (&scheduler->lock);
+	device = attestation_scheduler_claim_device (scheduler, response->source_eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS);
+	platform_mutex_unlock (&scheduler->lock);
+
+	if (device == NULL) {
+		return;
+	}
+
+	digests.digest = cerberus_protocol_certificate_digests (rsp);
+	digests.digest_len = SHA256_HASH_LENGTH;
+	digests.num_cert = rsp->num_digests;
+
+	platform_mutex_lock (&scheduler->attestation_lock);
+	status = scheduler->attestation->compare_digests (scheduler->attestation, device->eid,
+		&digests);
+	platform_mutex_unlock (&scheduler->attestation_lock);
+
+	platform_mutex_lock (&scheduler->lock);
+
+	if (ROT_IS_ERROR (status)) {
+		attestation_scheduler_fail_device (scheduler, device, status);
+	}
+	else if (status == 0) {
+		device->state = ATTESTATION_SCHEDULER_STATE_CHALLENGE;
+	}
+	else {
+		/* Request every certificate starting with the first one that doesn't match. */
+		device->cert_num = status - 1;
+		device->num_cert = rsp->num_digests;
+		device->state = ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE;
+	}
+
+	platform_mutex_unlock (&scheduler->lock);
+
+	platform_semaphore_post (&scheduler->work_ready);
+}
+
+/**
+ * Notification handler for certificate responses.
+ *
+ * @param observer The scheduler receiving the notification.
+ * @param response The response that was received.
+ */
+static void attestation_scheduler_on_get_certificate_response (
+	struct cerberus_protocol_observer *observer, struct cmd_interface_msg *response)
+{
+	struct attestation_scheduler *scheduler =
+		TO_DERIVED_TYPE (observer, struct attestation_scheduler, base_observer);
+	struct cerberus_protocol_get_certificate_response *rsp =
+		(struct cerberus_protocol_get_certificate_response*) response->data;
+	struct attestation_scheduler_device *device;
+	int status;
+
+	platform_mutex_lock (&scheduler->lock);
+	device = attestation_scheduler_claim_device (scheduler, response->source_eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CERTIFICATE);
+	platform_mutex_unlock (&scheduler->lock);
+
+	if (device == NULL) {
+		return;
+	}
+
+	if ((rsp->slot_num != ATTESTATION_RIOT_SLOT_NUM) || (rsp->cert_num != device->cert_num)) {
+		status = ATTESTATION_SCHEDULER_UNEXPECTED_RESPONSE;
+	}
+	else {
+		platform_mutex_lock (&scheduler->attestation_lock);
+		status = scheduler->attestation->store_certificate (scheduler->attestation, device->eid,
+			rsp->slot_num, rsp->cert_num, cerberus_protocol_certificate (rsp),
+			response->length - sizeof (*rsp));
+		platform_mutex_unlock (&scheduler->attestation_lock);
+	}
+
+	platform_mutex_lock (&scheduler->lock);
+
+	if (status != 0) {
+		attestation_scheduler_fail_device (scheduler, device, status);
+	}
+	else if (++device->cert_num < device->num_cert) {
+		device->state = ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE;
+	}
+	else {
+		device->state = ATTESTATION_SCHEDULER_STATE_CHALLENGE;
+	}
+
+	platform_mutex_unlock (&scheduler->lock);
+
+	platform_semaphore_post (&scheduler->work_ready);
+}
+
+/**
+ * Notification handler for challenge responses.  The response is queued for verification.
+ *
+ * @param observer The scheduler receiving the notification.
+ * @param response The response that was received.
+ */
+static void attestation_scheduler_on_challenge_response (
+	struct cerberus_protocol_observer *observer, struct cmd_interface_msg *response)
+{
+	struct attestation_scheduler *scheduler =
+		TO_DERIVED_TYPE (observer, struct attestation_scheduler, base_observer);
+	struct attestation_scheduler_device *device;
+	size_t length = response->length - sizeof (struct cerberus_protocol_header);
+	bool queued = false;
+
+	platform_mutex_lock (&scheduler->lock);
+
+	device = attestation_scheduler_claim_device (scheduler, response->source_eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CHALLENGE);
+	if (device != NULL) {
+		if (length > sizeof (scheduler->verify[device->slot].response)) {
+			attestation_scheduler_fail_device (scheduler, device,
+				ATTESTATION_SCHEDULER_RESPONSE_TOO_LARGE);
+		}
+		else {
+			memcpy (scheduler->verify[device->slot].response,
+				&response->data[sizeof (struct cerberus_protocol_header)], length);
+			scheduler->verify[device->slot].length = length;
+
+			device->state = ATTESTATION_SCHEDULER_STATE_VERIFY;
+			queued = true;
+		}
+	}
+
+	platform_mutex_unlock (&scheduler->lock);
+
+	if (queued) {
+		platform_semaphore_post (&scheduler->verify_ready);
+	}
+	else if (device != NULL) {
+		platform_semaphore_post (&scheduler->work_ready);
+	}
+}
+
+/**
+ * Initialize a scheduler for attesting many devices concurrently.
+ *
+ * The scheduler must be registered to receive Cerberus protocol responses from the command
+ * interface handling responses for the MCTP layer.
+ *
+ * @param scheduler The scheduler to initialize.
+ * @param attestation The attestation manager to use for processing responses.
+ * @param device_mgr The device manager containing the devices to attest.
+ * @param mctp The MCTP layer to use for sending requests.
+ * @param channel The command channel to use for sending requests.
+ *
+ * @return 0 if the scheduler was successfully initialized or an error code.
+ */
+int attestation_scheduler_init (struct attestation_scheduler *scheduler,
+	struct attestation_master *attestation, struct device_manager *device_mgr,
+	struct mctp_interface *mctp, struct cmd_channel *channel)
+{
+	int status;
+
+	if ((scheduler == NULL) || (attestation == NULL) || (device_mgr == NULL) || (mctp == NULL) ||
+		(channel == NULL)) {
+		return ATTESTATION_SCHEDULER_INVALID_ARGUMENT;
+	}
+
+	memset (scheduler, 0, sizeof (struct attestation_scheduler));
+
+	status = platform_mutex_init (&scheduler->lock);
+	if (status != 0) {
+		return status;
+	}
+
+	status = platform_mutex_init (&scheduler->attestation_lock);
+	if (status != 0) {
+		goto free_lock;
+	}
+
+	status = platform_semaphore_init (&scheduler->work_ready);
+	if (status != 0) {
+		goto free_attestation;
+	}
+
+	status = platform_semaphore_init (&scheduler->verify_ready);
+	if (status != 0) {
+		goto free_work;
+	}
+
+	scheduler->attestation = attestation;
+	scheduler->device_mgr = device_mgr;
+	scheduler->mctp = mctp;
+	scheduler->channel = channel;
+
+	scheduler->base_observer.on_get_digest_response = attestation_scheduler_on_get_digest_response;
+	scheduler->base_observer.on_get_certificate_response =
+		attestation_scheduler_on_get_certificate_response;
+	scheduler->base_observer.on_challenge_response = attestation_scheduler_on_challenge_response;
+
+	return 0;
+
+free_work:
+	platform_semaphore_free (&scheduler->work_ready);
+free_attestation:
+	platform_mutex_free (&scheduler->attestation_lock);
+free_lock:
+	platform_mutex_free (&scheduler->lock);
+	return status;
+}
+
+/**
+ * Release the resources used by an attestation scheduler.
+ *
+ * @param scheduler The scheduler to release.
+ */
+void attestation_scheduler_release (struct attestation_scheduler *scheduler)
+{
+	size_t i;
+
+	if (scheduler != NULL) {
+		for (i = 0; i < scheduler->num_devices; i++) {
+			if (attestation_scheduler_is_waiting (scheduler->devices[i].state)) {
+				mctp_interface_cancel_request (scheduler->mctp, scheduler->devices[i].eid);
+			}
+		}
+
+		platform_free (scheduler->devices);
+		platform_semaphore_free (&scheduler->verify_ready);
+		platform_semaphore_free (&scheduler->work_ready);
+		platform_mutex_free (&scheduler->attestation_lock);
+		platform_mutex_free (&scheduler->lock);
+	}
+}
+
+/**
+ * Start attesting every device in the device manager.  Devices without an assigned EID are
+ * skipped.  Requests are not sent until the scheduler is polled.
+ *
+ * @param scheduler The scheduler to start.
+ *
+ * @return The number of devices that will be attested or an error code.  Use ROT_IS_ERROR to check
+ * the return value.
+ */
+int attestation_scheduler_start_sweep (struct attestation_scheduler *scheduler)
+{
+	struct attestation_scheduler_device *device;
+	size_t num_devices;
+	size_t i;
+	int eid;
+	int addr;
+	int count = 0;
+	int status = 0;
+
+	if (scheduler == NULL) {
+		return ATTESTATION_SCHEDULER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&scheduler->lock);
+
+	for (i = 0; i < scheduler->num_devices; i++) {
+		if (!attestation_scheduler_is_device_done (&scheduler->devices[i])) {
+			status = ATTESTATION_SCHEDULER_SWEEP_IN_PROGRESS;
+			goto exit;
+		}
+	}
+
+	num_devices = scheduler->device_mgr->num_devices;
+	if (num_devices != scheduler->num_devices) {
+		platform_free (scheduler->devices);
+
+		scheduler->devices = platform_calloc (num_devices,
+			sizeof (struct attestation_scheduler_device));
+		if ((scheduler->devices == NULL) && (num_devices != 0)) {
+			scheduler->num_devices = 0;
+			status = ATTESTATION_SCHEDULER_NO_MEMORY;
+			goto exit;
+		}
+
+		scheduler->num_devices = num_devices;
+	}
+
+	for (i = 0; i < scheduler->num_devices; i++) {
+		device = &scheduler->devices[i];
+
+		memset (device, 0, sizeof (struct attestation_scheduler_device));
+		device->slot = -1;
+
+		if (i < ATTESTATION_SCHEDULER_FIRST_DEVICE_NUM) {
+			continue;
+		}
+
+		eid = device_manager_get_device_eid (scheduler->device_mgr, i);
+		addr = device_manager_get_device_addr (scheduler->device_mgr, i);
+		if (ROT_IS_ERROR (eid) || ROT_IS_ERROR (addr) || (eid == MCTP_BASE_PROTOCOL_NULL_EID)) {
+			continue;
+		}
+
+		device->eid = eid;
+		device->addr = addr;
+		device->state = ATTESTATION_SCHEDULER_STATE_GET_DIGESTS;
+		device->retries = ATTESTATION_SCHEDULER_MAX_RETRIES;
+		count++;
+	}
+
+	scheduler->in_flight = 0;
+	scheduler->multi_packet = NULL;
+
+exit:
+	platform_mutex_unlock (&scheduler->lock);
+
+	if (count != 0) {
+		platform_semaphore_post (&scheduler->work_ready);
+	}
+
+	return (status == 0) ? count : status;
+}
+
+/**
+ * Advance attestation for every device in the current sweep.  Requests that have timed out are
+ * retried or failed, and new requests are sent to every device that is ready for one, up to the
+ * maximum number of requests in flight.
+ *
+ * Challenges are only sent when a verification slot is available for the response.  A request
+ * whose response spans multiple packets is only sent when no other request is in flight, and holds
+ * off all other requests until it completes.
+ *
+ * @param scheduler The scheduler to poll.
+ *
+ * @return The number of devices still being attested or an error code.  Use ROT_IS_ERROR to check
+ * the return value.
+ */
+int attestation_scheduler_poll (struct attestation_scheduler *scheduler)
+{
+	struct attestation_scheduler_device *device;
+	size_t i;
+	int active = 0;
+
+	if (scheduler == NULL) {
+		return ATTESTATION_SCHEDULER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&scheduler->lock);
+
+	for (i = 0; i < scheduler->num_devices; i++) {
+		device = &scheduler->devices[i];
+
+		if (attestation_scheduler_is_waiting (device->state) &&
+			(platform_has_timeout_expired (&device->timeout) == 1)) {
+			mctp_interface_cancel_request (scheduler->mctp, device->eid);
+			attestation_scheduler_request_done (scheduler, device);
+
+			attestation_scheduler_retry_request (scheduler, device,
+				attestation_scheduler_get_request_state (device->state),
+				ATTESTATION_SCHEDULER_RESPONSE_TIMEOUT);
+		}
+
+		if (attestation_scheduler_can_send (scheduler, device)) {
+			attestation_scheduler_send_request (scheduler, device);
+		}
+
+		if (!attestation_scheduler_is_device_done (device)) {
+			active++;
+		}
+	}
+
+	platform_mutex_unlock (&scheduler->lock);
+
+	return active;
+}
+
+/**
+ * Verify the next challenge response waiting in the verification queue.  This must only be called
+ * from a single context.
+ *
+ * @param scheduler The scheduler with responses to verify.
+ *
+ * @return 0 if a response was verified, regardless of the verification result, or an error code.
+ * ATTESTATION_SCHEDULER_VERIFY_QUEUE_EMPTY is returned when there was nothing to verify.
+ */
+int attestation_scheduler_verify_next (struct attestation_scheduler *scheduler)
+{
+	struct attestation_scheduler_device *device = NULL;
+	struct attestation_scheduler_verify_slot *slot;
+	size_t i;
+	int status;
+
+	if (scheduler == NULL) {
+		return ATTESTATION_SCHEDULER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&scheduler->lock);
+
+	for (i = 0; (i < scheduler->num_devices) && (device == NULL); i++) {
+		if (scheduler->devices[i].state == ATTESTATION_SCHEDULER_STATE_VERIFY) {
+			device = &scheduler->devices[i];
+			device->state = ATTESTATION_SCHEDULER_STATE_VERIFYING;
+		}
+	}
+
+	platform_mutex_unlock (&scheduler->lock);
+
+	if (device == NULL) {
+		return ATTESTATION_SCHEDULER_VERIFY_QUEUE_EMPTY;
+	}
+
+	slot = &scheduler->verify[device->slot];
+
+	platform_mutex_lock (&scheduler->attestation_lock);
+	status = scheduler->attestation->process_challenge_response (scheduler->attestation,
+		slot->response, slot->length, device->eid);
+	platform_mutex_unlock (&scheduler->attestation_lock);
+
+	platform_mutex_lock (&scheduler->lock);
+
+	if (status == 0) {
+		attestation_scheduler_release_slot (scheduler, device);
+		device->state = ATTESTATION_SCHEDULER_STATE_AUTHENTICATED;
+		device->status = 0;
+	}
+	else {
+		attestation_scheduler_fail_device (scheduler, device, status);
+	}
+
+	platform_mutex_unlock (&scheduler->lock);
+
+	/* A verification slot is now available for another challenge. */
+	platform_semaphore_post (&scheduler->work_ready);
+
+	return 0;
+}
+
+/**
+ * Wait until there may be new requests to send.  This happens when responses are received,
+ * verification completes, or a new sweep is started.
+ *
+ * @param scheduler The scheduler to wait on.
+ * @param timeout_ms The maximum amount of time to wait, in milliseconds.  This should be short
+ * enough to detect request timeouts.
+ *
+ * @return 0 if the scheduler should be polled, 1 if the wait timed out, or an error code.
+ */
+int attestation_scheduler_wait_for_work (struct attestation_scheduler *scheduler,
+	uint32_t timeout_ms)
+{
+	if (scheduler == NULL) {
+		return ATTESTATION_SCHEDULER_INVALID_ARGUMENT;
+	}
+
+	return platform_semaphore_wait (&scheduler->work_ready, timeout_ms);
+}
+
+/**
+ * Wait until a challenge response is queued for verification.
+ *
+ * @param scheduler The scheduler to wait on.
+ * @param timeout_ms The maximum amount of time to wait, in milliseconds.  Set to 0 to wait
+ * forever.
+ *
+ * @return 0 if a response may be ready for verification, 1 if the wait timed out, or an error
+ * code.
+ */
+int attestation_scheduler_wait_for_verify (struct attestation_scheduler *scheduler,
+	uint32_t timeout_ms)
+{
+	if (scheduler == NULL) {
+		return ATTESTATION_SCHEDULER_INVALID_ARGUMENT;
+	}
+
+	return platform_semaphore_wait (&scheduler->verify_ready, timeout_ms);
+}
+
+/**
+ * Get the attestation state of a device from the current or last sweep.
+ *
+ * @param scheduler The scheduler attesting the device.
+ * @param eid EID of the device to query.
+ * @param result Optional output for the result of the last attestation.  This will be 0 if the
+ * device was authenticated or the reason attestation failed.
+ *
+ * @return The attestation state of the device or an error code.  Use ROT_IS_ERROR to check the
+ * return value.
+ */
+int attestation_scheduler_get_device_state (struct attestation_scheduler *scheduler, uint8_t eid,
+	int *result)
+{
+	struct attestation_scheduler_device *device;
+	int state;
+
+	if (scheduler == NULL) {
+		return ATTESTATION_SCHEDULER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&scheduler->lock);
+
+	device = attestation_scheduler_find_device (scheduler, eid);
+	if (device != NULL) {
+		state = device->state;
+		if (result != NULL) {
+			*result = device->status;
+		}
+	}
+	else {
+		state = ATTESTATION_SCHEDULER_UNKNOWN_DEVICE;
+	}
+
+	platform_mutex_unlock (&scheduler->lock);
+
+	return state;
+}
+#endif
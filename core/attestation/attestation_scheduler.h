@@ -0,0 +1,163 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef ATTESTATION_SCHEDULER_H_
+#define ATTESTATION_SCHEDULER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "platform.h"
+#include "status/rot_status.h"
+#include "crypto/hash.h"
+#include "crypto/rsa.h"
+#include "cmd_interface/cmd_channel.h"
+#include "cmd_interface/device_manager.h"
+#include "cmd_interface/cerberus_protocol_observer.h"
+#include "mctp/mctp_interface.h"
+#include "attestation.h"
+#include "attestation_master.h"
+
+
+/* Configurable scheduler parameters.  Defaults can be overridden in platform_config.h. */
+#include "platform_config.h"
+#ifndef ATTESTATION_SCHEDULER_MAX_IN_FLIGHT
+#define	ATTESTATION_SCHEDULER_MAX_IN_FLIGHT				MCTP_INTERFACE_MAX_PENDING_REQUESTS
+#endif
+#ifndef ATTESTATION_SCHEDULER_MAX_VERIFY
+#define	ATTESTATION_SCHEDULER_MAX_VERIFY				4
+#endif
+#ifndef ATTESTATION_SCHEDULER_MAX_RETRIES
+#define	ATTESTATION_SCHEDULER_MAX_RETRIES				2
+#endif
+#ifndef ATTESTATION_SCHEDULER_MAX_CHALLENGE_RSP_LEN
+#define	ATTESTATION_SCHEDULER_MAX_CHALLENGE_RSP_LEN		\
+	(ATTESTATION_CHALLENGE_RSP_LEN + SHA512_HASH_LENGTH + RSA_MAX_KEY_LENGTH)
+#endif
+#ifndef ATTESTATION_SCHEDULER_FIRST_DEVICE_NUM
+#define	ATTESTATION_SCHEDULER_FIRST_DEVICE_NUM			\
+	(DEVICE_MANAGER_MCTP_BRIDGE_DEVICE_NUM + 1)
+#endif
+
+
+/**
+ * Attestation states for a single device.
+ */
+enum attestation_scheduler_state {
+	ATTESTATION_SCHEDULER_STATE_IDLE = 0,				/**< The device has not been scheduled for attestation. */
+	ATTESTATION_SCHEDULER_STATE_GET_DIGESTS,			/**< Certificate digests need to be requested. */
+	ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS,			/**< Waiting for the certificate digests. */
+	ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE,		/**< A certificate needs to be requested. */
+	ATTESTATION_SCHEDULER_STATE_WAIT_CERTIFICATE,		/**< Waiting for a certificate. */
+	ATTESTATION_SCHEDULER_STATE_CHALLENGE,				/**< The device needs to be challenged. */
+	ATTESTATION_SCHEDULER_STATE_WAIT_CHALLENGE,			/**< Waiting for the challenge response. */
+	ATTESTATION_SCHEDULER_STATE_PROCESSING,				/**< A response from the device is being processed. */
+	ATTESTATION_SCHEDULER_STATE_VERIFY,					/**< The challenge response is waiting to be verified. */
+	ATTESTATION_SCHEDULER_STATE_VERIFYING,				/**< The challenge response is being verified. */
+	ATTESTATION_SCHEDULER_STATE_AUTHENTICATED,			/**< The device was successfully attested. */
+	ATTESTATION_SCHEDULER_STATE_FAILED,					/**< Attestation of the device failed. */
+};
+
+/**
+ * Attestation context for a single device.
+ */
+struct attestation_scheduler_device {
+	platform_clock timeout;								/**< Expiration time for the outstanding request. */
+	int status;											/**< Result of the last attestation of the device. */
+	uint8_t eid;										/**< EID of the device. */
+	uint8_t addr;										/**< SMBus address of the device. */
+	uint8_t state;										/**< Current attestation state of the device. */
+	uint8_t cert_num;									/**< The next certificate to request. */
+	uint8_t num_cert;									/**< Number of certificates in the device chain. */
+	uint8_t retries;									/**< Remaining retries for the current request. */
+	int8_t slot;										/**< Verification slot reserved for the device. */
+};
+
+/**
+ * Storage for a challenge response waiting for verification.
+ */
+struct attestation_scheduler_verify_slot {
+	uint8_t response[ATTESTATION_SCHEDULER_MAX_CHALLENGE_RSP_LEN];	/**< The challenge response. */
+	size_t length;										/**< Length of the challenge response. */
+	bool in_use;										/**< Flag indicating the slot is reserved. */
+};
+
+/**
+ * Scheduler to attest many devices concurrently.  Requests to different devices are kept in flight
+ * at the same time, with each device progressing through its own sequence of certificate digests,
+ * certificate, and challenge requests.  A sweep across all devices takes about as long as the
+ * slowest device rather than the sum of all of them.
+ *
+ * Requests are sent by {@link attestation_scheduler_poll}.  Responses are received through the
+ * Cerberus protocol observer interface.  Challenge responses are verified by calling
+ * {@link attestation_scheduler_verify_next} from a single worker context.  At most
+ * ATTESTATION_SCHEDULER_MAX_VERIFY challenges are outstanding or waiting for verification at any
+ * time.
+ *
+ * Responses for one channel are reassembled by the MCTP layer in a single buffer, so a request
+ * whose response spans multiple packets is only sent when no other request is in flight, and no
+ * other requests are sent until it completes.  Certificate requests always need multiple packets.
+ * Challenges do as well when RSA challenges are supported.
+ *
+ * All calls into the attestation manager and updates to the device manager are serialized by the
+ * scheduler.  Engines used by the attestation manager only need to be thread-safe if they are
+ * shared with other components.
+ *
+ * The scheduler is only available when CMD_ENABLE_ISSUE_REQUEST is defined.
+ */
+struct attestation_scheduler {
+	struct cerberus_protocol_observer base_observer;	/**< Base observer for receiving responses. */
+	struct attestation_master *attestation;				/**< Attestation manager for processing responses. */
+	struct device_manager *device_mgr;					/**< Device manager with the devices to attest. */
+	struct mctp_interface *mctp;						/**< MCTP layer for sending requests. */
+	struct cmd_channel *channel;						/**< Channel for sending requests. */
+	struct attestation_scheduler_device *devices;		/**< Attestation state for each device. */
+	size_t num_devices;									/**< Number of entries in the device list. */
+	struct attestation_scheduler_verify_slot
+		verify[ATTESTATION_SCHEDULER_MAX_VERIFY];		/**< Challenge responses waiting for verification. */
+	size_t in_flight;									/**< Number of requests waiting for a response. */
+	struct attestation_scheduler_device *multi_packet;	/**< Device with a multi-packet response in flight. */
+	platform_mutex lock;								/**< Synchronization for device state. */
+	platform_mutex attestation_lock;					/**< Synchronization for the attestation and device managers. */
+	platform_semaphore work_ready;						/**< Signal that requests can be sent. */
+	platform_semaphore verify_ready;					/**< Signal that a challenge response can be verified. */
+};
+
+
+int attestation_scheduler_init (struct attestation_scheduler *scheduler,
+	struct attestation_master *attestation, struct device_manager *device_mgr,
+	struct mctp_interface *mctp, struct cmd_channel *channel);
+void attestation_scheduler_release (struct attestation_scheduler *scheduler);
+
+int attestation_scheduler_start_sweep (struct attestation_scheduler *scheduler);
+int attestation_scheduler_poll (struct attestation_scheduler *scheduler);
+int attestation_scheduler_verify_next (struct attestation_scheduler *scheduler);
+
+int attestation_scheduler_wait_for_work (struct attestation_scheduler *scheduler,
+	uint32_t timeout_ms);
+int attestation_scheduler_wait_for_verify (struct attestation_scheduler *scheduler,
+	uint32_t timeout_ms);
+
+int attestation_scheduler_get_device_state (struct attestation_scheduler *scheduler, uint8_t eid,
+	int *result);
+
+
+#define	ATTESTATION_SCHEDULER_ERROR(code)		\
+	ROT_ERROR (ROT_MODULE_ATTESTATION_SCHEDULER, code)
+
+/**
+ * Error codes that can be generated by the attestation scheduler.
+ */
+enum {
+	ATTESTATION_SCHEDULER_INVALID_ARGUMENT = ATTESTATION_SCHEDULER_ERROR (0x00),		/**< Input parameter is null or not valid. */
+	ATTESTATION_SCHEDULER_NO_MEMORY = ATTESTATION_SCHEDULER_ERROR (0x01),				/**< Memory allocation failed. */
+	ATTESTATION_SCHEDULER_SWEEP_IN_PROGRESS = ATTESTATION_SCHEDULER_ERROR (0x02),		/**< Devices from the previous sweep are still being attested. */
+	ATTESTATION_SCHEDULER_RESPONSE_TIMEOUT = ATTESTATION_SCHEDULER_ERROR (0x03),		/**< The device did not respond to a request. */
+	ATTESTATION_SCHEDULER_RESPONSE_TOO_LARGE = ATTESTATION_SCHEDULER_ERROR (0x04),		/**< The challenge response is larger than supported. */
+	ATTESTATION_SCHEDULER_UNEXPECTED_RESPONSE = ATTESTATION_SCHEDULER_ERROR (0x05),		/**< The response does not match the request. */
+	ATTESTATION_SCHEDULER_UNKNOWN_DEVICE = ATTESTATION_SCHEDULER_ERROR (0x06),			/**< The device is not being attested. */
+	ATTESTATION_SCHEDULER_VERIFY_QUEUE_EMPTY = ATTESTATION_SCHEDULER_ERROR (0x07),		/**< No challenge responses are waiting to be verified. */
+};
+
+
+#endif /* ATTESTATION_SCHEDULER_H_ */
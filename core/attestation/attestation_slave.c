@@ -14,6 +14,9 @@ static int attestation_slave_get_digests (struct attestation_slave *attestation,
 	const struct der_cert *root_ca;
 	const struct der_cert *int_ca;
 	const struct der_cert *aux_cert = NULL;
+	struct attestation_slave_chain_digests *cache;
+	uint32_t riot_version;
+	uint32_t aux_version;
 	size_t offset = 0;
 	int status;
 
@@ -65,6 +68,20 @@ static int attestation_slave_get_digests (struct attestation_slave *attestation,
 
 	platform_mutex_lock (&attestation->lock);
 
+	/* The certificates only change when the RIoT key manager or auxiliary attestation handler
+	 * updates them, so digests don't need to be recalculated unless the certificates have a new
+	 * version. */
+	cache = &attestation->digests[slot_num];
+	riot_version = riot_key_manager_get_certificate_version (attestation->riot);
+	aux_version = aux_attestation_get_certificate_version (attestation->aux);
+
+	if (cache->valid && (cache->num_cert == *num_cert) && (cache->riot_version == riot_version) &&
+		(cache->aux_version == aux_version)) {
+		status = SHA256_HASH_LENGTH * (*num_cert);
+		memcpy (buf, cache->digests, status);
+		goto unlock;
+	}
+
 	if (root_ca != NULL) {
 		status = attestation->hash->calculate_sha256 (attestation->hash, root_ca->cert,
 			root_ca->length, buf, SHA256_HASH_LENGTH);
@@ -110,6 +127,12 @@ static int attestation_slave_get_digests (struct attestation_slave *attestation,
 
 	status = offset + SHA256_HASH_LENGTH;
 
+	memcpy (cache->digests, buf, status);
+	cache->num_cert = *num_cert;
+	cache->riot_version = riot_version;
+	cache->aux_version = aux_version;
+	cache->valid = true;
+
 unlock:
 	platform_mutex_unlock (&attestation->lock);
 exit:
@@ -331,8 +354,14 @@ static int attestation_slave_challenge_response (struct attestation_slave *attes
 		goto cleanup;
 	}
 
-	status = attestation->ecc->sign (attestation->ecc, &attestation->ecc_priv_key, buf_hash,
-		SHA256_HASH_LENGTH, buf + response_len, buf_len - response_len);
+	if (attestation->nonce_pool_enabled) {
+		status = ecc_nonce_pool_sign (&attestation->nonce_pool, buf_hash, SHA256_HASH_LENGTH,
+			buf + response_len, buf_len - response_len);
+	}
+	else {
+		status = attestation->ecc->sign (attestation->ecc, &attestation->ecc_priv_key, buf_hash,
+			SHA256_HASH_LENGTH, buf + response_len, buf_len - response_len);
+	}
 	if (ROT_IS_ERROR (status)) {
 		goto unlock;
 	}
@@ -550,7 +579,74 @@ int attestation_slave_init_no_aux (struct attestation_slave *attestation,
 void attestation_slave_release (struct attestation_slave *attestation)
 {
 	if (attestation) {
+		if (attestation->nonce_pool_enabled) {
+			ecc_nonce_pool_release (&attestation->nonce_pool);
+		}
+
 		attestation->ecc->release_key_pair (attestation->ecc, &attestation->ecc_priv_key, NULL);
 		platform_mutex_free (&attestation->lock);
 	}
 }
+
+/**
+ * Sign challenge responses using nonces precomputed for the alias key.  This moves the expensive
+ * part of signature generation out of the challenge path.  The nonces must be generated by calling
+ * {@link attestation_slave_refill_nonce_pool} from a background context.  Challenges received while
+ * no nonces are available are signed normally.
+ *
+ * If the nonce pool is refilled from a different task than challenges are processed, the ECC
+ * engine used by the attestation manager must be safe to call from multiple threads.
+ *
+ * @param attestation The slave attestation manager to update.
+ * @param capacity The number of nonces to keep available.
+ *
+ * @return 0 if the nonce pool was enabled or an error code.
+ */
+int attestation_slave_enable_nonce_pool (struct attestation_slave *attestation, size_t capacity)
+{
+	int status;
+
+	if (attestation == NULL) {
+		return ATTESTATION_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&attestation->lock);
+
+	if (attestation->nonce_pool_enabled) {
+		status = ATTESTATION_UNSUPPORTED_OPERATION;
+		goto exit;
+	}
+
+	status = ecc_nonce_pool_init (&attestation->nonce_pool, attestation->ecc,
+		&attestation->ecc_priv_key, capacity);
+	if (status == 0) {
+		attestation->nonce_pool_enabled = true;
+	}
+
+exit:
+	platform_mutex_unlock (&attestation->lock);
+	return status;
+}
+
+/**
+ * Generate nonces for signing challenge responses until the nonce pool is full.  This should be
+ * called periodically from a low priority context.  Nothing is done if the nonce pool has not been
+ * enabled.
+ *
+ * @param attestation The slave attestation manager to refill.
+ *
+ * @return The number of nonces that were generated or an error code.  Use ROT_IS_ERROR to check
+ * the return value.
+ */
+int attestation_slave_refill_nonce_pool (struct attestation_slave *attestation)
+{
+	if (attestation == NULL) {
+		return ATTESTATION_INVALID_ARGUMENT;
+	}
+
+	if (!attestation->nonce_pool_enabled) {
+		return 0;
+	}
+
+	return ecc_nonce_pool_refill (&attestation->nonce_pool);
+}
@@ -9,6 +9,7 @@
 #include "status/rot_status.h"
 #include "platform.h"
 #include "crypto/ecc.h"
+#include "crypto/ecc_nonce_pool.h"
 #include "crypto/hash.h"
 #include "crypto/rng.h"
 #include "common/certificate.h"
@@ -18,6 +19,22 @@
 #include "attestation/attestation.h"
 
 
+/**
+ * The maximum number of certificates in a certificate chain reported by the attestation manager.
+ */
+#define	ATTESTATION_SLAVE_MAX_CHAIN_LENGTH		4
+
+/**
+ * Cached digests for the certificates in a certificate chain.
+ */
+struct attestation_slave_chain_digests {
+	uint8_t digests[ATTESTATION_SLAVE_MAX_CHAIN_LENGTH][SHA256_HASH_LENGTH];	/**< Digest of each certificate in the chain. */
+	uint8_t num_cert;						/**< Number of certificates in the chain. */
+	uint32_t riot_version;					/**< Version of the RIoT certificates used for the digests. */
+	uint32_t aux_version;					/**< Version of the auxiliary certificate used for the digests. */
+	bool valid;								/**< Flag indicating the cached digests are valid. */
+};
+
 struct attestation_slave {
 	/**
 	 * Get the digests for all certificates in the certificate chain utilized by the attestation
@@ -132,6 +149,9 @@ struct attestation_slave {
 	uint8_t key_exchange_algorithm;			/**< Key exchange algorithm requested by caller. */
 	uint8_t min_protocol_version;			/**< Minimum protocol version supported by the device. */
 	uint8_t max_protocol_version;			/**< Maximum protocol version supported by the device. */
+	struct attestation_slave_chain_digests digests[ATTESTATION_AUX_SLOT_NUM + 1];	/**< Cached certificate digests for each slot. */
+	struct ecc_nonce_pool nonce_pool;		/**< Precomputed nonces for signing challenge responses. */
+	bool nonce_pool_enabled;				/**< Flag indicating the nonce pool is in use. */
 	platform_mutex lock;					/**< Synchronization for shared handlers. */
 };
 
@@ -147,5 +167,8 @@ int attestation_slave_init_no_aux (struct attestation_slave *attestation,
 
 void attestation_slave_release (struct attestation_slave *attestation);
 
+int attestation_slave_enable_nonce_pool (struct attestation_slave *attestation, size_t capacity);
+int attestation_slave_refill_nonce_pool (struct attestation_slave *attestation);
+
 
 #endif /* ATTESTATION_SLAVE_H_ */
@@ -66,6 +66,7 @@ static void aux_attestation_free_cert (struct aux_attestation *aux)
 		aux->cert.cert = NULL;
 		aux->cert.length = 0;
 		aux->is_static = false;
+		aux->cert_version++;
 	}
 }
 
@@ -223,6 +224,7 @@ int aux_attestation_create_certificate (struct aux_attestation *aux, struct x509
 	}
 	status = x509->get_certificate_der (x509, &attestation_cert, (uint8_t**) &aux->cert.cert,
 		&aux->cert.length);
+	aux->cert_version++;
 
 	x509->release_certificate (x509, &attestation_cert);
 exit_free_ca:
@@ -261,6 +263,7 @@ int aux_attestation_set_certificate (struct aux_attestation *aux, uint8_t *cert,
 
 	aux->cert.cert = cert;
 	aux->cert.length = length;
+	aux->cert_version++;
 
 	return 0;
 }
@@ -308,6 +311,24 @@ const struct der_cert* aux_attestation_get_certificate (struct aux_attestation *
 	}
 }
 
+/**
+ * Get the current version of the certificate for the attestation key.  The version changes any time
+ * the certificate is created, provisioned, or invalidated.
+ *
+ * @param aux The attestation handler to query.
+ *
+ * @return The certificate version.
+ */
+uint32_t aux_attestation_get_certificate_version (struct aux_attestation *aux)
+{
+	if (aux) {
+		return aux->cert_version;
+	}
+	else {
+		return 0;
+	}
+}
+
 /**
  * Process an attestation request to unseal the encrypted attestation data.
  *
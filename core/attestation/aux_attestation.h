@@ -68,6 +68,7 @@ struct aux_attestation {
 	struct ecc_engine *ecc;			/**< Interface for ECC unsealing operations. */
 	struct der_cert cert;			/**< The certificate for the attestation private key. */
 	bool is_static;					/**< Flag indicating if the certificate is in static memory. */
+	uint32_t cert_version;			/**< Counter incremented when the certificate changes. */
 };
 
 
@@ -85,6 +86,7 @@ int aux_attestation_set_certificate (struct aux_attestation *aux, uint8_t *cert,
 int aux_attestation_set_static_certificate (struct aux_attestation *aux, const uint8_t *cert,
 	size_t length);
 const struct der_cert* aux_attestation_get_certificate (struct aux_attestation *aux);
+uint32_t aux_attestation_get_certificate_version (struct aux_attestation *aux);
 
 int aux_attestation_unseal (struct aux_attestation *aux, struct hash_engine *hash,
 	struct pcr_store *pcr, enum aux_attestation_key_length key_type, const uint8_t *seed,
@@ -10,6 +10,20 @@
 #include "pcr.h"
 
 
+/**
+ * Mark the aggregated measurements starting at an index as needing to be recomputed.  This must be
+ * called with the PCR lock held.
+ *
+ * @param pcr The PCR bank being updated.
+ * @param measurement_index The index of the measurement that changed.
+ */
+static void pcr_mark_stale (struct pcr_bank *pcr, uint8_t measurement_index)
+{
+	if (measurement_index < pcr->first_stale) {
+		pcr->first_stale = measurement_index;
+	}
+}
+
 /**
  * Common function to update digest in PCR bank's list of measurements
  *
@@ -42,6 +56,7 @@ static int pcr_update_digest_common (struct pcr_bank *pcr, uint8_t measurement_i
 	memcpy (pcr->measurement_list[measurement_index].digest, digest, digest_len);
 	pcr->measurement_list[measurement_index].measurement_config = measurement_config;
 	pcr->measurement_list[measurement_index].version = version;
+	pcr_mark_stale (pcr, measurement_index);
 
 	platform_mutex_unlock (&pcr->lock);
 
@@ -340,7 +355,9 @@ int pcr_get_event_type (struct pcr_bank *pcr, uint8_t measurement_index, uint32_
 }
 
 /**
- * Compute aggregate of all measurements that have added to PCR bank
+ * Compute aggregate of all measurements that have added to PCR bank.  Aggregated measurements are
+ * cached, so only measurements starting from the lowest index that has changed since the previous
+ * computation will be extended.
  *
  * @param pcr The PCR bank to compute aggregate measurement of
  * @param hash Hashing engine to utilize
@@ -364,7 +381,13 @@ int pcr_compute (struct pcr_bank *pcr, struct hash_engine *hash, uint8_t *measur
 	}
 
 	if (!pcr->explicit_measurement) {
-		for (i_measurement = 0; i_measurement < (int) pcr->num_measurements; ++i_measurement) {
+		i_measurement = pcr->first_stale;
+		if (i_measurement != 0) {
+			memcpy (prev_measurement, pcr->measurement_list[i_measurement - 1].measurement,
+				sizeof (prev_measurement));
+		}
+
+		for (; i_measurement < (int) pcr->num_measurements; ++i_measurement) {
 			status = hash->start_sha256 (hash);
 			if (status != 0) {
 				goto exit;
@@ -388,6 +411,7 @@ int pcr_compute (struct pcr_bank *pcr, struct hash_engine *hash, uint8_t *measur
 
 			memcpy (pcr->measurement_list[i_measurement].measurement, prev_measurement,
 				sizeof (prev_measurement));
+			pcr->first_stale = i_measurement + 1;
 		}
 	}
 	else {
@@ -746,6 +770,7 @@ int pcr_invalidate_measurement_index (struct pcr_bank *pcr, uint8_t measurement_
 
 	memset (pcr->measurement_list[measurement_index].digest, 0,
 		sizeof (pcr->measurement_list[measurement_index].digest));
+	pcr_mark_stale (pcr, measurement_index);
 
 	platform_mutex_unlock (&pcr->lock);
 
@@ -44,6 +44,7 @@ struct pcr_bank {
 	struct pcr_measurement *measurement_list;				/**< List of measurements */
 	size_t num_measurements;								/**< Number of measurements */
 	bool explicit_measurement;								/**< PCR bank contains an explicit measurement */
+	size_t first_stale;										/**< Lowest index with an out of date aggregated measurement */
 	platform_mutex lock;									/**< Synchronization lock */
 };
 
@@ -49,6 +49,40 @@ int pcr_store_init (struct pcr_store *store, uint8_t *num_pcr_measurements, size
 		}
 	}
 
+	store->log_cache = NULL;
+	store->log_cache_valid = false;
+	store->log_cache_generation = 0;
+	store->generation = 0;
+
+	status = pcr_store_get_attestation_log_size (store);
+	if (ROT_IS_ERROR (status)) {
+		goto release_banks;
+	}
+
+	store->log_cache_length = status;
+	if (store->log_cache_length != 0) {
+		store->log_cache = platform_malloc (store->log_cache_length);
+		if (store->log_cache == NULL) {
+			status = PCR_NO_MEMORY;
+			goto release_banks;
+		}
+	}
+
+	status = platform_mutex_init (&store->log_lock);
+	if (status != 0) {
+		platform_free (store->log_cache);
+		goto release_banks;
+	}
+
+	return 0;
+
+release_banks:
+	for (i_pcr = 0; i_pcr < num_pcr; ++i_pcr) {
+		pcr_release (&store->banks[i_pcr]);
+	}
+
+	platform_free (store->banks);
+
 	return status;
 }
 
@@ -67,9 +101,24 @@ void pcr_store_release (struct pcr_store *store)
 		}
 
 		platform_free (store->banks);
+		platform_free (store->log_cache);
+		platform_mutex_free (&store->log_lock);
 	}
 }
 
+/**
+ * Indicate that a measurement in the PCR store has changed, invalidating any attestation log
+ * snapshot.
+ *
+ * @param store The PCR store that was updated.
+ */
+static void pcr_store_measurement_changed (struct pcr_store *store)
+{
+	platform_mutex_lock (&store->log_lock);
+	store->generation++;
+	platform_mutex_unlock (&store->log_lock);
+}
+
 /**
  * Indicate if a measurement type is valid for the PCR store.
  *
@@ -124,6 +173,7 @@ int pcr_store_update_digest (struct pcr_store *store, uint16_t measurement_type,
 {
 	uint8_t pcr_bank = (uint8_t) (measurement_type >> 8);
 	uint8_t measurement_index = (uint8_t) measurement_type;
+	int status;
 
 	if (store == NULL) {
 		return PCR_INVALID_ARGUMENT;
@@ -133,7 +183,12 @@ int pcr_store_update_digest (struct pcr_store *store, uint16_t measurement_type,
 		return PCR_INVALID_PCR;
 	}
 
-	return pcr_update_digest (&store->banks[pcr_bank], measurement_index, digest, digest_len);
+	status = pcr_update_digest (&store->banks[pcr_bank], measurement_index, digest, digest_len);
+	if (status == 0) {
+		pcr_store_measurement_changed (store);
+	}
+
+	return status;
 }
 
 /**
@@ -154,6 +209,7 @@ int pcr_store_update_buffer (struct pcr_store *store, struct hash_engine *hash,
 {
 	uint8_t pcr_bank = (uint8_t) (measurement_type >> 8);
 	uint8_t measurement_index = (uint8_t) measurement_type;
+	int status;
 
 	if (store == NULL) {
 		return PCR_INVALID_ARGUMENT;
@@ -163,8 +219,13 @@ int pcr_store_update_buffer (struct pcr_store *store, struct hash_engine *hash,
 		return PCR_INVALID_PCR;
 	}
 
-	return pcr_update_buffer (&store->banks[pcr_bank], hash, measurement_index, buf, buf_len,
+	status = pcr_update_buffer (&store->banks[pcr_bank], hash, measurement_index, buf, buf_len,
 		include_event);
+	if (status == 0) {
+		pcr_store_measurement_changed (store);
+	}
+
+	return status;
 }
 
 /**
@@ -187,6 +248,7 @@ int pcr_store_update_versioned_buffer (struct pcr_store *store, struct hash_engi
 {
 	uint8_t pcr_bank = (uint8_t) (measurement_type >> 8);
 	uint8_t measurement_index = (uint8_t) measurement_type;
+	int status;
 
 	if (store == NULL) {
 		return PCR_INVALID_ARGUMENT;
@@ -196,8 +258,13 @@ int pcr_store_update_versioned_buffer (struct pcr_store *store, struct hash_engi
 		return PCR_INVALID_PCR;
 	}
 
-	return pcr_update_versioned_buffer (&store->banks[pcr_bank], hash, measurement_index, buf,
+	status = pcr_update_versioned_buffer (&store->banks[pcr_bank], hash, measurement_index, buf,
 		buf_len, include_event, version);
+	if (status == 0) {
+		pcr_store_measurement_changed (store);
+	}
+
+	return status;
 }
 
 /**
@@ -214,6 +281,7 @@ int pcr_store_update_event_type (struct pcr_store *store, uint16_t measurement_t
 {
 	uint8_t pcr_bank = (uint8_t) (measurement_type >> 8);
 	uint8_t measurement_index = (uint8_t) measurement_type;
+	int status;
 
 	if (store == NULL) {
 		return PCR_INVALID_ARGUMENT;
@@ -223,7 +291,12 @@ int pcr_store_update_event_type (struct pcr_store *store, uint16_t measurement_t
 		return PCR_INVALID_PCR;
 	}
 
-	return pcr_update_event_type (&store->banks[pcr_bank], measurement_index, event_type);
+	status = pcr_update_event_type (&store->banks[pcr_bank], measurement_index, event_type);
+	if (status == 0) {
+		pcr_store_measurement_changed (store);
+	}
+
+	return status;
 }
 
 /**
@@ -344,6 +417,7 @@ int pcr_store_invalidate_measurement (struct pcr_store *store, uint16_t measurem
 {
 	uint8_t pcr_bank = (uint8_t)(measurement_type >> 8);
 	uint8_t measurement_index = (uint8_t)measurement_type;
+	int status;
 
 	if (store == NULL) {
 		return PCR_INVALID_ARGUMENT;
@@ -353,7 +427,12 @@ int pcr_store_invalidate_measurement (struct pcr_store *store, uint16_t measurem
 		return PCR_INVALID_PCR;
 	}
 
-	return pcr_invalidate_measurement_index (&store->banks[pcr_bank], measurement_index);
+	status = pcr_invalidate_measurement_index (&store->banks[pcr_bank], measurement_index);
+	if (status == 0) {
+		pcr_store_measurement_changed (store);
+	}
+
+	return status;
 }
 
 /**
@@ -409,36 +488,25 @@ int pcr_store_get_attestation_log_size (struct pcr_store *store)
 }
 
 /**
- * Generate attestation log from PCR banks.
+ * Serialize the attestation log for all PCR banks into the log snapshot.  This must be called with
+ * the log lock held.
  *
  * @param store PCR store to get measurements from.
  * @param hash Hashing engine to utilize in PCR bank operations.
- * @param offset Offset within the log to start reading data.
- * @param contents Output buffer for the log contents.
- * @param length Maximum number of bytes to read from the log.
  *
- * @return The number of bytes read from the log or an error code.
+ * @return 0 if the snapshot was generated successfully or an error code.
  */
-int pcr_store_get_attestation_log (struct pcr_store *store, struct hash_engine *hash,
-	uint32_t offset, uint8_t *contents, size_t length)
+static int pcr_store_build_attestation_log (struct pcr_store *store, struct hash_engine *hash)
 {
-	struct pcr_store_attestation_log_entry log_entry;
+	struct pcr_store_attestation_log_entry *log_entry =
+		(struct pcr_store_attestation_log_entry*) store->log_cache;
 	const struct pcr_measurement *measurements;
-	uint32_t contents_offset = 0;
-	uint32_t entry_length;
-	uint32_t entry_offset;
 	uint32_t i_entry = 0;
 	uint8_t i_bank;
-	int starting_measurement;
-	uint32_t total_log_size = 0;
 	int num_measurements;
 	int i_measurement;
 	int status;
 
-	if ((store == NULL) || (hash == NULL) || (contents == NULL)) {
-		return PCR_INVALID_ARGUMENT;
-	}
-
 	for (i_bank = 0; i_bank < store->num_pcr_banks; ++i_bank) {
 		status = pcr_lock (&store->banks[i_bank]);
 		if (status != 0) {
@@ -447,14 +515,13 @@ int pcr_store_get_attestation_log (struct pcr_store *store, struct hash_engine *
 
 		status = pcr_compute (&store->banks[i_bank], hash, NULL, false);
 		if (ROT_IS_ERROR (status)) {
-			pcr_unlock (&store->banks[i_bank]);
-			return status;
+			goto unlock;
 		}
 
 		num_measurements = pcr_get_num_measurements (&store->banks[i_bank]);
 		if (ROT_IS_ERROR (num_measurements)) {
-			pcr_unlock (&store->banks[i_bank]);
-			return num_measurements;
+			status = num_measurements;
+			goto unlock;
 		}
 
 		if (num_measurements == 0) {
@@ -465,70 +532,92 @@ int pcr_store_get_attestation_log (struct pcr_store *store, struct hash_engine *
 		num_measurements = pcr_get_all_measurements (&store->banks[i_bank],
 			(const uint8_t**) &measurements);
 		if (ROT_IS_ERROR (num_measurements)) {
-			pcr_unlock (&store->banks[i_bank]);
-			return num_measurements;
+			status = num_measurements;
+			goto unlock;
 		}
 
-		if (total_log_size >= offset) {
-			total_log_size += num_measurements * sizeof (struct pcr_store_attestation_log_entry);
-			starting_measurement = 0;
-			entry_offset = 0;
-		}
-		else {
-			starting_measurement = (offset - total_log_size) /
-				sizeof (struct pcr_store_attestation_log_entry);
-			entry_offset = (offset - total_log_size) - (starting_measurement) *
-				sizeof (struct pcr_store_attestation_log_entry);
-			total_log_size += num_measurements * sizeof (struct pcr_store_attestation_log_entry);
-
-			if (total_log_size <= offset) {
-				i_entry += num_measurements;
-				pcr_unlock (&store->banks[i_bank]);
-				continue;
-			}
+		for (i_measurement = 0; i_measurement < num_measurements; ++i_measurement) {
+			log_entry->header.log_magic = LOGGING_MAGIC_START;
+			log_entry->header.length = sizeof (struct pcr_store_attestation_log_entry);
+			log_entry->header.entry_id = i_entry++;
+
+			log_entry->entry.digest_algorithm_id = 0x0B;
+			log_entry->entry.digest_count = 1;
+			log_entry->entry.event_type = measurements[i_measurement].event_type;
+			log_entry->entry.measurement_type = PCR_MEASUREMENT (i_bank, i_measurement);
+			log_entry->entry.measurement_size = sizeof (measurements[i_measurement].digest);
+
+			memcpy (log_entry->entry.digest, measurements[i_measurement].digest,
+				sizeof (measurements[i_measurement].digest));
+			memcpy (log_entry->entry.measurement, measurements[i_measurement].measurement,
+				sizeof (measurements[i_measurement].measurement));
 
-			i_entry += starting_measurement;
+			log_entry++;
 		}
 
-		for (i_measurement = 0; i_measurement < num_measurements; ++i_measurement) {
-			if (i_measurement < starting_measurement) {
-				continue;
-			}
+		pcr_unlock (&store->banks[i_bank]);
+	}
 
-			log_entry.header.log_magic = LOGGING_MAGIC_START;
-			log_entry.header.length = sizeof (struct pcr_store_attestation_log_entry);
-			log_entry.header.entry_id = i_entry++;
+	return 0;
 
-			log_entry.entry.digest_algorithm_id = 0x0B;
-			log_entry.entry.digest_count = 1;
-			log_entry.entry.event_type = measurements[i_measurement].event_type;
-			log_entry.entry.measurement_type = PCR_MEASUREMENT (i_bank, i_measurement);
-			log_entry.entry.measurement_size = sizeof (measurements[i_measurement].digest);
+unlock:
+	pcr_unlock (&store->banks[i_bank]);
+	return status;
+}
 
-			memcpy (log_entry.entry.digest, measurements[i_measurement].digest,
-				sizeof (measurements[i_measurement].digest));
-			memcpy (log_entry.entry.measurement, measurements[i_measurement].measurement,
-				sizeof (measurements[i_measurement].measurement));
+/**
+ * Read the attestation log generated from PCR banks.
+ *
+ * The log is served from a snapshot that is regenerated only when measurements have changed.  To
+ * provide a consistent view of the log to readers retrieving it in multiple chunks, the snapshot is
+ * only refreshed when reading from the start of the log.  Reads at later offsets will return data
+ * from the same snapshot as the initial read, even if measurements have been updated since then.
+ *
+ * @param store PCR store to get measurements from.
+ * @param hash Hashing engine to utilize in PCR bank operations.
+ * @param offset Offset within the log to start reading data.
+ * @param contents Output buffer for the log contents.
+ * @param length Maximum number of bytes to read from the log.
+ *
+ * @return The number of bytes read from the log or an error code.
+ */
+int pcr_store_get_attestation_log (struct pcr_store *store, struct hash_engine *hash,
+	uint32_t offset, uint8_t *contents, size_t length)
+{
+	uint32_t generation;
+	size_t bytes_read = 0;
+	int status;
 
-			entry_length = min (length - contents_offset,
-				sizeof (struct pcr_store_attestation_log_entry) - entry_offset);
+	if ((store == NULL) || (hash == NULL) || (contents == NULL)) {
+		return PCR_INVALID_ARGUMENT;
+	}
 
-			memcpy (&contents[contents_offset], ((uint8_t*) &log_entry) + entry_offset,
-				entry_length);
+	platform_mutex_lock (&store->log_lock);
 
-			contents_offset += entry_length;
-			if (contents_offset >= length) {
-				pcr_unlock (&store->banks[i_bank]);
-				return contents_offset;
-			}
+	if (!store->log_cache_valid ||
+		((offset == 0) && (store->log_cache_generation != store->generation))) {
+		generation = store->generation;
 
-			entry_offset = 0;
+		status = pcr_store_build_attestation_log (store, hash);
+		if (status != 0) {
+			store->log_cache_valid = false;
+			goto exit;
 		}
 
-		pcr_unlock (&store->banks[i_bank]);
+		store->log_cache_valid = true;
+		store->log_cache_generation = generation;
+	}
+
+	if (offset < store->log_cache_length) {
+		bytes_read = min (length, store->log_cache_length - offset);
+		memcpy (contents, &store->log_cache[offset], bytes_read);
 	}
 
-	return contents_offset;
+	status = bytes_read;
+
+exit:
+	platform_mutex_unlock (&store->log_lock);
+	return status;
 }
 
 /**
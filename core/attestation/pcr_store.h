@@ -20,6 +20,12 @@
 struct pcr_store {
 	struct pcr_bank *banks;								/**< PCR banks */
 	size_t num_pcr_banks;								/**< Number of PCR banks */
+	uint8_t *log_cache;									/**< Snapshot of the serialized attestation log */
+	size_t log_cache_length;							/**< Length of the attestation log snapshot */
+	bool log_cache_valid;								/**< Flag indicating the snapshot has been generated */
+	uint32_t log_cache_generation;						/**< Measurement generation used for the snapshot */
+	uint32_t generation;								/**< Counter incremented for each measurement change */
+	platform_mutex log_lock;							/**< Synchronization for the attestation log snapshot */
 };
 
 #pragma pack(push, 1)
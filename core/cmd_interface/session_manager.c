@@ -79,14 +79,20 @@ static int session_manager_get_paired_key_index (struct session_manager *session
 }
 
 /**
- * Find AES session key for requested EID then set it in the AES engine
+ * Find AES session key for requested EID and get an AES engine that is ready to use the key.
+ *
+ * If the session has a dedicated AES engine, the session key is only set in the engine for the
+ * first message.  Subsequent messages reuse the key schedule already loaded in the engine.
+ * Otherwise, the session key is set in the shared AES engine for every message.
  *
  * @param session Session manager instance to utilize.
  * @param eid Device EID.
+ * @param aes Output for the AES engine that has been configured with the session key.
  *
  * @return Completion status, 0 if success or an error code.
  */
-static int session_manager_set_key (struct session_manager *session, uint8_t eid)
+static int session_manager_set_key (struct session_manager *session, uint8_t eid,
+	struct aes_engine **aes)
 {
 	struct session_manager_entry *curr_session;
 	int status;
@@ -99,8 +105,21 @@ static int session_manager_set_key (struct session_manager *session, uint8_t eid
 		return SESSION_MANAGER_SESSION_NOT_ESTABLISHED;
 	}
 
-	status = session->aes->set_key (session->aes, curr_session->session_key,
+	if (session->session_aes != NULL) {
+		*aes = session->session_aes[curr_session - session->sessions_table];
+		if (curr_session->aes_key_set) {
+			return 0;
+		}
+	}
+	else {
+		*aes = session->aes;
+	}
+
+	status = (*aes)->set_key (*aes, curr_session->session_key,
 		sizeof (curr_session->session_key));
+	if ((status == 0) && (session->session_aes != NULL)) {
+		curr_session->aes_key_set = true;
+	}
 
 	return status;
 }
@@ -185,6 +204,7 @@ int session_manager_get_pairing_state (struct session_manager *session, uint8_t
 int session_manager_decrypt_message (struct session_manager *session,
 	struct cmd_interface_msg *request)
 {
+	struct aes_engine *aes;
 	uint8_t *payload;
 	size_t payload_len;
 	size_t buffer_len;
@@ -210,14 +230,14 @@ int session_manager_decrypt_message (struct session_manager *session,
 		SESSION_MANAGER_TRAILER_LEN;
 	buffer_len = request->max_response - sizeof (struct cerberus_protocol_header);
 
-	status = session_manager_set_key (session, request->source_eid);
+	status = session_manager_set_key (session, request->source_eid, &aes);
 	if (status != 0) {
 		return status;
 	}
 
 	request->length -= SESSION_MANAGER_TRAILER_LEN;
 
-	return session->aes->decrypt_data (session->aes, payload, payload_len, &payload[payload_len],
+	return aes->decrypt_data (aes, payload, payload_len, &payload[payload_len],
 		&payload[payload_len + CERBERUS_PROTOCOL_AES_GCM_TAG_LEN], CERBERUS_PROTOCOL_AES_IV_LEN,
 		payload, buffer_len);
 }
@@ -234,6 +254,7 @@ int session_manager_encrypt_message (struct session_manager *session,
 	struct cmd_interface_msg *request)
 {
 	struct cerberus_protocol_header *header;
+	struct aes_engine *aes;
 	uint8_t *aes_iv;
 	uint8_t *payload;
 	size_t payload_len;
@@ -257,7 +278,7 @@ int session_manager_encrypt_message (struct session_manager *session,
 	buffer_len = request->max_response - sizeof (struct cerberus_protocol_header);
 	aes_iv = &payload[payload_len + CERBERUS_PROTOCOL_AES_GCM_TAG_LEN];
 
-	status = session_manager_set_key (session, request->source_eid);
+	status = session_manager_set_key (session, request->source_eid, &aes);
 	if (status != 0) {
 		return status;
 	}
@@ -268,7 +289,7 @@ int session_manager_encrypt_message (struct session_manager *session,
 		return status;
 	}
 
-	status = session->aes->encrypt_data (session->aes, payload, payload_len, aes_iv,
+	status = aes->encrypt_data (aes, payload, payload_len, aes_iv,
 		CERBERUS_PROTOCOL_AES_IV_LEN, payload, buffer_len - SESSION_MANAGER_TRAILER_LEN,
 		&payload[payload_len],
 		CERBERUS_PROTOCOL_AES_GCM_TAG_LEN);
@@ -315,6 +336,7 @@ int session_manager_add_session (struct session_manager *session, uint8_t eid,
 	memcpy (curr_session->cerberus_nonce, cerberus_nonce, SESSION_MANAGER_NONCE_LEN);
 	curr_session->session_state = SESSION_STATE_SETUP;
 	curr_session->eid = eid;
+	curr_session->aes_key_set = false;
 
 	return 0;
 }
@@ -526,6 +548,7 @@ int session_manager_setup_paired_session (struct session_manager *session, uint8
 	status = kdf_nist800_108_counter_mode (session->hash, HMAC_SHA256, pairing_key,
 		sizeof (pairing_key), label, sizeof (label), NULL, 0, req_session->session_key,
 		sizeof (req_session->session_key));
+	req_session->aes_key_set = false;
 	if (status != 0) {
 		goto exit;
 	}
@@ -642,6 +665,54 @@ int session_manager_init (struct session_manager *session, struct aes_engine *ae
 	return 0;
 }
 
+/**
+ * Provide a dedicated AES engine for each entry in the sessions table.  The session key will be set
+ * in an entry's engine once, when the first message for that session is encrypted or decrypted.
+ * Later messages use the engine without configuring the key again, avoiding the cost of AES key
+ * expansion for every message.
+ *
+ * Without dedicated engines, the shared AES engine is configured with the session key for every
+ * message.
+ *
+ * @param session Session manager instance to configure.
+ * @param aes List of AES engines to use for each session.  The engine at each index is used for
+ * the sessions table entry with the same index.  Each engine must only be used by this session
+ * manager.  Set to NULL to use the shared AES engine for all sessions.
+ * @param num_engines Number of AES engines in the list.  This must match the number of supported
+ * sessions.
+ *
+ * @return Completion status, 0 if success or an error code.
+ */
+int session_manager_set_session_aes_engines (struct session_manager *session,
+	struct aes_engine *const *aes, size_t num_engines)
+{
+	size_t i_session;
+
+	if (session == NULL) {
+		return SESSION_MANAGER_INVALID_ARGUMENT;
+	}
+
+	if (aes != NULL) {
+		if (num_engines != session->num_sessions) {
+			return SESSION_MANAGER_INVALID_ARGUMENT;
+		}
+
+		for (i_session = 0; i_session < num_engines; ++i_session) {
+			if (aes[i_session] == NULL) {
+				return SESSION_MANAGER_INVALID_ARGUMENT;
+			}
+		}
+	}
+
+	for (i_session = 0; i_session < session->num_sessions; ++i_session) {
+		session->sessions_table[i_session].aes_key_set = false;
+	}
+
+	session->session_aes = aes;
+
+	return 0;
+}
+
 /**
  * Release session manager
  *
@@ -49,6 +49,7 @@ struct session_manager_entry {
 	uint8_t eid;										/**< EID of other device participating in session */
 	uint8_t session_state;								/**< Current session state */
  	enum hmac_hash hmac_hash_type;						/**< HMAC hash type to utilize */
+	bool aes_key_set;									/**< Flag indicating the session AES engine holds the session key */
 };
 
 /**
@@ -174,6 +175,7 @@ struct session_manager {
 	const uint8_t *pairing_eids;						/**< List of supported devices for pairing mode */
 	bool sessions_table_preallocated;					/**< Flag indicating if session tables were provided by caller */
 	struct keystore *store;								/**< Keystore used to persist pairing keys */
+	struct aes_engine *const *session_aes;				/**< Optional AES engine dedicated to each session table entry */
 };
 
 /* Internal functions for use by derived types. */
@@ -183,6 +185,9 @@ int session_manager_init (struct session_manager *session, struct aes_engine *ae
 	size_t num_pairing_eids, struct keystore *store);
 void session_manager_release (struct session_manager *session);
 
+int session_manager_set_session_aes_engines (struct session_manager *session,
+	struct aes_engine *const *aes, size_t num_engines);
+
 int session_manager_add_session (struct session_manager *session, uint8_t eid,
 	const uint8_t *device_nonce, const uint8_t *cerberus_nonce);
 int session_manager_decrypt_message (struct session_manager *session,
@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "arena.h"
+
+
+/**
+ * Initialize an arena allocator.
+ *
+ * @param arena The arena to initialize.
+ * @param buffer The memory that will be used for allocations.  This can be statically allocated.
+ * The buffer must remain valid for the lifetime of the arena.
+ * @param size The size of the memory buffer.
+ *
+ * @return 0 if the arena was successfully initialized or an error code.
+ */
+int arena_init (struct arena *arena, void *buffer, size_t size)
+{
+	if ((arena == NULL) || (buffer == NULL) || (size == 0)) {
+		return ARENA_INVALID_ARGUMENT;
+	}
+
+	memset (arena, 0, sizeof (struct arena));
+
+	arena->buffer = buffer;
+	arena->size = size;
+
+	return 0;
+}
+
+/**
+ * Allocate memory from an arena.  The returned memory is not initialized.
+ *
+ * @param arena The arena to allocate from.
+ * @param size The number of bytes to allocate.  A zero length allocation will still return a
+ * unique, non-null pointer, matching the behavior of the heap allocator.
+ *
+ * @return The allocated memory or null if there is not enough space in the arena.
+ */
+void* arena_alloc (struct arena *arena, size_t size)
+{
+	uintptr_t next;
+	size_t pad;
+	void *mem;
+
+	if (arena == NULL) {
+		return NULL;
+	}
+
+	if (size == 0) {
+		size = 1;
+	}
+
+	next = (uintptr_t) &arena->buffer[arena->used];
+	pad = (ARENA_ALIGNMENT - (next & (ARENA_ALIGNMENT - 1))) & (ARENA_ALIGNMENT - 1);
+
+	if ((pad > (arena->size - arena->used)) || (size > (arena->size - arena->used - pad))) {
+		return NULL;
+	}
+
+	mem = &arena->buffer[arena->used + pad];
+	arena->used += pad + size;
+
+	if (arena->used > arena->peak) {
+		arena->peak = arena->used;
+	}
+
+	return mem;
+}
+
+/**
+ * Allocate zeroed memory for an array from an arena.
+ *
+ * @param arena The arena to allocate from.
+ * @param count The number of elements in the array.
+ * @param size The size of each element.
+ *
+ * @return The allocated memory or null if there is not enough space in the arena.
+ */
+void* arena_calloc (struct arena *arena, size_t count, size_t size)
+{
+	void *mem;
+
+	if ((size != 0) && (count > (SIZE_MAX / size))) {
+		return NULL;
+	}
+
+	mem = arena_alloc (arena, count * size);
+	if (mem != NULL) {
+		memset (mem, 0, count * size);
+	}
+
+	return mem;
+}
+
+/**
+ * Release all memory allocated from an arena.  Any memory previously returned from the arena must
+ * no longer be used.
+ *
+ * @param arena The arena to reset.
+ */
+void arena_reset (struct arena *arena)
+{
+	if (arena != NULL) {
+		arena->used = 0;
+	}
+}
+
+/**
+ * Determine if a pointer refers to memory managed by an arena.
+ *
+ * @param arena The arena to check.
+ * @param ptr The pointer to check.
+ *
+ * @return true if the pointer is within the arena buffer or false if not.
+ */
+bool arena_contains (const struct arena *arena, const void *ptr)
+{
+	uintptr_t start;
+	uintptr_t check = (uintptr_t) ptr;
+
+	if ((arena == NULL) || (ptr == NULL)) {
+		return false;
+	}
+
+	start = (uintptr_t) arena->buffer;
+
+	return ((check >= start) && ((check - start) < arena->size));
+}
+
+/**
+ * Get the amount of unallocated space remaining in an arena.  Alignment padding may reduce the size
+ * of the largest allocation that can be made.
+ *
+ * @param arena The arena to query.
+ *
+ * @return The number of unallocated bytes.
+ */
+size_t arena_get_remaining (const struct arena *arena)
+{
+	if (arena == NULL) {
+		return 0;
+	}
+
+	return arena->size - arena->used;
+}
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "status/rot_status.h"
+
+
+/**
+ * Alignment applied to every allocation from an arena.
+ */
+#define	ARENA_ALIGNMENT		8
+
+
+/**
+ * A bump allocator over a caller provided buffer.  Allocations are taken sequentially from the
+ * buffer and are never individually freed.  All allocations are released at once by resetting the
+ * arena, which allows the buffer to come from static storage and avoids fragmenting the heap with
+ * short-lived allocations.
+ *
+ * An arena is not thread-safe.  Each thread or context should use its own arena.
+ */
+struct arena {
+	uint8_t *buffer;			/**< The memory used for allocations. */
+	size_t size;				/**< The total size of the memory buffer. */
+	size_t used;				/**< The number of bytes currently allocated. */
+	size_t peak;				/**< The maximum number of bytes allocated since initialization. */
+};
+
+
+int arena_init (struct arena *arena, void *buffer, size_t size);
+
+void* arena_alloc (struct arena *arena, size_t size);
+void* arena_calloc (struct arena *arena, size_t count, size_t size);
+void arena_reset (struct arena *arena);
+
+bool arena_contains (const struct arena *arena, const void *ptr);
+size_t arena_get_remaining (const struct arena *arena);
+
+
+#define	ARENA_ERROR(code)		ROT_ERROR (ROT_MODULE_ARENA, code)
+
+/**
+ * Error codes that can be generated by an arena allocator.
+ */
+enum {
+	ARENA_INVALID_ARGUMENT = ARENA_ERROR (0x00),		/**< Input parameter is null or not valid. */
+	ARENA_NO_MEMORY = ARENA_ERROR (0x01),				/**< Memory allocation failed. */
+};
+
+
+#endif /* ARENA_H_ */
@@ -7,6 +7,27 @@
 #include "buffer_util.h"
 #include "common_math.h"
 
+#if (defined __x86_64__ || defined __i386__) && defined __GNUC__
+#include <immintrin.h>
+
+/* AVX2 comparisons are built for any x86 target and selected when the CPU supports them, so they
+ * don't depend on the target flags used for the rest of the build. */
+#define	BUFFER_UTIL_AVX2
+#elif defined (__SSE2__)
+#include <immintrin.h>
+#endif
+
+/* Words are loaded with a compiler builtin so the load is inlined, even when built with
+ * -fno-builtin, and there are no alignment requirements on the source data. */
+#if defined (__GNUC__)
+#define	buffer_util_load_words(dest, src, length)	__builtin_memcpy (dest, src, length)
+#define	buffer_util_load_aligned_words(dest, src, length)	\
+	__builtin_memcpy (dest, __builtin_assume_aligned (src, sizeof (size_t)), length)
+#else
+#define	buffer_util_load_words(dest, src, length)	memcpy (dest, src, length)
+#define	buffer_util_load_aligned_words(dest, src, length)	memcpy (dest, src, length)
+#endif
+
 
 /**
  * Copy data into an output buffer.
@@ -171,3 +192,220 @@ int buffer_compare_dwords (const uint32_t *buf1, const uint32_t *buf2, size_t dw
 
 	return (match == 0xffffffff) ? 0 : BUFFER_UTIL_DATA_MISMATCH;
 }
+
+#if defined (BUFFER_UTIL_AVX2)
+/**
+ * Check that every byte in a buffer contains the same value, 64 bytes at a time, using AVX2
+ * instructions.  Any remaining bytes are not checked.
+ *
+ * @param buffer The buffer to check.
+ * @param length Length of the buffer.
+ * @param value The value expected in every byte of the buffer.
+ * @param offset Output for the number of bytes that were checked.
+ *
+ * @return 0 if all checked bytes match the value or BUFFER_UTIL_DATA_MISMATCH if they do not.
+ */
+__attribute__((target ("avx2")))
+static int buffer_check_value_avx2 (const uint8_t *buffer, size_t length, uint8_t value,
+	size_t *offset)
+{
+	const __m256i expected = _mm256_set1_epi8 ((char) value);
+	__m256i match;
+	size_t i;
+
+	for (i = 0; (i + (sizeof (__m256i) * 2)) <= length; i += (sizeof (__m256i) * 2)) {
+		match = _mm256_and_si256 (
+			_mm256_cmpeq_epi8 (_mm256_loadu_si256 ((const __m256i*) &buffer[i]), expected),
+			_mm256_cmpeq_epi8 (_mm256_loadu_si256 ((const __m256i*) &buffer[i + sizeof (__m256i)]),
+				expected));
+		if ((uint32_t) _mm256_movemask_epi8 (match) != 0xffffffff) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+
+	*offset = i;
+	return 0;
+}
+
+/**
+ * Compare the contents of two buffers, 64 bytes at a time, using AVX2 instructions.  Any remaining
+ * bytes are not compared.
+ *
+ * @param buf1 First input buffer for the comparison.
+ * @param buf2 Second input buffer for the comparison.
+ * @param length Length of buffers to compare.
+ * @param offset Output for the number of bytes that were compared.
+ *
+ * @return 0 if all compared bytes match or BUFFER_UTIL_DATA_MISMATCH if they do not.
+ */
+__attribute__((target ("avx2")))
+static int buffer_compare_fast_avx2 (const uint8_t *buf1, const uint8_t *buf2, size_t length,
+	size_t *offset)
+{
+	__m256i match;
+	size_t i;
+
+	for (i = 0; (i + (sizeof (__m256i) * 2)) <= length; i += (sizeof (__m256i) * 2)) {
+		match = _mm256_and_si256 (
+			_mm256_cmpeq_epi8 (_mm256_loadu_si256 ((const __m256i*) &buf1[i]),
+				_mm256_loadu_si256 ((const __m256i*) &buf2[i])),
+			_mm256_cmpeq_epi8 (_mm256_loadu_si256 ((const __m256i*) &buf1[i + sizeof (__m256i)]),
+				_mm256_loadu_si256 ((const __m256i*) &buf2[i + sizeof (__m256i)])));
+		if ((uint32_t) _mm256_movemask_epi8 (match) != 0xffffffff) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+
+	*offset = i;
+	return 0;
+}
+#endif
+
+/**
+ * Check that every byte in a buffer contains the same value.  The check is done multiple bytes at a
+ * time, using vector instructions when supported by the target.
+ *
+ * This is not a constant time check and must not be used with secret data.
+ *
+ * @param buffer The buffer to check.
+ * @param length Length of the buffer.
+ * @param value The value expected in every byte of the buffer.
+ *
+ * @return 0 if all bytes in the buffer match the value, BUFFER_UTIL_DATA_MISMATCH if they do not,
+ * or BUFFER_UTIL_INVALID_ARGUMENT if the buffer is null.
+ */
+int buffer_check_value (const uint8_t *buffer, size_t length, uint8_t value)
+{
+	size_t pattern;
+	size_t word[4];
+	size_t i = 0;
+
+	if (buffer == NULL) {
+		return (length == 0) ? 0 : BUFFER_UTIL_INVALID_ARGUMENT;
+	}
+
+#if defined (BUFFER_UTIL_AVX2)
+	if (__builtin_cpu_supports ("avx2")) {
+		if (buffer_check_value_avx2 (buffer, length, value, &i) != 0) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+#endif
+#if defined (__SSE2__)
+	{
+		const __m128i expected = _mm_set1_epi8 ((char) value);
+		__m128i match;
+
+		for (; (i + (sizeof (__m128i) * 2)) <= length; i += (sizeof (__m128i) * 2)) {
+			match = _mm_and_si128 (
+				_mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i*) &buffer[i]), expected),
+				_mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i*) &buffer[i + sizeof (__m128i)]),
+					expected));
+			if (_mm_movemask_epi8 (match) != 0xffff) {
+				return BUFFER_UTIL_DATA_MISMATCH;
+			}
+		}
+	}
+#endif
+
+	/* Check single bytes until the buffer is aligned for word loads. */
+	for (; (i < length) && (((uintptr_t) &buffer[i] & (sizeof (size_t) - 1)) != 0); i++) {
+		if (buffer[i] != value) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+
+	memset (&pattern, value, sizeof (pattern));
+	for (; (i + sizeof (word)) <= length; i += sizeof (word)) {
+		buffer_util_load_aligned_words (word, &buffer[i], sizeof (word));
+		if (((word[0] ^ pattern) | (word[1] ^ pattern) | (word[2] ^ pattern) |
+			(word[3] ^ pattern)) != 0) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+
+	for (; i < length; i++) {
+		if (buffer[i] != value) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Compare the contents of two buffers.  The comparison is done multiple bytes at a time, using
+ * vector instructions when supported by the target, and stops at the first difference.
+ *
+ * This is not a constant time comparison and must not be used with secret data.  Use
+ * buffer_compare in secure contexts.
+ *
+ * @param buf1 First input buffer for the comparison.
+ * @param buf2 Second input buffer for the comparison.
+ * @param length Length of buffers to compare.
+ *
+ * @return 0 if the buffers match exactly or BUFFER_UTIL_DATA_MISMATCH if they do not.
+ */
+int buffer_compare_fast (const uint8_t *buf1, const uint8_t *buf2, size_t length)
+{
+	size_t word1[4];
+	size_t word2[4];
+	size_t i = 0;
+
+	if ((buf1 == NULL) || (buf2 == NULL)) {
+		if ((buf1 == NULL) && (buf2 == NULL) && (length == 0)) {
+			return 0;
+		}
+
+		return BUFFER_UTIL_DATA_MISMATCH;
+	}
+
+#if defined (BUFFER_UTIL_AVX2)
+	if (__builtin_cpu_supports ("avx2")) {
+		if (buffer_compare_fast_avx2 (buf1, buf2, length, &i) != 0) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+#endif
+#if defined (__SSE2__)
+	{
+		__m128i match;
+
+		for (; (i + (sizeof (__m128i) * 2)) <= length; i += (sizeof (__m128i) * 2)) {
+			match = _mm_and_si128 (
+				_mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i*) &buf1[i]),
+					_mm_loadu_si128 ((const __m128i*) &buf2[i])),
+				_mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i*) &buf1[i + sizeof (__m128i)]),
+					_mm_loadu_si128 ((const __m128i*) &buf2[i + sizeof (__m128i)])));
+			if (_mm_movemask_epi8 (match) != 0xffff) {
+				return BUFFER_UTIL_DATA_MISMATCH;
+			}
+		}
+	}
+#endif
+
+	/* Compare single bytes until the first buffer is aligned for word loads.  The second buffer
+	 * may still be unaligned. */
+	for (; (i < length) && (((uintptr_t) &buf1[i] & (sizeof (size_t) - 1)) != 0); i++) {
+		if (buf1[i] != buf2[i]) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+
+	for (; (i + sizeof (word1)) <= length; i += sizeof (word1)) {
+		buffer_util_load_aligned_words (word1, &buf1[i], sizeof (word1));
+		buffer_util_load_words (word2, &buf2[i], sizeof (word2));
+		if (((word1[0] ^ word2[0]) | (word1[1] ^ word2[1]) | (word1[2] ^ word2[2]) |
+			(word1[3] ^ word2[3])) != 0) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+
+	for (; i < length; i++) {
+		if (buf1[i] != buf2[i]) {
+			return BUFFER_UTIL_DATA_MISMATCH;
+		}
+	}
+
+	return 0;
+}
@@ -62,6 +62,18 @@ struct ecc_ecdsa_signature {
 };
 #pragma pack(pop)
 
+/**
+ * A precomputed, single-use nonce for generating an ECDSA signature.  Precomputing the nonce
+ * removes the expensive point multiplication from the signing operation.  The contents are
+ * specific to the engine that generated the nonce.  It must only be used once and only with the
+ * engine and key that generated it.
+ */
+struct ecc_ecdsa_nonce {
+	uint8_t k[ECC_MAX_KEY_LENGTH];			/**< Secret per-signature value derived from the nonce. */
+	uint8_t r[ECC_MAX_KEY_LENGTH];			/**< r value for the ECDSA signature. */
+	size_t length;							/**< Length of each integer in the nonce. */
+};
+
 /**
  * A platform-independent API for generating and using ECC key pairs.  ECC engine instances are not
  * guaranteed to be thread-safe.
@@ -208,6 +220,44 @@ struct ecc_engine {
 	int (*sign) (struct ecc_engine *engine, struct ecc_private_key *key, const uint8_t *digest,
 		size_t length, uint8_t *signature, size_t sig_length);
 
+	/**
+	 * Precompute a nonce that can be used later to create an ECDSA signature with
+	 * {@link sign_with_nonce}.  This performs the expensive part of signature generation, which
+	 * does not depend on the digest being signed.
+	 *
+	 * This is optional and will be null if the engine does not support precomputed nonces.
+	 *
+	 * @param engine The ECC engine to use to generate the nonce.
+	 * @param key The private key that will be used to sign with the nonce.
+	 * @param nonce Output for the generated nonce.  This contains secret data and must be zeroized
+	 * if it will not be used.
+	 *
+	 * @return 0 if the nonce was successfully generated or an error code.
+	 */
+	int (*generate_ecdsa_nonce) (struct ecc_engine *engine, struct ecc_private_key *key,
+		struct ecc_ecdsa_nonce *nonce);
+
+	/**
+	 * Create an ECDSA signature for a SHA2 digest using a precomputed nonce.  The nonce will be
+	 * zeroized after it has been used, whether or not the signature was generated successfully.
+	 *
+	 * This is optional and will be null if the engine does not support precomputed nonces.
+	 *
+	 * @param engine The ECC engine to use to sign the digest.
+	 * @param key The private key to sign with.  This must be the key used to generate the nonce.
+	 * @param nonce The precomputed nonce to use for the signature.
+	 * @param digest The digest to use to generate the signature.
+	 * @param length The length of the digest.
+	 * @param signature Output buffer for the ECDSA signature.  The signature will be DER encoded.
+	 * @param sig_length The length of the signature output buffer.
+	 *
+	 * @return The length of the signature or an error code.  Use ROT_IS_ERROR to check the return
+	 * value.
+	 */
+	int (*sign_with_nonce) (struct ecc_engine *engine, struct ecc_private_key *key,
+		struct ecc_ecdsa_nonce *nonce, const uint8_t *digest, size_t length, uint8_t *signature,
+		size_t sig_length);
+
 	/**
 	 * Verify an ECDSA signature against a SHA2 digest.
 	 *
@@ -283,6 +333,8 @@ enum {
 	ECC_ENGINE_UNSUPPORTED_KEY_LENGTH = ECC_ENGINE_ERROR (0x14),	/**< The ECC key length is not supported by the implementation. */
 	ECC_ENGINE_UNSUPPORTED_HASH_TYPE = ECC_ENGINE_ERROR (0x15),		/**< The hash algorithm for a signature digest is not supported by the implementation. */
 	ECC_ENGINE_SELF_TEST_FAILED = ECC_ENGINE_ERROR (0x16),			/**< An internal self-test of the ECC engine failed. */
+	ECC_ENGINE_NONCE_FAILED = ECC_ENGINE_ERROR (0x17),				/**< The ECDSA nonce was not generated. */
+	ECC_ENGINE_BAD_NONCE = ECC_ENGINE_ERROR (0x18),					/**< The ECDSA nonce is not valid for the signing key. */
 };
 
 
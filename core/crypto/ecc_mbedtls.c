@@ -12,6 +12,8 @@
 #include "mbedtls/ecdsa.h"
 #include "mbedtls/ecdh.h"
 #include "mbedtls/bignum.h"
+#include "mbedtls/asn1write.h"
+#include "mbedtls/platform_util.h"
 #include "logging/debug_log.h"
 #include "crypto/crypto_logging.h"
 #include "crypto/hash.h"
@@ -575,6 +577,222 @@ static int ecc_mbedtls_sign (struct ecc_engine *engine, struct ecc_private_key *
 	return (status == 0) ? (int) sig_length : status;
 }
 
+static int ecc_mbedtls_generate_ecdsa_nonce (struct ecc_engine *engine,
+	struct ecc_private_key *key, struct ecc_ecdsa_nonce *nonce)
+{
+	struct ecc_engine_mbedtls *mbedtls = (struct ecc_engine_mbedtls*) engine;
+	mbedtls_ecp_keypair *ec;
+	mbedtls_ecp_point R;
+	mbedtls_mpi k;
+	mbedtls_mpi kinv;
+	mbedtls_mpi r;
+	size_t length;
+	int status;
+
+	if ((mbedtls == NULL) || (key == NULL) || (nonce == NULL)) {
+		return ECC_ENGINE_INVALID_ARGUMENT;
+	}
+
+	mbedtls_ecp_point_init (&R);
+	mbedtls_mpi_init (&k);
+	mbedtls_mpi_init (&kinv);
+	mbedtls_mpi_init (&r);
+
+	ec = ecc_mbedtls_get_ec_key_pair (key);
+	length = mbedtls_mpi_size (&ec->grp.N);
+	if (length > ECC_MAX_KEY_LENGTH) {
+		status = ECC_ENGINE_UNSUPPORTED_KEY_LENGTH;
+		goto exit;
+	}
+
+	do {
+		status = mbedtls_ecp_gen_keypair (&ec->grp, &k, &R, mbedtls_ctr_drbg_random,
+			&mbedtls->ctr_drbg);
+		if (status != 0) {
+			goto exit;
+		}
+
+		status = mbedtls_mpi_mod_mpi (&r, &R.X, &ec->grp.N);
+		if (status != 0) {
+			goto exit;
+		}
+	} while (mbedtls_mpi_cmp_int (&r, 0) == 0);
+
+	status = mbedtls_mpi_inv_mod (&kinv, &k, &ec->grp.N);
+	if (status != 0) {
+		goto exit;
+	}
+
+	status = mbedtls_mpi_write_binary (&kinv, nonce->k, length);
+	if (status != 0) {
+		goto exit;
+	}
+
+	status = mbedtls_mpi_write_binary (&r, nonce->r, length);
+	if (status != 0) {
+		goto exit;
+	}
+
+	nonce->length = length;
+
+exit:
+	if (status != 0) {
+		mbedtls_platform_zeroize (nonce, sizeof (struct ecc_ecdsa_nonce));
+	}
+
+	mbedtls_mpi_free (&r);
+	mbedtls_mpi_free (&kinv);
+	mbedtls_mpi_free (&k);
+	mbedtls_ecp_point_free (&R);
+	return status;
+}
+
+static int ecc_mbedtls_sign_with_nonce (struct ecc_engine *engine, struct ecc_private_key *key,
+	struct ecc_ecdsa_nonce *nonce, const uint8_t *digest, size_t length, uint8_t *signature,
+	size_t sig_length)
+{
+	uint8_t der[MBEDTLS_ECDSA_MAX_LEN];
+	uint8_t *pos = der + sizeof (der);
+	mbedtls_ecp_keypair *ec;
+	mbedtls_mpi kinv;
+	mbedtls_mpi r;
+	mbedtls_mpi s;
+	mbedtls_mpi e;
+	size_t der_length = 0;
+	size_t use_length;
+	int status;
+
+	mbedtls_mpi_init (&kinv);
+	mbedtls_mpi_init (&r);
+	mbedtls_mpi_init (&s);
+	mbedtls_mpi_init (&e);
+
+	if ((engine == NULL) || (key == NULL) || (nonce == NULL) || (digest == NULL) ||
+		(signature == NULL) || (length == 0)) {
+		status = ECC_ENGINE_INVALID_ARGUMENT;
+		goto exit;
+	}
+
+	if ((int) sig_length < ecc_mbedtls_get_signature_max_length (engine, key)) {
+		status = ECC_ENGINE_SIG_BUFFER_TOO_SMALL;
+		goto exit;
+	}
+
+	if ((length != SHA256_HASH_LENGTH) && (length != SHA384_HASH_LENGTH) &&
+		(length != SHA512_HASH_LENGTH)) {
+		status = ECC_ENGINE_UNSUPPORTED_HASH_TYPE;
+		goto exit;
+	}
+
+	ec = ecc_mbedtls_get_ec_key_pair (key);
+	status = mbedtls_ecp_check_privkey (&ec->grp, &ec->d);
+	if (status != 0) {
+		goto exit;
+	}
+
+	if (nonce->length != mbedtls_mpi_size (&ec->grp.N)) {
+		status = ECC_ENGINE_BAD_NONCE;
+		goto exit;
+	}
+
+	status = mbedtls_mpi_read_binary (&kinv, nonce->k, nonce->length);
+	if (status != 0) {
+		goto exit;
+	}
+
+	status = mbedtls_mpi_read_binary (&r, nonce->r, nonce->length);
+	if (status != 0) {
+		goto exit;
+	}
+
+	if ((mbedtls_mpi_cmp_int (&kinv, 1) < 0) || (mbedtls_mpi_cmp_mpi (&kinv, &ec->grp.N) >= 0) ||
+		(mbedtls_mpi_cmp_int (&r, 1) < 0) || (mbedtls_mpi_cmp_mpi (&r, &ec->grp.N) >= 0)) {
+		status = ECC_ENGINE_BAD_NONCE;
+		goto exit;
+	}
+
+	/* Convert the digest to an integer, truncated to the bit length of the group order. */
+	use_length = (length > nonce->length) ? nonce->length : length;
+	status = mbedtls_mpi_read_binary (&e, digest, use_length);
+	if (status != 0) {
+		goto exit;
+	}
+
+	if ((use_length * 8) > ec->grp.nbits) {
+		status = mbedtls_mpi_shift_r (&e, (use_length * 8) - ec->grp.nbits);
+		if (status != 0) {
+			goto exit;
+		}
+	}
+
+	/* s = k^-1 * (e + r * d) mod n */
+	status = mbedtls_mpi_mul_mpi (&s, &r, &ec->d);
+	if (status == 0) {
+		status = mbedtls_mpi_add_mpi (&s, &s, &e);
+	}
+	if (status == 0) {
+		status = mbedtls_mpi_mod_mpi (&s, &s, &ec->grp.N);
+	}
+	if (status == 0) {
+		status = mbedtls_mpi_mul_mpi (&s, &s, &kinv);
+	}
+	if (status == 0) {
+		status = mbedtls_mpi_mod_mpi (&s, &s, &ec->grp.N);
+	}
+	if (status != 0) {
+		goto exit;
+	}
+
+	if (mbedtls_mpi_cmp_int (&s, 0) == 0) {
+		status = ECC_ENGINE_SIGN_FAILED;
+		goto exit;
+	}
+
+	/* DER encode the signature.  The ASN.1 writer fills the buffer from the end. */
+	status = mbedtls_asn1_write_mpi (&pos, der, &s);
+	if (status < 0) {
+		goto exit;
+	}
+	der_length += status;
+
+	status = mbedtls_asn1_write_mpi (&pos, der, &r);
+	if (status < 0) {
+		goto exit;
+	}
+	der_length += status;
+
+	status = mbedtls_asn1_write_len (&pos, der, der_length);
+	if (status < 0) {
+		goto exit;
+	}
+	der_length += status;
+
+	status = mbedtls_asn1_write_tag (&pos, der, MBEDTLS_ASN1_CONSTRUCTED | MBEDTLS_ASN1_SEQUENCE);
+	if (status < 0) {
+		goto exit;
+	}
+	der_length += status;
+
+	if (der_length > sig_length) {
+		status = ECC_ENGINE_SIG_BUFFER_TOO_SMALL;
+		goto exit;
+	}
+
+	memcpy (signature, pos, der_length);
+	status = der_length;
+
+exit:
+	if (nonce != NULL) {
+		mbedtls_platform_zeroize (nonce, sizeof (struct ecc_ecdsa_nonce));
+	}
+
+	mbedtls_mpi_free (&e);
+	mbedtls_mpi_free (&s);
+	mbedtls_mpi_free (&r);
+	mbedtls_mpi_free (&kinv);
+	return status;
+}
+
 static int ecc_mbedtls_verify (struct ecc_engine *engine, struct ecc_public_key *key,
 	const uint8_t *digest, size_t length, const uint8_t *signature, size_t sig_length)
 {
@@ -718,6 +936,8 @@ int ecc_mbedtls_init (struct ecc_engine_mbedtls *engine)
 	engine->base.get_public_key_der = ecc_mbedtls_get_public_key_der;
 #endif
 	engine->base.sign = ecc_mbedtls_sign;
+	engine->base.generate_ecdsa_nonce = ecc_mbedtls_generate_ecdsa_nonce;
+	engine->base.sign_with_nonce = ecc_mbedtls_sign_with_nonce;
 	engine->base.verify = ecc_mbedtls_verify;
 #ifdef ECC_ENABLE_ECDH
 	engine->base.get_shared_secret_max_length = ecc_mbedtls_get_shared_secret_max_length;
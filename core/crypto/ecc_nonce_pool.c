@@ -0,0 +1,215 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ecc_nonce_pool.h"
+#include "riot/riot_core.h"
+
+
+/**
+ * Initialize a pool of precomputed ECDSA nonces.  The pool starts out empty and must be filled by
+ * calling {@link ecc_nonce_pool_refill}.
+ *
+ * @param pool The nonce pool to initialize.
+ * @param ecc The ECC engine to use for generating nonces and signatures.  The engine must support
+ * precomputed nonces.  If the pool will be refilled from a different context than signatures are
+ * generated, the engine must be safe to call from multiple threads.
+ * @param key The private key that will be used for signing.  This must remain valid for the
+ * lifetime of the pool.
+ * @param capacity The number of nonces to keep in the pool.
+ *
+ * @return 0 if the nonce pool was successfully initialized or an error code.
+ */
+int ecc_nonce_pool_init (struct ecc_nonce_pool *pool, struct ecc_engine *ecc,
+	struct ecc_private_key *key, size_t capacity)
+{
+	int status;
+
+	if ((pool == NULL) || (ecc == NULL) || (key == NULL) || (capacity == 0)) {
+		return ECC_NONCE_POOL_INVALID_ARGUMENT;
+	}
+
+	if (capacity > ECC_NONCE_POOL_MAX_NONCES) {
+		return ECC_NONCE_POOL_TOO_MANY_NONCES;
+	}
+
+	if ((ecc->generate_ecdsa_nonce == NULL) || (ecc->sign_with_nonce == NULL)) {
+		return ECC_NONCE_POOL_UNSUPPORTED_ENGINE;
+	}
+
+	memset (pool, 0, sizeof (struct ecc_nonce_pool));
+
+	status = platform_mutex_init (&pool->lock);
+	if (status != 0) {
+		return status;
+	}
+
+	pool->ecc = ecc;
+	pool->key = key;
+	pool->capacity = capacity;
+
+	return 0;
+}
+
+/**
+ * Release the resources used by a nonce pool.  Any nonces remaining in the pool are discarded.
+ *
+ * @param pool The nonce pool to release.
+ */
+void ecc_nonce_pool_release (struct ecc_nonce_pool *pool)
+{
+	if (pool != NULL) {
+		riot_core_clear (pool->nonces, sizeof (pool->nonces));
+		pool->count = 0;
+
+		platform_mutex_free (&pool->lock);
+	}
+}
+
+/**
+ * Generate nonces until the pool is full.  This is expected to be called from a low priority or
+ * idle context.  Nonces are generated without holding the pool lock, so signing is never blocked
+ * waiting for a nonce to be generated.
+ *
+ * @param pool The nonce pool to refill.
+ *
+ * @return The number of nonces that were added to the pool or an error code.  Use ROT_IS_ERROR to
+ * check the return value.
+ */
+int ecc_nonce_pool_refill (struct ecc_nonce_pool *pool)
+{
+	struct ecc_ecdsa_nonce nonce;
+	int added = 0;
+	int status = 0;
+
+	if (pool == NULL) {
+		return ECC_NONCE_POOL_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&pool->lock);
+
+	while (pool->count < pool->capacity) {
+		platform_mutex_unlock (&pool->lock);
+
+		status = pool->ecc->generate_ecdsa_nonce (pool->ecc, pool->key, &nonce);
+
+		platform_mutex_lock (&pool->lock);
+
+		if (status != 0) {
+			break;
+		}
+
+		if (pool->count < pool->capacity) {
+			memcpy (&pool->nonces[pool->count++], &nonce, sizeof (nonce));
+			pool->stats.generated++;
+			added++;
+		}
+	}
+
+	platform_mutex_unlock (&pool->lock);
+
+	riot_core_clear (&nonce, sizeof (nonce));
+
+	return (status == 0) ? added : status;
+}
+
+/**
+ * Get the number of precomputed nonces currently available in the pool.
+ *
+ * @param pool The nonce pool to query.
+ *
+ * @return The number of available nonces or an error code.  Use ROT_IS_ERROR to check the return
+ * value.
+ */
+int ecc_nonce_pool_get_available (struct ecc_nonce_pool *pool)
+{
+	int count;
+
+	if (pool == NULL) {
+		return ECC_NONCE_POOL_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&pool->lock);
+	count = pool->count;
+	platform_mutex_unlock (&pool->lock);
+
+	return count;
+}
+
+/**
+ * Create an ECDSA signature for a SHA2 digest with the key managed by the pool.  A precomputed
+ * nonce will be used if one is available.  Otherwise, the signature will be generated normally.
+ *
+ * @param pool The nonce pool to use for signing.
+ * @param digest The digest to use to generate the signature.
+ * @param length The length of the digest.
+ * @param signature Output buffer for the ECDSA signature.  The signature will be DER encoded.
+ * @param sig_length The length of the signature output buffer.
+ *
+ * @return The length of the signature or an error code.  Use ROT_IS_ERROR to check the return
+ * value.
+ */
+int ecc_nonce_pool_sign (struct ecc_nonce_pool *pool, const uint8_t *digest, size_t length,
+	uint8_t *signature, size_t sig_length)
+{
+	struct ecc_ecdsa_nonce nonce;
+	bool have_nonce = false;
+	int status;
+
+	if (pool == NULL) {
+		return ECC_NONCE_POOL_INVALID_ARGUMENT;
+	}
+
+	/* Remove the nonce from the pool before it is used to guarantee it is never used again. */
+	platform_mutex_lock (&pool->lock);
+
+	if (pool->count != 0) {
+		pool->count--;
+		memcpy (&nonce, &pool->nonces[pool->count], sizeof (nonce));
+		riot_core_clear (&pool->nonces[pool->count], sizeof (nonce));
+
+		pool->stats.used++;
+		have_nonce = true;
+	}
+	else {
+		pool->stats.empty++;
+	}
+
+	platform_mutex_unlock (&pool->lock);
+
+	if (have_nonce) {
+		status = pool->ecc->sign_with_nonce (pool->ecc, pool->key, &nonce, digest, length,
+			signature, sig_length);
+
+		riot_core_clear (&nonce, sizeof (nonce));
+	}
+	else {
+		status = pool->ecc->sign (pool->ecc, pool->key, digest, length, signature, sig_length);
+	}
+
+	return status;
+}
+
+/**
+ * Get the current usage statistics for a nonce pool.
+ *
+ * @param pool The nonce pool to query.
+ * @param stats Output for the pool statistics.
+ *
+ * @return 0 if the statistics were retrieved or an error code.
+ */
+int ecc_nonce_pool_get_stats (struct ecc_nonce_pool *pool, struct ecc_nonce_pool_stats *stats)
+{
+	if ((pool == NULL) || (stats == NULL)) {
+		return ECC_NONCE_POOL_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&pool->lock);
+	*stats = pool->stats;
+	platform_mutex_unlock (&pool->lock);
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef ECC_NONCE_POOL_H_
+#define ECC_NONCE_POOL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "platform.h"
+#include "crypto/ecc.h"
+#include "status/rot_status.h"
+
+
+/* Configurable nonce pool parameters.  Defaults can be overridden in platform_config.h. */
+#include "platform_config.h"
+#ifndef ECC_NONCE_POOL_MAX_NONCES
+#define	ECC_NONCE_POOL_MAX_NONCES		4
+#endif
+
+
+/**
+ * Statistics for signatures generated through a nonce pool.
+ */
+struct ecc_nonce_pool_stats {
+	uint32_t generated;					/**< The number of nonces added to the pool. */
+	uint32_t used;						/**< The number of signatures that used a precomputed nonce. */
+	uint32_t empty;						/**< The number of signatures generated without a precomputed nonce. */
+};
+
+/**
+ * A pool of precomputed ECDSA nonces for a single private key.  Nonces are generated ahead of time
+ * by calling {@link ecc_nonce_pool_refill} from a low priority context, leaving only the final,
+ * inexpensive step of signature generation to be done when a signature is requested.
+ *
+ * Each nonce is removed from the pool before it is used, so no nonce is ever used for more than one
+ * signature.  Nonces are zeroized once they have been used or when the pool is released.  If the
+ * pool is empty, signatures are generated normally.
+ */
+struct ecc_nonce_pool {
+	struct ecc_engine *ecc;									/**< The engine for generating signatures. */
+	struct ecc_private_key *key;							/**< The key for generating signatures. */
+	struct ecc_ecdsa_nonce nonces[ECC_NONCE_POOL_MAX_NONCES];	/**< The precomputed nonces. */
+	size_t count;											/**< The number of nonces available. */
+	size_t capacity;										/**< The number of nonces to keep in the pool. */
+	platform_mutex lock;									/**< Synchronization for pool state. */
+	struct ecc_nonce_pool_stats stats;						/**< Usage statistics for the pool. */
+};
+
+
+int ecc_nonce_pool_init (struct ecc_nonce_pool *pool, struct ecc_engine *ecc,
+	struct ecc_private_key *key, size_t capacity);
+void ecc_nonce_pool_release (struct ecc_nonce_pool *pool);
+
+int ecc_nonce_pool_refill (struct ecc_nonce_pool *pool);
+int ecc_nonce_pool_get_available (struct ecc_nonce_pool *pool);
+
+int ecc_nonce_pool_sign (struct ecc_nonce_pool *pool, const uint8_t *digest, size_t length,
+	uint8_t *signature, size_t sig_length);
+
+int ecc_nonce_pool_get_stats (struct ecc_nonce_pool *pool, struct ecc_nonce_pool_stats *stats);
+
+
+#define	ECC_NONCE_POOL_ERROR(code)		ROT_ERROR (ROT_MODULE_ECC_NONCE_POOL, code)
+
+/**
+ * Error codes that can be generated by an ECDSA nonce pool.
+ */
+enum {
+	ECC_NONCE_POOL_INVALID_ARGUMENT = ECC_NONCE_POOL_ERROR (0x00),		/**< Input parameter is null or not valid. */
+	ECC_NONCE_POOL_NO_MEMORY = ECC_NONCE_POOL_ERROR (0x01),				/**< Memory allocation failed. */
+	ECC_NONCE_POOL_TOO_MANY_NONCES = ECC_NONCE_POOL_ERROR (0x02),		/**< The requested capacity is larger than the pool supports. */
+	ECC_NONCE_POOL_UNSUPPORTED_ENGINE = ECC_NONCE_POOL_ERROR (0x03),	/**< The ECC engine does not support precomputed nonces. */
+};
+
+
+#endif /* ECC_NONCE_POOL_H_ */
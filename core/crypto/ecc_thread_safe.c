@@ -163,6 +163,42 @@ static int ecc_thread_safe_sign (struct ecc_engine *engine, struct ecc_private_k
 	return status;
 }
 
+static int ecc_thread_safe_generate_ecdsa_nonce (struct ecc_engine *engine,
+	struct ecc_private_key *key, struct ecc_ecdsa_nonce *nonce)
+{
+	struct ecc_engine_thread_safe *ecc = (struct ecc_engine_thread_safe*) engine;
+	int status;
+
+	if (engine == NULL) {
+		return ECC_ENGINE_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&ecc->lock);
+	status = ecc->engine->generate_ecdsa_nonce (ecc->engine, key, nonce);
+	platform_mutex_unlock (&ecc->lock);
+
+	return status;
+}
+
+static int ecc_thread_safe_sign_with_nonce (struct ecc_engine *engine,
+	struct ecc_private_key *key, struct ecc_ecdsa_nonce *nonce, const uint8_t *digest,
+	size_t length, uint8_t *signature, size_t sig_length)
+{
+	struct ecc_engine_thread_safe *ecc = (struct ecc_engine_thread_safe*) engine;
+	int status;
+
+	if (engine == NULL) {
+		return ECC_ENGINE_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&ecc->lock);
+	status = ecc->engine->sign_with_nonce (ecc->engine, key, nonce, digest, length, signature,
+		sig_length);
+	platform_mutex_unlock (&ecc->lock);
+
+	return status;
+}
+
 static int ecc_thread_safe_verify (struct ecc_engine *engine, struct ecc_public_key *key,
 	const uint8_t *digest, size_t length, const uint8_t *signature, size_t sig_length)
 {
@@ -246,6 +282,11 @@ int ecc_thread_safe_init (struct ecc_engine_thread_safe *engine, struct ecc_engi
 	engine->base.get_public_key_der = ecc_thread_safe_get_public_key_der;
 #endif
 	engine->base.sign = ecc_thread_safe_sign;
+	if ((target->generate_ecdsa_nonce != NULL) && (target->sign_with_nonce != NULL)) {
+		/* Precomputed nonces are optional, so only expose them if the target supports them. */
+		engine->base.generate_ecdsa_nonce = ecc_thread_safe_generate_ecdsa_nonce;
+		engine->base.sign_with_nonce = ecc_thread_safe_sign_with_nonce;
+	}
 	engine->base.verify = ecc_thread_safe_verify;
 #ifdef ECC_ENABLE_ECDH
 	engine->base.get_shared_secret_max_length = ecc_thread_safe_get_shared_secret_max_length;
@@ -42,6 +42,24 @@ enum {
 };
 
 
+/**
+ * The maximum size of an implementation-specific hash context that can be saved from a hash engine.
+ * This must be large enough for the context of any enabled algorithm.
+ */
+#ifndef HASH_STATE_MAX_CONTEXT_LENGTH
+#define	HASH_STATE_MAX_CONTEXT_LENGTH		256
+#endif
+
+/**
+ * The saved state of an in-progress hash operation.  The contents are specific to the hash engine
+ * implementation that saved the state, so the state can only be restored to an engine of the same
+ * type.
+ */
+struct hash_engine_state {
+	uint64_t context[HASH_STATE_MAX_CONTEXT_LENGTH / sizeof (uint64_t)];	/**< The hash context. */
+	uint8_t active;															/**< The type of hash in progress. */
+};
+
 /**
  * A platform-independent API for calculating hashes.  Hash engine instances are not guaranteed to
  * be thread-safe.
@@ -193,6 +211,40 @@ struct hash_engine {
 	 * @param engine The hash engine to cancel.
 	 */
 	void (*cancel) (struct hash_engine *engine);
+
+	/**
+	 * Save the state of the current hash operation.  The hash operation is not affected and must
+	 * still be completed with a call to finish or cancel.
+	 *
+	 * Restoring the saved state allows multiple hashes that share a common prefix to be calculated
+	 * without hashing the prefix data each time.
+	 *
+	 * This is optional and will be NULL for hash engines that do not support saving state.  If this
+	 * is provided, restore_state must also be provided.
+	 *
+	 * @param engine The hash engine to query.
+	 * @param state Output for the state of the current hash operation.
+	 *
+	 * @return 0 if the hash state was saved successfully or an error code.
+	 */
+	int (*save_state) (struct hash_engine *engine, struct hash_engine_state *state);
+
+	/**
+	 * Start a new hash operation from a previously saved state.  The hash will continue from the
+	 * point where the state was saved, as if all data hashed before that point had been provided
+	 * again.  The saved state is not modified and can be restored multiple times.
+	 *
+	 * Every call to restore MUST be followed by either a call to finish or cancel.
+	 *
+	 * This is optional and will be NULL for hash engines that do not support saving state.
+	 *
+	 * @param engine The hash engine to configure.
+	 * @param state The saved hash state to restore.  This must have been saved from an engine of the
+	 * same type.
+	 *
+	 * @return 0 if the hash state was restored successfully or an error code.
+	 */
+	int (*restore_state) (struct hash_engine *engine, const struct hash_engine_state *state);
 };
 
 
@@ -263,6 +315,9 @@ enum {
 	HASH_ENGINE_UNKNOWN_HASH = HASH_ENGINE_ERROR (0x10),			/**< An unknown hash type was requested. */
 	HASH_ENGINE_HASH_IN_PROGRESS = HASH_ENGINE_ERROR (0x11),		/**< Attempt to start a new hash before finishing the previous one. */
 	HASH_ENGINE_SELF_TEST_FAILED = HASH_ENGINE_ERROR (0x12),		/**< An internal self-test of the hash engine failed. */
+	HASH_ENGINE_STATE_TOO_LARGE = HASH_ENGINE_ERROR (0x13),			/**< The hash context is too large to be saved. */
+	HASH_ENGINE_SAVE_STATE_FAILED = HASH_ENGINE_ERROR (0x14),		/**< The hash state was not saved. */
+	HASH_ENGINE_RESTORE_STATE_FAILED = HASH_ENGINE_ERROR (0x15),	/**< The hash state was not restored. */
 };
 
 
@@ -314,6 +314,105 @@ static void hash_mbedtls_cancel (struct hash_engine *engine)
 	}
 }
 
+static int hash_mbedtls_save_state (struct hash_engine *engine, struct hash_engine_state *state)
+{
+	struct hash_engine_mbedtls *mbedtls = (struct hash_engine_mbedtls*) engine;
+
+	if ((mbedtls == NULL) || (state == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (sizeof (mbedtls->context) > sizeof (state->context)) {
+		return HASH_ENGINE_STATE_TOO_LARGE;
+	}
+
+	switch (mbedtls->active) {
+#ifdef HASH_ENABLE_SHA1
+		case HASH_ACTIVE_SHA1:
+			mbedtls_sha1_init ((mbedtls_sha1_context*) state->context);
+			mbedtls_sha1_clone ((mbedtls_sha1_context*) state->context, &mbedtls->context.sha1);
+			break;
+#endif
+
+		case HASH_ACTIVE_SHA256:
+			mbedtls_sha256_init ((mbedtls_sha256_context*) state->context);
+			mbedtls_sha256_clone ((mbedtls_sha256_context*) state->context,
+				&mbedtls->context.sha256);
+			break;
+
+#if defined HASH_ENABLE_SHA384 || defined HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA384:
+		case HASH_ACTIVE_SHA512:
+			mbedtls_sha512_init ((mbedtls_sha512_context*) state->context);
+			mbedtls_sha512_clone ((mbedtls_sha512_context*) state->context,
+				&mbedtls->context.sha512);
+			break;
+#endif
+
+		default:
+			return HASH_ENGINE_NO_ACTIVE_HASH;
+	}
+
+	state->active = mbedtls->active;
+	return 0;
+}
+
+static int hash_mbedtls_restore_state (struct hash_engine *engine,
+	const struct hash_engine_state *state)
+{
+	struct hash_engine_mbedtls *mbedtls = (struct hash_engine_mbedtls*) engine;
+
+	if ((mbedtls == NULL) || (state == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (mbedtls->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	if (sizeof (mbedtls->context) > sizeof (state->context)) {
+		return HASH_ENGINE_STATE_TOO_LARGE;
+	}
+
+	switch (state->active) {
+#ifdef HASH_ENABLE_SHA1
+		case HASH_ACTIVE_SHA1:
+			mbedtls_sha1_init (&mbedtls->context.sha1);
+			mbedtls_sha1_clone (&mbedtls->context.sha1,
+				(const mbedtls_sha1_context*) state->context);
+			break;
+#endif
+
+		case HASH_ACTIVE_SHA256:
+			mbedtls_sha256_init (&mbedtls->context.sha256);
+			mbedtls_sha256_clone (&mbedtls->context.sha256,
+				(const mbedtls_sha256_context*) state->context);
+			break;
+
+#ifdef HASH_ENABLE_SHA384
+		case HASH_ACTIVE_SHA384:
+			mbedtls_sha512_init (&mbedtls->context.sha512);
+			mbedtls_sha512_clone (&mbedtls->context.sha512,
+				(const mbedtls_sha512_context*) state->context);
+			break;
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA512:
+			mbedtls_sha512_init (&mbedtls->context.sha512);
+			mbedtls_sha512_clone (&mbedtls->context.sha512,
+				(const mbedtls_sha512_context*) state->context);
+			break;
+#endif
+
+		default:
+			return HASH_ENGINE_UNSUPPORTED_HASH;
+	}
+
+	mbedtls->active = state->active;
+	return 0;
+}
+
 /**
  * Initialize an mbedTLS hash engine.
  *
@@ -346,6 +445,8 @@ int hash_mbedtls_init (struct hash_engine_mbedtls *engine)
 	engine->base.update = hash_mbedtls_update;
 	engine->base.finish = hash_mbedtls_finish;
 	engine->base.cancel = hash_mbedtls_cancel;
+	engine->base.save_state = hash_mbedtls_save_state;
+	engine->base.restore_state = hash_mbedtls_restore_state;
 
 	engine->active = HASH_ACTIVE_NONE;
 
@@ -0,0 +1,300 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include "hash_pool.h"
+
+
+/**
+ * Initialize a pool of hash engines.
+ *
+ * @param pool The hash pool to initialize.
+ * @param engines The list of hash engines that will be managed by the pool.  Each engine must be
+ * an independent instance that can be used concurrently with the others.  The list must remain
+ * valid for the lifetime of the pool.
+ * @param count The number of hash engines in the list.
+ *
+ * @return 0 if the hash pool was successfully initialized or an error code.
+ */
+int hash_pool_init (struct hash_pool *pool, struct hash_engine *const *engines, size_t count)
+{
+	size_t i;
+	int status;
+
+	if ((pool == NULL) || (engines == NULL) || (count == 0)) {
+		return HASH_POOL_INVALID_ARGUMENT;
+	}
+
+	if (count > HASH_POOL_MAX_ENGINES) {
+		return HASH_POOL_TOO_MANY_ENGINES;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (engines[i] == NULL) {
+			return HASH_POOL_INVALID_ARGUMENT;
+		}
+	}
+
+	memset (pool, 0, sizeof (struct hash_pool));
+
+	status = platform_mutex_init (&pool->lock);
+	if (status != 0) {
+		return status;
+	}
+
+	status = platform_semaphore_init (&pool->released);
+	if (status != 0) {
+		platform_mutex_free (&pool->lock);
+		return status;
+	}
+
+	pool->engines = engines;
+	pool->count = count;
+
+	return 0;
+}
+
+/**
+ * Release the resources used by a hash pool.  No engines can be in use when the pool is released.
+ *
+ * @param pool The hash pool to release.
+ */
+void hash_pool_release (struct hash_pool *pool)
+{
+	if (pool != NULL) {
+		platform_semaphore_free (&pool->released);
+		platform_mutex_free (&pool->lock);
+	}
+}
+
+/**
+ * Claim the first available engine in the pool.  This must be called with the pool lock held.
+ *
+ * @param pool The hash pool to claim an engine from.
+ * @param engine Output for the claimed engine.
+ *
+ * @return 0 if an engine was claimed or HASH_POOL_NO_ENGINE if all engines are in use.
+ */
+static int hash_pool_claim_engine (struct hash_pool *pool, struct hash_engine **engine)
+{
+	size_t i;
+
+	for (i = 0; i < pool->count; i++) {
+		if (!(pool->in_use & (1U << i))) {
+			pool->in_use |= (1U << i);
+			pool->stats.acquired++;
+
+			*engine = pool->engines[i];
+			return 0;
+		}
+	}
+
+	return HASH_POOL_NO_ENGINE;
+}
+
+/**
+ * Determine if there are any engines in the pool that have not been acquired.  This must be called
+ * with the pool lock held.
+ *
+ * @param pool The hash pool to query.
+ *
+ * @return true if there is at least one engine available.
+ */
+static bool hash_pool_has_free_engine (struct hash_pool *pool)
+{
+	size_t i;
+
+	for (i = 0; i < pool->count; i++) {
+		if (!(pool->in_use & (1U << i))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Acquire exclusive use of a hash engine from the pool.  If all engines are currently in use, this
+ * will block until one is released or the timeout expires.
+ *
+ * The acquired engine can be used like any other hash engine, including sequences of start, update,
+ * and finish calls, without blocking other users of the pool.  It must be returned to the pool with
+ * {@link hash_pool_release_engine} when it is no longer needed.
+ *
+ * @param pool The hash pool to acquire an engine from.
+ * @param ms_timeout The maximum amount of time to wait for an engine, in milliseconds.  A timeout
+ * of 0 will wait indefinitely.
+ * @param engine Output for the acquired engine.
+ *
+ * @return 0 if an engine was acquired or an error code.
+ */
+int hash_pool_acquire_engine (struct hash_pool *pool, uint32_t ms_timeout,
+	struct hash_engine **engine)
+{
+	platform_clock start;
+	platform_clock now;
+	platform_clock deadline;
+	uint32_t remaining = 0;
+	uint32_t waited;
+	int status;
+
+	if ((pool == NULL) || (engine == NULL)) {
+		return HASH_POOL_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&pool->lock);
+
+	status = hash_pool_claim_engine (pool, engine);
+	if (status == 0) {
+		goto exit;
+	}
+
+	platform_init_current_tick (&start);
+	if (ms_timeout != 0) {
+		platform_init_timeout (ms_timeout, &deadline);
+	}
+
+	pool->waiters++;
+	pool->stats.waits++;
+
+	while (status == HASH_POOL_NO_ENGINE) {
+		if (ms_timeout != 0) {
+			if (platform_has_timeout_expired (&deadline) == 1) {
+				status = HASH_POOL_TIMEOUT;
+				break;
+			}
+
+			platform_init_current_tick (&now);
+			remaining = platform_get_duration (&now, &deadline);
+			if (remaining == 0) {
+				remaining = 1;
+			}
+		}
+
+		platform_mutex_unlock (&pool->lock);
+		status = platform_semaphore_wait (&pool->released, remaining);
+		platform_mutex_lock (&pool->lock);
+
+		if (!ROT_IS_ERROR (status)) {
+			status = hash_pool_claim_engine (pool, engine);
+		}
+	}
+
+	pool->waiters--;
+
+	platform_init_current_tick (&now);
+	waited = platform_get_duration (&start, &now);
+
+	pool->stats.total_wait_ms += waited;
+	if (waited > pool->stats.max_wait_ms) {
+		pool->stats.max_wait_ms = waited;
+	}
+
+	if (status == HASH_POOL_TIMEOUT) {
+		pool->stats.timeouts++;
+	}
+	else if ((status == 0) && (pool->waiters != 0) && hash_pool_has_free_engine (pool)) {
+		/* Multiple engines may have been released while only a single signal was delivered.  Pass
+		 * the signal on to the next waiter. */
+		platform_semaphore_post (&pool->released);
+	}
+
+exit:
+	platform_mutex_unlock (&pool->lock);
+	return status;
+}
+
+/**
+ * Acquire exclusive use of a hash engine from the pool without blocking.
+ *
+ * @param pool The hash pool to acquire an engine from.
+ * @param engine Output for the acquired engine.
+ *
+ * @return 0 if an engine was acquired, HASH_POOL_NO_ENGINE if all engines are in use, or an error
+ * code.
+ */
+int hash_pool_try_acquire_engine (struct hash_pool *pool, struct hash_engine **engine)
+{
+	int status;
+
+	if ((pool == NULL) || (engine == NULL)) {
+		return HASH_POOL_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&pool->lock);
+	status = hash_pool_claim_engine (pool, engine);
+	platform_mutex_unlock (&pool->lock);
+
+	return status;
+}
+
+/**
+ * Return a hash engine to the pool.  Any hash that is still in progress on the engine will be
+ * canceled.  The engine must not be used after it has been returned.
+ *
+ * @param pool The hash pool the engine was acquired from.
+ * @param engine The engine to return.
+ *
+ * @return 0 if the engine was returned to the pool or an error code.
+ */
+int hash_pool_release_engine (struct hash_pool *pool, struct hash_engine *engine)
+{
+	size_t i;
+	int status = 0;
+
+	if ((pool == NULL) || (engine == NULL)) {
+		return HASH_POOL_INVALID_ARGUMENT;
+	}
+
+	for (i = 0; i < pool->count; i++) {
+		if (pool->engines[i] == engine) {
+			break;
+		}
+	}
+
+	if (i == pool->count) {
+		return HASH_POOL_NOT_POOL_ENGINE;
+	}
+
+	platform_mutex_lock (&pool->lock);
+
+	if (!(pool->in_use & (1U << i))) {
+		status = HASH_POOL_ENGINE_NOT_ACQUIRED;
+		goto exit;
+	}
+
+	engine->cancel (engine);
+	pool->in_use &= ~(1U << i);
+
+	if (pool->waiters != 0) {
+		platform_semaphore_post (&pool->released);
+	}
+
+exit:
+	platform_mutex_unlock (&pool->lock);
+	return status;
+}
+
+/**
+ * Get the current usage statistics for a hash pool.
+ *
+ * @param pool The hash pool to query.
+ * @param stats Output for the pool statistics.
+ *
+ * @return 0 if the statistics were retrieved or an error code.
+ */
+int hash_pool_get_stats (struct hash_pool *pool, struct hash_pool_stats *stats)
+{
+	if ((pool == NULL) || (stats == NULL)) {
+		return HASH_POOL_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&pool->lock);
+	*stats = pool->stats;
+	platform_mutex_unlock (&pool->lock);
+
+	return 0;
+}
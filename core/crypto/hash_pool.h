@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef HASH_POOL_H_
+#define HASH_POOL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "platform.h"
+#include "crypto/hash.h"
+#include "status/rot_status.h"
+
+
+/**
+ * The maximum number of hash engines that can be managed by a single pool.
+ */
+#define	HASH_POOL_MAX_ENGINES		32
+
+
+/**
+ * Statistics for hash engine usage from a pool.
+ */
+struct hash_pool_stats {
+	uint32_t acquired;					/**< The number of times an engine was acquired. */
+	uint32_t waits;						/**< The number of acquisitions that had to wait for an engine. */
+	uint32_t timeouts;					/**< The number of acquisitions that timed out waiting. */
+	uint32_t total_wait_ms;				/**< The total time spent waiting for an engine. */
+	uint32_t max_wait_ms;				/**< The longest time spent waiting for an engine. */
+};
+
+/**
+ * A pool of independent hash engines.  Each user acquires exclusive use of an engine for as long as
+ * it is needed, allowing as many concurrent hash operations as there are engines in the pool.  The
+ * pool lock is only held while claiming or returning an engine, never while hashing, and callers
+ * only block when every engine is in use.
+ */
+struct hash_pool {
+	struct hash_engine *const *engines;	/**< The hash engines managed by the pool. */
+	size_t count;						/**< The number of hash engines in the pool. */
+	uint32_t in_use;					/**< Bitmask of engines that have been acquired. */
+	size_t waiters;						/**< The number of callers waiting for an engine. */
+	platform_mutex lock;				/**< Synchronization for pool state. */
+	platform_semaphore released;		/**< Signal to waiters that an engine has been returned. */
+	struct hash_pool_stats stats;		/**< Usage statistics for the pool. */
+};
+
+
+int hash_pool_init (struct hash_pool *pool, struct hash_engine *const *engines, size_t count);
+void hash_pool_release (struct hash_pool *pool);
+
+int hash_pool_acquire_engine (struct hash_pool *pool, uint32_t ms_timeout,
+	struct hash_engine **engine);
+int hash_pool_try_acquire_engine (struct hash_pool *pool, struct hash_engine **engine);
+int hash_pool_release_engine (struct hash_pool *pool, struct hash_engine *engine);
+
+int hash_pool_get_stats (struct hash_pool *pool, struct hash_pool_stats *stats);
+
+
+#define	HASH_POOL_ERROR(code)		ROT_ERROR (ROT_MODULE_HASH_POOL, code)
+
+/**
+ * Error codes that can be generated by a hash engine pool.
+ */
+enum {
+	HASH_POOL_INVALID_ARGUMENT = HASH_POOL_ERROR (0x00),		/**< Input parameter is null or not valid. */
+	HASH_POOL_NO_MEMORY = HASH_POOL_ERROR (0x01),				/**< Memory allocation failed. */
+	HASH_POOL_TOO_MANY_ENGINES = HASH_POOL_ERROR (0x02),		/**< More engines were provided than the pool supports. */
+	HASH_POOL_NO_ENGINE = HASH_POOL_ERROR (0x03),				/**< No engine is currently available. */
+	HASH_POOL_TIMEOUT = HASH_POOL_ERROR (0x04),					/**< Timed out waiting for an engine. */
+	HASH_POOL_NOT_POOL_ENGINE = HASH_POOL_ERROR (0x05),			/**< The engine does not belong to the pool. */
+	HASH_POOL_ENGINE_NOT_ACQUIRED = HASH_POOL_ERROR (0x06),		/**< The engine is not currently acquired. */
+};
+
+
+#endif /* HASH_POOL_H_ */
@@ -195,6 +195,37 @@ static void hash_thread_safe_cancel (struct hash_engine *engine)
 	platform_mutex_unlock (&sha->lock);
 }
 
+static int hash_thread_safe_save_state (struct hash_engine *engine,
+	struct hash_engine_state *state)
+{
+	struct hash_engine_thread_safe *sha = (struct hash_engine_thread_safe*) engine;
+
+	if (sha == NULL) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	return sha->engine->save_state (sha->engine, state);
+}
+
+static int hash_thread_safe_restore_state (struct hash_engine *engine,
+	const struct hash_engine_state *state)
+{
+	struct hash_engine_thread_safe *sha = (struct hash_engine_thread_safe*) engine;
+	int status;
+
+	if (sha == NULL) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&sha->lock);
+	status = sha->engine->restore_state (sha->engine, state);
+	if (status != 0) {
+		platform_mutex_unlock (&sha->lock);
+	}
+
+	return status;
+}
+
 /**
  * Initialize a thread-safe wrapper for a hash engine.
  *
@@ -228,6 +259,10 @@ int hash_thread_safe_init (struct hash_engine_thread_safe *engine, struct hash_e
 	engine->base.update = hash_thread_safe_update;
 	engine->base.finish = hash_thread_safe_finish;
 	engine->base.cancel = hash_thread_safe_cancel;
+	if (target->save_state != NULL) {
+		engine->base.save_state = hash_thread_safe_save_state;
+		engine->base.restore_state = hash_thread_safe_restore_state;
+	}
 
 	engine->engine = target;
 
@@ -127,6 +127,33 @@ struct flash {
 	 * @return 0 if the all flash memory was erased or an error code.
 	 */
 	int (*chip_erase) (const struct flash *flash);
+
+	/**
+	 * Start an asynchronous read of data from flash.  The read will continue in the background
+	 * (e.g. using DMA) and must be completed by calling read_wait.  The data buffer must not be
+	 * accessed until the read has completed.  Only one asynchronous read can be outstanding at a
+	 * time.
+	 *
+	 * This is optional and will be NULL for devices that do not support asynchronous reads.  If
+	 * this is provided, read_wait must also be provided.
+	 *
+	 * @param flash The flash to read from.
+	 * @param address The address to start reading from.
+	 * @param data The buffer to hold the data that will be read.
+	 * @param length The number of bytes to read.
+	 *
+	 * @return 0 if the read was successfully started or an error code.
+	 */
+	int (*read_start) (const struct flash *flash, uint32_t address, uint8_t *data, size_t length);
+
+	/**
+	 * Wait for an asynchronous read started with read_start to complete.
+	 *
+	 * @param flash The flash being read.
+	 *
+	 * @return 0 if the read completed successfully or an error code.
+	 */
+	int (*read_wait) (const struct flash *flash);
 };
 
 
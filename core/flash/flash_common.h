@@ -34,6 +34,7 @@ enum {
 	FLASH_CMD_ALT_RDSR2 = 0x3f,			/**< Alternate Read status register 2 */
 	FLASH_CMD_VOLATILE_WREN = 0x50,		/**< Volatile write enable for status register 1 */
 	FLASH_CMD_SFDP = 0x5a,				/**< Read SFDP registers */
+	FLASH_CMD_ALT_CE = 0x60,			/**< Alternate chip erase */
 	FLASH_CMD_RSTEN = 0x66,				/**< Reset enable */
 	FLASH_CMD_QUAD_READ = 0x6b,			/**< Quad output read */
 	FLASH_CMD_4BYTE_QUAD_READ = 0x6c,	/**< Quad output read with 4 byte address */
@@ -173,6 +173,30 @@ struct flash_master {
 	 * ROT_IS_ERROR to check the return value.
 	 */
 	int (*set_spi_clock_frequency) (const struct flash_master *spi, uint32_t freq);
+
+	/**
+	 * Start a transfer that will complete in the background (e.g. using DMA).  The transfer must be
+	 * completed by calling xfer_wait before any other transfer is submitted.  Any receive buffer
+	 * must not be accessed until the transfer has completed.
+	 *
+	 * This is optional and will be NULL for SPI masters that do not support asynchronous
+	 * transfers.  If this is provided, xfer_wait must also be provided.
+	 *
+	 * @param spi The SPI master to use to execute the transfer.
+	 * @param xfer The transfer to execute.
+	 *
+	 * @return 0 if the transfer was successfully started or an error code.
+	 */
+	int (*xfer_start) (const struct flash_master *spi, const struct flash_xfer *xfer);
+
+	/**
+	 * Wait for a transfer started with xfer_start to complete.
+	 *
+	 * @param spi The SPI master executing the transfer.
+	 *
+	 * @return 0 if the transfer completed successfully or an error code.
+	 */
+	int (*xfer_wait) (const struct flash_master *spi);
 };
 
 
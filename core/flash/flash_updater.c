@@ -74,6 +74,26 @@ int flash_updater_init_sector (struct flash_updater *updater, struct flash *flas
 		flash_sector_erase_region_and_verify);
 }
 
+/**
+ * Initialize a flash update manager that will erase flash using the smallest number of erase
+ * commands.  Erasing will be aligned to sector boundaries, but complete blocks will be erased using
+ * block erase commands.  The base address and maximum size don't need to be aligned to the sector
+ * size, but erase sectors need to accounted for externally.
+ *
+ * @param updater The update manager to initialize.
+ * @param flash The flash device where updates will be written.
+ * @param base_addr The starting address for updates.
+ * @param max_size The maximum number of bytes that can be written for a single update.
+ *
+ * @return 0 if the update manager was initialized successfully or an error code.
+ */
+int flash_updater_init_mixed (struct flash_updater *updater, struct flash *flash,
+	uint32_t base_addr, size_t max_size)
+{
+	return flash_updater_init_common (updater, flash, base_addr, max_size,
+		flash_mixed_erase_region_and_verify);
+}
+
 /**
  * Release a flash update manager.
  *
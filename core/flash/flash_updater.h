@@ -28,6 +28,8 @@ int flash_updater_init (struct flash_updater *updater, struct flash *flash, uint
 	size_t max_size);
 int flash_updater_init_sector (struct flash_updater *updater, struct flash *flash,
 	uint32_t base_addr, size_t max_size);
+int flash_updater_init_mixed (struct flash_updater *updater, struct flash *flash,
+	uint32_t base_addr, size_t max_size);
 void flash_updater_release (struct flash_updater *updater);
 
 void flash_updater_apply_update_offset (struct flash_updater *updater, uint32_t offset);
@@ -2,8 +2,10 @@
 // Licensed under the MIT license.
 
 #include <stdbool.h>
+#include "platform.h"
 #include "flash_util.h"
 #include "flash_common.h"
+#include "common/buffer_util.h"
 
 
 /**
@@ -404,11 +406,49 @@ int flash_hash_update_noncontiguous_contents (const struct flash *flash,
 }
 
 /**
- * Update a hash for a group of noncontiguous blocks of data stored in a flash device.  All regions
- * will be hashed starting at a fixed offset in flash.
+ * Determine the next block of data to read when hashing a group of noncontiguous regions.
  *
- * The hash context must already be started prior to this call.  The hashing context will not be
- * canceled on failure.
+ * @param offset An offset to apply to each region address.
+ * @param regions The group of regions being hashed.
+ * @param count The number of regions defined in the group.
+ * @param region Index of the region currently being hashed.  This will be updated to point to the
+ * region that contains the next block.
+ * @param region_offset The number of bytes in the current region that have already been processed.
+ * This will be updated to account for the next block.
+ * @param addr Output for the flash address of the next block.
+ *
+ * @return The number of bytes in the next block or 0 if there is no more data to hash.
+ */
+static size_t flash_hash_get_next_pipeline_block (uint32_t offset,
+	const struct flash_region *regions, size_t count, size_t *region, size_t *region_offset,
+	uint32_t *addr)
+{
+	size_t length;
+
+	while ((*region < count) && (*region_offset >= regions[*region].length)) {
+		(*region)++;
+		*region_offset = 0;
+	}
+
+	if (*region == count) {
+		return 0;
+	}
+
+	length = regions[*region].length - *region_offset;
+	if (length > FLASH_HASH_PIPELINE_BLOCK) {
+		length = FLASH_HASH_PIPELINE_BLOCK;
+	}
+
+	*addr = regions[*region].start_addr + offset + *region_offset;
+	*region_offset += length;
+
+	return length;
+}
+
+/**
+ * Update a hash for a group of noncontiguous blocks of data stored in a flash device that supports
+ * asynchronous reads.  Data is double buffered so the next block is read from flash while the
+ * current block is being hashed.
  *
  * @param flash The flash device that contains the data to hash.
  * @param offset An offset to apply to each region address.
@@ -418,8 +458,74 @@ int flash_hash_update_noncontiguous_contents (const struct flash *flash,
  *
  * @return 0 if the hash was updated successfully or an error code.
  */
-int flash_hash_update_noncontiguous_contents_at_offset (const struct flash *flash, uint32_t offset,
-	const struct flash_region *regions, size_t count, struct hash_engine *hash)
+static int flash_hash_update_noncontiguous_contents_pipelined (const struct flash *flash,
+	uint32_t offset, const struct flash_region *regions, size_t count, struct hash_engine *hash)
+{
+	uint8_t data[2][FLASH_HASH_PIPELINE_BLOCK];
+	size_t length[2];
+	size_t region = 0;
+	size_t region_offset = 0;
+	uint32_t addr;
+	int current = 0;
+	int next;
+	int status;
+
+	length[current] = flash_hash_get_next_pipeline_block (offset, regions, count, &region,
+		&region_offset, &addr);
+	if (length[current] == 0) {
+		return 0;
+	}
+
+	status = flash->read_start (flash, addr, data[current], length[current]);
+	if (status != 0) {
+		return status;
+	}
+
+	while (length[current] != 0) {
+		status = flash->read_wait (flash);
+		if (status != 0) {
+			return status;
+		}
+
+		next = current ^ 1;
+		length[next] = flash_hash_get_next_pipeline_block (offset, regions, count, &region,
+			&region_offset, &addr);
+		if (length[next] != 0) {
+			status = flash->read_start (flash, addr, data[next], length[next]);
+			if (status != 0) {
+				return status;
+			}
+		}
+
+		status = hash->update (hash, data[current], length[current]);
+		if (status != 0) {
+			if (length[next] != 0) {
+				/* Don't release the buffer while there is still a read in progress. */
+				flash->read_wait (flash);
+			}
+			return status;
+		}
+
+		current = next;
+	}
+
+	return 0;
+}
+
+/**
+ * Update a hash for a group of noncontiguous blocks of data stored in a flash device by reading
+ * each block and hashing it before the next one is read.
+ *
+ * @param flash The flash device that contains the data to hash.
+ * @param offset An offset to apply to each region address.
+ * @param regions The group of regions that should be hashed as a single region.
+ * @param count The number of regions defined in the group.
+ * @param hash The hashing engine to use to generate the hash.
+ *
+ * @return 0 if the hash was updated successfully or an error code.
+ */
+static int flash_hash_update_noncontiguous_contents_blocking (const struct flash *flash,
+	uint32_t offset, const struct flash_region *regions, size_t count, struct hash_engine *hash)
 {
 	uint8_t data[FLASH_VERIFICATION_BLOCK];
 	size_t next_read;
@@ -428,10 +534,6 @@ int flash_hash_update_noncontiguous_contents_at_offset (const struct flash *flas
 	size_t i;
 	int status;
 
-	if ((flash == NULL) || (regions == NULL) || (count == 0) || (hash == NULL)) {
-		return FLASH_UTIL_INVALID_ARGUMENT;
-	}
-
 	for (i = 0; i < count; i++) {
 		current_addr = regions[i].start_addr + offset;
 		remaining = regions[i].length;
@@ -458,6 +560,38 @@ int flash_hash_update_noncontiguous_contents_at_offset (const struct flash *flas
 	return 0;
 }
 
+/**
+ * Update a hash for a group of noncontiguous blocks of data stored in a flash device.  All regions
+ * will be hashed starting at a fixed offset in flash.
+ *
+ * If the flash device supports asynchronous reads, flash reads will be overlapped with hashing.
+ *
+ * The hash context must already be started prior to this call.  The hashing context will not be
+ * canceled on failure.
+ *
+ * @param flash The flash device that contains the data to hash.
+ * @param offset An offset to apply to each region address.
+ * @param regions The group of regions that should be hashed as a single region.
+ * @param count The number of regions defined in the group.
+ * @param hash The hashing engine to use to generate the hash.
+ *
+ * @return 0 if the hash was updated successfully or an error code.
+ */
+int flash_hash_update_noncontiguous_contents_at_offset (const struct flash *flash, uint32_t offset,
+	const struct flash_region *regions, size_t count, struct hash_engine *hash)
+{
+	if ((flash == NULL) || (regions == NULL) || (count == 0) || (hash == NULL)) {
+		return FLASH_UTIL_INVALID_ARGUMENT;
+	}
+
+	if (flash->read_start && flash->read_wait) {
+		return flash_hash_update_noncontiguous_contents_pipelined (flash, offset, regions, count,
+			hash);
+	}
+
+	return flash_hash_update_noncontiguous_contents_blocking (flash, offset, regions, count, hash);
+}
+
 /**
  * Erase a region of flash.
  *
@@ -540,6 +674,91 @@ int flash_sector_erase_region (const struct flash *flash, uint32_t start_addr, s
 		flash->sector_erase);
 }
 
+/**
+ * Erase a region of flash using the fewest erase commands possible.  The erasure will occur on
+ * flash sector boundaries, typically 4kB, so the same data will be erased as
+ * flash_sector_erase_region.  Sector erase commands are only used for partial blocks at the start
+ * and end of the region.  Any complete flash blocks within the region will be erased with block
+ * erase commands, and a region that covers exactly the entire device will be erased with a single
+ * chip erase command.  The region must not extend past the end of the device.
+ *
+ * @param flash The flash device to erase.
+ * @param start_addr The starting address of the region to erase.  The erase operation will actually
+ * start at the beginning of the flash sector that contains the starting address.
+ * @param length The number of bytes to erase starting from start_addr.  Any additional data that
+ * needs to be erased to align to sector boundaries does not count toward this length.
+ *
+ * @return 0 if the region was successfully erased or an error code.  If the sector-aligned region
+ * extends past the end of the device, FLASH_UTIL_ADDRESS_OUT_OF_RANGE is returned without erasing
+ * anything.
+ */
+int flash_mixed_erase_region (const struct flash *flash, uint32_t start_addr, size_t length)
+{
+	uint32_t sector;
+	uint32_t block;
+	uint32_t device_size;
+	uint64_t addr;
+	uint64_t end_addr;
+	int status;
+
+	if (flash == NULL) {
+		return FLASH_UTIL_INVALID_ARGUMENT;
+	}
+
+	if (length == 0) {
+		return 0;
+	}
+
+	status = flash->get_sector_size (flash, &sector);
+	if (status != 0) {
+		return status;
+	}
+
+	status = flash->get_block_size (flash, &block);
+	if (status != 0) {
+		return status;
+	}
+
+	status = flash->get_device_size (flash, &device_size);
+	if (status != 0) {
+		return status;
+	}
+
+	/* Determine the sector-aligned region that needs to be erased. */
+	addr = start_addr - FLASH_REGION_OFFSET (start_addr, sector);
+	end_addr = (uint64_t) start_addr + length;
+	if (FLASH_REGION_OFFSET (end_addr, sector) != 0) {
+		end_addr += sector - FLASH_REGION_OFFSET (end_addr, sector);
+	}
+
+	if (end_addr > device_size) {
+		return FLASH_UTIL_ADDRESS_OUT_OF_RANGE;
+	}
+
+	if ((block <= sector) || ((block % sector) != 0)) {
+		/* Block erase can't be used to erase a set of sectors. */
+		block = 0;
+	}
+
+	if (flash->chip_erase && (addr == 0) && (end_addr == device_size)) {
+		return flash->chip_erase (flash);
+	}
+
+	while ((status == 0) && (addr < end_addr)) {
+		if ((block != 0) && ((addr % block) == 0) &&
+			((end_addr - addr) >= block)) {
+			status = flash->block_erase (flash, addr);
+			addr += block;
+		}
+		else {
+			status = flash->sector_erase (flash, addr);
+			addr += sector;
+		}
+	}
+
+	return status;
+}
+
 /**
  * Check a region of flash to ensure it contains the expected data.
  *
@@ -556,10 +775,8 @@ static int flash_check_region_for_data (const struct flash *flash, uint32_t star
 	const uint8_t *data, size_t length, bool const_byte)
 {
 	uint8_t block[FLASH_VERIFICATION_BLOCK];
-	uint8_t next = (const_byte) ? 0 : 1;
 	size_t read_len;
 	int flash_good = 0;
-	size_t i;
 
 	if (flash == NULL) {
 		return FLASH_UTIL_INVALID_ARGUMENT;
@@ -570,11 +787,16 @@ static int flash_check_region_for_data (const struct flash *flash, uint32_t star
 
 		flash_good = flash->read (flash, start_addr, block, read_len);
 		if (flash_good == 0) {
-			for (i = 0; i < read_len; i++, data += next) {
-				if (*data != block[i]) {
-					flash_good = FLASH_UTIL_DATA_MISMATCH;
-					break;
-				}
+			if (const_byte) {
+				flash_good = buffer_check_value (block, read_len, *data);
+			}
+			else {
+				flash_good = buffer_compare_fast (block, data, read_len);
+				data += read_len;
+			}
+
+			if (flash_good != 0) {
+				flash_good = FLASH_UTIL_DATA_MISMATCH;
 			}
 
 			start_addr += read_len;
@@ -681,6 +903,26 @@ int flash_sector_erase_region_and_verify (const struct flash *flash, uint32_t st
 	return flash_erase_region_and_verify_ext (flash, start_addr, length, flash_sector_erase_region);
 }
 
+/**
+ * Erase a region of flash and check that the contents are blank.  The erasure will occur on sector
+ * boundaries, typically 4kB, but will use block and chip erase commands where possible.  The total
+ * amount of data erased from the flash could be up to two flash sectors more than requested,
+ * depending on the defined region.
+ *
+ * @param flash The flash device to erase.
+ * @param start_addr The starting address of the region to erase.  The erase operation will actually
+ * start at the beginning of the flash sector that contains the starting address.
+ * @param length The number of bytes to erase starting from start_addr.  Any additional data that
+ * needs to be erased to align to sector boundaries does not count toward this length.
+ *
+ * @return 0 if the region was successfully erased or an error code.
+ */
+int flash_mixed_erase_region_and_verify (const struct flash *flash, uint32_t start_addr,
+	size_t length)
+{
+	return flash_erase_region_and_verify_ext (flash, start_addr, length, flash_mixed_erase_region);
+}
+
 /**
  * Program a block of data to a flash device after first erasing the region to be programmed.
  *
@@ -1403,3 +1645,130 @@ int flash_copy_ext_to_blank_and_verify (const struct flash *dest_flash, uint32_t
 {
 	return flash_copy_data_region (dest_flash, dest_addr, src_flash, src_addr, length, NULL, 1);
 }
+
+/**
+ * Copy data stored in at a location in flash to another flash location, only updating the flash
+ * sectors in the destination that do not already contain the source data.  Each sector of the
+ * destination region is compared against the source.  Sectors that differ are erased, blank
+ * checked, programmed, and verified.  Sectors that already match are left untouched.
+ *
+ * The source and destination flash devices can be the same or different devices.  If they are the
+ * same, then the source and destination regions must not overlap or be within the same erase
+ * sector.
+ *
+ * Erase blocks are on 4kB boundaries.  If a partial sector at the start or end of the destination
+ * region needs to be updated, any data in that sector outside of the region will be erased.
+ *
+ * @param dest_flash The flash device to write the copy to.
+ * @param dest_addr The flash address where the copy will be stored.
+ * @param src_flash The flash device to read the copy from.
+ * @param src_addr The flash address where the data will be copied from.
+ * @param length The number of bytes to copy.
+ * @param bytes_written Optional output for the number of bytes that were programmed into the
+ * destination.  This is updated even if the copy fails.  Set this to null if it is not needed.
+ *
+ * @return 0 if the destination contains the source data or an error code.
+ */
+int flash_differential_copy_ext_and_verify (const struct flash *dest_flash, uint32_t dest_addr,
+	const struct flash *src_flash, uint32_t src_addr, size_t length, size_t *bytes_written)
+{
+	uint32_t sector;
+	uint32_t page;
+	uint32_t sector_offset;
+	size_t copy_len;
+	int status;
+
+	if (bytes_written) {
+		*bytes_written = 0;
+	}
+
+	if ((dest_flash == NULL) || (src_flash == NULL)) {
+		return FLASH_UTIL_INVALID_ARGUMENT;
+	}
+
+	if (length == 0) {
+		return 0;
+	}
+
+	status = dest_flash->get_sector_size (dest_flash, &sector);
+	if (status != 0) {
+		return status;
+	}
+
+	if (dest_flash == src_flash) {
+		status = flash_check_copy_region (dest_addr, src_addr, length, FLASH_REGION_MASK (sector));
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	status = dest_flash->get_page_size (dest_flash, &page);
+	if (status != 0) {
+		return status;
+	}
+
+	if (page > FLASH_MAX_COPY_BLOCK) {
+		return FLASH_UTIL_UNSUPPORTED_PAGE_SIZE;
+	}
+
+	while (length != 0) {
+		sector_offset = FLASH_REGION_OFFSET (dest_addr, sector);
+		copy_len = sector - sector_offset;
+		copy_len = (length > copy_len) ? copy_len : length;
+
+		status = flash_verify_copy_ext (src_flash, src_addr, dest_flash, dest_addr, copy_len);
+		if (status == FLASH_UTIL_DATA_MISMATCH) {
+			status = dest_flash->sector_erase (dest_flash, dest_addr - sector_offset);
+			if (status != 0) {
+				return status;
+			}
+
+			status = flash_blank_check (dest_flash, dest_addr, copy_len);
+			if (status != 0) {
+				return status;
+			}
+
+			status = flash_copy_data_to_blank_region (dest_flash, dest_addr, src_flash, src_addr,
+				copy_len, page, 1);
+			if (status != 0) {
+				return status;
+			}
+
+			if (bytes_written) {
+				*bytes_written += copy_len;
+			}
+		}
+		else if (status != 0) {
+			return status;
+		}
+
+		length -= copy_len;
+		src_addr += copy_len;
+		dest_addr += copy_len;
+	}
+
+	return 0;
+}
+
+/**
+ * Copy data stored at one location in a flash device to another location in the same flash device,
+ * only updating the flash sectors in the destination that do not already contain the source data.
+ * The source and destination regions must not overlap or be within the same erase sector.
+ *
+ * Erase blocks are on 4kB boundaries.
+ *
+ * @param flash The flash device to use for the copy.
+ * @param dest_addr The flash address where the copy will be stored.
+ * @param src_addr The flash address where the data will be copied from.
+ * @param length The number of bytes to copy.
+ * @param bytes_written Optional output for the number of bytes that were programmed into the
+ * destination.
+ *
+ * @return 0 if the destination contains the source data or an error code.
+ */
+int flash_differential_copy_and_verify (const struct flash *flash, uint32_t dest_addr,
+	uint32_t src_addr, size_t length, size_t *bytes_written)
+{
+	return flash_differential_copy_ext_and_verify (flash, dest_addr, flash, src_addr, length,
+		bytes_written);
+}
@@ -13,17 +13,22 @@
 #include "common/signature_verification.h"
 
 
-/**
- * The maximum block size read from the flash for verification operations.
- */
-#define	FLASH_VERIFICATION_BLOCK	256
-
 /**
  * The maximum block size supported for flash copy operations.
  */
 #define	FLASH_MAX_COPY_BLOCK		512
 
 
+/* Configurable flash utility parameters.  Defaults can be overridden in platform_config.h. */
+#include "platform_config.h"
+#ifndef FLASH_HASH_PIPELINE_BLOCK
+#define	FLASH_HASH_PIPELINE_BLOCK	1024
+#endif
+#ifndef FLASH_VERIFICATION_BLOCK
+#define	FLASH_VERIFICATION_BLOCK	1024
+#endif
+
+
 /**
  * Defines a single region of flash memory.
  */
@@ -75,6 +80,7 @@ int flash_hash_update_noncontiguous_contents_at_offset (const struct flash *flas
 
 int flash_erase_region (const struct flash *flash, uint32_t start_addr, size_t length);
 int flash_sector_erase_region (const struct flash *flash, uint32_t start_addr, size_t length);
+int flash_mixed_erase_region (const struct flash *flash, uint32_t start_addr, size_t length);
 int flash_blank_check (const struct flash *flash, uint32_t start_addr, size_t length);
 int flash_value_check (const struct flash *flash, uint32_t start_addr, size_t length,
 	uint8_t value);
@@ -82,6 +88,8 @@ int flash_value_check (const struct flash *flash, uint32_t start_addr, size_t le
 int flash_erase_region_and_verify (const struct flash *flash, uint32_t start_addr, size_t length);
 int flash_sector_erase_region_and_verify (const struct flash *flash, uint32_t start_addr,
 	size_t length);
+int flash_mixed_erase_region_and_verify (const struct flash *flash, uint32_t start_addr,
+	size_t length);
 
 int flash_program_data (const struct flash *flash, uint32_t start_addr, const uint8_t *data,
 	size_t length);
@@ -129,6 +137,11 @@ int flash_copy_ext_to_blank (const struct flash *dest_flash, uint32_t dest_addr,
 int flash_copy_ext_to_blank_and_verify (const struct flash *dest_flash, uint32_t dest_addr,
 	const struct flash *src_flash, uint32_t src_addr, size_t length);
 
+int flash_differential_copy_and_verify (const struct flash *flash, uint32_t dest_addr,
+	uint32_t src_addr, size_t length, size_t *bytes_written);
+int flash_differential_copy_ext_and_verify (const struct flash *dest_flash, uint32_t dest_addr,
+	const struct flash *src_flash, uint32_t src_addr, size_t length, size_t *bytes_written);
+
 
 #define	FLASH_UTIL_ERROR(code)		ROT_ERROR (ROT_MODULE_FLASH_UTIL, code)
 
@@ -148,6 +161,7 @@ enum {
 	FLASH_UTIL_UNEXPECTED_VALUE = FLASH_UTIL_ERROR (0x09),		/**< The flash does not contain the expected value. */
 	FLASH_UTIL_HASH_BUFFER_TOO_SMALL = FLASH_UTIL_ERROR (0x0a),	/**< The hash out buffer is not large enough. */
 	FLASH_UTIL_UNSUPPORTED_PAGE_SIZE = FLASH_UTIL_ERROR (0x0b),	/**< Flash page size is unsupported. */
+	FLASH_UTIL_ADDRESS_OUT_OF_RANGE = FLASH_UTIL_ERROR (0x0c),	/**< The address range is outside the flash device. */
 };
 
 
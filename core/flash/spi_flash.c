@@ -133,6 +133,8 @@ static void spi_flash_set_device_commands (const struct spi_flash *flash,
 		spi_flash_sfdp_get_reset_command (sfdp, &flash->state->command.reset);
 		spi_flash_sfdp_get_deep_powerdown_commands (sfdp, &flash->state->command.enter_pwrdown,
 			&flash->state->command.release_pwrdown);
+		spi_flash_sfdp_get_suspend_resume_commands (sfdp, &flash->state->command.suspend,
+			&flash->state->command.resume);
 	}
 }
 
@@ -335,6 +337,11 @@ static void spi_flash_finish_device_restore (const struct spi_flash *flash,
 	flash->state->command.reset = info->reset_opcode;
 	flash->state->command.enter_pwrdown = info->enter_pwrdown;
 	flash->state->command.release_pwrdown = info->release_pwrdown;
+
+	if (info->version >= 2) {
+		flash->state->command.suspend = info->suspend_opcode;
+		flash->state->command.resume = info->resume_opcode;
+	}
 }
 
 /**
@@ -446,6 +453,12 @@ static int spi_flash_init_api (struct spi_flash *flash, struct spi_flash_state *
 	flash->base.block_erase = (int (*) (const struct flash*, uint32_t)) spi_flash_block_erase;
 	flash->base.chip_erase = (int (*) (const struct flash*)) spi_flash_chip_erase;
 
+	if (spi->xfer_start && spi->xfer_wait) {
+		flash->base.read_start =
+			(int (*) (const struct flash*, uint32_t, uint8_t*, size_t)) spi_flash_read_start;
+		flash->base.read_wait = (int (*) (const struct flash*)) spi_flash_read_wait;
+	}
+
 	flash->state = state;
 	flash->spi = spi;
 
@@ -629,6 +642,8 @@ int spi_flash_save_device_info (const struct spi_flash *flash, struct spi_flash_
 	info->release_pwrdown = flash->state->command.release_pwrdown;
 	info->switch_4byte = flash->state->switch_4byte;
 	info->quad_enable = flash->state->quad_enable;
+	info->suspend_opcode = flash->state->command.suspend;
+	info->resume_opcode = flash->state->command.resume;
 
 	info->flags = 0;
 	if (flash->state->use_busy_flag) {
@@ -718,6 +733,30 @@ static int spi_flash_is_wip_set (const struct spi_flash *flash)
 	}
 }
 
+/**
+ * Determine if the flash is able to accept a new write or erase command.  The flash must not be
+ * executing a write and must not have a suspended write.
+ *
+ * @param flash The flash instance to check.
+ *
+ * @return 0 if the flash is ready for a write command or an error code.
+ */
+static int spi_flash_check_write_ready (const struct spi_flash *flash)
+{
+	int status;
+
+	if (flash->state->write_suspended) {
+		return SPI_FLASH_WRITE_IN_PROGRESS;
+	}
+
+	status = spi_flash_is_wip_set (flash);
+	if (status != 0) {
+		return (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
+	}
+
+	return 0;
+}
+
 /**
  * Wait for a write operation to complete.
  *
@@ -786,9 +825,9 @@ static int spi_flash_write_register (const struct spi_flash *flash, uint8_t cmd,
 	struct flash_xfer xfer;
 	int status;
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_write_ready (flash);
 	if (status != 0) {
-		return (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
+		return status;
 	}
 
 	if (volatile_wren) {
@@ -1113,9 +1152,9 @@ int spi_flash_reset_device (const struct spi_flash *flash)
 
 	platform_mutex_lock (&flash->state->lock);
 
-	status = spi_flash_is_wip_set (flash);
+	/* A reset would abort a suspended write, so treat it the same as an active write. */
+	status = spi_flash_check_write_ready (flash);
 	if (status != 0) {
-		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 		goto exit;
 	}
 
@@ -1248,6 +1287,11 @@ int spi_flash_deep_power_down (const struct spi_flash *flash, uint8_t enable)
 
 	platform_mutex_lock (&flash->state->lock);
 
+	if (flash->state->write_suspended) {
+		status = SPI_FLASH_WRITE_IN_PROGRESS;
+		goto exit;
+	}
+
 	if (enable) {
 		status = spi_flash_simple_command (flash, flash->state->command.enter_pwrdown);
 	}
@@ -1259,6 +1303,7 @@ int spi_flash_deep_power_down (const struct spi_flash *flash, uint8_t enable)
 		platform_msleep (100);
 	}
 
+exit:
 	platform_mutex_unlock (&flash->state->lock);
 	return status;
 }
@@ -1411,6 +1456,11 @@ int spi_flash_enable_4byte_address_mode (const struct spi_flash *flash, uint8_t
 
 	platform_mutex_lock (&flash->state->lock);
 
+	if (flash->state->write_suspended) {
+		status = SPI_FLASH_WRITE_IN_PROGRESS;
+		goto exit;
+	}
+
 	status = spi_flash_supports_address_mode (flash, enable);
 	if (status != 0) {
 		if (status == SPI_FLASH_ADDR_MODE_FIXED) {
@@ -1873,6 +1923,88 @@ exit:
 	return status;
 }
 
+/**
+ * Start reading data from the SPI flash in the background.  The read is executed by the SPI master
+ * asynchronously (e.g. using DMA) and must be completed by calling {@link spi_flash_read_wait}.
+ *
+ * The flash remains locked until the read completes, so no other flash operations can be executed
+ * from the calling context before waiting for the read.
+ *
+ * @param flash The flash to read from.
+ * @param address The address to start reading from.
+ * @param data The buffer to hold the data that will be read.  This must not be accessed until the
+ * read has completed.
+ * @param length The number of bytes to read.
+ *
+ * @return 0 if the read was started successfully or an error code.
+ */
+int spi_flash_read_start (const struct spi_flash *flash, uint32_t address, uint8_t *data,
+	size_t length)
+{
+	struct flash_xfer xfer;
+	int status;
+
+	if ((flash == NULL) || (data == NULL)) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	if ((flash->spi->xfer_start == NULL) || (flash->spi->xfer_wait == NULL)) {
+		return SPI_FLASH_ASYNC_READ_NOT_SUPPORTED;
+	}
+
+	SPI_FLASH_BOUNDS_CHECK (flash->state->device_size, address, length)
+
+	platform_mutex_lock (&flash->state->lock);
+
+	status = spi_flash_is_wip_set (flash);
+	if (status != 0) {
+		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
+		goto exit;
+	}
+
+	FLASH_XFER_INIT_READ (xfer, flash->state->command.read, address,
+		flash->state->command.read_dummy, flash->state->command.read_mode, data, length,
+		flash->state->command.read_flags | flash->state->addr_mode);
+	status = flash->spi->xfer_start (flash->spi, &xfer);
+	if (status == 0) {
+		/* Keep the flash locked until the read has completed. */
+		flash->state->async_read = true;
+		return 0;
+	}
+
+exit:
+	platform_mutex_unlock (&flash->state->lock);
+	return status;
+}
+
+/**
+ * Wait for a read started with {@link spi_flash_read_start} to complete.  This must be called from
+ * the same context that started the read.
+ *
+ * @param flash The flash being read.
+ *
+ * @return 0 if the read completed successfully or an error code.
+ */
+int spi_flash_read_wait (const struct spi_flash *flash)
+{
+	int status;
+
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	if (!flash->state->async_read) {
+		return SPI_FLASH_NO_ASYNC_READ;
+	}
+
+	status = flash->spi->xfer_wait (flash->spi);
+
+	flash->state->async_read = false;
+	platform_mutex_unlock (&flash->state->lock);
+
+	return status;
+}
+
 /**
  * Get the size of a flash page for write operations.
  *
@@ -1951,9 +2083,8 @@ int spi_flash_write (const struct spi_flash *flash, uint32_t address, const uint
 
 	platform_mutex_lock (&flash->state->lock);
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_write_ready (flash);
 	if (status != 0) {
-		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 		goto exit;
 	}
 
@@ -2024,11 +2155,13 @@ int spi_flash_write_read_only (const struct flash *flash, uint32_t address, cons
  * @param address An address within the region to erase.
  * @param erase_cmd The erase command to use.
  * @param erase_flags Transfer flags for the command.
+ * @param wait Flag indicating if the call should block until the erase has completed.  If this is
+ * false, the erase will be left running on the device as an asynchronous operation.
  *
  * @return 0 if the region was erased or an error code.
  */
 static int spi_flash_erase_region (const struct spi_flash *flash, uint32_t address,
-	uint8_t erase_cmd, uint16_t erase_flags)
+	uint8_t erase_cmd, uint16_t erase_flags, bool wait)
 {
 	struct flash_xfer xfer;
 	int status;
@@ -2039,9 +2172,8 @@ static int spi_flash_erase_region (const struct spi_flash *flash, uint32_t addre
 
 	platform_mutex_lock (&flash->state->lock);
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_write_ready (flash);
 	if (status != 0) {
-		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 		goto exit;
 	}
 
@@ -2057,7 +2189,12 @@ static int spi_flash_erase_region (const struct spi_flash *flash, uint32_t addre
 		goto exit;
 	}
 
-	status = spi_flash_wait_for_write_completion (flash, -1, 0);
+	if (wait) {
+		status = spi_flash_wait_for_write_completion (flash, -1, 0);
+	}
+	else {
+		flash->state->async_write = true;
+	}
 
 exit:
 	platform_mutex_unlock (&flash->state->lock);
@@ -2099,7 +2236,7 @@ int spi_flash_sector_erase (const struct spi_flash *flash, uint32_t sector_addr)
 	}
 
 	return spi_flash_erase_region (flash, FLASH_SECTOR_BASE (sector_addr),
-		flash->state->command.erase_sector, flash->state->command.sector_flags);
+		flash->state->command.erase_sector, flash->state->command.sector_flags, true);
 }
 
 /* API handler for sector_erase and block_erase when statically initialized for read only access. */
@@ -2146,17 +2283,19 @@ int spi_flash_block_erase (const struct spi_flash *flash, uint32_t block_addr)
 	}
 
 	return spi_flash_erase_region (flash, FLASH_BLOCK_BASE (block_addr),
-		flash->state->command.erase_block, flash->state->command.block_flags);
+		flash->state->command.erase_block, flash->state->command.block_flags, true);
 }
 
 /**
  * Erase the entire flash chip.
  *
  * @param flash The flash to erase.
+ * @param wait Flag indicating if the call should block until the erase has completed.  If this is
+ * false, the erase will be left running on the device as an asynchronous operation.
  *
  * @return 0 if the flash chip was erased or an error code.
  */
-int spi_flash_chip_erase (const struct spi_flash *flash)
+static int spi_flash_erase_chip (const struct spi_flash *flash, bool wait)
 {
 	int status;
 
@@ -2166,9 +2305,8 @@ int spi_flash_chip_erase (const struct spi_flash *flash)
 
 	platform_mutex_lock (&flash->state->lock);
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_write_ready (flash);
 	if (status != 0) {
-		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 		goto exit;
 	}
 
@@ -2182,13 +2320,30 @@ int spi_flash_chip_erase (const struct spi_flash *flash)
 		goto exit;
 	}
 
-	status = spi_flash_wait_for_write_completion (flash, -1, 0);
+	if (wait) {
+		status = spi_flash_wait_for_write_completion (flash, -1, 0);
+	}
+	else {
+		flash->state->async_write = true;
+	}
 
 exit:
 	platform_mutex_unlock (&flash->state->lock);
 	return status;
 }
 
+/**
+ * Erase the entire flash chip.
+ *
+ * @param flash The flash to erase.
+ *
+ * @return 0 if the flash chip was erased or an error code.
+ */
+int spi_flash_chip_erase (const struct spi_flash *flash)
+{
+	return spi_flash_erase_chip (flash, true);
+}
+
 /* API handler for chip_erase when statically initialized for read only access. */
 int spi_flash_chip_erase_read_only (const struct flash *flash)
 {
@@ -2220,7 +2375,8 @@ int spi_flash_is_write_in_progress (const struct spi_flash *flash)
 }
 
 /**
- * Wait for a write operation to complete.
+ * Wait for a write operation to complete.  If the write was started asynchronously, the completion
+ * handler will be notified.  It is not possible to wait for a suspended operation.
  *
  * @param flash The flash instance that is executing a write operation.
  * @param timeout The maximum number of milliseconds to wait for completion.  A negative number will
@@ -2230,6 +2386,8 @@ int spi_flash_is_write_in_progress (const struct spi_flash *flash)
  */
 int spi_flash_wait_for_write (const struct spi_flash *flash, int32_t timeout)
 {
+	void (*handler) (void*, int) = NULL;
+	void *context = NULL;
 	int status;
 
 	if (flash == NULL) {
@@ -2237,8 +2395,290 @@ int spi_flash_wait_for_write (const struct spi_flash *flash, int32_t timeout)
 	}
 
 	platform_mutex_lock (&flash->state->lock);
+
+	if (flash->state->write_suspended) {
+		status = SPI_FLASH_WRITE_IN_PROGRESS;
+		goto exit;
+	}
+
 	status = spi_flash_wait_for_write_completion (flash, timeout, 0);
+	if ((status == 0) && flash->state->async_write) {
+		flash->state->async_write = false;
+		handler = flash->state->write_complete;
+		context = flash->state->write_complete_context;
+	}
+
+exit:
 	platform_mutex_unlock (&flash->state->lock);
 
+	if (handler) {
+		handler (context, 0);
+	}
+
+	return status;
+}
+
+/**
+ * Start programming data into a single page of flash.  The write command will be sent to the
+ * device, but the call will not wait for the write to complete.  Completion can be determined with
+ * {@link spi_flash_poll_write_complete} or {@link spi_flash_wait_for_write}.
+ *
+ * Only one page can be programmed by a single call.  If the data would cross a page boundary, only
+ * the data up to the end of the page will be written.
+ *
+ * @param flash The flash to write to.
+ * @param address The address to start writing to.
+ * @param data The data to write.  This buffer only needs to remain valid until the call returns.
+ * @param length The number of bytes to write.
+ *
+ * @return The number of bytes being written to the flash or an error code.  Use ROT_IS_ERROR to
+ * check the return value.
+ */
+int spi_flash_write_page_start (const struct spi_flash *flash, uint32_t address,
+	const uint8_t *data, size_t length)
+{
+	struct flash_xfer xfer;
+	size_t write_len;
+	int status;
+
+	if ((flash == NULL) || (data == NULL) || (length == 0)) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	SPI_FLASH_BOUNDS_CHECK (flash->state->device_size, address, length);
+
+	write_len = (FLASH_PAGE_BASE (address) + FLASH_PAGE_SIZE) - address;
+	if (length < write_len) {
+		write_len = length;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+
+	status = spi_flash_check_write_ready (flash);
+	if (status != 0) {
+		goto exit;
+	}
+
+	status = spi_flash_write_enable (flash);
+	if (status != 0) {
+		goto exit;
+	}
+
+	FLASH_XFER_INIT_WRITE (xfer, flash->state->command.write, address, 0, (uint8_t*) data,
+		write_len, flash->state->command.write_flags | flash->state->addr_mode);
+
+	status = flash->spi->xfer (flash->spi, &xfer);
+	if (status == 0) {
+		flash->state->async_write = true;
+		status = write_len;
+	}
+
+exit:
+	platform_mutex_unlock (&flash->state->lock);
+	return status;
+}
+
+/**
+ * Start erasing a 4kB sector of flash.  The erase command will be sent to the device, but the call
+ * will not wait for the erase to complete.  Completion can be determined with
+ * {@link spi_flash_poll_write_complete} or {@link spi_flash_wait_for_write}.
+ *
+ * @param flash The flash to erase.
+ * @param sector_addr An address within the sector to erase.
+ *
+ * @return 0 if the sector erase was started or an error code.
+ */
+int spi_flash_sector_erase_start (const struct spi_flash *flash, uint32_t sector_addr)
+{
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	return spi_flash_erase_region (flash, FLASH_SECTOR_BASE (sector_addr),
+		flash->state->command.erase_sector, flash->state->command.sector_flags, false);
+}
+
+/**
+ * Start erasing a 64kB block of flash.  The erase command will be sent to the device, but the call
+ * will not wait for the erase to complete.  Completion can be determined with
+ * {@link spi_flash_poll_write_complete} or {@link spi_flash_wait_for_write}.
+ *
+ * @param flash The flash to erase.
+ * @param block_addr An address within the block to erase.
+ *
+ * @return 0 if the block erase was started or an error code.
+ */
+int spi_flash_block_erase_start (const struct spi_flash *flash, uint32_t block_addr)
+{
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	return spi_flash_erase_region (flash, FLASH_BLOCK_BASE (block_addr),
+		flash->state->command.erase_block, flash->state->command.block_flags, false);
+}
+
+/**
+ * Start erasing the entire flash chip.  The erase command will be sent to the device, but the call
+ * will not wait for the erase to complete.  Completion can be determined with
+ * {@link spi_flash_poll_write_complete} or {@link spi_flash_wait_for_write}.
+ *
+ * @param flash The flash to erase.
+ *
+ * @return 0 if the chip erase was started or an error code.
+ */
+int spi_flash_chip_erase_start (const struct spi_flash *flash)
+{
+	return spi_flash_erase_chip (flash, false);
+}
+
+/**
+ * Set the handler that will be notified when an asynchronous write or erase operation completes.
+ * The handler is called from the context that detects completion, either
+ * {@link spi_flash_poll_write_complete} or {@link spi_flash_wait_for_write}, without holding the
+ * flash lock.  The handler could, for example, post a semaphore to wake a waiting task.
+ *
+ * @param flash The flash instance to configure.
+ * @param handler The completion handler.  Set this to null to disable notifications.
+ * @param context Context that will be passed to the handler.
+ *
+ * @return 0 if the handler was set successfully or an error code.
+ */
+int spi_flash_set_write_complete_handler (const struct spi_flash *flash,
+	void (*handler) (void *context, int result), void *context)
+{
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+	flash->state->write_complete = handler;
+	flash->state->write_complete_context = context;
+	platform_mutex_unlock (&flash->state->lock);
+
+	return 0;
+}
+
+/**
+ * Check the status of an asynchronous write or erase operation without blocking.  If the operation
+ * has completed, the completion handler will be notified.
+ *
+ * A suspended operation is reported as still in progress.
+ *
+ * @param flash The flash instance to check.
+ *
+ * @return 0 if no write is in progress, 1 if there is, or an error code.
+ */
+int spi_flash_poll_write_complete (const struct spi_flash *flash)
+{
+	void (*handler) (void*, int) = NULL;
+	void *context = NULL;
+	int status;
+
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+
+	if (flash->state->write_suspended) {
+		status = 1;
+	}
+	else {
+		status = spi_flash_is_wip_set (flash);
+		if ((status == 0) && flash->state->async_write) {
+			flash->state->async_write = false;
+			handler = flash->state->write_complete;
+			context = flash->state->write_complete_context;
+		}
+	}
+
+	platform_mutex_unlock (&flash->state->lock);
+
+	if (handler) {
+		handler (context, 0);
+	}
+
+	return status;
+}
+
+/**
+ * Suspend the erase or program operation currently executing on the flash.  While the operation is
+ * suspended, the flash can be read, but no new write or erase commands can be issued.  The
+ * suspended operation must be continued with {@link spi_flash_resume_write}.
+ *
+ * Data must not be read from the region being erased or programmed while the operation is
+ * suspended.
+ *
+ * @param flash The flash instance to suspend.
+ *
+ * @return 0 if there is no operation in progress or it was suspended successfully or an error code.
+ */
+int spi_flash_suspend_write (const struct spi_flash *flash)
+{
+	int status;
+
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	if (!flash->state->command.suspend) {
+		return SPI_FLASH_SUSPEND_NOT_SUPPORTED;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+
+	if (flash->state->write_suspended) {
+		status = 0;
+		goto exit;
+	}
+
+	status = spi_flash_is_wip_set (flash);
+	if (status != 1) {
+		goto exit;
+	}
+
+	status = spi_flash_simple_command (flash, flash->state->command.suspend);
+	if (status != 0) {
+		goto exit;
+	}
+
+	status = spi_flash_wait_for_write_completion (flash, -1, 1);
+	if (status == 0) {
+		flash->state->write_suspended = true;
+	}
+
+exit:
+	platform_mutex_unlock (&flash->state->lock);
+	return status;
+}
+
+/**
+ * Resume an erase or program operation that was suspended with {@link spi_flash_suspend_write}.
+ * Flash devices require some amount of time to make progress on the resumed operation, so suspend
+ * should not be called again immediately.
+ *
+ * @param flash The flash instance to resume.
+ *
+ * @return 0 if there was no suspended operation or it was resumed successfully or an error code.
+ */
+int spi_flash_resume_write (const struct spi_flash *flash)
+{
+	int status = 0;
+
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+
+	if (flash->state->write_suspended) {
+		status = spi_flash_simple_command (flash, flash->state->command.resume);
+		if (status == 0) {
+			flash->state->write_suspended = false;
+		}
+	}
+
+	platform_mutex_unlock (&flash->state->lock);
 	return status;
 }
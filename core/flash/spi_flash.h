@@ -31,6 +31,8 @@ struct spi_flash_commands {
 	uint8_t reset;						/**< The command to soft reset the device. */
 	uint8_t enter_pwrdown;				/**< The command to enter deep power down. */
 	uint8_t release_pwrdown;			/**< The command to release deep power down. */
+	uint8_t suspend;					/**< The command to suspend an erase or program operation. */
+	uint8_t resume;						/**< The command to resume a suspended operation. */
 };
 
 /**
@@ -49,6 +51,11 @@ struct spi_flash_state {
 	bool reset_3byte;									/**< Flag to switch to 3-byte mode on reset. */
 	enum spi_flash_sfdp_quad_enable quad_enable;		/**< Method to enable QSPI. */
 	bool sr1_volatile;									/**< Flag to use volatile write enable for status register 1. */
+	bool async_write;									/**< Flag indicating an asynchronous write or erase was started. */
+	bool write_suspended;								/**< Flag indicating the current write or erase is suspended. */
+	void (*write_complete) (void *context, int result);	/**< Handler for asynchronous write completion. */
+	void *write_complete_context;						/**< Context for the completion handler. */
+	bool async_read;									/**< Flag indicating an asynchronous read was started. */
 };
 
 /**
@@ -63,7 +70,7 @@ struct spi_flash {
 /**
  * Version number of the device info context.
  */
-#define	SPI_FLASH_DEVICE_INFO_VERSION	1
+#define	SPI_FLASH_DEVICE_INFO_VERSION	2
 
 #pragma pack(push,1)
 /**
@@ -85,6 +92,8 @@ struct spi_flash_device_info {
 	uint8_t switch_4byte;				/**< Method for switching to 4-byte addressing. */
 	uint8_t quad_enable;				/**< Method to enable QSPI. */
 	uint8_t flags;						/**< Misc behavior flags. */
+	uint8_t suspend_opcode;				/**< Opcode for suspending an erase or program operation. */
+	uint8_t resume_opcode;				/**< Opcode for resuming a suspended operation. */
 };
 #pragma pack(pop)
 
@@ -143,6 +152,9 @@ int spi_flash_is_quad_spi_enabled (const struct spi_flash *flash);
 int spi_flash_configure_drive_strength (const struct spi_flash *flash);
 
 int spi_flash_read (const struct spi_flash *flash, uint32_t address, uint8_t *data, size_t length);
+int spi_flash_read_start (const struct spi_flash *flash, uint32_t address, uint8_t *data,
+	size_t length);
+int spi_flash_read_wait (const struct spi_flash *flash);
 
 int spi_flash_get_page_size (const struct spi_flash *flash, uint32_t *bytes);
 int spi_flash_minimum_write_per_page (const struct spi_flash *flash, uint32_t *bytes);
@@ -160,6 +172,19 @@ int spi_flash_chip_erase (const struct spi_flash *flash);
 int spi_flash_is_write_in_progress (const struct spi_flash *flash);
 int spi_flash_wait_for_write (const struct spi_flash *flash, int32_t timeout);
 
+int spi_flash_write_page_start (const struct spi_flash *flash, uint32_t address,
+	const uint8_t *data, size_t length);
+int spi_flash_sector_erase_start (const struct spi_flash *flash, uint32_t sector_addr);
+int spi_flash_block_erase_start (const struct spi_flash *flash, uint32_t block_addr);
+int spi_flash_chip_erase_start (const struct spi_flash *flash);
+
+int spi_flash_set_write_complete_handler (const struct spi_flash *flash,
+	void (*handler) (void *context, int result), void *context);
+int spi_flash_poll_write_complete (const struct spi_flash *flash);
+
+int spi_flash_suspend_write (const struct spi_flash *flash);
+int spi_flash_resume_write (const struct spi_flash *flash);
+
 
 #define	SPI_FLASH_ERROR(code)		ROT_ERROR (ROT_MODULE_SPI_FLASH, code)
 
@@ -183,6 +208,9 @@ enum {
 	SPI_FLASH_RESET_NOT_SUPPORTED = SPI_FLASH_ERROR (0x0d),		/**< Soft reset is not supported by the device. */
 	SPI_FLASH_PWRDOWN_NOT_SUPPORTED = SPI_FLASH_ERROR (0x0e),	/**< Deep power down is not supported by the device. */
 	SPI_FLASH_READ_ONLY_INTERFACE = SPI_FLASH_ERROR (0x0f),		/**< The interface is only configured to allow read access. */
+	SPI_FLASH_SUSPEND_NOT_SUPPORTED = SPI_FLASH_ERROR (0x10),	/**< Erase/program suspend is not supported by the device. */
+	SPI_FLASH_ASYNC_READ_NOT_SUPPORTED = SPI_FLASH_ERROR (0x11),	/**< The SPI master does not support asynchronous reads. */
+	SPI_FLASH_NO_ASYNC_READ = SPI_FLASH_ERROR (0x12),			/**< There is no asynchronous read in progress. */
 };
 
 
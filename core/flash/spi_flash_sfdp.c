@@ -91,6 +91,7 @@ struct spi_flash_sfdp_basic_parameter_table_1_5 {
 	uint16_t program_time;			/**< 11th DWORD: Page programming typical timing. */
 	uint8_t chip_erase_time;		/**< 11th DWORD: Chip erase typical timing. */
 	uint32_t suspend_attr;			/**< 12th DWORD: Suspend/Resume attributes. */
+#define	SPI_FLASH_SFDP_SUSPEND_NO_SUPPORT	(1U << 31)
 	uint8_t program_resume;			/**< 13th DWORD: Program Resume instruction. */
 	uint8_t program_suspend;		/**< 13th DWORD: Program Suspend instruction. */
 	uint8_t resume;					/**< 13th DWORD: Resume instruction. */
@@ -797,6 +798,49 @@ int spi_flash_sfdp_get_deep_powerdown_commands (const struct spi_flash_sfdp_basi
 	return status;
 }
 
+/**
+ * Get the commands used to suspend and resume erase and program operations on the device.
+ *
+ * @param table The basic parameters table that will be queried.
+ * @param suspend Output for the suspend command.  This will be set to 0 if suspend is not supported
+ * by the device.
+ * @param resume Output for the resume command.  This will be set to 0 if suspend is not supported
+ * by the device.
+ *
+ * @return 0 if the suspend and resume commands were retrieved successfully or an error code.
+ */
+int spi_flash_sfdp_get_suspend_resume_commands (const struct spi_flash_sfdp_basic_table *table,
+	uint8_t *suspend, uint8_t *resume)
+{
+	struct spi_flash_sfdp_basic_parameter_table_1_5 *params;
+	uint8_t cmd_suspend = 0;
+	uint8_t cmd_resume = 0;
+	int status = 0;
+
+	if ((table == NULL) || (suspend == NULL) || (resume == NULL)) {
+		return SPI_FLASH_SFDP_INVALID_ARGUMENT;
+	}
+
+	if (table->sfdp->sfdp_header.parameter0.minor_revision >= 5) {
+		params = (struct spi_flash_sfdp_basic_parameter_table_1_5*) table->data;
+
+		if (!(params->suspend_attr & SPI_FLASH_SFDP_SUSPEND_NO_SUPPORT)) {
+			cmd_suspend = params->suspend;
+			cmd_resume = params->resume;
+		}
+		else {
+			status = SPI_FLASH_SFDP_SUSPEND_NOT_SUPPORTED;
+		}
+	}
+	else {
+		status = SPI_FLASH_SFDP_SUSPEND_NOT_SUPPORTED;
+	}
+
+	*suspend = cmd_suspend;
+	*resume = cmd_resume;
+	return status;
+}
+
 /**
  * Print the contents of the basic parameters table.
  *
@@ -138,6 +138,8 @@ int spi_flash_sfdp_get_reset_command (const struct spi_flash_sfdp_basic_table *t
 	uint8_t *reset);
 int spi_flash_sfdp_get_deep_powerdown_commands (const struct spi_flash_sfdp_basic_table *table,
 	uint8_t *enter, uint8_t *exit);
+int spi_flash_sfdp_get_suspend_resume_commands (const struct spi_flash_sfdp_basic_table *table,
+	uint8_t *suspend, uint8_t *resume);
 
 void spi_flash_sfdp_dump_basic_table (const struct spi_flash_sfdp_basic_table *table);
 
@@ -157,6 +159,7 @@ enum {
 	SPI_FLASH_SFDP_QUAD_ENABLE_UNKNOWN = SPI_FLASH_SFDP_ERROR (0x06),	/**< QSPI enabled method cannot be determined. */
 	SPI_FLASH_SFDP_RESET_NOT_SUPPORTED = SPI_FLASH_SFDP_ERROR (0x07),	/**< Soft reset is not supported by the device. */
 	SPI_FLASH_SFDP_PWRDOWN_NOT_SUPPORTED = SPI_FLASH_SFDP_ERROR (0x08),	/**< Deep power down is not supported by the device. */
+	SPI_FLASH_SFDP_SUSPEND_NOT_SUPPORTED = SPI_FLASH_SFDP_ERROR (0x09),	/**< Erase/program suspend is not supported by the device. */
 };
 
 
@@ -167,23 +167,28 @@ int host_flash_manager_validate_flash (struct pfm *pfm, struct hash_engine *hash
 }
 
 /**
- * Validate the image on a flash device.
+ * Validate the image on a flash device.  Firmware components may be verified concurrently.
  *
  * @param pfm The PFM to use for validation.
  * @param hash The hash to use for image validation.
  * @param rsa The RSA engine to use for signature verification.
- * @param full_validation Flag to control level of flash validation.
+ * @param full_validation Flag to control level of flash validation.  Full validation is always
+ * run sequentially.
  * @param flash The flash device to validate.
  * @param offset An offset in flash for images that will be validated.  Ignored if full_validation
  * is set.
  * @param host_rw Output for the read/write regions of the validated flash.  This will only be
  * valid if the flash is successfully validated.  This can be null if full_validation is false.
+ * @param workers Workers that can be used to verify firmware components concurrently.  This can be
+ * null to verify components sequentially.
+ * @param worker_count The number of available workers.
  *
  * @return 0 if the validation was successful or an error code.
  */
-int host_flash_manager_validate_offset_flash (struct pfm *pfm, struct hash_engine *hash,
-	struct rsa_engine *rsa, bool full_validation, struct spi_flash *flash, uint32_t offset,
-	struct host_flash_manager_rw_regions *host_rw)
+static int host_flash_manager_validate_offset_flash_with_workers (struct pfm *pfm,
+	struct hash_engine *hash, struct rsa_engine *rsa, bool full_validation,
+	struct spi_flash *flash, uint32_t offset, struct host_flash_manager_rw_regions *host_rw,
+	struct host_fw_verify_worker **workers, size_t worker_count)
 {
 	struct pfm_firmware host_fw;
 	struct pfm_firmware_versions versions;
@@ -217,8 +222,8 @@ int host_flash_manager_validate_offset_flash (struct pfm *pfm, struct hash_engin
 			host_rw->writable, host_fw.count, version->blank_byte, hash, rsa);
 	}
 	else {
-		status = host_fw_verify_offset_images_multiple_fw (flash, host_img.fw_images,
-			host_img.count, offset, hash, rsa);
+		status = host_fw_verify_offset_images_multiple_fw_parallel (flash, host_img.fw_images,
+			host_img.count, offset, hash, rsa, workers, worker_count);
 	}
 
 free_host:
@@ -231,6 +236,56 @@ free_host:
 	return status;
 }
 
+/**
+ * Validate the image on a flash device.
+ *
+ * @param pfm The PFM to use for validation.
+ * @param hash The hash to use for image validation.
+ * @param rsa The RSA engine to use for signature verification.
+ * @param full_validation Flag to control level of flash validation.
+ * @param flash The flash device to validate.
+ * @param offset An offset in flash for images that will be validated.  Ignored if full_validation
+ * is set.
+ * @param host_rw Output for the read/write regions of the validated flash.  This will only be
+ * valid if the flash is successfully validated.  This can be null if full_validation is false.
+ *
+ * @return 0 if the validation was successful or an error code.
+ */
+int host_flash_manager_validate_offset_flash (struct pfm *pfm, struct hash_engine *hash,
+	struct rsa_engine *rsa, bool full_validation, struct spi_flash *flash, uint32_t offset,
+	struct host_flash_manager_rw_regions *host_rw)
+{
+	return host_flash_manager_validate_offset_flash_with_workers (pfm, hash, rsa, full_validation,
+		flash, offset, host_rw, NULL, 0);
+}
+
+/**
+ * Validate the image on a flash device, using additional workers to verify firmware components
+ * concurrently.
+ *
+ * @param pfm The PFM to use for validation.
+ * @param hash The hash to use for image validation.
+ * @param rsa The RSA engine to use for signature verification.
+ * @param full_validation Flag to control level of flash validation.  Full validation is always
+ * run sequentially.
+ * @param flash The flash device to validate.
+ * @param host_rw Output for the read/write regions of the validated flash.  This will only be
+ * valid if the flash is successfully validated.  This can be null if full_validation is false.
+ * @param workers Workers that can be used to verify firmware components concurrently.  This can be
+ * null to verify components sequentially.
+ * @param worker_count The number of available workers.
+ *
+ * @return 0 if the validation was successful or an error code.
+ */
+int host_flash_manager_validate_flash_parallel (struct pfm *pfm, struct hash_engine *hash,
+	struct rsa_engine *rsa, bool full_validation, struct spi_flash *flash,
+	struct host_flash_manager_rw_regions *host_rw, struct host_fw_verify_worker **workers,
+	size_t worker_count)
+{
+	return host_flash_manager_validate_offset_flash_with_workers (pfm, hash, rsa, full_validation,
+		flash, 0, host_rw, workers, worker_count);
+}
+
 /**
  * Validate a PFM against the image on flash using a different PFM that is known to validate that
  * image.
@@ -248,6 +303,32 @@ free_host:
 int host_flash_manager_validate_pfm (struct pfm *pfm, struct pfm *good_pfm,
 	struct hash_engine *hash, struct rsa_engine *rsa, struct spi_flash *flash,
 	struct host_flash_manager_rw_regions *host_rw)
+{
+	return host_flash_manager_validate_pfm_parallel (pfm, good_pfm, hash, rsa, flash, host_rw, NULL,
+		0);
+}
+
+/**
+ * Validate a PFM against the image on flash using a different PFM that is known to validate that
+ * image.  If the image needs to be verified, firmware components may be verified concurrently.
+ *
+ * @param pfm The PFM to use for validation.
+ * @param good_pfm The PFM that is known to be good for the flash image.
+ * @param hash The hash to use for image validation.
+ * @param rsa The RSA engine to use for signature verification.
+ * @param flash The flash device to validate.
+ * @param host_rw Output for the read/write regions of the validated flash.  This will only be
+ * valid if the flash is successfully validated.  This can be null.
+ * @param workers Workers that can be used to verify firmware components concurrently.  This can be
+ * null to verify components sequentially.
+ * @param worker_count The number of available workers.
+ *
+ * @return 0 if the validation was successful or an error code.
+ */
+int host_flash_manager_validate_pfm_parallel (struct pfm *pfm, struct pfm *good_pfm,
+	struct hash_engine *hash, struct rsa_engine *rsa, struct spi_flash *flash,
+	struct host_flash_manager_rw_regions *host_rw, struct host_fw_verify_worker **workers,
+	size_t worker_count)
 {
 	struct pfm_firmware host_fw;
 	struct pfm_firmware_versions versions;
@@ -290,8 +371,8 @@ int host_flash_manager_validate_pfm (struct pfm *pfm, struct pfm *good_pfm,
 	}
 
 	if (match_status != 0) {
-		status = host_fw_verify_images_multiple_fw (flash, host_img.fw_images, host_img.count, hash,
-			rsa);
+		status = host_fw_verify_offset_images_multiple_fw_parallel (flash, host_img.fw_images,
+			host_img.count, 0, hash, rsa, workers, worker_count);
 	}
 
 free_host:
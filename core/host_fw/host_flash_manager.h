@@ -8,6 +8,7 @@
 #include "status/rot_status.h"
 #include "host_control.h"
 #include "host_flash_initialization.h"
+#include "host_fw_verify_worker.h"
 #include "flash/spi_flash.h"
 #include "spi_filter/spi_filter_interface.h"
 #include "spi_filter/flash_mfg_filter_handler.h"
@@ -242,6 +243,15 @@ int host_flash_manager_validate_pfm (struct pfm *pfm, struct pfm *good_pfm,
 	struct hash_engine *hash, struct rsa_engine *rsa, struct spi_flash *flash,
 	struct host_flash_manager_rw_regions *host_rw);
 
+int host_flash_manager_validate_flash_parallel (struct pfm *pfm, struct hash_engine *hash,
+	struct rsa_engine *rsa, bool full_validation, struct spi_flash *flash,
+	struct host_flash_manager_rw_regions *host_rw, struct host_fw_verify_worker **workers,
+	size_t worker_count);
+int host_flash_manager_validate_pfm_parallel (struct pfm *pfm, struct pfm *good_pfm,
+	struct hash_engine *hash, struct rsa_engine *rsa, struct spi_flash *flash,
+	struct host_flash_manager_rw_regions *host_rw, struct host_fw_verify_worker **workers,
+	size_t worker_count);
+
 int host_flash_manager_get_flash_read_write_regions (struct spi_flash *flash, struct pfm *pfm,
 	struct host_flash_manager_rw_regions *host_rw);
 
@@ -46,20 +46,23 @@ static int host_flash_manager_dual_validate_read_only_flash (struct host_flash_m
 	struct pfm *pfm, struct pfm *good_pfm, struct hash_engine *hash, struct rsa_engine *rsa,
 	bool full_validation, struct host_flash_manager_rw_regions *host_rw)
 {
+	struct host_flash_manager_dual *dual = (struct host_flash_manager_dual*) manager;
 	int status;
 
-	if ((manager == NULL) || (pfm == NULL) || (hash == NULL) || (rsa == NULL) ||
+	if ((dual == NULL) || (pfm == NULL) || (hash == NULL) || (rsa == NULL) ||
 		(host_rw == NULL)) {
 		return HOST_FLASH_MGR_INVALID_ARGUMENT;
 	}
 
 	if (good_pfm && !full_validation) {
-		status = host_flash_manager_validate_pfm (pfm, good_pfm, hash, rsa,
-			host_flash_manager_dual_get_read_only_flash (manager), host_rw);
+		status = host_flash_manager_validate_pfm_parallel (pfm, good_pfm, hash, rsa,
+			host_flash_manager_dual_get_read_only_flash (manager), host_rw, dual->workers,
+			dual->worker_count);
 	}
 	else {
-		status = host_flash_manager_validate_flash (pfm, hash, rsa, full_validation,
-			host_flash_manager_dual_get_read_only_flash (manager), host_rw);
+		status = host_flash_manager_validate_flash_parallel (pfm, hash, rsa, full_validation,
+			host_flash_manager_dual_get_read_only_flash (manager), host_rw, dual->workers,
+			dual->worker_count);
 	}
 
 	return status;
@@ -394,6 +397,30 @@ int host_flash_manager_dual_init_with_managed_flash_initialization (
 	return 0;
 }
 
+/**
+ * Provide additional workers that can be used to verify independent firmware components in
+ * parallel when validating the read-only flash.  Full flash validation is not affected.
+ *
+ * @param manager The flash manager to update.
+ * @param workers The list of workers to use for verification.  Set this to null to verify all
+ * components sequentially.
+ * @param count The number of workers in the list.
+ *
+ * @return 0 if the workers were set successfully or an error code.
+ */
+int host_flash_manager_dual_set_verification_workers (struct host_flash_manager_dual *manager,
+	struct host_fw_verify_worker **workers, size_t count)
+{
+	if ((manager == NULL) || ((workers == NULL) && (count != 0))) {
+		return HOST_FLASH_MGR_INVALID_ARGUMENT;
+	}
+
+	manager->workers = workers;
+	manager->worker_count = count;
+
+	return 0;
+}
+
 /**
  * Release the resources used for dual host flash management.
  *
@@ -19,6 +19,8 @@ struct host_flash_manager_dual {
 	struct spi_filter_interface *filter;			/**< The SPI filter connected to the flash devices. */
 	struct flash_mfg_filter_handler *mfg_handler;	/**< The filter handler for flash device types. */
 	struct host_flash_initialization *flash_init;	/**< Host flash initialization manager. */
+	struct host_fw_verify_worker **workers;			/**< Workers for parallel image verification. */
+	size_t worker_count;							/**< The number of verification workers. */
 };
 
 
@@ -31,5 +33,8 @@ int host_flash_manager_dual_init_with_managed_flash_initialization (
 	struct flash_mfg_filter_handler *mfg_handler, struct host_flash_initialization *flash_init);
 void host_flash_manager_dual_release (struct host_flash_manager_dual *manager);
 
+int host_flash_manager_dual_set_verification_workers (struct host_flash_manager_dual *manager,
+	struct host_fw_verify_worker **workers, size_t count);
+
 
 #endif /* HOST_FLASH_MANAGER_DUAL_H_ */
@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "host_flash_verification_cache.h"
+#include "common/buffer_util.h"
+
+
+/**
+ * Initialize a cache of host flash verification results.
+ *
+ * @param cache The verification cache to initialize.
+ * @param store Flash storage for the verification record.
+ * @param id The storage block to use for the verification record.
+ * @param key The key to use to authenticate the verification record.  This should be a device
+ * unique secret and must remain valid for the lifetime of the cache.
+ * @param key_length Length of the authentication key.
+ *
+ * @return 0 if the verification cache was successfully initialized or an error code.
+ */
+int host_flash_verification_cache_init (struct host_flash_verification_cache *cache,
+	struct flash_store *store, int id, const uint8_t *key, size_t key_length)
+{
+	if ((cache == NULL) || (store == NULL) || (key == NULL) || (key_length == 0)) {
+		return HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT;
+	}
+
+	memset (cache, 0, sizeof (struct host_flash_verification_cache));
+
+	cache->store = store;
+	cache->id = id;
+	cache->key = key;
+	cache->key_length = key_length;
+
+	return 0;
+}
+
+/**
+ * Release the resources used by a host flash verification cache.
+ *
+ * @param cache The verification cache to release.
+ */
+void host_flash_verification_cache_release (struct host_flash_verification_cache *cache)
+{
+
+}
+
+/**
+ * Generate the verification record for a PFM and flash device.
+ *
+ * @param cache The verification cache that will authenticate the record.
+ * @param pfm The PFM used to verify flash.
+ * @param hash The hash engine to use for generating the record.
+ * @param ro The flash device that was verified.
+ * @param record Output for the verification record.
+ *
+ * @return 0 if the record was generated successfully or an error code.
+ */
+static int host_flash_verification_cache_generate_record (
+	struct host_flash_verification_cache *cache, struct pfm *pfm, struct hash_engine *hash,
+	spi_filter_cs ro, struct host_flash_verification_cache_record *record)
+{
+	uint32_t pfm_id;
+	int status;
+
+	memset (record, 0, sizeof (struct host_flash_verification_cache_record));
+
+	status = pfm->base.get_id (&pfm->base, &pfm_id);
+	if (status != 0) {
+		return status;
+	}
+
+	record->pfm_id = pfm_id;
+
+	status = pfm->base.get_hash (&pfm->base, hash, record->pfm_hash, sizeof (record->pfm_hash));
+	if (ROT_IS_ERROR (status)) {
+		return status;
+	}
+
+	record->ro_flash = ro;
+
+	return hash_generate_hmac (hash, cache->key, cache->key_length, (uint8_t*) record,
+		offsetof (struct host_flash_verification_cache_record, hmac), HMAC_SHA256, record->hmac,
+		sizeof (record->hmac));
+}
+
+/**
+ * Save a record indicating that the read-only flash has been successfully verified.  This replaces
+ * any existing record.
+ *
+ * @param cache The verification cache to update.
+ * @param pfm The PFM that was used to verify flash.
+ * @param hash The hash engine to use for generating the record.
+ * @param ro The flash device that was verified.
+ *
+ * @return 0 if the verification record was saved successfully or an error code.
+ */
+int host_flash_verification_cache_save (struct host_flash_verification_cache *cache,
+	struct pfm *pfm, struct hash_engine *hash, spi_filter_cs ro)
+{
+	struct host_flash_verification_cache_record record;
+	int status;
+
+	if ((cache == NULL) || (pfm == NULL) || (hash == NULL)) {
+		return HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT;
+	}
+
+	status = host_flash_verification_cache_generate_record (cache, pfm, hash, ro, &record);
+	if (status != 0) {
+		return status;
+	}
+
+	return cache->store->write (cache->store, cache->id, (uint8_t*) &record, sizeof (record));
+}
+
+/**
+ * Check if the saved verification record matches a PFM and flash device.  The authenticity of the
+ * stored record is confirmed as part of the check.
+ *
+ * @param cache The verification cache to query.
+ * @param pfm The PFM that will be used to verify flash.
+ * @param hash The hash engine to use for checking the record.
+ * @param ro The flash device that would be verified.
+ *
+ * @return 1 if there is an authentic record for the PFM and flash device, 0 if there is not, or an
+ * error code.  Use ROT_IS_ERROR to check the return value.
+ */
+int host_flash_verification_cache_is_current (struct host_flash_verification_cache *cache,
+	struct pfm *pfm, struct hash_engine *hash, spi_filter_cs ro)
+{
+	struct host_flash_verification_cache_record stored;
+	struct host_flash_verification_cache_record expected;
+	int status;
+
+	if ((cache == NULL) || (pfm == NULL) || (hash == NULL)) {
+		return HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT;
+	}
+
+	status = cache->store->read (cache->store, cache->id, (uint8_t*) &stored, sizeof (stored));
+	if ((status == FLASH_STORE_NO_DATA) || (status == FLASH_STORE_CORRUPT_DATA)) {
+		return 0;
+	}
+	else if (ROT_IS_ERROR (status)) {
+		return status;
+	}
+	else if (status != sizeof (stored)) {
+		return 0;
+	}
+
+	status = host_flash_verification_cache_generate_record (cache, pfm, hash, ro, &expected);
+	if (status != 0) {
+		return status;
+	}
+
+	return (buffer_compare ((uint8_t*) &stored, (uint8_t*) &expected, sizeof (stored)) == 0);
+}
+
+/**
+ * Remove the saved verification record.
+ *
+ * @param cache The verification cache to clear.
+ *
+ * @return 0 if the verification record was removed successfully or an error code.
+ */
+int host_flash_verification_cache_invalidate (struct host_flash_verification_cache *cache)
+{
+	if (cache == NULL) {
+		return HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT;
+	}
+
+	return cache->store->erase (cache->store, cache->id);
+}
@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef HOST_FLASH_VERIFICATION_CACHE_H_
+#define HOST_FLASH_VERIFICATION_CACHE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "status/rot_status.h"
+#include "crypto/hash.h"
+#include "flash/flash_store.h"
+#include "manifest/pfm/pfm.h"
+#include "spi_filter/spi_filter_interface.h"
+
+
+/**
+ * Record stored in flash to indicate a successful verification of the read-only host flash.
+ */
+struct host_flash_verification_cache_record {
+	uint32_t pfm_id;						/**< ID of the PFM used for verification. */
+	uint8_t pfm_hash[SHA512_HASH_LENGTH];	/**< Digest of the PFM used for verification. */
+	uint8_t ro_flash;						/**< The flash device that was verified. */
+	uint8_t reserved[3];					/**< Unused. */
+	uint8_t hmac[SHA256_HASH_LENGTH];		/**< HMAC of the record contents. */
+} __attribute__((__packed__));
+
+
+/**
+ * Persistent cache of the last successful verification of read-only host flash.  The cached record
+ * is bound to the PFM used for verification, covering the definition and expected digest of every
+ * signed image region, and to the flash device that was verified.  An HMAC prevents the record from
+ * being forged or modified in storage.
+ *
+ * A matching record only indicates what was verified.  It is up to the user of the cache to
+ * determine that the flash could not have been modified since the record was saved.
+ */
+struct host_flash_verification_cache {
+	struct flash_store *store;		/**< Storage for the verification record. */
+	int id;							/**< Storage block that contains the record. */
+	const uint8_t *key;				/**< Key used to authenticate the record. */
+	size_t key_length;				/**< Length of the authentication key. */
+};
+
+
+int host_flash_verification_cache_init (struct host_flash_verification_cache *cache,
+	struct flash_store *store, int id, const uint8_t *key, size_t key_length);
+void host_flash_verification_cache_release (struct host_flash_verification_cache *cache);
+
+int host_flash_verification_cache_save (struct host_flash_verification_cache *cache,
+	struct pfm *pfm, struct hash_engine *hash, spi_filter_cs ro);
+int host_flash_verification_cache_is_current (struct host_flash_verification_cache *cache,
+	struct pfm *pfm, struct hash_engine *hash, spi_filter_cs ro);
+int host_flash_verification_cache_invalidate (struct host_flash_verification_cache *cache);
+
+
+#define	HOST_FLASH_VERIFICATION_CACHE_ERROR(code)	\
+	ROT_ERROR (ROT_MODULE_HOST_FLASH_VERIFICATION_CACHE, code)
+
+/**
+ * Error codes that can be generated by the host flash verification cache.
+ */
+enum {
+	HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT = HOST_FLASH_VERIFICATION_CACHE_ERROR (0x00),	/**< Input parameter is null or not valid. */
+};
+
+
+#endif /* HOST_FLASH_VERIFICATION_CACHE_H_ */
@@ -10,28 +10,250 @@
 
 
 /**
- * Search a list of host firmware version identifiers to find the longest string.
+ * Find the group of version identifiers stored at a flash address.
  *
- * @param list The list of versions to search.
+ * @param matcher The version matcher to search.
+ * @param addr The flash address of the version identifier.
  *
- * @return The length of the longest identifier.
+ * @return The group for the address or null if there is no group for the address.
  */
-static int host_fw_find_longest_version_id (const struct pfm_firmware_versions *list)
+static struct host_fw_version_group* host_fw_version_matcher_find_group (
+	struct host_fw_version_matcher *matcher, uint32_t addr)
 {
 	size_t i;
-	int max = 0;
-	int len;
-
-	if (list != NULL) {
-		for (i = 0; i < list->count; i++) {
-			len = strlen (list->versions[i].fw_version_id);
-			if (len > max) {
-				max = len;
+
+	for (i = 0; i < matcher->group_count; i++) {
+		if (matcher->groups[i].addr == addr) {
+			return &matcher->groups[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Allocate a new prefix tree node.  There is always space for the node, since enough nodes were
+ * allocated to hold every character of every version identifier.
+ *
+ * @param matcher The version matcher that will contain the node.
+ * @param value The identifier character for the node.
+ *
+ * @return Index of the new node.
+ */
+static size_t host_fw_version_matcher_new_node (struct host_fw_version_matcher *matcher,
+	char value)
+{
+	struct host_fw_version_node *node = &matcher->nodes[matcher->node_count];
+
+	node->child = 0;
+	node->sibling = 0;
+	node->version = -1;
+	node->value = value;
+
+	return matcher->node_count++;
+}
+
+/**
+ * Add a version identifier to the prefix tree for a group.
+ *
+ * @param matcher The version matcher being built.
+ * @param group The group that will contain the identifier.
+ * @param id The version identifier to add.
+ * @param index Index of the version in the list of allowed versions.
+ */
+static void host_fw_version_matcher_add_id (struct host_fw_version_matcher *matcher,
+	struct host_fw_version_group *group, const char *id, int index)
+{
+	size_t node = group->root;
+	size_t next;
+
+	while (*id != '\0') {
+		next = matcher->nodes[node].child;
+		while ((next != 0) && (matcher->nodes[next].value != *id)) {
+			next = matcher->nodes[next].sibling;
+		}
+
+		if (next == 0) {
+			next = host_fw_version_matcher_new_node (matcher, *id);
+			matcher->nodes[next].sibling = matcher->nodes[node].child;
+			matcher->nodes[node].child = next;
+		}
+
+		node = next;
+		id++;
+	}
+
+	if (index > matcher->nodes[node].version) {
+		matcher->nodes[node].version = index;
+	}
+}
+
+/**
+ * Initialize a matcher for detecting which allowed firmware version is stored on flash.
+ *
+ * Version identifiers are grouped by flash address and stored in a prefix tree for each address.
+ * Detection then needs only a single flash read for each distinct version address, regardless of
+ * how many versions share that address.
+ *
+ * @param matcher The version matcher to initialize.
+ * @param allowed The list of allowed versions.  This list must remain valid for the lifetime of
+ * the matcher.
+ *
+ * @return 0 if the matcher was successfully initialized or an error code.
+ */
+int host_fw_version_matcher_init (struct host_fw_version_matcher *matcher,
+	const struct pfm_firmware_versions *allowed)
+{
+	struct host_fw_version_group *group;
+	size_t max_nodes;
+	size_t max_length = 0;
+	size_t length;
+	size_t i;
+	uint8_t *next;
+
+	if ((matcher == NULL) || (allowed == NULL)) {
+		return HOST_FW_UTIL_INVALID_ARGUMENT;
+	}
+
+	memset (matcher, 0, sizeof (struct host_fw_version_matcher));
+
+	if ((allowed->count == 0) || (allowed->versions == NULL)) {
+		return HOST_FW_UTIL_UNSUPPORTED_VERSION;
+	}
+
+	/* Each version needs at most one group, one root node, and one node per character. */
+	max_nodes = allowed->count;
+	for (i = 0; i < allowed->count; i++) {
+		length = strlen (allowed->versions[i].fw_version_id);
+		max_nodes += length;
+		if (length > max_length) {
+			max_length = length;
+		}
+	}
+
+	matcher->groups = platform_malloc ((sizeof (struct host_fw_version_group) * allowed->count) +
+		(sizeof (struct host_fw_version_node) * max_nodes) + max_length);
+	if (matcher->groups == NULL) {
+		return HOST_FW_UTIL_NO_MEMORY;
+	}
+
+	next = (uint8_t*) &matcher->groups[allowed->count];
+	matcher->nodes = (struct host_fw_version_node*) next;
+	matcher->buffer = (uint8_t*) &matcher->nodes[max_nodes];
+	matcher->allowed = allowed;
+
+	/* Versions later in the list take priority, so build groups starting from the end.  This leaves
+	 * the groups sorted by the highest priority version they contain. */
+	i = allowed->count;
+	while (i-- > 0) {
+		group = host_fw_version_matcher_find_group (matcher,
+			allowed->versions[i].version_addr);
+		if (group == NULL) {
+			group = &matcher->groups[matcher->group_count++];
+			group->addr = allowed->versions[i].version_addr;
+			group->length = 0;
+			group->root = host_fw_version_matcher_new_node (matcher, '\0');
+			group->max_version = i;
+		}
+
+		length = strlen (allowed->versions[i].fw_version_id);
+		if (length > group->length) {
+			group->length = length;
+		}
+
+		host_fw_version_matcher_add_id (matcher, group, allowed->versions[i].fw_version_id, i);
+	}
+
+	return 0;
+}
+
+/**
+ * Release the resources used by a version matcher.
+ *
+ * @param matcher The version matcher to release.
+ */
+void host_fw_version_matcher_release (struct host_fw_version_matcher *matcher)
+{
+	if (matcher != NULL) {
+		platform_free (matcher->groups);
+		memset (matcher, 0, sizeof (struct host_fw_version_matcher));
+	}
+}
+
+/**
+ * Determine which of the allowed versions is stored on flash.  If multiple versions match the
+ * flash contents, the version that appears last in the list of allowed versions is selected.
+ *
+ * Each distinct version address is read at most once, and addresses that only contain versions
+ * with lower priority than an already matched version are not read at all.
+ *
+ * @param matcher The version matcher to use for detection.
+ * @param flash The flash device that contains the host firmware.
+ * @param offset The offset to apply to version addresses.
+ * @param version A pointer that will be updated to reference the version information for the
+ * matched version.  This will be a pointer to the entry within the versions list.
+ *
+ * @return 0 if the firmware version was found or an error code.
+ */
+int host_fw_version_matcher_find (const struct host_fw_version_matcher *matcher,
+	struct spi_flash *flash, uint32_t offset, const struct pfm_firmware_version **version)
+{
+	const struct host_fw_version_group *group;
+	const struct host_fw_version_node *nodes;
+	size_t node;
+	size_t i;
+	size_t j;
+	int match = -1;
+	int status;
+
+	if ((matcher == NULL) || (flash == NULL) || (version == NULL)) {
+		return HOST_FW_UTIL_INVALID_ARGUMENT;
+	}
+
+	*version = NULL;
+	nodes = matcher->nodes;
+
+	for (i = 0; i < matcher->group_count; i++) {
+		group = &matcher->groups[i];
+		if (group->max_version <= match) {
+			/* Groups are sorted by priority, so no remaining group can provide a better match. */
+			break;
+		}
+
+		if (group->length != 0) {
+			status = spi_flash_read (flash, group->addr + offset, matcher->buffer, group->length);
+			if (status != 0) {
+				return status;
+			}
+		}
+
+		node = group->root;
+		if (nodes[node].version > match) {
+			match = nodes[node].version;
+		}
+
+		for (j = 0; j < group->length; j++) {
+			node = nodes[node].child;
+			while ((node != 0) && (nodes[node].value != (char) matcher->buffer[j])) {
+				node = nodes[node].sibling;
+			}
+
+			if (node == 0) {
+				break;
+			}
+
+			if (nodes[node].version > match) {
+				match = nodes[node].version;
 			}
 		}
 	}
 
-	return max;
+	if (match < 0) {
+		return HOST_FW_UTIL_UNSUPPORTED_VERSION;
+	}
+
+	*version = &matcher->allowed->versions[match];
+	return 0;
 }
 
 /**
@@ -68,98 +290,21 @@ int host_fw_determine_version (struct spi_flash *flash, const struct pfm_firmwar
 int host_fw_determine_offset_version (struct spi_flash *flash, uint32_t offset,
 	const struct pfm_firmware_versions *allowed, const struct pfm_firmware_version **version)
 {
-	char *fw_version;
-	size_t version_len;
-	size_t current_len;
+	struct host_fw_version_matcher matcher;
 	int status;
-	int i;
-	int prev = -1;
 
 	if ((flash == NULL) || (allowed == NULL) || (version == NULL)) {
 		return HOST_FW_UTIL_INVALID_ARGUMENT;
 	}
 
-	if ((allowed->count == 0) || (allowed->versions == NULL)) {
-		return HOST_FW_UTIL_UNSUPPORTED_VERSION;
-	}
-
-	fw_version = platform_malloc (host_fw_find_longest_version_id (allowed));
-	if (fw_version == NULL) {
-		return HOST_FW_UTIL_NO_MEMORY;
-	}
-
-	*version = NULL;
-	i = allowed->count - 1;
-	while (!(*version) && (i >= 0)) {
-		current_len = strlen (allowed->versions[i].fw_version_id);
-
-		if ((prev < 0) ||
-			((allowed->versions[i].version_addr) != (allowed->versions[prev].version_addr))) {
-			/* We need to read a fresh version ID from the flash. */
-			version_len = current_len;
-			status = spi_flash_read (flash, allowed->versions[i].version_addr + offset,
-				(uint8_t*) fw_version, version_len);
-			if (status != 0) {
-				goto exit;
-			}
-
-			if (strncmp (allowed->versions[i].fw_version_id, fw_version, version_len) == 0) {
-				*version = &allowed->versions[i];
-				status = 0;
-			}
-		}
-		else {
-			int extra = current_len - version_len;
-
-			if (extra < 0) {
-				/* Our current ID is shorter than the cached one, so only compare against the length
-				 * of the current ID. */
-				if (strncmp (allowed->versions[i].fw_version_id, fw_version,
-					version_len + extra) == 0) {
-					*version = &allowed->versions[i];
-					status = 0;
-				}
-			}
-			else {
-				/* The current ID is at least as long at the cached one.  Check the parts we
-				 * already have to see if it matches at all. */
-				if (strncmp (allowed->versions[i].fw_version_id, fw_version, version_len) == 0) {
-					if (extra != 0) {
-						/* Get more data to finish the version check, but don't read the data we
-						 * already have. */
-						status = spi_flash_read (flash,
-							allowed->versions[i].version_addr + offset + version_len,
-							(uint8_t*) (fw_version + version_len), extra);
-						if (status != 0) {
-							goto exit;
-						}
-
-						if (strncmp (allowed->versions[i].fw_version_id + version_len,
-							fw_version + version_len, extra) == 0) {
-							*version = &allowed->versions[i];
-							status = 0;
-						}
-
-						version_len = current_len;
-					}
-					else {
-						*version = &allowed->versions[i];
-						status = 0;
-					}
-				}
-			}
-		}
-
-		prev = i;
-		i--;
+	status = host_fw_version_matcher_init (&matcher, allowed);
+	if (status != 0) {
+		return status;
 	}
 
-	if (*version == NULL) {
-		status = HOST_FW_UTIL_UNSUPPORTED_VERSION;
-	}
+	status = host_fw_version_matcher_find (&matcher, flash, offset, version);
 
-exit:
-	platform_free (fw_version);
+	host_fw_version_matcher_release (&matcher);
 	return status;
 }
 
@@ -459,46 +604,79 @@ int host_fw_verify_offset_images_multiple_fw (struct spi_flash *flash,
 }
 
 /**
- * Find the next flash region defined to be part of a firmware image.
+ * Verify that images from multiple different firmware components on the flash are valid, using
+ * additional workers to verify different components concurrently.  Only images flagged for
+ * validation will be checked.
  *
- * @param last_addr The flash address to start looking for the next region.
- * @param img_list The list of firmware images in flash.
- * @param fw_count The number of image instances.
+ * Components are verified in groups, with the first component of each group verified in the
+ * calling context and the rest distributed across the workers.  If a worker fails to start
+ * verification, that component will be verified in the calling context.  Every started
+ * verification is allowed to complete before returning.  If more than one component fails verification, the error
+ * for the component that appears first in the list is reported, so the result is the same as
+ * sequential verification.
  *
- * @return The region description for the next defined image region or null if there are no more
- * defined regions.
+ * All image addresses specified in the PFM will be offset by a fixed amount.
+ *
+ * @param flash The flash that contains the images to validate.
+ * @param img_list An array of firmware images that should be validated.
+ * @param fw_count The number of firmware components in the list.
+ * @param offset The offset to apply to image addresses.
+ * @param hash The hashing engine to use for validation in the calling context.
+ * @param rsa The RSA engine to use for signature checking in the calling context.
+ * @param workers The list of workers available for concurrent verification.  If this is null, all
+ * components will be verified sequentially.
+ * @param worker_count The number of available workers.
+ *
+ * @return 0 if all images that should be validated are good or an error code.
  */
-static const struct flash_region* host_fw_find_next_img_region (uint32_t last_addr,
-	const struct pfm_image_list *img_list, size_t fw_count)
+int host_fw_verify_offset_images_multiple_fw_parallel (struct spi_flash *flash,
+	const struct pfm_image_list *img_list, size_t fw_count, uint32_t offset,
+	struct hash_engine *hash, struct rsa_engine *rsa, struct host_fw_verify_worker **workers,
+	size_t worker_count)
 {
-	const struct flash_region *next = NULL;
-	const struct flash_region *img_next;
-	size_t i;
+	size_t i = 0;
+	size_t started;
 	size_t j;
+	int status;
+	int result;
 
-	for (i = 0; i < fw_count; i++) {
-		for (j = 0; j < img_list[i].count; j++) {
-			if (img_list[i].images_sig) {
-				img_next = host_fw_find_next_region (last_addr, img_list[i].images_sig[j].regions,
-					img_list[i].images_sig[j].count);
-			}
-			else {
-				img_next = host_fw_find_next_region (last_addr, img_list[i].images_hash[j].regions,
-					img_list[i].images_hash[j].count);
+	if ((flash == NULL) || (img_list == NULL) || (hash == NULL) || (rsa == NULL)) {
+		return HOST_FW_UTIL_INVALID_ARGUMENT;
+	}
+
+	if ((workers == NULL) || (worker_count == 0)) {
+		return host_fw_verify_offset_images_multiple_fw (flash, img_list, fw_count, offset, hash,
+			rsa);
+	}
+
+	while (i < fw_count) {
+		for (started = 0; (started < worker_count) && ((i + started + 1) < fw_count); started++) {
+			status = workers[started]->start_verification (workers[started], flash,
+				&img_list[i + started + 1], offset);
+			if (status != 0) {
+				/* The component that could not be started will be the first component of the next
+				 * group, so it gets verified in the calling context instead. */
+				break;
 			}
+		}
 
-			if (img_next) {
-				if (img_next->start_addr == last_addr) {
-					return img_next;
-				}
-				else if (!next || (img_next->start_addr < next->start_addr)) {
-					next = img_next;
-				}
+		result = host_fw_verify_images_on_flash (flash, &img_list[i], false, offset, hash, rsa);
+
+		for (j = 0; j < started; j++) {
+			status = workers[j]->get_verification_result (workers[j]);
+			if (result == 0) {
+				result = status;
 			}
 		}
+
+		if (result != 0) {
+			return result;
+		}
+
+		i += started + 1;
 	}
 
-	return next;
+	return 0;
 }
 
 /**
@@ -535,39 +713,184 @@ static const struct flash_region* host_fw_find_next_rw_region (uint32_t last_add
 }
 
 /**
- * Find the next used region of flash.
+ * Add a list of flash regions to the set of regions that will be included in a region map.
  *
- * @param last_addr The flash address to start looking for the next region.
- * @param img_list The list of images in the flash.
- * @param writable The list of read/write regions in the flash.
- * @param fw_count The number of different firmware instances.
+ * @param spans The list of spans being populated.
+ * @param count The number of spans already in the list.  This will be updated with the new count.
+ * @param regions The flash regions to add.
+ * @param region_count The number of flash regions to add.
+ * @param type The type of data contained in the flash regions.
+ */
+static void host_fw_region_map_add_regions (struct host_fw_region_span *spans, size_t *count,
+	const struct flash_region *regions, size_t region_count, enum host_fw_region_type type)
+{
+	size_t i;
+
+	for (i = 0; i < region_count; i++) {
+		spans[*count].start_addr = regions[i].start_addr;
+		spans[*count].length = regions[i].length;
+		spans[*count].type = type;
+		*count += 1;
+	}
+}
+
+/**
+ * Compare two region spans by starting address.
+ *
+ * @param first The first span to compare.
+ * @param second The second span to compare.
  *
- * @return The region description for the next used region or null if there are no more used
- * regions.
+ * @return A value less than, equal to, or greater than 0 if the first span starts before, at, or
+ * after the second span.
  */
-static const struct flash_region* host_fw_find_next_flash_region (uint32_t last_addr,
+static int host_fw_region_map_compare (const void *first, const void *second)
+{
+	const struct host_fw_region_span *span1 = first;
+	const struct host_fw_region_span *span2 = second;
+
+	if (span1->start_addr < span2->start_addr) {
+		return -1;
+	}
+	else if (span1->start_addr > span2->start_addr) {
+		return 1;
+	}
+	else {
+		return (int) span1->type - (int) span2->type;
+	}
+}
+
+/**
+ * Generate a sorted map of how the flash is used by a set of firmware components.
+ *
+ * Regions that overlap are merged into a single span, as are adjacent regions of the same type.
+ * Gaps between used regions are added to the map as unused spans.
+ *
+ * @param map The region map to initialize.
+ * @param img_list An array of firmware images for each firmware component.  This can be null to
+ * only map read/write regions.
+ * @param writable An array of read/write regions for each firmware component.  This can be null to
+ * only map image regions.
+ * @param fw_count The number of firmware components in the lists.
+ * @param flash_size The total size of the flash.  If this extends beyond the last used region, an
+ * unused span will be added to the end of the map.  Set this to 0 to not map the end of flash.
+ *
+ * @return 0 if the region map was successfully generated or an error code.
+ */
+int host_fw_region_map_init (struct host_fw_region_map *map,
 	const struct pfm_image_list *img_list, const struct pfm_read_write_regions *writable,
-	size_t fw_count)
+	size_t fw_count, uint32_t flash_size)
 {
-	const struct flash_region *next;
-	const struct flash_region *rw_next;
+	struct host_fw_region_span *used;
+	struct host_fw_region_span next;
+	size_t region_count = 0;
+	size_t used_count = 0;
+	uint32_t end = 0;
+	size_t i;
+	size_t j;
 
-	next = host_fw_find_next_img_region (last_addr, img_list, fw_count);
-	if (next && (next->start_addr == last_addr)) {
-		return next;
+	if (map == NULL) {
+		return HOST_FW_UTIL_INVALID_ARGUMENT;
 	}
 
-	rw_next = host_fw_find_next_rw_region (last_addr, writable, fw_count);
-	if (rw_next) {
-		if (!next || (rw_next->start_addr == last_addr)) {
-			next = rw_next;
+	memset (map, 0, sizeof (struct host_fw_region_map));
+
+	for (i = 0; i < fw_count; i++) {
+		if (img_list) {
+			for (j = 0; j < img_list[i].count; j++) {
+				region_count += (img_list[i].images_sig) ?
+					img_list[i].images_sig[j].count : img_list[i].images_hash[j].count;
+			}
 		}
-		else if (rw_next->start_addr < next->start_addr) {
-			next = rw_next;
+
+		if (writable) {
+			region_count += writable[i].count;
 		}
 	}
 
-	return next;
+	/* Each used region can add at most one unused gap before it, plus the unused end of flash.  The
+	 * raw list of used regions is staged in the upper part of the same buffer.  Since each region
+	 * generates no more than two spans, the map never overwrites a region that hasn't been
+	 * processed yet. */
+	map->spans = platform_malloc (sizeof (struct host_fw_region_span) * ((region_count * 2) + 1));
+	if (map->spans == NULL) {
+		return HOST_FW_UTIL_NO_MEMORY;
+	}
+
+	used = &map->spans[region_count + 1];
+	for (i = 0; i < fw_count; i++) {
+		if (img_list) {
+			for (j = 0; j < img_list[i].count; j++) {
+				if (img_list[i].images_sig) {
+					host_fw_region_map_add_regions (used, &used_count,
+						img_list[i].images_sig[j].regions, img_list[i].images_sig[j].count,
+						HOST_FW_REGION_SIGNED);
+				}
+				else {
+					host_fw_region_map_add_regions (used, &used_count,
+						img_list[i].images_hash[j].regions, img_list[i].images_hash[j].count,
+						HOST_FW_REGION_SIGNED);
+				}
+			}
+		}
+
+		if (writable) {
+			host_fw_region_map_add_regions (used, &used_count, writable[i].regions,
+				writable[i].count, HOST_FW_REGION_RW);
+		}
+	}
+
+	qsort (used, used_count, sizeof (struct host_fw_region_span), host_fw_region_map_compare);
+
+	for (i = 0; i < used_count; i++) {
+		next = used[i];
+		if (next.length == 0) {
+			continue;
+		}
+
+		if (map->count != 0) {
+			if ((next.start_addr < end) ||
+				((next.start_addr == end) && (next.type == map->spans[map->count - 1].type))) {
+				if ((next.start_addr + next.length) > end) {
+					end = next.start_addr + next.length;
+					map->spans[map->count - 1].length = end - map->spans[map->count - 1].start_addr;
+				}
+
+				continue;
+			}
+		}
+
+		if (next.start_addr > end) {
+			map->spans[map->count].start_addr = end;
+			map->spans[map->count].length = next.start_addr - end;
+			map->spans[map->count].type = HOST_FW_REGION_UNUSED;
+			map->count++;
+		}
+
+		map->spans[map->count++] = next;
+		end = next.start_addr + next.length;
+	}
+
+	if (flash_size > end) {
+		map->spans[map->count].start_addr = end;
+		map->spans[map->count].length = flash_size - end;
+		map->spans[map->count].type = HOST_FW_REGION_UNUSED;
+		map->count++;
+	}
+
+	return 0;
+}
+
+/**
+ * Release the resources used by a region map.
+ *
+ * @param map The region map to release.
+ */
+void host_fw_region_map_release (struct host_fw_region_map *map)
+{
+	if (map) {
+		platform_free (map->spans);
+		memset (map, 0, sizeof (struct host_fw_region_map));
+	}
 }
 
 /**
@@ -614,9 +937,8 @@ int host_fw_full_flash_verification_multiple_fw (struct spi_flash *flash,
 	const struct pfm_image_list *img_list, const struct pfm_read_write_regions *writable,
 	size_t fw_count, uint8_t unused_byte, struct hash_engine *hash, struct rsa_engine *rsa)
 {
-	const struct flash_region *pos;
+	struct host_fw_region_map map;
 	uint32_t flash_size;
-	uint32_t last_addr;
 	int status;
 	size_t i;
 
@@ -637,20 +959,23 @@ int host_fw_full_flash_verification_multiple_fw (struct spi_flash *flash,
 		}
 	}
 
-	last_addr = 0;
-	pos = host_fw_find_next_flash_region (last_addr, img_list, writable, fw_count);
-	while (pos) {
-		status = flash_value_check (&flash->base, last_addr, pos->start_addr - last_addr,
-			unused_byte);
-		if (status != 0) {
-			return status;
-		}
+	status = host_fw_region_map_init (&map, img_list, writable, fw_count, flash_size);
+	if (status != 0) {
+		return status;
+	}
 
-		last_addr = pos->start_addr + pos->length;
-		pos = host_fw_find_next_flash_region (last_addr, img_list, writable, fw_count);
+	for (i = 0; i < map.count; i++) {
+		if (map.spans[i].type == HOST_FW_REGION_UNUSED) {
+			status = flash_value_check (&flash->base, map.spans[i].start_addr,
+				map.spans[i].length, unused_byte);
+			if (status != 0) {
+				break;
+			}
+		}
 	}
 
-	return flash_value_check (&flash->base, last_addr, flash_size - last_addr, unused_byte);
+	host_fw_region_map_release (&map);
+	return status;
 }
 
 /**
@@ -1031,12 +1356,10 @@ int host_fw_config_spi_filter_read_write_regions (struct spi_filter_interface *f
 int host_fw_config_spi_filter_read_write_regions_multiple_fw (struct spi_filter_interface *filter,
 	const struct pfm_read_write_regions *writable, size_t fw_count)
 {
+	struct host_fw_region_map map;
 	uint8_t region_id = 0;
-	uint32_t last_addr = 0;
-	const struct flash_region *next = NULL;
-	const struct flash_region *prev = NULL;
-	size_t total_len;
 	int status;
+	size_t i;
 
 	if ((filter == NULL) || ((writable == NULL) && (fw_count != 0))) {
 		return HOST_FW_UTIL_INVALID_ARGUMENT;
@@ -1047,38 +1370,21 @@ int host_fw_config_spi_filter_read_write_regions_multiple_fw (struct spi_filter_
 		return status;
 	}
 
-	do {
-		if (!prev) {
-			prev = next;
-		}
-		next = host_fw_find_next_rw_region (last_addr, writable, fw_count);
-
-		if (prev) {
-			if (next && (next->start_addr == last_addr)) {
-				/* The next region is contiguous with the previous one. */
-				total_len += next->length;
-				last_addr += next->length;
-			}
-			else {
-				/* Found the end of a R/W region. */
-				status = filter->set_filter_rw_region (filter, ++region_id, prev->start_addr,
-					prev->start_addr + total_len);
-				if (status != 0) {
-					return status;
-				}
+	status = host_fw_region_map_init (&map, NULL, writable, fw_count, 0);
+	if (status != 0) {
+		return status;
+	}
 
-				prev = NULL;
-				if (next) {
-					total_len = next->length;
-					last_addr = next->start_addr + next->length;
-				}
+	for (i = 0; i < map.count; i++) {
+		if (map.spans[i].type == HOST_FW_REGION_RW) {
+			status = filter->set_filter_rw_region (filter, ++region_id, map.spans[i].start_addr,
+				map.spans[i].start_addr + map.spans[i].length);
+			if (status != 0) {
+				break;
 			}
 		}
-		else if (next) {
-			total_len = next->length;
-			last_addr = next->start_addr + next->length;
-		}
-	} while (prev || next);
+	}
 
-	return 0;
+	host_fw_region_map_release (&map);
+	return status;
 }
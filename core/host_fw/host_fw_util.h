@@ -12,8 +12,85 @@
 #include "spi_filter/spi_filter_interface.h"
 #include "crypto/hash.h"
 #include "crypto/rsa.h"
+#include "host_fw_verify_worker.h"
 
 
+/**
+ * A node in the prefix tree of version identifiers stored at a single flash address.
+ */
+struct host_fw_version_node {
+	size_t child;								/**< Index of the first child node.  0 if there are no children. */
+	size_t sibling;								/**< Index of the next node with the same parent.  0 if there are no more. */
+	int version;								/**< Index of the version identifier ending at this node.  -1 if none. */
+	char value;									/**< The identifier character for this node. */
+};
+
+/**
+ * All version identifiers that are stored at the same flash address.
+ */
+struct host_fw_version_group {
+	uint32_t addr;								/**< Flash address of the version identifiers. */
+	size_t length;								/**< Length of the longest identifier in the group. */
+	size_t root;								/**< Index of the root node for the group prefix tree. */
+	int max_version;							/**< Highest version index contained in the group. */
+};
+
+/**
+ * Precomputed structure for detecting which of a list of allowed versions is present on flash.
+ * Version identifiers are grouped by flash address, and each address only needs to be read once to
+ * check every identifier stored there.
+ */
+struct host_fw_version_matcher {
+	const struct pfm_firmware_versions *allowed;	/**< The list of allowed versions. */
+	struct host_fw_version_group *groups;			/**< Version identifiers grouped by address. */
+	size_t group_count;								/**< The number of distinct version addresses. */
+	struct host_fw_version_node *nodes;				/**< Prefix tree nodes for all groups. */
+	size_t node_count;								/**< The number of prefix tree nodes in use. */
+	uint8_t *buffer;								/**< Buffer for identifier data read from flash. */
+};
+
+
+/**
+ * The types of flash regions described by a region map.
+ */
+enum host_fw_region_type {
+	HOST_FW_REGION_UNUSED = 0,					/**< Flash that is not used by any firmware component. */
+	HOST_FW_REGION_SIGNED,						/**< Flash that contains signed firmware image data. */
+	HOST_FW_REGION_RW,							/**< Flash that contains read/write data. */
+};
+
+/**
+ * A contiguous span of flash that contains a single type of data.
+ */
+struct host_fw_region_span {
+	uint32_t start_addr;						/**< The starting address of the span. */
+	size_t length;								/**< The number of bytes in the span. */
+	enum host_fw_region_type type;				/**< The type of data in the span. */
+};
+
+/**
+ * A sorted map of all flash regions used by a set of firmware components.  Overlapping and
+ * adjacent regions of the same type are merged, and the gaps between used regions are described as
+ * unused spans.  This allows the entire flash layout to be processed in a single pass.
+ */
+struct host_fw_region_map {
+	struct host_fw_region_span *spans;			/**< The spans of flash, sorted by address. */
+	size_t count;								/**< The number of spans in the map. */
+};
+
+
+int host_fw_version_matcher_init (struct host_fw_version_matcher *matcher,
+	const struct pfm_firmware_versions *allowed);
+void host_fw_version_matcher_release (struct host_fw_version_matcher *matcher);
+
+int host_fw_version_matcher_find (const struct host_fw_version_matcher *matcher,
+	struct spi_flash *flash, uint32_t offset, const struct pfm_firmware_version **version);
+
+int host_fw_region_map_init (struct host_fw_region_map *map,
+	const struct pfm_image_list *img_list, const struct pfm_read_write_regions *writable,
+	size_t fw_count, uint32_t flash_size);
+void host_fw_region_map_release (struct host_fw_region_map *map);
+
 int host_fw_determine_version (struct spi_flash *flash, const struct pfm_firmware_versions *allowed,
 	const struct pfm_firmware_version **version);
 int host_fw_determine_offset_version (struct spi_flash *flash, uint32_t offset,
@@ -32,6 +109,10 @@ int host_fw_verify_images_multiple_fw (struct spi_flash *flash,
 int host_fw_verify_offset_images_multiple_fw (struct spi_flash *flash,
 	const struct pfm_image_list *img_list, size_t fw_count, uint32_t offset,
 	struct hash_engine *hash, struct rsa_engine *rsa);
+int host_fw_verify_offset_images_multiple_fw_parallel (struct spi_flash *flash,
+	const struct pfm_image_list *img_list, size_t fw_count, uint32_t offset,
+	struct hash_engine *hash, struct rsa_engine *rsa, struct host_fw_verify_worker **workers,
+	size_t worker_count);
 
 int host_fw_full_flash_verification (struct spi_flash *flash, const struct pfm_image_list *img_list,
 	const struct pfm_read_write_regions *writable, uint8_t unused_byte, struct hash_engine *hash,
@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef HOST_FW_VERIFY_WORKER_H_
+#define HOST_FW_VERIFY_WORKER_H_
+
+#include <stdint.h>
+#include "status/rot_status.h"
+#include "flash/spi_flash.h"
+#include "manifest/pfm/pfm.h"
+
+
+/**
+ * A platform-independent API for verifying host firmware images in an execution context separate
+ * from the caller.  This allows multiple firmware components to be verified concurrently.
+ *
+ * Each worker must use hash and RSA engines that are not shared with any other context.  The flash
+ * device will be accessed concurrently from multiple contexts, so the flash driver must serialize
+ * access to the device.
+ */
+struct host_fw_verify_worker {
+	/**
+	 * Start verification of a set of firmware images.  This will return as soon as verification
+	 * has been started, and the worker must not be used for any other verification until the
+	 * result has been retrieved.
+	 *
+	 * The images must be verified with the same rules as host_fw_verify_offset_images.
+	 *
+	 * @param worker The worker that will run the verification.
+	 * @param flash The flash that contains the images to validate.
+	 * @param img_list The list of images to validate.  This must remain valid until the
+	 * verification result has been retrieved.
+	 * @param offset The offset to apply to image addresses.
+	 *
+	 * @return 0 if verification was started successfully or an error code.
+	 */
+	int (*start_verification) (struct host_fw_verify_worker *worker, struct spi_flash *flash,
+		const struct pfm_image_list *img_list, uint32_t offset);
+
+	/**
+	 * Wait for an outstanding verification to complete.
+	 *
+	 * @param worker The worker running the verification.
+	 *
+	 * @return 0 if all images that should be validated are good or an error code.
+	 */
+	int (*get_verification_result) (struct host_fw_verify_worker *worker);
+};
+
+
+#define	HOST_FW_VERIFY_WORKER_ERROR(code)	\
+	ROT_ERROR (ROT_MODULE_HOST_FW_VERIFY_WORKER, code)
+
+/**
+ * Error codes that can be generated by a host firmware verification worker.
+ */
+enum {
+	HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT = HOST_FW_VERIFY_WORKER_ERROR (0x00),	/**< Input parameter is null or not valid. */
+	HOST_FW_VERIFY_WORKER_NO_MEMORY = HOST_FW_VERIFY_WORKER_ERROR (0x01),			/**< Memory allocation failed. */
+	HOST_FW_VERIFY_WORKER_START_FAILED = HOST_FW_VERIFY_WORKER_ERROR (0x02),		/**< Verification could not be started. */
+	HOST_FW_VERIFY_WORKER_RESULT_FAILED = HOST_FW_VERIFY_WORKER_ERROR (0x03),		/**< The verification result could not be retrieved. */
+	HOST_FW_VERIFY_WORKER_BUSY = HOST_FW_VERIFY_WORKER_ERROR (0x04),				/**< The worker is already running a verification. */
+	HOST_FW_VERIFY_WORKER_NOT_STARTED = HOST_FW_VERIFY_WORKER_ERROR (0x05),			/**< There is no verification running. */
+};
+
+
+#endif /* HOST_FW_VERIFY_WORKER_H_ */
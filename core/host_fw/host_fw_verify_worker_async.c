@@ -0,0 +1,258 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "host_fw_verify_worker_async.h"
+#include "host_fw_util.h"
+
+
+static int host_fw_verify_worker_async_start_verification (struct host_fw_verify_worker *worker,
+	struct spi_flash *flash, const struct pfm_image_list *img_list, uint32_t offset)
+{
+	struct host_fw_verify_worker_async *async = (struct host_fw_verify_worker_async*) worker;
+	int status = 0;
+
+	if ((async == NULL) || (flash == NULL) || (img_list == NULL)) {
+		return HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&async->lock);
+
+	if (async->active) {
+		status = HOST_FW_VERIFY_WORKER_BUSY;
+		goto exit;
+	}
+
+	async->flash = flash;
+	async->img_list = img_list;
+	async->offset = offset;
+	async->result = 0;
+	async->active = true;
+	async->pending = true;
+
+	/* Clear any stale completion signal before queuing the request. */
+	platform_semaphore_reset (&async->work_done);
+
+	status = platform_semaphore_post (&async->work_ready);
+	if (status != 0) {
+		async->active = false;
+		async->pending = false;
+	}
+
+exit:
+	platform_mutex_unlock (&async->lock);
+	return status;
+}
+
+static int host_fw_verify_worker_async_get_verification_result (
+	struct host_fw_verify_worker *worker)
+{
+	struct host_fw_verify_worker_async *async = (struct host_fw_verify_worker_async*) worker;
+	bool active;
+	int status;
+
+	if (async == NULL) {
+		return HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&async->lock);
+	active = async->active;
+	platform_mutex_unlock (&async->lock);
+
+	if (!active) {
+		return HOST_FW_VERIFY_WORKER_NOT_STARTED;
+	}
+
+	status = platform_semaphore_wait (&async->work_done, 0);
+	if (status != 0) {
+		return HOST_FW_VERIFY_WORKER_RESULT_FAILED;
+	}
+
+	platform_mutex_lock (&async->lock);
+	status = async->result;
+	async->active = false;
+	platform_mutex_unlock (&async->lock);
+
+	return status;
+}
+
+/**
+ * Initialize the common components of a host firmware verification worker.
+ *
+ * @param worker The worker to initialize.
+ * @param hash The dedicated hash engine for the worker.  Null if engines come from a pool.
+ * @param pool The pool to acquire hash engines from.  Null if the worker has a dedicated engine.
+ * @param rsa The RSA engine to use for signature verification.
+ *
+ * @return 0 if the worker was successfully initialized or an error code.
+ */
+static int host_fw_verify_worker_async_init_common (struct host_fw_verify_worker_async *worker,
+	struct hash_engine *hash, struct hash_pool *pool, struct rsa_engine *rsa)
+{
+	int status;
+
+	memset (worker, 0, sizeof (struct host_fw_verify_worker_async));
+
+	status = platform_mutex_init (&worker->lock);
+	if (status != 0) {
+		return status;
+	}
+
+	status = platform_semaphore_init (&worker->work_ready);
+	if (status != 0) {
+		goto free_lock;
+	}
+
+	status = platform_semaphore_init (&worker->work_done);
+	if (status != 0) {
+		goto free_ready;
+	}
+
+	worker->base.start_verification = host_fw_verify_worker_async_start_verification;
+	worker->base.get_verification_result = host_fw_verify_worker_async_get_verification_result;
+
+	worker->hash = hash;
+	worker->pool = pool;
+	worker->rsa = rsa;
+
+	return 0;
+
+free_ready:
+	platform_semaphore_free (&worker->work_ready);
+free_lock:
+	platform_mutex_free (&worker->lock);
+	return status;
+}
+
+/**
+ * Initialize a host firmware verification worker that runs in a separate context.
+ *
+ * @param worker The worker to initialize.
+ * @param hash The hash engine to use for verification.  This must not be used by any other
+ * context.
+ * @param rsa The RSA engine to use for signature verification.  This must not be used by any other
+ * context.
+ *
+ * @return 0 if the worker was successfully initialized or an error code.
+ */
+int host_fw_verify_worker_async_init (struct host_fw_verify_worker_async *worker,
+	struct hash_engine *hash, struct rsa_engine *rsa)
+{
+	if ((worker == NULL) || (hash == NULL) || (rsa == NULL)) {
+		return HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT;
+	}
+
+	return host_fw_verify_worker_async_init_common (worker, hash, NULL, rsa);
+}
+
+/**
+ * Initialize a host firmware verification worker that runs in a separate context and acquires a
+ * hash engine from a pool for each verification.  The engine is returned to the pool as soon as
+ * the verification completes, so it is available to other contexts while the worker is idle.
+ *
+ * @param worker The worker to initialize.
+ * @param pool The pool to acquire hash engines from.
+ * @param rsa The RSA engine to use for signature verification.  This must not be used by any other
+ * context.
+ *
+ * @return 0 if the worker was successfully initialized or an error code.
+ */
+int host_fw_verify_worker_async_init_pool (struct host_fw_verify_worker_async *worker,
+	struct hash_pool *pool, struct rsa_engine *rsa)
+{
+	if ((worker == NULL) || (pool == NULL) || (rsa == NULL)) {
+		return HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT;
+	}
+
+	return host_fw_verify_worker_async_init_common (worker, NULL, pool, rsa);
+}
+
+/**
+ * Release the resources used by a host firmware verification worker.  The execution context for
+ * the worker must be stopped before the worker is released.
+ *
+ * @param worker The worker to release.
+ */
+void host_fw_verify_worker_async_release (struct host_fw_verify_worker_async *worker)
+{
+	if (worker) {
+		platform_semaphore_free (&worker->work_done);
+		platform_semaphore_free (&worker->work_ready);
+		platform_mutex_free (&worker->lock);
+	}
+}
+
+/**
+ * Wait until a verification request has been queued for the worker.  This is called from the
+ * worker execution context.
+ *
+ * @param worker The worker to wait on.
+ * @param timeout_ms The maximum amount of time to wait, in milliseconds.  Set to 0 to wait
+ * forever.
+ *
+ * @return 0 if a request may be ready to process, 1 if the wait timed out, or an error code.
+ */
+int host_fw_verify_worker_async_wait_for_work (struct host_fw_verify_worker_async *worker,
+	uint32_t timeout_ms)
+{
+	if (worker == NULL) {
+		return HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT;
+	}
+
+	return platform_semaphore_wait (&worker->work_ready, timeout_ms);
+}
+
+/**
+ * Run a queued verification request.  This is called from the worker execution context.  The
+ * result will be provided to the context waiting for verification to complete.
+ *
+ * @param worker The worker to run.
+ *
+ * @return 0 if a verification was run, regardless of the verification result, or an error code.
+ * HOST_FW_VERIFY_WORKER_NOT_STARTED is returned when there is no queued request.
+ */
+int host_fw_verify_worker_async_process (struct host_fw_verify_worker_async *worker)
+{
+	struct spi_flash *flash;
+	const struct pfm_image_list *img_list;
+	struct hash_engine *hash;
+	uint32_t offset;
+	int result;
+
+	if (worker == NULL) {
+		return HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&worker->lock);
+
+	if (!worker->pending) {
+		platform_mutex_unlock (&worker->lock);
+		return HOST_FW_VERIFY_WORKER_NOT_STARTED;
+	}
+
+	flash = worker->flash;
+	img_list = worker->img_list;
+	offset = worker->offset;
+	worker->pending = false;
+
+	platform_mutex_unlock (&worker->lock);
+
+	if (worker->pool != NULL) {
+		result = hash_pool_acquire_engine (worker->pool, 0, &hash);
+		if (result == 0) {
+			result = host_fw_verify_offset_images (flash, img_list, offset, hash, worker->rsa);
+			hash_pool_release_engine (worker->pool, hash);
+		}
+	}
+	else {
+		result = host_fw_verify_offset_images (flash, img_list, offset, worker->hash, worker->rsa);
+	}
+
+	platform_mutex_lock (&worker->lock);
+	worker->result = result;
+	platform_mutex_unlock (&worker->lock);
+
+	return platform_semaphore_post (&worker->work_done);
+}
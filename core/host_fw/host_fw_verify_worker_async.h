@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef HOST_FW_VERIFY_WORKER_ASYNC_H_
+#define HOST_FW_VERIFY_WORKER_ASYNC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "platform.h"
+#include "host_fw_verify_worker.h"
+#include "crypto/hash.h"
+#include "crypto/hash_pool.h"
+#include "crypto/rsa.h"
+
+
+/**
+ * A host firmware verification worker that runs verification in a separate execution context.
+ * Verification requests are queued by the caller and executed when the worker context calls
+ * {@link host_fw_verify_worker_async_process}.  The platform is responsible for providing the
+ * execution context, which should wait for requests with
+ * {@link host_fw_verify_worker_async_wait_for_work}.
+ *
+ * Each worker has its own RSA engine that must not be used by any other context.  The hash engine
+ * is either dedicated to the worker or acquired from a pool for the duration of each verification.
+ */
+struct host_fw_verify_worker_async {
+	struct host_fw_verify_worker base;			/**< The base worker instance. */
+	struct hash_engine *hash;					/**< Hash engine used only by this worker. */
+	struct hash_pool *pool;						/**< Pool to acquire hash engines from. */
+	struct rsa_engine *rsa;						/**< RSA engine used only by this worker. */
+	struct spi_flash *flash;					/**< Flash that contains the images to verify. */
+	const struct pfm_image_list *img_list;		/**< The images to verify. */
+	uint32_t offset;							/**< Offset to apply to image addresses. */
+	int result;									/**< Result of the last verification. */
+	bool active;								/**< Flag indicating a verification has been started. */
+	bool pending;								/**< Flag indicating verification has not been run. */
+	platform_mutex lock;						/**< Synchronization for the request state. */
+	platform_semaphore work_ready;				/**< Signal that a verification request is queued. */
+	platform_semaphore work_done;				/**< Signal that verification has completed. */
+};
+
+
+int host_fw_verify_worker_async_init (struct host_fw_verify_worker_async *worker,
+	struct hash_engine *hash, struct rsa_engine *rsa);
+int host_fw_verify_worker_async_init_pool (struct host_fw_verify_worker_async *worker,
+	struct hash_pool *pool, struct rsa_engine *rsa);
+void host_fw_verify_worker_async_release (struct host_fw_verify_worker_async *worker);
+
+int host_fw_verify_worker_async_wait_for_work (struct host_fw_verify_worker_async *worker,
+	uint32_t timeout_ms);
+int host_fw_verify_worker_async_process (struct host_fw_verify_worker_async *worker);
+
+
+#endif /* HOST_FW_VERIFY_WORKER_ASYNC_H_ */
@@ -66,6 +66,7 @@ enum {
 	HOST_LOGGING_RW_RESTORE_FINISH,				/**< End condition for active image R/W regions. */
 	HOST_LOGGING_CHECK_PENDING_FAILED,			/**< Failed an empty check for a pending PFM. */
 	HOST_LOGGING_CLEAR_PFMS,					/**< Clearing all PFMs to enable bypass mode. */
+	HOST_LOGGING_VERIFICATION_CACHE_ERROR,		/**< Error updating the cached flash verification state. */
 };
 
 
@@ -72,6 +72,132 @@ void host_processor_filtered_release (struct host_processor_filtered *host)
 	}
 }
 
+/**
+ * Enable caching of read-only flash verification results.  With a cache, verification of the
+ * read-only flash will be skipped when the flash has already been verified against the same PFM and
+ * there is no indication that flash has been modified since that verification.  Full verification
+ * will be run whenever the state of flash is uncertain.
+ *
+ * The cache must only be used on platforms where host writes to flash will always be reported by
+ * the SPI filter dirty state.  Since the SPI filter is reset on power-on, the cache is never used
+ * for power-on verification, but a new result will be saved after successful verification.
+ *
+ * @param host The host processor instance to update.
+ * @param cache The verification cache to use.  Set this to null to disable caching.
+ */
+void host_processor_filtered_set_verification_cache (struct host_processor_filtered *host,
+	struct host_flash_verification_cache *cache)
+{
+	if (host) {
+		host->verify_cache = cache;
+	}
+}
+
+/**
+ * Remove any cached verification result for the read-only flash.  This must be called prior to any
+ * operation that could modify the contents of the read-only flash or allow it to be modified.
+ *
+ * @param host The host processor instance being updated.
+ */
+static void host_processor_filtered_invalidate_verification_cache (
+	struct host_processor_filtered *host)
+{
+	int status;
+
+	if (host->verify_cache) {
+		status = host_flash_verification_cache_invalidate (host->verify_cache);
+		if (status != 0) {
+			debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_HOST_FW,
+				HOST_LOGGING_VERIFICATION_CACHE_ERROR, host->base.port, status);
+		}
+	}
+}
+
+/**
+ * Determine if there has been any indication that host flash has been modified since the last
+ * verification.  If there is, any cached verification result is removed.
+ *
+ * @param host The host processor instance to check.
+ * @param is_bypass Flag indicating if the processor is running in bypass mode.
+ * @param allow_cache Flag indicating if the SPI filter state can be trusted to report flash
+ * modifications since the last verification.  This must be false after a power-on reset.
+ *
+ * @return true if a cached verification result can be used for the read-only flash.
+ */
+static bool host_processor_filtered_check_flash_unmodified (struct host_processor_filtered *host,
+	bool is_bypass, bool allow_cache)
+{
+	spi_filter_flash_state dirty;
+	int status;
+
+	if (host->verify_cache == NULL) {
+		return false;
+	}
+
+	if (allow_cache && !is_bypass && !host_state_manager_is_inactive_dirty (host->state)) {
+		status = host->filter->get_flash_dirty_state (host->filter, &dirty);
+		if ((status == 0) && (dirty == SPI_FILTER_FLASH_STATE_NORMAL)) {
+			return true;
+		}
+	}
+
+	host_processor_filtered_invalidate_verification_cache (host);
+	return false;
+}
+
+/**
+ * Get the read/write regions for the read-only flash using a cached verification result instead of
+ * validating the flash.  If there is no cached result for the PFM, the cache is cleared so that any
+ * subsequent verification failure will not leave a stale result.
+ *
+ * @param host The host processor instance to use.
+ * @param hash The hash engine to use for checking the cache.
+ * @param pfm The PFM that would be used to validate the flash.
+ * @param rw_list Output for the list of read/write regions on a cache hit.
+ *
+ * @return 0 if the cached result was used or an error code.
+ */
+static int host_processor_filtered_get_cached_verification (struct host_processor_filtered *host,
+	struct hash_engine *hash, struct pfm *pfm, struct host_flash_manager_rw_regions *rw_list)
+{
+	int status;
+
+	status = host_flash_verification_cache_is_current (host->verify_cache, pfm, hash,
+		host_state_manager_get_read_only_flash (host->state));
+	if (status == 1) {
+		status = host->flash->get_flash_read_write_regions (host->flash, pfm, false, rw_list);
+		if (status == 0) {
+			return 0;
+		}
+	}
+	else if (status == 0) {
+		status = HOST_PROCESSOR_NO_CACHED_VERIFICATION;
+	}
+
+	host_processor_filtered_invalidate_verification_cache (host);
+	return status;
+}
+
+/**
+ * Save the result of a successful read-only flash verification in the cache.
+ *
+ * @param host The host processor instance being updated.
+ * @param hash The hash engine to use for generating the cached result.
+ * @param pfm The PFM that was used to validate the flash.
+ */
+static void host_processor_filtered_save_verification (struct host_processor_filtered *host,
+	struct hash_engine *hash, struct pfm *pfm)
+{
+	int status;
+
+	status = host_flash_verification_cache_save (host->verify_cache, pfm, hash,
+		host_state_manager_get_read_only_flash (host->state));
+	if (status != 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_HOST_FW,
+			HOST_LOGGING_VERIFICATION_CACHE_ERROR, host->base.port, status);
+	}
+}
+
 /**
  * Take the SPI flash from the host for the first time and configure the SPI filter for the devices.
  * This function will spin indefinitely until this operation is successful or a known error is
@@ -201,6 +327,8 @@ void host_processor_filtered_config_bypass (struct host_processor_filtered *host
 			HOST_LOGGING_BYPASS_MODE_RETRIES, host->base.port, retries);
 	}
 
+	host_processor_filtered_invalidate_verification_cache (host);
+
 	host_state_manager_set_bypass_mode (host->state, true);
 	observable_notify_observers (&host->base.observable,
 		offsetof (struct host_processor_observer, on_bypass_mode));
@@ -333,6 +461,8 @@ void host_processor_filtered_swap_flash (struct host_processor_filtered *host,
 	int log_status = 0;
 	uint32_t retries = 0;
 
+	host_processor_filtered_invalidate_verification_cache (host);
+
 	do {
 		retries++;
 		status = host->flash->swap_flash_devices (host->flash, (!no_migrate) ? rw_list : NULL, pfm);
@@ -428,6 +558,8 @@ int host_processor_filtered_restore_read_write_data (struct host_processor_filte
  * the PFM.
  * @param single Flag indicating if only a single validation should be run against the PFM, or if
  * both flashes should be checked.
+ * @param allow_cache Flag indicating if a cached verification result can be used for the read-only
+ * flash.
  * @param config_fail Output flag indicating the error was not during validation.
  *
  * @return 0 if the flash was successfully validated or an error code.
@@ -435,7 +567,7 @@ int host_processor_filtered_restore_read_write_data (struct host_processor_filte
 static int host_processor_filtered_validate_flash (struct host_processor_filtered *host,
 	struct hash_engine *hash, struct rsa_engine *rsa, struct pfm *pfm, struct pfm *active,
 	bool is_pending, bool is_bypass, bool skip_ro, bool skip_ro_config, bool apply_filter_cfg,
-	bool is_validated, bool single, bool *config_fail)
+	bool is_validated, bool single, bool allow_cache, bool *config_fail)
 {
 	struct host_flash_manager_rw_regions rw_list;
 	int status = HOST_PROCESSOR_RW_SKIPPED;
@@ -443,6 +575,8 @@ static int host_processor_filtered_validate_flash (struct host_processor_filtere
 	bool checked_rw = true;
 	bool failed_rw = false;
 	bool pfm_dirty = host_state_manager_is_pfm_dirty (host->state);
+	bool ro_cached =
+		host_processor_filtered_check_flash_unmodified (host, is_bypass, allow_cache);
 
 	if (!is_bypass && host_state_manager_is_inactive_dirty (host->state)) {
 		if (!is_validated) {
@@ -538,8 +672,15 @@ static int host_processor_filtered_validate_flash (struct host_processor_filtere
 
 	if (!skip_ro && (status != 0) && (!is_pending || is_bypass || pfm_dirty) &&
 		(!single || !checked_rw)) {
-		status = host->flash->validate_read_only_flash (host->flash, pfm, active, hash, rsa,
-			is_bypass, &rw_list);
+		if (ro_cached) {
+			status = host_processor_filtered_get_cached_verification (host, hash, pfm, &rw_list);
+			ro_cached = (status == 0);
+		}
+
+		if (!ro_cached) {
+			status = host->flash->validate_read_only_flash (host->flash, pfm, active, hash, rsa,
+				is_bypass, &rw_list);
+		}
 
 		if (is_pending) {
 			debug_log_create_entry (
@@ -575,6 +716,10 @@ static int host_processor_filtered_validate_flash (struct host_processor_filtere
 
 				observable_notify_observers (&host->base.observable,
 					offsetof (struct host_processor_observer, on_active_mode));
+
+				if (host->verify_cache && !ro_cached) {
+					host_processor_filtered_save_verification (host, hash, pfm);
+				}
 			}
 
 			host->flash->free_read_write_regions (host->flash, &rw_list);
@@ -677,6 +822,8 @@ int host_processor_filtered_power_on_reset (struct host_processor_filtered *host
 	host_state_manager_set_pfm_dirty (host->state, true);
 	host_state_manager_set_bypass_mode (host->state, false);
 
+	/* Initial flash access resets the SPI filter, so the filter state can't indicate whether flash
+	 * was modified.  Never use a cached verification result for power-on validation. */
 	status = host_processor_filtered_initial_rot_flash_access (host);
 	if (status != 0) {
 		goto exit_host;
@@ -708,7 +855,7 @@ int host_processor_filtered_power_on_reset (struct host_processor_filtered *host
 		 * the flash and the PFM don't match. */
 		if (pending_pfm) {
 			status = host_processor_filtered_validate_flash (host, hash, rsa, pending_pfm, NULL,
-				true, false, false, false, true, false, single, NULL);
+				true, false, false, false, true, false, single, false, NULL);
 		}
 		else if (status == 0) {
 			host_state_manager_set_pfm_dirty (host->state, false);
@@ -716,7 +863,7 @@ int host_processor_filtered_power_on_reset (struct host_processor_filtered *host
 
 		if (!pending_pfm || (status != 0)) {
 			status = host_processor_filtered_validate_flash (host, hash, rsa, active_pfm, NULL,
-				false, false, false, false, true, false, single, NULL);
+				false, false, false, false, true, false, single, false, NULL);
 			if (status != 0) {
 				goto exit;
 			}
@@ -727,7 +874,7 @@ int host_processor_filtered_power_on_reset (struct host_processor_filtered *host
 		 * before it becomes the active PFM.  If validation fails with no active PFM available,
 		 * revert to bypass mode.  Without an active PFM, dirty flash is meaningless. */
 		status = host_processor_filtered_validate_flash (host, hash, rsa, pending_pfm, NULL, true,
-			true, false, false, true, false, single, NULL);
+			true, false, false, true, false, single, false, NULL);
 		if (status != 0) {
 			if (!IS_VALIDATION_FAILURE (status)) {
 				goto exit;
@@ -876,7 +1023,7 @@ int host_processor_filtered_update_verification (struct host_processor_filtered
 				only_validated = prevalidated;
 				status = host_processor_filtered_validate_flash (host, hash, rsa, pending_pfm,
 					bypass ? NULL : active_pfm, true, bypass, only_validated, true, true,
-					prevalidated, single, NULL);
+					prevalidated, single, true, NULL);
 			}
 		}
 		else if (status == 0) {
@@ -893,7 +1040,7 @@ int host_processor_filtered_update_verification (struct host_processor_filtered
 			}
 
 			status = host_processor_filtered_validate_flash (host, hash, rsa, active_pfm, NULL,
-				false, bypass, !bypass, true, true, prevalidated, single, NULL);
+				false, bypass, !bypass, true, true, prevalidated, single, true, NULL);
 		}
 		else if (!pending_pfm && !active_pfm) {
 			/* When there is no PFM available, ensure the system is running in bypass mode.  PFMs
@@ -1113,6 +1260,8 @@ int host_processor_filtered_apply_recovery_image (struct host_processor *host, b
 
 	ro_flash = filtered->flash->get_read_only_flash (filtered->flash);
 
+	host_processor_filtered_invalidate_verification_cache (filtered);
+
 	/* Trigger the notification as soon as the flash is modified for the recovery image. */
 	observable_notify_observers (&filtered->base.observable,
 		offsetof (struct host_processor_observer, on_recovery));
@@ -9,6 +9,7 @@
 #include "host_control.h"
 #include "host_flash_manager.h"
 #include "host_state_manager.h"
+#include "host_flash_verification_cache.h"
 #include "spi_filter/spi_filter_interface.h"
 #include "manifest/pfm/pfm_manager.h"
 #include "recovery/recovery_image_manager.h"
@@ -29,6 +30,7 @@ struct host_processor_filtered {
 	struct spi_filter_interface *filter;		/**< The SPI filter connected to host flash devices. */
 	struct pfm_manager *pfm;					/**< The manager for host processor PFMs. */
 	struct recovery_image_manager *recovery;	/**< The manager for recovery of the host processor. */
+	struct host_flash_verification_cache *verify_cache;	/**< Cache of read-only flash verification. */
 	int reset_pulse;							/**< The length of the reset pulse for the host. */
 	platform_mutex lock;						/**< Synchronization for verification routines. */
 
@@ -48,6 +50,10 @@ struct host_processor_filtered {
 };
 
 
+void host_processor_filtered_set_verification_cache (struct host_processor_filtered *host,
+	struct host_flash_verification_cache *cache);
+
+
 /* Internal functions for use by derived types. */
 int host_processor_filtered_init (struct host_processor_filtered *host,
 	struct host_control *control, struct host_flash_manager *flash,
@@ -142,12 +142,13 @@ static void cfm_flash_free_component_device (struct cfm *cfm,
 	struct cfm_component_device *component)
 {
 	if (component != NULL) {
-		platform_free ((void*) component->type);
-		platform_free ((void*) component->pmr_id_list);
+		manifest_flash_free_query (component->type);
+		manifest_flash_free_query (component->pmr_id_list);
 	}
 }
 
-static int cfm_flash_get_pmr_id_list (struct cfm *cfm, uint8_t entry, uint8_t **pmr_list)
+static int cfm_flash_get_pmr_id_list (struct cfm *cfm, struct arena *arena, uint8_t entry,
+	uint8_t **pmr_list)
 {
 	struct cfm_flash *cfm_flash = (struct cfm_flash*) cfm;
 	struct cfm_pmr_digest_element pmr_digest_element;
@@ -163,7 +164,7 @@ static int cfm_flash_get_pmr_id_list (struct cfm *cfm, uint8_t entry, uint8_t **
 		return num_pmr_digest;
 	}
 
-	*pmr_list = platform_malloc (sizeof (uint8_t) * num_pmr_digest);
+	*pmr_list = manifest_flash_alloc_query (arena, sizeof (uint8_t) * num_pmr_digest);
 	if (*pmr_list == NULL) {
 		return CFM_NO_MEMORY;
 	}
@@ -189,14 +190,24 @@ static int cfm_flash_get_pmr_id_list (struct cfm *cfm, uint8_t entry, uint8_t **
 	return num_pmr_digest;
 
 fail:
-	platform_free (*pmr_list);
+	manifest_flash_free_query (*pmr_list);
 	*pmr_list = NULL;
 
 	return status;
 }
 
-static int cfm_flash_get_component_device (struct cfm *cfm, const char *component_type,
-	struct cfm_component_device *component)
+/**
+ * Find component device for the specified component type.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the component device data from.  Null to use the heap.
+ * @param component_type The component type to find.
+ * @param component Output for the component device data.
+ *
+ * @return 0 if the component device was found or an error code.
+ */
+static int cfm_flash_query_component_device (struct cfm *cfm, struct arena *arena,
+	const char *component_type, struct cfm_component_device *component)
 {
 	struct cfm_component_device_element component_element;
 	uint8_t entry = 0;
@@ -212,14 +223,15 @@ static int cfm_flash_get_component_device (struct cfm *cfm, const char *componen
 		component->attestation_protocol = component_element.attestation_protocol;
 		component->cert_slot = component_element.cert_slot;
 
-		component->type = strdup ((char*) component_element.type);
+		component->type = manifest_flash_strdup_query (arena, (char*) component_element.type);
 		if (component->type == NULL) {
 			return CFM_NO_MEMORY;
 		}
 
-		status = cfm_flash_get_pmr_id_list (cfm, entry, (uint8_t**) &component->pmr_id_list);
+		status = cfm_flash_get_pmr_id_list (cfm, arena, entry,
+			(uint8_t**) &component->pmr_id_list);
 		if (ROT_IS_ERROR (status)) {
-			platform_free ((void*) component->type);
+			manifest_flash_free_query (component->type);
 			return status;
 		}
 
@@ -231,6 +243,34 @@ static int cfm_flash_get_component_device (struct cfm *cfm, const char *componen
 	return status;
 }
 
+static int cfm_flash_get_component_device (struct cfm *cfm, const char *component_type,
+	struct cfm_component_device *component)
+{
+	return cfm_flash_query_component_device (cfm, NULL, component_type, component);
+}
+
+/**
+ * Find component device for the specified component type, allocating the result from an arena
+ * instead of the heap.  If the arena runs out of space, the heap is used for the remaining
+ * allocations.
+ *
+ * The result must still be freed with free_component_device.  This only releases memory allocated
+ * from the heap, so memory from the arena is reclaimed by resetting the arena once the result has
+ * been freed.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the result from.  Null to allocate from the heap.
+ * @param component_type The component type to find.
+ * @param component Output for the component device data.
+ *
+ * @return 0 if the component device was found or an error code.
+ */
+int cfm_flash_get_component_device_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_component_device *component)
+{
+	return cfm_flash_query_component_device ((struct cfm*) cfm, arena, component_type, component);
+}
+
 static int cfm_flash_buffer_supported_components (struct cfm *cfm, size_t offset, size_t length,
 	uint8_t *components)
 {
@@ -412,7 +452,7 @@ static int cfm_flash_get_component_pmr (struct cfm *cfm, const char *component_t
  */
 static void cfm_flash_free_cfm_digests (struct cfm *cfm, struct cfm_digests *digests)
 {
-	platform_free ((void*) digests->digests);
+	manifest_flash_free_query (digests->digests);
 }
 
 /**
@@ -420,6 +460,7 @@ static void cfm_flash_free_cfm_digests (struct cfm *cfm, struct cfm_digests *dig
  * generating a cfm_digests container with the output.
  *
  * @param cfm The CFM to query.
+ * @param arena The arena to allocate the digests from.  Null to allocate from the heap.
  * @param digests The cfm_digests container to fill up.
  * @param digest_count The number of digests to read.
  * @param hash_type The type of digests to read.
@@ -429,8 +470,9 @@ static void cfm_flash_free_cfm_digests (struct cfm *cfm, struct cfm_digests *dig
  *
  * @return 0 if the container was generated successfully or an error code.
  */
-static int cfm_flash_populate_digests (struct cfm *cfm, struct cfm_digests *digests,
-	size_t digest_count, enum hash_type hash_type, uint8_t element_type, int entry, uint32_t offset)
+static int cfm_flash_populate_digests (struct cfm *cfm, struct arena *arena,
+	struct cfm_digests *digests, size_t digest_count, enum hash_type hash_type,
+	uint8_t element_type, int entry, uint32_t offset)
 {
 	struct cfm_flash *cfm_flash = (struct cfm_flash*) cfm;
 	size_t digests_len;
@@ -444,7 +486,7 @@ static int cfm_flash_populate_digests (struct cfm *cfm, struct cfm_digests *dige
 
 	digests_len = hash_len * digest_count;
 
-	digests->digests = platform_malloc (digests_len);
+	digests->digests = manifest_flash_alloc_query (arena, digests_len);
 	if (digests->digests == NULL) {
 		return CFM_NO_MEMORY;
 	}
@@ -475,8 +517,19 @@ static void cfm_flash_free_component_pmr_digest (struct cfm *cfm, struct cfm_pmr
 	}
 }
 
-static int cfm_flash_get_component_pmr_digest (struct cfm *cfm, const char *component_type,
-	uint8_t pmr_id, struct cfm_pmr_digest *pmr_digest)
+/**
+ * Get component PMR digest container for provided component type and PMR ID.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the PMR digests from.  Null to allocate from the heap.
+ * @param component_type The component type to query.
+ * @param pmr_id The PMR ID to query.
+ * @param pmr_digest A container to be updated with the component PMR digest information.
+ *
+ * @return 0 if the component PMR digest was retrieved successfully or an error code.
+ */
+static int cfm_flash_query_component_pmr_digest (struct cfm *cfm, struct arena *arena,
+	const char *component_type, uint8_t pmr_id, struct cfm_pmr_digest *pmr_digest)
 {
 	struct cfm_pmr_digest_element pmr_digest_element;
 	struct cfm_pmr_digest_element *pmr_digest_element_ptr = &pmr_digest_element;
@@ -504,13 +557,43 @@ static int cfm_flash_get_component_pmr_digest (struct cfm *cfm, const char *comp
 		if (pmr_digest_element.pmr_id == pmr_id) {
 			pmr_digest->pmr_id = pmr_digest_element.pmr_id;
 
-			return cfm_flash_populate_digests (cfm, &pmr_digest->digests,
+			return cfm_flash_populate_digests (cfm, arena, &pmr_digest->digests,
 				pmr_digest_element.digest_count, pmr_digest_element.pmr_hash_type, CFM_PMR_DIGEST,
 				entry - 1, sizeof (struct cfm_pmr_digest_element));
 		}
 	}
 }
 
+static int cfm_flash_get_component_pmr_digest (struct cfm *cfm, const char *component_type,
+	uint8_t pmr_id, struct cfm_pmr_digest *pmr_digest)
+{
+	return cfm_flash_query_component_pmr_digest (cfm, NULL, component_type, pmr_id, pmr_digest);
+}
+
+/**
+ * Get component PMR digest container for provided component type and PMR ID, allocating the result
+ * from an arena instead of the heap.  If the arena runs out of space, the heap is used for the
+ * remaining allocations.
+ *
+ * The result must still be freed with free_component_pmr_digest.  This only releases memory
+ * allocated from the heap, so memory from the arena is reclaimed by resetting the arena once the
+ * result has been freed.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the result from.  Null to allocate from the heap.
+ * @param component_type The component type to query.
+ * @param pmr_id The PMR ID to query.
+ * @param pmr_digest A container to be updated with the component PMR digest information.
+ *
+ * @return 0 if the component PMR digest was retrieved successfully or an error code.
+ */
+int cfm_flash_get_component_pmr_digest_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, uint8_t pmr_id, struct cfm_pmr_digest *pmr_digest)
+{
+	return cfm_flash_query_component_pmr_digest ((struct cfm*) cfm, arena, component_type, pmr_id,
+		pmr_digest);
+}
+
 static void cfm_flash_free_measurement (struct cfm *cfm, struct cfm_measurement *pmr_measurement)
 {
 	if (pmr_measurement != NULL) {
@@ -518,8 +601,19 @@ static void cfm_flash_free_measurement (struct cfm *cfm, struct cfm_measurement
 	}
 }
 
-static int cfm_flash_get_next_measurement (struct cfm *cfm, const char *component_type,
-	struct cfm_measurement *pmr_measurement, bool first)
+/**
+ * Find next measurement for the specified component type.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the measurement digests from.  Null to use the heap.
+ * @param component_type The component type to find a measurement for.
+ * @param pmr_measurement A container to be updated with the component measurement information.
+ * @param first Fetch first PMR measurement from CFM, or next PMR measurement since last call.
+ *
+ * @return 0 if the measurement was found or an error code.
+ */
+static int cfm_flash_query_next_measurement (struct cfm *cfm, struct arena *arena,
+	const char *component_type, struct cfm_measurement *pmr_measurement, bool first)
 {
 	struct cfm_measurement_element measurement_element;
 	struct cfm_measurement_element *measurement_element_ptr = &measurement_element;
@@ -550,11 +644,41 @@ static int cfm_flash_get_next_measurement (struct cfm *cfm, const char *componen
 	pmr_measurement->pmr_id = measurement_element.pmr_id;
 	pmr_measurement->measurement_id = measurement_element.measurement_id;
 
-	return cfm_flash_populate_digests (cfm, &pmr_measurement->digests,
+	return cfm_flash_populate_digests (cfm, arena, &pmr_measurement->digests,
 		measurement_element.digest_count, measurement_element.hash_type, CFM_MEASUREMENT,
 		*element_entry_ptr - 1, sizeof (struct cfm_measurement_element));
 }
 
+static int cfm_flash_get_next_measurement (struct cfm *cfm, const char *component_type,
+	struct cfm_measurement *pmr_measurement, bool first)
+{
+	return cfm_flash_query_next_measurement (cfm, NULL, component_type, pmr_measurement, first);
+}
+
+/**
+ * Find next measurement for the specified component type, allocating the result from an arena
+ * instead of the heap.  If the arena runs out of space, the heap is used for the remaining
+ * allocations.
+ *
+ * The result must still be freed with free_measurement.  This only releases memory allocated from
+ * the heap, so memory from the arena is reclaimed by resetting the arena once the result has been
+ * freed.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the result from.  Null to allocate from the heap.
+ * @param component_type The component type to find a measurement for.
+ * @param pmr_measurement A container to be updated with the component measurement information.
+ * @param first Fetch first PMR measurement from CFM, or next PMR measurement since last call.
+ *
+ * @return 0 if the measurement was found or an error code.
+ */
+int cfm_flash_get_next_measurement_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_measurement *pmr_measurement, bool first)
+{
+	return cfm_flash_query_next_measurement ((struct cfm*) cfm, arena, component_type,
+		pmr_measurement, first);
+}
+
 static void cfm_flash_free_measurement_data (struct cfm *cfm,
 	struct cfm_measurement_data *measurement_data)
 {
@@ -562,16 +686,28 @@ static void cfm_flash_free_measurement_data (struct cfm *cfm,
 
 	if (measurement_data != NULL) {
 		for (i_check = 0; i_check < measurement_data->check_count; ++i_check) {
-			platform_free ((void*) measurement_data->check[i_check].bitmask);
-			platform_free ((void*) measurement_data->check[i_check].allowable_data);
+			manifest_flash_free_query (measurement_data->check[i_check].bitmask);
+			manifest_flash_free_query (measurement_data->check[i_check].allowable_data);
 		}
 
-		platform_free (measurement_data->check);
+		manifest_flash_free_query (measurement_data->check);
 	}
 }
 
-static int cfm_flash_get_next_measurement_data (struct cfm *cfm, const char *component_type,
-	struct cfm_measurement_data *measurement_data, bool first)
+/**
+ * Find next measurement data for the specified component type.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the measurement data from.  Null to allocate from the heap.
+ * @param component_type The component type to find a measurement data for.
+ * @param measurement_data A container to be updated with the component measurement data
+ * 	information.
+ * @param first Fetch first measurement data from CFM, or next measurement data since last call.
+ *
+ * @return 0 if the measurement data was found or an error code.
+ */
+static int cfm_flash_query_next_measurement_data (struct cfm *cfm, struct arena *arena,
+	const char *component_type, struct cfm_measurement_data *measurement_data, bool first)
 {
 	struct cfm_flash *cfm_flash = (struct cfm_flash*) cfm;
 	struct cfm_measurement_data_element measurement_data_element;
@@ -622,8 +758,8 @@ static int cfm_flash_get_next_measurement_data (struct cfm *cfm, const char *com
 	}
 
 	measurement_data->check_count = num_allowable_data;
-	measurement_data->check =
-		platform_calloc (measurement_data->check_count, sizeof (struct cfm_allowable_data));
+	measurement_data->check = manifest_flash_calloc_query (arena, measurement_data->check_count,
+		sizeof (struct cfm_allowable_data));
 	if (measurement_data->check == NULL) {
 		return CFM_NO_MEMORY;
 	}
@@ -649,7 +785,8 @@ static int cfm_flash_get_next_measurement_data (struct cfm *cfm, const char *com
 		offset = sizeof (struct cfm_allowable_data_element);
 
 		if (allowable_data_element_ptr->bitmask_presence) {
-			allowable_data_ptr->bitmask = platform_malloc (allowable_data_ptr->data_len);
+			allowable_data_ptr->bitmask = manifest_flash_alloc_query (arena,
+				allowable_data_ptr->data_len);
 			if (allowable_data_ptr->bitmask == NULL) {
 				status = CFM_NO_MEMORY;
 				goto free_allowable_data;
@@ -668,7 +805,8 @@ static int cfm_flash_get_next_measurement_data (struct cfm *cfm, const char *com
 
 		allowable_data_len = allowable_data_ptr->data_len * allowable_data_ptr->data_count;
 
-		allowable_data_ptr->allowable_data = platform_malloc (allowable_data_len);
+		allowable_data_ptr->allowable_data = manifest_flash_alloc_query (arena,
+			allowable_data_len);
 		if (allowable_data_ptr->allowable_data == NULL) {
 			status = CFM_NO_MEMORY;
 			goto free_allowable_data;
@@ -693,6 +831,38 @@ free_allowable_data:
 	return status;
 }
 
+static int cfm_flash_get_next_measurement_data (struct cfm *cfm, const char *component_type,
+	struct cfm_measurement_data *measurement_data, bool first)
+{
+	return cfm_flash_query_next_measurement_data (cfm, NULL, component_type, measurement_data,
+		first);
+}
+
+/**
+ * Find next measurement data for the specified component type, allocating the result from an arena
+ * instead of the heap.  If the arena runs out of space, the heap is used for the remaining
+ * allocations.
+ *
+ * The result must still be freed with free_measurement_data.  This only releases memory allocated
+ * from the heap, so memory from the arena is reclaimed by resetting the arena once the result has
+ * been freed.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the result from.  Null to allocate from the heap.
+ * @param component_type The component type to find a measurement data for.
+ * @param measurement_data A container to be updated with the component measurement data
+ * 	information.
+ * @param first Fetch first measurement data from CFM, or next measurement data since last call.
+ *
+ * @return 0 if the measurement data was found or an error code.
+ */
+int cfm_flash_get_next_measurement_data_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_measurement_data *measurement_data, bool first)
+{
+	return cfm_flash_query_next_measurement_data ((struct cfm*) cfm, arena, component_type,
+		measurement_data, first);
+}
+
 static void cfm_flash_free_root_ca_digest (struct cfm *cfm,
 	struct cfm_root_ca_digests *root_ca_digest)
 {
@@ -701,8 +871,18 @@ static void cfm_flash_free_root_ca_digest (struct cfm *cfm,
 	}
 }
 
-static int cfm_flash_get_root_ca_digest (struct cfm *cfm, const char *component_type,
-	struct cfm_root_ca_digests *root_ca_digest)
+/**
+ * Find root CA digest for the specified component type.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the root CA digests from.  Null to allocate from the heap.
+ * @param component_type The component type to find root CA digest for.
+ * @param root_ca_digest A container to be updated with the component root CA digest information.
+ *
+ * @return 0 if the root CA digest was found or an error code.
+ */
+static int cfm_flash_query_root_ca_digest (struct cfm *cfm, struct arena *arena,
+	const char *component_type, struct cfm_root_ca_digests *root_ca_digest)
 {
 	struct cfm_root_ca_digests_element root_ca_digests_element;
 	struct cfm_root_ca_digests_element *root_ca_digests_element_ptr = &root_ca_digests_element;
@@ -724,22 +904,50 @@ static int cfm_flash_get_root_ca_digest (struct cfm *cfm, const char *component_
 		return status;
 	}
 
-	return cfm_flash_populate_digests (cfm, &root_ca_digest->digests,
+	return cfm_flash_populate_digests (cfm, arena, &root_ca_digest->digests,
 		root_ca_digests_element.ca_count, root_ca_digests_element.hash_type, CFM_ROOT_CA, entry - 1,
 		sizeof (struct cfm_root_ca_digests_element));
 }
 
+static int cfm_flash_get_root_ca_digest (struct cfm *cfm, const char *component_type,
+	struct cfm_root_ca_digests *root_ca_digest)
+{
+	return cfm_flash_query_root_ca_digest (cfm, NULL, component_type, root_ca_digest);
+}
+
+/**
+ * Find root CA digest for the specified component type, allocating the result from an arena instead
+ * of the heap.  If the arena runs out of space, the heap is used for the remaining allocations.
+ *
+ * The result must still be freed with free_root_ca_digest.  This only releases memory allocated
+ * from the heap, so memory from the arena is reclaimed by resetting the arena once the result has
+ * been freed.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the result from.  Null to allocate from the heap.
+ * @param component_type The component type to find root CA digest for.
+ * @param root_ca_digest A container to be updated with the component root CA digest information.
+ *
+ * @return 0 if the root CA digest was found or an error code.
+ */
+int cfm_flash_get_root_ca_digest_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_root_ca_digests *root_ca_digest)
+{
+	return cfm_flash_query_root_ca_digest ((struct cfm*) cfm, arena, component_type,
+		root_ca_digest);
+}
+
 static void cfm_flash_free_manifest (struct cfm *cfm, struct cfm_manifest *manifest)
 {
 	uint8_t i_check;
 
 	if (manifest != NULL) {
 		for (i_check = 0; i_check < manifest->check_count; ++i_check) {
-			platform_free ((void*) manifest->check[i_check].allowable_id);
+			manifest_flash_free_query (manifest->check[i_check].allowable_id);
 		}
 
-		platform_free (manifest->check);
-		platform_free ((void*) manifest->platform_id);
+		manifest_flash_free_query (manifest->check);
+		manifest_flash_free_query (manifest->platform_id);
 	}
 }
 
@@ -747,6 +955,7 @@ static void cfm_flash_free_manifest (struct cfm *cfm, struct cfm_manifest *manif
  * Common function used to find next allowable manifest element for the specified component type.
  *
  * @param cfm The CFM to query.
+ * @param arena The arena to allocate the manifest information from.  Null to use the heap.
  * @param component_type The component type to find allowable manifest for.
  * @param manifest_type The manifest type to find.
  * @param allowable_manifest A container to be updated with the component allowable manifest
@@ -756,8 +965,8 @@ static void cfm_flash_free_manifest (struct cfm *cfm, struct cfm_manifest *manif
  *
  * @return 0 if the allowable manifest element was found or an error code.
  */
-int cfm_flash_get_next_manifest (struct cfm *cfm, const char *component_type, int manifest_type,
-	struct cfm_manifest *allowable_manifest, bool first)
+int cfm_flash_get_next_manifest (struct cfm *cfm, struct arena *arena, const char *component_type,
+	int manifest_type, struct cfm_manifest *allowable_manifest, bool first)
 {
 	struct cfm_flash *cfm_flash = (struct cfm_flash*) cfm;
 	struct cfm_allowable_pfm_element allowable_pfm_element;
@@ -799,7 +1008,8 @@ int cfm_flash_get_next_manifest (struct cfm *cfm, const char *component_type, in
 
 	allowable_pfm_element.manifest.platform_id[allowable_pfm_element.manifest.platform_id_len] =
 		'\0';
-	allowable_manifest->platform_id = strdup ((char*) allowable_pfm_element.manifest.platform_id);
+	allowable_manifest->platform_id = manifest_flash_strdup_query (arena,
+		(char*) allowable_pfm_element.manifest.platform_id);
 	if (allowable_manifest->platform_id == NULL) {
 		return CFM_NO_MEMORY;
 	}
@@ -813,8 +1023,8 @@ int cfm_flash_get_next_manifest (struct cfm *cfm, const char *component_type, in
 	}
 
 	allowable_manifest->check_count = num_allowable_id;
-	allowable_manifest->check = platform_calloc (allowable_manifest->check_count,
-		sizeof (struct cfm_allowable_id));
+	allowable_manifest->check = manifest_flash_calloc_query (arena,
+		allowable_manifest->check_count, sizeof (struct cfm_allowable_id));
 	if (allowable_manifest->check == NULL) {
 		status = CFM_NO_MEMORY;
 		goto free_manifest;
@@ -841,7 +1051,7 @@ int cfm_flash_get_next_manifest (struct cfm *cfm, const char *component_type, in
 
 		ids_len = allowable_id_ptr->id_count * sizeof (uint32_t);
 
-		allowable_id_ptr->allowable_id = platform_malloc (ids_len);
+		allowable_id_ptr->allowable_id = manifest_flash_alloc_query (arena, ids_len);
 		if (allowable_id_ptr->allowable_id == NULL) {
 			status = CFM_NO_MEMORY;
 			goto free_manifest;
@@ -868,22 +1078,92 @@ free_manifest:
 int cfm_flash_get_next_pfm (struct cfm *cfm, const char *component_type,
 	struct cfm_manifest *allowable_pfm, bool first)
 {
-	return cfm_flash_get_next_manifest (cfm, component_type, CFM_ALLOWABLE_PFM, allowable_pfm,
+	return cfm_flash_get_next_manifest (cfm, NULL, component_type, CFM_ALLOWABLE_PFM, allowable_pfm,
 		first);
 }
 
 int cfm_flash_get_next_cfm (struct cfm *cfm, const char *component_type,
 	struct cfm_manifest *allowable_cfm, bool first)
 {
-	return cfm_flash_get_next_manifest (cfm, component_type, CFM_ALLOWABLE_CFM, allowable_cfm,
+	return cfm_flash_get_next_manifest (cfm, NULL, component_type, CFM_ALLOWABLE_CFM, allowable_cfm,
 		first);
 }
 
 int cfm_flash_get_pcd (struct cfm *cfm, const char *component_type,
 	struct cfm_manifest *allowable_pcd)
 {
-	return cfm_flash_get_next_manifest (cfm, component_type, CFM_ALLOWABLE_PCD, allowable_pcd,
-		true);
+	return cfm_flash_get_next_manifest (cfm, NULL, component_type, CFM_ALLOWABLE_PCD,
+		allowable_pcd, true);
+}
+
+/**
+ * Find next allowable PFM for the specified component type, allocating the result from an arena
+ * instead of the heap.  If the arena runs out of space, the heap is used for the remaining
+ * allocations.
+ *
+ * The result must still be freed with free_manifest.  This only releases memory allocated from the
+ * heap, so memory from the arena is reclaimed by resetting the arena once the result has been
+ * freed.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the result from.  Null to allocate from the heap.
+ * @param component_type The component type to find allowable PFM for.
+ * @param allowable_pfm A container to be updated with the component allowable PFM information.
+ * @param first Fetch first allowable PFM from CFM, or next allowable PFM since last call.
+ *
+ * @return 0 if the allowable PFM was found or an error code.
+ */
+int cfm_flash_get_next_pfm_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_manifest *allowable_pfm, bool first)
+{
+	return cfm_flash_get_next_manifest ((struct cfm*) cfm, arena, component_type,
+		CFM_ALLOWABLE_PFM, allowable_pfm, first);
+}
+
+/**
+ * Find next allowable CFM for the specified component type, allocating the result from an arena
+ * instead of the heap.  If the arena runs out of space, the heap is used for the remaining
+ * allocations.
+ *
+ * The result must still be freed with free_manifest.  This only releases memory allocated from the
+ * heap, so memory from the arena is reclaimed by resetting the arena once the result has been
+ * freed.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the result from.  Null to allocate from the heap.
+ * @param component_type The component type to find allowable CFM for.
+ * @param allowable_cfm A container to be updated with the component allowable CFM information.
+ * @param first Fetch first allowable CFM from CFM, or next allowable CFM since last call.
+ *
+ * @return 0 if the allowable CFM was found or an error code.
+ */
+int cfm_flash_get_next_cfm_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_manifest *allowable_cfm, bool first)
+{
+	return cfm_flash_get_next_manifest ((struct cfm*) cfm, arena, component_type,
+		CFM_ALLOWABLE_CFM, allowable_cfm, first);
+}
+
+/**
+ * Find allowable PCD for the specified component type, allocating the result from an arena instead
+ * of the heap.  If the arena runs out of space, the heap is used for the remaining allocations.
+ *
+ * The result must still be freed with free_manifest.  This only releases memory allocated from the
+ * heap, so memory from the arena is reclaimed by resetting the arena once the result has been
+ * freed.
+ *
+ * @param cfm The CFM to query.
+ * @param arena The arena to allocate the result from.  Null to allocate from the heap.
+ * @param component_type The component type to find allowable PCD for.
+ * @param allowable_pcd A container to be updated with the component allowable PCD information.
+ *
+ * @return 0 if the allowable PCD was found or an error code.
+ */
+int cfm_flash_get_pcd_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_manifest *allowable_pcd)
+{
+	return cfm_flash_get_next_manifest ((struct cfm*) cfm, arena, component_type,
+		CFM_ALLOWABLE_PCD, allowable_pcd, true);
 }
 
 /**
@@ -899,12 +1179,16 @@ int cfm_flash_get_pcd (struct cfm *cfm, const char *component_type,
  * @param max_signature The maximum supported length for a manifest signature.
  * @param platform_id_cache Buffer to hold the manifest platform ID.
  * @param max_platform_id The maximum platform ID length supported, including the NULL terminator.
+ * @param toc_cache Optional buffer to hold the verified table of contents.  This should be static
+ * storage that lives as long as the CFM instance.  Null to validate every element access from
+ * flash.
+ * @param max_toc_cache The size of the table of contents cache buffer.
  *
  * @return 0 if the CFM instance was initialized successfully or an error code.
  */
 int cfm_flash_init (struct cfm_flash *cfm, struct flash *flash, struct hash_engine *hash,
 	uint32_t base_addr, uint8_t *signature_cache, size_t max_signature, uint8_t *platform_id_cache,
-	size_t max_platform_id)
+	size_t max_platform_id, uint8_t *toc_cache, size_t max_toc_cache)
 {
 	int status;
 
@@ -920,6 +1204,8 @@ int cfm_flash_init (struct cfm_flash *cfm, struct flash *flash, struct hash_engi
 		return status;
 	}
 
+	manifest_flash_enable_toc_cache (&cfm->base_flash, toc_cache, max_toc_cache);
+
 	cfm->base.base.verify = cfm_flash_verify;
 	cfm->base.base.get_id = cfm_flash_get_id;
 	cfm->base.base.get_platform_id = cfm_flash_get_platform_id;
@@ -21,8 +21,25 @@ struct cfm_flash {
 
 int cfm_flash_init (struct cfm_flash *cfm, struct flash *flash, struct hash_engine *hash,
 	uint32_t base_addr, uint8_t *signature_cache, size_t max_signature, uint8_t *platform_id_cache,
-	size_t max_platform_id);
+	size_t max_platform_id, uint8_t *toc_cache, size_t max_toc_cache);
 void cfm_flash_release (struct cfm_flash *cfm);
 
+int cfm_flash_get_component_device_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_component_device *component);
+int cfm_flash_get_component_pmr_digest_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, uint8_t pmr_id, struct cfm_pmr_digest *pmr_digest);
+int cfm_flash_get_next_measurement_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_measurement *pmr_measurement, bool first);
+int cfm_flash_get_next_measurement_data_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_measurement_data *measurement_data, bool first);
+int cfm_flash_get_root_ca_digest_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_root_ca_digests *root_ca_digest);
+int cfm_flash_get_next_pfm_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_manifest *allowable_pfm, bool first);
+int cfm_flash_get_next_cfm_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_manifest *allowable_cfm, bool first);
+int cfm_flash_get_pcd_arena (struct cfm_flash *cfm, struct arena *arena,
+	const char *component_type, struct cfm_manifest *allowable_pcd);
+
 
 #endif //CFM_FLASH_H
@@ -114,6 +114,199 @@ void manifest_flash_release (struct manifest_flash *manifest)
 	}
 }
 
+/**
+ * Provide a buffer that will hold a RAM copy of the table of contents for a version 2 manifest.
+ * The table of contents entries and element hashes will be loaded into this buffer during manifest
+ * verification and used to locate elements without needing to read and validate the table of
+ * contents from flash for each request.
+ *
+ * If the table of contents for a manifest is larger than the buffer, the cache will not be used and
+ * all element accesses will be validated directly from flash.
+ *
+ * The cache will not be populated until the next time the manifest is verified.
+ *
+ * @param manifest The manifest to update.
+ * @param toc_cache The buffer to use for the table of contents cache.  Providing a null buffer will
+ * disable caching.
+ * @param max_toc_cache The size of the cache buffer.  MANIFEST_FLASH_TOC_CACHE_MAX_SIZE is large
+ * enough to cache any table of contents.
+ *
+ * @return 0 if the cache was configured successfully or an error code.
+ */
+int manifest_flash_enable_toc_cache (struct manifest_flash *manifest, uint8_t *toc_cache,
+	size_t max_toc_cache)
+{
+	if (manifest == NULL) {
+		return MANIFEST_INVALID_ARGUMENT;
+	}
+
+	manifest->toc_cache_valid = false;
+	manifest->toc_cache = toc_cache;
+	manifest->max_toc_cache = (toc_cache != NULL) ? max_toc_cache : 0;
+
+	return 0;
+}
+
+/**
+ * Provide the hash of the manifest data that should be used for the next verification.  This would
+ * be a hash calculated as the manifest was being written to flash, allowing verification to check
+ * the signature without reading the entire manifest back from flash.  Elements needed to parse the
+ * manifest will still be read during verification.
+ *
+ * Since the manifest data will not be read back, the hash must only cover data that has been
+ * confirmed to be stored in flash, such as by reading back each block of data after it was written.
+ *
+ * The hash is only used for the next verification attempt.  If the length of the hash doesn't match
+ * the signature type indicated in the manifest header, the hash will be ignored and the manifest
+ * will be hashed from flash.
+ *
+ * @param manifest The manifest to update.
+ * @param digest The hash of the manifest data, excluding the signature.  Providing a null hash will
+ * clear any previously provided hash.
+ * @param length The length of the manifest hash.
+ *
+ * @return 0 if the hash was saved successfully or an error code.
+ */
+int manifest_flash_set_verification_hash (struct manifest_flash *manifest, const uint8_t *digest,
+	size_t length)
+{
+	if (manifest == NULL) {
+		return MANIFEST_INVALID_ARGUMENT;
+	}
+
+	if (digest == NULL) {
+		manifest->precomputed_hash_length = 0;
+		return 0;
+	}
+
+	if ((length == 0) || (length > sizeof (manifest->hash_cache))) {
+		return MANIFEST_INVALID_ARGUMENT;
+	}
+
+	manifest->cache_valid = false;
+	memcpy (manifest->hash_cache, digest, length);
+	manifest->precomputed_hash_length = length;
+
+	return 0;
+}
+
+/**
+ * Header stored before each block of memory allocated for a query result.  It records where the
+ * memory came from, so the block can be freed without knowing how the query was made.
+ */
+union manifest_flash_query_block {
+	bool heap;									/**< Flag indicating the block is on the heap. */
+	uint8_t align[ARENA_ALIGNMENT];				/**< Keep the query memory aligned. */
+};
+
+/**
+ * Allocate memory for a query result.  If an arena is provided, the memory will be allocated from
+ * the arena.  If there is no arena or the arena doesn't have enough space left, it will be
+ * allocated from the heap.
+ *
+ * @param arena The arena to allocate from.  Null to allocate from the heap.
+ * @param size The number of bytes to allocate.
+ *
+ * @return The allocated memory or null if the allocation failed.  The memory must be released
+ * with manifest_flash_free_query.
+ */
+void* manifest_flash_alloc_query (struct arena *arena, size_t size)
+{
+	union manifest_flash_query_block *block = NULL;
+
+	if (size > (SIZE_MAX - sizeof (*block))) {
+		return NULL;
+	}
+
+	if (arena != NULL) {
+		block = arena_alloc (arena, sizeof (*block) + size);
+	}
+
+	if (block != NULL) {
+		block->heap = false;
+	}
+	else {
+		block = platform_malloc (sizeof (*block) + size);
+		if (block == NULL) {
+			return NULL;
+		}
+
+		block->heap = true;
+	}
+
+	return &block[1];
+}
+
+/**
+ * Allocate zeroed memory for an array in a query result.  If an arena is provided, the memory will
+ * be allocated from the arena.  If there is no arena or the arena doesn't have enough space left,
+ * it will be allocated from the heap.
+ *
+ * @param arena The arena to allocate from.  Null to allocate from the heap.
+ * @param count The number of elements in the array.
+ * @param size The size of each element.
+ *
+ * @return The allocated memory or null if the allocation failed.  The memory must be released
+ * with manifest_flash_free_query.
+ */
+void* manifest_flash_calloc_query (struct arena *arena, size_t count, size_t size)
+{
+	void *mem;
+
+	if ((size != 0) && (count > (SIZE_MAX / size))) {
+		return NULL;
+	}
+
+	mem = manifest_flash_alloc_query (arena, count * size);
+	if (mem != NULL) {
+		memset (mem, 0, count * size);
+	}
+
+	return mem;
+}
+
+/**
+ * Copy a string for a query result.  If an arena is provided, the memory will be allocated from
+ * the arena.  If there is no arena or the arena doesn't have enough space left, it will be
+ * allocated from the heap.
+ *
+ * @param arena The arena to allocate from.  Null to allocate from the heap.
+ * @param str The string to copy.
+ *
+ * @return The copy of the string or null if the allocation failed.  The memory must be released
+ * with manifest_flash_free_query.
+ */
+char* manifest_flash_strdup_query (struct arena *arena, const char *str)
+{
+	size_t length = strlen (str) + 1;
+	char *copy;
+
+	copy = manifest_flash_alloc_query (arena, length);
+	if (copy != NULL) {
+		memcpy (copy, str, length);
+	}
+
+	return copy;
+}
+
+/**
+ * Free memory allocated for a query result.  Only memory that was allocated from the heap is
+ * released.  Memory allocated from an arena is reclaimed when the arena is reset.
+ *
+ * @param ptr The memory to free.  This can be null.
+ */
+void manifest_flash_free_query (const void *ptr)
+{
+	const union manifest_flash_query_block *block;
+
+	if (ptr != NULL) {
+		block = ((const union manifest_flash_query_block*) ptr) - 1;
+		if (block->heap) {
+			platform_free ((void*) block);
+		}
+	}
+}
+
 /**
  * Read the manifest header and run validity checking on the contents:
  * - Check the magic number.
@@ -158,18 +351,27 @@ int manifest_flash_read_header (struct manifest_flash *manifest, struct manifest
  * @param verification The module to use for signature verification.
  * @param sig_hash The type of hash used to generate the signature.
  * @param hash_out Optional output buffer for the manifest hash.
+ * @param precomputed Flag indicating the manifest hash has already been calculated and is in the
+ * hash cache.  The manifest contents will not be read from flash.
  *
  * @return 0 if the manifest is valid or an error code.
  */
 static int manifest_flash_verify_v1 (struct manifest_flash *manifest, struct hash_engine *hash,
-	struct signature_verification *verification, enum hash_type sig_hash, uint8_t *hash_out)
+	struct signature_verification *verification, enum hash_type sig_hash, uint8_t *hash_out,
+	bool precomputed)
 {
 	int status;
 
-	status = flash_contents_verification (manifest->flash, manifest->addr,
-		manifest->header.length - manifest->header.sig_length, hash, sig_hash, verification,
-		manifest->signature, manifest->header.sig_length, manifest->hash_cache,
-		sizeof (manifest->hash_cache));
+	if (precomputed) {
+		status = verification->verify_signature (verification, manifest->hash_cache,
+			manifest->hash_length, manifest->signature, manifest->header.sig_length);
+	}
+	else {
+		status = flash_contents_verification (manifest->flash, manifest->addr,
+			manifest->header.length - manifest->header.sig_length, hash, sig_hash, verification,
+			manifest->signature, manifest->header.sig_length, manifest->hash_cache,
+			sizeof (manifest->hash_cache));
+	}
 
 	if ((status == 0) || (status == RSA_ENGINE_BAD_SIGNATURE) ||
 		(status == ECC_ENGINE_BAD_SIGNATURE)) {
@@ -182,6 +384,39 @@ static int manifest_flash_verify_v1 (struct manifest_flash *manifest, struct has
 	return status;
 }
 
+/**
+ * Add data to the manifest hash calculated during verification.
+ *
+ * @param hash The hash engine calculating the manifest hash.  If this is null, the manifest hash is
+ * not being calculated and no data will be hashed.
+ * @param data The data to add to the hash.
+ * @param length The length of the data.
+ *
+ * @return 0 if the data was hashed successfully or an error code.
+ */
+static int manifest_flash_verify_hash_update (struct hash_engine *hash, const uint8_t *data,
+	size_t length)
+{
+	return (hash != NULL) ? hash->update (hash, data, length) : 0;
+}
+
+/**
+ * Add manifest data stored on flash to the manifest hash calculated during verification.
+ *
+ * @param manifest The manifest being verified.
+ * @param addr The flash address of the data to hash.
+ * @param length The number of bytes to hash.
+ * @param hash The hash engine calculating the manifest hash.  If this is null, the manifest hash is
+ * not being calculated and flash will not be read.
+ *
+ * @return 0 if the data was hashed successfully or an error code.
+ */
+static int manifest_flash_verify_hash_contents (struct manifest_flash *manifest, uint32_t addr,
+	size_t length, struct hash_engine *hash)
+{
+	return (hash != NULL) ? flash_hash_update_contents (manifest->flash, addr, length, hash) : 0;
+}
+
 /**
  * Validate the signature on a version 2 manifest.
  *
@@ -190,27 +425,35 @@ static int manifest_flash_verify_v1 (struct manifest_flash *manifest, struct has
  * @param verification The module to use for signature verification.
  * @param sig_hash The type of hash used to generate the signature.
  * @param hash_out Optional output buffer for the manifest hash.
+ * @param precomputed Flag indicating the manifest hash has already been calculated and is in the
+ * hash cache.  Manifest data will only be read from flash as needed to parse the manifest.
  *
  * @return 0 if the manifest is valid or an error code.
  */
 static int manifest_flash_verify_v2 (struct manifest_flash *manifest, struct hash_engine *hash,
-	struct signature_verification *verification, enum hash_type sig_hash, uint8_t *hash_out)
+	struct signature_verification *verification, enum hash_type sig_hash, uint8_t *hash_out,
+	bool precomputed)
 {
+	struct hash_engine *body_hash = (precomputed) ? NULL : hash;
 	struct manifest_toc_entry entry;
 	struct manifest_platform_id plat_id_header;
 	uint32_t next_addr;
 	uint32_t toc_end;
 	uint32_t sig_addr = manifest->addr + manifest->header.length - manifest->header.sig_length;
+	bool toc_cached = false;
 	int i;
 	int status;
 
 	/* Hash the header data that has already been read in. */
-	status = hash_start_new_hash (hash, sig_hash);
-	if (status != 0) {
-		return status;
+	if (body_hash != NULL) {
+		status = hash_start_new_hash (body_hash, sig_hash);
+		if (status != 0) {
+			return status;
+		}
 	}
 
-	status = hash->update (hash, (uint8_t*) &manifest->header, sizeof (manifest->header));
+	status = manifest_flash_verify_hash_update (body_hash, (uint8_t*) &manifest->header,
+		sizeof (manifest->header));
 	if (status != 0) {
 		goto error;
 	}
@@ -244,42 +487,77 @@ static int manifest_flash_verify_v2 (struct manifest_flash *manifest, struct has
 			goto error;
 	}
 
-	status = hash->update (hash, (uint8_t*) &manifest->toc_header, sizeof (manifest->toc_header));
+	status = manifest_flash_verify_hash_update (body_hash, (uint8_t*) &manifest->toc_header,
+		sizeof (manifest->toc_header));
 	if (status != 0) {
 		goto error;
 	}
 
-	/* Find the platform ID element, hashing each entry as it is read in. */
 	next_addr += sizeof (manifest->toc_header);
-	i = 0;
-	do {
-		status = manifest->flash->read (manifest->flash, next_addr, (uint8_t*) &entry,
-			sizeof (entry));
+	toc_end = manifest->addr + sizeof (manifest->header) + sizeof (manifest->toc_header) +
+		MANIFEST_FLASH_TOC_CACHE_SIZE (manifest->toc_header.entry_count,
+			manifest->toc_header.hash_count, manifest->toc_hash_length);
+
+	if ((manifest->toc_cache != NULL) && ((toc_end - next_addr) <= manifest->max_toc_cache)) {
+		/* Read and hash the entire table of contents into the cache. */
+		status = manifest->flash->read (manifest->flash, next_addr, manifest->toc_cache,
+			toc_end - next_addr);
 		if (status != 0) {
 			goto error;
 		}
 
-		status = hash->update (hash, (uint8_t*) &entry, sizeof (entry));
+		status = manifest_flash_verify_hash_update (body_hash, manifest->toc_cache,
+			toc_end - next_addr);
 		if (status != 0) {
 			goto error;
 		}
 
-		next_addr += sizeof (entry);
-		i++;
-	} while ((entry.type_id != MANIFEST_PLATFORM_ID) && (i < manifest->toc_header.entry_count));
+		/* Find the platform ID element in the cached data. */
+		for (i = 0; i < manifest->toc_header.entry_count; i++) {
+			memcpy (&entry, &manifest->toc_cache[sizeof (entry) * i], sizeof (entry));
+			if (entry.type_id == MANIFEST_PLATFORM_ID) {
+				break;
+			}
+		}
 
-	if (entry.type_id != MANIFEST_PLATFORM_ID) {
-		status = MANIFEST_NO_PLATFORM_ID;
-		goto error;
+		if (i == manifest->toc_header.entry_count) {
+			status = MANIFEST_NO_PLATFORM_ID;
+			goto error;
+		}
+
+		toc_cached = true;
 	}
+	else {
+		/* Find the platform ID element, hashing each entry as it is read in. */
+		i = 0;
+		do {
+			status = manifest->flash->read (manifest->flash, next_addr, (uint8_t*) &entry,
+				sizeof (entry));
+			if (status != 0) {
+				goto error;
+			}
 
-	/* Hash the flash contents for the rest of the table of contents. */
-	toc_end = manifest->addr + sizeof (manifest->header) + sizeof (manifest->toc_header) +
-		(manifest->toc_header.entry_count * sizeof (entry)) +
-		(manifest->toc_header.hash_count * manifest->toc_hash_length);
-	status = flash_hash_update_contents (manifest->flash, next_addr, toc_end - next_addr, hash);
-	if (status != 0) {
-		goto error;
+			status = manifest_flash_verify_hash_update (body_hash, (uint8_t*) &entry,
+				sizeof (entry));
+			if (status != 0) {
+				goto error;
+			}
+
+			next_addr += sizeof (entry);
+			i++;
+		} while ((entry.type_id != MANIFEST_PLATFORM_ID) && (i < manifest->toc_header.entry_count));
+
+		if (entry.type_id != MANIFEST_PLATFORM_ID) {
+			status = MANIFEST_NO_PLATFORM_ID;
+			goto error;
+		}
+
+		/* Hash the flash contents for the rest of the table of contents. */
+		status = manifest_flash_verify_hash_contents (manifest, next_addr, toc_end - next_addr,
+			body_hash);
+		if (status != 0) {
+			goto error;
+		}
 	}
 
 	/* Read and hash the table of contents hash. */
@@ -290,15 +568,16 @@ static int manifest_flash_verify_v2 (struct manifest_flash *manifest, struct has
 		goto error;
 	}
 
-	status = hash->update (hash, manifest->toc_hash, manifest->toc_hash_length);
+	status = manifest_flash_verify_hash_update (body_hash, manifest->toc_hash,
+		manifest->toc_hash_length);
 	if (status != 0) {
 		goto error;
 	}
 
 	/* Hash the flash contents until the platform ID element. */
 	next_addr += manifest->toc_hash_length;
-	status = flash_hash_update_contents (manifest->flash, next_addr,
-		manifest->addr + entry.offset - next_addr, hash);
+	status = manifest_flash_verify_hash_contents (manifest, next_addr,
+		manifest->addr + entry.offset - next_addr, body_hash);
 	if (status != 0) {
 		goto error;
 	}
@@ -316,7 +595,8 @@ static int manifest_flash_verify_v2 (struct manifest_flash *manifest, struct has
 		goto error;
 	}
 
-	status = hash->update (hash, (uint8_t*) &plat_id_header, sizeof (plat_id_header));
+	status = manifest_flash_verify_hash_update (body_hash, (uint8_t*) &plat_id_header,
+		sizeof (plat_id_header));
 	if (status != 0) {
 		goto error;
 	}
@@ -330,22 +610,26 @@ static int manifest_flash_verify_v2 (struct manifest_flash *manifest, struct has
 	}
 
 	manifest->platform_id[plat_id_header.id_length] = '\0';
-	status = hash->update (hash, (uint8_t*) manifest->platform_id, plat_id_header.id_length);
+	status = manifest_flash_verify_hash_update (body_hash, (uint8_t*) manifest->platform_id,
+		plat_id_header.id_length);
 	if (status != 0) {
 		goto error;
 	}
 
 	/* Hash the remaining manifest flash contents. */
 	next_addr += plat_id_header.id_length;
-	status = flash_hash_update_contents (manifest->flash, next_addr, sig_addr - next_addr, hash);
+	status = manifest_flash_verify_hash_contents (manifest, next_addr, sig_addr - next_addr,
+		body_hash);
 	if (status != 0) {
 		goto error;
 	}
 
 	/* Verify the signature of the overall manifest data. */
-	status = hash->finish (hash, manifest->hash_cache, sizeof (manifest->hash_cache));
-	if (status != 0) {
-		goto error;
+	if (body_hash != NULL) {
+		status = body_hash->finish (body_hash, manifest->hash_cache, sizeof (manifest->hash_cache));
+		if (status != 0) {
+			goto error;
+		}
 	}
 
 	manifest->cache_valid = true;
@@ -353,11 +637,20 @@ static int manifest_flash_verify_v2 (struct manifest_flash *manifest, struct has
 		memcpy (hash_out, manifest->hash_cache, manifest->hash_length);
 	}
 
-	return verification->verify_signature (verification, manifest->hash_cache,
+	status = verification->verify_signature (verification, manifest->hash_cache,
 		manifest->hash_length, manifest->signature, manifest->header.sig_length);
 
+	/* The cached table of contents was hashed as part of the signed manifest data, so it can be
+	 * trusted once the signature is verified.  With a precomputed hash, the data read into the
+	 * cache was not part of the hash and is not used. */
+	manifest->toc_cache_valid = toc_cached && (body_hash != NULL) && (status == 0);
+
+	return status;
+
 error:
-	hash->cancel (hash);
+	if (body_hash != NULL) {
+		body_hash->cancel (body_hash);
+	}
 	return status;
 }
 
@@ -378,18 +671,24 @@ int manifest_flash_verify (struct manifest_flash *manifest, struct hash_engine *
 	struct signature_verification *verification, uint8_t *hash_out, size_t hash_length)
 {
 	enum hash_type sig_hash;
+	size_t precomputed;
 	int status;
 
 	if ((manifest == NULL) || (hash == NULL) || (verification == NULL)) {
 		return MANIFEST_INVALID_ARGUMENT;
 	}
 
+	/* A precomputed hash is only used for a single verification attempt. */
+	precomputed = manifest->precomputed_hash_length;
+	manifest->precomputed_hash_length = 0;
+
 	if ((hash_out != NULL) && (hash_length < SHA256_HASH_LENGTH)) {
 		return MANIFEST_HASH_BUFFER_TOO_SMALL;
 	}
 
 	manifest->manifest_valid = false;
 	manifest->cache_valid = false;
+	manifest->toc_cache_valid = false;
 	if (hash_out != NULL) {
 		/* Clear the output hash buffer to indicate no hash was calculated. */
 		memset (hash_out, 0, hash_length);
@@ -438,10 +737,12 @@ int manifest_flash_verify (struct manifest_flash *manifest, struct hash_engine *
 	}
 
 	if (manifest->header.magic == manifest->magic_num_v1) {
-		status = manifest_flash_verify_v1 (manifest, hash, verification, sig_hash, hash_out);
+		status = manifest_flash_verify_v1 (manifest, hash, verification, sig_hash, hash_out,
+			(precomputed == manifest->hash_length));
 	}
 	else {
-		status = manifest_flash_verify_v2 (manifest, hash, verification, sig_hash, hash_out);
+		status = manifest_flash_verify_v2 (manifest, hash, verification, sig_hash, hash_out,
+			(precomputed == manifest->hash_length));
 	}
 
 	if (status == 0) {
@@ -635,38 +936,24 @@ int manifest_flash_get_signature (struct manifest_flash *manifest, uint8_t *sign
 }
 
 /**
- * Find the first element of a specified type in the manifest and read the element data.
- * Everything about the operation will be validated, as appropriate.  This includes table of
- * contents and entry data hashing.
+ * Find a table of contents entry for an element by reading the table of contents from flash.  The
+ * table of contents will be validated against the expected hash.
  *
- * @param manifest The manifest to read.
- * @param hash The hash engine to use for element validation.
+ * @param manifest The manifest to search.
+ * @param hash The hash engine to use for table of contents validation.
  * @param type Identifier for the type of element to find.
  * @param start Index of the table of contents entry to start searching for the element.
- * @param parent_type Identifier for the type of the parent element.  If the element has no parent,
- * MANIFEST_NO_PARENT must be provided.
- * @param read_offset Offset into the element data to start reading.  The entire element is still
- * validated, but the buffer will only contain element data starting starting at the offset.
- * @param found Optional output indicating which TOC entry was used for the element.
- * @param format Optional output for the format version of the element data.
- * @param total_len Optional output for the total length of the element data.
- * @param element Optional pointer to the output buffer for the element data.  If the output buffer
- * is null, a buffer will by dynamically allocated to fit the entire element.  This buffer must be
- * freed by the caller.  If the pointer is null, no element data will be read.
- * @param length Length of the element output buffer, if the buffer is not null.  If the actual
- * element data is longer than the specified length, only the specified length will be read back and
- * no error is generated.  This parameter is ignored when the output buffer is dynamically
- * allocated.
+ * @param parent_type Identifier for the type of the parent element.
+ * @param entry Output for the table of contents entry for the element.
+ * @param index Output for the index of the table of contents entry.
+ * @param entry_hash Output for the element hash.  This is only valid if the entry has a hash.
  *
- * @return The amount of element data read or an error code.  Use ROT_IS_ERROR to check the return
- * value.
+ * @return 0 if the entry was found and the table of contents is valid or an error code.
  */
-int manifest_flash_read_element_data (struct manifest_flash *manifest, struct hash_engine *hash,
-	uint8_t type, int start, uint8_t parent_type, uint32_t read_offset, uint8_t *found,
-	uint8_t *format, size_t *total_len, uint8_t **element, size_t length)
+static int manifest_flash_find_toc_entry (struct manifest_flash *manifest,
+	struct hash_engine *hash, uint8_t type, int start, uint8_t parent_type,
+	struct manifest_toc_entry *entry, int *index, uint8_t *entry_hash)
 {
-	struct manifest_toc_entry entry;
-	uint8_t entry_hash[SHA512_HASH_LENGTH];
 	uint8_t validate_hash[SHA512_HASH_LENGTH];
 	uint32_t entry_addr;
 	uint32_t hash_addr;
@@ -674,22 +961,9 @@ int manifest_flash_read_element_data (struct manifest_flash *manifest, struct ha
 	int i;
 	int status;
 
-	if ((manifest == NULL) || (hash == NULL)) {
-		return MANIFEST_INVALID_ARGUMENT;
-	}
-
-	if (!manifest->manifest_valid) {
-		return MANIFEST_NO_MANIFEST;
-	}
-
-	if (start >= manifest->toc_header.entry_count) {
-		return (parent_type == MANIFEST_NO_PARENT) ?
-			MANIFEST_ELEMENT_NOT_FOUND : MANIFEST_CHILD_NOT_FOUND;
-	}
-
 	entry_addr =
 		manifest->addr + sizeof (struct manifest_header) + sizeof (struct manifest_toc_header);
-	hash_addr = entry_addr + (sizeof (entry) * manifest->toc_header.entry_count);
+	hash_addr = entry_addr + (sizeof (*entry) * manifest->toc_header.entry_count);
 	toc_end = hash_addr + (manifest->toc_hash_length * manifest->toc_header.hash_count);
 
 	/* Start hashing to verify the TOC contents. */
@@ -704,46 +978,47 @@ int manifest_flash_read_element_data (struct manifest_flash *manifest, struct ha
 	}
 
 	/* Hash the TOC data before the first entry that will be read. */
-	status = flash_hash_update_contents (manifest->flash, entry_addr, sizeof (entry) * start, hash);
+	status = flash_hash_update_contents (manifest->flash, entry_addr, sizeof (*entry) * start,
+		hash);
 	if (status != 0) {
 		goto error;
 	}
 
 	/* Find the TOC entry for the requested element. */
-	entry_addr += sizeof (entry) * start;
+	entry_addr += sizeof (*entry) * start;
 	i = start;
 	do {
-		status = manifest->flash->read (manifest->flash, entry_addr, (uint8_t*) &entry,
-			sizeof (entry));
+		status = manifest->flash->read (manifest->flash, entry_addr, (uint8_t*) entry,
+			sizeof (*entry));
 		if (status != 0) {
 			goto error;
 		}
 
 		/* As soon as we see an element that is not a child, we fail because we have left the
 		 * context of the expected parent. */
-		if ((parent_type != MANIFEST_NO_PARENT) && (entry.parent == MANIFEST_NO_PARENT)) {
+		if ((parent_type != MANIFEST_NO_PARENT) && (entry->parent == MANIFEST_NO_PARENT)) {
 			status = MANIFEST_CHILD_NOT_FOUND;
 			goto error;
 		}
 
-		status = hash->update (hash, (uint8_t*) &entry, sizeof (entry));
+		status = hash->update (hash, (uint8_t*) entry, sizeof (*entry));
 		if (status != 0) {
 			goto error;
 		}
 
 		i++;
-		entry_addr += sizeof (entry);
-	} while ((entry.type_id != type) && (i < manifest->toc_header.entry_count));
+		entry_addr += sizeof (*entry);
+	} while ((entry->type_id != type) && (i < manifest->toc_header.entry_count));
 
-	if (entry.type_id != type) {
+	if (entry->type_id != type) {
 		status = (parent_type == MANIFEST_NO_PARENT) ?
 			MANIFEST_ELEMENT_NOT_FOUND : MANIFEST_CHILD_NOT_FOUND;
 		goto error;
 	}
 
-	if (entry.hash_id < manifest->toc_header.hash_count) {
+	if (entry->hash_id < manifest->toc_header.hash_count) {
 		/* Find the address of the entry hash. */
-		hash_addr += (manifest->toc_hash_length * entry.hash_id);
+		hash_addr += (manifest->toc_hash_length * entry->hash_id);
 
 		/* Hash the unneeded TOC data until the entry hash. */
 		status = flash_hash_update_contents (manifest->flash, entry_addr, hash_addr - entry_addr,
@@ -789,13 +1064,132 @@ int manifest_flash_read_element_data (struct manifest_flash *manifest, struct ha
 		return MANIFEST_TOC_INVALID;
 	}
 
+	*index = i - 1;
+	return 0;
+
+error:
+	hash->cancel (hash);
+	return status;
+}
+
+/**
+ * Find a table of contents entry for an element using the cached table of contents.  No flash
+ * accesses or hashing is necessary, since the cache was validated when the manifest was verified.
+ *
+ * @param manifest The manifest to search.
+ * @param type Identifier for the type of element to find.
+ * @param start Index of the table of contents entry to start searching for the element.
+ * @param parent_type Identifier for the type of the parent element.
+ * @param entry Output for the table of contents entry for the element.
+ * @param index Output for the index of the table of contents entry.
+ * @param entry_hash Output for the element hash.  This is only valid if the entry has a hash.
+ *
+ * @return 0 if the entry was found or an error code.
+ */
+static int manifest_flash_find_cached_toc_entry (struct manifest_flash *manifest, uint8_t type,
+	int start, uint8_t parent_type, struct manifest_toc_entry *entry, int *index,
+	uint8_t *entry_hash)
+{
+	const uint8_t *hashes =
+		&manifest->toc_cache[sizeof (*entry) * manifest->toc_header.entry_count];
+	int i;
+
+	for (i = start; i < manifest->toc_header.entry_count; i++) {
+		memcpy (entry, &manifest->toc_cache[sizeof (*entry) * i], sizeof (*entry));
+
+		/* As soon as we see an element that is not a child, we fail because we have left the
+		 * context of the expected parent. */
+		if ((parent_type != MANIFEST_NO_PARENT) && (entry->parent == MANIFEST_NO_PARENT)) {
+			return MANIFEST_CHILD_NOT_FOUND;
+		}
+
+		if (entry->type_id == type) {
+			if (entry->hash_id < manifest->toc_header.hash_count) {
+				memcpy (entry_hash, &hashes[manifest->toc_hash_length * entry->hash_id],
+					manifest->toc_hash_length);
+			}
+
+			*index = i;
+			return 0;
+		}
+	}
+
+	return (parent_type == MANIFEST_NO_PARENT) ?
+		MANIFEST_ELEMENT_NOT_FOUND : MANIFEST_CHILD_NOT_FOUND;
+}
+
+/**
+ * Find the first element of a specified type in the manifest and read the element data.
+ * Everything about the operation will be validated, as appropriate.  This includes table of
+ * contents and entry data hashing.
+ *
+ * If the manifest has a valid table of contents cache, element lookup will be done using the cached
+ * data and only the element data will be read from flash.
+ *
+ * @param manifest The manifest to read.
+ * @param hash The hash engine to use for element validation.
+ * @param type Identifier for the type of element to find.
+ * @param start Index of the table of contents entry to start searching for the element.
+ * @param parent_type Identifier for the type of the parent element.  If the element has no parent,
+ * MANIFEST_NO_PARENT must be provided.
+ * @param read_offset Offset into the element data to start reading.  The entire element is still
+ * validated, but the buffer will only contain element data starting starting at the offset.
+ * @param found Optional output indicating which TOC entry was used for the element.
+ * @param format Optional output for the format version of the element data.
+ * @param total_len Optional output for the total length of the element data.
+ * @param element Optional pointer to the output buffer for the element data.  If the output buffer
+ * is null, a buffer will by dynamically allocated to fit the entire element.  This buffer must be
+ * freed by the caller.  If the pointer is null, no element data will be read.
+ * @param length Length of the element output buffer, if the buffer is not null.  If the actual
+ * element data is longer than the specified length, only the specified length will be read back and
+ * no error is generated.  This parameter is ignored when the output buffer is dynamically
+ * allocated.
+ *
+ * @return The amount of element data read or an error code.  Use ROT_IS_ERROR to check the return
+ * value.
+ */
+int manifest_flash_read_element_data (struct manifest_flash *manifest, struct hash_engine *hash,
+	uint8_t type, int start, uint8_t parent_type, uint32_t read_offset, uint8_t *found,
+	uint8_t *format, size_t *total_len, uint8_t **element, size_t length)
+{
+	struct manifest_toc_entry entry;
+	uint8_t entry_hash[SHA512_HASH_LENGTH];
+	uint8_t validate_hash[SHA512_HASH_LENGTH];
+	int i;
+	int status;
+
+	if ((manifest == NULL) || (hash == NULL)) {
+		return MANIFEST_INVALID_ARGUMENT;
+	}
+
+	if (!manifest->manifest_valid) {
+		return MANIFEST_NO_MANIFEST;
+	}
+
+	if (start >= manifest->toc_header.entry_count) {
+		return (parent_type == MANIFEST_NO_PARENT) ?
+			MANIFEST_ELEMENT_NOT_FOUND : MANIFEST_CHILD_NOT_FOUND;
+	}
+
+	if (manifest->toc_cache_valid) {
+		status = manifest_flash_find_cached_toc_entry (manifest, type, start, parent_type, &entry,
+			&i, entry_hash);
+	}
+	else {
+		status = manifest_flash_find_toc_entry (manifest, hash, type, start, parent_type, &entry,
+			&i, entry_hash);
+	}
+	if (status != 0) {
+		return status;
+	}
+
 	/* Read the element data. */
 	if ((entry.parent != MANIFEST_NO_PARENT) && (entry.parent != parent_type)) {
 		return MANIFEST_WRONG_PARENT;
 	}
 
 	if (found) {
-		*found = i - 1;
+		*found = i;
 	}
 	if (format) {
 		*format = entry.format;
@@ -918,6 +1312,26 @@ int manifest_flash_get_num_child_elements (struct manifest_flash *manifest,
 		return 0;
 	}
 
+	if (manifest->toc_cache_valid) {
+		for (; entry < manifest->toc_header.entry_count; ++entry) {
+			memcpy (&toc_entry, &manifest->toc_cache[sizeof (struct manifest_toc_entry) * entry],
+				sizeof (struct manifest_toc_entry));
+
+			if ((toc_entry.parent == parent_type) || (toc_entry.type_id == parent_type)) {
+				break;
+			}
+			if ((toc_entry.parent == type) && (toc_entry.type_id == child_type)) {
+				++child_count;
+
+				if (child_len != NULL) {
+					*child_len = *child_len + toc_entry.length;
+				}
+			}
+		}
+
+		return child_count;
+	}
+
 	entry_addr = manifest->addr + sizeof (struct manifest_header) +
 		sizeof (struct manifest_toc_header);
 	hash_addr = entry_addr + ((sizeof (struct manifest_toc_entry) + manifest->toc_hash_length) *
@@ -11,6 +11,25 @@
 #include "flash/flash.h"
 #include "crypto/hash.h"
 #include "common/signature_verification.h"
+#include "common/arena.h"
+
+
+/**
+ * The buffer size needed to cache the largest possible table of contents for a manifest.  This
+ * covers the maximum number of entries and element hashes, but not the table of contents header.
+ */
+#define	MANIFEST_FLASH_TOC_CACHE_MAX_SIZE	\
+	(MANIFEST_MAX_ENTRIES * (sizeof (struct manifest_toc_entry) + SHA512_HASH_LENGTH))
+
+/**
+ * Get the buffer size needed to cache a table of contents of a specific size.
+ *
+ * @param entries The number of entries in the table of contents.
+ * @param hashes The number of element hashes in the table of contents.
+ * @param hash_len The length of each element hash.
+ */
+#define	MANIFEST_FLASH_TOC_CACHE_SIZE(entries, hashes, hash_len)	\
+	(((entries) * sizeof (struct manifest_toc_entry)) + ((hashes) * (hash_len)))
 
 
 /**
@@ -39,6 +58,10 @@ struct manifest_flash {
 	bool cache_valid;							/**< Flag indicating if the cached hash is valid. */
 	bool free_signature;						/**< Flag indicating the signature buffer should be freed. */
 	bool manifest_valid;						/**< Flag indicating there is a validated manifest. */
+	uint8_t *toc_cache;							/**< Optional buffer to hold the verified table of contents. */
+	size_t max_toc_cache;						/**< Size of the table of contents cache buffer. */
+	bool toc_cache_valid;						/**< Flag indicating the cached table of contents is valid. */
+	size_t precomputed_hash_length;				/**< Length of a precomputed hash for the next verification. */
 };
 
 
@@ -50,6 +73,16 @@ int manifest_flash_v2_init (struct manifest_flash *manifest, struct flash *flash
 	size_t max_platform_id);
 void manifest_flash_release (struct manifest_flash *manifest);
 
+int manifest_flash_enable_toc_cache (struct manifest_flash *manifest, uint8_t *toc_cache,
+	size_t max_toc_cache);
+int manifest_flash_set_verification_hash (struct manifest_flash *manifest, const uint8_t *digest,
+	size_t length);
+
+void* manifest_flash_alloc_query (struct arena *arena, size_t size);
+void* manifest_flash_calloc_query (struct arena *arena, size_t count, size_t size);
+char* manifest_flash_strdup_query (struct arena *arena, const char *str);
+void manifest_flash_free_query (const void *ptr);
+
 int manifest_flash_read_header (struct manifest_flash *manifest, struct manifest_header *header);
 
 int manifest_flash_verify (struct manifest_flash *manifest, struct hash_engine *hash,
@@ -131,6 +131,153 @@ static int manifest_manager_flash_check_empty_manifest (struct manifest_manager_
 	return status;
 }
 
+/**
+ * Discard any manifest hash calculated from written data and prepare to hash new data.
+ *
+ * @param stream The stream hashing state to reset.
+ * @param enable Flag indicating if new data should be hashed.  Data will never be hashed if there
+ * is no hash engine for streaming verification.
+ */
+static void manifest_manager_flash_stream_reset (struct manifest_manager_flash_stream *stream,
+	bool enable)
+{
+	if (stream->active) {
+		stream->hash->cancel (stream->hash);
+	}
+
+	stream->active = false;
+	stream->received = 0;
+	stream->signed_length = 0;
+	stream->digest_length = 0;
+	stream->valid = enable && (stream->hash != NULL);
+}
+
+/**
+ * Start hashing the manifest after the complete header has been received.
+ *
+ * @param stream The stream hashing state.
+ *
+ * @return 0 if the hash was started or an error code.
+ */
+static int manifest_manager_flash_stream_start (struct manifest_manager_flash_stream *stream)
+{
+	enum hash_type type;
+	int status;
+
+	switch (manifest_get_hash_type (stream->header.sig_type)) {
+		case MANIFEST_HASH_SHA256:
+			type = HASH_TYPE_SHA256;
+			break;
+
+		case MANIFEST_HASH_SHA384:
+			type = HASH_TYPE_SHA384;
+			break;
+
+		case MANIFEST_HASH_SHA512:
+			type = HASH_TYPE_SHA512;
+			break;
+
+		default:
+			return MANIFEST_SIG_UNKNOWN_HASH_TYPE;
+	}
+
+	if (stream->header.sig_length >= stream->header.length) {
+		return MANIFEST_BAD_LENGTH;
+	}
+
+	stream->signed_length = stream->header.length - stream->header.sig_length;
+	if (stream->signed_length < sizeof (stream->header)) {
+		return MANIFEST_BAD_LENGTH;
+	}
+
+	status = hash_start_new_hash (stream->hash, type);
+	if (status != 0) {
+		return status;
+	}
+
+	stream->active = true;
+	stream->digest_length = hash_get_hash_len (type);
+
+	return stream->hash->update (stream->hash, (uint8_t*) &stream->header,
+		sizeof (stream->header));
+}
+
+/**
+ * Hash manifest data that has been written to the pending region.  Data must be provided in the
+ * same order it was written.  The data is read back from flash before it is hashed, since the
+ * resulting hash will be used in place of reading the manifest during verification.  If the data
+ * cannot be confirmed or hashed, streaming verification will be disabled until the next update and
+ * the manifest will be hashed from flash during verification.
+ *
+ * @param stream The stream hashing state.
+ * @param flash The flash that contains the pending region.
+ * @param addr The flash address where the data was written.
+ * @param data The data that was written.
+ * @param length The length of the data.
+ */
+static void manifest_manager_flash_stream_update (struct manifest_manager_flash_stream *stream,
+	const struct flash *flash, uint32_t addr, const uint8_t *data, size_t length)
+{
+	size_t bytes;
+	int status = 0;
+
+	if (!stream->valid) {
+		return;
+	}
+
+	status = flash_verify_data (flash, addr, data, length);
+	if (status != 0) {
+		goto fail;
+	}
+
+	if (stream->received < sizeof (stream->header)) {
+		bytes = sizeof (stream->header) - stream->received;
+		if (bytes > length) {
+			bytes = length;
+		}
+
+		memcpy (((uint8_t*) &stream->header) + stream->received, data, bytes);
+		stream->received += bytes;
+		data += bytes;
+		length -= bytes;
+
+		if (stream->received == sizeof (stream->header)) {
+			status = manifest_manager_flash_stream_start (stream);
+			if (status != 0) {
+				goto fail;
+			}
+		}
+	}
+
+	if (stream->active && (length != 0)) {
+		bytes = stream->signed_length - stream->received;
+		if (bytes > length) {
+			bytes = length;
+		}
+
+		status = stream->hash->update (stream->hash, data, bytes);
+		if (status != 0) {
+			goto fail;
+		}
+
+		stream->received += bytes;
+	}
+
+	if (stream->active && (stream->received == stream->signed_length)) {
+		status = stream->hash->finish (stream->hash, stream->digest, sizeof (stream->digest));
+		if (status != 0) {
+			goto fail;
+		}
+
+		stream->active = false;
+	}
+
+	return;
+
+fail:
+	manifest_manager_flash_stream_reset (stream, false);
+}
+
 /**
  * Initialize the manager for handling manifests.
  *
@@ -238,11 +385,44 @@ exit_region1:
  */
 void manifest_manager_flash_release (struct manifest_manager_flash *manager)
 {
+	manifest_manager_flash_stream_reset (&manager->stream, false);
+
 	platform_mutex_free (&manager->lock);
 	flash_updater_release (&manager->region1.updater);
 	flash_updater_release (&manager->region2.updater);
 }
 
+/**
+ * Hash manifest data as it is written to the pending region.  Each block of data is read back from
+ * flash after it is written and only hashed if it matches.  When the update is complete, the
+ * manifest signature can be checked against this hash without needing to hash the entire manifest
+ * from flash again.  If the update data is not written contiguously or does not match the flash
+ * contents, the manifest will be hashed from flash as normal.
+ *
+ * @param manager The manifest manager to configure.
+ * @param hash The hash engine to use for hashing written data.  This must be a dedicated instance
+ * that is not used for any other operations, since the hash remains active between writes.  Set
+ * this to null to disable streaming verification.
+ *
+ * @return 0 if streaming verification was configured successfully or an error code.
+ */
+int manifest_manager_flash_enable_stream_verification (struct manifest_manager_flash *manager,
+	struct hash_engine *hash)
+{
+	if (manager == NULL) {
+		return MANIFEST_MANAGER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&manager->lock);
+
+	manifest_manager_flash_stream_reset (&manager->stream, false);
+	manager->stream.hash = hash;
+
+	platform_mutex_unlock (&manager->lock);
+
+	return 0;
+}
+
 /**
  * Get the active or pending manifest region based on the current system state.
  *
@@ -391,6 +571,7 @@ int manifest_manager_flash_clear_pending_region (struct manifest_manager_flash *
 
 		manager->updating = &region->updater;
 		region->is_valid = false;
+		manifest_manager_flash_stream_reset (&manager->stream, true);
 	}
 	else {
 		platform_mutex_unlock (&manager->lock);
@@ -414,6 +595,9 @@ int manifest_manager_flash_clear_pending_region (struct manifest_manager_flash *
 int manifest_manager_flash_write_pending_data (struct manifest_manager_flash *manager,
 	const uint8_t *data, size_t length)
 {
+	uint32_t addr;
+	int status;
+
 	if (data == NULL) {
 		return MANIFEST_MANAGER_INVALID_ARGUMENT;
 	}
@@ -422,7 +606,19 @@ int manifest_manager_flash_write_pending_data (struct manifest_manager_flash *ma
 		return MANIFEST_MANAGER_NOT_CLEARED;
 	}
 
-	return flash_updater_write_update_data (manager->updating, data, length);
+	addr = manager->updating->base_addr + flash_updater_get_bytes_written (manager->updating);
+
+	status = flash_updater_write_update_data (manager->updating, data, length);
+	if (status == 0) {
+		manifest_manager_flash_stream_update (&manager->stream, manager->updating->flash, addr,
+			data, length);
+	}
+	else {
+		/* Some of the data may have been written, so the stream is no longer contiguous. */
+		manifest_manager_flash_stream_reset (&manager->stream, false);
+	}
+
+	return status;
 }
 
 /**
@@ -448,11 +644,21 @@ int manifest_manager_flash_verify_pending_manifest (struct manifest_manager_flas
 	region = manifest_manager_flash_get_region (manager, false);
 	if (!region->is_valid) {
 		if (manager->updating != NULL) {
+			if (manager->stream.valid && !manager->stream.active &&
+				(manager->stream.digest_length != 0)) {
+				/* All manifest data was hashed as it was written, so there is no need to read it
+				 * back from flash. */
+				manifest_flash_set_verification_hash (region->flash, manager->stream.digest,
+					manager->stream.digest_length);
+			}
+
 			status = region->manifest->verify (region->manifest, manager->hash,
 				manager->verification, NULL, 0);
 			if (status == 0) {
 				region->is_valid = true;
 			}
+
+			manifest_flash_set_verification_hash (region->flash, NULL, 0);
 		}
 		else {
 			status = MANIFEST_MANAGER_NONE_PENDING;
@@ -483,6 +689,7 @@ int manifest_manager_flash_verify_pending_manifest (struct manifest_manager_flas
 
 exit:
 	manager->updating = NULL;
+	manifest_manager_flash_stream_reset (&manager->stream, false);
 
 	platform_mutex_unlock (&manager->lock);
 	return status;
@@ -531,6 +738,7 @@ int manifest_manager_flash_clear_all_manifests (struct manifest_manager_flash *m
 	}
 
 	manager->updating = NULL;
+	manifest_manager_flash_stream_reset (&manager->stream, false);
 	status = manifest_manager_flash_clear_manifest (
 		manifest_manager_flash_get_region (manager, true), MANIFEST_MANAGER_ACTIVE_IN_USE);
 
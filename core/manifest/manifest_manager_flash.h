@@ -28,6 +28,20 @@ struct manifest_manager_flash_region {
 	struct flash_updater updater;					/**< Update manager for the flash region. */
 };
 
+/**
+ * State for hashing manifest data as it is written to the pending region.
+ */
+struct manifest_manager_flash_stream {
+	struct hash_engine *hash;						/**< Dedicated hash engine for the written data. */
+	struct manifest_header header;					/**< Header of the manifest being written. */
+	size_t received;								/**< The number of manifest bytes processed. */
+	size_t signed_length;							/**< The number of manifest bytes covered by the signature. */
+	uint8_t digest[SHA512_HASH_LENGTH];				/**< Hash of the written manifest data. */
+	size_t digest_length;							/**< Length of the manifest hash.  0 if the hash is not complete. */
+	bool active;									/**< Flag indicating a hash is in progress. */
+	bool valid;										/**< Flag indicating all written data has been hashed. */
+};
+
 /**
  * A manager for a single set of manifests stored in flash.
  *
@@ -45,6 +59,7 @@ struct manifest_manager_flash {
 	platform_mutex lock;							/**< Synchronization for flash manager state. */
 	uint8_t manifest_index;							/**< Index of manifest in state manager. */
 	bool sku_upgrade_permitted;						/**< Manifest permitted to upgrade from generic to SKU-specific */
+	struct manifest_manager_flash_stream stream;	/**< Hashing of pending manifest data as it is written. */
 
 	/**
 	 * Function called after standard manifest verification has been completed successfully.  This
@@ -66,6 +81,9 @@ int manifest_manager_flash_init (struct manifest_manager_flash *manager,
 	bool sku_upgrade_permitted);
 void manifest_manager_flash_release (struct manifest_manager_flash *manager);
 
+int manifest_manager_flash_enable_stream_verification (struct manifest_manager_flash *manager,
+	struct hash_engine *hash);
+
 struct manifest_manager_flash_region* manifest_manager_flash_get_region (
 	struct manifest_manager_flash *manager, bool active);
 struct manifest_manager_flash_region* manifest_manager_flash_get_manifest_region (
@@ -362,12 +362,16 @@ fail:
  * @param max_signature The maximum supported length for a manifest signature.
  * @param platform_id_cache Buffer to hold the manifest platform ID.
  * @param max_platform_id The maximum platform ID length supported, including the NULL terminator.
+ * @param toc_cache Optional buffer to hold the verified table of contents.  This should be static
+ * storage that lives as long as the PCD instance.  Null to validate every element access from
+ * flash.
+ * @param max_toc_cache The size of the table of contents cache buffer.
  *
  * @return 0 if the PCD instance was initialized successfully or an error code.
  */
 int pcd_flash_init (struct pcd_flash *pcd, struct flash *flash, struct hash_engine *hash,
 	uint32_t base_addr, uint8_t *signature_cache, size_t max_signature, uint8_t *platform_id_cache,
-	size_t max_platform_id)
+	size_t max_platform_id, uint8_t *toc_cache, size_t max_toc_cache)
 {
 	int status;
 
@@ -383,6 +387,8 @@ int pcd_flash_init (struct pcd_flash *pcd, struct flash *flash, struct hash_engi
 		return status;
 	}
 
+	manifest_flash_enable_toc_cache (&pcd->base_flash, toc_cache, max_toc_cache);
+
 	pcd->base.base.verify = pcd_flash_verify;
 	pcd->base.base.get_id = pcd_flash_get_id;
 	pcd->base.base.get_platform_id = pcd_flash_get_platform_id;
@@ -21,7 +21,7 @@ struct pcd_flash {
 
 int pcd_flash_init (struct pcd_flash *pcd, struct flash *flash, struct hash_engine *hash, 
 	uint32_t base_addr, uint8_t *signature_cache, size_t max_signature, uint8_t *platform_id_cache,
-	size_t max_platform_id);
+	size_t max_platform_id, uint8_t *toc_cache, size_t max_toc_cache);
 void pcd_flash_release (struct pcd_flash *pcd);
 
 
@@ -28,6 +28,9 @@ static int pfm_flash_verify (struct manifest *pfm, struct hash_engine *hash,
 		return PFM_INVALID_ARGUMENT;
 	}
 
+	/* Any existing index no longer represents the PFM data being verified. */
+	pfm_flash_discard_index (pfm_flash);
+
 	status = manifest_flash_verify (&pfm_flash->base_flash, hash, verification, hash_out,
 		hash_length);
 	if (status != 0) {
@@ -191,16 +194,156 @@ static int pfm_flash_is_empty (struct manifest *pfm)
 	return status;
 }
 
+/**
+ * Find the index entry for a firmware component.
+ *
+ * @param index The PFM index to search.
+ * @param fw The firmware ID to find.  This can be null to return the first firmware component.
+ *
+ * @return The index entry for the firmware or null if the firmware is not in the PFM.
+ */
+static const struct pfm_flash_index_fw* pfm_flash_index_find_firmware (
+	const struct pfm_flash_index *index, const char *fw)
+{
+	size_t i;
+
+	if (index->fw.count == 0) {
+		return NULL;
+	}
+
+	if (fw == NULL) {
+		return &index->fw_info[0];
+	}
+
+	for (i = 0; i < index->fw.count; i++) {
+		if (strcmp (fw, index->fw.ids[i]) == 0) {
+			return &index->fw_info[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Find the index entry for a version of a firmware component.
+ *
+ * @param index The PFM index to search.
+ * @param fw The firmware ID to find.  This can be null to use the first firmware component.
+ * @param version The version ID to find.
+ * @param info Output for the index entry for the firmware version.
+ *
+ * @return 0 if the firmware version was found or an error code.
+ */
+static int pfm_flash_index_find_version (const struct pfm_flash_index *index, const char *fw,
+	const char *version, const struct pfm_flash_index_version **info)
+{
+	const struct pfm_flash_index_fw *fw_info;
+	size_t i;
+
+	fw_info = pfm_flash_index_find_firmware (index, fw);
+	if (fw_info == NULL) {
+		return PFM_UNKNOWN_FIRMWARE;
+	}
+
+	for (i = 0; i < fw_info->versions.count; i++) {
+		if (strcmp (version, fw_info->versions.versions[i].fw_version_id) == 0) {
+			*info = &fw_info->info[i];
+			return 0;
+		}
+	}
+
+	return PFM_UNSUPPORTED_VERSION;
+}
+
+/**
+ * Check if a pointer references data stored in a PFM index.
+ *
+ * @param index The PFM index to check.  This can be null.
+ * @param ptr The pointer to check.
+ *
+ * @return true if the pointer is within the index or false if not.
+ */
+static bool pfm_flash_is_index_data (const struct pfm_flash_index *index, const void *ptr)
+{
+	return (index != NULL) && ((const uint8_t*) ptr >= (const uint8_t*) index) &&
+		((const uint8_t*) ptr < ((const uint8_t*) index + index->length));
+}
+
+/**
+ * Take a reference to the PFM index for a query result that points into the index.  The index
+ * lock must be held by the caller.
+ *
+ * @param index The PFM index providing the query result.
+ * @param list The list returned for the query.  No reference is needed for an empty list.
+ */
+static void pfm_flash_index_add_reference (struct pfm_flash_index *index, const void *list)
+{
+	if (list != NULL) {
+		index->refs++;
+	}
+}
+
+/**
+ * Release the index reference held by a query result.  An index that has already been discarded
+ * is freed once there are no query results that reference it.
+ *
+ * @param pfm The PFM that generated the query result.
+ * @param list The list returned for the query.
+ *
+ * @return true if the query result was provided by an index or false if the result must be freed.
+ */
+static bool pfm_flash_index_release_reference (struct pfm *pfm, const void *list)
+{
+	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
+	struct pfm_flash_index **entry;
+	struct pfm_flash_index *index;
+	bool found = false;
+
+	if ((pfm_flash == NULL) || (list == NULL)) {
+		return false;
+	}
+
+	platform_mutex_lock (&pfm_flash->index_lock);
+
+	if (pfm_flash_is_index_data (pfm_flash->index, list)) {
+		pfm_flash->index->refs--;
+		found = true;
+	}
+
+	entry = &pfm_flash->retired;
+	while (!found && (*entry != NULL)) {
+		index = *entry;
+		if (pfm_flash_is_index_data (index, list)) {
+			found = true;
+
+			index->refs--;
+			if (index->refs == 0) {
+				*entry = index->next;
+				platform_free (index);
+			}
+		}
+		else {
+			entry = &index->next;
+		}
+	}
+
+	platform_mutex_unlock (&pfm_flash->index_lock);
+
+	return found;
+}
+
 static void pfm_flash_free_firmware (struct pfm *pfm, struct pfm_firmware *fw)
 {
 	size_t i;
 
 	if ((fw != NULL) && (fw->ids != NULL) && (fw->ids != NO_FW_IDS)) {
-		for (i = 0; i < fw->count; i++) {
-			platform_free ((void*) fw->ids[i]);
-		}
+		if (!pfm_flash_index_release_reference (pfm, fw->ids)) {
+			for (i = 0; i < fw->count; i++) {
+				manifest_flash_free_query (fw->ids[i]);
+			}
 
-		platform_free (fw->ids);
+			manifest_flash_free_query (fw->ids);
+		}
 
 		memset (fw, 0, sizeof (*fw));
 	}
@@ -266,11 +409,13 @@ static int pfm_flash_read_firmware_element_v2 (struct pfm_flash *pfm, uint8_t *e
  * Get the list of firmware components in a v2 formatted PFM.
  *
  * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
  * @param fw Output for the list of firmware.
  *
  * @return 0 if the list was generated successfully or an error code.
  */
-static int pfm_flash_get_firmware_v2 (struct pfm_flash *pfm, struct pfm_firmware *fw)
+static int pfm_flash_get_firmware_v2 (struct pfm_flash *pfm, struct arena *arena,
+	struct pfm_firmware *fw)
 {
 	struct pfm_firmware_element fw_element;
 	uint8_t last = 0;
@@ -279,7 +424,7 @@ static int pfm_flash_get_firmware_v2 (struct pfm_flash *pfm, struct pfm_firmware
 
 	if ((pfm->flash_dev_format >= 0) && (pfm->flash_dev.fw_count != 0)) {
 		fw->count = pfm->flash_dev.fw_count;
-		fw->ids = platform_calloc (fw->count, sizeof (char*));
+		fw->ids = manifest_flash_calloc_query (arena, fw->count, sizeof (char*));
 		if (fw->ids == NULL) {
 			return PFM_NO_MEMORY;
 		}
@@ -291,7 +436,7 @@ static int pfm_flash_get_firmware_v2 (struct pfm_flash *pfm, struct pfm_firmware
 			}
 
 			fw_element.id[fw_element.id_length] = '\0';
-			fw->ids[i] = strdup ((char*) fw_element.id);
+			fw->ids[i] = manifest_flash_strdup_query (arena, (char*) fw_element.id);
 			if (fw->ids[i] == NULL) {
 				status = PFM_NO_MEMORY;
 				goto error;
@@ -309,7 +454,17 @@ error:
 	return status;
 }
 
-static int pfm_flash_get_firmware (struct pfm *pfm, struct pfm_firmware *fw)
+/**
+ * Get the list of firmware components in a PFM.
+ *
+ * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
+ * @param fw Output for the list of firmware.
+ *
+ * @return 0 if the list was generated successfully or an error code.
+ */
+static int pfm_flash_query_firmware (struct pfm *pfm, struct arena *arena,
+	struct pfm_firmware *fw)
 {
 	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
 
@@ -321,24 +476,60 @@ static int pfm_flash_get_firmware (struct pfm *pfm, struct pfm_firmware *fw)
 		return MANIFEST_NO_MANIFEST;
 	}
 
+	platform_mutex_lock (&pfm_flash->index_lock);
+	if (pfm_flash->index != NULL) {
+		*fw = pfm_flash->index->fw;
+		pfm_flash_index_add_reference (pfm_flash->index, fw->ids);
+		platform_mutex_unlock (&pfm_flash->index_lock);
+
+		return 0;
+	}
+	platform_mutex_unlock (&pfm_flash->index_lock);
+
 	if (pfm_flash->base_flash.header.magic == PFM_MAGIC_NUM) {
 		return pfm_flash_get_firmware_v1 (pfm_flash, fw);
 	}
 	else {
-		return pfm_flash_get_firmware_v2 (pfm_flash, fw);
+		return pfm_flash_get_firmware_v2 (pfm_flash, arena, fw);
 	}
 }
 
+static int pfm_flash_get_firmware (struct pfm *pfm, struct pfm_firmware *fw)
+{
+	return pfm_flash_query_firmware (pfm, NULL, fw);
+}
+
+/**
+ * Get the list of firmware components in a PFM, allocating the list from an arena instead of the
+ * heap.  If the arena runs out of space, the heap is used for the remaining allocations.
+ *
+ * The list must still be freed with free_firmware.  This only releases memory allocated from the
+ * heap, so memory from the arena is reclaimed by resetting the arena once the list has been freed.
+ *
+ * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
+ * @param fw Output for the list of firmware.
+ *
+ * @return 0 if the list was generated successfully or an error code.
+ */
+int pfm_flash_get_firmware_arena (struct pfm_flash *pfm, struct arena *arena,
+	struct pfm_firmware *fw)
+{
+	return pfm_flash_query_firmware ((struct pfm*) pfm, arena, fw);
+}
+
 static void pfm_flash_free_fw_versions (struct pfm *pfm, struct pfm_firmware_versions *ver_list)
 {
 	size_t i;
 
 	if ((ver_list != NULL) && (ver_list->versions != NULL)) {
-		for (i = 0; i < ver_list->count; i++) {
-			platform_free ((void*) ver_list->versions[i].fw_version_id);
-		}
+		if (!pfm_flash_index_release_reference (pfm, ver_list->versions)) {
+			for (i = 0; i < ver_list->count; i++) {
+				manifest_flash_free_query (ver_list->versions[i].fw_version_id);
+			}
 
-		platform_free ((void*) ver_list->versions);
+			manifest_flash_free_query (ver_list->versions);
+		}
 
 		memset (ver_list, 0, sizeof (*ver_list));
 	}
@@ -348,6 +539,7 @@ static void pfm_flash_free_fw_versions (struct pfm *pfm, struct pfm_firmware_ver
  * Get the list of supported firmware versions from a v1 formatted PFM.
  *
  * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
  * @param ver_list Output for the list of supported firmware versions.  Null to buffer the output.
  * @param offset Offset to start buffering version strings.
  * @param length Maximum length of version strings to buffer.
@@ -356,7 +548,7 @@ static void pfm_flash_free_fw_versions (struct pfm *pfm, struct pfm_firmware_ver
  *
  * @return 0 if the version list was successfully generated or an error code.
  */
-static int pfm_flash_get_supported_versions_v1 (struct pfm_flash *pfm,
+static int pfm_flash_get_supported_versions_v1 (struct pfm_flash *pfm, struct arena *arena,
 	struct pfm_firmware_versions *ver_list, size_t offset, size_t length, uint8_t *ver_out,
 	int *bytes)
 {
@@ -394,7 +586,8 @@ static int pfm_flash_get_supported_versions_v1 (struct pfm_flash *pfm,
 	}
 
 	if (ver_list) {
-		version_list = platform_calloc (fw_section.fw_count, sizeof (struct pfm_firmware_version));
+		version_list = manifest_flash_calloc_query (arena,
+			fw_section.fw_count, sizeof (struct pfm_firmware_version));
 		if (version_list == NULL) {
 			return PFM_NO_MEMORY;
 		}
@@ -424,7 +617,8 @@ static int pfm_flash_get_supported_versions_v1 (struct pfm_flash *pfm,
 		if (ver_list) {
 			version_list[i].version_addr = fw_header.version_addr;
 			version_list[i].blank_byte = fw_header.blank_byte;
-			version_list[i].fw_version_id = strdup ((char*) version_str);
+			version_list[i].fw_version_id = manifest_flash_strdup_query (arena,
+				(char*) version_str);
 			if (version_list[i].fw_version_id == NULL) {
 				status = PFM_NO_MEMORY;
 				goto error;
@@ -530,6 +724,7 @@ static int pfm_flash_read_firmware_version_element_v2 (struct pfm_flash *pfm, ui
  * Get the list of supported firmware versions from a v2 formatted PFM.
  *
  * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
  * @param fw The firmware ID to query.  This can be null to default to the first firmware ID.
  * @param ver_list Output for the list of supported firmware versions.  Null to buffer the output.
  * @param offset Offset to start buffering version strings.  Updated on output.
@@ -539,9 +734,9 @@ static int pfm_flash_read_firmware_version_element_v2 (struct pfm_flash *pfm, ui
  *
  * @return 0 if the version list was successfully generated or an error code.
  */
-static int pfm_flash_get_supported_versions_v2 (struct pfm_flash *pfm, const char *fw,
-	struct pfm_firmware_versions *ver_list, size_t *offset, size_t *length, uint8_t *ver_out,
-	int *bytes)
+static int pfm_flash_get_supported_versions_v2 (struct pfm_flash *pfm, struct arena *arena,
+	const char *fw, struct pfm_firmware_versions *ver_list, size_t *offset, size_t *length,
+	uint8_t *ver_out, int *bytes)
 {
 	union {
 		struct pfm_firmware_element fw_element;
@@ -580,7 +775,8 @@ static int pfm_flash_get_supported_versions_v2 (struct pfm_flash *pfm, const cha
 	count = buffer.fw_element.version_count;
 	if (ver_list) {
 		ver_list->count = count;
-		version_list = platform_calloc (ver_list->count, sizeof (struct pfm_firmware_version));
+		version_list = manifest_flash_calloc_query (arena,
+			ver_list->count, sizeof (struct pfm_firmware_version));
 		if (version_list == NULL) {
 			return PFM_NO_MEMORY;
 		}
@@ -601,7 +797,8 @@ static int pfm_flash_get_supported_versions_v2 (struct pfm_flash *pfm, const cha
 		if (ver_list) {
 			version_list[i].blank_byte = pfm->flash_dev.blank_byte;
 			version_list[i].version_addr = buffer.ver_element.version_addr;
-			version_list[i].fw_version_id = strdup ((char*) buffer.ver_element.version);
+			version_list[i].fw_version_id = manifest_flash_strdup_query (arena,
+				(char*) buffer.ver_element.version);
 			if (version_list[i].fw_version_id == NULL) {
 				status = PFM_NO_MEMORY;
 				goto error;
@@ -623,10 +820,22 @@ error:
 	return status;
 }
 
-static int pfm_flash_get_supported_versions (struct pfm *pfm, const char *fw,
-	struct pfm_firmware_versions *ver_list)
+/**
+ * Get the list of supported versions for a firmware component in a PFM.
+ *
+ * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
+ * @param fw The firmware ID to query.  This can be null to default to the first firmware ID.
+ * @param ver_list Output for the list of supported versions.
+ *
+ * @return 0 if the list was generated successfully or an error code.
+ */
+static int pfm_flash_query_supported_versions (struct pfm *pfm, struct arena *arena,
+	const char *fw, struct pfm_firmware_versions *ver_list)
 {
 	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
+	const struct pfm_flash_index_fw *fw_info;
+	int status;
 
 	if ((pfm_flash == NULL) || (ver_list == NULL)) {
 		return PFM_INVALID_ARGUMENT;
@@ -636,12 +845,86 @@ static int pfm_flash_get_supported_versions (struct pfm *pfm, const char *fw,
 		return MANIFEST_NO_MANIFEST;
 	}
 
+	platform_mutex_lock (&pfm_flash->index_lock);
+	if (pfm_flash->index != NULL) {
+		fw_info = pfm_flash_index_find_firmware (pfm_flash->index, fw);
+		if (fw_info != NULL) {
+			*ver_list = fw_info->versions;
+			pfm_flash_index_add_reference (pfm_flash->index, ver_list->versions);
+			status = 0;
+		}
+		else if (fw == NULL) {
+			memset (ver_list, 0, sizeof (*ver_list));
+			status = 0;
+		}
+		else {
+			status = PFM_UNKNOWN_FIRMWARE;
+		}
+
+		platform_mutex_unlock (&pfm_flash->index_lock);
+		return status;
+	}
+	platform_mutex_unlock (&pfm_flash->index_lock);
+
 	if (pfm_flash->base_flash.header.magic == PFM_MAGIC_NUM) {
-		return pfm_flash_get_supported_versions_v1 (pfm_flash, ver_list, 0, 1, NULL, NULL);
+		return pfm_flash_get_supported_versions_v1 (pfm_flash, arena, ver_list, 0, 1, NULL,
+			NULL);
 	}
 	else {
-		return pfm_flash_get_supported_versions_v2 (pfm_flash, fw, ver_list, NULL, NULL, NULL,
-			NULL);
+		return pfm_flash_get_supported_versions_v2 (pfm_flash, arena, fw, ver_list, NULL, NULL,
+			NULL, NULL);
+	}
+}
+
+static int pfm_flash_get_supported_versions (struct pfm *pfm, const char *fw,
+	struct pfm_firmware_versions *ver_list)
+{
+	return pfm_flash_query_supported_versions (pfm, NULL, fw, ver_list);
+}
+
+/**
+ * Get the list of supported versions for a firmware component in a PFM, allocating the list from
+ * an arena instead of the heap.  If the arena runs out of space, the heap is used for the remaining
+ * allocations.
+ *
+ * The list must still be freed with free_fw_versions.  This only releases memory allocated from
+ * the heap, so memory from the arena is reclaimed by resetting the arena once the list has been
+ * freed.
+ *
+ * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
+ * @param fw The firmware ID to query.  This can be null to default to the first firmware ID.
+ * @param ver_list Output for the list of supported versions.
+ *
+ * @return 0 if the list was generated successfully or an error code.
+ */
+int pfm_flash_get_supported_versions_arena (struct pfm_flash *pfm, struct arena *arena,
+	const char *fw, struct pfm_firmware_versions *ver_list)
+{
+	return pfm_flash_query_supported_versions ((struct pfm*) pfm, arena, fw, ver_list);
+}
+
+/**
+ * Buffer the list of supported versions for a firmware component from the PFM index.
+ *
+ * @param fw_info The index entry for the firmware component.
+ * @param offset Offset to start buffering version strings.  Updated on output.
+ * @param length Maximum length of version strings to buffer.  Updated on output.
+ * @param ver_out Output for buffering the list of versions.
+ * @param bytes Output for the number of bytes that were buffered.
+ */
+static void pfm_flash_buffer_supported_versions_index (const struct pfm_flash_index_fw *fw_info,
+	size_t *offset, size_t *length, uint8_t *ver_out, int *bytes)
+{
+	const char *version;
+	size_t i = 0;
+
+	while ((i < fw_info->versions.count) && (*length > 0)) {
+		version = fw_info->versions.versions[i].fw_version_id;
+		*bytes += buffer_copy ((const uint8_t*) version, strlen (version) + 1, offset, length,
+			&ver_out[*bytes]);
+
+		i++;
 	}
 }
 
@@ -649,6 +932,7 @@ static int pfm_flash_buffer_supported_versions (struct pfm *pfm, const char *fw,
 	size_t length, uint8_t *ver_list)
 {
 	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
+	const struct pfm_flash_index_fw *fw_info;
 	struct pfm_firmware fw_list;
 	int bytes = 0;
 	int status = 0;
@@ -662,17 +946,49 @@ static int pfm_flash_buffer_supported_versions (struct pfm *pfm, const char *fw,
 		return MANIFEST_NO_MANIFEST;
 	}
 
+	platform_mutex_lock (&pfm_flash->index_lock);
+	if (pfm_flash->index != NULL) {
+		if (fw == NULL) {
+			i = 0;
+			while ((i < pfm_flash->index->fw.count) && (length > 0)) {
+				bytes += buffer_copy ((const uint8_t*) pfm_flash->index->fw.ids[i],
+					strlen (pfm_flash->index->fw.ids[i]) + 1, &offset, &length, &ver_list[bytes]);
+
+				if (length > 0) {
+					pfm_flash_buffer_supported_versions_index (&pfm_flash->index->fw_info[i],
+						&offset, &length, ver_list, &bytes);
+				}
+
+				i++;
+			}
+		}
+		else {
+			fw_info = pfm_flash_index_find_firmware (pfm_flash->index, fw);
+			if (fw_info != NULL) {
+				pfm_flash_buffer_supported_versions_index (fw_info, &offset, &length, ver_list,
+					&bytes);
+			}
+			else {
+				bytes = PFM_UNKNOWN_FIRMWARE;
+			}
+		}
+
+		platform_mutex_unlock (&pfm_flash->index_lock);
+		return bytes;
+	}
+	platform_mutex_unlock (&pfm_flash->index_lock);
+
 	if (pfm_flash->base_flash.header.magic == PFM_MAGIC_NUM) {
 		if (fw != NULL) {
 			return PFM_UNKNOWN_FIRMWARE;
 		}
 
-		status = pfm_flash_get_supported_versions_v1 (pfm_flash, NULL, offset, length, ver_list,
-			&bytes);
+		status = pfm_flash_get_supported_versions_v1 (pfm_flash, NULL, NULL, offset, length,
+			ver_list, &bytes);
 	}
 	else {
 		if (fw == NULL) {
-			status = pfm_flash_get_firmware_v2 (pfm_flash, &fw_list);
+			status = pfm_flash_get_firmware_v2 (pfm_flash, NULL, &fw_list);
 			if (status != 0) {
 				return status;
 			}
@@ -683,8 +999,8 @@ static int pfm_flash_buffer_supported_versions (struct pfm *pfm, const char *fw,
 					&offset, &length, &ver_list[bytes]);
 
 				if (length > 0) {
-					status = pfm_flash_get_supported_versions_v2 (pfm_flash, fw_list.ids[i], NULL,
-						&offset, &length, ver_list, &bytes);
+					status = pfm_flash_get_supported_versions_v2 (pfm_flash, NULL,
+						fw_list.ids[i], NULL, &offset, &length, ver_list, &bytes);
 				}
 
 				i++;
@@ -693,8 +1009,8 @@ static int pfm_flash_buffer_supported_versions (struct pfm *pfm, const char *fw,
 			pfm_flash_free_firmware (pfm, &fw_list);
 		}
 		else {
-			status = pfm_flash_get_supported_versions_v2 (pfm_flash, fw, NULL, &offset, &length,
-				ver_list, &bytes);
+			status = pfm_flash_get_supported_versions_v2 (pfm_flash, NULL, fw, NULL, &offset,
+				&length, ver_list, &bytes);
 		}
 	}
 
@@ -854,8 +1170,10 @@ static void pfm_flash_free_read_write_regions (struct pfm *pfm,
 	struct pfm_read_write_regions *writable)
 {
 	if (writable != NULL) {
-		platform_free ((void*) writable->regions);
-		platform_free ((void*) writable->properties);
+		if (!pfm_flash_index_release_reference (pfm, writable->regions)) {
+			manifest_flash_free_query (writable->regions);
+			manifest_flash_free_query (writable->properties);
+		}
 
 		memset (writable, 0, sizeof (*writable));
 	}
@@ -865,13 +1183,14 @@ static void pfm_flash_free_read_write_regions (struct pfm *pfm,
  * Get the list of read/write regions for a firmware version from a v1 formatted PFM.
  *
  * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
  * @param version The firmware version to query.
  * @param writable Output for the list of read/write regions.
  *
  * @return 0 if the list was successfully generated or an error code.
  */
-static int pfm_flash_get_read_write_regions_v1 (struct pfm_flash *pfm, const char *version,
-	struct pfm_read_write_regions *writable)
+static int pfm_flash_get_read_write_regions_v1 (struct pfm_flash *pfm, struct arena *arena,
+	const char *version, struct pfm_read_write_regions *writable)
 {
 	struct pfm_firmware_header fw_header;
 	struct flash_region *region_list;
@@ -884,14 +1203,16 @@ static int pfm_flash_get_read_write_regions_v1 (struct pfm_flash *pfm, const cha
 		return status;
 	}
 
-	region_list = platform_calloc (fw_header.rw_count, sizeof (struct flash_region));
+	region_list = manifest_flash_calloc_query (arena,
+		fw_header.rw_count, sizeof (struct flash_region));
 	if (region_list == NULL) {
 		return PFM_NO_MEMORY;
 	}
 
 	writable->regions = region_list;
 	writable->count = fw_header.rw_count;
-	writable->properties = platform_calloc (fw_header.rw_count, sizeof (struct pfm_read_write));
+	writable->properties = manifest_flash_calloc_query (arena,
+		fw_header.rw_count, sizeof (struct pfm_read_write));
 	if (writable->properties == NULL) {
 		status = PFM_NO_MEMORY;
 		goto error;
@@ -960,14 +1281,15 @@ static int pfm_flash_find_firmware_version_element_v2 (struct pfm_flash *pfm, co
  * Get the list of read/write regions for a firmware version from a v2 formatted PFM.
  *
  * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
  * @param fw The firmware ID to query.  This can be null to default to the first firmware ID.
  * @param version The firmware version to query.
  * @param writable Output for the list of read/write regions.
  *
  * @return 0 if the list was successfully generated or an error code.
  */
-static int pfm_flash_get_read_write_regions_v2 (struct pfm_flash *pfm, const char *fw,
-	const char *version, struct pfm_read_write_regions *writable)
+static int pfm_flash_get_read_write_regions_v2 (struct pfm_flash *pfm, struct arena *arena,
+	const char *fw, const char *version, struct pfm_read_write_regions *writable)
 {
 	union {
 		struct pfm_firmware_element fw_element;
@@ -1037,12 +1359,14 @@ static int pfm_flash_get_read_write_regions_v2 (struct pfm_flash *pfm, const cha
 	}
 
 	writable->count = buffer.ver_element.rw_count;
-	writable->regions = platform_calloc (writable->count, sizeof (struct flash_region));
+	writable->regions = manifest_flash_calloc_query (arena,
+		writable->count, sizeof (struct flash_region));
 	if (writable->regions == NULL) {
 		return PFM_NO_MEMORY;
 	}
 
-	writable->properties = platform_calloc (writable->count, sizeof (struct pfm_read_write));
+	writable->properties = manifest_flash_calloc_query (arena,
+		writable->count, sizeof (struct pfm_read_write));
 	if (writable->properties == NULL) {
 		status = PFM_NO_MEMORY;
 		goto error;
@@ -1071,10 +1395,23 @@ error:
 	return status;
 }
 
-static int pfm_flash_get_read_write_regions (struct pfm *pfm, const char *fw, const char *version,
-	struct pfm_read_write_regions *writable)
+/**
+ * Get the list of read/write regions for a firmware version in a PFM.
+ *
+ * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
+ * @param fw The firmware ID to query.  This can be null to default to the first firmware ID.
+ * @param version The firmware version to query.
+ * @param writable Output for the list of read/write regions.
+ *
+ * @return 0 if the list was generated successfully or an error code.
+ */
+static int pfm_flash_query_read_write_regions (struct pfm *pfm, struct arena *arena,
+	const char *fw, const char *version, struct pfm_read_write_regions *writable)
 {
 	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
+	const struct pfm_flash_index_version *info;
+	int status;
 
 	if ((pfm_flash == NULL) || (version == NULL) || (writable == NULL)) {
 		return PFM_INVALID_ARGUMENT;
@@ -1084,33 +1421,80 @@ static int pfm_flash_get_read_write_regions (struct pfm *pfm, const char *fw, co
 		return MANIFEST_NO_MANIFEST;
 	}
 
+	platform_mutex_lock (&pfm_flash->index_lock);
+	if (pfm_flash->index != NULL) {
+		status = pfm_flash_index_find_version (pfm_flash->index, fw, version, &info);
+		if (status == 0) {
+			*writable = info->rw;
+			pfm_flash_index_add_reference (pfm_flash->index, writable->regions);
+		}
+
+		platform_mutex_unlock (&pfm_flash->index_lock);
+		return status;
+	}
+	platform_mutex_unlock (&pfm_flash->index_lock);
+
 	if (pfm_flash->base_flash.header.magic == PFM_MAGIC_NUM) {
-		return pfm_flash_get_read_write_regions_v1 (pfm_flash, version, writable);
+		return pfm_flash_get_read_write_regions_v1 (pfm_flash, arena, version, writable);
 	}
 	else {
-		return pfm_flash_get_read_write_regions_v2 (pfm_flash, fw, version, writable);
+		return pfm_flash_get_read_write_regions_v2 (pfm_flash, arena, fw, version, writable);
 	}
 }
 
+static int pfm_flash_get_read_write_regions (struct pfm *pfm, const char *fw, const char *version,
+	struct pfm_read_write_regions *writable)
+{
+	return pfm_flash_query_read_write_regions (pfm, NULL, fw, version, writable);
+}
+
+/**
+ * Get the list of read/write regions for a firmware version in a PFM, allocating the list from an
+ * arena instead of the heap.  If the arena runs out of space, the heap is used for the remaining
+ * allocations.
+ *
+ * The list must still be freed with free_read_write_regions.  This only releases memory allocated
+ * from the heap, so memory from the arena is reclaimed by resetting the arena once the list has
+ * been freed.
+ *
+ * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
+ * @param fw The firmware ID to query.  This can be null to default to the first firmware ID.
+ * @param version The firmware version to query.
+ * @param writable Output for the list of read/write regions.
+ *
+ * @return 0 if the list was generated successfully or an error code.
+ */
+int pfm_flash_get_read_write_regions_arena (struct pfm_flash *pfm, struct arena *arena,
+	const char *fw, const char *version, struct pfm_read_write_regions *writable)
+{
+	return pfm_flash_query_read_write_regions ((struct pfm*) pfm, arena, fw, version, writable);
+}
+
 static void pfm_flash_free_firmware_images (struct pfm *pfm, struct pfm_image_list *img_list)
 {
 	size_t i;
 
 	if (img_list != NULL) {
+		if (pfm_flash_index_release_reference (pfm, img_list->images_hash)) {
+			memset (img_list, 0, sizeof (*img_list));
+			return;
+		}
+
 		if (img_list->images_sig != NULL) {
 			for (i = 0; i < img_list->count; i++) {
-				platform_free ((void*) img_list->images_sig[i].regions);
+				manifest_flash_free_query (img_list->images_sig[i].regions);
 			}
 
-			platform_free ((void*) img_list->images_sig);
+			manifest_flash_free_query (img_list->images_sig);
 		}
 
 		if (img_list->images_hash != NULL) {
 			for (i = 0; i < img_list->count; i++) {
-				platform_free ((void*) img_list->images_hash[i].regions);
+				manifest_flash_free_query (img_list->images_hash[i].regions);
 			}
 
-			platform_free ((void*) img_list->images_hash);
+			manifest_flash_free_query (img_list->images_hash);
 		}
 
 		memset (img_list, 0, sizeof (*img_list));
@@ -1121,13 +1505,14 @@ static void pfm_flash_free_firmware_images (struct pfm *pfm, struct pfm_image_li
  * Get the list of signed images for a version of firmware from a v1 formatted PFM.
  *
  * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
  * @param version The firmware version to query.
  * @param img_list Output for the list of signed images.
  *
  * @return 0 if the list was successfully generated or an error code.
  */
-static int pfm_flash_get_firmware_images_v1 (struct pfm_flash *pfm, const char *version,
-	struct pfm_image_list *img_list)
+static int pfm_flash_get_firmware_images_v1 (struct pfm_flash *pfm, struct arena *arena,
+	const char *version, struct pfm_image_list *img_list)
 {
 	struct pfm_firmware_header fw_header;
 	struct pfm_image_header img_header;
@@ -1149,7 +1534,8 @@ static int pfm_flash_get_firmware_images_v1 (struct pfm_flash *pfm, const char *
 		return status;
 	}
 
-	images = platform_calloc (fw_header.img_count, sizeof (struct pfm_image_signature));
+	images = manifest_flash_calloc_query (arena,
+		fw_header.img_count, sizeof (struct pfm_image_signature));
 	if (images == NULL) {
 		return PFM_NO_MEMORY;
 	}
@@ -1176,7 +1562,8 @@ static int pfm_flash_get_firmware_images_v1 (struct pfm_flash *pfm, const char *
 			goto error;
 		}
 
-		region_list = platform_calloc (img_header.region_count, sizeof (struct flash_region));
+		region_list = manifest_flash_calloc_query (arena,
+			img_header.region_count, sizeof (struct flash_region));
 		if (region_list == NULL) {
 			status = PFM_NO_MEMORY;
 			goto error;
@@ -1291,14 +1678,15 @@ static uint32_t pfm_flash_get_image_length_v2 (struct pfm_fw_version_element_ima
  * Get the list of signed images for a version of firmware from a v2 formatted PFM.
  *
  * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
  * @param fw The firmware ID to query.  This can be null to default to the first firmware ID.
  * @param version The firmware version to query.
  * @param img_list Output for the list of signed images.
  *
  * @return 0 if the list was successfully generated or an error code.
  */
-static int pfm_flash_get_firmware_images_v2 (struct pfm_flash *pfm, const char *fw,
-	const char *version, struct pfm_image_list *img_list)
+static int pfm_flash_get_firmware_images_v2 (struct pfm_flash *pfm, struct arena *arena,
+	const char *fw, const char *version, struct pfm_image_list *img_list)
 {
 	union {
 		struct pfm_firmware_element fw_element;
@@ -1336,7 +1724,8 @@ static int pfm_flash_get_firmware_images_v2 (struct pfm_flash *pfm, const char *
 
 	img_list->count = buffer.ver_element.img_count;
 	img_list->images_sig = NULL;
-	img_list->images_hash = platform_calloc (img_list->count, sizeof (struct pfm_image_hash));
+	img_list->images_hash = manifest_flash_calloc_query (arena,
+		img_list->count, sizeof (struct pfm_image_hash));
 	if (img_list->images_hash == NULL) {
 		return PFM_NO_MEMORY;
 	}
@@ -1411,7 +1800,8 @@ static int pfm_flash_get_firmware_images_v2 (struct pfm_flash *pfm, const char *
 
 		images = (struct pfm_image_hash*) img_list->images_hash;
 		images[i].count = img->region_count;
-		images[i].regions = platform_calloc (images[i].count, sizeof (struct flash_region));
+		images[i].regions = manifest_flash_calloc_query (arena,
+			images[i].count, sizeof (struct flash_region));
 		if (images[i].regions == NULL) {
 			status = PFM_NO_MEMORY;
 			goto error;
@@ -1467,10 +1857,23 @@ error:
 	return status;
 }
 
-static int pfm_flash_get_firmware_images (struct pfm *pfm, const char *fw, const char *version,
-	struct pfm_image_list *img_list)
+/**
+ * Get the list of authenticated images for a firmware version in a PFM.
+ *
+ * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
+ * @param fw The firmware ID to query.  This can be null to default to the first firmware ID.
+ * @param version The firmware version to query.
+ * @param img_list Output for the list of images.
+ *
+ * @return 0 if the list was generated successfully or an error code.
+ */
+static int pfm_flash_query_firmware_images (struct pfm *pfm, struct arena *arena,
+	const char *fw, const char *version, struct pfm_image_list *img_list)
 {
 	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
+	const struct pfm_flash_index_version *info;
+	int status;
 
 	if ((pfm_flash == NULL) || (version == NULL) || (img_list == NULL)) {
 		return PFM_INVALID_ARGUMENT;
@@ -1480,14 +1883,56 @@ static int pfm_flash_get_firmware_images (struct pfm *pfm, const char *fw, const
 		return MANIFEST_NO_MANIFEST;
 	}
 
+	platform_mutex_lock (&pfm_flash->index_lock);
+	if (pfm_flash->index != NULL) {
+		status = pfm_flash_index_find_version (pfm_flash->index, fw, version, &info);
+		if (status == 0) {
+			*img_list = info->images;
+			pfm_flash_index_add_reference (pfm_flash->index, img_list->images_hash);
+		}
+
+		platform_mutex_unlock (&pfm_flash->index_lock);
+		return status;
+	}
+	platform_mutex_unlock (&pfm_flash->index_lock);
+
 	if (pfm_flash->base_flash.header.magic == PFM_MAGIC_NUM) {
-		return pfm_flash_get_firmware_images_v1 (pfm_flash, version, img_list);
+		return pfm_flash_get_firmware_images_v1 (pfm_flash, arena, version, img_list);
 	}
 	else {
-		return pfm_flash_get_firmware_images_v2 (pfm_flash, fw, version, img_list);
+		return pfm_flash_get_firmware_images_v2 (pfm_flash, arena, fw, version, img_list);
 	}
 }
 
+static int pfm_flash_get_firmware_images (struct pfm *pfm, const char *fw, const char *version,
+	struct pfm_image_list *img_list)
+{
+	return pfm_flash_query_firmware_images (pfm, NULL, fw, version, img_list);
+}
+
+/**
+ * Get the list of authenticated images for a firmware version in a PFM, allocating the list from
+ * an arena instead of the heap.  If the arena runs out of space, the heap is used for the remaining
+ * allocations.
+ *
+ * The list must still be freed with free_firmware_images.  This only releases memory allocated from
+ * the heap, so memory from the arena is reclaimed by resetting the arena once the list has been
+ * freed.
+ *
+ * @param pfm The PFM to query.
+ * @param arena The arena to allocate the list from.  Null to allocate from the heap.
+ * @param fw The firmware ID to query.  This can be null to default to the first firmware ID.
+ * @param version The firmware version to query.
+ * @param img_list Output for the list of images.
+ *
+ * @return 0 if the list was generated successfully or an error code.
+ */
+int pfm_flash_get_firmware_images_arena (struct pfm_flash *pfm, struct arena *arena,
+	const char *fw, const char *version, struct pfm_image_list *img_list)
+{
+	return pfm_flash_query_firmware_images ((struct pfm*) pfm, arena, fw, version, img_list);
+}
+
 /**
  * Initialize the interface to a PFM residing in flash memory.
  *
@@ -1501,12 +1946,16 @@ static int pfm_flash_get_firmware_images (struct pfm *pfm, const char *fw, const
  * @param max_signature The maximum supported length for a manifest signature.
  * @param platform_id_cache Buffer to hold the manifest platform ID.
  * @param max_platform_id The maximum platform ID length supported, including the NULL terminator.
+ * @param toc_cache Optional buffer to hold the verified table of contents.  This should be static
+ * storage that lives as long as the PFM instance.  Null to validate every element access from
+ * flash.
+ * @param max_toc_cache The size of the table of contents cache buffer.
  *
  * @return 0 if the PFM instance was initialized successfully or an error code.
  */
 int pfm_flash_init (struct pfm_flash *pfm, struct flash *flash, struct hash_engine *hash,
 	uint32_t base_addr, uint8_t *signature_cache, size_t max_signature, uint8_t *platform_id_cache,
-	size_t max_platform_id)
+	size_t max_platform_id, uint8_t *toc_cache, size_t max_toc_cache)
 {
 	int status;
 
@@ -1522,6 +1971,14 @@ int pfm_flash_init (struct pfm_flash *pfm, struct flash *flash, struct hash_engi
 		return status;
 	}
 
+	manifest_flash_enable_toc_cache (&pfm->base_flash, toc_cache, max_toc_cache);
+
+	status = platform_mutex_init (&pfm->index_lock);
+	if (status != 0) {
+		manifest_flash_release (&pfm->base_flash);
+		return status;
+	}
+
 	pfm->base.base.verify = pfm_flash_verify;
 	pfm->base.base.get_id = pfm_flash_get_id;
 	pfm->base.base.get_platform_id = pfm_flash_get_platform_id;
@@ -1550,7 +2007,406 @@ int pfm_flash_init (struct pfm_flash *pfm, struct flash *flash, struct hash_engi
  */
 void pfm_flash_release (struct pfm_flash *pfm)
 {
+	struct pfm_flash_index *index;
+
 	if (pfm != NULL) {
+		pfm_flash_discard_index (pfm);
+
+		while (pfm->retired != NULL) {
+			index = pfm->retired;
+			pfm->retired = index->next;
+			platform_free (index);
+		}
+
+		platform_mutex_free (&pfm->index_lock);
 		manifest_flash_release (&pfm->base_flash);
 	}
 }
+
+/**
+ * Number of entries of each type stored in a PFM index.
+ */
+struct pfm_flash_index_layout {
+	size_t versions;							/**< Number of firmware versions. */
+	size_t regions;								/**< Number of read/write and image flash regions. */
+	size_t rw;									/**< Number of read/write regions. */
+	size_t images;								/**< Number of authenticated images. */
+	size_t strings;								/**< Total length of all identifier strings. */
+};
+
+/**
+ * Storage within the index allocation for each type of entry.
+ */
+struct pfm_flash_index_pools {
+	const char **fw_ids;						/**< Firmware ID list. */
+	struct pfm_flash_index_fw *fw_info;			/**< Per-firmware version lists. */
+	struct pfm_firmware_version *versions;		/**< Firmware versions for all components. */
+	struct pfm_flash_index_version *info;		/**< Regions and images for each version. */
+	struct pfm_image_hash *images;				/**< Authenticated images for all versions. */
+	struct flash_region *regions;				/**< Flash regions for all versions and images. */
+	struct pfm_read_write *properties;			/**< Properties for all read/write regions. */
+	char *strings;								/**< Firmware and version identifiers. */
+};
+
+/**
+ * Release the lists read from a v2 formatted PFM to build the index.
+ *
+ * @param pfm The PFM that provided the lists.
+ * @param lists The lists for each firmware component.
+ * @param count The number of firmware components.
+ */
+static void pfm_flash_index_free_lists_v2 (struct pfm_flash *pfm, struct pfm_flash_index_fw *lists,
+	size_t count)
+{
+	struct pfm_flash_index_version *info;
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < count; i++) {
+		info = (struct pfm_flash_index_version*) lists[i].info;
+		if (info != NULL) {
+			for (j = 0; j < lists[i].versions.count; j++) {
+				pfm_flash_free_read_write_regions (&pfm->base, &info[j].rw);
+				pfm_flash_free_firmware_images (&pfm->base, &info[j].images);
+			}
+
+			platform_free (info);
+		}
+
+		pfm_flash_free_fw_versions (&pfm->base, &lists[i].versions);
+	}
+
+	platform_free (lists);
+}
+
+/**
+ * Read the versions, read/write regions, and images for every firmware component in a v2 formatted
+ * PFM.  The lists are stored using the same structure as the index, but each list is allocated
+ * separately.
+ *
+ * @param pfm The PFM being indexed.
+ * @param fw_list The list of firmware components in the PFM.
+ * @param lists Output for the lists for each firmware component.  This must be zeroed and large
+ * enough for every firmware component in the PFM.
+ * @param layout Output for the number of entries of each type needed in the index.
+ *
+ * @return 0 if all lists were read successfully or an error code.
+ */
+static int pfm_flash_index_read_lists_v2 (struct pfm_flash *pfm,
+	const struct pfm_firmware *fw_list, struct pfm_flash_index_fw *lists,
+	struct pfm_flash_index_layout *layout)
+{
+	struct pfm_flash_index_version *info;
+	const char *version;
+	size_t i;
+	size_t j;
+	size_t k;
+	int status;
+
+	memset (layout, 0, sizeof (*layout));
+
+	for (i = 0; i < fw_list->count; i++) {
+		status = pfm_flash_get_supported_versions_v2 (pfm, NULL, fw_list->ids[i],
+			&lists[i].versions, NULL, NULL, NULL, NULL);
+		if (status != 0) {
+			return status;
+		}
+
+		layout->strings += strlen (fw_list->ids[i]) + 1;
+		layout->versions += lists[i].versions.count;
+
+		if (lists[i].versions.count == 0) {
+			continue;
+		}
+
+		info = platform_calloc (lists[i].versions.count, sizeof (struct pfm_flash_index_version));
+		if (info == NULL) {
+			return PFM_NO_MEMORY;
+		}
+
+		lists[i].info = info;
+
+		for (j = 0; j < lists[i].versions.count; j++) {
+			version = lists[i].versions.versions[j].fw_version_id;
+
+			status = pfm_flash_get_read_write_regions_v2 (pfm, NULL, fw_list->ids[i], version,
+				&info[j].rw);
+			if (status != 0) {
+				return status;
+			}
+
+			status = pfm_flash_get_firmware_images_v2 (pfm, NULL, fw_list->ids[i], version,
+				&info[j].images);
+			if (status != 0) {
+				return status;
+			}
+
+			layout->strings += strlen (version) + 1;
+			layout->rw += info[j].rw.count;
+			layout->regions += info[j].rw.count;
+			layout->images += info[j].images.count;
+
+			for (k = 0; k < info[j].images.count; k++) {
+				layout->regions += info[j].images.images_hash[k].count;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Add a string to the PFM index.
+ *
+ * @param pools Index storage.
+ * @param pos Current position in each index pool.  This will be updated for the added string.
+ * @param str The string to add.
+ *
+ * @return The copy of the string in the index.
+ */
+static const char* pfm_flash_index_add_string (const struct pfm_flash_index_pools *pools,
+	struct pfm_flash_index_layout *pos, const char *str)
+{
+	size_t length = strlen (str) + 1;
+	char *entry = &pools->strings[pos->strings];
+
+	memcpy (entry, str, length);
+	pos->strings += length;
+
+	return entry;
+}
+
+/**
+ * Add a list of flash regions to the PFM index.
+ *
+ * @param pools Index storage.
+ * @param pos Current position in each index pool.  This will be updated for the added regions.
+ * @param regions The list of regions to add.
+ * @param count The number of regions in the list.
+ *
+ * @return The copy of the regions in the index or null if there are no regions.
+ */
+static const struct flash_region* pfm_flash_index_add_regions (
+	const struct pfm_flash_index_pools *pools, struct pfm_flash_index_layout *pos,
+	const struct flash_region *regions, size_t count)
+{
+	struct flash_region *entry;
+
+	if (count == 0) {
+		return NULL;
+	}
+
+	entry = &pools->regions[pos->regions];
+	memcpy (entry, regions, sizeof (*regions) * count);
+	pos->regions += count;
+
+	return entry;
+}
+
+/**
+ * Add a single firmware version, with its read/write regions and images, to the PFM index.
+ *
+ * @param pools Index storage.
+ * @param pos Current position in each index pool.  This will be updated for the added version.
+ * @param version The firmware version to add.
+ * @param src The read/write regions and images for the version.
+ */
+static void pfm_flash_index_add_version (const struct pfm_flash_index_pools *pools,
+	struct pfm_flash_index_layout *pos, const struct pfm_firmware_version *version,
+	const struct pfm_flash_index_version *src)
+{
+	struct pfm_firmware_version *entry = &pools->versions[pos->versions];
+	struct pfm_flash_index_version *info = &pools->info[pos->versions];
+	struct pfm_read_write *properties;
+	struct pfm_image_hash *images;
+	size_t i;
+
+	*entry = *version;
+	entry->fw_version_id = pfm_flash_index_add_string (pools, pos, version->fw_version_id);
+
+	memset (info, 0, sizeof (*info));
+	info->rw.count = src->rw.count;
+	info->rw.regions = pfm_flash_index_add_regions (pools, pos, src->rw.regions, src->rw.count);
+	if (src->rw.count != 0) {
+		properties = &pools->properties[pos->rw];
+		memcpy (properties, src->rw.properties, sizeof (*properties) * src->rw.count);
+
+		info->rw.properties = properties;
+		pos->rw += src->rw.count;
+	}
+
+	info->images.count = src->images.count;
+	if (src->images.count != 0) {
+		images = &pools->images[pos->images];
+		for (i = 0; i < src->images.count; i++) {
+			images[i] = src->images.images_hash[i];
+			images[i].regions = pfm_flash_index_add_regions (pools, pos,
+				src->images.images_hash[i].regions, src->images.images_hash[i].count);
+		}
+
+		info->images.images_hash = images;
+		pos->images += src->images.count;
+	}
+
+	pos->versions++;
+}
+
+/**
+ * Build an in-memory index of the firmware components, versions, authenticated images, and
+ * read/write regions defined in the PFM.  Once the index has been built, these PFM queries will be
+ * served from the index without reading flash or allocating memory.  Query results point directly
+ * into the index.  They must still be freed by the caller, which releases the query's reference to
+ * the index, and they remain valid until freed even if the index is discarded in the meantime.
+ *
+ * The PFM contents are read from flash once, and the index is stored in a single allocation sized
+ * for the PFM contents.  It is discarded when the PFM is verified again or released.  Only v2
+ * formatted PFMs are indexed.
+ *
+ * @param pfm The PFM to index.  The PFM must have been successfully verified.
+ *
+ * @return 0 if the index was built successfully or an error code.  Failure to build an index does
+ * not affect the ability to query the PFM.
+ */
+int pfm_flash_build_index (struct pfm_flash *pfm)
+{
+	struct pfm_firmware fw_list;
+	struct pfm_flash_index_fw *lists = NULL;
+	struct pfm_flash_index_layout layout;
+	struct pfm_flash_index_pools pools;
+	struct pfm_flash_index *index;
+	size_t length;
+	size_t i;
+	size_t j;
+	uint8_t *next;
+	int status;
+
+	if (pfm == NULL) {
+		return PFM_INVALID_ARGUMENT;
+	}
+
+	pfm_flash_discard_index (pfm);
+
+	if (!pfm->base_flash.manifest_valid) {
+		return MANIFEST_NO_MANIFEST;
+	}
+
+	if (pfm->base_flash.header.magic == PFM_MAGIC_NUM) {
+		return 0;
+	}
+
+	status = pfm_flash_get_firmware_v2 (pfm, NULL, &fw_list);
+	if (status != 0) {
+		return status;
+	}
+
+	if (fw_list.count != 0) {
+		lists = platform_calloc (fw_list.count, sizeof (struct pfm_flash_index_fw));
+		if (lists == NULL) {
+			status = PFM_NO_MEMORY;
+			goto free_fw;
+		}
+	}
+
+	status = pfm_flash_index_read_lists_v2 (pfm, &fw_list, lists, &layout);
+	if (status != 0) {
+		goto free_lists;
+	}
+
+	/* Every entry type has a size that is a multiple of its alignment.  Ordering the entries from
+	 * the strictest alignment to the least ensures all entries are aligned without padding. */
+	length = sizeof (struct pfm_flash_index) +
+		(fw_list.count * (sizeof (char*) + sizeof (struct pfm_flash_index_fw))) +
+		(layout.versions *
+			(sizeof (struct pfm_firmware_version) + sizeof (struct pfm_flash_index_version))) +
+		(layout.images * sizeof (struct pfm_image_hash)) +
+		(layout.regions * sizeof (struct flash_region)) +
+		(layout.rw * sizeof (struct pfm_read_write)) + layout.strings;
+
+	index = platform_malloc (length);
+	if (index == NULL) {
+		status = PFM_NO_MEMORY;
+		goto free_lists;
+	}
+
+	next = (uint8_t*) &index[1];
+	pools.fw_ids = (const char**) next;
+	next += fw_list.count * sizeof (char*);
+	pools.fw_info = (struct pfm_flash_index_fw*) next;
+	next += fw_list.count * sizeof (struct pfm_flash_index_fw);
+	pools.versions = (struct pfm_firmware_version*) next;
+	next += layout.versions * sizeof (struct pfm_firmware_version);
+	pools.info = (struct pfm_flash_index_version*) next;
+	next += layout.versions * sizeof (struct pfm_flash_index_version);
+	pools.images = (struct pfm_image_hash*) next;
+	next += layout.images * sizeof (struct pfm_image_hash);
+	pools.regions = (struct flash_region*) next;
+	next += layout.regions * sizeof (struct flash_region);
+	pools.properties = (struct pfm_read_write*) next;
+	next += layout.rw * sizeof (struct pfm_read_write);
+	pools.strings = (char*) next;
+
+	memset (&layout, 0, sizeof (layout));
+	for (i = 0; i < fw_list.count; i++) {
+		pools.fw_ids[i] = pfm_flash_index_add_string (&pools, &layout, fw_list.ids[i]);
+
+		pools.fw_info[i].versions.count = lists[i].versions.count;
+		if (lists[i].versions.count != 0) {
+			pools.fw_info[i].versions.versions = &pools.versions[layout.versions];
+			pools.fw_info[i].info = &pools.info[layout.versions];
+		}
+		else {
+			pools.fw_info[i].versions.versions = NULL;
+			pools.fw_info[i].info = NULL;
+		}
+
+		for (j = 0; j < lists[i].versions.count; j++) {
+			pfm_flash_index_add_version (&pools, &layout, &lists[i].versions.versions[j],
+				&lists[i].info[j]);
+		}
+	}
+
+	index->length = length;
+	index->refs = 0;
+	index->next = NULL;
+	index->fw.ids = (fw_list.count != 0) ? pools.fw_ids : NULL;
+	index->fw.count = fw_list.count;
+	index->fw_info = pools.fw_info;
+
+	platform_mutex_lock (&pfm->index_lock);
+	pfm->index = index;
+	platform_mutex_unlock (&pfm->index_lock);
+
+free_lists:
+	pfm_flash_index_free_lists_v2 (pfm, lists, fw_list.count);
+free_fw:
+	pfm_flash_free_firmware (&pfm->base, &fw_list);
+	return status;
+}
+
+/**
+ * Discard the in-memory index for the PFM.  PFM queries will read the data from flash.
+ *
+ * Lists returned by PFM queries that point into the index remain valid after the index has been
+ * discarded.  The index memory is not freed until all of these query results have been freed.
+ *
+ * @param pfm The PFM to update.
+ */
+void pfm_flash_discard_index (struct pfm_flash *pfm)
+{
+	struct pfm_flash_index *index;
+
+	if (pfm != NULL) {
+		platform_mutex_lock (&pfm->index_lock);
+		index = pfm->index;
+		pfm->index = NULL;
+
+		if ((index != NULL) && (index->refs != 0)) {
+			index->next = pfm->retired;
+			pfm->retired = index;
+			index = NULL;
+		}
+		platform_mutex_unlock (&pfm->index_lock);
+
+		platform_free (index);
+	}
+}
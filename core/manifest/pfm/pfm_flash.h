@@ -9,8 +9,39 @@
 #include "pfm_format.h"
 #include "manifest/manifest_flash.h"
 #include "flash/flash.h"
+#include "platform.h"
 
 
+/**
+ * Regions and images defined for a single firmware version in a PFM index.
+ */
+struct pfm_flash_index_version {
+	struct pfm_read_write_regions rw;			/**< The read/write regions for the version. */
+	struct pfm_image_list images;				/**< The authenticated images for the version. */
+};
+
+/**
+ * Versions defined for a single firmware component in a PFM index.
+ */
+struct pfm_flash_index_fw {
+	struct pfm_firmware_versions versions;		/**< The list of supported firmware versions. */
+	const struct pfm_flash_index_version *info;	/**< Regions and images for each version. */
+};
+
+/**
+ * A read-only copy of the firmware, version, image, and read/write region information contained in
+ * a PFM.  All data for the index is stored in a single contiguous allocation.  PFM queries return
+ * lists that point directly into the index, and each of these query results holds a reference to
+ * the index until it is freed.
+ */
+struct pfm_flash_index {
+	size_t length;								/**< Total size of the index allocation. */
+	size_t refs;								/**< Number of query results referencing the index. */
+	struct pfm_flash_index *next;				/**< Next discarded index that is still referenced. */
+	struct pfm_firmware fw;						/**< The list of firmware components. */
+	const struct pfm_flash_index_fw *fw_info;	/**< Version information for each component. */
+};
+
 /**
  * Defines a PFM that is stored in flash memory.
  */
@@ -19,13 +50,28 @@ struct pfm_flash {
 	struct manifest_flash base_flash;			/**< The base PFM flash instance. */
 	struct pfm_flash_device_element flash_dev;	/**< Flash device element for the PFM. */
 	int flash_dev_format;						/**< Format of the flash device element. */
+	struct pfm_flash_index *index;				/**< In-memory index of the PFM contents. */
+	struct pfm_flash_index *retired;			/**< Discarded indexes still referenced by queries. */
+	platform_mutex index_lock;					/**< Synchronization for access to the index. */
 };
 
 
 int pfm_flash_init (struct pfm_flash *pfm, struct flash *flash, struct hash_engine *hash,
 	uint32_t base_addr, uint8_t *signature_cache, size_t max_signature, uint8_t *platform_id_cache,
-	size_t max_platform_id);
+	size_t max_platform_id, uint8_t *toc_cache, size_t max_toc_cache);
 void pfm_flash_release (struct pfm_flash *pfm);
 
+int pfm_flash_get_firmware_arena (struct pfm_flash *pfm, struct arena *arena,
+	struct pfm_firmware *fw);
+int pfm_flash_get_supported_versions_arena (struct pfm_flash *pfm, struct arena *arena,
+	const char *fw, struct pfm_firmware_versions *ver_list);
+int pfm_flash_get_read_write_regions_arena (struct pfm_flash *pfm, struct arena *arena,
+	const char *fw, const char *version, struct pfm_read_write_regions *writable);
+int pfm_flash_get_firmware_images_arena (struct pfm_flash *pfm, struct arena *arena,
+	const char *fw, const char *version, struct pfm_image_list *img_list);
+
+int pfm_flash_build_index (struct pfm_flash *pfm);
+void pfm_flash_discard_index (struct pfm_flash *pfm);
+
 
 #endif //PFM_FLASH_H
@@ -53,6 +53,22 @@ static void pfm_manager_flash_free_pfm (struct pfm_manager *manager, struct pfm
 	manifest_manager_flash_free_manifest (&pfm_mgr->manifest_manager, (struct manifest*) pfm);
 }
 
+/**
+ * Build the in-memory index for the active PFM so PFM queries do not need to access flash.
+ *
+ * @param manager The PFM manager to update.
+ */
+static void pfm_manager_flash_index_active_pfm (struct pfm_manager_flash *manager)
+{
+	struct manifest_manager_flash_region *region;
+
+	region = manifest_manager_flash_get_region (&manager->manifest_manager, true);
+	if (region->is_valid) {
+		/* The index is only an optimization.  Queries fall back to reading flash without it. */
+		pfm_flash_build_index ((struct pfm_flash*) region->manifest);
+	}
+}
+
 static int pfm_manager_flash_activate_pending_pfm (struct manifest_manager *manager)
 {
 	struct pfm_manager_flash *pfm_mgr = (struct pfm_manager_flash*) manager;
@@ -64,6 +80,7 @@ static int pfm_manager_flash_activate_pending_pfm (struct manifest_manager *mana
 
 	status = manifest_manager_flash_activate_pending_manifest (&pfm_mgr->manifest_manager);
 	if (status == 0) {
+		pfm_manager_flash_index_active_pfm (pfm_mgr);
 		host_state_manager_set_pfm_dirty (pfm_mgr->host_state, false);
 		pfm_manager_on_pfm_activated (&pfm_mgr->base);
 	}
@@ -208,6 +225,8 @@ int pfm_manager_flash_init_port (struct pfm_manager_flash *manager, struct pfm_f
 
 	manager->host_state = state;
 
+	pfm_manager_flash_index_active_pfm (manager);
+
 	return 0;
 
 manifest_base_error:
@@ -216,6 +216,7 @@ enum {
 	MCTP_BASE_PROTOCOL_INVALID_EID = MCTP_BASE_PROTOCOL_ERROR (0x0c),		/**< Received packet from device using incorrect EID. */
 	MCTP_BASE_PROTOCOL_BUILD_UNSUPPORTED = MCTP_BASE_PROTOCOL_ERROR (0x0d),	/**< Failed to construct a packet for an unsupported message type. */
 	MCTP_BASE_PROTOCOL_RESPONSE_TIMEOUT = MCTP_BASE_PROTOCOL_ERROR (0x0e),	/**< Timeout elapsed before receiving a response. */
+	MCTP_BASE_PROTOCOL_TOO_MANY_REQUESTS = MCTP_BASE_PROTOCOL_ERROR (0x0f),	/**< No space is available to track another outstanding request. */
 };
 
 
@@ -50,6 +50,13 @@ int mctp_interface_init (struct mctp_interface *mctp, struct cmd_interface *cmd_
 		platform_semaphore_free (&mctp->wait_for_response);
 		return status;
 	}
+
+	status = platform_mutex_init (&mctp->pending_lock);
+	if (status != 0) {
+		platform_semaphore_free (&mctp->wait_for_response);
+		platform_mutex_free (&mctp->lock);
+		return status;
+	}
 #endif
 
 	mctp->device_manager = device_mgr;
@@ -74,6 +81,7 @@ void mctp_interface_deinit (struct mctp_interface *mctp)
 #ifdef CMD_ENABLE_ISSUE_REQUEST
 		platform_semaphore_free (&mctp->wait_for_response);
 		platform_mutex_free (&mctp->lock);
+		platform_mutex_free (&mctp->pending_lock);
 #endif
 	}
 }
@@ -225,6 +233,84 @@ static int mctp_interface_generate_error_packet (struct mctp_interface *mctp, in
 	return 0;
 }
 
+#ifdef CMD_ENABLE_ISSUE_REQUEST
+/**
+ * Find the pending request entry for a device.  The pending request lock must be held.
+ *
+ * @param mctp The MCTP interface to query.
+ * @param eid The EID of the device to find.
+ *
+ * @return The index of the pending request entry or -1 if there is no entry for the device.
+ */
+static int mctp_interface_find_pending_request (struct mctp_interface *mctp, uint8_t eid)
+{
+	int i;
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_PENDING_REQUESTS; i++) {
+		if (mctp->pending[i].active && (mctp->pending[i].eid == eid)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * Check if a response packet belongs to a request sent without waiting for the response.
+ *
+ * @param mctp The MCTP interface that sent the request.
+ * @param src_eid The EID of the device that sent the response.
+ * @param msg_tag The message tag of the response.
+ * @param complete Flag indicating the pending request should be completed if the response matches.
+ *
+ * @return true if the response matches a pending request.
+ */
+static bool mctp_interface_check_pending_request (struct mctp_interface *mctp, uint8_t src_eid,
+	uint8_t msg_tag, bool complete)
+{
+	bool match = false;
+	int entry;
+
+	platform_mutex_lock (&mctp->pending_lock);
+
+	entry = mctp_interface_find_pending_request (mctp, src_eid);
+	if ((entry >= 0) && (mctp->pending[entry].msg_tag == msg_tag)) {
+		match = true;
+		if (complete) {
+			mctp->pending[entry].active = false;
+		}
+	}
+
+	platform_mutex_unlock (&mctp->pending_lock);
+
+	return match;
+}
+#endif
+
+/**
+ * Check if a response packet belongs to a request issued by this interface.
+ *
+ * @param mctp The MCTP interface that issued the request.
+ * @param src_eid The EID of the device that sent the response.
+ * @param msg_tag The message tag of the response.
+ *
+ * @return true if a response from the device is expected.
+ */
+static bool mctp_interface_is_response_expected (struct mctp_interface *mctp, uint8_t src_eid,
+	uint8_t msg_tag)
+{
+	if (mctp->response_expected && (src_eid == mctp->response_eid) &&
+		(msg_tag == mctp->response_msg_tag)) {
+		return true;
+	}
+
+#ifdef CMD_ENABLE_ISSUE_REQUEST
+	return mctp_interface_check_pending_request (mctp, src_eid, msg_tag, false);
+#else
+	return false;
+#endif
+}
+
 /**
  * MCTP interface message processing function
  *
@@ -314,8 +400,7 @@ int mctp_interface_process_packet (struct mctp_interface *mctp, struct cmd_packe
 	}
 
 	if (tag_owner == MCTP_BASE_PROTOCOL_TO_RESPONSE) {
-		if (!mctp->response_expected || (src_eid != mctp->response_eid) ||
-			(msg_tag != mctp->response_msg_tag)) {
+		if (!mctp_interface_is_response_expected (mctp, src_eid, msg_tag)) {
 			return MCTP_BASE_PROTOCOL_UNEXPECTED_PKT;
 		}
 	}
@@ -376,6 +461,14 @@ int mctp_interface_process_packet (struct mctp_interface *mctp, struct cmd_packe
 			/* If flag is not defined, we will never issue requests, so response_expected will
 			 * always be false and any response packets will be rejected in the earlier check.
 			 * Therefore, we dont need to do anything here in that case. */
+			bool pending = !mctp->response_expected || (src_eid != mctp->response_eid) ||
+				(msg_tag != mctp->response_msg_tag);
+
+			if (pending && !mctp_interface_check_pending_request (mctp, src_eid, msg_tag, true)) {
+				/* The request was cancelled while the response was being received. */
+				return MCTP_BASE_PROTOCOL_UNEXPECTED_PKT;
+			}
+
 			if (MCTP_BASE_PROTOCOL_IS_CONTROL_MSG (mctp->msg_type)) {
 				status = mctp->cmd_mctp->process_response (mctp->cmd_mctp, &mctp->req_buffer);
 
@@ -387,10 +480,12 @@ int mctp_interface_process_packet (struct mctp_interface *mctp, struct cmd_packe
 					&mctp->req_buffer);
 			}
 
-			mctp->response_expected = false;
-			mctp->response_msg_tag = (mctp->response_msg_tag + 1) % 8;
+			if (!pending) {
+				mctp->response_expected = false;
+				mctp->response_msg_tag = (mctp->response_msg_tag + 1) % 8;
 
-			platform_semaphore_post (&mctp->wait_for_response);
+				platform_semaphore_post (&mctp->wait_for_response);
+			}
 
 			return status;
 #endif
@@ -492,40 +587,30 @@ void mctp_interface_reset_message_processing (struct mctp_interface *mctp)
 
 #ifdef CMD_ENABLE_ISSUE_REQUEST
 /**
- * Packetize a request message and send it over a command channel.  This call will block until the
- * full message has been transmitted and a response has been received or the operation times out.
+ * Packetize a request message for transmission over a command channel.
  *
  * @param mctp MCTP instance that will be processing the request message.
- * @param channel Command channel to use for transmitting the packets.
  * @param dest_addr The destination address for the request.
  * @param dest_eid The destination EID for the request.
  * @param request Buffer that contains the request body to send.
  * @param length Length of the request message before any packetization.
- * @param msg_buffer Buffer that will be used to store the packetized message.  This can be
- * overlapping with the request buffer.  If the buffers overlap, the request data will be modified
- * upon return.
- * @param max_length Maximum length of the message buffer.  This buffer should be
- * MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN bytes to ensure any message packetized in any way can fit.
- * @param timeout_ms Timeout period in milliseconds to wait for response to be received.
+ * @param msg_buffer Buffer that will be used to store the packetized message.
+ * @param max_length Maximum length of the message buffer.
+ * @param msg_tag MCTP message tag to use for the request.
+ * @param cmd_msg Output for the packetized message.
  *
- * @return 0 if the request was transmitted successfully or an error code.
+ * @return 0 if the request was packetized successfully or an error code.
  */
-int mctp_interface_issue_request (struct mctp_interface *mctp, struct cmd_channel *channel,
-	uint8_t dest_addr, uint8_t dest_eid, uint8_t *request, size_t length, uint8_t *msg_buffer,
-	size_t max_length, uint32_t timeout_ms)
+static int mctp_interface_generate_request (struct mctp_interface *mctp, uint8_t dest_addr,
+	uint8_t dest_eid, uint8_t *request, size_t length, uint8_t *msg_buffer, size_t max_length,
+	uint8_t msg_tag, struct cmd_message *cmd_msg)
 {
-	struct cmd_message cmd_msg;
 	size_t max_transmission_unit;
 	size_t num_packets;
 	int src_eid;
 	int src_addr;
 	int status;
 
-	if ((mctp == NULL) || (channel == NULL) || (request == NULL) || (msg_buffer == NULL) ||
-		(length == 0)) {
-		return MCTP_BASE_PROTOCOL_INVALID_ARGUMENT;
-	}
-
 	if (length > device_manager_get_max_message_len_by_eid (mctp->device_manager, dest_eid)) {
 		return MCTP_BASE_PROTOCOL_MSG_TOO_LARGE;
 	}
@@ -558,15 +643,55 @@ int mctp_interface_issue_request (struct mctp_interface *mctp, struct cmd_channe
 	}
 
 	status = mctp_interface_generate_packets_from_payload (mctp->device_manager, request, length,
-		msg_buffer, max_length, dest_eid, dest_addr, src_eid, src_addr, mctp->response_msg_tag,
-		MCTP_BASE_PROTOCOL_TO_REQUEST, &cmd_msg.pkt_size);
+		msg_buffer, max_length, dest_eid, dest_addr, src_eid, src_addr, msg_tag,
+		MCTP_BASE_PROTOCOL_TO_REQUEST, &cmd_msg->pkt_size);
 	if (ROT_IS_ERROR (status)) {
 		return status;
 	}
 
-	cmd_msg.msg_size = status;
-	cmd_msg.data = msg_buffer;
-	cmd_msg.dest_addr = dest_addr;
+	cmd_msg->msg_size = status;
+	cmd_msg->data = msg_buffer;
+	cmd_msg->dest_addr = dest_addr;
+
+	return 0;
+}
+
+/**
+ * Packetize a request message and send it over a command channel.  This call will block until the
+ * full message has been transmitted and a response has been received or the operation times out.
+ *
+ * @param mctp MCTP instance that will be processing the request message.
+ * @param channel Command channel to use for transmitting the packets.
+ * @param dest_addr The destination address for the request.
+ * @param dest_eid The destination EID for the request.
+ * @param request Buffer that contains the request body to send.
+ * @param length Length of the request message before any packetization.
+ * @param msg_buffer Buffer that will be used to store the packetized message.  This can be
+ * overlapping with the request buffer.  If the buffers overlap, the request data will be modified
+ * upon return.
+ * @param max_length Maximum length of the message buffer.  This buffer should be
+ * MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN bytes to ensure any message packetized in any way can fit.
+ * @param timeout_ms Timeout period in milliseconds to wait for response to be received.
+ *
+ * @return 0 if the request was transmitted successfully or an error code.
+ */
+int mctp_interface_issue_request (struct mctp_interface *mctp, struct cmd_channel *channel,
+	uint8_t dest_addr, uint8_t dest_eid, uint8_t *request, size_t length, uint8_t *msg_buffer,
+	size_t max_length, uint32_t timeout_ms)
+{
+	struct cmd_message cmd_msg;
+	int status;
+
+	if ((mctp == NULL) || (channel == NULL) || (request == NULL) || (msg_buffer == NULL) ||
+		(length == 0)) {
+		return MCTP_BASE_PROTOCOL_INVALID_ARGUMENT;
+	}
+
+	status = mctp_interface_generate_request (mctp, dest_addr, dest_eid, request, length,
+		msg_buffer, max_length, mctp->response_msg_tag, &cmd_msg);
+	if (status != 0) {
+		return status;
+	}
 
 	platform_mutex_lock (&mctp->lock);
 
@@ -595,4 +720,113 @@ exit:
 
 	return status;
 }
+
+/**
+ * Packetize a request message and send it over a command channel without waiting for the
+ * response.  When the response is received, it will be passed to the command interface for
+ * processing just like a response to a blocking request.
+ *
+ * Only a single request can be outstanding for each device.  Sending a new request to a device
+ * replaces any request that is still waiting for a response.  Requests can be outstanding to many
+ * devices at the same time, up to MCTP_INTERFACE_MAX_PENDING_REQUESTS.
+ *
+ * @param mctp MCTP instance that will be processing the request message.
+ * @param channel Command channel to use for transmitting the packets.
+ * @param dest_addr The destination address for the request.
+ * @param dest_eid The destination EID for the request.
+ * @param request Buffer that contains the request body to send.
+ * @param length Length of the request message before any packetization.
+ * @param msg_buffer Buffer that will be used to store the packetized message.  This can be
+ * overlapping with the request buffer.  If the buffers overlap, the request data will be modified
+ * upon return.
+ * @param max_length Maximum length of the message buffer.  This buffer should be
+ * MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN bytes to ensure any message packetized in any way can fit.
+ *
+ * @return 0 if the request was transmitted successfully or an error code.
+ */
+int mctp_interface_send_request (struct mctp_interface *mctp, struct cmd_channel *channel,
+	uint8_t dest_addr, uint8_t dest_eid, uint8_t *request, size_t length, uint8_t *msg_buffer,
+	size_t max_length)
+{
+	struct cmd_message cmd_msg;
+	uint8_t msg_tag;
+	int entry;
+	int i;
+	int status;
+
+	if ((mctp == NULL) || (channel == NULL) || (request == NULL) || (msg_buffer == NULL) ||
+		(length == 0)) {
+		return MCTP_BASE_PROTOCOL_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&mctp->pending_lock);
+
+	entry = -1;
+	for (i = 0; i < MCTP_INTERFACE_MAX_PENDING_REQUESTS; i++) {
+		if (mctp->pending[i].eid == dest_eid) {
+			entry = i;
+			break;
+		}
+		else if ((entry < 0) && !mctp->pending[i].active) {
+			entry = i;
+		}
+	}
+
+	if (entry < 0) {
+		status = MCTP_BASE_PROTOCOL_TOO_MANY_REQUESTS;
+		goto exit;
+	}
+
+	/* Use a new tag for each request so a late response to a previous request is discarded. */
+	msg_tag = (mctp->pending[entry].msg_tag + 1) % 8;
+
+	status = mctp_interface_generate_request (mctp, dest_addr, dest_eid, request, length,
+		msg_buffer, max_length, msg_tag, &cmd_msg);
+	if (status != 0) {
+		goto exit;
+	}
+
+	mctp->pending[entry].eid = dest_eid;
+	mctp->pending[entry].msg_tag = msg_tag;
+	mctp->pending[entry].active = true;
+
+	platform_mutex_unlock (&mctp->pending_lock);
+
+	status = cmd_channel_send_message (channel, &cmd_msg);
+	if (status != 0) {
+		mctp_interface_cancel_request (mctp, dest_eid);
+	}
+
+	return status;
+
+exit:
+	platform_mutex_unlock (&mctp->pending_lock);
+
+	return status;
+}
+
+/**
+ * Stop waiting for the response to a request sent with mctp_interface_send_request.  Any response
+ * received from the device after the request has been cancelled will be discarded.
+ *
+ * @param mctp MCTP instance that sent the request.
+ * @param dest_eid The EID the request was sent to.
+ */
+void mctp_interface_cancel_request (struct mctp_interface *mctp, uint8_t dest_eid)
+{
+	int entry;
+
+	if (mctp == NULL) {
+		return;
+	}
+
+	platform_mutex_lock (&mctp->pending_lock);
+
+	entry = mctp_interface_find_pending_request (mctp, dest_eid);
+	if (entry >= 0) {
+		mctp->pending[entry].active = false;
+	}
+
+	platform_mutex_unlock (&mctp->pending_lock);
+}
 #endif
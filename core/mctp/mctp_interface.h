@@ -13,6 +13,24 @@
 #include "mctp_base_protocol.h"
 
 
+/* Configurable MCTP interface parameters.  Defaults can be overridden in platform_config.h. */
+#include "platform_config.h"
+#ifndef MCTP_INTERFACE_MAX_PENDING_REQUESTS
+#define	MCTP_INTERFACE_MAX_PENDING_REQUESTS		32
+#endif
+
+
+#ifdef CMD_ENABLE_ISSUE_REQUEST
+/**
+ * A request that was sent without waiting for the response.
+ */
+struct mctp_interface_pending_request {
+	uint8_t eid;											/**< MCTP EID of the device the request was sent to. */
+	uint8_t msg_tag;										/**< MCTP message tag used for the request. */
+	bool active;											/**< Flag indicating the response has not been received. */
+};
+#endif
+
 /**
  * MCTP interface context
  */
@@ -34,6 +52,8 @@ struct mctp_interface {
 #ifdef CMD_ENABLE_ISSUE_REQUEST
 	platform_semaphore wait_for_response;					/**< Semaphore used by requester to wait for response. */
 	platform_mutex lock;									/**< Synchronization for shared interfaces */
+	struct mctp_interface_pending_request pending[MCTP_INTERFACE_MAX_PENDING_REQUESTS];	/**< Requests waiting for a response. */
+	platform_mutex pending_lock;							/**< Synchronization for pending requests. */
 #endif
 };
 
@@ -52,6 +72,10 @@ void mctp_interface_reset_message_processing (struct mctp_interface *mctp);
 int mctp_interface_issue_request (struct mctp_interface *mctp, struct cmd_channel *channel,
 	uint8_t dest_addr, uint8_t dest_eid, uint8_t *request, size_t length, uint8_t *msg_buffer,
 	size_t max_buffer, uint32_t timeout_ms);
+int mctp_interface_send_request (struct mctp_interface *mctp, struct cmd_channel *channel,
+	uint8_t dest_addr, uint8_t dest_eid, uint8_t *request, size_t length, uint8_t *msg_buffer,
+	size_t max_buffer);
+void mctp_interface_cancel_request (struct mctp_interface *mctp, uint8_t dest_eid);
 #endif
 
 #endif /* MCTP_INTERFACE_H_ */
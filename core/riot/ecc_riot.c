@@ -342,6 +342,86 @@ static int ecc_riot_sign (struct ecc_engine *engine, struct ecc_private_key *key
 	return (status == RIOT_SUCCESS) ? out_len : ECC_ENGINE_SIGN_FAILED;
 }
 
+static int ecc_riot_generate_ecdsa_nonce (struct ecc_engine *engine, struct ecc_private_key *key,
+	struct ecc_ecdsa_nonce *nonce)
+{
+	struct ecc_engine_riot *riot = (struct ecc_engine_riot*) engine;
+	ecc_signature_nonce riot_nonce;
+	int status;
+
+	if ((riot == NULL) || (key == NULL) || (nonce == NULL)) {
+		return ECC_ENGINE_INVALID_ARGUMENT;
+	}
+
+	status = RIOT_DSA_generate_nonce (&riot_nonce, riot->rng);
+	if (status != RIOT_SUCCESS) {
+		status = ECC_ENGINE_NONCE_FAILED;
+		goto exit;
+	}
+
+	BigValToBigInt (nonce->k, &riot_nonce.k);
+	BigValToBigInt (nonce->r, &riot_nonce.r);
+	nonce->length = RIOT_ECC_PRIVATE_BYTES;
+
+exit:
+	riot_core_clear (&riot_nonce, sizeof (riot_nonce));
+	return status;
+}
+
+static int ecc_riot_sign_with_nonce (struct ecc_engine *engine, struct ecc_private_key *key,
+	struct ecc_ecdsa_nonce *nonce, const uint8_t *digest, size_t length, uint8_t *signature,
+	size_t sig_length)
+{
+	ecc_signature_nonce riot_nonce;
+	ecc_keypair *ec;
+	int out_len;
+	int status;
+
+	memset (&riot_nonce, 0, sizeof (riot_nonce));
+
+	if ((engine == NULL) || (key == NULL) || (nonce == NULL) || (digest == NULL) ||
+		(signature == NULL) || (length == 0)) {
+		status = ECC_ENGINE_INVALID_ARGUMENT;
+		goto exit;
+	}
+
+	if ((int) sig_length < ecc_riot_get_signature_max_length (engine, key)) {
+		status = ECC_ENGINE_SIG_BUFFER_TOO_SMALL;
+		goto exit;
+	}
+
+	if (length != SHA256_HASH_LENGTH) {
+		status = ECC_ENGINE_UNSUPPORTED_HASH_TYPE;
+		goto exit;
+	}
+
+	if (nonce->length != RIOT_ECC_PRIVATE_BYTES) {
+		status = ECC_ENGINE_BAD_NONCE;
+		goto exit;
+	}
+
+	ec = ecc_riot_get_ec_key_pair (key);
+
+	if (RIOT_DSA_check_privkey (&ec->d) != RIOT_SUCCESS) {
+		status = ECC_ENGINE_NOT_PRIVATE_KEY;
+		goto exit;
+	}
+
+	BigIntToBigVal (&riot_nonce.k, nonce->k, nonce->length);
+	BigIntToBigVal (&riot_nonce.r, nonce->r, nonce->length);
+
+	status = RIOT_DSASignDigestWithNonce (digest, length, &ec->d, &riot_nonce, signature,
+		sig_length, &out_len);
+	status = (status == RIOT_SUCCESS) ? out_len : ECC_ENGINE_SIGN_FAILED;
+
+exit:
+	riot_core_clear (&riot_nonce, sizeof (riot_nonce));
+	if (nonce != NULL) {
+		riot_core_clear (nonce, sizeof (struct ecc_ecdsa_nonce));
+	}
+	return status;
+}
+
 static int ecc_riot_verify (struct ecc_engine *engine, struct ecc_public_key *key,
 	const uint8_t *digest, size_t length, const uint8_t *signature, size_t sig_length)
 {
@@ -399,6 +479,8 @@ int ecc_riot_init (struct ecc_engine_riot *engine, struct rng_engine *rng)
 	engine->base.get_public_key_der = ecc_riot_get_public_key_der;
 #endif
 	engine->base.sign = ecc_riot_sign;
+	engine->base.generate_ecdsa_nonce = ecc_riot_generate_ecdsa_nonce;
+	engine->base.sign_with_nonce = ecc_riot_sign_with_nonce;
 	engine->base.verify = ecc_riot_verify;
 #ifdef ECC_ENABLE_ECDH
 	engine->base.get_shared_secret_max_length = NULL;
@@ -184,6 +184,88 @@ static void hash_riot_cancel (struct hash_engine *engine)
 	}
 }
 
+/**
+ * Get the hash context used for a type of hash.
+ *
+ * @param riot The hash engine to query.
+ * @param active The type of hash.
+ * @param length Output for the length of the hash context.
+ *
+ * @return The hash context or null if the hash type is not supported.
+ */
+static void* hash_riot_get_context (struct hash_engine_riot *riot, uint8_t active, size_t *length)
+{
+	switch (active) {
+#ifdef HASH_ENABLE_SHA1
+		case HASH_ACTIVE_SHA1:
+			*length = sizeof (riot->context.sha1);
+			return &riot->context.sha1;
+#endif
+
+		case HASH_ACTIVE_SHA256:
+			*length = sizeof (riot->context.sha256);
+			return &riot->context.sha256;
+
+		default:
+			return NULL;
+	}
+}
+
+static int hash_riot_save_state (struct hash_engine *engine, struct hash_engine_state *state)
+{
+	struct hash_engine_riot *riot = (struct hash_engine_riot*) engine;
+	void *context;
+	size_t length;
+
+	if ((riot == NULL) || (state == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	context = hash_riot_get_context (riot, riot->active, &length);
+	if (context == NULL) {
+		return HASH_ENGINE_NO_ACTIVE_HASH;
+	}
+
+	if (length > sizeof (state->context)) {
+		return HASH_ENGINE_STATE_TOO_LARGE;
+	}
+
+	memcpy (state->context, context, length);
+	state->active = riot->active;
+
+	return 0;
+}
+
+static int hash_riot_restore_state (struct hash_engine *engine,
+	const struct hash_engine_state *state)
+{
+	struct hash_engine_riot *riot = (struct hash_engine_riot*) engine;
+	void *context;
+	size_t length;
+
+	if ((riot == NULL) || (state == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (riot->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	context = hash_riot_get_context (riot, state->active, &length);
+	if (context == NULL) {
+		return HASH_ENGINE_UNSUPPORTED_HASH;
+	}
+
+	if (length > sizeof (state->context)) {
+		return HASH_ENGINE_STATE_TOO_LARGE;
+	}
+
+	memcpy (context, state->context, length);
+	riot->active = state->active;
+
+	return 0;
+}
+
 /**
  * Initialize a riot hash engine.
  *
@@ -216,6 +298,8 @@ int hash_riot_init (struct hash_engine_riot *engine)
 	engine->base.update = hash_riot_update;
 	engine->base.finish = hash_riot_finish;
 	engine->base.cancel = hash_riot_cancel;
+	engine->base.save_state = hash_riot_save_state;
+	engine->base.restore_state = hash_riot_restore_state;
 
 	engine->active = HASH_ACTIVE_NONE;
 
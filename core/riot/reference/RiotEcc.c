@@ -1503,40 +1503,71 @@ ECDH_derive_pt(affine_point_t *tgt, bigval_t const *k, affine_point_t const *Q)
 
 #if ECDSA_SIGN
 //
-// This function sets the r and s fields of sig.  The implementation
-// follows HMV Algorithm 4.29.
+// This function generates the random value, k, and the corresponding r
+// field of a signature.  These do not depend on the message being signed.
 static int
-ECDSA_sign(bigval_t const *msgdgst,
-           bigval_t const *privkey,
-           struct rng_engine *rng,
-           ECDSA_sig_t *sig)
+ECDSA_sign_setup(struct rng_engine *rng, ECDSA_nonce_t *nonce)
 {
     int rv;
     affine_point_t P1;
-    bigval_t k;
-    bigval_t t;
 
-startpoint:
+    do {
+        rv = ECDH_generate(&P1, &nonce->k, rng);
+        if (rv) {
+            return (rv);
+        }
 
-    rv = ECDH_generate(&P1, &k, rng);
-    if (rv) {
-        return (rv);
-    }
+        big_precise_reduce(&nonce->r, &P1.x, &orderP);
+    } while (big_is_zero(&nonce->r));
 
-    big_precise_reduce(&sig->r, &P1.x, &orderP);
-    if (big_is_zero(&sig->r)) {
-        goto startpoint;
-    }
+    return (0);
+}
+
+//
+// This function sets the r and s fields of sig using a k and r generated
+// by ECDSA_sign_setup.  Returns -1 if the resulting s is zero, in which
+// case a new nonce must be used.
+static int
+ECDSA_sign_finish(bigval_t const *msgdgst,
+                  bigval_t const *privkey,
+                  ECDSA_nonce_t const *nonce,
+                  ECDSA_sig_t *sig)
+{
+    bigval_t t;
+
+    sig->r = nonce->r;
 
     big_mpyP(&t, privkey, &sig->r, MOD_ORDER);
     big_add(&t, &t, msgdgst);
     big_precise_reduce(&t, &t, &orderP); // may not be necessary
-    big_divide(&sig->s, &t, &k, &orderP);
+    big_divide(&sig->s, &t, &nonce->k, &orderP);
     if (big_is_zero(&sig->s)) {
-        goto startpoint;
+        return (-1);
     }
 
-	riot_core_clear (&k, sizeof (bigval_t));
+    return (0);
+}
+
+//
+// This function sets the r and s fields of sig.  The implementation
+// follows HMV Algorithm 4.29.
+static int
+ECDSA_sign(bigval_t const *msgdgst,
+           bigval_t const *privkey,
+           struct rng_engine *rng,
+           ECDSA_sig_t *sig)
+{
+    int rv;
+    ECDSA_nonce_t nonce;
+
+    do {
+        rv = ECDSA_sign_setup(rng, &nonce);
+        if (rv) {
+            return (rv);
+        }
+    } while (ECDSA_sign_finish(msgdgst, privkey, &nonce, sig) != 0);
+
+	riot_core_clear (&nonce, sizeof (ECDSA_nonce_t));
 
     return (0);
 }
@@ -1831,6 +1862,44 @@ RIOT_DSASignDigest(const uint8_t *digest, size_t digest_size, const ecc_privatek
 	return RIOT_DSA_encode_signature (&sig, buf, buf_len, out_len);
 }
 
+//
+// Generate a nonce for a DSA signature
+//
+RIOT_STATUS
+RIOT_DSA_generate_nonce(ecc_signature_nonce *nonce, struct rng_engine *rng)
+{
+	return (ECDSA_sign_setup(rng, nonce) == 0) ? RIOT_SUCCESS : RIOT_FAILURE;
+}
+
+//
+// Sign a digest using the DSA key and a precomputed nonce
+//
+RIOT_STATUS
+RIOT_DSASignDigestWithNonce(const uint8_t *digest, size_t digest_size,
+	const ecc_privatekey *signingPrivateKey, const ecc_signature_nonce *nonce, uint8_t *buf,
+	size_t buf_len, int *out_len)
+{
+    bigval_t source;
+	ecc_signature sig;
+	int status;
+
+	*out_len = 0;
+
+	if ((RIOT_DSA_check_privkey(&nonce->k) != RIOT_SUCCESS) ||
+		(RIOT_DSA_check_privkey(&nonce->r) != RIOT_SUCCESS)) {
+		return RIOT_FAILURE;
+	}
+
+    BigIntToBigVal(&source, digest, digest_size);
+	status = ECDSA_sign_finish(&source, signingPrivateKey, nonce, &sig);
+
+	if (status != 0) {
+		return RIOT_FAILURE;
+	}
+
+	return RIOT_DSA_encode_signature (&sig, buf, buf_len, out_len);
+}
+
 //
 // Sign a buffer using the DSA key
 // @param buf The buffer to sign
@@ -76,6 +76,11 @@ typedef struct {
     bigval_t s;
 } ECDSA_sig_t;
 
+typedef struct {
+    bigval_t k;
+    bigval_t r;
+} ECDSA_nonce_t;
+
 typedef struct {
 	bigval_t d;
 	affine_point_t Q;	
@@ -85,6 +90,7 @@ typedef bigval_t ecc_privatekey;
 typedef affine_point_t ecc_publickey;
 typedef affine_point_t ecc_secret;
 typedef ECDSA_sig_t ecc_signature;
+typedef ECDSA_nonce_t ecc_signature_nonce;
 typedef riot_ecdh_keypair ecc_keypair;
 
 void set_drbg_seed(uint8_t *buf, size_t length);
@@ -176,6 +182,31 @@ RIOT_DeriveDsaKeyPair(ecc_publickey *publicKey, ecc_privatekey *privateKey,
 RIOT_STATUS RIOT_DSASignDigest(const uint8_t *digest, size_t digest_size, const ecc_privatekey *signingPrivateKey,
 	uint8_t *buf, size_t buf_len, struct rng_engine *rng, int *out_len);
 
+//
+// Generate a nonce that can be used for a single DSA signature.  This performs
+// the point multiplication for the signature, which does not depend on the digest.
+// @param nonce The generated nonce
+// @param rng The random number generator engine
+// @return  - RIOT_SUCCESS if the nonce was generated
+//          - RIOT_FAILURE otherwise
+RIOT_STATUS RIOT_DSA_generate_nonce(ecc_signature_nonce *nonce, struct rng_engine *rng);
+
+//
+// Sign a digest using the DSA key and a precomputed nonce.  The nonce must not
+// be used for any other signature.
+// @param digest The digest to sign
+// @param digest_size The digest buffer size
+// @param signingPrivateKey The private key
+// @param nonce The nonce to use for the signature
+// @param buf The buffer to store the signature
+// @param buf_len The buffer size
+// @param out_len The length in bytes of the DER encoded signed digest
+// @return  - RIOT_SUCCESS if the signing process succeeds
+//          - RIOT_FAILURE otherwise
+RIOT_STATUS RIOT_DSASignDigestWithNonce(const uint8_t *digest, size_t digest_size,
+	const ecc_privatekey *signingPrivateKey, const ecc_signature_nonce *nonce, uint8_t *buf,
+	size_t buf_len, int *out_len);
+
 //
 // Sign a buffer using the DSA key
 // @param buf The buffer to sign
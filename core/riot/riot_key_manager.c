@@ -22,6 +22,18 @@ static void riot_key_manager_free_ca_cert (struct der_cert *cert)
 	cert->cert = NULL;
 }
 
+/**
+ * Indicate that the certificate chain managed by the RIoT key manager has changed.
+ *
+ * @param riot The RIoT key manager that was updated.
+ */
+static void riot_key_manager_certificates_changed (struct riot_key_manager *riot)
+{
+	platform_mutex_lock (&riot->auth_lock);
+	riot->cert_version++;
+	platform_mutex_unlock (&riot->auth_lock);
+}
+
 /**
  * Load the certificates from keystore and check if they create a authenticated certificate chain.
  * If the chain is authenticated, update the RIoT keys using the stored certificates.
@@ -53,6 +65,7 @@ static int riot_key_manager_authenticate_stored_certificates (struct riot_key_ma
 				platform_free (signed_devid);
 
 				platform_mutex_unlock (&riot->store_lock);
+				riot_key_manager_certificates_changed (riot);
 				return status;
 			}
 		}
@@ -117,6 +130,7 @@ static int riot_key_manager_authenticate_stored_certificates (struct riot_key_ma
 		riot->keys.devid_cert = signed_devid;
 		riot->keys.devid_cert_length = devid_length;
 		riot->static_devid = false;
+		riot->cert_version++;
 
 		platform_mutex_unlock (&riot->auth_lock);
 
@@ -137,6 +151,7 @@ auth_load_error:
 	platform_free (signed_devid);
 	riot_key_manager_free_ca_cert (&riot->root_ca);
 	riot_key_manager_free_ca_cert (&riot->intermediate_ca);
+	riot_key_manager_certificates_changed (riot);
 
 	return status;
 }
@@ -465,3 +480,22 @@ const struct der_cert* riot_key_manager_get_intermediate_ca (struct riot_key_man
 		return NULL;
 	}
 }
+
+/**
+ * Get the current version of the certificate chain managed by the RIoT key manager.  The version
+ * changes any time the Device ID certificate or CA certificates are updated, allowing users to
+ * determine if information derived from the certificates needs to be regenerated.
+ *
+ * @param riot The RIoT key manager to query.
+ *
+ * @return The certificate chain version.
+ */
+uint32_t riot_key_manager_get_certificate_version (struct riot_key_manager *riot)
+{
+	if (riot) {
+		return riot->cert_version;
+	}
+	else {
+		return 0;
+	}
+}
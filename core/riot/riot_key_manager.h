@@ -26,6 +26,7 @@ struct riot_key_manager {
 	struct der_cert intermediate_ca;		/**< The RIoT intermediate CA certificate. */
 	bool static_keys;						/**< Flag indicating static key buffers. */
 	bool static_devid;						/**< Flag indicating a static device ID cert buffer. */
+	uint32_t cert_version;					/**< Counter incremented when the certificate chain changes. */
 	platform_mutex store_lock;				/**< Synchronization for cert storage. */
 	platform_mutex auth_lock;				/**< Synchronization for key updates. */
 };
@@ -54,6 +55,8 @@ void riot_key_manager_release_riot_keys (struct riot_key_manager *riot,
 const struct der_cert* riot_key_manager_get_root_ca (struct riot_key_manager *riot);
 const struct der_cert* riot_key_manager_get_intermediate_ca (struct riot_key_manager *riot);
 
+uint32_t riot_key_manager_get_certificate_version (struct riot_key_manager *riot);
+
 
 #define	RIOT_KEY_MANAGER_ERROR(code)		ROT_ERROR (ROT_MODULE_RIOT_KEY_MANAGER, code)
 
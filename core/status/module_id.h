@@ -108,6 +108,12 @@ enum {
 	ROT_MODULE_OCP_RECOVERY_DEVICE = 0x0060,			/**< Device handler for the OCP Recovery protocol. */
 	ROT_MODULE_OCP_RECOVERY_SMBUS = 0x0061,				/**< SMBus layer for the OCP Recovery protocol. */
 	ROT_MODULE_MCTP_CONTROL_PROTOCOL_OBSERVER = 0x0062,	/**< MCTP control command interface observer. */
+	ROT_MODULE_HOST_FLASH_VERIFICATION_CACHE = 0x0063,	/**< Cache of host flash verification results. */
+	ROT_MODULE_HOST_FW_VERIFY_WORKER = 0x0064,			/**< Concurrent host firmware verification. */
+	ROT_MODULE_ARENA = 0x0065,							/**< Bump allocator over a fixed buffer. */
+	ROT_MODULE_HASH_POOL = 0x0066,						/**< Pool of independent hash engines. */
+	ROT_MODULE_ECC_NONCE_POOL = 0x0067,					/**< Pool of precomputed ECDSA nonces. */
+	ROT_MODULE_ATTESTATION_SCHEDULER = 0x0068,			/**< Concurrent attestation of many devices. */
 };
 
 
@@ -27,6 +27,12 @@ static void add_all_attestation_tests (CuSuite *suite)
 	!defined TESTING_SKIP_ATTESTATION_MASTER_SUITE
 	TESTING_RUN_SUITE (attestation_master);
 #endif
+#if (defined TESTING_RUN_ATTESTATION_SCHEDULER_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_ATTESTATION_SCHEDULER_SUITE
+	TESTING_RUN_SUITE (attestation_scheduler);
+#endif
 #if (defined TESTING_RUN_ATTESTATION_SLAVE_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
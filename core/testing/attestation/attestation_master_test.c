@@ -9,6 +9,7 @@
 #include "platform.h"
 #include "testing.h"
 #include "attestation/attestation_master.h"
+#include "crypto/hash_pool.h"
 #include "cmd_interface/device_manager.h"
 #include "testing/mock/crypto/ecc_mock.h"
 #include "testing/mock/crypto/rsa_mock.h"
@@ -38,11 +39,15 @@ static struct riot_keys keys = {
 
 
 /**
- * Helper function to setup the attestation manager to use mock crypto engines
+ * Helper function to setup the attestation manager to use mock crypto engines, optionally
+ * acquiring the hash engine from a pool.
  *
  * @param test The test framework
  * @param attestation The attestation manager instance to initialize
  * @param hash The hash engine mock to initialize
+ * @param pool The hash pool to initialize with the hash engine mock.  Null to use the mock
+ * directly.
+ * @param engines Engine list for the hash pool.  Unused if there is no pool.
  * @param ecc The ECC engine mock to initialize
  * @param rsa The RSA engine mock to initialize
  * @param x509 The x509 engine mock to initialize
@@ -51,11 +56,11 @@ static struct riot_keys keys = {
  * @param keystore The keystore to initialize
  * @param manager Device manager to initialize
  */
-static void setup_attestation_master_mock_test (CuTest *test,
-	struct attestation_master *attestation, struct hash_engine_mock *hash,
-	struct ecc_engine_mock *ecc, struct rsa_engine_mock *rsa, struct x509_engine_mock *x509,
-	struct rng_engine_mock *rng, struct riot_key_manager *riot, struct keystore_mock *keystore,
-	struct device_manager *manager)
+static void setup_attestation_master_mock_test_common (CuTest *test,
+	struct attestation_master *attestation, struct hash_engine_mock *hash, struct hash_pool *pool,
+	struct hash_engine **engines, struct ecc_engine_mock *ecc, struct rsa_engine_mock *rsa,
+	struct x509_engine_mock *x509, struct rng_engine_mock *rng, struct riot_key_manager *riot,
+	struct keystore_mock *keystore, struct device_manager *manager)
 {
 	uint8_t *dev_id_der = NULL;
 	int status;
@@ -97,11 +102,72 @@ static void setup_attestation_master_mock_test (CuTest *test,
 	status = riot_key_manager_init_static (riot, &keystore->base, &keys, &x509->base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = attestation_master_init (attestation, riot, &hash->base, &ecc->base, &rsa->base,
-		&x509->base, &rng->base, manager, 1);
+	if (pool != NULL) {
+		engines[0] = &hash->base;
+
+		status = hash_pool_init (pool, engines, 1);
+		CuAssertIntEquals (test, 0, status);
+
+		status = attestation_master_init_pool (attestation, riot, pool, &ecc->base, &rsa->base,
+			&x509->base, &rng->base, manager, 1);
+	}
+	else {
+		status = attestation_master_init (attestation, riot, &hash->base, &ecc->base, &rsa->base,
+			&x509->base, &rng->base, manager, 1);
+	}
 	CuAssertIntEquals (test, 0, status);
 }
 
+/**
+ * Helper function to setup the attestation manager to use mock crypto engines
+ *
+ * @param test The test framework
+ * @param attestation The attestation manager instance to initialize
+ * @param hash The hash engine mock to initialize
+ * @param ecc The ECC engine mock to initialize
+ * @param rsa The RSA engine mock to initialize
+ * @param x509 The x509 engine mock to initialize
+ * @param rng The RNG engine mock to initialize
+ * @param riot RIoT keys manager to initialize
+ * @param keystore The keystore to initialize
+ * @param manager Device manager to initialize
+ */
+static void setup_attestation_master_mock_test (CuTest *test,
+	struct attestation_master *attestation, struct hash_engine_mock *hash,
+	struct ecc_engine_mock *ecc, struct rsa_engine_mock *rsa, struct x509_engine_mock *x509,
+	struct rng_engine_mock *rng, struct riot_key_manager *riot, struct keystore_mock *keystore,
+	struct device_manager *manager)
+{
+	setup_attestation_master_mock_test_common (test, attestation, hash, NULL, NULL, ecc, rsa, x509,
+		rng, riot, keystore, manager);
+}
+
+/**
+ * Helper function to setup the attestation manager to acquire a mock hash engine from a pool
+ *
+ * @param test The test framework
+ * @param attestation The attestation manager instance to initialize
+ * @param hash The hash engine mock to initialize
+ * @param pool The hash pool to initialize with the hash engine mock
+ * @param engines Engine list for the hash pool
+ * @param ecc The ECC engine mock to initialize
+ * @param rsa The RSA engine mock to initialize
+ * @param x509 The x509 engine mock to initialize
+ * @param rng The RNG engine mock to initialize
+ * @param riot RIoT keys manager to initialize
+ * @param keystore The keystore to initialize
+ * @param manager Device manager to initialize
+ */
+static void setup_attestation_master_mock_test_pool (CuTest *test,
+	struct attestation_master *attestation, struct hash_engine_mock *hash, struct hash_pool *pool,
+	struct hash_engine **engines, struct ecc_engine_mock *ecc, struct rsa_engine_mock *rsa,
+	struct x509_engine_mock *x509, struct rng_engine_mock *rng, struct riot_key_manager *riot,
+	struct keystore_mock *keystore, struct device_manager *manager)
+{
+	setup_attestation_master_mock_test_common (test, attestation, hash, pool, engines, ecc, rsa,
+		x509, rng, riot, keystore, manager);
+}
+
 /**
  * Helper function to release attestation manager instance
  *
@@ -396,6 +462,100 @@ static void attestation_master_test_init_null (CuTest *test)
 	device_manager_release (&manager);
 }
 
+static void attestation_master_test_init_pool (CuTest *test)
+{
+	int status;
+	struct attestation_master attestation;
+	struct hash_engine_mock hash;
+	struct hash_engine *engines[1];
+	struct hash_pool pool;
+	struct ecc_engine_mock ecc;
+	struct rsa_engine_mock rsa;
+	struct x509_engine_mock x509;
+	struct rng_engine_mock rng;
+	struct riot_key_manager riot;
+	struct keystore_mock keystore;
+	struct device_manager manager;
+	struct hash_pool_stats stats;
+
+	TEST_START;
+
+	setup_attestation_master_mock_test_pool (test, &attestation, &hash, &pool, engines, &ecc, &rsa,
+		&x509, &rng, &riot, &keystore, &manager);
+
+	CuAssertPtrNotNull (test, attestation.generate_challenge_request);
+	CuAssertPtrNotNull (test, attestation.compare_digests);
+	CuAssertPtrNotNull (test, attestation.store_certificate);
+	CuAssertPtrNotNull (test, attestation.process_challenge_response);
+
+	status = hash_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.acquired);
+
+	complete_attestation_master_mock_test (test, &attestation, &hash, &ecc, &rsa, &x509, &rng,
+		&keystore, &manager, &riot);
+	hash_pool_release (&pool);
+}
+
+static void attestation_master_test_init_pool_null (CuTest *test)
+{
+	int status;
+	struct attestation_master attestation;
+	struct hash_engine_mock hash;
+	struct hash_engine *engines[1];
+	struct hash_pool pool;
+	struct ecc_engine_mock ecc;
+	struct rsa_engine_mock rsa;
+	struct x509_engine_mock x509;
+	struct rng_engine_mock rng;
+	struct riot_key_manager riot;
+	struct keystore_mock keystore;
+	struct device_manager manager;
+
+	TEST_START;
+
+	setup_attestation_master_mock_test_pool (test, &attestation, &hash, &pool, engines, &ecc, &rsa,
+		&x509, &rng, &riot, &keystore, &manager);
+	attestation_master_release (&attestation);
+
+	status = attestation_master_init_pool (NULL, &riot, &pool, &ecc.base, &rsa.base, &x509.base,
+		&rng.base, &manager, 1);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+
+	status = attestation_master_init_pool (&attestation, NULL, &pool, &ecc.base, &rsa.base,
+		&x509.base, &rng.base, &manager, 1);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+
+	status = attestation_master_init_pool (&attestation, &riot, NULL, &ecc.base, &rsa.base,
+		&x509.base, &rng.base, &manager, 1);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+
+	status = attestation_master_init_pool (&attestation, &riot, &pool, NULL, &rsa.base,
+		&x509.base, &rng.base, &manager, 1);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+
+	status = attestation_master_init_pool (&attestation, &riot, &pool, &ecc.base, &rsa.base, NULL,
+		&rng.base, &manager, 1);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+
+	status = attestation_master_init_pool (&attestation, &riot, &pool, &ecc.base, &rsa.base,
+		&x509.base, NULL, &manager, 1);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+
+	status = attestation_master_init_pool (&attestation, &riot, &pool, &ecc.base, &rsa.base,
+		&x509.base, &rng.base, NULL, 1);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+
+	/* Re-initialize so the common release can be used. */
+	status = attestation_master_init_pool (&attestation, &riot, &pool, &ecc.base, &rsa.base,
+		&x509.base, &rng.base, &manager, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	complete_attestation_master_mock_test (test, &attestation, &hash, &ecc, &rsa, &x509, &rng,
+		&keystore, &manager, &riot);
+	hash_pool_release (&pool);
+}
+
 static void attestation_master_test_release_null (CuTest *test)
 {
 	TEST_START;
@@ -840,6 +1000,138 @@ static void attestation_master_test_compare_digests_hash_fail (CuTest *test)
 		&keystore, &manager, &riot);
 }
 
+static void attestation_master_test_compare_digests_pool (CuTest *test)
+{
+	int status;
+	struct attestation_master attestation;
+	struct hash_engine_mock hash;
+	struct hash_engine *engines[1];
+	struct hash_pool pool;
+	struct ecc_engine_mock ecc;
+	struct rsa_engine_mock rsa;
+	struct x509_engine_mock x509;
+	struct rng_engine_mock rng;
+	struct attestation_chain_digest digests;
+	struct riot_key_manager riot;
+	struct keystore_mock keystore;
+	struct device_manager manager;
+	struct hash_engine *engine;
+	struct hash_pool_stats stats;
+
+	TEST_START;
+
+	digests.num_cert = 2;
+	digests.digest_len = SHA256_HASH_LENGTH;
+	digests.digest = platform_calloc (2, SHA256_HASH_LENGTH);
+
+	setup_attestation_master_mock_test_pool (test, &attestation, &hash, &pool, engines, &ecc, &rsa,
+		&x509, &rng, &riot, &keystore, &manager);
+
+	status = attestation.compare_digests (&attestation, 0xAA, &digests);
+	CuAssertIntEquals (test, 1, status);
+
+	status = device_manager_update_cert (attestation.device_manager, 0, 0, RIOT_CORE_ALIAS_CERT,
+		RIOT_CORE_ALIAS_CERT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = device_manager_update_cert (attestation.device_manager, 0, 1, RIOT_CORE_DEVID_CERT,
+		RIOT_CORE_DEVID_CERT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&hash.mock, hash.base.calculate_sha256, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_CERT, RIOT_CORE_ALIAS_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&hash.mock, 2, digests.digest, SHA256_HASH_LENGTH, -1);
+	status |= mock_expect (&hash.mock, hash.base.calculate_sha256, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_DEVID_CERT, RIOT_CORE_DEVID_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_DEVID_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&hash.mock, 2, &digests.digest[32], SHA256_HASH_LENGTH, -1);
+	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation.compare_digests (&attestation, 0xAA, &digests);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.acquired);
+
+	/* The engine must have been returned to the pool. */
+	status = hash_pool_try_acquire_engine (&pool, &engine);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &hash.base, engine);
+
+	status = mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool, engine);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_free (digests.digest);
+
+	complete_attestation_master_mock_test (test, &attestation, &hash, &ecc, &rsa, &x509, &rng,
+		&keystore, &manager, &riot);
+	hash_pool_release (&pool);
+}
+
+static void attestation_master_test_compare_digests_pool_hash_fail (CuTest *test)
+{
+	int status;
+	struct attestation_master attestation;
+	struct hash_engine_mock hash;
+	struct hash_engine *engines[1];
+	struct hash_pool pool;
+	struct ecc_engine_mock ecc;
+	struct rsa_engine_mock rsa;
+	struct x509_engine_mock x509;
+	struct rng_engine_mock rng;
+	struct attestation_chain_digest digests;
+	struct riot_key_manager riot;
+	struct keystore_mock keystore;
+	struct device_manager manager;
+	struct hash_engine *engine;
+
+	TEST_START;
+
+	digests.num_cert = 1;
+	digests.digest_len = SHA256_HASH_LENGTH;
+	digests.digest = platform_calloc (1, SHA256_HASH_LENGTH);
+
+	setup_attestation_master_mock_test_pool (test, &attestation, &hash, &pool, engines, &ecc, &rsa,
+		&x509, &rng, &riot, &keystore, &manager);
+
+	status = attestation.compare_digests (&attestation, 0xAA, &digests);
+	CuAssertIntEquals (test, 1, status);
+
+	status = device_manager_update_cert (attestation.device_manager, 0, 0, RIOT_CORE_ALIAS_CERT,
+		RIOT_CORE_ALIAS_CERT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&hash.mock, hash.base.calculate_sha256, &hash, -1,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_CERT, RIOT_CORE_ALIAS_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation.compare_digests (&attestation, 0xAA, &digests);
+	CuAssertIntEquals (test, -1, status);
+
+	status = hash_pool_try_acquire_engine (&pool, &engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool, engine);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_free (digests.digest);
+
+	complete_attestation_master_mock_test (test, &attestation, &hash, &ecc, &rsa, &x509, &rng,
+		&keystore, &manager, &riot);
+	hash_pool_release (&pool);
+}
+
 static void attestation_master_test_compare_digests_invalid_device (CuTest *test)
 {
 	int status;
@@ -2065,6 +2357,84 @@ static void attestation_master_test_process_challenge_response_start_hash_failur
 		&keystore, &manager, &riot);
 }
 
+static void attestation_master_test_process_challenge_response_pool_start_hash_failure (
+	CuTest *test)
+{
+	int status;
+	struct attestation_master attestation;
+	struct hash_engine_mock hash;
+	struct hash_engine *engines[1];
+	struct hash_pool pool;
+	struct ecc_engine_mock ecc;
+	struct rsa_engine_mock rsa;
+	struct x509_engine_mock x509;
+	struct rng_engine_mock rng;
+	struct attestation_challenge challenge;
+	struct attestation_chain_digest digests;
+	struct riot_key_manager riot;
+	struct keystore_mock keystore;
+	struct device_manager manager;
+	struct hash_engine *engine;
+	uint8_t buf[137] = {0};
+	uint16_t buf_len = 137;
+
+	TEST_START;
+
+	buf[1] = 1;
+	buf[2] = 0;
+	buf[3] = 4;
+
+	digests.num_cert = 1;
+
+	setup_attestation_master_mock_test_pool (test, &attestation, &hash, &pool, engines, &ecc, &rsa,
+		&x509, &rng, &riot, &keystore, &manager);
+
+	status = mock_expect (&x509.mock, x509.base.load_certificate, &x509, 0, MOCK_ARG_NOT_NULL,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_DEVID_CERT, RIOT_CORE_DEVID_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_DEVID_CERT_LEN));
+	status |= mock_expect_save_arg (&x509.mock, 0, 2);
+	status |= mock_expect (&x509.mock, x509.base.get_public_key_type, &x509, X509_PUBLIC_KEY_ECC,
+		MOCK_ARG_SAVED_ARG (2));
+	status |= mock_expect (&x509.mock, x509.base.release_certificate, &x509, 0,
+		MOCK_ARG_SAVED_ARG (2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&rng.mock, rng.base.generate_random_buffer, &rng, 0, MOCK_ARG (32),
+		MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, -1);
+	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation.compare_digests (&attestation, 0xAA, &digests);
+	CuAssertIntEquals (test, 1, status);
+
+	status = attestation.store_certificate (&attestation, 0xAA, 0, 0, RIOT_CORE_DEVID_CERT,
+		RIOT_CORE_DEVID_CERT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation.generate_challenge_request (&attestation, 0xAA, 0, &challenge);
+	CuAssertIntEquals (test, sizeof (struct attestation_challenge), status);
+
+	status = attestation.process_challenge_response (&attestation, buf, buf_len, 0xAA);
+	CuAssertIntEquals (test, -1, status);
+
+	/* The engine must have been returned to the pool. */
+	status = hash_pool_try_acquire_engine (&pool, &engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool, engine);
+	CuAssertIntEquals (test, 0, status);
+
+	complete_attestation_master_mock_test (test, &attestation, &hash, &ecc, &rsa, &x509, &rng,
+		&keystore, &manager, &riot);
+	hash_pool_release (&pool);
+}
+
 static void attestation_master_test_process_challenge_response_hash_challenge_failure (CuTest *test)
 {
 	int status;
@@ -3546,6 +3916,8 @@ TEST_SUITE_START (attestation_master);
 
 TEST (attestation_master_test_init);
 TEST (attestation_master_test_init_null);
+TEST (attestation_master_test_init_pool);
+TEST (attestation_master_test_init_pool_null);
 TEST (attestation_master_test_release_null);
 TEST (attestation_master_test_generate_challenge_request);
 TEST (attestation_master_test_generate_challenge_request_invalid_slot_num);
@@ -3558,6 +3930,8 @@ TEST (attestation_master_test_compare_digests_new_chain);
 TEST (attestation_master_test_compare_digests_same);
 TEST (attestation_master_test_compare_digests_mismatch);
 TEST (attestation_master_test_compare_digests_hash_fail);
+TEST (attestation_master_test_compare_digests_pool);
+TEST (attestation_master_test_compare_digests_pool_hash_fail);
 TEST (attestation_master_test_compare_digests_invalid_device);
 TEST (attestation_master_test_compare_digests_null);
 TEST (attestation_master_test_store_certificate);
@@ -3578,6 +3952,7 @@ TEST (attestation_master_test_process_challenge_response_invalid_max_protocol_ve
 TEST (attestation_master_test_process_challenge_response_init_cert_failure);
 TEST (attestation_master_test_process_challenge_response_get_pub_key_type_failure);
 TEST (attestation_master_test_process_challenge_response_start_hash_failure);
+TEST (attestation_master_test_process_challenge_response_pool_start_hash_failure);
 TEST (attestation_master_test_process_challenge_response_hash_challenge_failure);
 TEST (attestation_master_test_process_challenge_response_hash_response_failure);
 TEST (attestation_master_test_process_challenge_response_finish_hash_failure);
@@ -0,0 +1,1492 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "platform.h"
+#include "testing.h"
+#include "attestation/attestation_scheduler.h"
+#include "cmd_interface/cerberus_protocol.h"
+#include "cmd_interface/cerberus_protocol_required_commands.h"
+#include "cmd_interface/cmd_channel.h"
+#include "mctp/mctp_interface.h"
+#include "mctp/mctp_base_protocol.h"
+#include "testing/mock/attestation/attestation_master_mock.h"
+#include "testing/mock/cmd_interface/cmd_interface_mock.h"
+#include "testing/mock/cmd_interface/cmd_channel_mock.h"
+
+
+TEST_SUITE_LABEL ("attestation_scheduler");
+
+
+/**
+ * EID of the first component device.
+ */
+#define	ATTESTATION_SCHEDULER_TESTING_EID		0x20
+
+/**
+ * SMBus address of the first component device.
+ */
+#define	ATTESTATION_SCHEDULER_TESTING_ADDR		0x40
+
+/**
+ * Length of the challenge response sent by the testing devices.
+ */
+#define	ATTESTATION_SCHEDULER_TESTING_RSP_LEN	(ATTESTATION_CHALLENGE_RSP_LEN + 64 + 72)
+
+
+/**
+ * Dependencies for testing the attestation scheduler.
+ */
+struct attestation_scheduler_testing {
+	struct attestation_master_mock attestation;		/**< Mock for the attestation manager. */
+	struct cmd_interface_mock cmd_cerberus;			/**< Mock for the Cerberus protocol handler. */
+	struct cmd_interface_mock cmd_mctp;				/**< Mock for the MCTP control protocol handler. */
+	struct cmd_channel_mock channel;				/**< Mock for the command channel. */
+	struct device_manager device_mgr;				/**< Device manager with the devices to attest. */
+	struct mctp_interface mctp;						/**< MCTP layer for sending requests. */
+	struct attestation_scheduler test;				/**< Scheduler under test. */
+};
+
+
+/**
+ * Initialize all dependencies for testing.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing dependencies to initialize.
+ * @param num_components Number of component devices to add to the device manager.
+ */
+static void attestation_scheduler_testing_init_dependencies (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, int num_components)
+{
+	int status;
+	int i;
+
+	status = attestation_master_mock_init (&scheduler->attestation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_interface_mock_init (&scheduler->cmd_cerberus);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_interface_mock_init (&scheduler->cmd_mctp);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_channel_mock_init (&scheduler->channel, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = device_manager_init (&scheduler->device_mgr, num_components + 2,
+		DEVICE_MANAGER_PA_ROT_MODE, DEVICE_MANAGER_MASTER_AND_SLAVE_BUS_ROLE);
+	CuAssertIntEquals (test, 0, status);
+
+	status = device_manager_update_device_entry (&scheduler->device_mgr, 0,
+		MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID, 0x5D);
+	CuAssertIntEquals (test, 0, status);
+
+	status = device_manager_update_device_entry (&scheduler->device_mgr, 1,
+		MCTP_BASE_PROTOCOL_BMC_EID, 0x10);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < num_components; i++) {
+		status = device_manager_update_device_entry (&scheduler->device_mgr, i + 2,
+			ATTESTATION_SCHEDULER_TESTING_EID + i, ATTESTATION_SCHEDULER_TESTING_ADDR + (i * 2));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mctp_interface_init (&scheduler->mctp, &scheduler->cmd_cerberus.base,
+		&scheduler->cmd_mctp.base, &scheduler->device_mgr);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release all testing dependencies and validate all mocks.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing dependencies to release.
+ */
+static void attestation_scheduler_testing_release_dependencies (CuTest *test,
+	struct attestation_scheduler_testing *scheduler)
+{
+	int status;
+
+	status = attestation_master_mock_validate_and_release (&scheduler->attestation);
+	status |= cmd_interface_mock_validate_and_release (&scheduler->cmd_cerberus);
+	status |= cmd_interface_mock_validate_and_release (&scheduler->cmd_mctp);
+	status |= cmd_channel_mock_validate_and_release (&scheduler->channel);
+
+	CuAssertIntEquals (test, 0, status);
+
+	mctp_interface_deinit (&scheduler->mctp);
+	device_manager_release (&scheduler->device_mgr);
+}
+
+/**
+ * Initialize an attestation scheduler for testing.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to initialize.
+ * @param num_components Number of component devices to add to the device manager.
+ */
+static void attestation_scheduler_testing_init (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, int num_components)
+{
+	int status;
+
+	attestation_scheduler_testing_init_dependencies (test, scheduler, num_components);
+
+	status = attestation_scheduler_init (&scheduler->test, &scheduler->attestation.base,
+		&scheduler->device_mgr, &scheduler->mctp, &scheduler->channel.base);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release test components and validate all mocks.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to release.
+ */
+static void attestation_scheduler_testing_release (CuTest *test,
+	struct attestation_scheduler_testing *scheduler)
+{
+	attestation_scheduler_release (&scheduler->test);
+	attestation_scheduler_testing_release_dependencies (test, scheduler);
+}
+
+/**
+ * Set the response timeout used for all devices.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to update.
+ * @param timeout_10ms The response timeout, in 10ms increments.
+ */
+static void attestation_scheduler_testing_set_timeout (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, uint8_t timeout_10ms)
+{
+	struct device_manager_full_capabilities capabilities;
+	int status;
+
+	status = device_manager_get_device_capabilities (&scheduler->device_mgr, 0, &capabilities);
+	CuAssertIntEquals (test, 0, status);
+
+	capabilities.max_timeout = timeout_10ms;
+
+	status = device_manager_update_device_capabilities (&scheduler->device_mgr, 0, &capabilities);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Set up expectations for sending a request to a device.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to use.
+ * @param send_status Status to return from sending the request.
+ */
+static void attestation_scheduler_testing_expect_send (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, int send_status)
+{
+	int status;
+
+	status = mock_expect (&scheduler->channel.mock, scheduler->channel.base.send_packet,
+		&scheduler->channel, send_status, MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Set up expectations for sending a challenge to a device.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to use.
+ * @param eid EID of the device being challenged.
+ */
+static void attestation_scheduler_testing_expect_challenge (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, uint8_t eid)
+{
+	int status;
+
+	status = mock_expect (&scheduler->attestation.mock,
+		scheduler->attestation.base.generate_challenge_request, &scheduler->attestation, 0,
+		MOCK_ARG (eid), MOCK_ARG (ATTESTATION_RIOT_SLOT_NUM), MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_expect_send (test, scheduler, 0);
+}
+
+/**
+ * Check the attestation state of a device.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to use.
+ * @param eid EID of the device to check.
+ * @param state The expected state of the device.
+ * @param result The expected attestation result for the device.
+ */
+static void attestation_scheduler_testing_check_state (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, uint8_t eid, int state, int result)
+{
+	int status;
+	int last = -1;
+
+	status = attestation_scheduler_get_device_state (&scheduler->test, eid, &last);
+	CuAssertIntEquals (test, state, status);
+	CuAssertIntEquals (test, result, last);
+}
+
+/**
+ * Deliver a certificate digests response from a device to the scheduler.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to use.
+ * @param eid EID of the device sending the response.
+ * @param num_cert The number of certificate digests in the response.
+ * @param compare_result The result of comparing the digests against the cached certificates.
+ */
+static void attestation_scheduler_testing_digest_response (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, uint8_t eid, uint8_t num_cert,
+	int compare_result)
+{
+	uint8_t data[sizeof (struct cerberus_protocol_get_certificate_digest_response) +
+		(SHA256_HASH_LENGTH * 3)];
+	struct cerberus_protocol_get_certificate_digest_response *rsp =
+		(struct cerberus_protocol_get_certificate_digest_response*) data;
+	struct cmd_interface_msg response;
+	int status;
+
+	memset (data, 0x55, sizeof (data));
+	memset (&response, 0, sizeof (response));
+
+	rsp->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	rsp->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	rsp->header.command = CERBERUS_PROTOCOL_GET_DIGEST;
+	rsp->capabilities = 1;
+	rsp->num_digests = num_cert;
+
+	response.data = data;
+	response.length = cerberus_protocol_get_certificate_digest_response_length (
+		SHA256_HASH_LENGTH * num_cert);
+	response.source_eid = eid;
+
+	status = mock_expect (&scheduler->attestation.mock,
+		scheduler->attestation.base.compare_digests, &scheduler->attestation, compare_result,
+		MOCK_ARG (eid), MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	scheduler->test.base_observer.on_get_digest_response (&scheduler->test.base_observer,
+		&response);
+}
+
+/**
+ * Deliver a certificate response from a device to the scheduler.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to use.
+ * @param eid EID of the device sending the response.
+ * @param cert_num The certificate number in the response.
+ * @param store_result The result of storing the certificate.  Set to 1 if the certificate is not
+ * expected to be stored.
+ */
+static void attestation_scheduler_testing_certificate_response (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, uint8_t eid, uint8_t cert_num,
+	int store_result)
+{
+	uint8_t data[sizeof (struct cerberus_protocol_get_certificate_response) + 32];
+	struct cerberus_protocol_get_certificate_response *rsp =
+		(struct cerberus_protocol_get_certificate_response*) data;
+	struct cmd_interface_msg response;
+	int status;
+
+	memset (data, 0xaa, sizeof (data));
+	memset (&response, 0, sizeof (response));
+
+	rsp->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	rsp->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	rsp->header.command = CERBERUS_PROTOCOL_GET_CERTIFICATE;
+	rsp->slot_num = ATTESTATION_RIOT_SLOT_NUM;
+	rsp->cert_num = cert_num;
+
+	response.data = data;
+	response.length = sizeof (data);
+	response.source_eid = eid;
+
+	if (store_result != 1) {
+		status = mock_expect (&scheduler->attestation.mock,
+			scheduler->attestation.base.store_certificate, &scheduler->attestation, store_result,
+			MOCK_ARG (eid), MOCK_ARG (ATTESTATION_RIOT_SLOT_NUM), MOCK_ARG (cert_num),
+			MOCK_ARG_PTR_CONTAINS_TMP (cerberus_protocol_certificate (rsp), 32), MOCK_ARG (32));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	scheduler->test.base_observer.on_get_certificate_response (&scheduler->test.base_observer,
+		&response);
+}
+
+/**
+ * Deliver a challenge response from a device to the scheduler.
+ *
+ * @param scheduler Testing components to use.
+ * @param eid EID of the device sending the response.
+ * @param length Length of the challenge response, not including the protocol header.
+ */
+static void attestation_scheduler_testing_challenge_response (
+	struct attestation_scheduler_testing *scheduler, uint8_t eid, size_t length)
+{
+	uint8_t data[sizeof (struct cerberus_protocol_header) +
+		ATTESTATION_SCHEDULER_MAX_CHALLENGE_RSP_LEN + 1];
+	struct cerberus_protocol_header *header = (struct cerberus_protocol_header*) data;
+	struct cmd_interface_msg response;
+
+	memset (data, eid, sizeof (data));
+	memset (&response, 0, sizeof (response));
+
+	header->msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	header->pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	header->command = CERBERUS_PROTOCOL_ATTESTATION_CHALLENGE;
+
+	response.data = data;
+	response.length = sizeof (struct cerberus_protocol_header) + length;
+	response.source_eid = eid;
+
+	scheduler->test.base_observer.on_challenge_response (&scheduler->test.base_observer,
+		&response);
+}
+
+/**
+ * Verify the next queued challenge response.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to use.
+ * @param eid EID of the device whose response will be verified.
+ * @param verify_result The result of verifying the challenge response.
+ */
+static void attestation_scheduler_testing_verify (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, uint8_t eid, int verify_result)
+{
+	uint8_t expected[ATTESTATION_SCHEDULER_TESTING_RSP_LEN];
+	int status;
+
+	memset (expected, eid, sizeof (expected));
+
+	status = mock_expect (&scheduler->attestation.mock,
+		scheduler->attestation.base.process_challenge_response, &scheduler->attestation,
+		verify_result, MOCK_ARG_PTR_CONTAINS_TMP (expected, sizeof (expected)),
+		MOCK_ARG (sizeof (expected)), MOCK_ARG (eid));
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_scheduler_verify_next (&scheduler->test);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Start a sweep and send the certificate digests request to every device.
+ *
+ * @param test The test framework.
+ * @param scheduler Testing components to use.
+ * @param num_components The number of devices being attested.
+ */
+static void attestation_scheduler_testing_start_sweep (CuTest *test,
+	struct attestation_scheduler_testing *scheduler, int num_components)
+{
+	int status;
+	int i;
+
+	status = attestation_scheduler_start_sweep (&scheduler->test);
+	CuAssertIntEquals (test, num_components, status);
+
+	for (i = 0; i < num_components; i++) {
+		attestation_scheduler_testing_expect_send (test, scheduler, 0);
+	}
+
+	status = attestation_scheduler_poll (&scheduler->test);
+	CuAssertIntEquals (test, num_components, status);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void attestation_scheduler_test_init (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init_dependencies (test, &scheduler, 1);
+
+	status = attestation_scheduler_init (&scheduler.test, &scheduler.attestation.base,
+		&scheduler.device_mgr, &scheduler.mctp, &scheduler.channel.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, scheduler.test.base_observer.on_get_digest_response);
+	CuAssertPtrNotNull (test, scheduler.test.base_observer.on_get_certificate_response);
+	CuAssertPtrNotNull (test, scheduler.test.base_observer.on_challenge_response);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_init_null (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init_dependencies (test, &scheduler, 1);
+
+	status = attestation_scheduler_init (NULL, &scheduler.attestation.base,
+		&scheduler.device_mgr, &scheduler.mctp, &scheduler.channel.base);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+
+	status = attestation_scheduler_init (&scheduler.test, NULL,
+		&scheduler.device_mgr, &scheduler.mctp, &scheduler.channel.base);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+
+	status = attestation_scheduler_init (&scheduler.test, &scheduler.attestation.base,
+		NULL, &scheduler.mctp, &scheduler.channel.base);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+
+	status = attestation_scheduler_init (&scheduler.test, &scheduler.attestation.base,
+		&scheduler.device_mgr, NULL, &scheduler.channel.base);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+
+	status = attestation_scheduler_init (&scheduler.test, &scheduler.attestation.base,
+		&scheduler.device_mgr, &scheduler.mctp, NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+
+	attestation_scheduler_testing_release_dependencies (test, &scheduler);
+}
+
+static void attestation_scheduler_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	attestation_scheduler_release (NULL);
+}
+
+static void attestation_scheduler_test_start_sweep (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+	int i;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 3);
+
+	status = attestation_scheduler_start_sweep (&scheduler.test);
+	CuAssertIntEquals (test, 3, status);
+
+	for (i = 0; i < 3; i++) {
+		attestation_scheduler_testing_check_state (test, &scheduler,
+			ATTESTATION_SCHEDULER_TESTING_EID + i, ATTESTATION_SCHEDULER_STATE_GET_DIGESTS, 0);
+	}
+
+	status = attestation_scheduler_wait_for_work (&scheduler.test, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_start_sweep_device_without_eid (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 3);
+
+	status = device_manager_update_device_entry (&scheduler.device_mgr, 3,
+		MCTP_BASE_PROTOCOL_NULL_EID, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_scheduler_start_sweep (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, ATTESTATION_SCHEDULER_TESTING_EID,
+		ATTESTATION_SCHEDULER_STATE_GET_DIGESTS, 0);
+	attestation_scheduler_testing_check_state (test, &scheduler,
+		ATTESTATION_SCHEDULER_TESTING_EID + 2, ATTESTATION_SCHEDULER_STATE_GET_DIGESTS, 0);
+
+	status = attestation_scheduler_get_device_state (&scheduler.test,
+		ATTESTATION_SCHEDULER_TESTING_EID + 1, NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_UNKNOWN_DEVICE, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_start_sweep_no_components (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 0);
+
+	status = attestation_scheduler_start_sweep (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_scheduler_get_device_state (&scheduler.test,
+		MCTP_BASE_PROTOCOL_BMC_EID, NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_UNKNOWN_DEVICE, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_start_sweep_in_progress (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 2);
+
+	status = attestation_scheduler_start_sweep (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	status = attestation_scheduler_start_sweep (&scheduler.test);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_SWEEP_IN_PROGRESS, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_start_sweep_after_completed_sweep (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1,
+		ATTESTATION_INVALID_DEVICE_NUM);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_FAILED, ATTESTATION_INVALID_DEVICE_NUM);
+
+	status = attestation_scheduler_start_sweep (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_GET_DIGESTS, 0);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_start_sweep_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_scheduler_start_sweep (NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+}
+
+static void attestation_scheduler_test_poll_no_sweep (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 2);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_poll_sends_to_all_devices (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+	int i;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 3);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 3);
+
+	for (i = 0; i < 3; i++) {
+		attestation_scheduler_testing_check_state (test, &scheduler,
+			ATTESTATION_SCHEDULER_TESTING_EID + i, ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS, 0);
+	}
+
+	/* Nothing more is sent while waiting for responses. */
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 3, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_poll_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_scheduler_poll (NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+}
+
+static void attestation_scheduler_test_attest_device_digests_match (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 2, 0);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_CHALLENGE, 0);
+
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CHALLENGE, 0);
+
+	attestation_scheduler_testing_challenge_response (&scheduler, eid,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_VERIFY, 0);
+
+	status = attestation_scheduler_wait_for_verify (&scheduler.test, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_verify (test, &scheduler, eid, 0);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_AUTHENTICATED, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_attest_device_get_certificates (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+
+	/* The second certificate doesn't match, so the second and third certificates are requested. */
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 3, 2);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE, 0);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CERTIFICATE, 0);
+
+	attestation_scheduler_testing_certificate_response (test, &scheduler, eid, 1, 0);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE, 0);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_certificate_response (test, &scheduler, eid, 2, 0);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_CHALLENGE, 0);
+
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_challenge_response (&scheduler, eid,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+	attestation_scheduler_testing_verify (test, &scheduler, eid, 0);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_AUTHENTICATED, 0);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+#ifndef ATTESTATION_SUPPORT_RSA_CHALLENGE
+static void attestation_scheduler_test_attest_multiple_devices_interleaved (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 3);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 3);
+
+	/* Responses arrive out of order. */
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid + 2, 1, 0);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1, 1);
+
+	/* The certificate request waits until no other requests are in flight. */
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid + 2);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 3, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE, 0);
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS, 0);
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + 2,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CHALLENGE, 0);
+
+	attestation_scheduler_testing_challenge_response (&scheduler, eid + 2,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid + 1, 1, 0);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 3, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CERTIFICATE, 0);
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_STATE_CHALLENGE, 0);
+
+	attestation_scheduler_testing_verify (test, &scheduler, eid + 2, 0);
+
+	attestation_scheduler_testing_certificate_response (test, &scheduler, eid, 0, 0);
+
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid);
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid + 1);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_challenge_response (&scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+	attestation_scheduler_testing_challenge_response (&scheduler, eid,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+
+	attestation_scheduler_testing_verify (test, &scheduler, eid, 0);
+	attestation_scheduler_testing_verify (test, &scheduler, eid + 1, ATTESTATION_BAD_LENGTH);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_AUTHENTICATED, 0);
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_STATE_FAILED, ATTESTATION_BAD_LENGTH);
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + 2,
+		ATTESTATION_SCHEDULER_STATE_AUTHENTICATED, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_challenges_limited_by_verify_slots (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int num_devices = ATTESTATION_SCHEDULER_MAX_VERIFY + 1;
+	int status;
+	int i;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, num_devices);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, num_devices);
+
+	for (i = 0; i < num_devices; i++) {
+		attestation_scheduler_testing_digest_response (test, &scheduler, eid + i, 1, 0);
+	}
+
+	for (i = 0; i < ATTESTATION_SCHEDULER_MAX_VERIFY; i++) {
+		attestation_scheduler_testing_expect_challenge (test, &scheduler, eid + i);
+	}
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, num_devices, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + num_devices - 1,
+		ATTESTATION_SCHEDULER_STATE_CHALLENGE, 0);
+
+	/* The last device is challenged only once a response has been verified. */
+	attestation_scheduler_testing_challenge_response (&scheduler, eid,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, num_devices, status);
+
+	attestation_scheduler_testing_verify (test, &scheduler, eid, 0);
+
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid + num_devices - 1);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, num_devices - 1, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + num_devices - 1,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CHALLENGE, 0);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+#endif
+
+#ifdef ATTESTATION_SUPPORT_RSA_CHALLENGE
+static void attestation_scheduler_test_rsa_challenges_sent_one_at_a_time (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 2);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 2);
+
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1, 0);
+
+	/* RSA challenge responses need multiple packets, so the challenge waits for the digests. */
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_CHALLENGE, 0);
+
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid + 1, 1, 0);
+
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CHALLENGE, 0);
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_STATE_CHALLENGE, 0);
+
+	attestation_scheduler_testing_challenge_response (&scheduler, eid,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid + 1);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_challenge_response (&scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+
+	attestation_scheduler_testing_verify (test, &scheduler, eid, 0);
+	attestation_scheduler_testing_verify (test, &scheduler, eid + 1, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+#endif
+
+static void attestation_scheduler_test_certificate_requests_sent_one_at_a_time (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 2);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 2);
+
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1, 1);
+
+	/* Digests from the second device can still arrive, so the certificate is not requested. */
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE, 0);
+
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid + 1, 1, 1);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CERTIFICATE, 0);
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE, 0);
+
+	/* Nothing else is sent while the certificate is being received. */
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_certificate_response (test, &scheduler, eid, 0, 0);
+
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_STATE_GET_CERTIFICATE, 0);
+
+	attestation_scheduler_testing_challenge_response (&scheduler, eid,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 2, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CERTIFICATE, 0);
+
+	attestation_scheduler_testing_verify (test, &scheduler, eid, 0);
+	attestation_scheduler_testing_certificate_response (test, &scheduler, eid + 1, 0, 0);
+
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid + 1);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_certificate_request_timeout (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+	attestation_scheduler_testing_set_timeout (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1, 1);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	platform_msleep (20);
+
+	/* The certificate request is sent again once the previous one has timed out. */
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_CERTIFICATE, 0);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_compare_digests_error (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	status = device_manager_update_device_state (&scheduler.device_mgr, 2,
+		DEVICE_MANAGER_AUTHENTICATED);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1,
+		ATTESTATION_NO_MEMORY);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_FAILED, ATTESTATION_NO_MEMORY);
+
+	status = device_manager_get_device_state (&scheduler.device_mgr, 2);
+	CuAssertIntEquals (test, DEVICE_MANAGER_AVAILABLE, status);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_store_certificate_error (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1, 1);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_certificate_response (test, &scheduler, eid, 0,
+		ATTESTATION_NO_MEMORY);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_FAILED, ATTESTATION_NO_MEMORY);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_certificate_response_wrong_cert_num (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 2, 1);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_certificate_response (test, &scheduler, eid, 1, 1);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_FAILED, ATTESTATION_SCHEDULER_UNEXPECTED_RESPONSE);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_challenge_response_too_large (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1, 0);
+
+	attestation_scheduler_testing_expect_challenge (test, &scheduler, eid);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_challenge_response (&scheduler, eid,
+		ATTESTATION_SCHEDULER_MAX_CHALLENGE_RSP_LEN + 1);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_FAILED, ATTESTATION_SCHEDULER_RESPONSE_TOO_LARGE);
+
+	status = attestation_scheduler_verify_next (&scheduler.test);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_VERIFY_QUEUE_EMPTY, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_unexpected_response (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+
+	/* Responses that don't match the outstanding request are dropped. */
+	attestation_scheduler_testing_certificate_response (test, &scheduler, eid, 0, 1);
+	attestation_scheduler_testing_challenge_response (&scheduler, eid,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+	attestation_scheduler_testing_challenge_response (&scheduler, eid + 1,
+		ATTESTATION_SCHEDULER_TESTING_RSP_LEN);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS, 0);
+
+	status = attestation_scheduler_verify_next (&scheduler.test);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_VERIFY_QUEUE_EMPTY, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_response_timeout_retry (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 2);
+	attestation_scheduler_testing_set_timeout (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 2);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid + 1, 1,
+		ATTESTATION_INVALID_ARGUMENT);
+
+	platform_msleep (20);
+
+	/* Only the request that timed out is sent again. */
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS, 0);
+
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1, 0);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_CHALLENGE, 0);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_response_timeout_no_more_retries (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+	int i;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+	attestation_scheduler_testing_set_timeout (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+
+	for (i = 0; i < ATTESTATION_SCHEDULER_MAX_RETRIES; i++) {
+		platform_msleep (20);
+
+		attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+		status = attestation_scheduler_poll (&scheduler.test);
+		CuAssertIntEquals (test, 1, status);
+
+		attestation_scheduler_testing_check_state (test, &scheduler, eid,
+			ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS, 0);
+	}
+
+	platform_msleep (20);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_FAILED, ATTESTATION_SCHEDULER_RESPONSE_TIMEOUT);
+
+	/* A late response is ignored. */
+	attestation_scheduler_testing_certificate_response (test, &scheduler, eid, 0, 1);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_FAILED, ATTESTATION_SCHEDULER_RESPONSE_TIMEOUT);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_send_error_retry (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	status = attestation_scheduler_start_sweep (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, CMD_CHANNEL_TX_FAILED);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_GET_DIGESTS, 0);
+
+	attestation_scheduler_testing_expect_send (test, &scheduler, 0);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_WAIT_DIGESTS, 0);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_generate_challenge_error (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	uint8_t eid = ATTESTATION_SCHEDULER_TESTING_EID;
+	int status;
+	int i;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+	attestation_scheduler_testing_digest_response (test, &scheduler, eid, 1, 0);
+
+	for (i = 0; i <= ATTESTATION_SCHEDULER_MAX_RETRIES; i++) {
+		status = mock_expect (&scheduler.attestation.mock,
+			scheduler.attestation.base.generate_challenge_request, &scheduler.attestation,
+			ATTESTATION_NO_MEMORY, MOCK_ARG (eid), MOCK_ARG (ATTESTATION_RIOT_SLOT_NUM),
+			MOCK_ARG_NOT_NULL);
+		CuAssertIntEquals (test, 0, status);
+
+		attestation_scheduler_poll (&scheduler.test);
+	}
+
+	attestation_scheduler_testing_check_state (test, &scheduler, eid,
+		ATTESTATION_SCHEDULER_STATE_FAILED, ATTESTATION_NO_MEMORY);
+
+	status = attestation_scheduler_poll (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_verify_next_empty (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	status = attestation_scheduler_verify_next (&scheduler.test);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_VERIFY_QUEUE_EMPTY, status);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 1);
+
+	status = attestation_scheduler_verify_next (&scheduler.test);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_VERIFY_QUEUE_EMPTY, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_verify_next_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_scheduler_verify_next (NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+}
+
+static void attestation_scheduler_test_wait_for_work_timeout (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	status = attestation_scheduler_wait_for_work (&scheduler.test, 10);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_wait_for_work_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_scheduler_wait_for_work (NULL, 10);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+}
+
+static void attestation_scheduler_test_wait_for_verify_timeout (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	status = attestation_scheduler_wait_for_verify (&scheduler.test, 10);
+	CuAssertIntEquals (test, 1, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_wait_for_verify_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_scheduler_wait_for_verify (NULL, 10);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+}
+
+static void attestation_scheduler_test_get_device_state_unknown_device (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 1);
+
+	status = attestation_scheduler_get_device_state (&scheduler.test,
+		ATTESTATION_SCHEDULER_TESTING_EID, NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_UNKNOWN_DEVICE, status);
+
+	status = attestation_scheduler_start_sweep (&scheduler.test);
+	CuAssertIntEquals (test, 1, status);
+
+	status = attestation_scheduler_get_device_state (&scheduler.test,
+		ATTESTATION_SCHEDULER_TESTING_EID + 1, NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_UNKNOWN_DEVICE, status);
+
+	status = attestation_scheduler_get_device_state (&scheduler.test,
+		MCTP_BASE_PROTOCOL_BMC_EID, NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_UNKNOWN_DEVICE, status);
+
+	attestation_scheduler_testing_release (test, &scheduler);
+}
+
+static void attestation_scheduler_test_get_device_state_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_scheduler_get_device_state (NULL, ATTESTATION_SCHEDULER_TESTING_EID,
+		NULL);
+	CuAssertIntEquals (test, ATTESTATION_SCHEDULER_INVALID_ARGUMENT, status);
+}
+
+static void attestation_scheduler_test_release_with_requests_in_flight (CuTest *test)
+{
+	struct attestation_scheduler_testing scheduler;
+	int i;
+
+	TEST_START;
+
+	attestation_scheduler_testing_init (test, &scheduler, 2);
+
+	attestation_scheduler_testing_start_sweep (test, &scheduler, 2);
+
+	attestation_scheduler_release (&scheduler.test);
+
+	/* Outstanding requests are cancelled in the MCTP layer. */
+	for (i = 0; i < MCTP_INTERFACE_MAX_PENDING_REQUESTS; i++) {
+		CuAssertIntEquals (test, false, scheduler.mctp.pending[i].active);
+	}
+
+	attestation_scheduler_testing_release_dependencies (test, &scheduler);
+}
+
+
+TEST_SUITE_START (attestation_scheduler);
+
+TEST (attestation_scheduler_test_init);
+TEST (attestation_scheduler_test_init_null);
+TEST (attestation_scheduler_test_release_null);
+TEST (attestation_scheduler_test_start_sweep);
+TEST (attestation_scheduler_test_start_sweep_device_without_eid);
+TEST (attestation_scheduler_test_start_sweep_no_components);
+TEST (attestation_scheduler_test_start_sweep_in_progress);
+TEST (attestation_scheduler_test_start_sweep_after_completed_sweep);
+TEST (attestation_scheduler_test_start_sweep_null);
+TEST (attestation_scheduler_test_poll_no_sweep);
+TEST (attestation_scheduler_test_poll_sends_to_all_devices);
+TEST (attestation_scheduler_test_poll_null);
+TEST (attestation_scheduler_test_attest_device_digests_match);
+TEST (attestation_scheduler_test_attest_device_get_certificates);
+#ifndef ATTESTATION_SUPPORT_RSA_CHALLENGE
+TEST (attestation_scheduler_test_attest_multiple_devices_interleaved);
+TEST (attestation_scheduler_test_challenges_limited_by_verify_slots);
+#endif
+#ifdef ATTESTATION_SUPPORT_RSA_CHALLENGE
+TEST (attestation_scheduler_test_rsa_challenges_sent_one_at_a_time);
+#endif
+TEST (attestation_scheduler_test_certificate_requests_sent_one_at_a_time);
+TEST (attestation_scheduler_test_certificate_request_timeout);
+TEST (attestation_scheduler_test_compare_digests_error);
+TEST (attestation_scheduler_test_store_certificate_error);
+TEST (attestation_scheduler_test_certificate_response_wrong_cert_num);
+TEST (attestation_scheduler_test_challenge_response_too_large);
+TEST (attestation_scheduler_test_unexpected_response);
+TEST (attestation_scheduler_test_response_timeout_retry);
+TEST (attestation_scheduler_test_response_timeout_no_more_retries);
+TEST (attestation_scheduler_test_send_error_retry);
+TEST (attestation_scheduler_test_generate_challenge_error);
+TEST (attestation_scheduler_test_verify_next_empty);
+TEST (attestation_scheduler_test_verify_next_null);
+TEST (attestation_scheduler_test_wait_for_work_timeout);
+TEST (attestation_scheduler_test_wait_for_work_null);
+TEST (attestation_scheduler_test_wait_for_verify_timeout);
+TEST (attestation_scheduler_test_wait_for_verify_null);
+TEST (attestation_scheduler_test_get_device_state_unknown_device);
+TEST (attestation_scheduler_test_get_device_state_null);
+TEST (attestation_scheduler_test_release_with_requests_in_flight);
+
+TEST_SUITE_END;
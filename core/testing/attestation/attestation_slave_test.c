@@ -650,6 +650,228 @@ static void attestation_slave_test_get_digests (CuTest *test)
 	complete_attestation_slave_mock_test (test, &attestation);
 }
 
+static void attestation_slave_test_get_digests_cached (CuTest *test)
+{
+	int status;
+	struct attestation_slave_testing attestation;
+	uint8_t buf[32 * 4] = {0};
+	uint8_t cert_hash[] = {
+		0x00,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0x01,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0x02,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0x03,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f
+	};
+	uint8_t num_cert = 0;
+
+	TEST_START;
+
+	setup_attestation_slave_mock_test (test, &attestation);
+
+	attestation_testing_add_int_ca_to_riot_key_manager (test, &attestation.riot,
+		&attestation.keystore, &attestation.x509);
+
+	status = mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+		&attestation.hash, 0,
+		MOCK_ARG_PTR_CONTAINS (X509_CERTSS_RSA_CA_NOPL_DER, X509_CERTSS_RSA_CA_NOPL_DER_LEN),
+		MOCK_ARG (X509_CERTSS_RSA_CA_NOPL_DER_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[0], 32, -1);
+
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+		&attestation.hash, 0,
+		MOCK_ARG_PTR_CONTAINS (X509_CERTCA_ECC_CA_NOPL_DER, X509_CERTCA_ECC_CA_NOPL_DER_LEN),
+		MOCK_ARG (X509_CERTCA_ECC_CA_NOPL_DER_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[32], 32, -1);
+
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+		&attestation.hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_DEVID_INTR_SIGNED_CERT,
+			RIOT_CORE_DEVID_INTR_SIGNED_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_DEVID_INTR_SIGNED_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[64], 32, -1);
+
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+		&attestation.hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_CERT, RIOT_CORE_ALIAS_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[96], 32, -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation.slave.get_digests (&attestation.slave, 0, buf, sizeof (buf), &num_cert);
+	CuAssertIntEquals (test, sizeof (cert_hash), status);
+	CuAssertIntEquals (test, 4, num_cert);
+
+	status = testing_validate_array (cert_hash, buf, sizeof (cert_hash));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The certificates have not changed, so the digests are not calculated again. */
+	memset (buf, 0, sizeof (buf));
+	num_cert = 0;
+
+	status = attestation.slave.get_digests (&attestation.slave, 0, buf, sizeof (buf), &num_cert);
+	CuAssertIntEquals (test, sizeof (cert_hash), status);
+	CuAssertIntEquals (test, 4, num_cert);
+
+	status = testing_validate_array (cert_hash, buf, sizeof (cert_hash));
+	CuAssertIntEquals (test, 0, status);
+
+	complete_attestation_slave_mock_test (test, &attestation);
+}
+
+static void attestation_slave_test_get_digests_riot_certificate_change (CuTest *test)
+{
+	int status;
+	struct attestation_slave_testing attestation;
+	uint8_t buf[32 * 3] = {0};
+	uint8_t cert_hash[] = {
+		0x00,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0x01,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0x02,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+	};
+	uint8_t num_cert = 0;
+
+	TEST_START;
+
+	setup_attestation_slave_mock_test (test, &attestation);
+
+	status = mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+		&attestation.hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_DEVID_CERT, RIOT_CORE_DEVID_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_DEVID_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[32], 32, -1);
+
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+		&attestation.hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_CERT, RIOT_CORE_ALIAS_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[64], 32, -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation.slave.get_digests (&attestation.slave, 0, buf, sizeof (buf), &num_cert);
+	CuAssertIntEquals (test, 2 * 32, status);
+	CuAssertIntEquals (test, 2, num_cert);
+
+	status = testing_validate_array (&cert_hash[32], buf, 2 * 32);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Storing a signed certificate chain requires the digests to be calculated again. */
+	attestation_testing_add_root_ca_to_riot_key_manager (test, &attestation.riot,
+		&attestation.keystore, &attestation.x509);
+
+	status = mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+		&attestation.hash, 0,
+		MOCK_ARG_PTR_CONTAINS (X509_CERTSS_ECC_CA_DER, X509_CERTSS_ECC_CA_DER_LEN),
+		MOCK_ARG (X509_CERTSS_ECC_CA_DER_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[0], 32, -1);
+
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+		&attestation.hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_DEVID_SIGNED_CERT, RIOT_CORE_DEVID_SIGNED_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_DEVID_SIGNED_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[32], 32, -1);
+
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+		&attestation.hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_CERT, RIOT_CORE_ALIAS_CERT_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[64], 32, -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation.slave.get_digests (&attestation.slave, 0, buf, sizeof (buf), &num_cert);
+	CuAssertIntEquals (test, sizeof (cert_hash), status);
+	CuAssertIntEquals (test, 3, num_cert);
+
+	status = testing_validate_array (cert_hash, buf, sizeof (cert_hash));
+	CuAssertIntEquals (test, 0, status);
+
+	complete_attestation_slave_mock_test (test, &attestation);
+}
+
+static void attestation_slave_test_get_digests_aux_certificate_change (CuTest *test)
+{
+	int status;
+	struct attestation_slave_testing attestation;
+	uint8_t buf[32 * 4] = {0};
+	uint8_t cert_hash[] = {
+		0x00,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0x01,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0x02,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0x03,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f
+	};
+	uint8_t num_cert = 0;
+	int i;
+
+	TEST_START;
+
+	setup_attestation_slave_mock_test (test, &attestation);
+
+	attestation_testing_add_int_ca_to_riot_key_manager (test, &attestation.riot,
+		&attestation.keystore, &attestation.x509);
+	attestation_testing_add_aux_certificate (test, &attestation.aux);
+
+	for (i = 0; i < 2; i++) {
+		status = mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+			&attestation.hash, 0,
+			MOCK_ARG_PTR_CONTAINS (X509_CERTSS_RSA_CA_NOPL_DER, X509_CERTSS_RSA_CA_NOPL_DER_LEN),
+			MOCK_ARG (X509_CERTSS_RSA_CA_NOPL_DER_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+		status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[0], 32, -1);
+
+		status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+			&attestation.hash, 0,
+			MOCK_ARG_PTR_CONTAINS (X509_CERTCA_ECC_CA_NOPL_DER, X509_CERTCA_ECC_CA_NOPL_DER_LEN),
+			MOCK_ARG (X509_CERTCA_ECC_CA_NOPL_DER_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+		status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[32], 32, -1);
+
+		status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+			&attestation.hash, 0,
+			MOCK_ARG_PTR_CONTAINS (RIOT_CORE_DEVID_INTR_SIGNED_CERT,
+				RIOT_CORE_DEVID_INTR_SIGNED_CERT_LEN),
+			MOCK_ARG (RIOT_CORE_DEVID_INTR_SIGNED_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+		status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[64], 32, -1);
+
+		status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+			&attestation.hash, 0,
+			MOCK_ARG_PTR_CONTAINS (X509_CERTCA_RSA_EE_DER, X509_CERTCA_RSA_EE_DER_LEN),
+			MOCK_ARG (X509_CERTCA_RSA_EE_DER_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+		status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[96], 32, -1);
+
+		CuAssertIntEquals (test, 0, status);
+
+		status = attestation.slave.get_digests (&attestation.slave, 1, buf, sizeof (buf),
+			&num_cert);
+		CuAssertIntEquals (test, sizeof (cert_hash), status);
+		CuAssertIntEquals (test, 4, num_cert);
+
+		status = testing_validate_array (cert_hash, buf, sizeof (cert_hash));
+		CuAssertIntEquals (test, 0, status);
+
+		/* Replacing the aux certificate requires the digests to be calculated again. */
+		status = mock_expect (&attestation.keystore.mock, attestation.keystore.base.erase_key,
+			&attestation.keystore, 0, MOCK_ARG (0));
+		CuAssertIntEquals (test, 0, status);
+
+		status = aux_attestation_erase_key (&attestation.aux);
+		CuAssertIntEquals (test, 0, status);
+
+		attestation_testing_add_aux_certificate (test, &attestation.aux);
+	}
+
+	complete_attestation_slave_mock_test (test, &attestation);
+}
+
 static void attestation_slave_test_get_digests_no_aux (CuTest *test)
 {
 	int status;
@@ -2427,6 +2649,112 @@ static void attestation_slave_test_get_certificate_null (CuTest *test)
 	complete_attestation_slave_mock_test (test, &attestation);
 }
 
+static void attestation_slave_test_enable_nonce_pool (CuTest *test)
+{
+	struct attestation_slave_testing attestation;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+
+	TEST_START;
+
+	memset (&nonce, 0x55, sizeof (nonce));
+	nonce.length = ECC_KEY_LENGTH_256;
+
+	setup_attestation_slave_mock_test (test, &attestation);
+
+	status = attestation_slave_enable_nonce_pool (&attestation.slave, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&attestation.ecc.mock, attestation.ecc.base.generate_ecdsa_nonce,
+		&attestation.ecc, 0, MOCK_ARG_SAVED_ARG (0), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&attestation.ecc.mock, 1, &nonce, sizeof (nonce), -1);
+	status |= mock_expect (&attestation.ecc.mock, attestation.ecc.base.generate_ecdsa_nonce,
+		&attestation.ecc, 0, MOCK_ARG_SAVED_ARG (0), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&attestation.ecc.mock, 1, &nonce, sizeof (nonce), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_slave_refill_nonce_pool (&attestation.slave);
+	CuAssertIntEquals (test, 2, status);
+
+	status = attestation_slave_refill_nonce_pool (&attestation.slave);
+	CuAssertIntEquals (test, 0, status);
+
+	complete_attestation_slave_mock_test (test, &attestation);
+}
+
+static void attestation_slave_test_enable_nonce_pool_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_slave_enable_nonce_pool (NULL, 2);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+}
+
+static void attestation_slave_test_enable_nonce_pool_twice (CuTest *test)
+{
+	struct attestation_slave_testing attestation;
+	int status;
+
+	TEST_START;
+
+	setup_attestation_slave_mock_test (test, &attestation);
+
+	status = attestation_slave_enable_nonce_pool (&attestation.slave, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_slave_enable_nonce_pool (&attestation.slave, 2);
+	CuAssertIntEquals (test, ATTESTATION_UNSUPPORTED_OPERATION, status);
+
+	complete_attestation_slave_mock_test (test, &attestation);
+}
+
+static void attestation_slave_test_enable_nonce_pool_too_many_nonces (CuTest *test)
+{
+	struct attestation_slave_testing attestation;
+	int status;
+
+	TEST_START;
+
+	setup_attestation_slave_mock_test (test, &attestation);
+
+	status = attestation_slave_enable_nonce_pool (&attestation.slave,
+		ECC_NONCE_POOL_MAX_NONCES + 1);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TOO_MANY_NONCES, status);
+
+	/* The attestation manager is still usable without the pool. */
+	status = attestation_slave_refill_nonce_pool (&attestation.slave);
+	CuAssertIntEquals (test, 0, status);
+
+	complete_attestation_slave_mock_test (test, &attestation);
+}
+
+static void attestation_slave_test_refill_nonce_pool_not_enabled (CuTest *test)
+{
+	struct attestation_slave_testing attestation;
+	int status;
+
+	TEST_START;
+
+	setup_attestation_slave_mock_test (test, &attestation);
+
+	status = attestation_slave_refill_nonce_pool (&attestation.slave);
+	CuAssertIntEquals (test, 0, status);
+
+	complete_attestation_slave_mock_test (test, &attestation);
+}
+
+static void attestation_slave_test_refill_nonce_pool_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_slave_refill_nonce_pool (NULL);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+}
+
 static void attestation_slave_test_pa_rot_challenge_response (CuTest *test)
 {
 	int status;
@@ -2890,6 +3218,151 @@ static void attestation_slave_test_pa_rot_challenge_response_sign_fail (CuTest *
 	complete_attestation_slave_mock_test (test, &attestation);
 }
 
+static void attestation_slave_test_pa_rot_challenge_response_nonce_pool (CuTest *test)
+{
+	int status;
+	struct attestation_slave_testing attestation;
+	struct attestation_challenge challenge = {0};
+	struct ecc_ecdsa_nonce nonce;
+	uint8_t buf[136] = {0};
+	uint8_t measurement[] = {
+		0xfc,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f
+	};
+	uint8_t signature[] = {
+		0xfc,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0xfc,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f
+	};
+	uint16_t buf_len = sizeof (buf);
+
+	TEST_START;
+
+	memset (nonce.k, 0x11, sizeof (nonce.k));
+	memset (nonce.r, 0x22, sizeof (nonce.r));
+	nonce.length = ECC_KEY_LENGTH_256;
+
+	challenge.nonce[0] = 0xAA;
+	challenge.nonce[31] = 0xBB;
+
+	memcpy (buf, (uint8_t*) &challenge, sizeof (struct attestation_challenge));
+
+	setup_attestation_slave_mock_test (test, &attestation);
+
+	status = attestation_slave_enable_nonce_pool (&attestation.slave, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&attestation.ecc.mock, attestation.ecc.base.generate_ecdsa_nonce,
+		&attestation.ecc, 0, MOCK_ARG_SAVED_ARG (0), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&attestation.ecc.mock, 1, &nonce, sizeof (nonce), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_slave_refill_nonce_pool (&attestation.slave);
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_expect (&attestation.rng.mock, attestation.rng.base.generate_random_buffer,
+		&attestation.rng, 0, MOCK_ARG (32), MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&attestation.hash.mock, attestation.hash.base.start_sha256,
+		&attestation.hash, 0);
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.update, &attestation.hash,
+		0, MOCK_ARG_PTR_CONTAINS (&challenge, sizeof (struct attestation_challenge)),
+		MOCK_ARG (sizeof (struct attestation_challenge)));
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.update, &attestation.hash,
+		0, MOCK_ARG_NOT_NULL, MOCK_ARG (32 + sizeof (struct attestation_response)));
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.finish, &attestation.hash,
+		0, MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&attestation.ecc.mock, attestation.ecc.base.sign_with_nonce,
+		&attestation.ecc, 64, MOCK_ARG_SAVED_ARG (0),
+		MOCK_ARG_PTR_CONTAINS (&nonce, sizeof (nonce)), MOCK_ARG_NOT_NULL, MOCK_ARG (32),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (64));
+	status |= mock_expect_output (&attestation.ecc.mock, 4, signature, sizeof (signature), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_update_digest (&attestation.store, 0, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation.slave.challenge_response (&attestation.slave, buf, buf_len);
+	CuAssertIntEquals (test, 136, status);
+
+	status = testing_validate_array (measurement, buf + sizeof (struct attestation_response),
+		sizeof (measurement));
+	status |= testing_validate_array (signature,
+		buf + sizeof (struct attestation_response) + sizeof (measurement),
+		sizeof (signature));
+	CuAssertIntEquals (test, 0, status);
+
+	complete_attestation_slave_mock_test (test, &attestation);
+}
+
+static void attestation_slave_test_pa_rot_challenge_response_nonce_pool_empty (CuTest *test)
+{
+	int status;
+	struct attestation_slave_testing attestation;
+	struct attestation_challenge challenge = {0};
+	uint8_t buf[136] = {0};
+	uint8_t measurement[] = {
+		0xfc,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f
+	};
+	uint8_t signature[] = {
+		0xfc,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,
+		0xfc,0x3d,0x91,0xe6,0xc1,0x13,0xd6,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+		0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f
+	};
+	uint16_t buf_len = sizeof (buf);
+
+	TEST_START;
+
+	challenge.nonce[0] = 0xAA;
+	challenge.nonce[31] = 0xBB;
+
+	memcpy (buf, (uint8_t*) &challenge, sizeof (struct attestation_challenge));
+
+	setup_attestation_slave_mock_test (test, &attestation);
+
+	status = attestation_slave_enable_nonce_pool (&attestation.slave, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&attestation.rng.mock, attestation.rng.base.generate_random_buffer,
+		&attestation.rng, 0, MOCK_ARG (32), MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&attestation.hash.mock, attestation.hash.base.start_sha256,
+		&attestation.hash, 0);
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.update, &attestation.hash,
+		0, MOCK_ARG_PTR_CONTAINS (&challenge, sizeof (struct attestation_challenge)),
+		MOCK_ARG (sizeof (struct attestation_challenge)));
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.update, &attestation.hash,
+		0, MOCK_ARG_NOT_NULL, MOCK_ARG (32 + sizeof (struct attestation_response)));
+	status |= mock_expect (&attestation.hash.mock, attestation.hash.base.finish, &attestation.hash,
+		0, MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&attestation.ecc.mock, attestation.ecc.base.sign, &attestation.ecc, 64,
+		MOCK_ARG_SAVED_ARG (0), MOCK_ARG_NOT_NULL, MOCK_ARG (32), MOCK_ARG_NOT_NULL, MOCK_ARG (64));
+	status |= mock_expect_output (&attestation.ecc.mock, 3, signature, sizeof (signature), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_update_digest (&attestation.store, 0, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation.slave.challenge_response (&attestation.slave, buf, buf_len);
+	CuAssertIntEquals (test, 136, status);
+
+	status = testing_validate_array (signature,
+		buf + sizeof (struct attestation_response) + sizeof (measurement),
+		sizeof (signature));
+	CuAssertIntEquals (test, 0, status);
+
+	complete_attestation_slave_mock_test (test, &attestation);
+}
+
 static void attestation_slave_test_pa_rot_challenge_response_buf_too_small (CuTest *test)
 {
 	int status;
@@ -3614,6 +4087,9 @@ TEST (attestation_slave_test_init_no_aux_init_keypair_fail);
 TEST (attestation_slave_test_init_no_aux_null);
 TEST (attestation_slave_test_release_null);
 TEST (attestation_slave_test_get_digests);
+TEST (attestation_slave_test_get_digests_cached);
+TEST (attestation_slave_test_get_digests_riot_certificate_change);
+TEST (attestation_slave_test_get_digests_aux_certificate_change);
 TEST (attestation_slave_test_get_digests_no_aux);
 TEST (attestation_slave_test_get_digests_aux_slot);
 TEST (attestation_slave_test_get_digests_aux_slot_no_aux);
@@ -3672,6 +4148,12 @@ TEST (attestation_slave_test_get_certificate_invalid_cert_num_no_int_ca_aux_slot
 TEST (attestation_slave_test_get_certificate_invalid_cert_num_no_root_ca);
 TEST (attestation_slave_test_get_certificate_invalid_cert_num_no_root_ca_aux_slot);
 TEST (attestation_slave_test_get_certificate_null);
+TEST (attestation_slave_test_enable_nonce_pool);
+TEST (attestation_slave_test_enable_nonce_pool_null);
+TEST (attestation_slave_test_enable_nonce_pool_twice);
+TEST (attestation_slave_test_enable_nonce_pool_too_many_nonces);
+TEST (attestation_slave_test_refill_nonce_pool_not_enabled);
+TEST (attestation_slave_test_refill_nonce_pool_null);
 TEST (attestation_slave_test_pa_rot_challenge_response);
 TEST (attestation_slave_test_pa_rot_challenge_response_no_aux);
 TEST (attestation_slave_test_pa_rot_challenge_response_invalid_slot_num);
@@ -3683,6 +4165,8 @@ TEST (attestation_slave_test_pa_rot_challenge_response_rng_fail);
 TEST (attestation_slave_test_pa_rot_challenge_response_update_response_hash_fail);
 TEST (attestation_slave_test_pa_rot_challenge_response_finish_hash_fail);
 TEST (attestation_slave_test_pa_rot_challenge_response_sign_fail);
+TEST (attestation_slave_test_pa_rot_challenge_response_nonce_pool);
+TEST (attestation_slave_test_pa_rot_challenge_response_nonce_pool_empty);
 TEST (attestation_slave_test_pa_rot_challenge_response_buf_too_small);
 TEST (attestation_slave_test_pa_rot_challenge_response_null);
 TEST (attestation_slave_test_aux_attestation_unseal);
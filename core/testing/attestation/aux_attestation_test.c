@@ -2126,6 +2126,54 @@ static void aux_attestation_test_get_certificate_null (CuTest *test)
 
 }
 
+static void aux_attestation_test_get_certificate_version (CuTest *test)
+{
+	struct aux_attestation_testing aux;
+	int status;
+	uint8_t *cert_der;
+	uint32_t version;
+
+	TEST_START;
+
+	cert_der = platform_malloc (X509_CERTCA_RSA_EE_DER_LEN);
+	CuAssertPtrNotNull (test, cert_der);
+
+	memcpy (cert_der, X509_CERTCA_RSA_EE_DER, X509_CERTCA_RSA_EE_DER_LEN);
+
+	aux_attestation_testing_init (test, &aux);
+
+	version = aux_attestation_get_certificate_version (&aux.test);
+
+	status = aux_attestation_set_certificate (&aux.test, cert_der, X509_CERTCA_RSA_EE_DER_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertTrue (test, (version != aux_attestation_get_certificate_version (&aux.test)));
+	version = aux_attestation_get_certificate_version (&aux.test);
+
+	status = aux_attestation_set_certificate (&aux.test, cert_der, X509_CERTCA_RSA_EE_DER_LEN);
+	CuAssertIntEquals (test, AUX_ATTESTATION_HAS_CERTIFICATE, status);
+
+	CuAssertIntEquals (test, version, aux_attestation_get_certificate_version (&aux.test));
+
+	status = mock_expect (&aux.keystore.mock, aux.keystore.base.erase_key, &aux.keystore, 0,
+		MOCK_ARG (0));
+	CuAssertIntEquals (test, 0, status);
+
+	status = aux_attestation_erase_key (&aux.test);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertTrue (test, (version != aux_attestation_get_certificate_version (&aux.test)));
+
+	aux_attestation_testing_validate_and_release (test, &aux);
+}
+
+static void aux_attestation_test_get_certificate_version_null (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, aux_attestation_get_certificate_version (NULL));
+}
+
 static void aux_attestation_test_unseal_rsa_oaep_sha1 (CuTest *test)
 {
 	struct aux_attestation_testing aux;
@@ -6300,6 +6348,8 @@ TEST (aux_attestation_test_set_static_certificate_no_rsa_support);
 TEST (aux_attestation_test_set_static_certificate_twice);
 TEST (aux_attestation_test_set_static_certificate_after_create);
 TEST (aux_attestation_test_get_certificate_null);
+TEST (aux_attestation_test_get_certificate_version);
+TEST (aux_attestation_test_get_certificate_version_null);
 TEST (aux_attestation_test_unseal_rsa_oaep_sha1);
 TEST (aux_attestation_test_unseal_rsa_oaep_sha256);
 TEST (aux_attestation_test_unseal_rsa_pkcs15);
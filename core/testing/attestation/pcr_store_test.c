@@ -1924,6 +1924,37 @@ static void pcr_store_test_get_attestation_log_small_buffer (CuTest *test)
 	status |= mock_expect_output (&hash.mock, 0, digests[3], PCR_DIGEST_LENGTH, -1);
 	CuAssertIntEquals (test, 0, status);
 
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (buffer0, PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[3], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[2], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[2], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[4], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[1], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[1], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[5], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[0], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+
 	for (i_measurement = 0; i_measurement < 3; ++i_measurement) {
 		pcr_store_update_digest (&store, PCR_MEASUREMENT (0, i_measurement), digests[i_measurement],
 			PCR_DIGEST_LENGTH);
@@ -2041,6 +2072,37 @@ static void pcr_store_test_get_attestation_log_small_buffer_not_entry_aligned (C
 	status |= mock_expect_output (&hash.mock, 0, digests[3], PCR_DIGEST_LENGTH, -1);
 	CuAssertIntEquals (test, 0, status);
 
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (buffer0, PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[3], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[2], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[2], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[4], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[1], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[1], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[5], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[0], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+
 	for (i_measurement = 0; i_measurement < 3; ++i_measurement) {
 		pcr_store_update_digest (&store, PCR_MEASUREMENT (0, i_measurement), digests[i_measurement],
 			PCR_DIGEST_LENGTH);
@@ -2408,6 +2470,299 @@ static void pcr_store_test_get_attestation_log_compute_fail (CuTest *test)
 	complete_pcr_store_mock_test (test, &store, &hash);
 }
 
+static void pcr_store_test_get_attestation_log_no_changes (CuTest *test)
+{
+	struct pcr_store store;
+	struct hash_engine_mock hash;
+	struct pcr_store_attestation_log_entry buf[2];
+	struct pcr_store_attestation_log_entry exp_buf[2];
+	uint8_t buffer0[PCR_DIGEST_LENGTH] = {0};
+	uint8_t digests[4][PCR_DIGEST_LENGTH] = {
+		{
+			0xab,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0xcd,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0xef,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0x12,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		}
+	};
+	int i_measurement;
+	int status;
+
+	TEST_START;
+
+	memset (exp_buf, 0, sizeof (exp_buf));
+	for (i_measurement = 0; i_measurement < 2; ++i_measurement) {
+		exp_buf[i_measurement].header.log_magic = 0xCB;
+		exp_buf[i_measurement].header.length = sizeof (struct pcr_store_attestation_log_entry);
+		exp_buf[i_measurement].header.entry_id = i_measurement;
+		exp_buf[i_measurement].entry.digest_algorithm_id = 0x0B;
+		exp_buf[i_measurement].entry.digest_count = 1;
+		exp_buf[i_measurement].entry.measurement_size = 32;
+		exp_buf[i_measurement].entry.measurement_type = PCR_MEASUREMENT (0, i_measurement);
+
+		memcpy (exp_buf[i_measurement].entry.digest, digests[i_measurement],
+			sizeof (exp_buf[i_measurement].entry.digest));
+		memcpy (exp_buf[i_measurement].entry.measurement, digests[2 + i_measurement],
+			sizeof (exp_buf[i_measurement].entry.measurement));
+	}
+
+	setup_pcr_store_mock_test (test, &store, &hash, 2, 0);
+
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (buffer0, PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[0], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[2], PCR_DIGEST_LENGTH, -1);
+
+	status |= mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[2], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[1], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[3], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_update_digest (&store, PCR_MEASUREMENT (0, 0), digests[0],
+		PCR_DIGEST_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_update_digest (&store, PCR_MEASUREMENT (0, 1), digests[1],
+		PCR_DIGEST_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_get_attestation_log (&store, &hash.base, 0, (uint8_t*) buf, sizeof (buf));
+	CuAssertIntEquals (test, sizeof (buf), status);
+
+	status = testing_validate_array ((uint8_t*) exp_buf, (uint8_t*) buf, sizeof (buf));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Nothing has changed, so the log is read without computing any measurements. */
+	memset (buf, 0, sizeof (buf));
+
+	status = pcr_store_get_attestation_log (&store, &hash.base, 0, (uint8_t*) buf, sizeof (buf));
+	CuAssertIntEquals (test, sizeof (buf), status);
+
+	status = testing_validate_array ((uint8_t*) exp_buf, (uint8_t*) buf, sizeof (buf));
+	CuAssertIntEquals (test, 0, status);
+
+	complete_pcr_store_mock_test (test, &store, &hash);
+}
+
+static void pcr_store_test_get_attestation_log_chunked_update (CuTest *test)
+{
+	struct pcr_store store;
+	struct hash_engine_mock hash;
+	struct pcr_store_attestation_log_entry buf[2];
+	struct pcr_store_attestation_log_entry exp_buf[2];
+	uint8_t buffer0[PCR_DIGEST_LENGTH] = {0};
+	uint8_t digests[6][PCR_DIGEST_LENGTH] = {
+		{
+			0xab,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0xcd,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0xef,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0x12,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0x23,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0x45,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		}
+	};
+	int i_measurement;
+	int status;
+
+	TEST_START;
+
+	memset (exp_buf, 0, sizeof (exp_buf));
+	for (i_measurement = 0; i_measurement < 2; ++i_measurement) {
+		exp_buf[i_measurement].header.log_magic = 0xCB;
+		exp_buf[i_measurement].header.length = sizeof (struct pcr_store_attestation_log_entry);
+		exp_buf[i_measurement].header.entry_id = i_measurement;
+		exp_buf[i_measurement].entry.digest_algorithm_id = 0x0B;
+		exp_buf[i_measurement].entry.digest_count = 1;
+		exp_buf[i_measurement].entry.measurement_size = 32;
+		exp_buf[i_measurement].entry.measurement_type = PCR_MEASUREMENT (0, i_measurement);
+
+		memcpy (exp_buf[i_measurement].entry.digest, digests[i_measurement],
+			sizeof (exp_buf[i_measurement].entry.digest));
+		memcpy (exp_buf[i_measurement].entry.measurement, digests[2 + i_measurement],
+			sizeof (exp_buf[i_measurement].entry.measurement));
+	}
+
+	setup_pcr_store_mock_test (test, &store, &hash, 2, 0);
+
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (buffer0, PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[0], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[2], PCR_DIGEST_LENGTH, -1);
+
+	status |= mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[2], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[1], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[3], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_update_digest (&store, PCR_MEASUREMENT (0, 0), digests[0],
+		PCR_DIGEST_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_update_digest (&store, PCR_MEASUREMENT (0, 1), digests[1],
+		PCR_DIGEST_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_get_attestation_log (&store, &hash.base, 0, (uint8_t*) buf,
+		sizeof (struct pcr_store_attestation_log_entry));
+	CuAssertIntEquals (test, sizeof (struct pcr_store_attestation_log_entry), status);
+
+	status = pcr_store_update_digest (&store, PCR_MEASUREMENT (0, 1), digests[4],
+		PCR_DIGEST_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Continuing the read returns the log as it was when the read started. */
+	status = pcr_store_get_attestation_log (&store, &hash.base,
+		sizeof (struct pcr_store_attestation_log_entry), (uint8_t*) &buf[1],
+		sizeof (struct pcr_store_attestation_log_entry));
+	CuAssertIntEquals (test, sizeof (struct pcr_store_attestation_log_entry), status);
+
+	status = testing_validate_array ((uint8_t*) exp_buf, (uint8_t*) buf, sizeof (buf));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Starting a new read picks up the updated measurement. */
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[2], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[4], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[5], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+	memcpy (exp_buf[1].entry.digest, digests[4], sizeof (exp_buf[1].entry.digest));
+	memcpy (exp_buf[1].entry.measurement, digests[5], sizeof (exp_buf[1].entry.measurement));
+
+	status = pcr_store_get_attestation_log (&store, &hash.base, 0, (uint8_t*) buf, sizeof (buf));
+	CuAssertIntEquals (test, sizeof (buf), status);
+
+	status = testing_validate_array ((uint8_t*) exp_buf, (uint8_t*) buf, sizeof (buf));
+	CuAssertIntEquals (test, 0, status);
+
+	complete_pcr_store_mock_test (test, &store, &hash);
+}
+
+static void pcr_store_test_get_attestation_log_after_compute_fail (CuTest *test)
+{
+	struct pcr_store store;
+	struct hash_engine_mock hash;
+	struct pcr_store_attestation_log_entry buf;
+	struct pcr_store_attestation_log_entry exp_buf;
+	uint8_t buffer0[PCR_DIGEST_LENGTH] = {0};
+	uint8_t digests[3][PCR_DIGEST_LENGTH] = {
+		{
+			0xab,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0xcd,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0xef,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		}
+	};
+	int status;
+
+	TEST_START;
+
+	memset (&exp_buf, 0, sizeof (exp_buf));
+	exp_buf.header.log_magic = 0xCB;
+	exp_buf.header.length = sizeof (struct pcr_store_attestation_log_entry);
+	exp_buf.header.entry_id = 1;
+	exp_buf.entry.digest_algorithm_id = 0x0B;
+	exp_buf.entry.digest_count = 1;
+	exp_buf.entry.measurement_size = 32;
+	exp_buf.entry.measurement_type = PCR_MEASUREMENT (0, 1);
+	memcpy (exp_buf.entry.measurement, digests[2], sizeof (exp_buf.entry.measurement));
+
+	setup_pcr_store_mock_test (test, &store, &hash, 2, 0);
+
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, HASH_ENGINE_NO_MEMORY);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_update_digest (&store, PCR_MEASUREMENT (0, 0), digests[0],
+		PCR_DIGEST_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_get_attestation_log (&store, &hash.base, 0, (uint8_t*) &buf, sizeof (buf));
+	CuAssertIntEquals (test, HASH_ENGINE_NO_MEMORY, status);
+
+	/* There is no valid log, so it must be generated even when not reading from the start. */
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (buffer0, PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[0], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[1], PCR_DIGEST_LENGTH, -1);
+
+	status |= mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (digests[1], PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (buffer0, PCR_DIGEST_LENGTH), MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (PCR_DIGEST_LENGTH));
+	status |= mock_expect_output (&hash.mock, 0, digests[2], PCR_DIGEST_LENGTH, -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_get_attestation_log (&store, &hash.base,
+		sizeof (struct pcr_store_attestation_log_entry), (uint8_t*) &buf, sizeof (buf));
+	CuAssertIntEquals (test, sizeof (buf), status);
+
+	status = testing_validate_array ((uint8_t*) &exp_buf, (uint8_t*) &buf, sizeof (buf));
+	CuAssertIntEquals (test, 0, status);
+
+	complete_pcr_store_mock_test (test, &store, &hash);
+}
+
 static void pcr_store_test_invalidate_measurement (CuTest *test)
 {
 	struct pcr_store store;
@@ -3824,6 +4179,9 @@ TEST (pcr_store_test_get_attestation_log_small_buffer_nonzero_offset);
 TEST (pcr_store_test_get_attestation_log_invalid_offset);
 TEST (pcr_store_test_get_attestation_log_invalid_arg);
 TEST (pcr_store_test_get_attestation_log_compute_fail);
+TEST (pcr_store_test_get_attestation_log_no_changes);
+TEST (pcr_store_test_get_attestation_log_chunked_update);
+TEST (pcr_store_test_get_attestation_log_after_compute_fail);
 TEST (pcr_store_test_invalidate_measurement);
 TEST (pcr_store_test_invalidate_measurement_explicit);
 TEST (pcr_store_test_invalidate_measurement_null);
@@ -2886,6 +2886,313 @@ static void session_manager_ecc_test_decrypt_message_invalid_arg (CuTest *test)
 	release_session_manager_ecc_test (test, &cmd);
 }
 
+/**
+ * Set up a message for decryption tests using dedicated session AES engines.
+ *
+ * @param rq The request to initialize.
+ * @param rq_data Buffer for the request data.
+ */
+static void session_manager_ecc_testing_init_encrypted_request (struct cmd_interface_msg *rq,
+	uint8_t *rq_data)
+{
+	uint8_t data[] = {
+		0xA,0xB,0xC,0xD,0xE,0xF,0xAA,0xBB,0xCC,0xDD,0xEE,0xFF
+	};
+
+	rq->data = rq_data;
+	memcpy (rq->data, data, sizeof (data));
+	memcpy (rq->data + sizeof (data), SESSION_AES_GCM_TAG, sizeof (SESSION_AES_GCM_TAG));
+	memcpy (rq->data + sizeof (data) + sizeof (SESSION_AES_GCM_TAG), SESSION_AES_IV,
+		sizeof (SESSION_AES_IV));
+
+	rq->length = 40;
+	rq->source_eid = 0x10;
+	rq->max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+}
+
+static void session_manager_ecc_test_decrypt_message_session_aes_engines (CuTest *test)
+{
+	struct session_manager_ecc_testing cmd;
+	struct aes_engine_mock aes[3];
+	struct aes_engine *engines[] = {&aes[0].base, &aes[1].base, &aes[2].base};
+	uint8_t rq_data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg rq;
+	uint8_t aes_key[] = {
+		0xf1,0x3b,0x43,0x16,0x2c,0xe4,0x05,0x75,0x73,0xc5,0x54,0x10,0xad,0xd5,0xc5,0xc6,
+		0x0e,0x9a,0x37,0xff,0x3e,0xa0,0x02,0x34,0xd6,0x41,0x80,0xfa,0x1a,0x0e,0x0a,0x04
+	};
+	int i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < 3; i++) {
+		status = aes_mock_init (&aes[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	setup_session_manager_ecc_test (test, &cmd);
+
+	status = session_manager_set_session_aes_engines (&cmd.session.base, engines, 3);
+	CuAssertIntEquals (test, 0, status);
+
+	session_manager_ecc_establish_session (test, &cmd, 0x10);
+
+	status = mock_expect (&aes[0].mock, aes[0].base.set_key, &aes[0], 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)), MOCK_ARG (sizeof (aes_key)));
+
+	for (i = 0; i < 2; i++) {
+		status |= mock_expect (&aes[0].mock, aes[0].base.decrypt_data, &aes[0], 0,
+			MOCK_ARG_NOT_NULL, MOCK_ARG (40 - SESSION_MANAGER_TRAILER_LEN -
+				sizeof (struct cerberus_protocol_header)),
+			MOCK_ARG_PTR_CONTAINS (SESSION_AES_GCM_TAG, sizeof (SESSION_AES_GCM_TAG)),
+			MOCK_ARG_PTR_CONTAINS (SESSION_AES_IV, sizeof (SESSION_AES_IV)),
+			MOCK_ARG (sizeof (SESSION_AES_IV)), MOCK_ARG_NOT_NULL, MOCK_ARG_ANY);
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 2; i++) {
+		session_manager_ecc_testing_init_encrypted_request (&rq, rq_data);
+
+		status = cmd.session.base.decrypt_message (&cmd.session.base, &rq);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	for (i = 0; i < 3; i++) {
+		status = aes_mock_validate_and_release (&aes[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	release_session_manager_ecc_test (test, &cmd);
+}
+
+static void session_manager_ecc_test_encrypt_message_session_aes_engines (CuTest *test)
+{
+	struct session_manager_ecc_testing cmd;
+	struct aes_engine_mock aes[3];
+	struct aes_engine *engines[] = {&aes[0].base, &aes[1].base, &aes[2].base};
+	uint8_t rq_data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg rq;
+	uint8_t aes_key[] = {
+		0xf1,0x3b,0x43,0x16,0x2c,0xe4,0x05,0x75,0x73,0xc5,0x54,0x10,0xad,0xd5,0xc5,0xc6,
+		0x0e,0x9a,0x37,0xff,0x3e,0xa0,0x02,0x34,0xd6,0x41,0x80,0xfa,0x1a,0x0e,0x0a,0x04
+	};
+	int i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < 3; i++) {
+		status = aes_mock_init (&aes[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	setup_session_manager_ecc_test (test, &cmd);
+
+	status = session_manager_set_session_aes_engines (&cmd.session.base, engines, 3);
+	CuAssertIntEquals (test, 0, status);
+
+	session_manager_ecc_establish_session (test, &cmd, 0x11);
+
+	status = ecc_mock_validate_and_release (&cmd.ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_mock_init (&cmd.ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	session_manager_ecc_establish_session (test, &cmd, 0x10);
+
+	status = mock_expect (&aes[1].mock, aes[1].base.set_key, &aes[1], 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)), MOCK_ARG (sizeof (aes_key)));
+	status |= mock_expect (&aes[1].mock, aes[1].base.decrypt_data, &aes[1], 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (40 - SESSION_MANAGER_TRAILER_LEN -
+			sizeof (struct cerberus_protocol_header)),
+		MOCK_ARG_PTR_CONTAINS (SESSION_AES_GCM_TAG, sizeof (SESSION_AES_GCM_TAG)),
+		MOCK_ARG_PTR_CONTAINS (SESSION_AES_IV, sizeof (SESSION_AES_IV)),
+		MOCK_ARG (sizeof (SESSION_AES_IV)), MOCK_ARG_NOT_NULL, MOCK_ARG_ANY);
+
+	status |= mock_expect (&cmd.rng.mock, cmd.rng.base.generate_random_buffer, &cmd.rng, 0,
+		MOCK_ARG (sizeof (SESSION_AES_IV)), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&cmd.rng.mock, 1, SESSION_AES_IV, sizeof (SESSION_AES_IV), 0);
+
+	status |= mock_expect (&aes[1].mock, aes[1].base.encrypt_data, &aes[1], 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (40 - SESSION_MANAGER_TRAILER_LEN -
+			sizeof (struct cerberus_protocol_header)),
+		MOCK_ARG_PTR_CONTAINS (SESSION_AES_IV, sizeof (SESSION_AES_IV)),
+		MOCK_ARG (sizeof (SESSION_AES_IV)), MOCK_ARG_NOT_NULL, MOCK_ARG_ANY, MOCK_ARG_NOT_NULL,
+		MOCK_ARG_ANY);
+
+	CuAssertIntEquals (test, 0, status);
+
+	session_manager_ecc_testing_init_encrypted_request (&rq, rq_data);
+
+	status = cmd.session.base.decrypt_message (&cmd.session.base, &rq);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd.session.base.encrypt_message (&cmd.session.base, &rq);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 3; i++) {
+		status = aes_mock_validate_and_release (&aes[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	release_session_manager_ecc_test (test, &cmd);
+}
+
+static void session_manager_ecc_test_decrypt_message_session_aes_engines_new_session (
+	CuTest *test)
+{
+	struct session_manager_ecc_testing cmd;
+	struct aes_engine_mock aes[3];
+	struct aes_engine *engines[] = {&aes[0].base, &aes[1].base, &aes[2].base};
+	uint8_t rq_data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg rq;
+	uint8_t aes_key[] = {
+		0xf1,0x3b,0x43,0x16,0x2c,0xe4,0x05,0x75,0x73,0xc5,0x54,0x10,0xad,0xd5,0xc5,0xc6,
+		0x0e,0x9a,0x37,0xff,0x3e,0xa0,0x02,0x34,0xd6,0x41,0x80,0xfa,0x1a,0x0e,0x0a,0x04
+	};
+	int i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < 3; i++) {
+		status = aes_mock_init (&aes[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	setup_session_manager_ecc_test (test, &cmd);
+
+	status = session_manager_set_session_aes_engines (&cmd.session.base, engines, 3);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 2; i++) {
+		session_manager_ecc_establish_session (test, &cmd, 0x10);
+
+		status = mock_expect (&aes[0].mock, aes[0].base.set_key, &aes[0], 0,
+			MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)), MOCK_ARG (sizeof (aes_key)));
+		status |= mock_expect (&aes[0].mock, aes[0].base.decrypt_data, &aes[0], 0,
+			MOCK_ARG_NOT_NULL, MOCK_ARG (40 - SESSION_MANAGER_TRAILER_LEN -
+				sizeof (struct cerberus_protocol_header)),
+			MOCK_ARG_PTR_CONTAINS (SESSION_AES_GCM_TAG, sizeof (SESSION_AES_GCM_TAG)),
+			MOCK_ARG_PTR_CONTAINS (SESSION_AES_IV, sizeof (SESSION_AES_IV)),
+			MOCK_ARG (sizeof (SESSION_AES_IV)), MOCK_ARG_NOT_NULL, MOCK_ARG_ANY);
+		CuAssertIntEquals (test, 0, status);
+
+		session_manager_ecc_testing_init_encrypted_request (&rq, rq_data);
+
+		status = cmd.session.base.decrypt_message (&cmd.session.base, &rq);
+		CuAssertIntEquals (test, 0, status);
+
+		status = mock_validate (&aes[0].mock);
+		CuAssertIntEquals (test, 0, status);
+
+		status = cmd.session.base.reset_session (&cmd.session.base, 0x10, NULL, 0);
+		CuAssertIntEquals (test, 0, status);
+
+		status = ecc_mock_validate_and_release (&cmd.ecc);
+		CuAssertIntEquals (test, 0, status);
+
+		status = ecc_mock_init (&cmd.ecc);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	for (i = 0; i < 3; i++) {
+		status = aes_mock_validate_and_release (&aes[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	release_session_manager_ecc_test (test, &cmd);
+}
+
+static void session_manager_ecc_test_decrypt_message_session_aes_engines_set_key_fail (
+	CuTest *test)
+{
+	struct session_manager_ecc_testing cmd;
+	struct aes_engine_mock aes[3];
+	struct aes_engine *engines[] = {&aes[0].base, &aes[1].base, &aes[2].base};
+	uint8_t rq_data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg rq;
+	uint8_t aes_key[] = {
+		0xf1,0x3b,0x43,0x16,0x2c,0xe4,0x05,0x75,0x73,0xc5,0x54,0x10,0xad,0xd5,0xc5,0xc6,
+		0x0e,0x9a,0x37,0xff,0x3e,0xa0,0x02,0x34,0xd6,0x41,0x80,0xfa,0x1a,0x0e,0x0a,0x04
+	};
+	int i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < 3; i++) {
+		status = aes_mock_init (&aes[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	setup_session_manager_ecc_test (test, &cmd);
+
+	status = session_manager_set_session_aes_engines (&cmd.session.base, engines, 3);
+	CuAssertIntEquals (test, 0, status);
+
+	session_manager_ecc_establish_session (test, &cmd, 0x10);
+
+	status = mock_expect (&aes[0].mock, aes[0].base.set_key, &aes[0], AES_ENGINE_NO_MEMORY,
+		MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)), MOCK_ARG (sizeof (aes_key)));
+
+	status |= mock_expect (&aes[0].mock, aes[0].base.set_key, &aes[0], 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)), MOCK_ARG (sizeof (aes_key)));
+	status |= mock_expect (&aes[0].mock, aes[0].base.decrypt_data, &aes[0], 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (40 - SESSION_MANAGER_TRAILER_LEN -
+			sizeof (struct cerberus_protocol_header)),
+		MOCK_ARG_PTR_CONTAINS (SESSION_AES_GCM_TAG, sizeof (SESSION_AES_GCM_TAG)),
+		MOCK_ARG_PTR_CONTAINS (SESSION_AES_IV, sizeof (SESSION_AES_IV)),
+		MOCK_ARG (sizeof (SESSION_AES_IV)), MOCK_ARG_NOT_NULL, MOCK_ARG_ANY);
+
+	CuAssertIntEquals (test, 0, status);
+
+	session_manager_ecc_testing_init_encrypted_request (&rq, rq_data);
+
+	status = cmd.session.base.decrypt_message (&cmd.session.base, &rq);
+	CuAssertIntEquals (test, AES_ENGINE_NO_MEMORY, status);
+
+	status = cmd.session.base.decrypt_message (&cmd.session.base, &rq);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 3; i++) {
+		status = aes_mock_validate_and_release (&aes[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	release_session_manager_ecc_test (test, &cmd);
+}
+
+static void session_manager_ecc_test_set_session_aes_engines_invalid_arg (CuTest *test)
+{
+	struct session_manager_ecc_testing cmd;
+	struct aes_engine_mock aes[3];
+	struct aes_engine *engines[] = {&aes[0].base, &aes[1].base, &aes[2].base};
+	struct aes_engine *null_engine[] = {&aes[0].base, NULL, &aes[2].base};
+	int status;
+
+	TEST_START;
+
+	setup_session_manager_ecc_test (test, &cmd);
+
+	status = session_manager_set_session_aes_engines (NULL, engines, 3);
+	CuAssertIntEquals (test, SESSION_MANAGER_INVALID_ARGUMENT, status);
+
+	status = session_manager_set_session_aes_engines (&cmd.session.base, engines, 2);
+	CuAssertIntEquals (test, SESSION_MANAGER_INVALID_ARGUMENT, status);
+
+	status = session_manager_set_session_aes_engines (&cmd.session.base, null_engine, 3);
+	CuAssertIntEquals (test, SESSION_MANAGER_INVALID_ARGUMENT, status);
+
+	status = session_manager_set_session_aes_engines (&cmd.session.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	release_session_manager_ecc_test (test, &cmd);
+}
+
 static void session_manager_ecc_test_encrypt_message (CuTest *test)
 {
 	struct session_manager_ecc_testing cmd;
@@ -4723,6 +5030,11 @@ TEST (session_manager_ecc_test_decrypt_message_fail);
 TEST (session_manager_ecc_test_decrypt_message_invalid_message);
 TEST (session_manager_ecc_test_decrypt_message_buf_too_small);
 TEST (session_manager_ecc_test_decrypt_message_invalid_arg);
+TEST (session_manager_ecc_test_decrypt_message_session_aes_engines);
+TEST (session_manager_ecc_test_encrypt_message_session_aes_engines);
+TEST (session_manager_ecc_test_decrypt_message_session_aes_engines_new_session);
+TEST (session_manager_ecc_test_decrypt_message_session_aes_engines_set_key_fail);
+TEST (session_manager_ecc_test_set_session_aes_engines_invalid_arg);
 TEST (session_manager_ecc_test_encrypt_message);
 TEST (session_manager_ecc_test_encrypt_message_unexpected_eid);
 TEST (session_manager_ecc_test_encrypt_message_session_not_established);
@@ -0,0 +1,386 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "common/arena.h"
+
+
+TEST_SUITE_LABEL ("arena");
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void arena_test_init (CuTest *test)
+{
+	struct arena arena;
+	uint8_t buffer[64];
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, buffer, arena.buffer);
+	CuAssertIntEquals (test, sizeof (buffer), arena.size);
+	CuAssertIntEquals (test, 0, arena.used);
+	CuAssertIntEquals (test, 0, arena.peak);
+	CuAssertIntEquals (test, sizeof (buffer), arena_get_remaining (&arena));
+}
+
+static void arena_test_init_null (CuTest *test)
+{
+	struct arena arena;
+	uint8_t buffer[64];
+	int status;
+
+	TEST_START;
+
+	status = arena_init (NULL, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, ARENA_INVALID_ARGUMENT, status);
+
+	status = arena_init (&arena, NULL, sizeof (buffer));
+	CuAssertIntEquals (test, ARENA_INVALID_ARGUMENT, status);
+
+	status = arena_init (&arena, buffer, 0);
+	CuAssertIntEquals (test, ARENA_INVALID_ARGUMENT, status);
+}
+
+static void arena_test_alloc (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem1;
+	uint8_t *mem2;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem1 = arena_alloc (&arena, 16);
+	CuAssertPtrEquals (test, buffer, mem1);
+	CuAssertIntEquals (test, 16, arena.used);
+
+	mem2 = arena_alloc (&arena, 8);
+	CuAssertPtrEquals (test, &mem1[16], mem2);
+	CuAssertIntEquals (test, 24, arena.used);
+	CuAssertIntEquals (test, 24, arena.peak);
+	CuAssertIntEquals (test, sizeof (buffer) - 24, arena_get_remaining (&arena));
+}
+
+static void arena_test_alloc_alignment (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem1;
+	uint8_t *mem2;
+	uint8_t *mem3;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem1 = arena_alloc (&arena, 3);
+	CuAssertPtrEquals (test, buffer, mem1);
+
+	mem2 = arena_alloc (&arena, 5);
+	CuAssertPtrEquals (test, &mem1[ARENA_ALIGNMENT], mem2);
+	CuAssertIntEquals (test, 0, ((uintptr_t) mem2) & (ARENA_ALIGNMENT - 1));
+
+	mem3 = arena_alloc (&arena, 1);
+	CuAssertPtrEquals (test, &mem2[ARENA_ALIGNMENT], mem3);
+	CuAssertIntEquals (test, (ARENA_ALIGNMENT * 2) + 1, arena.used);
+}
+
+static void arena_test_alloc_unaligned_buffer (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, &((uint8_t*) buffer)[1], sizeof (buffer) - 1);
+	CuAssertIntEquals (test, 0, status);
+
+	mem = arena_alloc (&arena, 4);
+	CuAssertPtrEquals (test, &buffer[1], mem);
+	CuAssertIntEquals (test, (ARENA_ALIGNMENT - 1) + 4, arena.used);
+}
+
+static void arena_test_alloc_zero_length (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem1;
+	uint8_t *mem2;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem1 = arena_alloc (&arena, 0);
+	CuAssertPtrNotNull (test, mem1);
+
+	mem2 = arena_alloc (&arena, 0);
+	CuAssertPtrNotNull (test, mem2);
+	CuAssertTrue (test, (mem1 != mem2));
+
+	CuAssertIntEquals (test, true, arena_contains (&arena, mem1));
+	CuAssertIntEquals (test, true, arena_contains (&arena, mem2));
+}
+
+static void arena_test_alloc_full (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem = arena_alloc (&arena, sizeof (buffer));
+	CuAssertPtrEquals (test, buffer, mem);
+	CuAssertIntEquals (test, 0, arena_get_remaining (&arena));
+
+	mem = arena_alloc (&arena, 1);
+	CuAssertPtrEquals (test, NULL, mem);
+	CuAssertIntEquals (test, sizeof (buffer), arena.used);
+}
+
+static void arena_test_alloc_too_large (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem = arena_alloc (&arena, sizeof (buffer) + 1);
+	CuAssertPtrEquals (test, NULL, mem);
+	CuAssertIntEquals (test, 0, arena.used);
+
+	mem = arena_alloc (&arena, SIZE_MAX);
+	CuAssertPtrEquals (test, NULL, mem);
+	CuAssertIntEquals (test, 0, arena.used);
+}
+
+static void arena_test_alloc_no_space_for_padding (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[2];
+	uint8_t *mem;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, ARENA_ALIGNMENT + 2);
+	CuAssertIntEquals (test, 0, status);
+
+	mem = arena_alloc (&arena, 1);
+	CuAssertPtrEquals (test, buffer, mem);
+
+	mem = arena_alloc (&arena, 4);
+	CuAssertPtrEquals (test, NULL, mem);
+	CuAssertIntEquals (test, 1, arena.used);
+
+	mem = arena_alloc (&arena, 2);
+	CuAssertPtrEquals (test, &buffer[1], mem);
+	CuAssertIntEquals (test, 0, arena_get_remaining (&arena));
+}
+
+static void arena_test_alloc_null (CuTest *test)
+{
+	uint8_t *mem;
+
+	TEST_START;
+
+	mem = arena_alloc (NULL, 8);
+	CuAssertPtrEquals (test, NULL, mem);
+}
+
+static void arena_test_calloc (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t zero[16] = {0};
+	uint8_t *mem;
+	int status;
+
+	TEST_START;
+
+	memset (buffer, 0x55, sizeof (buffer));
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem = arena_calloc (&arena, 4, 4);
+	CuAssertPtrEquals (test, buffer, mem);
+	CuAssertIntEquals (test, 16, arena.used);
+
+	status = testing_validate_array (zero, mem, sizeof (zero));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0x55, mem[16]);
+}
+
+static void arena_test_calloc_overflow (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem = arena_calloc (&arena, (SIZE_MAX / 2) + 1, 2);
+	CuAssertPtrEquals (test, NULL, mem);
+	CuAssertIntEquals (test, 0, arena.used);
+}
+
+static void arena_test_calloc_no_space (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem = arena_calloc (&arena, 9, sizeof (uint64_t));
+	CuAssertPtrEquals (test, NULL, mem);
+	CuAssertIntEquals (test, 0, arena.used);
+}
+
+static void arena_test_calloc_null (CuTest *test)
+{
+	uint8_t *mem;
+
+	TEST_START;
+
+	mem = arena_calloc (NULL, 2, 4);
+	CuAssertPtrEquals (test, NULL, mem);
+}
+
+static void arena_test_reset (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem = arena_alloc (&arena, 48);
+	CuAssertPtrEquals (test, buffer, mem);
+
+	arena_reset (&arena);
+	CuAssertIntEquals (test, 0, arena.used);
+	CuAssertIntEquals (test, 48, arena.peak);
+	CuAssertIntEquals (test, sizeof (buffer), arena_get_remaining (&arena));
+
+	mem = arena_alloc (&arena, 16);
+	CuAssertPtrEquals (test, buffer, mem);
+	CuAssertIntEquals (test, 48, arena.peak);
+}
+
+static void arena_test_reset_null (CuTest *test)
+{
+	TEST_START;
+
+	arena_reset (NULL);
+}
+
+static void arena_test_contains (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	uint64_t other;
+	uint8_t *bytes = (uint8_t*) buffer;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, true, arena_contains (&arena, buffer));
+	CuAssertIntEquals (test, true, arena_contains (&arena, &bytes[sizeof (buffer) - 1]));
+	CuAssertIntEquals (test, false, arena_contains (&arena, &bytes[sizeof (buffer)]));
+	CuAssertIntEquals (test, false, arena_contains (&arena, &other));
+}
+
+static void arena_test_contains_null (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, false, arena_contains (NULL, buffer));
+	CuAssertIntEquals (test, false, arena_contains (&arena, NULL));
+}
+
+static void arena_test_get_remaining_null (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, arena_get_remaining (NULL));
+}
+
+
+TEST_SUITE_START (arena);
+
+TEST (arena_test_init);
+TEST (arena_test_init_null);
+TEST (arena_test_alloc);
+TEST (arena_test_alloc_alignment);
+TEST (arena_test_alloc_unaligned_buffer);
+TEST (arena_test_alloc_zero_length);
+TEST (arena_test_alloc_full);
+TEST (arena_test_alloc_too_large);
+TEST (arena_test_alloc_no_space_for_padding);
+TEST (arena_test_alloc_null);
+TEST (arena_test_calloc);
+TEST (arena_test_calloc_overflow);
+TEST (arena_test_calloc_no_space);
+TEST (arena_test_calloc_null);
+TEST (arena_test_reset);
+TEST (arena_test_reset_null);
+TEST (arena_test_contains);
+TEST (arena_test_contains_null);
+TEST (arena_test_get_remaining_null);
+
+TEST_SUITE_END;
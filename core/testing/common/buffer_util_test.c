@@ -1005,6 +1005,308 @@ static void buffer_compare_dwords_test_one_null_non_zero_length (CuTest *test)
 	CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
 }
 
+static void buffer_check_value_test_match (CuTest *test)
+{
+	uint8_t buffer[300];
+	int status;
+
+	TEST_START;
+
+	memset (buffer, 0xff, sizeof (buffer));
+
+	status = buffer_check_value (buffer, sizeof (buffer), 0xff);
+	CuAssertIntEquals (test, 0, status);
+
+	memset (buffer, 0x00, sizeof (buffer));
+
+	status = buffer_check_value (buffer, sizeof (buffer), 0x00);
+	CuAssertIntEquals (test, 0, status);
+
+	memset (buffer, 0x5a, sizeof (buffer));
+
+	status = buffer_check_value (buffer, sizeof (buffer), 0x5a);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void buffer_check_value_test_match_all_lengths_and_offsets (CuTest *test)
+{
+	uint8_t buffer[160];
+	size_t offset;
+	size_t length;
+	int status;
+
+	TEST_START;
+
+	memset (buffer, 0xa5, sizeof (buffer));
+
+	for (offset = 0; offset < 16; offset++) {
+		for (length = 0; length <= (sizeof (buffer) - offset); length++) {
+			status = buffer_check_value (&buffer[offset], length, 0xa5);
+			CuAssertIntEquals (test, 0, status);
+		}
+	}
+}
+
+static void buffer_check_value_test_no_match (CuTest *test)
+{
+	uint8_t buffer[300];
+	int status;
+
+	TEST_START;
+
+	memset (buffer, 0xff, sizeof (buffer));
+
+	status = buffer_check_value (buffer, sizeof (buffer), 0x00);
+	CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
+}
+
+static void buffer_check_value_test_no_match_each_byte (CuTest *test)
+{
+	uint8_t buffer[160];
+	size_t offset;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	memset (buffer, 0xff, sizeof (buffer));
+
+	for (offset = 0; offset < 16; offset++) {
+		for (i = offset; i < sizeof (buffer); i++) {
+			buffer[i] = 0xfe;
+
+			status = buffer_check_value (&buffer[offset], sizeof (buffer) - offset, 0xff);
+			CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
+
+			buffer[i] = 0xff;
+		}
+	}
+}
+
+static void buffer_check_value_test_no_match_outside_length (CuTest *test)
+{
+	uint8_t buffer[160];
+	int status;
+
+	TEST_START;
+
+	memset (buffer, 0xff, sizeof (buffer));
+	buffer[0] = 0;
+	buffer[sizeof (buffer) - 1] = 0;
+
+	status = buffer_check_value (&buffer[1], sizeof (buffer) - 2, 0xff);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void buffer_check_value_test_zero_length (CuTest *test)
+{
+	uint8_t buffer[32];
+	int status;
+
+	TEST_START;
+
+	memset (buffer, 0x00, sizeof (buffer));
+
+	status = buffer_check_value (buffer, 0, 0xff);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void buffer_check_value_test_null_zero_length (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = buffer_check_value (NULL, 0, 0xff);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void buffer_check_value_test_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = buffer_check_value (NULL, 32, 0xff);
+	CuAssertIntEquals (test, BUFFER_UTIL_INVALID_ARGUMENT, status);
+}
+
+static void buffer_compare_fast_test_match (CuTest *test)
+{
+	uint8_t buf1[300];
+	uint8_t buf2[300];
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (buf1); i++) {
+		buf1[i] = i;
+		buf2[i] = i;
+	}
+
+	status = buffer_compare_fast (buf1, buf2, sizeof (buf1));
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void buffer_compare_fast_test_match_all_lengths_and_offsets (CuTest *test)
+{
+	uint8_t buf1[160];
+	uint8_t buf2[176];
+	size_t offset;
+	size_t length;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (buf1); i++) {
+		buf1[i] = i;
+	}
+
+	/* Offset only the second buffer to check comparisons between buffers of different alignment. */
+	for (offset = 0; offset < 16; offset++) {
+		memcpy (&buf2[offset], buf1, sizeof (buf1));
+
+		for (length = 0; length <= sizeof (buf1); length++) {
+			status = buffer_compare_fast (buf1, &buf2[offset], length);
+			CuAssertIntEquals (test, 0, status);
+		}
+	}
+}
+
+static void buffer_compare_fast_test_match_first_buffer_offset (CuTest *test)
+{
+	uint8_t buf1[176];
+	uint8_t buf2[160];
+	size_t offset;
+	size_t length;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (buf2); i++) {
+		buf2[i] = i;
+	}
+
+	/* Offset the first buffer to check the bytes compared before it is aligned for word loads. */
+	for (offset = 0; offset < 16; offset++) {
+		memcpy (&buf1[offset], buf2, sizeof (buf2));
+
+		for (length = 0; length <= sizeof (buf2); length++) {
+			status = buffer_compare_fast (&buf1[offset], buf2, length);
+			CuAssertIntEquals (test, 0, status);
+
+			if (length != 0) {
+				buf1[offset + length - 1] ^= 0x01;
+
+				status = buffer_compare_fast (&buf1[offset], buf2, length);
+				CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
+
+				buf1[offset + length - 1] ^= 0x01;
+			}
+		}
+	}
+}
+
+static void buffer_compare_fast_test_no_match (CuTest *test)
+{
+	uint8_t buf1[300];
+	uint8_t buf2[300];
+	int status;
+
+	TEST_START;
+
+	memset (buf1, 0x55, sizeof (buf1));
+	memset (buf2, 0xaa, sizeof (buf2));
+
+	status = buffer_compare_fast (buf1, buf2, sizeof (buf1));
+	CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
+}
+
+static void buffer_compare_fast_test_no_match_each_byte (CuTest *test)
+{
+	uint8_t buf1[160];
+	uint8_t buf2[176];
+	size_t offset;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (buf1); i++) {
+		buf1[i] = i;
+	}
+
+	for (offset = 0; offset < 16; offset++) {
+		memcpy (&buf2[offset], buf1, sizeof (buf1));
+
+		for (i = 0; i < sizeof (buf1); i++) {
+			buf2[offset + i] ^= 0x01;
+
+			status = buffer_compare_fast (buf1, &buf2[offset], sizeof (buf1));
+			CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
+
+			buf2[offset + i] ^= 0x01;
+		}
+	}
+}
+
+static void buffer_compare_fast_test_zero_length (CuTest *test)
+{
+	uint8_t buf1[32];
+	uint8_t buf2[32];
+	int status;
+
+	TEST_START;
+
+	memset (buf1, 0x55, sizeof (buf1));
+	memset (buf2, 0xaa, sizeof (buf2));
+
+	status = buffer_compare_fast (buf1, buf2, 0);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void buffer_compare_fast_test_match_both_null_zero_length (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = buffer_compare_fast (NULL, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void buffer_compare_fast_test_match_both_null_non_zero_length (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = buffer_compare_fast (NULL, NULL, 32);
+	CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
+}
+
+static void buffer_compare_fast_test_one_null (CuTest *test)
+{
+	uint8_t buf1[32];
+	int status;
+
+	TEST_START;
+
+	memset (buf1, 0x55, sizeof (buf1));
+
+	status = buffer_compare_fast (buf1, NULL, sizeof (buf1));
+	CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
+
+	status = buffer_compare_fast (NULL, buf1, sizeof (buf1));
+	CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
+
+	status = buffer_compare_fast (buf1, NULL, 0);
+	CuAssertIntEquals (test, BUFFER_UTIL_DATA_MISMATCH, status);
+}
+
 
 TEST_SUITE_START (buffer_util);
 
@@ -1057,5 +1359,22 @@ TEST (buffer_compare_dwords_test_match_both_null_zero_length);
 TEST (buffer_compare_dwords_test_match_both_null_non_zero_length);
 TEST (buffer_compare_dwords_test_one_null_zero_length);
 TEST (buffer_compare_dwords_test_one_null_non_zero_length);
+TEST (buffer_check_value_test_match);
+TEST (buffer_check_value_test_match_all_lengths_and_offsets);
+TEST (buffer_check_value_test_no_match);
+TEST (buffer_check_value_test_no_match_each_byte);
+TEST (buffer_check_value_test_no_match_outside_length);
+TEST (buffer_check_value_test_zero_length);
+TEST (buffer_check_value_test_null_zero_length);
+TEST (buffer_check_value_test_null);
+TEST (buffer_compare_fast_test_match);
+TEST (buffer_compare_fast_test_match_all_lengths_and_offsets);
+TEST (buffer_compare_fast_test_match_first_buffer_offset);
+TEST (buffer_compare_fast_test_no_match);
+TEST (buffer_compare_fast_test_no_match_each_byte);
+TEST (buffer_compare_fast_test_zero_length);
+TEST (buffer_compare_fast_test_match_both_null_zero_length);
+TEST (buffer_compare_fast_test_match_both_null_non_zero_length);
+TEST (buffer_compare_fast_test_one_null);
 
 TEST_SUITE_END;
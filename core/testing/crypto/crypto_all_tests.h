@@ -57,6 +57,12 @@ static void add_all_crypto_tests (CuSuite *suite)
 	!defined TESTING_SKIP_ECC_MBEDTLS_SUITE
 	TESTING_RUN_SUITE (ecc_mbedtls);
 #endif
+#if (defined TESTING_RUN_ECC_NONCE_POOL_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_ECC_NONCE_POOL_SUITE
+	TESTING_RUN_SUITE (ecc_nonce_pool);
+#endif
 #if (defined TESTING_RUN_ECC_THREAD_SAFE_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
@@ -75,6 +81,12 @@ static void add_all_crypto_tests (CuSuite *suite)
 	!defined TESTING_SKIP_HASH_MBEDTLS_SUITE
 	TESTING_RUN_SUITE (hash_mbedtls);
 #endif
+#if (defined TESTING_RUN_HASH_POOL_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_HASH_POOL_SUITE
+	TESTING_RUN_SUITE (hash_pool);
+#endif
 #if (defined TESTING_RUN_HASH_THREAD_SAFE_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
@@ -0,0 +1,534 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "platform.h"
+#include "crypto/ecc_nonce_pool.h"
+#include "testing/mock/crypto/ecc_mock.h"
+#include "testing/crypto/signature_testing.h"
+
+
+TEST_SUITE_LABEL ("ecc_nonce_pool");
+
+
+/**
+ * Number of nonces kept by the pool under test.
+ */
+#define	ECC_NONCE_POOL_TESTING_CAPACITY		2
+
+/**
+ * Dependencies for testing a nonce pool.
+ */
+struct ecc_nonce_pool_testing {
+	struct ecc_engine_mock ecc;				/**< Mock ECC engine for the pool. */
+	struct ecc_private_key key;				/**< The signing key for the pool. */
+	struct ecc_ecdsa_nonce nonce[ECC_NONCE_POOL_TESTING_CAPACITY];	/**< Nonces generated by the mock. */
+	struct ecc_nonce_pool test;				/**< The pool under test. */
+};
+
+
+/**
+ * Initialize the dependencies and the nonce pool for testing.
+ *
+ * @param test The test framework.
+ * @param pool Testing components to initialize.
+ */
+static void ecc_nonce_pool_testing_init (CuTest *test, struct ecc_nonce_pool_testing *pool)
+{
+	size_t i;
+	int status;
+
+	status = ecc_mock_init (&pool->ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < ECC_NONCE_POOL_TESTING_CAPACITY; i++) {
+		memset (pool->nonce[i].k, 0x10 + i, sizeof (pool->nonce[i].k));
+		memset (pool->nonce[i].r, 0x20 + i, sizeof (pool->nonce[i].r));
+		pool->nonce[i].length = ECC_KEY_LENGTH_256;
+	}
+
+	status = ecc_nonce_pool_init (&pool->test, &pool->ecc.base, &pool->key,
+		ECC_NONCE_POOL_TESTING_CAPACITY);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Fill the pool under test with nonces.
+ *
+ * @param test The test framework.
+ * @param pool Testing components to use.
+ */
+static void ecc_nonce_pool_testing_fill (CuTest *test, struct ecc_nonce_pool_testing *pool)
+{
+	size_t i;
+	int status = 0;
+
+	for (i = 0; i < ECC_NONCE_POOL_TESTING_CAPACITY; i++) {
+		status |= mock_expect (&pool->ecc.mock, pool->ecc.base.generate_ecdsa_nonce, &pool->ecc, 0,
+			MOCK_ARG (&pool->key), MOCK_ARG_NOT_NULL);
+		status |= mock_expect_output (&pool->ecc.mock, 1, &pool->nonce[i],
+			sizeof (struct ecc_ecdsa_nonce), -1);
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_refill (&pool->test);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TESTING_CAPACITY, status);
+}
+
+/**
+ * Release the test components and validate all mocks.
+ *
+ * @param test The test framework.
+ * @param pool Testing components to release.
+ */
+static void ecc_nonce_pool_testing_release (CuTest *test, struct ecc_nonce_pool_testing *pool)
+{
+	int status;
+
+	status = ecc_mock_validate_and_release (&pool->ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	ecc_nonce_pool_release (&pool->test);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void ecc_nonce_pool_test_init (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	struct ecc_nonce_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+
+	status = ecc_nonce_pool_get_available (&pool.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.generated);
+	CuAssertIntEquals (test, 0, stats.used);
+	CuAssertIntEquals (test, 0, stats.empty);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+static void ecc_nonce_pool_test_init_max_capacity (CuTest *test)
+{
+	struct ecc_engine_mock ecc;
+	struct ecc_private_key key;
+	struct ecc_nonce_pool pool;
+	int status;
+
+	TEST_START;
+
+	status = ecc_mock_init (&ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_init (&pool, &ecc.base, &key, ECC_NONCE_POOL_MAX_NONCES);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_mock_validate_and_release (&ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	ecc_nonce_pool_release (&pool);
+}
+
+static void ecc_nonce_pool_test_init_null (CuTest *test)
+{
+	struct ecc_engine_mock ecc;
+	struct ecc_private_key key;
+	struct ecc_nonce_pool pool;
+	int status;
+
+	TEST_START;
+
+	status = ecc_mock_init (&ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_init (NULL, &ecc.base, &key, 1);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_INVALID_ARGUMENT, status);
+
+	status = ecc_nonce_pool_init (&pool, NULL, &key, 1);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_INVALID_ARGUMENT, status);
+
+	status = ecc_nonce_pool_init (&pool, &ecc.base, NULL, 1);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_INVALID_ARGUMENT, status);
+
+	status = ecc_nonce_pool_init (&pool, &ecc.base, &key, 0);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_INVALID_ARGUMENT, status);
+
+	status = ecc_mock_validate_and_release (&ecc);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void ecc_nonce_pool_test_init_too_many_nonces (CuTest *test)
+{
+	struct ecc_engine_mock ecc;
+	struct ecc_private_key key;
+	struct ecc_nonce_pool pool;
+	int status;
+
+	TEST_START;
+
+	status = ecc_mock_init (&ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_init (&pool, &ecc.base, &key, ECC_NONCE_POOL_MAX_NONCES + 1);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TOO_MANY_NONCES, status);
+
+	status = ecc_mock_validate_and_release (&ecc);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void ecc_nonce_pool_test_init_unsupported_engine (CuTest *test)
+{
+	struct ecc_engine_mock ecc;
+	struct ecc_private_key key;
+	struct ecc_nonce_pool pool;
+	int (*generate) (struct ecc_engine*, struct ecc_private_key*, struct ecc_ecdsa_nonce*);
+	int status;
+
+	TEST_START;
+
+	status = ecc_mock_init (&ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	generate = ecc.base.generate_ecdsa_nonce;
+	ecc.base.generate_ecdsa_nonce = NULL;
+
+	status = ecc_nonce_pool_init (&pool, &ecc.base, &key, 1);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_UNSUPPORTED_ENGINE, status);
+
+	ecc.base.generate_ecdsa_nonce = generate;
+	ecc.base.sign_with_nonce = NULL;
+
+	status = ecc_nonce_pool_init (&pool, &ecc.base, &key, 1);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_UNSUPPORTED_ENGINE, status);
+
+	status = ecc_mock_validate_and_release (&ecc);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void ecc_nonce_pool_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	ecc_nonce_pool_release (NULL);
+}
+
+static void ecc_nonce_pool_test_refill (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	struct ecc_nonce_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+	ecc_nonce_pool_testing_fill (test, &pool);
+
+	status = ecc_nonce_pool_get_available (&pool.test);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TESTING_CAPACITY, status);
+
+	status = ecc_nonce_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TESTING_CAPACITY, stats.generated);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+static void ecc_nonce_pool_test_refill_full (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	int status;
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+	ecc_nonce_pool_testing_fill (test, &pool);
+
+	status = ecc_nonce_pool_refill (&pool.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_get_available (&pool.test);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TESTING_CAPACITY, status);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+static void ecc_nonce_pool_test_refill_after_sign (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	int status;
+	uint8_t out[72];
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+	ecc_nonce_pool_testing_fill (test, &pool);
+
+	status = mock_expect (&pool.ecc.mock, pool.ecc.base.sign_with_nonce, &pool.ecc, 72,
+		MOCK_ARG (&pool.key), MOCK_ARG_NOT_NULL, MOCK_ARG (SIG_HASH_TEST), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG (out), MOCK_ARG (sizeof (out)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_sign (&pool.test, SIG_HASH_TEST, SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, 72, status);
+
+	status = ecc_nonce_pool_get_available (&pool.test);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TESTING_CAPACITY - 1, status);
+
+	status = mock_expect (&pool.ecc.mock, pool.ecc.base.generate_ecdsa_nonce, &pool.ecc, 0,
+		MOCK_ARG (&pool.key), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&pool.ecc.mock, 1, &pool.nonce[0],
+		sizeof (struct ecc_ecdsa_nonce), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_refill (&pool.test);
+	CuAssertIntEquals (test, 1, status);
+
+	status = ecc_nonce_pool_get_available (&pool.test);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TESTING_CAPACITY, status);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+static void ecc_nonce_pool_test_refill_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = ecc_nonce_pool_refill (NULL);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_INVALID_ARGUMENT, status);
+}
+
+static void ecc_nonce_pool_test_refill_generate_error (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	int status;
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+
+	status = mock_expect (&pool.ecc.mock, pool.ecc.base.generate_ecdsa_nonce, &pool.ecc, 0,
+		MOCK_ARG (&pool.key), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&pool.ecc.mock, 1, &pool.nonce[0],
+		sizeof (struct ecc_ecdsa_nonce), -1);
+
+	status |= mock_expect (&pool.ecc.mock, pool.ecc.base.generate_ecdsa_nonce, &pool.ecc,
+		ECC_ENGINE_NONCE_FAILED, MOCK_ARG (&pool.key), MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_refill (&pool.test);
+	CuAssertIntEquals (test, ECC_ENGINE_NONCE_FAILED, status);
+
+	/* Nonces generated before the failure remain available. */
+	status = ecc_nonce_pool_get_available (&pool.test);
+	CuAssertIntEquals (test, 1, status);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+static void ecc_nonce_pool_test_get_available_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = ecc_nonce_pool_get_available (NULL);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_INVALID_ARGUMENT, status);
+}
+
+static void ecc_nonce_pool_test_sign (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	struct ecc_nonce_pool_stats stats;
+	int status;
+	uint8_t out[72];
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+	ecc_nonce_pool_testing_fill (test, &pool);
+
+	/* The most recently generated nonce is used first. */
+	status = mock_expect (&pool.ecc.mock, pool.ecc.base.sign_with_nonce, &pool.ecc, 72,
+		MOCK_ARG (&pool.key),
+		MOCK_ARG_PTR_CONTAINS (&pool.nonce[1], sizeof (struct ecc_ecdsa_nonce)),
+		MOCK_ARG (SIG_HASH_TEST), MOCK_ARG (SIG_HASH_LEN), MOCK_ARG (out), MOCK_ARG (sizeof (out)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_sign (&pool.test, SIG_HASH_TEST, SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, 72, status);
+
+	status = ecc_nonce_pool_get_available (&pool.test);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TESTING_CAPACITY - 1, status);
+
+	status = ecc_nonce_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.used);
+	CuAssertIntEquals (test, 0, stats.empty);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+static void ecc_nonce_pool_test_sign_single_use (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	struct ecc_nonce_pool_stats stats;
+	int status;
+	uint8_t out[72];
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+	ecc_nonce_pool_testing_fill (test, &pool);
+
+	status = mock_expect (&pool.ecc.mock, pool.ecc.base.sign_with_nonce, &pool.ecc, 72,
+		MOCK_ARG (&pool.key),
+		MOCK_ARG_PTR_CONTAINS (&pool.nonce[1], sizeof (struct ecc_ecdsa_nonce)),
+		MOCK_ARG (SIG_HASH_TEST), MOCK_ARG (SIG_HASH_LEN), MOCK_ARG (out), MOCK_ARG (sizeof (out)));
+	status |= mock_expect (&pool.ecc.mock, pool.ecc.base.sign_with_nonce, &pool.ecc, 71,
+		MOCK_ARG (&pool.key),
+		MOCK_ARG_PTR_CONTAINS (&pool.nonce[0], sizeof (struct ecc_ecdsa_nonce)),
+		MOCK_ARG (SIG_HASH_TEST), MOCK_ARG (SIG_HASH_LEN), MOCK_ARG (out), MOCK_ARG (sizeof (out)));
+	status |= mock_expect (&pool.ecc.mock, pool.ecc.base.sign, &pool.ecc, 70, MOCK_ARG (&pool.key),
+		MOCK_ARG (SIG_HASH_TEST), MOCK_ARG (SIG_HASH_LEN), MOCK_ARG (out), MOCK_ARG (sizeof (out)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_sign (&pool.test, SIG_HASH_TEST, SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, 72, status);
+
+	status = ecc_nonce_pool_sign (&pool.test, SIG_HASH_TEST, SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, 71, status);
+
+	status = ecc_nonce_pool_sign (&pool.test, SIG_HASH_TEST, SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, 70, status);
+
+	status = ecc_nonce_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.used);
+	CuAssertIntEquals (test, 1, stats.empty);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+static void ecc_nonce_pool_test_sign_empty (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	struct ecc_nonce_pool_stats stats;
+	int status;
+	uint8_t out[72];
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+
+	status = mock_expect (&pool.ecc.mock, pool.ecc.base.sign, &pool.ecc, 72, MOCK_ARG (&pool.key),
+		MOCK_ARG (SIG_HASH_TEST), MOCK_ARG (SIG_HASH_LEN), MOCK_ARG (out), MOCK_ARG (sizeof (out)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_sign (&pool.test, SIG_HASH_TEST, SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, 72, status);
+
+	status = ecc_nonce_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.used);
+	CuAssertIntEquals (test, 1, stats.empty);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+static void ecc_nonce_pool_test_sign_null (CuTest *test)
+{
+	int status;
+	uint8_t out[72];
+
+	TEST_START;
+
+	status = ecc_nonce_pool_sign (NULL, SIG_HASH_TEST, SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, ECC_NONCE_POOL_INVALID_ARGUMENT, status);
+}
+
+static void ecc_nonce_pool_test_sign_error (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	int status;
+	uint8_t out[72];
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+	ecc_nonce_pool_testing_fill (test, &pool);
+
+	status = mock_expect (&pool.ecc.mock, pool.ecc.base.sign_with_nonce, &pool.ecc,
+		ECC_ENGINE_SIGN_FAILED, MOCK_ARG (&pool.key), MOCK_ARG_NOT_NULL, MOCK_ARG (SIG_HASH_TEST),
+		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG (out), MOCK_ARG (sizeof (out)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_nonce_pool_sign (&pool.test, SIG_HASH_TEST, SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_SIGN_FAILED, status);
+
+	/* The nonce is consumed even when signing fails. */
+	status = ecc_nonce_pool_get_available (&pool.test);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_TESTING_CAPACITY - 1, status);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+static void ecc_nonce_pool_test_get_stats_null (CuTest *test)
+{
+	struct ecc_nonce_pool_testing pool;
+	struct ecc_nonce_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	ecc_nonce_pool_testing_init (test, &pool);
+
+	status = ecc_nonce_pool_get_stats (NULL, &stats);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_INVALID_ARGUMENT, status);
+
+	status = ecc_nonce_pool_get_stats (&pool.test, NULL);
+	CuAssertIntEquals (test, ECC_NONCE_POOL_INVALID_ARGUMENT, status);
+
+	ecc_nonce_pool_testing_release (test, &pool);
+}
+
+
+TEST_SUITE_START (ecc_nonce_pool);
+
+TEST (ecc_nonce_pool_test_init);
+TEST (ecc_nonce_pool_test_init_max_capacity);
+TEST (ecc_nonce_pool_test_init_null);
+TEST (ecc_nonce_pool_test_init_too_many_nonces);
+TEST (ecc_nonce_pool_test_init_unsupported_engine);
+TEST (ecc_nonce_pool_test_release_null);
+TEST (ecc_nonce_pool_test_refill);
+TEST (ecc_nonce_pool_test_refill_full);
+TEST (ecc_nonce_pool_test_refill_after_sign);
+TEST (ecc_nonce_pool_test_refill_null);
+TEST (ecc_nonce_pool_test_refill_generate_error);
+TEST (ecc_nonce_pool_test_get_available_null);
+TEST (ecc_nonce_pool_test_sign);
+TEST (ecc_nonce_pool_test_sign_single_use);
+TEST (ecc_nonce_pool_test_sign_empty);
+TEST (ecc_nonce_pool_test_sign_null);
+TEST (ecc_nonce_pool_test_sign_error);
+TEST (ecc_nonce_pool_test_get_stats_null);
+
+TEST_SUITE_END;
@@ -42,6 +42,8 @@ static void ecc_thread_safe_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, engine.base.get_private_key_der);
 	CuAssertPtrNotNull (test, engine.base.get_public_key_der);
 	CuAssertPtrNotNull (test, engine.base.sign);
+	CuAssertPtrNotNull (test, engine.base.generate_ecdsa_nonce);
+	CuAssertPtrNotNull (test, engine.base.sign_with_nonce);
 	CuAssertPtrNotNull (test, engine.base.verify);
 	CuAssertPtrNotNull (test, engine.base.get_shared_secret_max_length);
 	CuAssertPtrNotNull (test, engine.base.compute_shared_secret);
@@ -52,6 +54,33 @@ static void ecc_thread_safe_test_init (CuTest *test)
 	ecc_thread_safe_release (&engine);
 }
 
+static void ecc_thread_safe_test_init_no_nonce_support (CuTest *test)
+{
+	struct ecc_engine_thread_safe engine;
+	struct ecc_engine_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = ecc_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	mock.base.generate_ecdsa_nonce = NULL;
+	mock.base.sign_with_nonce = NULL;
+
+	status = ecc_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, engine.base.sign);
+	CuAssertPtrEquals (test, NULL, engine.base.generate_ecdsa_nonce);
+	CuAssertPtrEquals (test, NULL, engine.base.sign_with_nonce);
+
+	status = ecc_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	ecc_thread_safe_release (&engine);
+}
+
 static void ecc_thread_safe_test_init_null (CuTest *test)
 {
 	struct ecc_engine_thread_safe engine;
@@ -954,6 +983,216 @@ static void ecc_thread_safe_test_sign_null (CuTest *test)
 	ecc_thread_safe_release (&engine);
 }
 
+static void ecc_thread_safe_test_generate_ecdsa_nonce (CuTest *test)
+{
+	struct ecc_engine_thread_safe engine;
+	struct ecc_engine_mock mock;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+
+	TEST_START;
+
+	status = ecc_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.generate_ecdsa_nonce, &mock, 0,
+		MOCK_ARG (&priv_key), MOCK_ARG (&nonce));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.init_key_pair (&engine.base, (const uint8_t*) ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		NULL, &pub_key);
+
+	ecc_mock_release (&mock);
+	ecc_thread_safe_release (&engine);
+}
+
+static void ecc_thread_safe_test_generate_ecdsa_nonce_error (CuTest *test)
+{
+	struct ecc_engine_thread_safe engine;
+	struct ecc_engine_mock mock;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+
+	TEST_START;
+
+	status = ecc_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.generate_ecdsa_nonce, &mock,
+		ECC_ENGINE_NONCE_FAILED, MOCK_ARG (&priv_key), MOCK_ARG (&nonce));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, ECC_ENGINE_NONCE_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.init_key_pair (&engine.base, (const uint8_t*) ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		NULL, &pub_key);
+
+	ecc_mock_release (&mock);
+	ecc_thread_safe_release (&engine);
+}
+
+static void ecc_thread_safe_test_generate_ecdsa_nonce_null (CuTest *test)
+{
+	struct ecc_engine_thread_safe engine;
+	struct ecc_engine_mock mock;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+
+	TEST_START;
+
+	status = ecc_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (NULL, &priv_key, &nonce);
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.init_key_pair (&engine.base, (const uint8_t*) ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		NULL, &pub_key);
+
+	ecc_mock_release (&mock);
+	ecc_thread_safe_release (&engine);
+}
+
+static void ecc_thread_safe_test_sign_with_nonce (CuTest *test)
+{
+	struct ecc_engine_thread_safe engine;
+	struct ecc_engine_mock mock;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+	uint8_t out[72];
+
+	TEST_START;
+
+	status = ecc_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.sign_with_nonce, &mock, 72, MOCK_ARG (&priv_key),
+		MOCK_ARG (&nonce), MOCK_ARG (SIG_HASH_TEST), MOCK_ARG (SIG_HASH_LEN), MOCK_ARG (out),
+		MOCK_ARG (sizeof (out)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, 72, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.init_key_pair (&engine.base, (const uint8_t*) ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		NULL, &pub_key);
+
+	ecc_mock_release (&mock);
+	ecc_thread_safe_release (&engine);
+}
+
+static void ecc_thread_safe_test_sign_with_nonce_error (CuTest *test)
+{
+	struct ecc_engine_thread_safe engine;
+	struct ecc_engine_mock mock;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+	uint8_t out[72];
+
+	TEST_START;
+
+	status = ecc_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.sign_with_nonce, &mock, ECC_ENGINE_SIGN_FAILED,
+		MOCK_ARG (&priv_key), MOCK_ARG (&nonce), MOCK_ARG (SIG_HASH_TEST), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG (out), MOCK_ARG (sizeof (out)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_SIGN_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.init_key_pair (&engine.base, (const uint8_t*) ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		NULL, &pub_key);
+
+	ecc_mock_release (&mock);
+	ecc_thread_safe_release (&engine);
+}
+
+static void ecc_thread_safe_test_sign_with_nonce_null (CuTest *test)
+{
+	struct ecc_engine_thread_safe engine;
+	struct ecc_engine_mock mock;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+	uint8_t out[72];
+
+	TEST_START;
+
+	status = ecc_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (NULL, &priv_key, &nonce, SIG_HASH_TEST, SIG_HASH_LEN,
+		out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.init_key_pair (&engine.base, (const uint8_t*) ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		NULL, &pub_key);
+
+	ecc_mock_release (&mock);
+	ecc_thread_safe_release (&engine);
+}
+
 static void ecc_thread_safe_test_verify (CuTest *test)
 {
 	struct ecc_engine_thread_safe engine;
@@ -1261,6 +1500,7 @@ static void ecc_thread_safe_test_compute_shared_secret_null (CuTest *test)
 TEST_SUITE_START (ecc_thread_safe);
 
 TEST (ecc_thread_safe_test_init);
+TEST (ecc_thread_safe_test_init_no_nonce_support);
 TEST (ecc_thread_safe_test_init_null);
 TEST (ecc_thread_safe_test_release_null);
 TEST (ecc_thread_safe_test_init_key_pair);
@@ -1289,6 +1529,12 @@ TEST (ecc_thread_safe_test_get_public_key_der_null);
 TEST (ecc_thread_safe_test_sign);
 TEST (ecc_thread_safe_test_sign_error);
 TEST (ecc_thread_safe_test_sign_null);
+TEST (ecc_thread_safe_test_generate_ecdsa_nonce);
+TEST (ecc_thread_safe_test_generate_ecdsa_nonce_error);
+TEST (ecc_thread_safe_test_generate_ecdsa_nonce_null);
+TEST (ecc_thread_safe_test_sign_with_nonce);
+TEST (ecc_thread_safe_test_sign_with_nonce_error);
+TEST (ecc_thread_safe_test_sign_with_nonce_null);
 TEST (ecc_thread_safe_test_verify);
 TEST (ecc_thread_safe_test_verify_error);
 TEST (ecc_thread_safe_test_verify_null);
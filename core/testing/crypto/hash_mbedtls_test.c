@@ -44,6 +44,8 @@ static void hash_mbedtls_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, engine.base.update);
 	CuAssertPtrNotNull (test, engine.base.finish);
 	CuAssertPtrNotNull (test, engine.base.cancel);
+	CuAssertPtrNotNull (test, engine.base.save_state);
+	CuAssertPtrNotNull (test, engine.base.restore_state);
 
 	hash_mbedtls_release (&engine);
 }
@@ -3166,6 +3168,369 @@ static void hash_mbedtls_test_calculate_sha512_small_hash_buffer (CuTest *test)
 }
 #endif
 
+#ifdef HASH_ENABLE_SHA1
+static void hash_mbedtls_test_sha1_save_restore_state (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA1_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha1 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) &message[2], strlen (message) - 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA1_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) &message[2], strlen (message) - 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA1_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_mbedtls_release (&engine);
+}
+#endif
+
+static void hash_mbedtls_test_sha256_save_restore_state (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) &message[2], strlen (message) - 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) &message[2], strlen (message) - 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_mbedtls_release (&engine);
+}
+
+#ifdef HASH_ENABLE_SHA384
+static void hash_mbedtls_test_sha384_save_restore_state (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA384_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha384 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) &message[2], strlen (message) - 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA384_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) &message[2], strlen (message) - 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA384_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_mbedtls_release (&engine);
+}
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+static void hash_mbedtls_test_sha512_save_restore_state (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA512_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha512 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) &message[2], strlen (message) - 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA512_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) &message[2], strlen (message) - 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA512_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_mbedtls_release (&engine);
+}
+#endif
+
+static void hash_mbedtls_test_save_state_multiple_restore (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, HASH_TESTING_FULL_BLOCK_512, 32);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, &HASH_TESTING_FULL_BLOCK_512[32], 32);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_FULL_BLOCK_512_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, &HASH_TESTING_FULL_BLOCK_512[32], 32);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_FULL_BLOCK_512_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_mbedtls_release (&engine);
+}
+
+static void hash_mbedtls_test_save_state_null (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (NULL, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.save_state (&engine.base, NULL);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	engine.base.cancel (&engine.base);
+
+	hash_mbedtls_release (&engine);
+}
+
+static void hash_mbedtls_test_save_state_no_active_hash (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	hash_mbedtls_release (&engine);
+}
+
+static void hash_mbedtls_test_restore_state_null (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = engine.base.restore_state (NULL, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.restore_state (&engine.base, NULL);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	hash_mbedtls_release (&engine);
+}
+
+static void hash_mbedtls_test_restore_state_hash_in_progress (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_IN_PROGRESS, status);
+
+	engine.base.cancel (&engine.base);
+
+	hash_mbedtls_release (&engine);
+}
+
+static void hash_mbedtls_test_restore_state_unsupported_hash (CuTest *test)
+{
+	struct hash_engine_mbedtls engine;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mbedtls_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&state, 0, sizeof (state));
+	state.active = HASH_ACTIVE_NONE;
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_UNSUPPORTED_HASH, status);
+
+	state.active = HASH_ACTIVE_SHA512 + 1;
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_UNSUPPORTED_HASH, status);
+
+	status = engine.base.update (&engine.base, HASH_TESTING_FULL_BLOCK_512, 32);
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	hash_mbedtls_release (&engine);
+}
+
 
 TEST_SUITE_START (hash_mbedtls);
 
@@ -3298,5 +3663,21 @@ TEST (hash_mbedtls_test_calculate_sha512_null);
 TEST (hash_mbedtls_test_calculate_sha512_without_finish);
 TEST (hash_mbedtls_test_calculate_sha512_small_hash_buffer);
 #endif
+#ifdef HASH_ENABLE_SHA1
+TEST (hash_mbedtls_test_sha1_save_restore_state);
+#endif
+TEST (hash_mbedtls_test_sha256_save_restore_state);
+#ifdef HASH_ENABLE_SHA384
+TEST (hash_mbedtls_test_sha384_save_restore_state);
+#endif
+#ifdef HASH_ENABLE_SHA512
+TEST (hash_mbedtls_test_sha512_save_restore_state);
+#endif
+TEST (hash_mbedtls_test_save_state_multiple_restore);
+TEST (hash_mbedtls_test_save_state_null);
+TEST (hash_mbedtls_test_save_state_no_active_hash);
+TEST (hash_mbedtls_test_restore_state_null);
+TEST (hash_mbedtls_test_restore_state_hash_in_progress);
+TEST (hash_mbedtls_test_restore_state_unsupported_hash);
 
 TEST_SUITE_END;
@@ -0,0 +1,614 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "platform.h"
+#include "crypto/hash_pool.h"
+#include "testing/mock/crypto/hash_mock.h"
+
+
+TEST_SUITE_LABEL ("hash_pool");
+
+
+/**
+ * Number of hash engines used for testing the pool.
+ */
+#define	HASH_POOL_TESTING_ENGINES		2
+
+/**
+ * Dependencies for testing a hash pool.
+ */
+struct hash_pool_testing {
+	struct hash_engine_mock mock[HASH_POOL_TESTING_ENGINES];	/**< Mock hash engines for the pool. */
+	struct hash_engine *engines[HASH_POOL_TESTING_ENGINES];	/**< List of engines for the pool. */
+	struct hash_pool test;										/**< The pool under test. */
+};
+
+/**
+ * Context for releasing an engine to the pool from a timer.
+ */
+struct hash_pool_testing_release {
+	struct hash_pool *pool;				/**< The pool to release the engine to. */
+	struct hash_engine *engine;			/**< The engine to release. */
+	int status;							/**< The result of the release. */
+};
+
+
+/**
+ * Initialize the mock engines and the pool for testing.
+ *
+ * @param test The test framework.
+ * @param pool Testing components to initialize.
+ */
+static void hash_pool_testing_init (CuTest *test, struct hash_pool_testing *pool)
+{
+	int status;
+	int i;
+
+	for (i = 0; i < HASH_POOL_TESTING_ENGINES; i++) {
+		status = hash_mock_init (&pool->mock[i]);
+		CuAssertIntEquals (test, 0, status);
+
+		pool->engines[i] = &pool->mock[i].base;
+	}
+
+	status = hash_pool_init (&pool->test, pool->engines, HASH_POOL_TESTING_ENGINES);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release the testing components and validate all mocks.
+ *
+ * @param test The test framework.
+ * @param pool Testing components to release.
+ */
+static void hash_pool_testing_release (CuTest *test, struct hash_pool_testing *pool)
+{
+	int status = 0;
+	int i;
+
+	for (i = 0; i < HASH_POOL_TESTING_ENGINES; i++) {
+		status |= hash_mock_validate_and_release (&pool->mock[i]);
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	hash_pool_release (&pool->test);
+}
+
+/**
+ * Timer callback to return an engine to the pool.
+ *
+ * @param context The release context.
+ */
+static void hash_pool_testing_release_callback (void *context)
+{
+	struct hash_pool_testing_release *release = (struct hash_pool_testing_release*) context;
+
+	release->status = hash_pool_release_engine (release->pool, release->engine);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void hash_pool_test_init (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = hash_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0, stats.acquired);
+	CuAssertIntEquals (test, 0, stats.waits);
+	CuAssertIntEquals (test, 0, stats.timeouts);
+	CuAssertIntEquals (test, 0, stats.total_wait_ms);
+	CuAssertIntEquals (test, 0, stats.max_wait_ms);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_init_null (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *null_engine[2];
+	int status;
+	int i;
+
+	TEST_START;
+
+	for (i = 0; i < HASH_POOL_TESTING_ENGINES; i++) {
+		pool.engines[i] = &pool.mock[i].base;
+	}
+
+	status = hash_pool_init (NULL, pool.engines, HASH_POOL_TESTING_ENGINES);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	status = hash_pool_init (&pool.test, NULL, HASH_POOL_TESTING_ENGINES);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	status = hash_pool_init (&pool.test, pool.engines, 0);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	null_engine[0] = &pool.mock[0].base;
+	null_engine[1] = NULL;
+
+	status = hash_pool_init (&pool.test, null_engine, 2);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+}
+
+static void hash_pool_test_init_too_many_engines (CuTest *test)
+{
+	struct hash_pool pool;
+	struct hash_engine_mock mock;
+	struct hash_engine *engines[HASH_POOL_MAX_ENGINES + 1];
+	int status;
+	int i;
+
+	TEST_START;
+
+	for (i = 0; i < HASH_POOL_MAX_ENGINES + 1; i++) {
+		engines[i] = &mock.base;
+	}
+
+	status = hash_pool_init (&pool, engines, HASH_POOL_MAX_ENGINES + 1);
+	CuAssertIntEquals (test, HASH_POOL_TOO_MANY_ENGINES, status);
+}
+
+static void hash_pool_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	hash_pool_release (NULL);
+}
+
+static void hash_pool_test_acquire_engine (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *engine1 = NULL;
+	struct hash_engine *engine2 = NULL;
+	struct hash_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, &engine1);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &pool.mock[0].base, engine1);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, &engine2);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &pool.mock[1].base, engine2);
+
+	status = hash_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 2, stats.acquired);
+	CuAssertIntEquals (test, 0, stats.waits);
+	CuAssertIntEquals (test, 0, stats.timeouts);
+
+	status = mock_expect (&pool.mock[0].mock, pool.mock[0].base.cancel, &pool.mock[0], 0);
+	status |= mock_expect (&pool.mock[1].mock, pool.mock[1].base.cancel, &pool.mock[1], 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_acquire_engine_independent_hashes (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *engine1 = NULL;
+	struct hash_engine *engine2 = NULL;
+	uint8_t hash[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = mock_expect (&pool.mock[0].mock, pool.mock[0].base.start_sha256, &pool.mock[0], 0);
+	status |= mock_expect (&pool.mock[0].mock, pool.mock[0].base.finish, &pool.mock[0], 0,
+		MOCK_ARG (hash), MOCK_ARG (sizeof (hash)));
+	status |= mock_expect (&pool.mock[0].mock, pool.mock[0].base.cancel, &pool.mock[0], 0);
+
+	status |= mock_expect (&pool.mock[1].mock, pool.mock[1].base.start_sha256, &pool.mock[1], 0);
+	status |= mock_expect (&pool.mock[1].mock, pool.mock[1].base.finish, &pool.mock[1], 0,
+		MOCK_ARG (hash), MOCK_ARG (sizeof (hash)));
+	status |= mock_expect (&pool.mock[1].mock, pool.mock[1].base.cancel, &pool.mock[1], 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 0, &engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine1->start_sha256 (engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	/* A second hash can be started while the first is still in progress. */
+	status = hash_pool_acquire_engine (&pool.test, 0, &engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine2->start_sha256 (engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine1->finish (engine1, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine2->finish (engine2, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_acquire_engine_after_release (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *engine1 = NULL;
+	struct hash_engine *engine2 = NULL;
+	struct hash_engine *engine3 = NULL;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = mock_expect (&pool.mock[0].mock, pool.mock[0].base.cancel, &pool.mock[0], 0);
+	status |= mock_expect (&pool.mock[0].mock, pool.mock[0].base.cancel, &pool.mock[0], 0);
+	status |= mock_expect (&pool.mock[1].mock, pool.mock[1].base.cancel, &pool.mock[1], 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, &engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, &engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, &engine3);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, engine1, engine3);
+
+	status = hash_pool_release_engine (&pool.test, engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine3);
+	CuAssertIntEquals (test, 0, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_acquire_engine_timeout (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *engine1 = NULL;
+	struct hash_engine *engine2 = NULL;
+	struct hash_engine *engine3 = NULL;
+	struct hash_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = mock_expect (&pool.mock[0].mock, pool.mock[0].base.cancel, &pool.mock[0], 0);
+	status |= mock_expect (&pool.mock[1].mock, pool.mock[1].base.cancel, &pool.mock[1], 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, &engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, &engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 50, &engine3);
+	CuAssertIntEquals (test, HASH_POOL_TIMEOUT, status);
+
+	status = hash_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 2, stats.acquired);
+	CuAssertIntEquals (test, 1, stats.waits);
+	CuAssertIntEquals (test, 1, stats.timeouts);
+	CuAssertTrue (test, (stats.total_wait_ms >= 45));
+	CuAssertIntEquals (test, stats.total_wait_ms, stats.max_wait_ms);
+
+	status = hash_pool_release_engine (&pool.test, engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_acquire_engine_wait_for_release (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_pool_testing_release release;
+	platform_timer timer;
+	struct hash_engine *engine1 = NULL;
+	struct hash_engine *engine2 = NULL;
+	struct hash_engine *engine3 = NULL;
+	struct hash_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = mock_expect (&pool.mock[0].mock, pool.mock[0].base.cancel, &pool.mock[0], 0);
+	status |= mock_expect (&pool.mock[1].mock, pool.mock[1].base.cancel, &pool.mock[1], 0);
+	status |= mock_expect (&pool.mock[1].mock, pool.mock[1].base.cancel, &pool.mock[1], 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 0, &engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 0, &engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	release.pool = &pool.test;
+	release.engine = engine2;
+	release.status = -1;
+
+	status = platform_timer_create (&timer, hash_pool_testing_release_callback, &release);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_timer_arm_one_shot (&timer, 20);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 1000, &engine3);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, engine2, engine3);
+	CuAssertIntEquals (test, 0, release.status);
+
+	platform_timer_delete (&timer);
+
+	status = hash_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 3, stats.acquired);
+	CuAssertIntEquals (test, 1, stats.waits);
+	CuAssertIntEquals (test, 0, stats.timeouts);
+	CuAssertTrue (test, (stats.max_wait_ms < 1000));
+
+	status = hash_pool_release_engine (&pool.test, engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine3);
+	CuAssertIntEquals (test, 0, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_acquire_engine_null (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *engine = NULL;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = hash_pool_acquire_engine (NULL, 100, &engine);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, NULL);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_try_acquire_engine (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *engine1 = NULL;
+	struct hash_engine *engine2 = NULL;
+	struct hash_engine *engine3 = NULL;
+	struct hash_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = mock_expect (&pool.mock[0].mock, pool.mock[0].base.cancel, &pool.mock[0], 0);
+	status |= mock_expect (&pool.mock[1].mock, pool.mock[1].base.cancel, &pool.mock[1], 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_try_acquire_engine (&pool.test, &engine1);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &pool.mock[0].base, engine1);
+
+	status = hash_pool_try_acquire_engine (&pool.test, &engine2);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &pool.mock[1].base, engine2);
+
+	status = hash_pool_try_acquire_engine (&pool.test, &engine3);
+	CuAssertIntEquals (test, HASH_POOL_NO_ENGINE, status);
+
+	status = hash_pool_get_stats (&pool.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 2, stats.acquired);
+	CuAssertIntEquals (test, 0, stats.waits);
+
+	status = hash_pool_release_engine (&pool.test, engine1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_try_acquire_engine_null (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *engine = NULL;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = hash_pool_try_acquire_engine (NULL, &engine);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	status = hash_pool_try_acquire_engine (&pool.test, NULL);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_release_engine_null (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *engine = NULL;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = mock_expect (&pool.mock[0].mock, pool.mock[0].base.cancel, &pool.mock[0], 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, &engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (NULL, engine);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	status = hash_pool_release_engine (&pool.test, NULL);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	status = hash_pool_release_engine (&pool.test, engine);
+	CuAssertIntEquals (test, 0, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_release_engine_not_pool_engine (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine_mock other;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = hash_mock_init (&other);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, &other.base);
+	CuAssertIntEquals (test, HASH_POOL_NOT_POOL_ENGINE, status);
+
+	status = hash_mock_validate_and_release (&other);
+	CuAssertIntEquals (test, 0, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_release_engine_not_acquired (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_engine *engine = NULL;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = mock_expect (&pool.mock[0].mock, pool.mock[0].base.cancel, &pool.mock[0], 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, &pool.mock[1].base);
+	CuAssertIntEquals (test, HASH_POOL_ENGINE_NOT_ACQUIRED, status);
+
+	status = hash_pool_acquire_engine (&pool.test, 100, &engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&pool.test, engine);
+	CuAssertIntEquals (test, HASH_POOL_ENGINE_NOT_ACQUIRED, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+static void hash_pool_test_get_stats_null (CuTest *test)
+{
+	struct hash_pool_testing pool;
+	struct hash_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	hash_pool_testing_init (test, &pool);
+
+	status = hash_pool_get_stats (NULL, &stats);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	status = hash_pool_get_stats (&pool.test, NULL);
+	CuAssertIntEquals (test, HASH_POOL_INVALID_ARGUMENT, status);
+
+	hash_pool_testing_release (test, &pool);
+}
+
+
+TEST_SUITE_START (hash_pool);
+
+TEST (hash_pool_test_init);
+TEST (hash_pool_test_init_null);
+TEST (hash_pool_test_init_too_many_engines);
+TEST (hash_pool_test_release_null);
+TEST (hash_pool_test_acquire_engine);
+TEST (hash_pool_test_acquire_engine_independent_hashes);
+TEST (hash_pool_test_acquire_engine_after_release);
+TEST (hash_pool_test_acquire_engine_timeout);
+TEST (hash_pool_test_acquire_engine_wait_for_release);
+TEST (hash_pool_test_acquire_engine_null);
+TEST (hash_pool_test_try_acquire_engine);
+TEST (hash_pool_test_try_acquire_engine_null);
+TEST (hash_pool_test_release_engine_null);
+TEST (hash_pool_test_release_engine_not_pool_engine);
+TEST (hash_pool_test_release_engine_not_acquired);
+TEST (hash_pool_test_get_stats_null);
+
+TEST_SUITE_END;
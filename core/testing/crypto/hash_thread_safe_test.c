@@ -42,6 +42,35 @@ static void hash_thread_safe_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, engine.base.update);
 	CuAssertPtrNotNull (test, engine.base.finish);
 	CuAssertPtrNotNull (test, engine.base.cancel);
+	CuAssertPtrNotNull (test, engine.base.save_state);
+	CuAssertPtrNotNull (test, engine.base.restore_state);
+
+	status = hash_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_init_no_save_state (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	mock.base.save_state = NULL;
+	mock.base.restore_state = NULL;
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, engine.base.update);
+	CuAssertPtrEquals (test, NULL, engine.base.save_state);
+	CuAssertPtrEquals (test, NULL, engine.base.restore_state);
 
 	status = hash_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
@@ -1088,10 +1117,224 @@ static void hash_thread_safe_test_cancel_null (CuTest *test)
 	hash_thread_safe_release (&engine);
 }
 
+static void hash_thread_safe_test_save_state (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.start_sha256, &mock, 0);
+	status |= mock_expect (&mock.mock, mock.base.save_state, &mock, 0, MOCK_ARG (&state));
+	status |= mock_expect (&mock.mock, mock.base.cancel, &mock, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_save_state_error (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.start_sha256, &mock, 0);
+	status |= mock_expect (&mock.mock, mock.base.save_state, &mock, HASH_ENGINE_SAVE_STATE_FAILED,
+		MOCK_ARG (&state));
+	status |= mock_expect (&mock.mock, mock.base.cancel, &mock, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_SAVE_STATE_FAILED, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_save_state_null (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.start_sha256, &mock, 0);
+	status |= mock_expect (&mock.mock, mock.base.cancel, &mock, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (NULL, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_restore_state (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.restore_state, &mock, 0, MOCK_ARG (&state));
+	status |= mock_expect (&mock.mock, mock.base.cancel, &mock, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_restore_state_error (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.restore_state, &mock,
+		HASH_ENGINE_RESTORE_STATE_FAILED, MOCK_ARG (&state));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_RESTORE_STATE_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_restore_state_null (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_engine_state state;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (NULL, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
 
 TEST_SUITE_START (hash_thread_safe);
 
 TEST (hash_thread_safe_test_init);
+TEST (hash_thread_safe_test_init_no_save_state);
 TEST (hash_thread_safe_test_init_null);
 TEST (hash_thread_safe_test_release_null);
 TEST (hash_thread_safe_test_calculate_sha1);
@@ -1125,5 +1368,11 @@ TEST (hash_thread_safe_test_finish);
 TEST (hash_thread_safe_test_finish_error);
 TEST (hash_thread_safe_test_finish_null);
 TEST (hash_thread_safe_test_cancel_null);
+TEST (hash_thread_safe_test_save_state);
+TEST (hash_thread_safe_test_save_state_error);
+TEST (hash_thread_safe_test_save_state_null);
+TEST (hash_thread_safe_test_restore_state);
+TEST (hash_thread_safe_test_restore_state_error);
+TEST (hash_thread_safe_test_restore_state_null);
 
 TEST_SUITE_END;
@@ -6,6 +6,7 @@
 #include <string.h>
 #include "testing.h"
 #include "flash/flash_updater.h"
+#include "flash/flash_common.h"
 #include "testing/mock/flash/flash_mock.h"
 
 
@@ -166,6 +167,55 @@ static void flash_updater_test_init_sector_null (CuTest *test)
 	flash_updater_release (&updater);
 }
 
+static void flash_updater_test_init_mixed (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_mixed (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_init_mixed_null (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_mixed (NULL, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, FLASH_UPDATER_INVALID_ARGUMENT, status);
+
+	status = flash_updater_init_mixed (&updater, NULL, 0x10000, 0x10000);
+	CuAssertIntEquals (test, FLASH_UPDATER_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
 static void flash_updater_test_release_null (CuTest *test)
 {
 	TEST_START;
@@ -496,6 +546,53 @@ static void flash_updater_test_prepare_for_update_erase_all_sector (CuTest *test
 	flash_updater_release (&updater);
 }
 
+static void flash_updater_test_prepare_for_update_erase_all_mixed (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_mixed (&updater, &flash.base, 0x1f000, 0x11000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1f000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= flash_mock_expect_blank_check (&flash, 0x1f000, 0x11000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update_erase_all (&updater, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 10, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
 static void flash_updater_test_prepare_for_update_erase_all_not_aligned (CuTest *test)
 {
 	struct flash_mock flash;
@@ -1721,6 +1818,8 @@ TEST (flash_updater_test_init_null);
 TEST (flash_updater_test_init_sector);
 TEST (flash_updater_test_init_sector_not_sector_aligned);
 TEST (flash_updater_test_init_sector_null);
+TEST (flash_updater_test_init_mixed);
+TEST (flash_updater_test_init_mixed_null);
 TEST (flash_updater_test_release_null);
 TEST (flash_updater_test_prepare_for_update);
 TEST (flash_updater_test_prepare_for_update_sector);
@@ -1732,6 +1831,7 @@ TEST (flash_updater_test_prepare_for_update_too_large);
 TEST (flash_updater_test_prepare_for_update_erase_error);
 TEST (flash_updater_test_prepare_for_update_erase_all);
 TEST (flash_updater_test_prepare_for_update_erase_all_sector);
+TEST (flash_updater_test_prepare_for_update_erase_all_mixed);
 TEST (flash_updater_test_prepare_for_update_erase_all_not_aligned);
 TEST (flash_updater_test_prepare_for_update_erase_all_with_offset);
 TEST (flash_updater_test_prepare_for_update_erase_all_zero_length);
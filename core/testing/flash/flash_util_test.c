@@ -8213,12 +8213,13 @@ static void flash_sector_erase_region_test_multiple_sectors_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_erase_region_and_verify_test (CuTest *test)
+static void flash_mixed_erase_region_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0xff, 0xff, 0xff, 0xff};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
@@ -8226,29 +8227,32 @@ static void flash_sector_erase_region_and_verify_test (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_erase_region_and_verify (&flash.base, 0x10000, sizeof (data));
+	status = flash_mixed_erase_region (&flash.base, 0x10000, 256);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_erase_region_and_verify_test_not_blank (CuTest *test)
+static void flash_mixed_erase_region_test_multiple_sectors (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0xff, 0xff, 0xff, 0x00};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
@@ -8256,67 +8260,102 @@ static void flash_sector_erase_region_and_verify_test_not_blank (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_erase_region_and_verify (&flash.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
+	status = flash_mixed_erase_region (&flash.base, 0x10000, (1024 * 4 * 3));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_erase_region_and_verify_test_null (CuTest *test)
+static void flash_mixed_erase_region_test_full_block (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_erase_region_and_verify (NULL, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x10000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mixed_erase_region (&flash.base, 0x10000, FLASH_BLOCK_SIZE);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_erase_region_and_verify_test_sector_check_error (CuTest *test)
+static void flash_mixed_erase_region_test_multiple_blocks (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x30000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_erase_region_and_verify (&flash.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+	status = flash_mixed_erase_region (&flash.base, 0x10000, FLASH_BLOCK_SIZE * 3);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_erase_region_and_verify_test_erase_error (CuTest *test)
+static void flash_mixed_erase_region_test_unaligned_start_and_end (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
@@ -8324,26 +8363,37 @@ static void flash_sector_erase_region_and_verify_test_erase_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
-		MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1e000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1f000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x30000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x40000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_erase_region_and_verify (&flash.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
+	status = flash_mixed_erase_region (&flash.base, 0x1e100, 0x40100 - 0x1e100);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test (CuTest *test)
+static void flash_mixed_erase_region_test_block_unaligned_region (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
+	int i;
 
 	TEST_START;
 
@@ -8351,28 +8401,35 @@ static void flash_sector_program_data_test (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	for (i = 0; i < 16; i++) {
+		status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0,
+			MOCK_ARG (0x18000 + (i * FLASH_SECTOR_SIZE)));
+	}
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
+	status = flash_mixed_erase_region (&flash.base, 0x18000, FLASH_BLOCK_SIZE);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_offset (CuTest *test)
+static void flash_mixed_erase_region_test_block_not_sector_multiple (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_SECTOR_SIZE + (FLASH_SECTOR_SIZE / 2);
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
@@ -8380,49 +8437,68 @@ static void flash_sector_program_data_test_offset (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10200));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10200),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x0000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x2000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x3000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x10200, data, sizeof (data));
+	status = flash_mixed_erase_region (&flash.base, 0, FLASH_SECTOR_SIZE * 4);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_null (CuTest *test)
+static void flash_mixed_erase_region_test_block_same_as_sector (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (NULL, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status = flash_sector_program_data (&flash.base, 0x10000, NULL, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mixed_erase_region (&flash.base, 0x10000, FLASH_SECTOR_SIZE * 2);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_erase_error (CuTest *test)
+static void flash_mixed_erase_region_test_full_device (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
@@ -8430,26 +8506,32 @@ static void flash_sector_program_data_test_erase_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
-		MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.chip_erase, &flash, 0);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
+	status = flash_mixed_erase_region (&flash.base, 0, device);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_write_error (CuTest *test)
+static void flash_mixed_erase_region_test_start_of_device (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
@@ -8457,28 +8539,35 @@ static void flash_sector_program_data_test_write_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x00000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+	status = flash_mixed_erase_region (&flash.base, 0, 0x20010);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_incomplete_write (CuTest *test)
+static void flash_mixed_erase_region_test_all_but_last_sector (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
+	uint32_t addr;
 
 	TEST_START;
 
@@ -8486,28 +8575,38 @@ static void flash_sector_program_data_test_incomplete_write (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x100fe));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
-		MOCK_ARG (0x100fe), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	for (addr = 0; addr < 0xf0000; addr += FLASH_BLOCK_SIZE) {
+		status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (addr));
+	}
+
+	for (addr = 0xf0000; addr < (device - FLASH_SECTOR_SIZE); addr += FLASH_SECTOR_SIZE) {
+		status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (addr));
+	}
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x100fe, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+	status = flash_mixed_erase_region (&flash.base, 0, device - FLASH_SECTOR_SIZE);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test (CuTest *test)
+static void flash_mixed_erase_region_test_end_of_device (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
@@ -8515,33 +8614,33 @@ static void flash_sector_program_and_verify_test (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0xef000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0xf0000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	status = flash_mixed_erase_region (&flash.base, 0xef000, device - 0xef000);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test_mismatch (CuTest *test)
+static void flash_mixed_erase_region_test_past_end_of_device (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t check[] = {0x01, 0x02, 0x13, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
@@ -8549,692 +8648,442 @@ static void flash_sector_program_and_verify_test_mismatch (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, check, sizeof (check), 2);
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	status = flash_mixed_erase_region (&flash.base, 0, device + 1);
+	CuAssertIntEquals (test, FLASH_UTIL_ADDRESS_OUT_OF_RANGE, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test_null (CuTest *test)
+static void flash_mixed_erase_region_test_past_end_of_device_unaligned (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (NULL, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, NULL, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mixed_erase_region (&flash.base, 0xff000, FLASH_SECTOR_SIZE + 0x10);
+	CuAssertIntEquals (test, FLASH_UTIL_ADDRESS_OUT_OF_RANGE, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test_error (CuTest *test)
+static void flash_mixed_erase_region_test_no_length (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
-		MOCK_ARG (0x10000));
-
+	status = flash_mixed_erase_region (&flash.base, 0x10000, 0);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
-
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test_verify_error (CuTest *test)
+static void flash_mixed_erase_region_test_null (CuTest *test)
 {
-	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_mixed_erase_region (NULL, 0x10000, 256);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+}
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+static void flash_mixed_erase_region_test_sector_size_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	TEST_START;
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_mixed_erase_region (&flash.base, 0x10000, 256);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test (CuTest *test)
+static void flash_mixed_erase_region_test_block_size_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint32_t sector = FLASH_SECTOR_SIZE;
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, FLASH_BLOCK_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_mixed_erase_region (&flash.base, 0x10000, 256);
+	CuAssertIntEquals (test, FLASH_BLOCK_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_across_erase_blocks (CuTest *test)
+static void flash_mixed_erase_region_test_device_size_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
-		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
-		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
-		MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash,
+		FLASH_DEVICE_SIZE_FAILED, MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x11fff, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_mixed_erase_region (&flash.base, 0, 0x100000);
+	CuAssertIntEquals (test, FLASH_DEVICE_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_multiple_pages (CuTest *test)
+static void flash_mixed_erase_region_test_chip_erase_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash.mock, flash.base.chip_erase, &flash, FLASH_CHIP_ERASE_FAILED);
 
-	offset = 0;
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+	status = flash_mixed_erase_region (&flash.base, 0, device);
+	CuAssertIntEquals (test, FLASH_CHIP_ERASE_FAILED, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+static void flash_mixed_erase_region_test_block_erase_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
-	offset += page;
+	TEST_START;
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	offset += page;
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
-		MOCK_ARG (page - 1));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1f000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, FLASH_BLOCK_ERASE_FAILED,
+		MOCK_ARG (0x20000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_mixed_erase_region (&flash.base, 0x1f000, FLASH_BLOCK_SIZE * 2);
+	CuAssertIntEquals (test, FLASH_BLOCK_ERASE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_full_sector (CuTest *test)
+static void flash_mixed_erase_region_test_sector_erase_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[FLASH_SECTOR_SIZE];
-	uint8_t blank[sizeof (data)];
-	int offset;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
 
 	TEST_START;
 
-	memset (data, 0x55, sizeof (data));
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
-
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-	}
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
 
-		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
-			MOCK_ARG (FLASH_PAGE_SIZE));
-	}
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x1f000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x11000, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_mixed_erase_region (&flash.base, 0x1f000, FLASH_BLOCK_SIZE * 2);
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_source_higher_address (CuTest *test)
+static void flash_mixed_erase_region_and_verify_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
+	uint8_t data[] = {0xff, 0xff, 0xff, 0xff};
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
 
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, sizeof (data));
+	status = flash_mixed_erase_region_and_verify (&flash.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_source_higher_address_full_sector (CuTest *test)
+static void flash_mixed_erase_region_and_verify_test_not_blank (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[FLASH_SECTOR_SIZE];
-	uint8_t blank[sizeof (data)];
-	int offset;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
+	uint8_t data[] = {0xff, 0xff, 0xff, 0x00};
 
 	TEST_START;
 
-	memset (data, 0x55, sizeof (data));
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-	}
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
-			MOCK_ARG (0x10000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
-			MOCK_ARG (FLASH_PAGE_SIZE));
-	}
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_mixed_erase_region_and_verify (&flash.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_not_4k (CuTest *test)
+static void flash_mixed_erase_region_and_verify_test_null (CuTest *test)
 {
-	struct flash_mock flash;
 	int status;
-	uint32_t bytes = 1024 * 2;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
+	status = flash_mixed_erase_region_and_verify (NULL, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+}
+
+static void flash_mixed_erase_region_and_verify_test_erase_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint32_t device = 0x100000;
+
+	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10800));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.get_device_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &device, sizeof (device), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10800),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x10000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10800, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_mixed_erase_region_and_verify (&flash.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_multiple_pages_page_not_256 (CuTest *test)
+static void flash_sector_erase_region_and_verify_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = 256 * 2;
-	uint8_t data[page * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	uint8_t data[] = {0xff, 0xff, 0xff, 0xff};
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset = 0;
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	offset += page;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	offset += page;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
-		MOCK_ARG (page - 1));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
+	status = flash_sector_erase_region_and_verify (&flash.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_multiple_pages_page_offset (CuTest *test)
+static void flash_sector_erase_region_and_verify_test_not_blank (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	uint8_t data[] = {0xff, 0xff, 0xff, 0x00};
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20010));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset = 0;
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 0x10,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
-		MOCK_ARG (page - 0x10));
-
-	offset += page - 0x10;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	offset += page;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	offset += page;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, 0x10, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20010, 0x10000, page * 3);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_erase_region_and_verify (&flash.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_null (CuTest *test)
+static void flash_sector_erase_region_and_verify_test_null (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -9244,14 +9093,14 @@ static void flash_sector_copy_test_null (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (NULL, 0x20000, 0x10000, 4);
+	status = flash_sector_erase_region_and_verify (NULL, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_no_length (CuTest *test)
+static void flash_sector_erase_region_and_verify_test_sector_check_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -9261,373 +9110,248 @@ static void flash_sector_copy_test_no_length (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 0);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
+
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_sector_erase_region_and_verify (&flash.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_sector_check_error (CuTest *test)
+static void flash_sector_erase_region_and_verify_test_erase_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x10000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+	status = flash_sector_erase_region_and_verify (&flash.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_not_blank (CuTest *test)
+static void flash_sector_program_data_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-	blank[sizeof (blank) - 1] = 0;
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (blank));
-	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
+	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_page_size_error (CuTest *test)
+static void flash_sector_program_data_test_offset (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10200));
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, FLASH_PAGE_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10200),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
+	status = flash_sector_program_data (&flash.base, 0x10200, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_page_size_unsupported (CuTest *test)
+static void flash_sector_program_data_test_null (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
-	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
-
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_program_data (NULL, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_program_data (&flash.base, 0x10000, NULL, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_read_error (CuTest *test)
+static void flash_sector_program_data_test_erase_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x10000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_write_error (CuTest *test)
+static void flash_sector_program_data_test_write_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
+	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
 	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_partial_write (CuTest *test)
+static void flash_sector_program_data_test_incomplete_write (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
-		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x100fe));
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 2,
-		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
-		MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
+		MOCK_ARG (0x100fe), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x11fff, 0x10000, sizeof (data));
+	status = flash_sector_program_data (&flash.base, 0x100fe, data, sizeof (data));
 	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_multiple_pages_error (CuTest *test)
+static void flash_sector_program_and_verify_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset = 0;
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	offset += page;
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page),
-		MOCK_ARG (page));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_overlapping_regions (CuTest *test)
+static void flash_sector_program_and_verify_test_mismatch (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t check[] = {0x01, 0x02, 0x13, 0x04};
 
 	TEST_START;
 
@@ -9637,66 +9361,51 @@ static void flash_sector_copy_test_overlapping_regions (CuTest *test)
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy (&flash.base, 0x11000, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
-
-	status = flash_mock_validate_and_release (&flash);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_test_overlapping_regions_source_higher (CuTest *test)
-{
-	struct flash_mock flash;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-
-	TEST_START;
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, check, sizeof (check), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_same_erase_block (CuTest *test)
+static void flash_sector_program_and_verify_test_null (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_program_and_verify (NULL, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_sector_copy (&flash.base, 0x10100, 0x10000, 0x10);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, NULL, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_same_erase_block_at_source_end (CuTest *test)
+static void flash_sector_program_and_verify_test_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -9706,20 +9415,24 @@ static void flash_sector_copy_test_same_erase_block_at_source_end (CuTest *test)
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x10000));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10000, 0x11100, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_same_erase_block_at_destination_end (CuTest *test)
+static void flash_sector_program_and_verify_test_verify_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -9729,16 +9442,24 @@ static void flash_sector_copy_test_same_erase_block_at_destination_end (CuTest *
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x11100, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test (CuTest *test)
+static void flash_sector_copy_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -9776,20 +9497,16 @@ static void flash_sector_copy_and_verify_test (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
 		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_mismatch (CuTest *test)
+static void flash_sector_copy_test_across_erase_blocks (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -9811,9 +9528,10 @@ static void flash_sector_copy_and_verify_test_mismatch (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
@@ -9821,26 +9539,30 @@ static void flash_sector_copy_and_verify_test_mismatch (CuTest *test)
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
+		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
+		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
+		MOCK_ARG (sizeof (data) - 1));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	status = flash_sector_copy (&flash.base, 0x11fff, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_multiple_pages_mismatch (CuTest *test)
+static void flash_sector_copy_test_multiple_pages (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -9896,10 +9618,6 @@ static void flash_sector_copy_and_verify_test_multiple_pages_mismatch (CuTest *t
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
 		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
 	offset += page;
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
@@ -9909,21 +9627,26 @@ static void flash_sector_copy_and_verify_test_multiple_pages_mismatch (CuTest *t
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
 		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
+		MOCK_ARG (page - 1));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000,
-		(page * 3) - 1);
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_full_sector (CuTest *test)
+static void flash_sector_copy_test_full_sector (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -9966,22 +9689,119 @@ static void flash_sector_copy_and_verify_test_full_sector (CuTest *test)
 		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
 			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
 			MOCK_ARG (FLASH_PAGE_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy (&flash.base, 0x11000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_test_source_higher_address (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_test_source_higher_address_full_sector (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[FLASH_SECTOR_SIZE];
+	uint8_t blank[sizeof (data)];
+	int offset;
+
+	TEST_START;
+
+	memset (data, 0x55, sizeof (data));
+	memset (blank, 0xff, sizeof (blank));
 
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	}
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
 		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
 			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
 		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
+			MOCK_ARG (0x10000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
+			MOCK_ARG (FLASH_PAGE_SIZE));
 	}
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x11000, 0x10000, sizeof (data));
+	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_not_4k (CuTest *test)
+static void flash_sector_copy_test_not_4k (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10019,20 +9839,16 @@ static void flash_sector_copy_and_verify_test_not_4k (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10800),
 		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x10800, 0x10000, sizeof (data));
+	status = flash_sector_copy (&flash.base, 0x10800, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTest *test)
+static void flash_sector_copy_test_multiple_pages_page_not_256 (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10041,7 +9857,6 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTes
 	uint8_t data[page * 3];
 	uint8_t blank[FLASH_VERIFICATION_BLOCK];
 	int offset = 0;
-	int verify;
 
 	TEST_START;
 
@@ -10097,7 +9912,6 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTes
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	offset = 0;
-	verify = 0;
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
@@ -10109,18 +9923,7 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTes
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
 		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
-
 	offset += page;
-	verify += FLASH_VERIFICATION_BLOCK;
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
@@ -10129,18 +9932,7 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTes
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
 		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
-
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
-
 	offset += page;
-	verify += FLASH_VERIFICATION_BLOCK;
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
@@ -10150,26 +9942,16 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTes
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
 		MOCK_ARG (page - 1));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
-
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_multiple_pages_page_offset (CuTest *test)
+static void flash_sector_copy_test_multiple_pages_page_offset (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10226,10 +10008,6 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_offset (CuTest
 		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
 		MOCK_ARG (page - 0x10));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
 	offset += page - 0x10;
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
@@ -10239,10 +10017,6 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_offset (CuTest
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
 		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
 	offset += page;
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
@@ -10252,10 +10026,6 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_offset (CuTest
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
 		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
 	offset += page;
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
@@ -10265,20 +10035,16 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_offset (CuTest
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, 0x10, MOCK_ARG (0x20010 + offset),
 		MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20010, 0x10000, page * 3);
+	status = flash_sector_copy (&flash.base, 0x20010, 0x10000, page * 3);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_null (CuTest *test)
+static void flash_sector_copy_test_null (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10288,14 +10054,31 @@ static void flash_sector_copy_and_verify_test_null (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (NULL, 0x20000, 0x10000, 4);
+	status = flash_sector_copy (NULL, 0x20000, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_sector_check_error (CuTest *test)
+static void flash_sector_copy_test_no_length (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_test_sector_check_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10310,14 +10093,14 @@ static void flash_sector_copy_and_verify_test_sector_check_error (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_page_size_error (CuTest *test)
+static void flash_sector_copy_test_not_blank (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10327,6 +10110,7 @@ static void flash_sector_copy_and_verify_test_page_size_error (CuTest *test)
 	TEST_START;
 
 	memset (blank, 0xff, sizeof (blank));
+	blank[sizeof (blank) - 1] = 0;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -10340,27 +10124,23 @@ static void flash_sector_copy_and_verify_test_page_size_error (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, FLASH_PAGE_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (blank));
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_test_page_size_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
 	uint8_t blank[4];
 
 	TEST_START;
@@ -10382,24 +10162,24 @@ static void flash_sector_copy_and_verify_test_page_size_unsupported (CuTest *tes
 		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, FLASH_PAGE_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_read_error (CuTest *test)
+static void flash_sector_copy_test_page_size_unsupported (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
+	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
 	uint8_t blank[4];
 
 	TEST_START;
@@ -10422,28 +10202,24 @@ static void flash_sector_copy_and_verify_test_read_error (CuTest *test)
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_write_error (CuTest *test)
+static void flash_sector_copy_test_read_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint8_t blank[4];
 
 	TEST_START;
 
@@ -10461,7 +10237,50 @@ static void flash_sector_copy_and_verify_test_write_error (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_test_write_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
@@ -10476,14 +10295,14 @@ static void flash_sector_copy_and_verify_test_write_error (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_partial_write (CuTest *test)
+static void flash_sector_copy_test_partial_write (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10522,10 +10341,6 @@ static void flash_sector_copy_and_verify_test_partial_write (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
 		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
 	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
@@ -10536,37 +10351,112 @@ static void flash_sector_copy_and_verify_test_partial_write (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x11fff, 0x10000, sizeof (data));
+	status = flash_sector_copy (&flash.base, 0x11fff, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_overlapping_regions (CuTest *test)
+static void flash_sector_copy_test_multiple_pages_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
 
 	TEST_START;
 
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memset (blank, 0xff, sizeof (blank));
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page),
+		MOCK_ARG (page));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x11000, 0x10000, 0x1001);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_test_overlapping_regions (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy (&flash.base, 0x11000, 0x10000, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_overlapping_regions_source_higher (CuTest *test)
+static void flash_sector_copy_test_overlapping_regions_source_higher (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10582,14 +10472,14 @@ static void flash_sector_copy_and_verify_test_overlapping_regions_source_higher
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x10000, 0x11000, 0x1001);
+	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_same_erase_block (CuTest *test)
+static void flash_sector_copy_test_same_erase_block (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10605,14 +10495,14 @@ static void flash_sector_copy_and_verify_test_same_erase_block (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x10100, 0x10000, 0x10);
+	status = flash_sector_copy (&flash.base, 0x10100, 0x10000, 0x10);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_same_erase_block_at_source_end (CuTest *test)
+static void flash_sector_copy_test_same_erase_block_at_source_end (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10628,14 +10518,14 @@ static void flash_sector_copy_and_verify_test_same_erase_block_at_source_end (Cu
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x10000, 0x11100, 0x1001);
+	status = flash_sector_copy (&flash.base, 0x10000, 0x11100, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_same_erase_block_at_destination_end (CuTest *test)
+static void flash_sector_copy_test_same_erase_block_at_destination_end (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10651,17 +10541,16 @@ static void flash_sector_copy_and_verify_test_same_erase_block_at_destination_en
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x11100, 0x10000, 0x1001);
+	status = flash_sector_copy (&flash.base, 0x11100, 0x10000, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test (CuTest *test)
+static void flash_sector_copy_and_verify_test (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
@@ -10672,49 +10561,47 @@ static void flash_sector_copy_ext_test (CuTest *test)
 
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash1);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_across_erase_blocks (CuTest *test)
+static void flash_sector_copy_and_verify_test_mismatch (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
@@ -10725,58 +10612,47 @@ static void flash_sector_copy_ext_test_across_erase_blocks (CuTest *test)
 
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
-		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 1,
-		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
-		MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x11fff, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
 
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_multiple_pages (CuTest *test)
+static void flash_sector_copy_and_verify_test_multiple_pages_mismatch (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
@@ -10791,83 +10667,75 @@ static void flash_sector_copy_ext_test_multiple_pages (CuTest *test)
 	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	offset += FLASH_VERIFICATION_BLOCK;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	offset += FLASH_VERIFICATION_BLOCK;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	offset = 0;
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	offset += page;
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	offset += page;
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 1,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
-		MOCK_ARG (page - 1));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		(page * 3) - 1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000,
+		(page * 3) - 1);
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
 
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_full_sector (CuTest *test)
+static void flash_sector_copy_and_verify_test_full_sector (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
@@ -10880,56 +10748,54 @@ static void flash_sector_copy_ext_test_full_sector (CuTest *test)
 	memset (data, 0x55, sizeof (data));
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
 
 	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
-		status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-		status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 	}
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
 	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
-		status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0,
-			MOCK_ARG (0x10000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-		status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_PAGE_SIZE,
+		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
 			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
 			MOCK_ARG (FLASH_PAGE_SIZE));
-	}
 
-	CuAssertIntEquals (test, 0, status);
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	}
 
-	status = flash_sector_copy_ext (&flash2.base, 0x11000, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash1);
+	status = flash_sector_copy_and_verify (&flash.base, 0x11000, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_source_same_address (CuTest *test)
+static void flash_sector_copy_and_verify_test_not_4k (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t bytes = 1024 * 2;
 	uint32_t page = FLASH_PAGE_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t blank[sizeof (data)];
@@ -10938,58 +10804,61 @@ static void flash_sector_copy_ext_test_source_same_address (CuTest *test)
 
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10800));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10800),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x10000, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash1);
+	status = flash_sector_copy_and_verify (&flash.base, 0x10800, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_same_flash_full_sector (CuTest *test)
+static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[FLASH_SECTOR_SIZE];
-	uint8_t blank[sizeof (data)];
-	int offset;
+	uint32_t page = 256 * 2;
+	uint8_t data[page * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+	int verify;
 
 	TEST_START;
 
-	memset (data, 0x55, sizeof (data));
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
@@ -11001,202 +10870,118 @@ static void flash_sector_copy_ext_test_same_flash_full_sector (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-	}
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+	offset += FLASH_VERIFICATION_BLOCK;
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
-			MOCK_ARG (0x10000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
-			MOCK_ARG (FLASH_PAGE_SIZE));
-	}
+	offset += FLASH_VERIFICATION_BLOCK;
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status = flash_sector_copy_ext (&flash.base, 0x11000, &flash.base, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	offset += FLASH_VERIFICATION_BLOCK;
 
-	status = flash_mock_validate_and_release (&flash);
-	CuAssertIntEquals (test, 0, status);
-}
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-static void flash_sector_copy_ext_test_not_4k (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-	uint32_t bytes = 1024 * 2;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	offset += FLASH_VERIFICATION_BLOCK;
 
-	TEST_START;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	memset (blank, 0xff, sizeof (blank));
+	offset += FLASH_VERIFICATION_BLOCK;
 
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	offset = 0;
+	verify = 0;
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10800));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x10800), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x10800, &flash1.base, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = 256 * 2;
-	uint8_t data[page * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
-
-	TEST_START;
-
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
-	memset (blank, 0xff, sizeof (blank));
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	verify += FLASH_VERIFICATION_BLOCK;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	offset += page;
+	verify += FLASH_VERIFICATION_BLOCK;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	verify += FLASH_VERIFICATION_BLOCK;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset = 0;
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	offset += page;
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
 
 	offset += page;
+	verify += FLASH_VERIFICATION_BLOCK;
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 1,
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
 		MOCK_ARG (page - 1));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, (page * 3) - 1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash1);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_multiple_pages_page_offset (CuTest *test)
+static void flash_sector_copy_and_verify_test_multiple_pages_page_offset (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
@@ -11211,219 +10996,140 @@ static void flash_sector_copy_ext_test_multiple_pages_page_offset (CuTest *test)
 	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20010));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20010));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	offset += FLASH_VERIFICATION_BLOCK;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	offset += FLASH_VERIFICATION_BLOCK;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	offset = 0;
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 0x10,
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 0x10,
 		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
 		MOCK_ARG (page - 0x10));
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
 	offset += page - 0x10;
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
 	offset += page;
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
 	offset += page;
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 0x10,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, 0x10, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20010, &flash1.base, 0x10000, page * 3);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash1);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20010, 0x10000, page * 3);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_null (CuTest *test)
+static void flash_sector_copy_and_verify_test_null (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 
 	TEST_START;
 
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = flash_sector_copy_ext (NULL, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, NULL, 0x10000, 4);
+	status = flash_sector_copy_and_verify (NULL, 0x20000, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_no_length (CuTest *test)
+static void flash_sector_copy_and_verify_test_sector_check_error (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 
 	TEST_START;
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 0);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_sector_check_error (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-
-	TEST_START;
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2,
-		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
 
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_not_blank (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
-
-	TEST_START;
-
-	memset (blank, 0xff, sizeof (blank));
-	blank[sizeof (blank) - 1] = 0;
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (blank));
-	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_page_size_error (CuTest *test)
+static void flash_sector_copy_and_verify_test_page_size_error (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint8_t blank[4];
@@ -11432,42 +11138,36 @@ static void flash_sector_copy_ext_test_page_size_error (CuTest *test)
 
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, FLASH_PAGE_SIZE_FAILED,
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, FLASH_PAGE_SIZE_FAILED,
 		MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
 
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_and_verify_test_page_size_unsupported (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
@@ -11477,42 +11177,36 @@ static void flash_sector_copy_ext_test_page_size_unsupported (CuTest *test)
 
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
 
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_read_error (CuTest *test)
+static void flash_sector_copy_and_verify_test_read_error (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
@@ -11522,45 +11216,39 @@ static void flash_sector_copy_ext_test_read_error (CuTest *test)
 
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, FLASH_READ_FAILED,
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
 		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_write_error (CuTest *test)
+static void flash_sector_copy_and_verify_test_write_error (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
@@ -11571,49 +11259,43 @@ static void flash_sector_copy_ext_test_write_error (CuTest *test)
 
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
 		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
 
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_partial_write (CuTest *test)
+static void flash_sector_copy_and_verify_test_partial_write (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
@@ -11624,136 +11306,54 @@ static void flash_sector_copy_ext_test_partial_write (CuTest *test)
 
 	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash1);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
 		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
+	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 2,
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 2,
 		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
 		MOCK_ARG (sizeof (data) - 1));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x11fff, &flash1.base, 0x10000, sizeof (data));
+	status = flash_sector_copy_and_verify (&flash.base, 0x11fff, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
 
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_multiple_pages_error (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
-
-	TEST_START;
-
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memset (blank, 0xff, sizeof (blank));
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset = 0;
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	offset += page;
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		(page * 3) - 1);
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_same_flash_overlapping_regions (CuTest *test)
+static void flash_sector_copy_and_verify_test_overlapping_regions (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -11769,14 +11369,14 @@ static void flash_sector_copy_ext_test_same_flash_overlapping_regions (CuTest *t
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash.base, 0x11000, &flash.base, 0x10000, 0x1001);
+	status = flash_sector_copy_and_verify (&flash.base, 0x11000, 0x10000, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_same_flash_overlapping_regions_source_higher (CuTest *test)
+static void flash_sector_copy_and_verify_test_overlapping_regions_source_higher (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -11792,14 +11392,14 @@ static void flash_sector_copy_ext_test_same_flash_overlapping_regions_source_hig
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash.base, 0x10000, &flash.base, 0x11000, 0x1001);
+	status = flash_sector_copy_and_verify (&flash.base, 0x10000, 0x11000, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_same_flash_same_erase_block (CuTest *test)
+static void flash_sector_copy_and_verify_test_same_erase_block (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -11815,14 +11415,14 @@ static void flash_sector_copy_ext_test_same_flash_same_erase_block (CuTest *test
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash.base, 0x10100, &flash.base, 0x10000, 0x10);
+	status = flash_sector_copy_and_verify (&flash.base, 0x10100, 0x10000, 0x10);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_source_end (CuTest *test)
+static void flash_sector_copy_and_verify_test_same_erase_block_at_source_end (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -11838,14 +11438,14 @@ static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_source_end
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash.base, 0x10000, &flash.base, 0x11100, 0x1001);
+	status = flash_sector_copy_and_verify (&flash.base, 0x10000, 0x11100, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_destination_end (CuTest *test)
+static void flash_sector_copy_and_verify_test_same_erase_block_at_destination_end (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -11861,14 +11461,14 @@ static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_destinatio
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash.base, 0x11100, &flash.base, 0x10000, 0x1001);
+	status = flash_sector_copy_and_verify (&flash.base, 0x11100, 0x10000, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test (CuTest *test)
+static void flash_sector_copy_ext_test (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -11909,14 +11509,9 @@ static void flash_sector_copy_ext_and_verify_test (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
 		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		sizeof (data));
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -11926,7 +11521,7 @@ static void flash_sector_copy_ext_and_verify_test (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_address (CuTest *test)
+static void flash_sector_copy_ext_test_across_erase_blocks (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -11951,9 +11546,10 @@ static void flash_sector_copy_ext_and_verify_test_same_address (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
@@ -11961,80 +11557,25 @@ static void flash_sector_copy_ext_and_verify_test_same_address (CuTest *test)
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
 	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x10000, &flash1.base, 0x10000,
-		sizeof (data));
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_and_verify_test_mismatch (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
-
-	TEST_START;
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
+		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
 
-	memset (blank, 0xff, sizeof (blank));
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
 
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 1,
+		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
+		MOCK_ARG (sizeof (data) - 1));
 
-	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
+	status = flash_sector_copy_ext (&flash2.base, 0x11fff, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
-
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
@@ -12042,7 +11583,7 @@ static void flash_sector_copy_ext_and_verify_test_mismatch (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_multiple_pages_mismatch (CuTest *test)
+static void flash_sector_copy_ext_test_multiple_pages (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12101,10 +11642,6 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_mismatch (CuTes
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
-
 	offset += page;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
@@ -12114,15 +11651,21 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_mismatch (CuTes
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 1,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
+		MOCK_ARG (page - 1));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000,
 		(page * 3) - 1);
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -12131,7 +11674,7 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_mismatch (CuTes
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_full_sector (CuTest *test)
+static void flash_sector_copy_ext_test_full_sector (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12177,16 +11720,11 @@ static void flash_sector_copy_ext_and_verify_test_full_sector (CuTest *test)
 		status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_PAGE_SIZE,
 			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
 			MOCK_ARG (FLASH_PAGE_SIZE));
-
-		status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
 	}
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x11000, &flash1.base, 0x10000,
-		sizeof (data));
+	status = flash_sector_copy_ext (&flash2.base, 0x11000, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12196,12 +11734,12 @@ static void flash_sector_copy_ext_and_verify_test_full_sector (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_not_4k (CuTest *test)
+static void flash_sector_copy_ext_test_source_same_address (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
-	uint32_t bytes = 1024 * 2;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t blank[sizeof (data)];
@@ -12221,9 +11759,9 @@ static void flash_sector_copy_ext_and_verify_test_not_4k (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10800));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
@@ -12235,16 +11773,118 @@ static void flash_sector_copy_ext_and_verify_test_not_4k (CuTest *test)
 	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x10800), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+	CuAssertIntEquals (test, 0, status);
 
+	status = flash_sector_copy_ext (&flash2.base, 0x10000, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x10800, &flash1.base, 0x10000,
-		sizeof (data));
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_same_flash_full_sector (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[FLASH_SECTOR_SIZE];
+	uint8_t blank[sizeof (data)];
+	int offset;
+
+	TEST_START;
+
+	memset (data, 0x55, sizeof (data));
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	}
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+			MOCK_ARG (0x10000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
+			MOCK_ARG (FLASH_PAGE_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash.base, 0x11000, &flash.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_not_4k (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = 1024 * 2;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10800));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x10800), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x10800, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12254,7 +11894,7 @@ static void flash_sector_copy_ext_and_verify_test_not_4k (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (CuTest *test)
+static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12264,7 +11904,6 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (C
 	uint8_t data[page * 3];
 	uint8_t blank[FLASH_VERIFICATION_BLOCK];
 	int offset = 0;
-	int verify;
 
 	TEST_START;
 
@@ -12322,7 +11961,6 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (C
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
 	offset = 0;
-	verify = 0;
 
 	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
@@ -12334,18 +11972,7 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (C
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
-
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
-
 	offset += page;
-	verify += FLASH_VERIFICATION_BLOCK;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
@@ -12354,18 +11981,7 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (C
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
-
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
-
 	offset += page;
-	verify += FLASH_VERIFICATION_BLOCK;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
@@ -12375,20 +11991,9 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (C
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
 		MOCK_ARG (page - 1));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
-
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		(page * 3) - 1);
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, (page * 3) - 1);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12398,7 +12003,7 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (C
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (CuTest *test)
+static void flash_sector_copy_ext_test_multiple_pages_page_offset (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12458,10 +12063,6 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (Cu
 		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
 		MOCK_ARG (page - 0x10));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
-	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
-
 	offset += page - 0x10;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
@@ -12471,10 +12072,6 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (Cu
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
-
 	offset += page;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
@@ -12484,10 +12081,6 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (Cu
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
-
 	offset += page;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
@@ -12497,14 +12090,9 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (Cu
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 0x10,
 		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20010, &flash1.base, 0x10000,
-		page * 3);
+	status = flash_sector_copy_ext (&flash2.base, 0x20010, &flash1.base, 0x10000, page * 3);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12514,7 +12102,7 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (Cu
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_null (CuTest *test)
+static void flash_sector_copy_ext_test_null (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12530,10 +12118,10 @@ static void flash_sector_copy_ext_and_verify_test_null (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 	flash2.mock.name = "flash2";
 
-	status = flash_sector_copy_ext_and_verify (NULL, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_ext (NULL, 0x20000, &flash1.base, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, NULL, 0x10000, 4);
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, NULL, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12543,7 +12131,33 @@ static void flash_sector_copy_ext_and_verify_test_null (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_sector_check_error (CuTest *test)
+static void flash_sector_copy_ext_test_no_length (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_sector_check_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12564,7 +12178,7 @@ static void flash_sector_copy_ext_and_verify_test_sector_check_error (CuTest *te
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12574,7 +12188,7 @@ static void flash_sector_copy_ext_and_verify_test_sector_check_error (CuTest *te
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_not_blank (CuTest *test)
+static void flash_sector_copy_ext_test_not_blank (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12606,8 +12220,7 @@ static void flash_sector_copy_ext_and_verify_test_not_blank (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		sizeof (blank));
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (blank));
 	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12617,7 +12230,7 @@ static void flash_sector_copy_ext_and_verify_test_not_blank (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_page_size_error (CuTest *test)
+static void flash_sector_copy_ext_test_page_size_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12651,7 +12264,7 @@ static void flash_sector_copy_ext_and_verify_test_page_size_error (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12661,7 +12274,7 @@ static void flash_sector_copy_ext_and_verify_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_ext_test_page_size_unsupported (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12696,7 +12309,7 @@ static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12706,7 +12319,7 @@ static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_read_error (CuTest *test)
+static void flash_sector_copy_ext_test_read_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12744,7 +12357,7 @@ static void flash_sector_copy_ext_and_verify_test_read_error (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
 	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12754,7 +12367,7 @@ static void flash_sector_copy_ext_and_verify_test_read_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_write_error (CuTest *test)
+static void flash_sector_copy_ext_test_write_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12797,8 +12410,7 @@ static void flash_sector_copy_ext_and_verify_test_write_error (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		sizeof (data));
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12808,7 +12420,7 @@ static void flash_sector_copy_ext_and_verify_test_write_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
+static void flash_sector_copy_ext_test_partial_write (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12850,10 +12462,6 @@ static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
 		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
-
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
 	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
@@ -12864,8 +12472,7 @@ static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x11fff, &flash1.base, 0x10000,
-		sizeof (data));
+	status = flash_sector_copy_ext (&flash2.base, 0x11fff, &flash1.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12875,31 +12482,88 @@ static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_overlapping_regions (CuTest *test)
+static void flash_sector_copy_ext_test_multiple_pages_error (CuTest *test)
 {
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
 
 	TEST_START;
 
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memset (blank, 0xff, sizeof (blank));
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x11000, &flash.base, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = flash_mock_validate_and_release (&flash);
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		(page * 3) - 1);
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_overlapping_source_higher (
-	CuTest *test)
+static void flash_sector_copy_ext_test_same_flash_overlapping_regions (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -12915,14 +12579,14 @@ static void flash_sector_copy_ext_and_verify_test_same_flash_overlapping_source_
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10000, &flash.base, 0x11000, 0x1001);
+	status = flash_sector_copy_ext (&flash.base, 0x11000, &flash.base, 0x10000, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block (CuTest *test)
+static void flash_sector_copy_ext_test_same_flash_overlapping_regions_source_higher (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -12938,15 +12602,14 @@ static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block (C
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10100, &flash.base, 0x10000, 0x10);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = flash_sector_copy_ext (&flash.base, 0x10000, &flash.base, 0x11000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_source_end (
-	CuTest *test)
+static void flash_sector_copy_ext_test_same_flash_same_erase_block (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -12962,15 +12625,14 @@ static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10000, &flash.base, 0x11100, 0x1001);
+	status = flash_sector_copy_ext (&flash.base, 0x10100, &flash.base, 0x10000, 0x10);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_destination_end (
-	CuTest *test)
+static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_source_end (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -12986,184 +12648,1955 @@ static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x11100, &flash.base, 0x10000, 0x1001);
+	status = flash_sector_copy_ext (&flash.base, 0x10000, &flash.base, 0x11100, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_contents_verification_test_sha256 (CuTest *test)
+static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_destination_end (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	char *data = "Test";
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = signature_verification_mock_init (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
-
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
-		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
-		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_copy_ext (&flash.base, 0x11100, &flash.base, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
-
-	status = signature_verification_mock_validate_and_release (&verification);
-	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_contents_verification_test_sha256_with_hash_out (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
+	memset (blank, 0xff, sizeof (blank));
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
-		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
-		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
-		sizeof (hash_out));
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_contents_verification_test_sha256_no_match_signature (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_same_address (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	char *data = "Test";
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
+	memset (blank, 0xff, sizeof (blank));
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
-		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
-		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
-		MOCK_ARG (RSA_ENCRYPT_LEN));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10000));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
 
-	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x10000, &flash1.base, 0x10000,
+		sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_contents_verification_test_sha256_no_match_signature_with_hash_out (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_mismatch (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
+	memset (blank, 0xff, sizeof (blank));
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_multiple_pages_mismatch (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+
+	TEST_START;
+
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		(page * 3) - 1);
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_full_sector (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[FLASH_SECTOR_SIZE];
+	uint8_t blank[sizeof (data)];
+	int offset;
+
+	TEST_START;
+
+	memset (data, 0x55, sizeof (data));
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11000));
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
+		status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	}
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
+		status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0,
+			MOCK_ARG (0x10000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+		status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_PAGE_SIZE,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
+			MOCK_ARG (FLASH_PAGE_SIZE));
+
+		status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x11000, &flash1.base, 0x10000,
+		sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_not_4k (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = 1024 * 2;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10800));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x10800), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x10800, &flash1.base, 0x10000,
+		sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = 256 * 2;
+	uint8_t data[page * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+	int verify;
+
+	TEST_START;
+
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+	verify = 0;
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	offset += page;
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	offset += page;
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 1,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
+		MOCK_ARG (page - 1));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		(page * 3) - 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+
+	TEST_START;
+
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20010));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 0x10,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
+		MOCK_ARG (page - 0x10));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
+	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	offset += page - 0x10;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 0x10,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20010, &flash1.base, 0x10000,
+		page * 3);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_null (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = flash_sector_copy_ext_and_verify (NULL, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, NULL, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_sector_check_error (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_not_blank (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+	blank[sizeof (blank) - 1] = 0;
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (blank));
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_page_size_error (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, FLASH_PAGE_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_read_error (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_write_error (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data));
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
+		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 2,
+		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
+		MOCK_ARG (sizeof (data) - 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x11fff, &flash1.base, 0x10000,
+		sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_same_flash_overlapping_regions (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x11000, &flash.base, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_same_flash_overlapping_source_higher (
+	CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10000, &flash.base, 0x11000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10100, &flash.base, 0x10000, 0x10);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_source_end (
+	CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10000, &flash.base, 0x11100, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_destination_end (
+	CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x11100, &flash.base, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_contents_verification_test_sha256 (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
+		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_contents_verification_test_sha256_with_hash_out (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
+		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_contents_verification_test_sha256_no_match_signature (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
+		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
+		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
+		MOCK_ARG (RSA_ENCRYPT_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_contents_verification_test_sha256_no_match_signature_with_hash_out (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
+		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
+		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
+		MOCK_ARG (RSA_ENCRYPT_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	memset (hash_out, 0, sizeof (hash_out));
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_contents_verification_test_sha256_no_match_signature_ecc_with_hash_out (
+	CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
+		ECC_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
+		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN),
+		MOCK_ARG (ECC_SIG_NOPE_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	memset (hash_out, 0, sizeof (hash_out));
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, ECC_ENGINE_BAD_SIGNATURE, status);
+
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_contents_verification_test_sha1 (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA1, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_SIG_HASH, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_contents_verification_test_unknown (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		(enum hash_type) 10, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_UNKNOWN_SIG_HASH, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_contents_verification_test_null (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_contents_verification (NULL, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, 0, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), NULL,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, NULL, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, NULL, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, 0, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_contents_verification_test_small_hash_buffer (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	uint8_t hash_out[SHA256_HASH_LENGTH - 1];
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, FLASH_UTIL_HASH_BUFFER_TOO_SMALL, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_contents_verification_test_read_error_with_hash_out (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint8_t empty[sizeof (hash_out)] = {0};
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x4321), MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	memcpy (hash_out, empty, sizeof (hash_out));
+
+	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = testing_validate_array (empty, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_noncontiguous_contents_verification_test_sha256 (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
+		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_noncontiguous_contents_verification_test_sha256_with_hash_out (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
+		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_noncontiguous_contents_verification_test_sha256_no_match_signature (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
+		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
+		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
+		MOCK_ARG (RSA_ENCRYPT_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_noncontiguous_contents_verification_test_sha256_no_match_signature_with_hash_out (
+	CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
 		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
 		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
 		MOCK_ARG (RSA_ENCRYPT_LEN));
 
 	CuAssertIntEquals (test, 0, status);
 
-	memset (hash_out, 0, sizeof (hash_out));
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+	memset (hash_out, 0, sizeof (hash_out));
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_noncontiguous_contents_verification_test_sha256_no_match_signature_ecc_with_hash_out (
+	CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
+		ECC_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
+		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN),
+		MOCK_ARG (ECC_SIG_NOPE_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+	memset (hash_out, 0, sizeof (hash_out));
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, ECC_ENGINE_BAD_SIGNATURE, status);
+
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_noncontiguous_contents_verification_test_sha1 (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA1, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_SIG_HASH, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_noncontiguous_contents_verification_test_unknown (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		(enum hash_type) 10, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_UNKNOWN_SIG_HASH, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_noncontiguous_contents_verification_test_multiple_regions (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions[2];
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, hash_out,
-		sizeof (hash_out));
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x8765),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (3));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
+		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	regions[0].start_addr = 0x4321;
+	regions[0].length = 1;
+
+	regions[1].start_addr = 0x8765;
+	regions[1].length = 3;
+
+	status = flash_noncontiguous_contents_verification (&flash.base, regions, 2, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
@@ -13175,15 +14608,14 @@ static void flash_contents_verification_test_sha256_no_match_signature_with_hash
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_contents_verification_test_sha256_no_match_signature_ecc_with_hash_out (
-	CuTest *test)
+static void flash_noncontiguous_contents_verification_test_null (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct signature_verification_mock verification;
 	struct flash_mock flash;
+	struct flash_region regions;
 	int status;
 	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
@@ -13196,26 +14628,36 @@ static void flash_contents_verification_test_sha256_no_match_signature_ecc_with_
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
-		ECC_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
-		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN),
-		MOCK_ARG (ECC_SIG_NOPE_LEN));
+	status = flash_noncontiguous_contents_verification (NULL, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	CuAssertIntEquals (test, 0, status);
+	status = flash_noncontiguous_contents_verification (&flash.base, NULL, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	memset (hash_out, 0, sizeof (hash_out));
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 0, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN, hash_out,
-		sizeof (hash_out));
-	CuAssertIntEquals (test, ECC_ENGINE_BAD_SIGNATURE, status);
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, NULL,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, NULL, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, NULL, RSA_ENCRYPT_LEN, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, 0, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -13226,11 +14668,13 @@ static void flash_contents_verification_test_sha256_no_match_signature_ecc_with_
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_contents_verification_test_sha1 (CuTest *test)
+static void flash_noncontiguous_contents_verification_test_hash_buffer_too_small (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct signature_verification_mock verification;
 	struct flash_mock flash;
+	struct flash_region regions;
+	uint8_t hash_out[SHA256_HASH_LENGTH - 1];
 	int status;
 	char *data = "Test";
 
@@ -13245,9 +14689,13 @@ static void flash_contents_verification_test_sha1 (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA1, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_SIG_HASH, status);
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, FLASH_UTIL_HASH_BUFFER_TOO_SMALL, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -13258,13 +14706,16 @@ static void flash_contents_verification_test_sha1 (CuTest *test)
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_contents_verification_test_unknown (CuTest *test)
+static void flash_noncontiguous_contents_verification_test_read_error_with_hash_out (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
+	struct flash_region regions;
 	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint8_t empty[sizeof (hash_out)] = {0};
 
 	TEST_START;
 
@@ -13277,9 +14728,22 @@ static void flash_contents_verification_test_unknown (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		(enum hash_type) 10, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_UNKNOWN_SIG_HASH, status);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x4321), MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+	memcpy (hash_out, empty, sizeof (hash_out));
+
+	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
+		sizeof (hash_out));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = testing_validate_array (empty, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -13290,468 +14754,589 @@ static void flash_contents_verification_test_unknown (CuTest *test)
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_contents_verification_test_null (CuTest *test)
+static void flash_hash_noncontiguous_contents_at_offset_test_sha256 (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	char *data = "Test";
+	struct flash_region regions;
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x1122;
+	regions.length = 4;
+
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_hash_noncontiguous_contents_at_offset_test_sha1 (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x71,0x10,0xed,0xa4,0xd0,0x9e,0x06,0x2a,0xa5,0xe4,0xa3,0x90,0xb0,0xa5,0x72,0xac,
+		0x0d,0x2c,0x02,0x20
+	};
+	uint8_t hash_actual[SHA1_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_contents_verification (NULL, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x612345),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status = flash_contents_verification (&flash.base, 0x4321, 0, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), NULL,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	regions.start_addr = 0x12345;
+	regions.length = 4;
+
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x600000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA1, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_hash_noncontiguous_contents_at_offset_test_unknown (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x1122;
+	regions.length = 4;
+
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x10000, &regions, 1,
+		&hash.base, (enum hash_type) 10, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, HASH_ENGINE_UNKNOWN_HASH, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_hash_noncontiguous_contents_at_offset_test_multiple_blocks (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+	uint8_t hash_expected[] = {
+		0x66,0x74,0x48,0xad,0x7b,0x51,0x35,0xd0,0xbc,0xbf,0xb4,0xbd,0x15,0x6f,0x5b,0x9b,
+		0x64,0xa0,0xd8,0xab,0x68,0x71,0xa7,0xb8,0x2a,0x8c,0x68,0x0c,0x46,0xb8,0xe4,0x62
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41222),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41322),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (16));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_NOPE, RSA_ENCRYPT_LEN, 2);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, NULL, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, NULL, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	regions.start_addr = 0x1122;
+	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, 0, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x40000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_contents_verification_test_small_hash_buffer (CuTest *test)
+static void flash_hash_noncontiguous_contents_at_offset_test_multiple_regions (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
-	uint8_t hash_out[SHA256_HASH_LENGTH - 1];
 	int status;
-	char *data = "Test";
+	struct flash_region regions[3];
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x71122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x73344),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (2));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x75566),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data + 3, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
-		sizeof (hash_out));
-	CuAssertIntEquals (test, FLASH_UTIL_HASH_BUFFER_TOO_SMALL, status);
+	regions[0].start_addr = 0x1122;
+	regions[0].length = 1;
 
-	status = flash_mock_validate_and_release (&flash);
+	regions[1].start_addr = 0x3344;
+	regions[1].length = 2;
+
+	regions[2].start_addr = 0x5566;
+	regions[2].length = 1;
+
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x70000, regions, 3,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_contents_verification_test_read_error_with_hash_out (CuTest *test)
+static void flash_hash_noncontiguous_contents_at_offset_test_no_offset (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
-	uint8_t empty[sizeof (hash_out)] = {0};
+	struct flash_region regions;
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x4321), MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	memcpy (hash_out, empty, sizeof (hash_out));
-
-	status = flash_contents_verification (&flash.base, 0x4321, strlen (data), &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
-		sizeof (hash_out));
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status = testing_validate_array (empty, hash_out, sizeof (hash_out));
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_test_sha256 (CuTest *test)
+static void flash_hash_noncontiguous_contents_at_offset_test_null (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	char *data = "Test";
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
-		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
-		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+	status = flash_hash_noncontiguous_contents_at_offset (NULL, 0x30000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	CuAssertIntEquals (test, 0, status);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, NULL, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 0,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		NULL, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_mock_validate_and_release (&flash);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, NULL, sizeof (hash_actual));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_test_sha256_with_hash_out (CuTest *test)
+static void flash_hash_noncontiguous_contents_at_offset_test_read_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = signature_verification_mock_init (&verification);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
-
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
-		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
-		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x31122), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
-		sizeof (hash_out));
 	CuAssertIntEquals (test, 0, status);
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
-	CuAssertIntEquals (test, 0, status);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
+
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash_mock_validate_and_release (&hash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_test_sha256_no_match_signature (CuTest *test)
+static void flash_hash_noncontiguous_contents_at_offset_test_multiple_blocks_read_error (
+	CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	char *data = "Test";
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = signature_verification_mock_init (&verification);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
-		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
-		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
-		MOCK_ARG (RSA_ENCRYPT_LEN));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
+
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RSA_ENCRYPT_TEST, FLASH_VERIFICATION_BLOCK),
+		MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x31222), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+
+	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	regions.start_addr = 0x1122;
+	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash_mock_validate_and_release (&hash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_test_sha256_no_match_signature_with_hash_out (
+static void flash_hash_noncontiguous_contents_at_offset_test_multiple_regions_read_error (
 	CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
+	struct flash_region regions[3];
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x71122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0, MOCK_ARG_PTR_CONTAINS (data, 1),
+		MOCK_ARG (1));
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x73344), MOCK_ARG_NOT_NULL, MOCK_ARG (2));
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
-		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
-		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
-		MOCK_ARG (RSA_ENCRYPT_LEN));
+	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
-	memset (hash_out, 0, sizeof (hash_out));
+	regions[0].start_addr = 0x1122;
+	regions[0].length = 1;
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, hash_out,
-		sizeof (hash_out));
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	regions[1].start_addr = 0x3344;
+	regions[1].length = 2;
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
-	CuAssertIntEquals (test, 0, status);
+	regions[2].start_addr = 0x5566;
+	regions[2].length = 1;
+
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x70000, regions, 3,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash_mock_validate_and_release (&hash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_test_sha256_no_match_signature_ecc_with_hash_out (
-	CuTest *test)
+static void flash_hash_noncontiguous_contents_at_offset_test_hash_start_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = signature_verification_mock_init (&verification);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
-
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
-		ECC_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
-		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN),
-		MOCK_ARG (ECC_SIG_NOPE_LEN));
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash,
+		HASH_ENGINE_START_SHA256_FAILED);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
-	memset (hash_out, 0, sizeof (hash_out));
-
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN, hash_out,
-		sizeof (hash_out));
-	CuAssertIntEquals (test, ECC_ENGINE_BAD_SIGNATURE, status);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, HASH_ENGINE_START_SHA256_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash_mock_validate_and_release (&hash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_test_sha1 (CuTest *test)
+static void flash_hash_noncontiguous_contents_at_offset_test_hash_update_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	char *data = "Test";
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, HASH_ENGINE_UPDATE_FAILED,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA1, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_SIG_HASH, status);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, HASH_ENGINE_UPDATE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash_mock_validate_and_release (&hash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_test_unknown (CuTest *test)
+static void flash_hash_noncontiguous_contents_at_offset_test_hash_finish_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	char *data = "Test";
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0, MOCK_ARG_NOT_NULL,
+		MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&hash.mock, hash.base.finish, &hash, HASH_ENGINE_FINISH_FAILED,
+		MOCK_ARG (hash_actual), MOCK_ARG (SHA256_HASH_LENGTH));
+	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		(enum hash_type) 10, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_UNKNOWN_SIG_HASH, status);
+	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, HASH_ENGINE_FINISH_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash_mock_validate_and_release (&hash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_test_multiple_regions (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_sha256 (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions[2];
+	struct flash_region regions;
 	char *data = "Test";
 
 	TEST_START;
@@ -13759,113 +15344,86 @@ static void flash_noncontiguous_contents_verification_test_multiple_regions (CuT
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
 	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x8765),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (3));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, strlen (data), 2);
-
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
-		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
-		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
-
 	CuAssertIntEquals (test, 0, status);
 
-	regions[0].start_addr = 0x4321;
-	regions[0].length = 1;
-
-	regions[1].start_addr = 0x8765;
-	regions[1].length = 3;
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status = flash_noncontiguous_contents_verification (&flash.base, regions, 2, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_noncontiguous_contents_verification_test_null (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_sha256_with_hash_out (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
-	struct flash_region regions;
 	int status;
+	struct flash_region regions;
 	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
-
-	status = flash_noncontiguous_contents_verification (NULL, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_noncontiguous_contents_verification (&flash.base, NULL, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 0, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, NULL,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, NULL, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, NULL, RSA_ENCRYPT_LEN, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, 0, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_noncontiguous_contents_verification_test_hash_buffer_too_small (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_sha256_no_match_signature (
+	CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
-	struct flash_region regions;
-	uint8_t hash_out[SHA256_HASH_LENGTH - 1];
 	int status;
+	struct flash_region regions;
 	char *data = "Test";
 
 	TEST_START;
@@ -13873,657 +15431,688 @@ static void flash_noncontiguous_contents_verification_test_hash_buffer_too_small
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
 	regions.start_addr = 0x4321;
 	regions.length = strlen (data);
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
-		sizeof (hash_out));
-	CuAssertIntEquals (test, FLASH_UTIL_HASH_BUFFER_TOO_SMALL, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_noncontiguous_contents_verification_test_read_error_with_hash_out (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_sha256_no_match_signature_with_hash_out (
+	CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
 	char *data = "Test";
 	uint8_t hash_out[SHA256_HASH_LENGTH];
-	uint8_t empty[sizeof (hash_out)] = {0};
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x4321), MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
 	regions.start_addr = 0x4321;
 	regions.length = strlen (data);
-	memcpy (hash_out, empty, sizeof (hash_out));
+	memset (hash_out, 0, sizeof (hash_out));
 
-	status = flash_noncontiguous_contents_verification (&flash.base, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, hash_out,
-		sizeof (hash_out));
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
-	status = testing_validate_array (empty, hash_out, sizeof (hash_out));
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_sha256 (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_sha1 (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_expected[] = {
-		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
-		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
-	};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	char *data = "Test";
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
-
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, 0, status);
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA1, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, &RSA_PUBLIC_KEY,
+		NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_SIG_HASH, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_sha1 (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_unknown (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_expected[] = {
-		0x71,0x10,0xed,0xa4,0xd0,0x9e,0x06,0x2a,0xa5,0xe4,0xa3,0x90,0xb0,0xa5,0x72,0xac,
-		0x0d,0x2c,0x02,0x20
-	};
-	uint8_t hash_actual[SHA1_HASH_LENGTH];
+	char *data = "Test";
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x612345),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x12345;
-	regions.length = 4;
-
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x600000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA1, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, 0, status);
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, (enum hash_type) 10, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_UNKNOWN_SIG_HASH, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_unknown (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_multiple_regions (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	struct flash_region regions[2];
+	char *data = "Test";
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x94321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x10000, &regions, 1,
-		&hash.base, (enum hash_type) 10, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, HASH_ENGINE_UNKNOWN_HASH, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x98765),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (3));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, strlen (data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	regions[0].start_addr = 0x4321;
+	regions[0].length = 1;
+
+	regions[1].start_addr = 0x8765;
+	regions[1].length = 3;
+
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x90000, regions, 2,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_multiple_blocks (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_no_offset (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t hash_expected[] = {
-		0x66,0x74,0x48,0xad,0x7b,0x51,0x35,0xd0,0xbc,0xbf,0xb4,0xbd,0x15,0x6f,0x5b,0x9b,
-		0x64,0xa0,0xd8,0xab,0x68,0x71,0xa7,0xb8,0x2a,0x8c,0x68,0x0c,0x46,0xb8,0xe4,0x62
-	};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	char *data = "Test";
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41222),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41322),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (16));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_NOPE, RSA_ENCRYPT_LEN, 2);
-
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x40000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0, &regions, 1, &hash.base,
+		HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, &RSA_PUBLIC_KEY, NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_multiple_regions (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_null (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
+	struct flash_region regions;
 	int status;
-	struct flash_region regions[3];
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_expected[] = {
-		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
-		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
-	};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	char *data = "Test";
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x71122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x73344),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (2));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data), 2);
+	status = flash_verify_noncontiguous_contents_at_offset (NULL, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x75566),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data + 3, sizeof (data), 2);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, NULL, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	CuAssertIntEquals (test, 0, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 0,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	regions[0].start_addr = 0x1122;
-	regions[0].length = 1;
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		NULL, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	regions[1].start_addr = 0x3344;
-	regions[1].length = 2;
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, NULL, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	regions[2].start_addr = 0x5566;
-	regions[2].length = 1;
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, NULL, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x70000, regions, 3,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, 0,
+		&RSA_PUBLIC_KEY, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		NULL, NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_no_offset (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_hash_buffer_too_small (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
-	int status;
 	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_expected[] = {
-		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
-		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
-	};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	uint8_t hash_out[SHA256_HASH_LENGTH - 1];
+	int status;
+	char *data = "Test";
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
-
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, 0, status);
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, FLASH_UTIL_HASH_BUFFER_TOO_SMALL, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_null (CuTest *test)
+static void flash_verify_noncontiguous_contents_at_offset_test_read_error_with_hash_out (
+	CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint8_t empty[sizeof (hash_out)] = {0};
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
-
-	status = flash_hash_noncontiguous_contents_at_offset (NULL, 0x30000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, NULL, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x54321), MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 0,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		NULL, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+	memcpy (hash_out, empty, sizeof (hash_out));
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, NULL, sizeof (hash_actual));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		&RSA_PUBLIC_KEY, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = testing_validate_array (empty, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_read_error (CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_sha256 (CuTest *test)
 {
-	struct hash_engine_mock hash;
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	char *data = "Test";
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x31122), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
+		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = signature_verification_mock_validate_and_release (&verification);
 	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_multiple_blocks_read_error (
+static void flash_noncontiguous_contents_verification_at_offset_test_sha256_with_hash_out (
 	CuTest *test)
 {
-	struct hash_engine_mock hash;
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
-		MOCK_ARG_PTR_CONTAINS (RSA_ENCRYPT_TEST, FLASH_VERIFICATION_BLOCK),
-		MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
+		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x31222), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		hash_out, sizeof (hash_out));
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
-
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = signature_verification_mock_validate_and_release (&verification);
 	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_multiple_regions_read_error (
+static void flash_noncontiguous_contents_verification_at_offset_test_sha256_no_match_signature (
 	CuTest *test)
 {
-	struct hash_engine_mock hash;
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions[3];
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	struct flash_region regions;
+	char *data = "Test";
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x71122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0, MOCK_ARG_PTR_CONTAINS (data, 1),
-		MOCK_ARG (1));
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x73344), MOCK_ARG_NOT_NULL, MOCK_ARG (2));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
+		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
+		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
+		MOCK_ARG (RSA_ENCRYPT_LEN));
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions[0].start_addr = 0x1122;
-	regions[0].length = 1;
-
-	regions[1].start_addr = 0x3344;
-	regions[1].length = 2;
-
-	regions[2].start_addr = 0x5566;
-	regions[2].length = 1;
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x70000, regions, 3,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = signature_verification_mock_validate_and_release (&verification);
 	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_hash_start_error (CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_sha256_no_match_signature_with_hash_out (
+	CuTest *test)
 {
-	struct hash_engine_mock hash;
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash,
-		HASH_ENGINE_START_SHA256_FAILED);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
+		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
+		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
+		MOCK_ARG (RSA_ENCRYPT_LEN));
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+	memset (hash_out, 0, sizeof (hash_out));
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, HASH_ENGINE_START_SHA256_FAILED, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN,
+		hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = signature_verification_mock_validate_and_release (&verification);
 	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_hash_update_error (CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_sha256_no_match_signature_ecc_with_hash_out (
+	CuTest *test)
 {
-	struct hash_engine_mock hash;
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	status |= mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, HASH_ENGINE_UPDATE_FAILED,
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
+		ECC_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
+		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN),
+		MOCK_ARG (ECC_SIG_NOPE_LEN));
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
+	memset (hash_out, 0, sizeof (hash_out));
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, HASH_ENGINE_UPDATE_FAILED, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN,
+		hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, ECC_ENGINE_BAD_SIGNATURE, status);
+
+	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = signature_verification_mock_validate_and_release (&verification);
 	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_noncontiguous_contents_at_offset_test_hash_finish_error (CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_sha1 (CuTest *test)
 {
-	struct hash_engine_mock hash;
+	HASH_TESTING_ENGINE hash;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	char *data = "Test";
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&hash.mock, hash.base.start_sha256, &hash, 0);
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0, MOCK_ARG_NOT_NULL,
-		MOCK_ARG (sizeof (data)));
-	status |= mock_expect (&hash.mock, hash.base.finish, &hash, HASH_ENGINE_FINISH_FAILED,
-		MOCK_ARG (hash_actual), MOCK_ARG (SHA256_HASH_LENGTH));
-	status |= mock_expect (&hash.mock, hash.base.cancel, &hash, 0);
-
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+	regions.start_addr = 0x4321;
+	regions.length = strlen (data);
 
-	status = flash_hash_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, HASH_ENGINE_FINISH_FAILED, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA1, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_SIG_HASH, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = signature_verification_mock_validate_and_release (&verification);
 	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_sha256 (CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_unknown (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
@@ -14534,83 +16123,87 @@ static void flash_verify_noncontiguous_contents_at_offset_test_sha256 (CuTest *t
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
-
-	CuAssertIntEquals (test, 0, status);
-
 	regions.start_addr = 0x4321;
 	regions.length = strlen (data);
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, (enum hash_type) 10, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		NULL, 0);
+	CuAssertIntEquals (test, FLASH_UTIL_UNKNOWN_SIG_HASH, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
 	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_sha256_with_hash_out (CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_multiple_regions (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
+	struct flash_region regions[2];
 	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x94321),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
 	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x98765),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (3));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, strlen (data), 2);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
+		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, hash_out, sizeof (hash_out));
 	CuAssertIntEquals (test, 0, status);
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	regions[0].start_addr = 0x4321;
+	regions[0].length = 1;
+
+	regions[1].start_addr = 0x8765;
+	regions[1].length = 3;
+
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x90000, regions, 2,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
+		0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
 	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_sha256_no_match_signature (
-	CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_no_offset (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
@@ -14621,87 +16214,115 @@ static void flash_verify_noncontiguous_contents_at_offset_test_sha256_no_match_s
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
 	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
 
+	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
+		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+
 	CuAssertIntEquals (test, 0, status);
 
 	regions.start_addr = 0x4321;
 	regions.length = strlen (data);
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
 	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_sha256_no_match_signature_with_hash_out (
-	CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_null (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
-	int status;
 	struct flash_region regions;
+	int status;
 	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
-
-	CuAssertIntEquals (test, 0, status);
-
 	regions.start_addr = 0x4321;
 	regions.length = strlen (data);
-	memset (hash_out, 0, sizeof (hash_out));
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, hash_out, sizeof (hash_out));
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	status = flash_noncontiguous_contents_verification_at_offset (NULL, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, NULL, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 0,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		NULL, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, NULL, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, NULL, RSA_ENCRYPT_LEN, NULL,
+		0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, 0, NULL,
+		0);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
 	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_sha1 (CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_hash_buffer_too_small (
+	CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
-	int status;
 	struct flash_region regions;
+	uint8_t hash_out[SHA256_HASH_LENGTH - 1];
+	int status;
 	char *data = "Test";
 
 	TEST_START;
@@ -14709,7 +16330,7 @@ static void flash_verify_noncontiguous_contents_at_offset_test_sha1 (CuTest *tes
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
@@ -14718,1037 +16339,1069 @@ static void flash_verify_noncontiguous_contents_at_offset_test_sha1 (CuTest *tes
 	regions.start_addr = 0x4321;
 	regions.length = strlen (data);
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA1, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, &RSA_PUBLIC_KEY,
-		NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_SIG_HASH, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, FLASH_UTIL_HASH_BUFFER_TOO_SMALL, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
 	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_unknown (CuTest *test)
+static void flash_noncontiguous_contents_verification_at_offset_test_read_error_with_hash_out (
+	CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
 	char *data = "Test";
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint8_t empty[sizeof (hash_out)] = {0};
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	status = signature_verification_mock_init (&verification);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
+	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x54321), MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
 	regions.start_addr = 0x4321;
 	regions.length = strlen (data);
+	memcpy (hash_out, empty, sizeof (hash_out));
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, (enum hash_type) 10, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_UNKNOWN_SIG_HASH, status);
+	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
+		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
+		hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = testing_validate_array (empty, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
+	status = signature_verification_mock_validate_and_release (&verification);
+	CuAssertIntEquals (test, 0, status);
+
 	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_multiple_regions (CuTest *test)
+static void flash_write_and_verify_test (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions[2];
-	char *data = "Test";
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	status = mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = flash_write_and_verify (&flash.base, 0x10000, data, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x94321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x98765),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (3));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, strlen (data), 2);
+static void flash_write_and_verify_test_mismatch (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t check[] = {0x01, 0x02, 0x13, 0x04};
 
+	TEST_START;
+
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions[0].start_addr = 0x4321;
-	regions[0].length = 1;
+	status = mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	regions[1].start_addr = 0x8765;
-	regions[1].length = 3;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, check, sizeof (check), 2);
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x90000, regions, 2,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_write_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_no_offset (CuTest *test)
+static void flash_write_and_verify_test_null (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	char *data = "Test";
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_write_and_verify (NULL, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_mock_init (&flash);
+	status = flash_write_and_verify (&flash.base, 0x10000, NULL, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
+}
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+static void flash_write_and_verify_test_write_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
+	TEST_START;
+
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status = mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0, &regions, 1, &hash.base,
-		HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, &RSA_PUBLIC_KEY, NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_write_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_null (CuTest *test)
+static void flash_write_and_verify_test_incomplete_write (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
-	struct flash_region regions;
 	int status;
-	char *data = "Test";
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
+	status = mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
+		MOCK_ARG (0x100fe), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status = flash_write_and_verify (&flash.base, 0x100fe, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
 
-	status = flash_verify_noncontiguous_contents_at_offset (NULL, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, NULL, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+static void flash_write_and_verify_test_verify_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 0,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	TEST_START;
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		NULL, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, NULL, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, NULL, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, 0,
-		&RSA_PUBLIC_KEY, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		NULL, NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = flash_write_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_hash_buffer_too_small (CuTest *test)
+static void flash_hash_update_contents_test_sha256 (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
-	struct flash_region regions;
-	uint8_t hash_out[SHA256_HASH_LENGTH - 1];
 	int status;
-	char *data = "Test";
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status = hash.base.start_sha256 (&hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, hash_out, sizeof (hash_out));
-	CuAssertIntEquals (test, FLASH_UTIL_HASH_BUFFER_TOO_SMALL, status);
+	status = flash_hash_update_contents (&flash.base, 0x1122, 4, &hash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_verify_noncontiguous_contents_at_offset_test_read_error_with_hash_out (
-	CuTest *test)
+static void flash_hash_update_contents_test_sha1 (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
-	uint8_t empty[sizeof (hash_out)] = {0};
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x71,0x10,0xed,0xa4,0xd0,0x9e,0x06,0x2a,0xa5,0xe4,0xa3,0x90,0xb0,0xa5,0x72,0xac,
+		0x0d,0x2c,0x02,0x20
+	};
+	uint8_t hash_actual[SHA1_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x54321), MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x12345),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
-	memcpy (hash_out, empty, sizeof (hash_out));
+	status = hash.base.start_sha1 (&hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_verify_noncontiguous_contents_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &rsa.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		&RSA_PUBLIC_KEY, hash_out, sizeof (hash_out));
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_hash_update_contents (&flash.base, 0x12345, 4, &hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = testing_validate_array (empty, hash_out, sizeof (hash_out));
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_sha256 (CuTest *test)
+static void flash_hash_update_contents_test_multiple_blocks (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	char *data = "Test";
+	uint8_t hash_expected[] = {
+		0x66,0x74,0x48,0xad,0x7b,0x51,0x35,0xd0,0xbc,0xbf,0xb4,0xbd,0x15,0x6f,0x5b,0x9b,
+		0x64,0xa0,0xd8,0xab,0x68,0x71,0xa7,0xb8,0x2a,0x8c,0x68,0x0c,0x46,0xb8,0xe4,0x62
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
-		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
-		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1222),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1322),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (16));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_NOPE, RSA_ENCRYPT_LEN, 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status = hash.base.start_sha256 (&hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
-		0);
+	status = flash_hash_update_contents (&flash.base, 0x1122, (FLASH_VERIFICATION_BLOCK * 2) + 16,
+		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_sha256_with_hash_out (
-	CuTest *test)
+static void flash_hash_update_contents_test_zero_length (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
-
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
-		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
-		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
-
+	status = hash.base.start_sha256 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
-
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		hash_out, sizeof (hash_out));
+	status = flash_hash_update_contents (&flash.base, 0x1122, 0, &hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = testing_validate_array (SHA256_EMPTY_BUFFER_HASH, hash_actual, SHA256_HASH_LENGTH);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_sha256_no_match_signature (
-	CuTest *test)
+static void flash_hash_update_contents_test_null (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	char *data = "Test";
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = flash_hash_update_contents (NULL, 0x1122, 4, &hash.base);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_hash_update_contents (&flash.base, 0x1122, 4, NULL);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
-		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
-		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
-		MOCK_ARG (RSA_ENCRYPT_LEN));
+static void flash_hash_update_contents_test_read_error (CuTest *test)
+{
+	struct hash_engine_mock hash;
+	struct flash_mock flash;
+	int status;
+
+	TEST_START;
 
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN, NULL,
-		0);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x1122), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 
-	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = flash_hash_update_contents (&flash.base, 0x1122, 4, &hash.base);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
+	status = hash_mock_validate_and_release (&hash);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_sha256_no_match_signature_with_hash_out (
-	CuTest *test)
+static void flash_hash_update_contents_test_multiple_blocks_read_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = signature_verification_mock_init (&verification);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
-
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
-		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
-		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN),
-		MOCK_ARG (RSA_ENCRYPT_LEN));
-
-	CuAssertIntEquals (test, 0, status);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
-	memset (hash_out, 0, sizeof (hash_out));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RSA_ENCRYPT_TEST, FLASH_VERIFICATION_BLOCK),
+		MOCK_ARG (FLASH_VERIFICATION_BLOCK));
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN,
-		hash_out, sizeof (hash_out));
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x1222), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
 
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_hash_update_contents (&flash.base, 0x1122, (FLASH_VERIFICATION_BLOCK * 2) + 16,
+		&hash.base);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash_mock_validate_and_release (&hash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_sha256_no_match_signature_ecc_with_hash_out (
-	CuTest *test)
+static void flash_hash_update_contents_test_hash_update_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = signature_verification_mock_init (&verification);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x54321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification,
-		ECC_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN),
-		MOCK_ARG (SIG_HASH_LEN), MOCK_ARG_PTR_CONTAINS (ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN),
-		MOCK_ARG (ECC_SIG_NOPE_LEN));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, HASH_ENGINE_UPDATE_FAILED,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
-	memset (hash_out, 0, sizeof (hash_out));
-
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, ECC_SIGNATURE_NOPE, ECC_SIG_NOPE_LEN,
-		hash_out, sizeof (hash_out));
-	CuAssertIntEquals (test, ECC_ENGINE_BAD_SIGNATURE, status);
-
-	status = testing_validate_array (SIG_HASH_TEST, hash_out, SIG_HASH_LEN);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_hash_update_contents (&flash.base, 0x1122, 4, &hash.base);
+	CuAssertIntEquals (test, HASH_ENGINE_UPDATE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash_mock_validate_and_release (&hash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_sha1 (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_sha256 (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	char *data = "Test";
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status = hash.base.start_sha256 (&hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA1, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
-		0);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_SIG_HASH, status);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_unknown (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_sha1 (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	char *data = "Test";
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x71,0x10,0xed,0xa4,0xd0,0x9e,0x06,0x2a,0xa5,0xe4,0xa3,0x90,0xb0,0xa5,0x72,0xac,
+		0x0d,0x2c,0x02,0x20
+	};
+	uint8_t hash_actual[SHA1_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x12345),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status = hash.base.start_sha1 (&hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, (enum hash_type) 10, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		NULL, 0);
-	CuAssertIntEquals (test, FLASH_UTIL_UNKNOWN_SIG_HASH, status);
+	regions.start_addr = 0x12345;
+	regions.length = 4;
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_multiple_regions (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_multiple_blocks (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions[2];
-	char *data = "Test";
+	struct flash_region regions;
+	uint8_t hash_expected[] = {
+		0x66,0x74,0x48,0xad,0x7b,0x51,0x35,0xd0,0xbc,0xbf,0xb4,0xbd,0x15,0x6f,0x5b,0x9b,
+		0x64,0xa0,0xd8,0xab,0x68,0x71,0xa7,0xb8,0x2a,0x8c,0x68,0x0c,0x46,0xb8,0xe4,0x62
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x94321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x98765),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (3));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, strlen (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1222),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN, 2);
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
-		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
-		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1322),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (16));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_NOPE, RSA_ENCRYPT_LEN, 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions[0].start_addr = 0x4321;
-	regions[0].length = 1;
+	status = hash.base.start_sha256 (&hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	regions[1].start_addr = 0x8765;
-	regions[1].length = 3;
+	regions.start_addr = 0x1122;
+	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x90000, regions, 2,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
-		0);
+	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_no_offset (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_multiple_regions (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	char *data = "Test";
+	struct flash_region regions[3];
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x4321),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, strlen (data), 2);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&verification.mock, verification.base.verify_signature, &verification, 0,
-		MOCK_ARG_PTR_CONTAINS (SIG_HASH_TEST, SIG_HASH_LEN), MOCK_ARG (SIG_HASH_LEN),
-		MOCK_ARG_PTR_CONTAINS (RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN), MOCK_ARG (RSA_ENCRYPT_LEN));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x3344),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (2));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x5566),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data + 3, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	status = hash.base.start_sha256 (&hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
-		0);
+	regions[0].start_addr = 0x1122;
+	regions[0].length = 1;
+
+	regions[1].start_addr = 0x3344;
+	regions[1].length = 2;
+
+	regions[2].start_addr = 0x5566;
+	regions[2].length = 1;
+
+	status = flash_hash_update_noncontiguous_contents (&flash.base, regions, 3, &hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_null (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_zero_length (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
-	struct flash_region regions;
 	int status;
-	char *data = "Test";
+	struct flash_region regions;
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
-
-	status = flash_noncontiguous_contents_verification_at_offset (NULL, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
-		0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, NULL, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
-		0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 0,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
-		0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		NULL, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
-		0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = hash.base.start_sha256 (&hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, NULL, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN, NULL,
-		0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	regions.start_addr = 0x1122;
+	regions.length = 0;
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, NULL, RSA_ENCRYPT_LEN, NULL,
-		0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, 0, NULL,
-		0);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = testing_validate_array (SHA256_EMPTY_BUFFER_HASH, hash_actual, SHA256_HASH_LENGTH);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_hash_buffer_too_small (
-	CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_null (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
 	struct flash_mock flash;
-	struct flash_region regions;
-	uint8_t hash_out[SHA256_HASH_LENGTH - 1];
 	int status;
-	char *data = "Test";
+	struct flash_region regions;
 
 	TEST_START;
 
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_init (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		hash_out, sizeof (hash_out));
-	CuAssertIntEquals (test, FLASH_UTIL_HASH_BUFFER_TOO_SMALL, status);
+	status = flash_hash_update_noncontiguous_contents (NULL, &regions, 1, &hash.base);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_hash_update_noncontiguous_contents (&flash.base, NULL, 1, &hash.base);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 0, &hash.base);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, NULL);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
-	CuAssertIntEquals (test, 0, status);
-
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_noncontiguous_contents_verification_at_offset_test_read_error_with_hash_out (
-	CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_read_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct signature_verification_mock verification;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	char *data = "Test";
-	uint8_t hash_out[SHA256_HASH_LENGTH];
-	uint8_t empty[sizeof (hash_out)] = {0};
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = signature_verification_mock_init (&verification);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x54321), MOCK_ARG_NOT_NULL, MOCK_ARG (strlen (data)));
+		MOCK_ARG (0x1122), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x4321;
-	regions.length = strlen (data);
-	memcpy (hash_out, empty, sizeof (hash_out));
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status = flash_noncontiguous_contents_verification_at_offset (&flash.base, 0x50000, &regions, 1,
-		&hash.base, HASH_TYPE_SHA256, &verification.base, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN,
-		hash_out, sizeof (hash_out));
+	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
 	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
-	status = testing_validate_array (empty, hash_out, sizeof (hash_out));
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = signature_verification_mock_validate_and_release (&verification);
+	status = hash_mock_validate_and_release (&hash);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_write_and_verify_test (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_multiple_blocks_read_error (CuTest *test)
 {
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	struct flash_region regions;
 
 	TEST_START;
 
+	status = hash_mock_init (&hash);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
+		MOCK_ARG_PTR_CONTAINS (RSA_ENCRYPT_TEST, FLASH_VERIFICATION_BLOCK),
+		MOCK_ARG (FLASH_VERIFICATION_BLOCK));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x1222), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
 
-	status = flash_write_and_verify (&flash.base, 0x10000, data, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
+	regions.start_addr = 0x1122;
+	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
+
+	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
+
+	status = hash_mock_validate_and_release (&hash);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_write_and_verify_test_mismatch (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_multiple_regions_read_error (CuTest *test)
 {
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t check[] = {0x01, 0x02, 0x13, 0x04};
+	struct flash_region regions[3];
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
 
 	TEST_START;
 
+	status = hash_mock_init (&hash);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, check, sizeof (check), 2);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0, MOCK_ARG_PTR_CONTAINS (data, 1),
+		MOCK_ARG (1));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x3344), MOCK_ARG_NOT_NULL, MOCK_ARG (2));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_write_and_verify (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	regions[0].start_addr = 0x1122;
+	regions[0].length = 1;
+
+	regions[1].start_addr = 0x3344;
+	regions[1].length = 2;
+
+	regions[2].start_addr = 0x5566;
+	regions[2].length = 1;
+
+	status = flash_hash_update_noncontiguous_contents (&flash.base, regions, 3, &hash.base);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
+
+	status = hash_mock_validate_and_release (&hash);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_write_and_verify_test_null (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_test_hash_update_error (CuTest *test)
 {
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	struct flash_region regions;
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
 
 	TEST_START;
 
+	status = hash_mock_init (&hash);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_write_and_verify (NULL, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status = flash_write_and_verify (&flash.base, 0x10000, NULL, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, HASH_ENGINE_UPDATE_FAILED,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	regions.start_addr = 0x1122;
+	regions.length = 4;
+
+	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
+	CuAssertIntEquals (test, HASH_ENGINE_UPDATE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
+
+	status = hash_mock_validate_and_release (&hash);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_write_and_verify_test_write_error (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_sha256 (CuTest *test)
 {
+	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	struct flash_region regions;
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
+	};
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = flash_mock_init (&flash);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_write_and_verify (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
-}
 
-static void flash_write_and_verify_test_incomplete_write (CuTest *test)
-{
-	struct flash_mock flash;
-	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	status = hash.base.start_sha256 (&hash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	TEST_START;
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status = flash_mock_init (&flash);
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
-		MOCK_ARG (0x100fe), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_write_and_verify (&flash.base, 0x100fe, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_write_and_verify_test_verify_error (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_sha1 (CuTest *test)
 {
+	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	struct flash_region regions;
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint8_t hash_expected[] = {
+		0x71,0x10,0xed,0xa4,0xd0,0x9e,0x06,0x2a,0xa5,0xe4,0xa3,0x90,0xb0,0xa5,0x72,0xac,
+		0x0d,0x2c,0x02,0x20
+	};
+	uint8_t hash_actual[SHA1_HASH_LENGTH];
 
 	TEST_START;
 
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x612345),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	CuAssertIntEquals (test, 0, status);
 
+	status = hash.base.start_sha1 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_write_and_verify (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	regions.start_addr = 0x12345;
+	regions.length = 4;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x600000, &regions, 1,
+		&hash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_contents_test_sha256 (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_multiple_blocks (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	struct flash_region regions;
 	uint8_t hash_expected[] = {
-		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
-		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
+		0x66,0x74,0x48,0xad,0x7b,0x51,0x35,0xd0,0xbc,0xbf,0xb4,0xbd,0x15,0x6f,0x5b,0x9b,
+		0x64,0xa0,0xd8,0xab,0x68,0x71,0xa7,0xb8,0x2a,0x8c,0x68,0x0c,0x46,0xb8,0xe4,0x62
 	};
 	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
@@ -15760,16 +17413,28 @@ static void flash_hash_update_contents_test_sha256 (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41222),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41322),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (16));
+	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_NOPE, RSA_ENCRYPT_LEN, 2);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = hash.base.start_sha256 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_update_contents (&flash.base, 0x1122, 4, &hash.base);
+	regions.start_addr = 0x1122;
+	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x40000, &regions, 1,
+		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
@@ -15784,17 +17449,18 @@ static void flash_hash_update_contents_test_sha256 (CuTest *test)
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_contents_test_sha1 (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_multiple_regions (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
 	int status;
+	struct flash_region regions[3];
 	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
 	uint8_t hash_expected[] = {
-		0x71,0x10,0xed,0xa4,0xd0,0x9e,0x06,0x2a,0xa5,0xe4,0xa3,0x90,0xb0,0xa5,0x72,0xac,
-		0x0d,0x2c,0x02,0x20
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
 	};
-	uint8_t hash_actual[SHA1_HASH_LENGTH];
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
@@ -15804,16 +17470,34 @@ static void flash_hash_update_contents_test_sha1 (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x12345),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x71122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x73344),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (2));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x75566),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data + 3, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash.base.start_sha1 (&hash.base);
+	status = hash.base.start_sha256 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_update_contents (&flash.base, 0x12345, 4, &hash.base);
+	regions[0].start_addr = 0x1122;
+	regions[0].length = 1;
+
+	regions[1].start_addr = 0x3344;
+	regions[1].length = 2;
+
+	regions[2].start_addr = 0x5566;
+	regions[2].length = 1;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x70000, regions, 3,
+		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
@@ -15828,14 +17512,16 @@ static void flash_hash_update_contents_test_sha1 (CuTest *test)
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_contents_test_multiple_blocks (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_no_offset (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
 	int status;
+	struct flash_region regions;
+	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
 	uint8_t hash_expected[] = {
-		0x66,0x74,0x48,0xad,0x7b,0x51,0x35,0xd0,0xbc,0xbf,0xb4,0xbd,0x15,0x6f,0x5b,0x9b,
-		0x64,0xa0,0xd8,0xab,0x68,0x71,0xa7,0xb8,0x2a,0x8c,0x68,0x0c,0x46,0xb8,0xe4,0x62
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
 	};
 	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
@@ -15848,23 +17534,18 @@ static void flash_hash_update_contents_test_multiple_blocks (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1222),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1322),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (16));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_NOPE, RSA_ENCRYPT_LEN, 2);
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = hash.base.start_sha256 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_update_contents (&flash.base, 0x1122, (FLASH_VERIFICATION_BLOCK * 2) + 16,
+	regions.start_addr = 0x1122;
+	regions.length = 4;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0, &regions, 1,
 		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
@@ -15880,11 +17561,12 @@ static void flash_hash_update_contents_test_multiple_blocks (CuTest *test)
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_contents_test_zero_length (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_zero_length (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
 	int status;
+	struct flash_region regions;
 	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
@@ -15898,7 +17580,11 @@ static void flash_hash_update_contents_test_zero_length (CuTest *test)
 	status = hash.base.start_sha256 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_update_contents (&flash.base, 0x1122, 0, &hash.base);
+	regions.start_addr = 0x1122;
+	regions.length = 0;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
@@ -15913,11 +17599,12 @@ static void flash_hash_update_contents_test_zero_length (CuTest *test)
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_contents_test_null (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_null (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
 	int status;
+	struct flash_region regions;
 
 	TEST_START;
 
@@ -15927,10 +17614,23 @@ static void flash_hash_update_contents_test_null (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_update_contents (NULL, 0x1122, 4, &hash.base);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (NULL, 0x30000, &regions, 1,
+		&hash.base);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_hash_update_contents (&flash.base, 0x1122, 4, NULL);
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, NULL, 1,
+		&hash.base);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 0,
+		&hash.base);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		NULL);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
@@ -15939,11 +17639,12 @@ static void flash_hash_update_contents_test_null (CuTest *test)
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_contents_test_read_error (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_read_error (CuTest *test)
 {
 	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
+	struct flash_region regions;
 
 	TEST_START;
 
@@ -15954,11 +17655,15 @@ static void flash_hash_update_contents_test_read_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x1122), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+		MOCK_ARG (0x31122), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_update_contents (&flash.base, 0x1122, 4, &hash.base);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
 	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
@@ -15968,11 +17673,13 @@ static void flash_hash_update_contents_test_read_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_contents_test_multiple_blocks_read_error (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_multiple_blocks_read_error (
+	CuTest *test)
 {
 	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
+	struct flash_region regions;
 
 	TEST_START;
 
@@ -15982,7 +17689,7 @@ static void flash_hash_update_contents_test_multiple_blocks_read_error (CuTest *
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
 	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
 
@@ -15991,11 +17698,14 @@ static void flash_hash_update_contents_test_multiple_blocks_read_error (CuTest *
 		MOCK_ARG (FLASH_VERIFICATION_BLOCK));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x1222), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		MOCK_ARG (0x31222), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_update_contents (&flash.base, 0x1122, (FLASH_VERIFICATION_BLOCK * 2) + 16,
+	regions.start_addr = 0x1122;
+	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
 		&hash.base);
 	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
@@ -16006,11 +17716,13 @@ static void flash_hash_update_contents_test_multiple_blocks_read_error (CuTest *
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_contents_test_hash_update_error (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_multiple_regions_read_error (
+	CuTest *test)
 {
 	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
+	struct flash_region regions[3];
 	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
 
 	TEST_START;
@@ -16021,17 +17733,30 @@ static void flash_hash_update_contents_test_hash_update_error (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x71122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, HASH_ENGINE_UPDATE_FAILED,
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0, MOCK_ARG_PTR_CONTAINS (data, 1),
+		MOCK_ARG (1));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x73344), MOCK_ARG_NOT_NULL, MOCK_ARG (2));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_update_contents (&flash.base, 0x1122, 4, &hash.base);
-	CuAssertIntEquals (test, HASH_ENGINE_UPDATE_FAILED, status);
+	regions[0].start_addr = 0x1122;
+	regions[0].length = 1;
+
+	regions[1].start_addr = 0x3344;
+	regions[1].length = 2;
+
+	regions[2].start_addr = 0x5566;
+	regions[2].length = 1;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x70000, regions, 3,
+		&hash.base);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -16040,55 +17765,47 @@ static void flash_hash_update_contents_test_hash_update_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_sha256 (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_hash_update_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
 	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_expected[] = {
-		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
-		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
-	};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, HASH_ENGINE_UPDATE_FAILED,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 
-	status = hash.base.start_sha256 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
 	regions.start_addr = 0x1122;
 	regions.length = 4;
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, 0, status);
-
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
+	CuAssertIntEquals (test, HASH_ENGINE_UPDATE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
+	status = hash_mock_validate_and_release (&hash);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_sha1 (CuTest *test)
+
+static void flash_hash_update_noncontiguous_contents_at_offset_test_async_read (CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
@@ -16096,10 +17813,10 @@ static void flash_hash_update_noncontiguous_contents_test_sha1 (CuTest *test)
 	struct flash_region regions;
 	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
 	uint8_t hash_expected[] = {
-		0x71,0x10,0xed,0xa4,0xd0,0x9e,0x06,0x2a,0xa5,0xe4,0xa3,0x90,0xb0,0xa5,0x72,0xac,
-		0x0d,0x2c,0x02,0x20
+		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
+		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
 	};
-	uint8_t hash_actual[SHA1_HASH_LENGTH];
+	uint8_t hash_actual[SHA256_HASH_LENGTH];
 
 	TEST_START;
 
@@ -16109,19 +17826,23 @@ static void flash_hash_update_noncontiguous_contents_test_sha1 (CuTest *test)
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x12345),
+	flash_mock_enable_async_read (&flash);
+
+	status = mock_expect (&flash.mock, flash.base.read_start, &flash, 0, MOCK_ARG (0x31122),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash.base.start_sha1 (&hash.base);
+	status = hash.base.start_sha256 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x12345;
+	regions.start_addr = 0x1122;
 	regions.length = 4;
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
@@ -16136,47 +17857,63 @@ static void flash_hash_update_noncontiguous_contents_test_sha1 (CuTest *test)
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_multiple_blocks (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_async_read_multiple_blocks (
+	CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
-	uint8_t hash_expected[] = {
-		0x66,0x74,0x48,0xad,0x7b,0x51,0x35,0xd0,0xbc,0xbf,0xb4,0xbd,0x15,0x6f,0x5b,0x9b,
-		0x64,0xa0,0xd8,0xab,0x68,0x71,0xa7,0xb8,0x2a,0x8c,0x68,0x0c,0x46,0xb8,0xe4,0x62
-	};
+	uint8_t data[(FLASH_HASH_PIPELINE_BLOCK * 2) + 16];
+	uint8_t hash_expected[SHA256_HASH_LENGTH];
 	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	size_t i;
 
 	TEST_START;
 
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
+
 	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
+	flash_mock_enable_async_read (&flash);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1222),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN, 2);
+	status = mock_expect (&flash.mock, flash.base.read_start, &flash, 0, MOCK_ARG (0x41122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_HASH_PIPELINE_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1322),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (16));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_NOPE, RSA_ENCRYPT_LEN, 2);
+	status |= mock_expect (&flash.mock, flash.base.read_start, &flash, 0,
+		MOCK_ARG (0x41122 + FLASH_HASH_PIPELINE_BLOCK), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (FLASH_HASH_PIPELINE_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, &data[FLASH_HASH_PIPELINE_BLOCK],
+		sizeof (data) - FLASH_HASH_PIPELINE_BLOCK, 2);
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
+
+	status |= mock_expect (&flash.mock, flash.base.read_start, &flash, 0,
+		MOCK_ARG (0x41122 + (FLASH_HASH_PIPELINE_BLOCK * 2)), MOCK_ARG_NOT_NULL, MOCK_ARG (16));
+	status |= mock_expect_output (&flash.mock, 1, &data[FLASH_HASH_PIPELINE_BLOCK * 2], 16, 2);
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
+
+	CuAssertIntEquals (test, 0, status);
 
+	status = hash.base.calculate_sha256 (&hash.base, data, sizeof (data), hash_expected,
+		sizeof (hash_expected));
 	CuAssertIntEquals (test, 0, status);
 
 	status = hash.base.start_sha256 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
 	regions.start_addr = 0x1122;
-	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
+	regions.length = sizeof (data);
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x40000, &regions, 1,
+		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
@@ -16191,12 +17928,13 @@ static void flash_hash_update_noncontiguous_contents_test_multiple_blocks (CuTes
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_multiple_regions (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_async_read_multiple_regions (
+	CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions[3];
+	struct flash_region regions[4];
 	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
 	uint8_t hash_expected[] = {
 		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
@@ -16212,17 +17950,22 @@ static void flash_hash_update_noncontiguous_contents_test_multiple_regions (CuTe
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
+	flash_mock_enable_async_read (&flash);
+
+	status = mock_expect (&flash.mock, flash.base.read_start, &flash, 0, MOCK_ARG (0x71122),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x3344),
+	status |= mock_expect (&flash.mock, flash.base.read_start, &flash, 0, MOCK_ARG (0x73344),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (2));
 	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x5566),
+	status |= mock_expect (&flash.mock, flash.base.read_start, &flash, 0, MOCK_ARG (0x75566),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
 	status |= mock_expect_output (&flash.mock, 1, data + 3, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -16232,13 +17975,17 @@ static void flash_hash_update_noncontiguous_contents_test_multiple_regions (CuTe
 	regions[0].start_addr = 0x1122;
 	regions[0].length = 1;
 
-	regions[1].start_addr = 0x3344;
-	regions[1].length = 2;
+	regions[1].start_addr = 0x2233;
+	regions[1].length = 0;
 
-	regions[2].start_addr = 0x5566;
-	regions[2].length = 1;
+	regions[2].start_addr = 0x3344;
+	regions[2].length = 2;
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, regions, 3, &hash.base);
+	regions[3].start_addr = 0x5566;
+	regions[3].length = 1;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x70000, regions, 4,
+		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
@@ -16253,7 +18000,8 @@ static void flash_hash_update_noncontiguous_contents_test_multiple_regions (CuTe
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_zero_length (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_async_read_zero_length (
+	CuTest *test)
 {
 	HASH_TESTING_ENGINE hash;
 	struct flash_mock flash;
@@ -16269,64 +18017,107 @@ static void flash_hash_update_noncontiguous_contents_test_zero_length (CuTest *t
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_mock_enable_async_read (&flash);
+
 	status = hash.base.start_sha256 (&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
 	regions.start_addr = 0x1122;
 	regions.length = 0;
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_EMPTY_BUFFER_HASH, hash_actual, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void flash_hash_update_noncontiguous_contents_at_offset_test_async_read_start_error (
+	CuTest *test)
+{
+	struct hash_engine_mock hash;
+	struct flash_mock flash;
+	int status;
+	struct flash_region regions;
+
+	TEST_START;
+
+	status = hash_mock_init (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, 0, status);
+	flash_mock_enable_async_read (&flash);
+
+	status = mock_expect (&flash.mock, flash.base.read_start, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x31122), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 
-	status = testing_validate_array (SHA256_EMPTY_BUFFER_HASH, hash_actual, SHA256_HASH_LENGTH);
 	CuAssertIntEquals (test, 0, status);
 
+	regions.start_addr = 0x1122;
+	regions.length = 4;
+
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
+	status = hash_mock_validate_and_release (&hash);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_null (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_async_read_wait_error (
+	CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
+	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
 	struct flash_region regions;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = hash_mock_init (&hash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+	flash_mock_enable_async_read (&flash);
 
-	status = flash_hash_update_noncontiguous_contents (NULL, &regions, 1, &hash.base);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.read_start, &flash, 0, MOCK_ARG (0x31122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, FLASH_READ_FAILED);
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, NULL, 1, &hash.base);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 0, &hash.base);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	regions.start_addr = 0x1122;
+	regions.length = 4;
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, NULL);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
+	status = hash_mock_validate_and_release (&hash);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_read_error (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_async_read_next_error (
+	CuTest *test)
 {
 	struct hash_engine_mock hash;
 	struct flash_mock flash;
@@ -16341,15 +18132,22 @@ static void flash_hash_update_noncontiguous_contents_test_read_error (CuTest *te
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x1122), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	flash_mock_enable_async_read (&flash);
+
+	status = mock_expect (&flash.mock, flash.base.read_start, &flash, 0, MOCK_ARG (0x31122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_HASH_PIPELINE_BLOCK));
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
+
+	status |= mock_expect (&flash.mock, flash.base.read_start, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x31122 + FLASH_HASH_PIPELINE_BLOCK), MOCK_ARG_NOT_NULL, MOCK_ARG (16));
 
 	CuAssertIntEquals (test, 0, status);
 
 	regions.start_addr = 0x1122;
-	regions.length = 4;
+	regions.length = FLASH_HASH_PIPELINE_BLOCK + 16;
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
 	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
@@ -16359,7 +18157,8 @@ static void flash_hash_update_noncontiguous_contents_test_read_error (CuTest *te
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_multiple_blocks_read_error (CuTest *test)
+static void flash_hash_update_noncontiguous_contents_at_offset_test_async_read_hash_update_error (
+	CuTest *test)
 {
 	struct hash_engine_mock hash;
 	struct flash_mock flash;
@@ -16374,24 +18173,28 @@ static void flash_hash_update_noncontiguous_contents_test_multiple_blocks_read_e
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
+	flash_mock_enable_async_read (&flash);
 
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
-		MOCK_ARG_PTR_CONTAINS (RSA_ENCRYPT_TEST, FLASH_VERIFICATION_BLOCK),
-		MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status = mock_expect (&flash.mock, flash.base.read_start, &flash, 0, MOCK_ARG (0x31122),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_HASH_PIPELINE_BLOCK));
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x1222), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect (&flash.mock, flash.base.read_start, &flash, 0,
+		MOCK_ARG (0x31122 + FLASH_HASH_PIPELINE_BLOCK), MOCK_ARG_NOT_NULL, MOCK_ARG (16));
+
+	status |= mock_expect (&hash.mock, hash.base.update, &hash, HASH_ENGINE_UPDATE_FAILED,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_HASH_PIPELINE_BLOCK));
+
+	status |= mock_expect (&flash.mock, flash.base.read_wait, &flash, 0);
 
 	CuAssertIntEquals (test, 0, status);
 
 	regions.start_addr = 0x1122;
-	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
+	regions.length = FLASH_HASH_PIPELINE_BLOCK + 16;
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
+		&hash.base);
+	CuAssertIntEquals (test, HASH_ENGINE_UPDATE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -16400,597 +18203,734 @@ static void flash_hash_update_noncontiguous_contents_test_multiple_blocks_read_e
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_multiple_regions_read_error (CuTest *test)
+
+static void flash_differential_copy_ext_and_verify_test (CuTest *test)
 {
-	struct hash_engine_mock hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions[3];
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+	uint8_t old[] = {0x11, 0x12, 0x13, 0x14};
+	size_t written;
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0, MOCK_ARG_PTR_CONTAINS (data, 1),
-		MOCK_ARG (1));
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x3344), MOCK_ARG_NOT_NULL, MOCK_ARG (2));
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
 
-	regions[0].start_addr = 0x1122;
-	regions[0].length = 1;
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0,
+		MOCK_ARG (0x20000));
 
-	regions[1].start_addr = 0x3344;
-	regions[1].length = 2;
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	regions[2].start_addr = 0x5566;
-	regions[2].length = 1;
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, regions, 3, &hash.base);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
 
-	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &written);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (data), written);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_test_hash_update_error (CuTest *test)
+static void flash_differential_copy_ext_and_verify_test_identical (CuTest *test)
 {
-	struct hash_engine_mock hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+	size_t written;
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, HASH_ENGINE_UPDATE_FAILED,
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &written);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, written);
 
-	status = flash_hash_update_noncontiguous_contents (&flash.base, &regions, 1, &hash.base);
-	CuAssertIntEquals (test, HASH_ENGINE_UPDATE_FAILED, status);
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
+}
 
-	status = hash_mock_validate_and_release (&hash);
+static void flash_differential_copy_ext_and_verify_test_multiple_sectors (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+	uint8_t old[] = {0x11, 0x12, 0x13, 0x14};
+	size_t written;
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20ffc),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10004),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x21000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0,
+		MOCK_ARG (0x21000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x21000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10004),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x21000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x21000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20ffc, &flash1.base, 0x10000,
+		sizeof (data) * 2, &written);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (data), written);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_sha256 (CuTest *test)
+static void flash_differential_copy_ext_and_verify_test_null_bytes_written (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_expected[] = {
-		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
-		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
-	};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+	uint8_t old[] = {0x11, 0x12, 0x13, 0x14};
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status = hash.base.start_sha256 (&hash.base);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
 
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0,
+		MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
 
-	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), NULL);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_sha1 (CuTest *test)
+static void flash_differential_copy_ext_and_verify_test_read_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_expected[] = {
-		0x71,0x10,0xed,0xa4,0xd0,0x9e,0x06,0x2a,0xa5,0xe4,0xa3,0x90,0xb0,0xa5,0x72,0xac,
-		0x0d,0x2c,0x02,0x20
-	};
-	uint8_t hash_actual[SHA1_HASH_LENGTH];
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+	size_t written;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
+	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x612345),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = hash.base.start_sha1 (&hash.base);
-	CuAssertIntEquals (test, 0, status);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	regions.start_addr = 0x12345;
-	regions.length = 4;
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x600000, &regions, 1,
-		&hash.base);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 
-	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
 	CuAssertIntEquals (test, 0, status);
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &written);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	CuAssertIntEquals (test, 0, written);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_multiple_blocks (CuTest *test)
+static void flash_differential_copy_ext_and_verify_test_erase_error (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions;
-	uint8_t hash_expected[] = {
-		0x66,0x74,0x48,0xad,0x7b,0x51,0x35,0xd0,0xbc,0xbf,0xb4,0xbd,0x15,0x6f,0x5b,0x9b,
-		0x64,0xa0,0xd8,0xab,0x68,0x71,0xa7,0xb8,0x2a,0x8c,0x68,0x0c,0x46,0xb8,0xe4,0x62
-	};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+	uint8_t old[] = {0x11, 0x12, 0x13, 0x14};
+	size_t written;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
+	memset (blank, 0xff, sizeof (blank));
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41222),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN, 2);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x41322),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (16));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_NOPE, RSA_ENCRYPT_LEN, 2);
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status = hash.base.start_sha256 (&hash.base);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
 
-	regions.start_addr = 0x1122;
-	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2,
+		FLASH_SECTOR_ERASE_FAILED, MOCK_ARG (0x20000));
 
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x40000, &regions, 1,
-		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &written);
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
+	CuAssertIntEquals (test, 0, written);
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_multiple_regions (CuTest *test)
+static void flash_differential_copy_ext_and_verify_test_not_blank (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions[3];
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_expected[] = {
-		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
-		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
-	};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+	uint8_t old[] = {0x11, 0x12, 0x13, 0x14};
+	size_t written;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x71122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x73344),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (2));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data), 2);
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x75566),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data + 3, sizeof (data), 2);
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
 
-	status = hash.base.start_sha256 (&hash.base);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0,
+		MOCK_ARG (0x20000));
 
-	regions[0].start_addr = 0x1122;
-	regions[0].length = 1;
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
 
-	regions[1].start_addr = 0x3344;
-	regions[1].length = 2;
+	CuAssertIntEquals (test, 0, status);
 
-	regions[2].start_addr = 0x5566;
-	regions[2].length = 1;
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &written);
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
+	CuAssertIntEquals (test, 0, written);
 
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x70000, regions, 3,
-		&hash.base);
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
+}
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+static void flash_differential_copy_ext_and_verify_test_verify_mismatch (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+	uint8_t old[] = {0x11, 0x12, 0x13, 0x14};
+	size_t written;
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-}
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_no_offset (CuTest *test)
-{
-	HASH_TESTING_ENGINE hash;
-	struct flash_mock flash;
-	int status;
-	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
-	uint8_t hash_expected[] = {
-		0x03,0xac,0x67,0x42,0x16,0xf3,0xe1,0x5c,0x76,0x1e,0xe1,0xa5,0xe2,0x55,0xf0,0x67,
-		0x95,0x36,0x23,0xc8,0xb3,0x88,0xb4,0x45,0x9e,0x13,0xf9,0x78,0xd7,0xc8,0x46,0xf4
-	};
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	TEST_START;
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
 
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0,
+		MOCK_ARG (0x20000));
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x1122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status = hash.base.start_sha256 (&hash.base);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
 
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0, &regions, 1,
-		&hash.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &written);
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	CuAssertIntEquals (test, 0, written);
 
-	status = testing_validate_array (hash_expected, hash_actual, sizeof (hash_expected));
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_zero_length (CuTest *test)
+static void flash_differential_copy_ext_and_verify_test_zero_length (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions;
-	uint8_t hash_actual[SHA256_HASH_LENGTH];
+	size_t written = 1;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = hash.base.start_sha256 (&hash.base);
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 0;
-
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash.base.finish (&hash.base, hash_actual, sizeof (hash_actual));
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		0, &written);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, written);
 
-	status = testing_validate_array (SHA256_EMPTY_BUFFER_HASH, hash_actual, SHA256_HASH_LENGTH);
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
-
-	HASH_TESTING_ENGINE_RELEASE (&hash);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_null (CuTest *test)
+static void flash_differential_copy_ext_and_verify_test_null (CuTest *test)
 {
-	HASH_TESTING_ENGINE hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions;
+	size_t written;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
-
-	status = flash_hash_update_noncontiguous_contents_at_offset (NULL, 0x30000, &regions, 1,
-		&hash.base);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, NULL, 1,
-		&hash.base);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 0,
-		&hash.base);
+	status = flash_differential_copy_ext_and_verify (NULL, 0x20000, &flash1.base, 0x10000, 4,
+		&written);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		NULL);
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, NULL, 0x10000, 4,
+		&written);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	HASH_TESTING_ENGINE_RELEASE (&hash);
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_read_error (CuTest *test)
+static void flash_differential_copy_ext_and_verify_test_sector_size_error (CuTest *test)
 {
-	struct hash_engine_mock hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions;
+	size_t written;
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x31122), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
-
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		4, &written);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_multiple_blocks_read_error (
-	CuTest *test)
+static void flash_differential_copy_ext_and_verify_test_page_size_unsupported (CuTest *test)
 {
-	struct hash_engine_mock hash;
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
-	struct flash_region regions;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	size_t written;
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
+	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_init (&flash);
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN, 2);
-
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0,
-		MOCK_ARG_PTR_CONTAINS (RSA_ENCRYPT_TEST, FLASH_VERIFICATION_BLOCK),
-		MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x31222), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	regions.start_addr = 0x1122;
-	regions.length = (FLASH_VERIFICATION_BLOCK * 2) + 16;
-
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_differential_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		4, &written);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_multiple_regions_read_error (
-	CuTest *test)
+static void flash_differential_copy_and_verify_test (CuTest *test)
 {
-	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions[3];
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+	uint8_t old[] = {0x11, 0x12, 0x13, 0x14};
+	size_t written;
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
-	CuAssertIntEquals (test, 0, status);
+	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x71122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, 0, MOCK_ARG_PTR_CONTAINS (data, 1),
-		MOCK_ARG (1));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, old, sizeof (old), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x73344), MOCK_ARG_NOT_NULL, MOCK_ARG (2));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	regions[0].start_addr = 0x1122;
-	regions[0].length = 1;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	regions[1].start_addr = 0x3344;
-	regions[1].length = 2;
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	regions[2].start_addr = 0x5566;
-	regions[2].length = 1;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x70000, regions, 3,
-		&hash.base);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_differential_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data),
+		&written);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (data), written);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_hash_update_noncontiguous_contents_at_offset_test_hash_update_error (CuTest *test)
+static void flash_differential_copy_and_verify_test_same_erase_sector (CuTest *test)
 {
-	struct hash_engine_mock hash;
 	struct flash_mock flash;
 	int status;
-	struct flash_region regions;
-	uint8_t data[] = {0x31, 0x32, 0x33, 0x34};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	size_t written;
 
 	TEST_START;
 
-	status = hash_mock_init (&hash);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x31122),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&hash.mock, hash.base.update, &hash, HASH_ENGINE_UPDATE_FAILED,
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_differential_copy_and_verify (&flash.base, 0x10800, 0x10000, 4, &written);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	CuAssertIntEquals (test, 0, written);
 
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
+}
 
-	regions.start_addr = 0x1122;
-	regions.length = 4;
+static void flash_differential_copy_and_verify_test_overlapping_regions (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	size_t written;
 
-	status = flash_hash_update_noncontiguous_contents_at_offset (&flash.base, 0x30000, &regions, 1,
-		&hash.base);
-	CuAssertIntEquals (test, HASH_ENGINE_UPDATE_FAILED, status);
+	TEST_START;
 
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = hash_mock_validate_and_release (&hash);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_differential_copy_and_verify (&flash.base, 0x11000, 0x10000, 0x2000, &written);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
@@ -17200,6 +19140,32 @@ TEST (flash_sector_erase_region_test_null);
 TEST (flash_sector_erase_region_test_sector_size_error);
 TEST (flash_sector_erase_region_test_error);
 TEST (flash_sector_erase_region_test_multiple_sectors_error);
+TEST (flash_mixed_erase_region_test);
+TEST (flash_mixed_erase_region_test_multiple_sectors);
+TEST (flash_mixed_erase_region_test_full_block);
+TEST (flash_mixed_erase_region_test_multiple_blocks);
+TEST (flash_mixed_erase_region_test_unaligned_start_and_end);
+TEST (flash_mixed_erase_region_test_block_unaligned_region);
+TEST (flash_mixed_erase_region_test_block_not_sector_multiple);
+TEST (flash_mixed_erase_region_test_block_same_as_sector);
+TEST (flash_mixed_erase_region_test_full_device);
+TEST (flash_mixed_erase_region_test_start_of_device);
+TEST (flash_mixed_erase_region_test_all_but_last_sector);
+TEST (flash_mixed_erase_region_test_end_of_device);
+TEST (flash_mixed_erase_region_test_past_end_of_device);
+TEST (flash_mixed_erase_region_test_past_end_of_device_unaligned);
+TEST (flash_mixed_erase_region_test_no_length);
+TEST (flash_mixed_erase_region_test_null);
+TEST (flash_mixed_erase_region_test_sector_size_error);
+TEST (flash_mixed_erase_region_test_block_size_error);
+TEST (flash_mixed_erase_region_test_device_size_error);
+TEST (flash_mixed_erase_region_test_chip_erase_error);
+TEST (flash_mixed_erase_region_test_block_erase_error);
+TEST (flash_mixed_erase_region_test_sector_erase_error);
+TEST (flash_mixed_erase_region_and_verify_test);
+TEST (flash_mixed_erase_region_and_verify_test_not_blank);
+TEST (flash_mixed_erase_region_and_verify_test_null);
+TEST (flash_mixed_erase_region_and_verify_test_erase_error);
 TEST (flash_sector_erase_region_and_verify_test);
 TEST (flash_sector_erase_region_and_verify_test_not_blank);
 TEST (flash_sector_erase_region_and_verify_test_null);
@@ -17396,5 +19362,28 @@ TEST (flash_hash_update_noncontiguous_contents_at_offset_test_read_error);
 TEST (flash_hash_update_noncontiguous_contents_at_offset_test_multiple_blocks_read_error);
 TEST (flash_hash_update_noncontiguous_contents_at_offset_test_multiple_regions_read_error);
 TEST (flash_hash_update_noncontiguous_contents_at_offset_test_hash_update_error);
+TEST (flash_hash_update_noncontiguous_contents_at_offset_test_async_read);
+TEST (flash_hash_update_noncontiguous_contents_at_offset_test_async_read_multiple_blocks);
+TEST (flash_hash_update_noncontiguous_contents_at_offset_test_async_read_multiple_regions);
+TEST (flash_hash_update_noncontiguous_contents_at_offset_test_async_read_zero_length);
+TEST (flash_hash_update_noncontiguous_contents_at_offset_test_async_read_start_error);
+TEST (flash_hash_update_noncontiguous_contents_at_offset_test_async_read_wait_error);
+TEST (flash_hash_update_noncontiguous_contents_at_offset_test_async_read_next_error);
+TEST (flash_hash_update_noncontiguous_contents_at_offset_test_async_read_hash_update_error);
+TEST (flash_differential_copy_ext_and_verify_test);
+TEST (flash_differential_copy_ext_and_verify_test_identical);
+TEST (flash_differential_copy_ext_and_verify_test_multiple_sectors);
+TEST (flash_differential_copy_ext_and_verify_test_null_bytes_written);
+TEST (flash_differential_copy_ext_and_verify_test_read_error);
+TEST (flash_differential_copy_ext_and_verify_test_erase_error);
+TEST (flash_differential_copy_ext_and_verify_test_not_blank);
+TEST (flash_differential_copy_ext_and_verify_test_verify_mismatch);
+TEST (flash_differential_copy_ext_and_verify_test_zero_length);
+TEST (flash_differential_copy_ext_and_verify_test_null);
+TEST (flash_differential_copy_ext_and_verify_test_sector_size_error);
+TEST (flash_differential_copy_ext_and_verify_test_page_size_unsupported);
+TEST (flash_differential_copy_and_verify_test);
+TEST (flash_differential_copy_and_verify_test_same_erase_sector);
+TEST (flash_differential_copy_and_verify_test_overlapping_regions);
 
 TEST_SUITE_END;
@@ -195,6 +195,36 @@ static void spi_flash_test_init (CuTest *test)
 	CuAssertPtrEquals (test, spi_flash_block_erase, flash.base.block_erase);
 	CuAssertPtrEquals (test, spi_flash_chip_erase, flash.base.chip_erase);
 
+	CuAssertPtrEquals (test, NULL, flash.base.read_start);
+	CuAssertPtrEquals (test, NULL, flash.base.read_wait);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_init_async_read (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mock_enable_async_xfer (&mock);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, spi_flash_read, flash.base.read);
+	CuAssertPtrEquals (test, spi_flash_read_start, flash.base.read_start);
+	CuAssertPtrEquals (test, spi_flash_read_wait, flash.base.read_wait);
+
 	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -8077,219 +8107,177 @@ static void spi_flash_test_read_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write (CuTest *test)
+static void spi_flash_test_read_start (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t read_status = 0;
+	uint8_t data[] = {1, 2, 3, 4};
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
+	uint8_t wip_status = 0;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_enable_async_xfer (&mock);
+
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer_start (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
+	status |= flash_master_mock_expect_xfer_wait (&mock, 0);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_read_start (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read_wait (&flash);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = testing_validate_array (data, data_in, length);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_across_page (CuTest *test)
+static void spi_flash_test_read_start_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t data[] = {1, 2, 3, 4};
-	uint8_t cmd_expected[] = {0x01};
-	uint8_t cmd2_expected[] = {0x02, 0x03, 0x04};
-	uint8_t read_status = 0;
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
+	uint8_t wip_status = 0;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_enable_async_xfer (&mock);
+
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
+	status = spi_flash_set_device_size (&flash, 0x2000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x12ff, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer_start (&mock, 0, data, length,
+		FLASH_EXP_READ_4B_CMD (0x13, 0x1234, 0, data_in, length));
+	status |= flash_master_mock_expect_xfer_wait (&mock, 0);
 
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, cmd2_expected, sizeof (cmd2_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_read_start (&flash, 0x1234, data_in, length);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x12ff, data, sizeof (data));
-	CuAssertIntEquals (test, sizeof (data), status);
+	status = spi_flash_read_wait (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data, data_in, length);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_multiple_pages (CuTest *test)
+static void spi_flash_test_read_start_flash_api (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t data[FLASH_PAGE_SIZE * 2];
-	uint8_t page1_expected[FLASH_PAGE_SIZE];
-	uint8_t page2_expected[FLASH_PAGE_SIZE];
-	uint8_t read_status = 0;
-	int i;
+	uint8_t data[] = {1, 2, 3, 4};
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
+	uint8_t wip_status = 0;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_enable_async_xfer (&mock);
+
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	for (i = 0; i < FLASH_PAGE_SIZE; i++) {
-		data[i] = i;
-		page1_expected[i] = i;
-	}
-	for (i = FLASH_PAGE_SIZE - 1; i >= 0; i--) {
-		data[FLASH_PAGE_SIZE + i] = i;
-		page2_expected[i] = i;
-	}
-
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1200, 0, page1_expected, sizeof (page1_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer_start (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
+	status |= flash_master_mock_expect_xfer_wait (&mock, 0);
 
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, page2_expected, sizeof (page2_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	CuAssertIntEquals (test, 0, status);
 
+	status = flash.base.read_start (&flash.base, 0x1234, data_in, length);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1200, data, sizeof (data));
-	CuAssertIntEquals (test, sizeof (data), status);
+	status = flash.base.read_wait (&flash.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	status = testing_validate_array (data, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_multiple_pages_not_aligned (CuTest *test)
+static void spi_flash_test_read_start_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t data[FLASH_PAGE_SIZE * 2];
-	uint8_t page1_expected[0x10] = {0x02, 0x00, 0x12, 0xf0};
-	uint8_t page2_expected[FLASH_PAGE_SIZE] = {0x02, 0x00, 0x13, 0x00};
-	uint8_t page3_expected[FLASH_PAGE_SIZE - 0x10] = {0x02, 0x00, 0x14, 0x00};
-	uint8_t read_status = 0;
-	int i;
-	uint8_t *pos;
+	uint8_t data_in[4];
+	size_t length = sizeof (data_in);
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_enable_async_xfer (&mock);
+
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	for (i = 0; i < FLASH_PAGE_SIZE; i++) {
-		data[i] = i;
-	}
-	for (i = FLASH_PAGE_SIZE - 1; i >= 0; i--) {
-		data[FLASH_PAGE_SIZE + i] = i;
-	}
-
-	pos = data;
-	for (i = 0; i < 0x10; i++, pos++) {
-		page1_expected[i] = *pos;
-	}
-	for (i = 0; i < FLASH_PAGE_SIZE; i++, pos++) {
-		page2_expected[i] = *pos;
-	}
-	for (i = 0; i < FLASH_PAGE_SIZE - 0x10; i++, pos++) {
-		page3_expected[i] = *pos;
-	}
-
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x12f0, 0, page1_expected, sizeof (page1_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, page2_expected, sizeof (page2_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1400, 0, page3_expected, sizeof (page3_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_read_start (NULL, 0x1234, data_in, length);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
-	status = spi_flash_write (&flash, 0x12f0, data, sizeof (data));
-	CuAssertIntEquals (test, sizeof (data), status);
+	status = spi_flash_read_start (&flash, 0x1234, NULL, length);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
@@ -8297,14 +8285,14 @@ static void spi_flash_test_write_multiple_pages_not_aligned (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_max_address (CuTest *test)
+static void spi_flash_test_read_start_not_supported (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01};
-	uint8_t read_status = 0;
+	uint8_t data_in[4];
+	size_t length = sizeof (data_in);
 
 	TEST_START;
 
@@ -8317,153 +8305,137 @@ static void spi_flash_test_write_max_address (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0xffffff, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_write (&flash, 0xffffff, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_read_start (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, SPI_FLASH_ASYNC_READ_NOT_SUPPORTED, status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_4byte (CuTest *test)
+static void spi_flash_test_read_start_out_of_range (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t read_status = 0;
+	uint8_t data_in[4];
+	size_t length = sizeof (data_in);
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_enable_async_xfer (&mock);
+
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash, 0x2000000);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_read_start (&flash, 0x1000000, data_in, length);
+	CuAssertIntEquals (test, SPI_FLASH_ADDRESS_OUT_OF_RANGE, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_read_start (&flash, 0xfffffd, data_in, length);
+	CuAssertIntEquals (test, SPI_FLASH_OPERATION_OUT_OF_RANGE, status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_api (CuTest *test)
+static void spi_flash_test_read_start_error_in_progress (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t read_status = 0;
+	const size_t length = 4;
+	uint8_t data_in[length];
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_enable_async_xfer (&mock);
+
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.write (&flash.base, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_read_start (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
 
-	status = mock_validate (&mock.mock);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_read_wait (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_NO_ASYNC_READ, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_switch_4byte_address (CuTest *test)
+static void spi_flash_test_read_start_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t read_status = 0;
+	uint8_t data[] = {1, 2, 3, 4};
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
+	uint8_t wip_status = 0;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_enable_async_xfer (&mock);
+
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	/* A small device that supports switching address modes is not a normal scenario.  Override the
-	 * internal capabilities to allow it to happen.  If the device size was just increased, the
-	 * native 4 byte commands would be used. */
-	state.capabilities = (FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR);
-
-	status = flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xb7));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_4B_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= mock_expect (&mock.mock, mock.base.xfer_start, &mock, FLASH_MASTER_XFER_FAILED,
+		MOCK_ARG (0x03), MOCK_ARG (0x1234), MOCK_ARG (0), MOCK_ARG (0), MOCK_ARG (data_in),
+		MOCK_ARG (length), MOCK_ARG (0));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_enable_4byte_address_mode (&flash, 1);
+	status = spi_flash_read_start (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = spi_flash_read_wait (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_NO_ASYNC_READ, status);
+
+	/* The flash must be unlocked after a failure. */
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, 4, status);
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
@@ -8471,133 +8443,98 @@ static void spi_flash_test_write_switch_4byte_address (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_1_1_1_3byte_only (CuTest *test)
+static void spi_flash_test_read_wait_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_read_wait (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_read_wait_no_read (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8020e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	flash_master_mock_enable_async_xfer (&mock);
 
+	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_read_wait (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_NO_ASYNC_READ, status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_1_1_1_3byte_4byte (CuTest *test)
+static void spi_flash_test_read_wait_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8220e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
+	uint8_t data[] = {1, 2, 3, 4};
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
+	uint8_t wip_status = 0;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	flash_master_mock_enable_async_xfer (&mock);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer_start (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
+	status |= flash_master_mock_expect_xfer_wait (&mock, FLASH_MASTER_XFER_DMA_ERROR);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_read_start (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read_wait (&flash);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_DMA_ERROR, status);
+
+	/* The flash must be unlocked after a failure. */
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
 
-	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_1_1_1_4byte_only (CuTest *test)
+static void spi_flash_test_write (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -8605,44 +8542,23 @@ static void spi_flash_test_write_flash_1_1_1_4byte_only (CuTest *test)
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8420e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_4B_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
@@ -8660,247 +8576,215 @@ static void spi_flash_test_write_flash_1_1_1_4byte_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_1_1_2_3byte_4byte (CuTest *test)
+static void spi_flash_test_write_across_page (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t cmd_expected[] = {0x01};
+	uint8_t cmd2_expected[] = {0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8320e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff003b08,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+		FLASH_EXP_WRITE_CMD (0x02, 0x12ff, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, cmd2_expected, sizeof (cmd2_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_write (&flash, 0x12ff, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_1_2_2_3byte_4byte (CuTest *test)
+static void spi_flash_test_write_multiple_pages (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t data[FLASH_PAGE_SIZE * 2];
+	uint8_t page1_expected[FLASH_PAGE_SIZE];
+	uint8_t page2_expected[FLASH_PAGE_SIZE];
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff9320e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xbb043b08,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
+	int i;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < FLASH_PAGE_SIZE; i++) {
+		data[i] = i;
+		page1_expected[i] = i;
+	}
+	for (i = FLASH_PAGE_SIZE - 1; i >= 0; i--) {
+		data[FLASH_PAGE_SIZE + i] = i;
+		page2_expected[i] = i;
+	}
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+		FLASH_EXP_WRITE_CMD (0x02, 0x1200, 0, page1_expected, sizeof (page1_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, page2_expected, sizeof (page2_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_write (&flash, 0x1200, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_2_2_2_3byte_4byte (CuTest *test)
+static void spi_flash_test_write_multiple_pages_not_aligned (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t data[FLASH_PAGE_SIZE * 2];
+	uint8_t page1_expected[0x10] = {0x02, 0x00, 0x12, 0xf0};
+	uint8_t page2_expected[FLASH_PAGE_SIZE] = {0x02, 0x00, 0x13, 0x00};
+	uint8_t page3_expected[FLASH_PAGE_SIZE - 0x10] = {0x02, 0x00, 0x14, 0x00};
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff9320e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
+	int i;
+	uint8_t *pos;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < FLASH_PAGE_SIZE; i++) {
+		data[i] = i;
+	}
+	for (i = FLASH_PAGE_SIZE - 1; i >= 0; i--) {
+		data[FLASH_PAGE_SIZE + i] = i;
+	}
+
+	pos = data;
+	for (i = 0; i < 0x10; i++, pos++) {
+		page1_expected[i] = *pos;
+	}
+	for (i = 0; i < FLASH_PAGE_SIZE; i++, pos++) {
+		page2_expected[i] = *pos;
+	}
+	for (i = 0; i < FLASH_PAGE_SIZE - 0x10; i++, pos++) {
+		page3_expected[i] = *pos;
+	}
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+		FLASH_EXP_WRITE_CMD (0x02, 0x12f0, 0, page1_expected, sizeof (page1_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, page2_expected, sizeof (page2_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1400, 0, page3_expected, sizeof (page3_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_write (&flash, 0x12f0, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_1_1_4_3byte_4byte (CuTest *test)
+static void spi_flash_test_write_max_address (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t cmd_expected[] = {0x01};
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xffd320e5,
-		0x00ffffff,
-		0x6b08ff00,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff288000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+		FLASH_EXP_WRITE_CMD (0x02, 0xffffff, 0, cmd_expected, sizeof (cmd_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	status = spi_flash_write (&flash, 0xffffff, cmd_expected, sizeof (cmd_expected));
 	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
@@ -8912,7 +8796,7 @@ static void spi_flash_test_write_flash_1_1_4_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_1_4_4_3byte_4byte (CuTest *test)
+static void spi_flash_test_write_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -8920,38 +8804,17 @@ static void spi_flash_test_write_flash_1_4_4_3byte_4byte (CuTest *test)
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xfff320e5,
-		0x00ffffff,
-		0x6b08eb44,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff288000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x2000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
@@ -8975,7 +8838,7 @@ static void spi_flash_test_write_flash_1_4_4_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flash_4_4_4_3byte_4byte (CuTest *test)
+static void spi_flash_test_write_flash_api (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -8983,50 +8846,29 @@ static void spi_flash_test_write_flash_4_4_4_3byte_4byte (CuTest *test)
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xfff320e5,
-		0x00ffffff,
-		0x6b08eb44,
-		0xbb043b08,
-		0xffffffff,
-		0xbb04ffff,
-		0xeb44ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff288000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	status = flash.base.write (&flash.base, 0x1234, cmd_expected, sizeof (cmd_expected));
 	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
@@ -9038,14 +8880,62 @@ static void spi_flash_test_write_flash_4_4_4_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_flag_status_register (CuTest *test)
+static void spi_flash_test_write_switch_4byte_address (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t read_status = FLASH_FLAG_STATUS_READY;
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	/* A small device that supports switching address modes is not a normal scenario.  Override the
+	 * internal capabilities to allow it to happen.  If the device size was just increased, the
+	 * native 4 byte commands would be used. */
+	state.capabilities = (FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR);
+
+	status = flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xb7));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_4B_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_enable_4byte_address_mode (&flash, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, 4, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_flash_1_1_1_3byte_only (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
 	uint32_t header[] = {
 		0x50444653,
 		0xff010106,
@@ -9066,23 +8956,26 @@ static void spi_flash_test_write_flag_status_register (CuTest *test)
 		0xb314ea82,
 		0x337663e9,
 		0x757a757a,
-		0x5cd5a2fb,
+		0x5cd5a2f7,
 		0xff088000,
-		0x80f820e9
+		0xa1f860e9
 	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
 	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
+		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
 		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -9098,31 +8991,52 @@ static void spi_flash_test_write_flag_status_register (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_static (CuTest *test)
+static void spi_flash_test_write_flash_1_1_1_3byte_4byte (CuTest *test)
 {
-	struct flash_master_mock mock;
 	struct spi_flash_state state;
-	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_API_INIT, &state, &mock.base);
+	struct spi_flash flash;
+	struct flash_master_mock mock;
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8220e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init_state (&flash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
@@ -9140,28 +9054,59 @@ static void spi_flash_test_write_static (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_static_read_only (CuTest *test)
+static void spi_flash_test_write_flash_1_1_1_4byte_only (CuTest *test)
 {
-	struct flash_master_mock mock;
 	struct spi_flash_state state;
-	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
-		&mock.base);
+	struct spi_flash flash;
+	struct flash_master_mock mock;
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8420e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
-	status = spi_flash_init_state (&flash);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_4B_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.write (&flash.base, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9172,58 +9117,122 @@ static void spi_flash_test_write_static_read_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_null (CuTest *test)
+static void spi_flash_test_write_flash_1_1_2_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8320e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff003b08,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (NULL, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
-
-	status = spi_flash_write (&flash, 0x1234, NULL, sizeof (cmd_expected));
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_out_of_range (CuTest *test)
+static void spi_flash_test_write_flash_1_2_2_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff9320e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xbb043b08,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	TEST_START;
-
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1000000, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, SPI_FLASH_ADDRESS_OUT_OF_RANGE, status);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9234,27 +9243,59 @@ static void spi_flash_test_write_out_of_range (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_too_long (CuTest *test)
+static void spi_flash_test_write_flash_2_2_2_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff9320e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0xfffffd, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, SPI_FLASH_OPERATION_OUT_OF_RANGE, status);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9265,7 +9306,7 @@ static void spi_flash_test_write_too_long (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_error_enable (CuTest *test)
+static void spi_flash_test_write_flash_1_1_4_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -9273,27 +9314,51 @@ static void spi_flash_test_write_error_enable (CuTest *test)
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xffd320e5,
+		0x00ffffff,
+		0x6b08ff00,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff288000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9304,7 +9369,7 @@ static void spi_flash_test_write_error_enable (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_error_write (CuTest *test)
+static void spi_flash_test_write_flash_1_4_4_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -9312,28 +9377,51 @@ static void spi_flash_test_write_error_write (CuTest *test)
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xfff320e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff288000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9344,42 +9432,59 @@ static void spi_flash_test_write_error_write (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_error_second_page (CuTest *test)
+static void spi_flash_test_write_flash_4_4_4_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t data[] = {1, 2, 3, 4};
-	uint8_t cmd_expected[] = {0x01};
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xfff320e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb043b08,
+		0xffffffff,
+		0xbb04ffff,
+		0xeb44ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff288000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x12ff, 0, cmd_expected, sizeof (cmd_expected)));
+		FLASH_EXP_WRITE_4B_CMD (0x12, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
-	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_WRITE_ENABLE);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x12ff, data, sizeof (data));
-	CuAssertIntEquals (test, 1, status);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9390,51 +9495,14 @@ static void spi_flash_test_write_error_second_page (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_error_in_progress (CuTest *test)
+static void spi_flash_test_write_flag_status_register (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t wip_status = FLASH_STATUS_WIP;
-
-	TEST_START;
-
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
-
-	status = mock_validate (&mock.mock);
-	CuAssertIntEquals (test, 0, status);
-
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
-	spi_flash_release (&flash);
-}
-
-static void spi_flash_test_write_error_in_progress_flag_status_register (CuTest *test)
-{
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	struct flash_master_mock mock;
-	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t wip_status = 0;
+	uint8_t read_status = FLASH_FLAG_STATUS_READY;
 	uint32_t header[] = {
 		0x50444653,
 		0xff010106,
@@ -9465,13 +9533,18 @@ static void spi_flash_test_write_error_in_progress_flag_status_register (CuTest
 	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
 		sizeof (params), 0x000030, FULL_CAPABILITIES);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_FLAG_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9482,32 +9555,38 @@ static void spi_flash_test_write_error_in_progress_flag_status_register (CuTest
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_status_error (CuTest *test)
+static void spi_flash_test_write_static (CuTest *test)
 {
-	struct spi_flash_state state;
-	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_state state;
+	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_API_INIT, &state, &mock.base);
 	int status;
 	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
+	status = spi_flash_init_state (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9518,13 +9597,45 @@ static void spi_flash_test_write_status_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase (CuTest *test)
+static void spi_flash_test_write_static_read_only (CuTest *test)
+{
+	struct flash_master_mock mock;
+	struct spi_flash_state state;
+	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
+		&mock.base);
+	int status;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init_state (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash.base.write (&flash.base, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -9537,18 +9648,40 @@ static void spi_flash_test_sector_erase (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status = spi_flash_write (NULL, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
+	status = spi_flash_write (&flash, 0x1234, NULL, sizeof (cmd_expected));
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1000);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_out_of_range (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_write (&flash, 0x1000000, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, SPI_FLASH_ADDRESS_OUT_OF_RANGE, status);
+
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -9558,13 +9691,13 @@ static void spi_flash_test_sector_erase (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_offset_address (CuTest *test)
+static void spi_flash_test_write_too_long (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -9577,30 +9710,25 @@ static void spi_flash_test_sector_erase_offset_address (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_write (&flash, 0xfffffd, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, SPI_FLASH_OPERATION_OUT_OF_RANGE, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1200);
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_is_write_in_progress (&flash);
 
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_max_address (CuTest *test)
+static void spi_flash_test_write_error_enable (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
 
 	TEST_START;
@@ -9616,15 +9744,13 @@ static void spi_flash_test_sector_erase_max_address (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0xfff000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_WRITE_ENABLE);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (&flash, 0xffffff);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9635,12 +9761,13 @@ static void spi_flash_test_sector_erase_max_address (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_4byte (CuTest *test)
+static void spi_flash_test_write_error_write (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t read_status = 0;
 
 	TEST_START;
@@ -9651,20 +9778,19 @@ static void spi_flash_test_sector_erase_4byte (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash, 0x2000000);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_tx_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1000);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9675,12 +9801,14 @@ static void spi_flash_test_sector_erase_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_api (CuTest *test)
+static void spi_flash_test_write_error_second_page (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t cmd_expected[] = {0x01};
 	uint8_t read_status = 0;
 
 	TEST_START;
@@ -9697,15 +9825,19 @@ static void spi_flash_test_sector_erase_flash_api (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x12ff, 0, cmd_expected, sizeof (cmd_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_WRITE_ENABLE);
 
-	status = flash.base.sector_erase (&flash.base, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_write (&flash, 0x12ff, data, sizeof (data));
+	CuAssertIntEquals (test, 1, status);
+
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -9715,13 +9847,14 @@ static void spi_flash_test_sector_erase_flash_api (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_switch_4byte_address (CuTest *test)
+static void spi_flash_test_write_error_in_progress (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
@@ -9734,40 +9867,31 @@ static void spi_flash_test_sector_erase_switch_4byte_address (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	/* A small device that supports switching address modes is not a normal scenario.  Override the
-	 * internal capabilities to allow it to happen.  If the device size was just increased, the
-	 * native 4 byte commands would be used. */
-	state.capabilities = (FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR);
-
-	status = flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xb7));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x20, 0x1000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_enable_4byte_address_mode (&flash, 1);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1000);
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_is_write_in_progress (&flash);
 
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_1_1_1_3byte_only (CuTest *test)
+static void spi_flash_test_write_error_in_progress_flag_status_register (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t wip_status = 0;
 	uint32_t header[] = {
 		0x50444653,
 		0xff010106,
@@ -9788,30 +9912,23 @@ static void spi_flash_test_sector_erase_flash_1_1_1_3byte_only (CuTest *test)
 		0xb314ea82,
 		0x337663e9,
 		0x757a757a,
-		0x5cd5a2f7,
+		0x5cd5a2fb,
 		0xff088000,
-		0xa1f860e9
+		0x80f820e9
 	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
 	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1000);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -9822,58 +9939,33 @@ static void spi_flash_test_sector_erase_flash_1_1_1_3byte_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_1_1_1_3byte_4byte (CuTest *test)
+static void spi_flash_test_write_status_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8220e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1000);
+	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -9883,50 +9975,29 @@ static void spi_flash_test_sector_erase_flash_1_1_1_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_1_1_1_4byte_only (CuTest *test)
+static void spi_flash_test_sector_erase (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8420e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
@@ -9944,117 +10015,72 @@ static void spi_flash_test_sector_erase_flash_1_1_1_4byte_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_1_1_2_3byte_4byte (CuTest *test)
+static void spi_flash_test_sector_erase_offset_address (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8320e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff003b08,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1000);
+	status = spi_flash_sector_erase (&flash, 0x1200);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_1_2_2_3byte_4byte (CuTest *test)
+static void spi_flash_test_sector_erase_max_address (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff9320e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xbb043b08,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0xfff000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1000);
+	status = spi_flash_sector_erase (&flash, 0xffffff);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
@@ -10066,45 +10092,24 @@ static void spi_flash_test_sector_erase_flash_1_2_2_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_2_2_2_3byte_4byte (CuTest *test)
+static void spi_flash_test_sector_erase_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff9320e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x2000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
@@ -10127,56 +10132,35 @@ static void spi_flash_test_sector_erase_flash_2_2_2_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_1_1_4_3byte_4byte (CuTest *test)
+static void spi_flash_test_sector_erase_flash_api (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xffd320e5,
-		0x00ffffff,
-		0x6b08ff00,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff288000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1000);
+	status = flash.base.sector_erase (&flash.base, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
@@ -10188,26 +10172,72 @@ static void spi_flash_test_sector_erase_flash_1_1_4_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_1_4_4_3byte_4byte (CuTest *test)
+static void spi_flash_test_sector_erase_switch_4byte_address (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xfff320e5,
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	/* A small device that supports switching address modes is not a normal scenario.  Override the
+	 * internal capabilities to allow it to happen.  If the device size was just increased, the
+	 * native 4 byte commands would be used. */
+	state.capabilities = (FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR);
+
+	status = flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xb7));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_enable_4byte_address_mode (&flash, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_sector_erase_flash_1_1_1_3byte_only (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8020e5,
 		0x00ffffff,
-		0x6b08eb44,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
 		0xff00ffff,
 		0xd810200c,
 		0xff00ff00,
@@ -10216,7 +10246,7 @@ static void spi_flash_test_sector_erase_flash_1_4_4_3byte_4byte (CuTest *test)
 		0x337663e9,
 		0x757a757a,
 		0x5cd5a2f7,
-		0xff288000,
+		0xff088000,
 		0xa1f860e9
 	};
 	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
@@ -10231,7 +10261,7 @@ static void spi_flash_test_sector_erase_flash_1_4_4_3byte_4byte (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
@@ -10249,7 +10279,7 @@ static void spi_flash_test_sector_erase_flash_1_4_4_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flash_4_4_4_3byte_4byte (CuTest *test)
+static void spi_flash_test_sector_erase_flash_1_1_1_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -10263,13 +10293,13 @@ static void spi_flash_test_sector_erase_flash_4_4_4_3byte_4byte (CuTest *test)
 		0xff000030
 	};
 	uint32_t params[] = {
-		0xfff320e5,
+		0xff8220e5,
 		0x00ffffff,
-		0x6b08eb44,
-		0xbb043b08,
-		0xffffffff,
-		0xbb04ffff,
-		0xeb44ffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
 		0xd810200c,
 		0xff00ff00,
 		0x00a60236,
@@ -10277,7 +10307,7 @@ static void spi_flash_test_sector_erase_flash_4_4_4_3byte_4byte (CuTest *test)
 		0x337663e9,
 		0x757a757a,
 		0x5cd5a2f7,
-		0xff288000,
+		0xff088000,
 		0xa1f860e9
 	};
 	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
@@ -10310,13 +10340,13 @@ static void spi_flash_test_sector_erase_flash_4_4_4_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_flag_status_register (CuTest *test)
+static void spi_flash_test_sector_erase_flash_1_1_1_4byte_only (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = FLASH_FLAG_STATUS_READY;
+	uint8_t read_status = 0;
 	uint32_t header[] = {
 		0x50444653,
 		0xff010106,
@@ -10324,7 +10354,7 @@ static void spi_flash_test_sector_erase_flag_status_register (CuTest *test)
 		0xff000030
 	};
 	uint32_t params[] = {
-		0xff8020e5,
+		0xff8420e5,
 		0x00ffffff,
 		0xff00ff00,
 		0xff00ff00,
@@ -10337,22 +10367,25 @@ static void spi_flash_test_sector_erase_flag_status_register (CuTest *test)
 		0xb314ea82,
 		0x337663e9,
 		0x757a757a,
-		0x5cd5a2fb,
+		0x5cd5a2f7,
 		0xff088000,
-		0x80f820e9
+		0xa1f860e9
 	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
 	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
+		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x20, 0x1000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -10368,29 +10401,50 @@ static void spi_flash_test_sector_erase_flag_status_register (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_static (CuTest *test)
+static void spi_flash_test_sector_erase_flash_1_1_2_3byte_4byte (CuTest *test)
 {
-	struct flash_master_mock mock;
 	struct spi_flash_state state;
-	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_API_INIT, &state, &mock.base);
+	struct spi_flash flash;
+	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8320e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff003b08,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init_state (&flash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
@@ -10408,27 +10462,57 @@ static void spi_flash_test_sector_erase_static (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_static_read_only (CuTest *test)
+static void spi_flash_test_sector_erase_flash_1_2_2_3byte_4byte (CuTest *test)
 {
-	struct flash_master_mock mock;
 	struct spi_flash_state state;
-	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
-		&mock.base);
+	struct spi_flash flash;
+	struct flash_master_mock mock;
 	int status;
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff9320e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xbb043b08,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
-	status = spi_flash_init_state (&flash);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.sector_erase (&flash.base, 0x1000);
-	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10439,53 +10523,118 @@ static void spi_flash_test_sector_erase_static_read_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_null (CuTest *test)
+static void spi_flash_test_sector_erase_flash_2_2_2_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff9320e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (NULL, 0x1000);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_out_of_range (CuTest *test)
+static void spi_flash_test_sector_erase_flash_1_1_4_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xffd320e5,
+		0x00ffffff,
+		0x6b08ff00,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff288000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
+
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_sector_erase (&flash, 0x1000000);
-	CuAssertIntEquals (test, SPI_FLASH_ADDRESS_OUT_OF_RANGE, status);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10496,34 +10645,57 @@ static void spi_flash_test_sector_erase_out_of_range (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_error_enable (CuTest *test)
+static void spi_flash_test_sector_erase_flash_1_4_4_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xfff320e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff288000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_sector_erase (&flash, 0x1000);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10534,32 +10706,57 @@ static void spi_flash_test_sector_erase_error_enable (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_error_in_progress (CuTest *test)
+static void spi_flash_test_sector_erase_flash_4_4_4_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t wip_status = FLASH_STATUS_WIP;
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xfff320e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb043b08,
+		0xffffffff,
+		0xbb04ffff,
+		0xeb44ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff288000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_sector_erase (&flash, 0x1000);
-	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10570,13 +10767,13 @@ static void spi_flash_test_sector_erase_error_in_progress (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_error_in_progress_flag_status_register (CuTest *test)
+static void spi_flash_test_sector_erase_flag_status_register (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t wip_status = 0;
+	uint8_t read_status = FLASH_FLAG_STATUS_READY;
 	uint32_t header[] = {
 		0x50444653,
 		0xff010106,
@@ -10607,13 +10804,17 @@ static void spi_flash_test_sector_erase_error_in_progress_flag_status_register (
 	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
 		sizeof (params), 0x000030, FULL_CAPABILITIES);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_FLAG_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_sector_erase (&flash, 0x1000);
-	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10624,31 +10825,36 @@ static void spi_flash_test_sector_erase_error_in_progress_flag_status_register (
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_status_error (CuTest *test)
+static void spi_flash_test_sector_erase_static (CuTest *test)
 {
-	struct spi_flash_state state;
-	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_state state;
+	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_API_INIT, &state, &mock.base);
 	int status;
+	uint8_t read_status = 0;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
+	status = spi_flash_init_state (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_sector_erase (&flash, 0x1000);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10659,35 +10865,27 @@ static void spi_flash_test_sector_erase_status_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_error (CuTest *test)
+static void spi_flash_test_sector_erase_static_read_only (CuTest *test)
 {
-	struct spi_flash_state state;
-	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_state state;
+	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
+		&mock.base);
 	int status;
-	uint8_t read_status = 0;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
+	status = spi_flash_init_state (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_ERASE_CMD (0x20, 0x1000));
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_sector_erase (&flash, 0x1000);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	status = flash.base.sector_erase (&flash.base, 0x1000);
+	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10698,13 +10896,12 @@ static void spi_flash_test_sector_erase_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_sector_erase_wait_error (CuTest *test)
+static void spi_flash_test_sector_erase_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -10717,34 +10914,21 @@ static void spi_flash_test_sector_erase_wait_error (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
-	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_STATUS_REG);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_sector_erase (&flash, 0x1000);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	status = spi_flash_sector_erase (NULL, 0x1000);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase (CuTest *test)
+static void spi_flash_test_sector_erase_out_of_range (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -10757,17 +10941,8 @@ static void spi_flash_test_block_erase (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_block_erase (&flash, 0x10000);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_sector_erase (&flash, 0x1000000);
+	CuAssertIntEquals (test, SPI_FLASH_ADDRESS_OUT_OF_RANGE, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10778,7 +10953,7 @@ static void spi_flash_test_block_erase (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_offset_address (CuTest *test)
+static void spi_flash_test_sector_erase_error_enable (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -10799,29 +10974,30 @@ static void spi_flash_test_block_erase_offset_address (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_WRITE_ENABLE);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_block_erase (&flash, 0x12000);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_max_address (CuTest *test)
+static void spi_flash_test_sector_erase_error_in_progress (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
@@ -10834,18 +11010,68 @@ static void spi_flash_test_block_erase_max_address (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0xff0000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_block_erase (&flash, 0xffffff);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_sector_erase_error_in_progress_flag_status_register (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t wip_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8020e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2fb,
+		0xff088000,
+		0x80f820e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
+
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -10855,13 +11081,12 @@ static void spi_flash_test_block_erase_max_address (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_4byte (CuTest *test)
+static void spi_flash_test_sector_erase_status_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -10871,20 +11096,16 @@ static void spi_flash_test_block_erase_4byte (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash, 0x2000000);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xdc, 0x10000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_block_erase (&flash, 0x10000);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10895,7 +11116,7 @@ static void spi_flash_test_block_erase_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_api (CuTest *test)
+static void spi_flash_test_sector_erase_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -10917,14 +11138,13 @@ static void spi_flash_test_block_erase_flash_api (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_ERASE_CMD (0x20, 0x1000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.block_erase (&flash.base, 0x10000);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -10935,7 +11155,7 @@ static void spi_flash_test_block_erase_flash_api (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_switch_4byte_address (CuTest *test)
+static void spi_flash_test_sector_erase_wait_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -10954,72 +11174,45 @@ static void spi_flash_test_block_erase_switch_4byte_address (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	/* A small device that supports switching address modes is not a normal scenario.  Override the
-	 * internal capabilities to allow it to happen.  If the device size was just increased, the
-	 * native 4 byte commands would be used. */
-	state.capabilities = (FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR);
-
-	status = flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xb7));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xd8, 0x10000));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_enable_4byte_address_mode (&flash, 1);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
-	status = spi_flash_block_erase (&flash, 0x10000);
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_is_write_in_progress (&flash);
 
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_1_1_1_3byte_only (CuTest *test)
+static void spi_flash_test_block_erase (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8020e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
@@ -11042,117 +11235,72 @@ static void spi_flash_test_block_erase_flash_1_1_1_3byte_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_1_1_1_3byte_4byte (CuTest *test)
+static void spi_flash_test_block_erase_offset_address (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8220e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xdc, 0x10000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_block_erase (&flash, 0x10000);
+	status = spi_flash_block_erase (&flash, 0x12000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_1_1_1_4byte_only (CuTest *test)
+static void spi_flash_test_block_erase_max_address (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8420e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xd8, 0x10000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0xff0000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_block_erase (&flash, 0x10000);
+	status = spi_flash_block_erase (&flash, 0xffffff);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
@@ -11164,45 +11312,24 @@ static void spi_flash_test_block_erase_flash_1_1_1_4byte_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_1_1_2_3byte_4byte (CuTest *test)
+static void spi_flash_test_block_erase_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8320e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff003b08,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
-	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
-		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
-		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, capabilities);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x2000000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
@@ -11225,7 +11352,93 @@ static void spi_flash_test_block_erase_flash_1_1_2_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_1_2_2_3byte_4byte (CuTest *test)
+static void spi_flash_test_block_erase_flash_api (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash.base.block_erase (&flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_block_erase_switch_4byte_address (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	/* A small device that supports switching address modes is not a normal scenario.  Override the
+	 * internal capabilities to allow it to happen.  If the device size was just increased, the
+	 * native 4 byte commands would be used. */
+	state.capabilities = (FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR);
+
+	status = flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xb7));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xd8, 0x10000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_enable_4byte_address_mode (&flash, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_block_erase (&flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_block_erase_flash_1_1_1_3byte_only (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -11239,10 +11452,10 @@ static void spi_flash_test_block_erase_flash_1_2_2_3byte_4byte (CuTest *test)
 		0xff000030
 	};
 	uint32_t params[] = {
-		0xff9320e5,
+		0xff8020e5,
 		0x00ffffff,
 		0xff00ff00,
-		0xbb043b08,
+		0xff00ff00,
 		0xffffffee,
 		0xff00ffff,
 		0xff00ffff,
@@ -11268,7 +11481,7 @@ static void spi_flash_test_block_erase_flash_1_2_2_3byte_4byte (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xdc, 0x10000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
@@ -11286,7 +11499,7 @@ static void spi_flash_test_block_erase_flash_1_2_2_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_2_2_2_3byte_4byte (CuTest *test)
+static void spi_flash_test_block_erase_flash_1_1_1_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -11300,12 +11513,12 @@ static void spi_flash_test_block_erase_flash_2_2_2_3byte_4byte (CuTest *test)
 		0xff000030
 	};
 	uint32_t params[] = {
-		0xff9320e5,
+		0xff8220e5,
 		0x00ffffff,
 		0xff00ff00,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
 		0xff00ffff,
 		0xd810200c,
 		0xff00ff00,
@@ -11347,7 +11560,7 @@ static void spi_flash_test_block_erase_flash_2_2_2_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_1_1_4_3byte_4byte (CuTest *test)
+static void spi_flash_test_block_erase_flash_1_1_1_4byte_only (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -11361,12 +11574,12 @@ static void spi_flash_test_block_erase_flash_1_1_4_3byte_4byte (CuTest *test)
 		0xff000030
 	};
 	uint32_t params[] = {
-		0xffd320e5,
+		0xff8420e5,
 		0x00ffffff,
-		0x6b08ff00,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
 		0xff00ffff,
 		0xd810200c,
 		0xff00ff00,
@@ -11375,7 +11588,7 @@ static void spi_flash_test_block_erase_flash_1_1_4_3byte_4byte (CuTest *test)
 		0x337663e9,
 		0x757a757a,
 		0x5cd5a2f7,
-		0xff288000,
+		0xff088000,
 		0xa1f860e9
 	};
 	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
@@ -11390,7 +11603,7 @@ static void spi_flash_test_block_erase_flash_1_1_4_3byte_4byte (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xdc, 0x10000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xd8, 0x10000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
@@ -11408,7 +11621,7 @@ static void spi_flash_test_block_erase_flash_1_1_4_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_1_4_4_3byte_4byte (CuTest *test)
+static void spi_flash_test_block_erase_flash_1_1_2_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -11422,12 +11635,12 @@ static void spi_flash_test_block_erase_flash_1_4_4_3byte_4byte (CuTest *test)
 		0xff000030
 	};
 	uint32_t params[] = {
-		0xfff320e5,
+		0xff8320e5,
 		0x00ffffff,
-		0x6b08eb44,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
+		0xff00ff00,
+		0xff003b08,
+		0xffffffee,
+		0xff00ffff,
 		0xff00ffff,
 		0xd810200c,
 		0xff00ff00,
@@ -11436,7 +11649,7 @@ static void spi_flash_test_block_erase_flash_1_4_4_3byte_4byte (CuTest *test)
 		0x337663e9,
 		0x757a757a,
 		0x5cd5a2f7,
-		0xff288000,
+		0xff088000,
 		0xa1f860e9
 	};
 	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
@@ -11469,7 +11682,7 @@ static void spi_flash_test_block_erase_flash_1_4_4_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flash_4_4_4_3byte_4byte (CuTest *test)
+static void spi_flash_test_block_erase_flash_1_2_2_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -11483,13 +11696,13 @@ static void spi_flash_test_block_erase_flash_4_4_4_3byte_4byte (CuTest *test)
 		0xff000030
 	};
 	uint32_t params[] = {
-		0xfff320e5,
+		0xff9320e5,
 		0x00ffffff,
-		0x6b08eb44,
+		0xff00ff00,
 		0xbb043b08,
-		0xffffffff,
-		0xbb04ffff,
-		0xeb44ffff,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
 		0xd810200c,
 		0xff00ff00,
 		0x00a60236,
@@ -11497,7 +11710,7 @@ static void spi_flash_test_block_erase_flash_4_4_4_3byte_4byte (CuTest *test)
 		0x337663e9,
 		0x757a757a,
 		0x5cd5a2f7,
-		0xff288000,
+		0xff088000,
 		0xa1f860e9
 	};
 	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
@@ -11530,13 +11743,13 @@ static void spi_flash_test_block_erase_flash_4_4_4_3byte_4byte (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_flag_status_register (CuTest *test)
+static void spi_flash_test_block_erase_flash_2_2_2_3byte_4byte (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = FLASH_FLAG_STATUS_READY;
+	uint8_t read_status = 0;
 	uint32_t header[] = {
 		0x50444653,
 		0xff010106,
@@ -11544,12 +11757,12 @@ static void spi_flash_test_block_erase_flag_status_register (CuTest *test)
 		0xff000030
 	};
 	uint32_t params[] = {
-		0xff8020e5,
+		0xff9320e5,
 		0x00ffffff,
 		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
 		0xff00ffff,
 		0xd810200c,
 		0xff00ff00,
@@ -11557,22 +11770,25 @@ static void spi_flash_test_block_erase_flag_status_register (CuTest *test)
 		0xb314ea82,
 		0x337663e9,
 		0x757a757a,
-		0x5cd5a2fb,
+		0x5cd5a2f7,
 		0xff088000,
-		0x80f820e9
+		0xa1f860e9
 	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
 	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
+		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xdc, 0x10000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -11588,29 +11804,50 @@ static void spi_flash_test_block_erase_flag_status_register (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_static (CuTest *test)
+static void spi_flash_test_block_erase_flash_1_1_4_3byte_4byte (CuTest *test)
 {
-	struct flash_master_mock mock;
 	struct spi_flash_state state;
-	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_API_INIT, &state, &mock.base);
+	struct spi_flash flash;
+	struct flash_master_mock mock;
 	int status;
 	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xffd320e5,
+		0x00ffffff,
+		0x6b08ff00,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff288000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init_state (&flash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xdc, 0x10000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
@@ -11628,22 +11865,242 @@ static void spi_flash_test_block_erase_static (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_block_erase_static_read_only (CuTest *test)
+static void spi_flash_test_block_erase_flash_1_4_4_3byte_4byte (CuTest *test)
 {
-	struct flash_master_mock mock;
 	struct spi_flash_state state;
-	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
-		&mock.base);
+	struct spi_flash flash;
+	struct flash_master_mock mock;
 	int status;
-
-	TEST_START;
-
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init_state (&flash);
-	CuAssertIntEquals (test, 0, status);
-
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xfff320e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff288000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xdc, 0x10000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_block_erase (&flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_block_erase_flash_4_4_4_3byte_4byte (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xfff320e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb043b08,
+		0xffffffff,
+		0xbb04ffff,
+		0xeb44ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff288000,
+		0xa1f860e9
+	};
+	uint32_t capabilities = FLASH_CAP_DUAL_2_2_2 | FLASH_CAP_DUAL_1_2_2 | FLASH_CAP_DUAL_1_1_2 |
+		FLASH_CAP_QUAD_4_4_4 | FLASH_CAP_QUAD_1_4_4 | FLASH_CAP_QUAD_1_1_4 | FLASH_CAP_3BYTE_ADDR |
+		FLASH_CAP_4BYTE_ADDR;
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, capabilities);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xdc, 0x10000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_block_erase (&flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_block_erase_flag_status_register (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t read_status = FLASH_FLAG_STATUS_READY;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8020e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2fb,
+		0xff088000,
+		0x80f820e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_block_erase (&flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_block_erase_static (CuTest *test)
+{
+	struct flash_master_mock mock;
+	struct spi_flash_state state;
+	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_API_INIT, &state, &mock.base);
+	int status;
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init_state (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_block_erase (&flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_block_erase_static_read_only (CuTest *test)
+{
+	struct flash_master_mock mock;
+	struct spi_flash_state state;
+	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
+		&mock.base);
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init_state (&flash);
+	CuAssertIntEquals (test, 0, status);
+
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
@@ -21104,6 +21561,8 @@ static void spi_flash_test_save_device_info (CuTest *test)
 	CuAssertIntEquals (test, SPI_FLASH_SFDP_4BYTE_MODE_UNSUPPORTED, info.switch_4byte);
 	CuAssertIntEquals (test, SPI_FLASH_SFDP_QUAD_NO_QE_BIT, info.quad_enable);
 	CuAssertIntEquals (test, SPI_FLASH_DEVICE_INFO_RESET_3BYTE, info.flags);
+	CuAssertIntEquals (test, 0, info.suspend_opcode);
+	CuAssertIntEquals (test, 0, info.resume_opcode);
 
 	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
@@ -24312,97 +24771,1123 @@ static void spi_flash_test_restore_device_state_null (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void spi_flash_test_restore_device_state_fast_read_init_error (CuTest *test)
+static void spi_flash_test_restore_device_state_fast_read_init_error (CuTest *test)
+{
+	struct flash_master_mock mock;
+	struct spi_flash_state state;
+	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_API_INIT, &state, &mock.base);
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xffd120e5,
+		0x00ffffff,
+		0x6b08ff00,
+		0xbb043b08,
+		0xffffffef,
+		0xbb04ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff2df719,
+		0x80f830e9
+	};
+	uint8_t macronix[] = {0xc2, 0x20, 0x19};
+	uint8_t read_status = 0x7c;
+	uint8_t write_status = 0x40;
+	struct spi_flash_device_info info;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Get Device ID. */
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, macronix, FLASH_ID_LEN,
+		FLASH_EXP_READ_REG (0x9f, FLASH_ID_LEN));
+
+	/* Use SFDP to discover device properties. */
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, macronix, FLASH_ID_LEN,
+		FLASH_EXP_READ_REG (0x9f, FLASH_ID_LEN));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, (uint8_t*) header, sizeof (header),
+		FLASH_EXP_READ_CMD (0x5a, 0x000000, 1, -1, sizeof (header)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, (uint8_t*) params, sizeof (params),
+		FLASH_EXP_READ_CMD (0x5a, 0x000030, 1, -1, sizeof (params)));
+	status |= mock_expect (&mock.mock, mock.base.capabilities, &mock,
+		FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR);
+
+	/* Detect device WIP state. */
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	/* Clear block protect bits. */
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_REG (0x01, &write_status, 1));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &write_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_initialize_device_state (&flash, true, false, false, false);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_save_device_info (&flash, &info);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_restore_device_state (NULL, &info);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void spi_flash_test_is_address_mode_fixed (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_address_mode_fixed (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_address_mode_fixed_16M (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_address_mode_fixed (&flash);
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_address_mode_fixed_3byte_only (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010100,
+		0x09010000,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8020e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = spi_flash_is_address_mode_fixed (&flash);
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_address_mode_fixed_3byte_4byte (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8220e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = spi_flash_is_address_mode_fixed (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_address_mode_fixed_4byte_only (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010100,
+		0x09010000,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8420e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = spi_flash_is_address_mode_fixed (&flash);
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_address_mode_fixed_null (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_address_mode_fixed (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_address_mode_requires_write_enable (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_address_mode_requires_write_enable (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_address_mode_requires_write_enable_16M (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_address_mode_requires_write_enable (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_ADDR_MODE_FIXED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_address_mode_requires_write_enable_with_write_enable (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8220e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa2f8a0e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = spi_flash_address_mode_requires_write_enable (&flash);
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_address_mode_requires_write_enable_3byte_only (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010100,
+		0x09010000,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8020e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = spi_flash_address_mode_requires_write_enable (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_ADDR_MODE_FIXED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_address_mode_requires_write_enable_3byte_4byte (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8220e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f860e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = spi_flash_address_mode_requires_write_enable (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_address_mode_requires_write_enable_4byte_only (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010100,
+		0x09010000,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8420e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = spi_flash_address_mode_requires_write_enable (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_ADDR_MODE_FIXED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_address_mode_requires_write_enable_null (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_address_mode_requires_write_enable (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_macronix (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t macronix[] = {0xc2, 0x20, 0x19};
+	const size_t length = sizeof (macronix);
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, macronix, length,
+		FLASH_EXP_READ_REG (0x9f, length));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_winbond (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t winbond[] = {0xef, 0x40, 0x19};
+	const size_t length = sizeof (winbond);
+	uint8_t reset_4b[] = {0x02};
+	uint8_t reset_3b[] = {~0x02};
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, winbond, length,
+		FLASH_EXP_READ_REG (0x9f, length));
+
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, reset_4b, 1,
+		FLASH_EXP_READ_REG (0x15, 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, reset_3b, 1,
+		FLASH_EXP_READ_REG (0x15, 1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_micron (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t micron[] = {0x20, 0xba, 0x19};
+	const size_t length = sizeof (micron);
+	uint8_t reset_4b[] = {~0x01};
+	uint8_t reset_3b[] = {0x01};
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, micron, length,
+		FLASH_EXP_READ_REG (0x9f, length));
+
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, reset_4b, 1,
+		FLASH_EXP_READ_REG (0xb5, 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, reset_3b, 1,
+		FLASH_EXP_READ_REG (0xb5, 1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_unknown (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t unknown[] = {0x11, 0x20, 0x19};
+	const size_t length = sizeof (unknown);
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, unknown, length,
+		FLASH_EXP_READ_REG (0x9f, length));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_UNSUPPORTED_DEVICE, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_16M (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_3byte_only (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010100,
+		0x09010000,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8020e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_4byte_only (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010100,
+		0x09010000,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8420e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_null (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_error_id (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_REG (0x9f, 3));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_error_read_reg_winbond (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t winbond[] = {0xef, 0x40, 0x19};
+	const size_t length = sizeof (winbond);
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, winbond, length,
+		FLASH_EXP_READ_REG (0x9f, length));
+
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_REG (0x15, 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_4byte_address_mode_on_reset_error_read_reg_micron (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t micron[] = {0x20, 0xba, 0x19};
+	const size_t length = sizeof (micron);
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, micron, length,
+		FLASH_EXP_READ_REG (0x9f, length));
+
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_REG (0xb5, 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_set_read_command (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data[] = {1, 2, 3, 4};
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
+	uint8_t wip_status = 0;
+	struct spi_flash_sfdp_read_cmd command = {
+		.opcode = 0xec,
+		.dummy_bytes = 2,
+		.mode_bytes = 1
+	};
+	uint16_t flags = FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_read_command (&flash, &command, flags);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
+		FLASH_EXP_1_4_4_READ_CMD (0xec, 0x1234, 2, 1, data_in, length));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_set_read_command_null (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	struct spi_flash_sfdp_read_cmd command = {
+		.opcode = 0xec,
+		.dummy_bytes = 2,
+		.mode_bytes = 1
+	};
+	uint16_t flags = FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_read_command (NULL, &command, flags);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = spi_flash_set_read_command (&flash, NULL, flags);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_set_write_command (CuTest *test)
 {
-	struct flash_master_mock mock;
 	struct spi_flash_state state;
-	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_API_INIT, &state, &mock.base);
+	struct spi_flash flash;
+	struct flash_master_mock mock;
 	int status;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xffd120e5,
-		0x00ffffff,
-		0x6b08ff00,
-		0xbb043b08,
-		0xffffffef,
-		0xbb04ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff2df719,
-		0x80f830e9
-	};
-	uint8_t macronix[] = {0xc2, 0x20, 0x19};
-	uint8_t read_status = 0x7c;
-	uint8_t write_status = 0x40;
-	struct spi_flash_device_info info;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	/* Get Device ID. */
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, macronix, FLASH_ID_LEN,
-		FLASH_EXP_READ_REG (0x9f, FLASH_ID_LEN));
-
-	/* Use SFDP to discover device properties. */
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, macronix, FLASH_ID_LEN,
-		FLASH_EXP_READ_REG (0x9f, FLASH_ID_LEN));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, (uint8_t*) header, sizeof (header),
-		FLASH_EXP_READ_CMD (0x5a, 0x000000, 1, -1, sizeof (header)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, (uint8_t*) params, sizeof (params),
-		FLASH_EXP_READ_CMD (0x5a, 0x000030, 1, -1, sizeof (params)));
-	status |= mock_expect (&mock.mock, mock.base.capabilities, &mock,
-		FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR);
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
 
-	/* Detect device WIP state. */
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	/* Clear block protect bits. */
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status = spi_flash_set_write_command (&flash, 0x38,
+		FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
 	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_REG (0x01, &write_status, 1));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &write_status, 1,
+		FLASH_EXP_WRITE_EXT_CMD (0x38, 0x1234, 0, 0, cmd_expected, sizeof (cmd_expected),
+			FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_initialize_device_state (&flash, true, false, false, false);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_save_device_info (&flash, &info);
-	CuAssertIntEquals (test, 0, status);
-
-	spi_flash_release (&flash);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_restore_device_state (NULL, &info);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	spi_flash_is_write_in_progress (&flash);
 
-	status = flash_master_mock_validate_and_release (&mock);
-	CuAssertIntEquals (test, 0, status);
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_address_mode_fixed (CuTest *test)
+static void spi_flash_test_set_write_command_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -24417,9 +25902,13 @@ static void spi_flash_test_is_address_mode_fixed (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_address_mode_fixed (&flash);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_set_write_command (NULL, 0x38,
+		FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -24429,12 +25918,36 @@ static void spi_flash_test_is_address_mode_fixed (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_address_mode_fixed_16M (CuTest *test)
+
+/**
+ * Context for tracking asynchronous write completion notifications.
+ */
+struct spi_flash_testing_write_complete {
+	int count;			/**< Number of completion notifications received. */
+	int result;			/**< Result of the last completion notification. */
+};
+
+/**
+ * Completion handler for asynchronous writes.
+ *
+ * @param context The notification tracking context.
+ * @param result The result of the write operation.
+ */
+static void spi_flash_testing_write_complete (void *context, int result)
+{
+	struct spi_flash_testing_write_complete *complete = context;
+
+	complete->count++;
+	complete->result = result;
+}
+
+static void spi_flash_test_sector_erase_start (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -24447,154 +25960,164 @@ static void spi_flash_test_is_address_mode_fixed_16M (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_address_mode_fixed (&flash);
-	CuAssertIntEquals (test, 1, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
 
-	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_sector_erase_start (&flash, 0x1234);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_address_mode_fixed_3byte_only (CuTest *test)
+static void spi_flash_test_sector_erase_start_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_sector_erase_start (NULL, 0x1000);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_sector_erase_start_write_in_progress (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010100,
-		0x09010000,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8020e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00
-	};
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_address_mode_fixed (&flash);
-	CuAssertIntEquals (test, 1, status);
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sector_erase_start (&flash, 0x1000);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_address_mode_fixed_3byte_4byte (CuTest *test)
+static void spi_flash_test_block_erase_start (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8220e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
+	uint8_t read_status = 0;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_address_mode_fixed (&flash);
+	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_block_erase_start (&flash, 0x11234);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_address_mode_fixed_4byte_only (CuTest *test)
+static void spi_flash_test_block_erase_start_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_block_erase_start (NULL, 0x10000);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_chip_erase_start (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010100,
-		0x09010000,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8420e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00
-	};
+	uint8_t read_status = 0;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_address_mode_fixed (&flash);
-	CuAssertIntEquals (test, 1, status);
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xc7));
+
+	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_chip_erase_start (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_address_mode_fixed_null (CuTest *test)
+static void spi_flash_test_chip_erase_start_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_chip_erase_start (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_write_page_start (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -24604,24 +26127,36 @@ static void spi_flash_test_is_address_mode_fixed_null (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_address_mode_fixed (NULL);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
 
-	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_write_page_start (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_address_mode_requires_write_enable (CuTest *test)
+static void spi_flash_test_write_page_start_across_page (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t cmd_expected[] = {0x01, 0x02};
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -24631,24 +26166,34 @@ static void spi_flash_test_address_mode_requires_write_enable (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_address_mode_requires_write_enable (&flash);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x12fe, 0, cmd_expected, sizeof (cmd_expected)));
+
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_write_page_start (&flash, 0x12fe, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_address_mode_requires_write_enable_16M (CuTest *test)
+static void spi_flash_test_write_page_start_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t data[] = {1, 2, 3, 4};
 
 	TEST_START;
 
@@ -24661,202 +26206,144 @@ static void spi_flash_test_address_mode_requires_write_enable_16M (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_address_mode_requires_write_enable (&flash);
-	CuAssertIntEquals (test, SPI_FLASH_ADDR_MODE_FIXED, status);
+	status = spi_flash_write_page_start (NULL, 0x1234, data, sizeof (data));
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = spi_flash_write_page_start (&flash, 0x1234, NULL, sizeof (data));
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = spi_flash_write_page_start (&flash, 0x1234, data, 0);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_address_mode_requires_write_enable_with_write_enable (CuTest *test)
+static void spi_flash_test_write_page_start_out_of_range (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8220e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa2f8a0e9
-	};
+	uint8_t data[] = {1, 2, 3, 4};
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_address_mode_requires_write_enable (&flash);
-	CuAssertIntEquals (test, 1, status);
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_write_page_start (&flash, 0x1000000, data, sizeof (data));
+	CuAssertIntEquals (test, SPI_FLASH_ADDRESS_OUT_OF_RANGE, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_address_mode_requires_write_enable_3byte_only (CuTest *test)
+static void spi_flash_test_write_page_start_write_in_progress (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010100,
-		0x09010000,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8020e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00
-	};
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_address_mode_requires_write_enable (&flash);
-	CuAssertIntEquals (test, SPI_FLASH_ADDR_MODE_FIXED, status);
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write_page_start (&flash, 0x1234, data, sizeof (data));
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_address_mode_requires_write_enable_3byte_4byte (CuTest *test)
+static void spi_flash_test_write_page_start_write_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_testing_write_complete complete = {0};
 	int status;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8220e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2f7,
-		0xff088000,
-		0xa1f860e9
-	};
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
-
-	status = spi_flash_address_mode_requires_write_enable (&flash);
+	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	flash_master_mock_release (&mock);
-	spi_flash_release (&flash);
-}
+	status = spi_flash_set_write_complete_handler (&flash, spi_flash_testing_write_complete,
+		&complete);
+	CuAssertIntEquals (test, 0, status);
 
-static void spi_flash_test_address_mode_requires_write_enable_4byte_only (CuTest *test)
-{
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	struct flash_master_mock mock;
-	int status;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010100,
-		0x09010000,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8420e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00
-	};
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	TEST_START;
+	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	status = spi_flash_write_page_start (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
-	status = spi_flash_address_mode_requires_write_enable (&flash);
-	CuAssertIntEquals (test, SPI_FLASH_ADDR_MODE_FIXED, status);
+	status = spi_flash_poll_write_complete (&flash);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, complete.count);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_address_mode_requires_write_enable_null (CuTest *test)
+static void spi_flash_test_poll_write_complete (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_testing_write_complete complete = {0, 1};
 	int status;
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
@@ -24866,26 +26353,56 @@ static void spi_flash_test_address_mode_requires_write_enable_null (CuTest *test
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_address_mode_requires_write_enable (NULL);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_set_write_complete_handler (&flash, spi_flash_testing_write_complete,
+		&complete);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sector_erase_start (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_poll_write_complete (&flash);
+	CuAssertIntEquals (test, 1, status);
+	CuAssertIntEquals (test, 0, complete.count);
+
+	status = spi_flash_poll_write_complete (&flash);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, complete.count);
+	CuAssertIntEquals (test, 0, complete.result);
+
+	status = spi_flash_poll_write_complete (&flash);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, complete.count);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_macronix (CuTest *test)
+static void spi_flash_test_poll_write_complete_no_handler (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t macronix[] = {0xc2, 0x20, 0x19};
-	const size_t length = sizeof (macronix);
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -24895,33 +26412,36 @@ static void spi_flash_test_is_4byte_address_mode_on_reset_macronix (CuTest *test
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, macronix, length,
-		FLASH_EXP_READ_REG (0x9f, length));
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xc7));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	status = spi_flash_chip_erase_start (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_poll_write_complete (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_winbond (CuTest *test)
+static void spi_flash_test_poll_write_complete_handler_cleared (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_testing_write_complete complete = {0};
 	int status;
-	uint8_t winbond[] = {0xef, 0x40, 0x19};
-	const size_t length = sizeof (winbond);
-	uint8_t reset_4b[] = {0x02};
-	uint8_t reset_3b[] = {~0x02};
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -24931,46 +26451,44 @@ static void spi_flash_test_is_4byte_address_mode_on_reset_winbond (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, winbond, length,
-		FLASH_EXP_READ_REG (0x9f, length));
-
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, reset_4b, 1,
-		FLASH_EXP_READ_REG (0x15, 1));
+	status = spi_flash_set_write_complete_handler (&flash, spi_flash_testing_write_complete,
+		&complete);
+	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_set_write_complete_handler (&flash, NULL, NULL);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
-	CuAssertIntEquals (test, 1, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xc7));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, reset_3b, 1,
-		FLASH_EXP_READ_REG (0x15, 1));
+	status = spi_flash_chip_erase_start (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	status = spi_flash_poll_write_complete (&flash);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, complete.count);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_micron (CuTest *test)
+static void spi_flash_test_poll_write_complete_not_started (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_testing_write_complete complete = {0};
 	int status;
-	uint8_t micron[] = {0x20, 0xba, 0x19};
-	const size_t length = sizeof (micron);
-	uint8_t reset_4b[] = {~0x01};
-	uint8_t reset_3b[] = {0x01};
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -24980,44 +26498,44 @@ static void spi_flash_test_is_4byte_address_mode_on_reset_micron (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, micron, length,
-		FLASH_EXP_READ_REG (0x9f, length));
-
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, reset_4b, 1,
-		FLASH_EXP_READ_REG (0xb5, 1));
-
+	status = spi_flash_set_write_complete_handler (&flash, spi_flash_testing_write_complete,
+		&complete);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
-	CuAssertIntEquals (test, 1, status);
-
-	status = mock_validate (&mock.mock);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, reset_3b, 1,
-		FLASH_EXP_READ_REG (0xb5, 1));
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	status = spi_flash_poll_write_complete (&flash);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, complete.count);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_unknown (CuTest *test)
+static void spi_flash_test_poll_write_complete_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_poll_write_complete (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_poll_write_complete_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_testing_write_complete complete = {0};
 	int status;
-	uint8_t unknown[] = {0x11, 0x20, 0x19};
-	const size_t length = sizeof (unknown);
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -25027,29 +26545,54 @@ static void spi_flash_test_is_4byte_address_mode_on_reset_unknown (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, unknown, length,
-		FLASH_EXP_READ_REG (0x9f, length));
+	status = spi_flash_set_write_complete_handler (&flash, spi_flash_testing_write_complete,
+		&complete);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xc7));
+	status |= flash_master_mock_expect_rx_xfer (&mock, FLASH_MASTER_XFER_FAILED, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
-	CuAssertIntEquals (test, SPI_FLASH_UNSUPPORTED_DEVICE, status);
+	status = spi_flash_chip_erase_start (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_poll_write_complete (&flash);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 0, complete.count);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_16M (CuTest *test)
+static void spi_flash_test_set_write_complete_handler_null (CuTest *test)
+{
+	struct spi_flash_testing_write_complete complete = {0};
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_set_write_complete_handler (NULL, spi_flash_testing_write_complete,
+		&complete);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_wait_for_write_async_complete (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_testing_write_complete complete = {0, 1};
 	int status;
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
@@ -25062,32 +26605,55 @@ static void spi_flash_test_is_4byte_address_mode_on_reset_16M (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	status = spi_flash_set_write_complete_handler (&flash, spi_flash_testing_write_complete,
+		&complete);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_block_erase_start (&flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_wait_for_write (&flash, 100);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, complete.count);
+	CuAssertIntEquals (test, 0, complete.result);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_3byte_only (CuTest *test)
+/**
+ * Initialize a SPI flash instance with discovered parameters that support erase suspend.
+ *
+ * @param test The test framework.
+ * @param flash The SPI interface to initialize.
+ * @param state Variable context for the SPI interface.
+ * @param mock The flash mock for the SPI device.
+ */
+static void spi_flash_testing_init_with_suspend (CuTest *test, struct spi_flash *flash,
+	struct spi_flash_state *state, struct flash_master_mock *mock)
 {
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	struct flash_master_mock mock;
-	int status;
 	uint32_t header[] = {
 		0x50444653,
-		0xff010100,
-		0x09010000,
+		0xff010106,
+		0x10010600,
 		0xff000030
 	};
 	uint32_t params[] = {
-		0xff8020e5,
+		0xff8220e5,
 		0x00ffffff,
 		0xff00ff00,
 		0xff00ff00,
@@ -25095,68 +26661,168 @@ static void spi_flash_test_is_4byte_address_mode_on_reset_3byte_only (CuTest *te
 		0xff00ffff,
 		0xff00ffff,
 		0xd810200c,
-		0xff00ff00
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff088000,
+		0xa1f870e9
 	};
 
+	spi_flash_testing_discover_params (test, flash, state, mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+}
+
+static void spi_flash_test_suspend_write (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	struct spi_flash_testing_write_complete complete = {0, 1};
+	int status;
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t data_in[sizeof (data)];
+
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	status = spi_flash_set_write_complete_handler (&flash, spi_flash_testing_write_complete,
+		&complete);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0xdc, 0x10000));
+
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x75));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, sizeof (data),
+		FLASH_EXP_READ_4B_CMD (0x13, 0x1234, 0, data_in, sizeof (data_in)));
+
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x7a));
+
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_block_erase_start (&flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_suspend_write (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_poll_write_complete (&flash);
+	CuAssertIntEquals (test, 1, status);
+	CuAssertIntEquals (test, 0, complete.count);
+
+	status = spi_flash_read (&flash, 0x1234, data_in, sizeof (data_in));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data, data_in, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_sector_erase (&flash, 0x20000);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = spi_flash_write (&flash, 0x20000, data, sizeof (data));
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = spi_flash_wait_for_write (&flash, 100);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = spi_flash_resume_write (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_poll_write_complete (&flash);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, complete.count);
+	CuAssertIntEquals (test, 0, complete.result);
+
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_suspend_write_already_suspended (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
+
+	TEST_START;
+
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x75));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_suspend_write (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_suspend_write (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_4byte_only (CuTest *test)
+static void spi_flash_test_suspend_write_no_write_in_progress (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010100,
-		0x09010000,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8420e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00
-	};
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	TEST_START;
+	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	status = spi_flash_suspend_write (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
-	CuAssertIntEquals (test, 1, status);
+	status = spi_flash_resume_write (&flash);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_null (CuTest *test)
+static void spi_flash_test_suspend_write_not_supported (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -25171,298 +26837,372 @@ static void spi_flash_test_is_4byte_address_mode_on_reset_null (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (NULL);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = spi_flash_suspend_write (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_SUSPEND_NOT_SUPPORTED, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_error_id (CuTest *test)
+static void spi_flash_test_suspend_write_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_suspend_write (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_suspend_write_status_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t read_status = 0;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
 
-	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_REG (0x9f, 3));
+	status = flash_master_mock_expect_rx_xfer (&mock, FLASH_MASTER_XFER_FAILED, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	status = spi_flash_suspend_write (&flash);
 	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_error_read_reg_winbond (CuTest *test)
+static void spi_flash_test_suspend_write_suspend_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t winbond[] = {0xef, 0x40, 0x19};
-	const size_t length = sizeof (winbond);
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, winbond, length,
-		FLASH_EXP_READ_REG (0x9f, length));
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
 
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_REG (0x15, 1));
+		FLASH_EXP_OPCODE (0x75));
+
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_4B_CMD (0x21, 0x20000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	status = spi_flash_suspend_write (&flash);
 	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_sector_erase_start (&flash, 0x20000);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_4byte_address_mode_on_reset_error_read_reg_micron (CuTest *test)
+static void spi_flash_test_resume_write_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_resume_write (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_resume_write_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t micron[] = {0x20, 0xba, 0x19};
-	const size_t length = sizeof (micron);
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, micron, length,
-		FLASH_EXP_READ_REG (0x9f, length));
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x75));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
 	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_REG (0xb5, 1));
+		FLASH_EXP_OPCODE (0x7a));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_4byte_address_mode_on_reset (&flash);
+	status = spi_flash_suspend_write (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_resume_write (&flash);
 	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
+	status = spi_flash_poll_write_complete (&flash);
+	CuAssertIntEquals (test, 1, status);
+
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_set_read_command (CuTest *test)
+
+static void spi_flash_test_suspend_write_save_and_restore_device (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
 	struct flash_master_mock mock;
+	struct spi_flash_device_info info;
 	int status;
-	uint8_t data[] = {1, 2, 3, 4};
-	const size_t length = sizeof (data);
-	uint8_t data_in[length];
-	uint8_t wip_status = 0;
-	struct spi_flash_sfdp_read_cmd command = {
-		.opcode = 0xec,
-		.dummy_bytes = 2,
-		.mode_bytes = 1
-	};
-	uint16_t flags = FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA;
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
+	status = spi_flash_save_device_info (&flash, &info);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, SPI_FLASH_DEVICE_INFO_VERSION, info.version);
+	CuAssertIntEquals (test, 0x75, info.suspend_opcode);
+	CuAssertIntEquals (test, 0x7a, info.resume_opcode);
 
-	status = spi_flash_set_read_command (&flash, &command, flags);
+	spi_flash_release (&flash);
+
+	status = spi_flash_restore_device (&flash2, &state2, &mock.base, &info);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
-		FLASH_EXP_1_4_4_READ_CMD (0xec, 0x1234, 2, 1, data_in, length));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x75));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x7a));
 
-	status = spi_flash_read (&flash, 0x1234, data_in, length);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_suspend_write (&flash2);
 	CuAssertIntEquals (test, 0, status);
 
-	status = testing_validate_array (data, data_in, length);
+	status = spi_flash_resume_write (&flash2);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
-	spi_flash_release (&flash);
+	spi_flash_release (&flash2);
 }
 
-static void spi_flash_test_set_read_command_null (CuTest *test)
+static void spi_flash_test_suspend_write_restore_device_state (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_device_info info;
 	int status;
-	struct spi_flash_sfdp_read_cmd command = {
-		.opcode = 0xec,
-		.dummy_bytes = 2,
-		.mode_bytes = 1
-	};
-	uint16_t flags = FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA;
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
+
+	status = spi_flash_save_device_info (&flash, &info);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
+	spi_flash_release (&flash);
+
+	status = spi_flash_restore_device_state (&flash, &info);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x75));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x7a));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_read_command (NULL, &command, flags);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = spi_flash_suspend_write (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_read_command (&flash, NULL, flags);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = spi_flash_resume_write (&flash);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_set_write_command (CuTest *test)
+static void spi_flash_test_suspend_write_restore_device_version1 (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
 	struct flash_master_mock mock;
+	struct spi_flash_device_info info;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t read_status = 0;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
+	status = spi_flash_save_device_info (&flash, &info);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
+	spi_flash_release (&flash);
+
+	/* Version 1 contexts don't contain suspend and resume commands. */
+	info.version = 1;
+
+	status = spi_flash_restore_device (&flash2, &state2, &mock.base, &info);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_write_command (&flash, 0x38,
-		FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA);
+	status = spi_flash_suspend_write (&flash2);
+	CuAssertIntEquals (test, SPI_FLASH_SUSPEND_NOT_SUPPORTED, status);
+
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash2);
+}
+
+static void spi_flash_test_suspend_write_device_commands_rejected (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
+	int addr_mode;
+
+	TEST_START;
+
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_EXT_CMD (0x38, 0x1234, 0, 0, cmd_expected, sizeof (cmd_expected),
-			FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA));
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x75));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, TEST_ID, FLASH_ID_LEN,
+		FLASH_EXP_READ_REG (0x9f, FLASH_ID_LEN));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_suspend_write (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	addr_mode = spi_flash_is_4byte_address_mode (&flash);
+
+	status = spi_flash_reset_device (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = spi_flash_deep_power_down (&flash, 1);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = spi_flash_deep_power_down (&flash, 0);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = spi_flash_enable_4byte_address_mode (&flash, 0);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = spi_flash_enable_4byte_address_mode (&flash, 1);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = spi_flash_is_4byte_address_mode (&flash);
+	CuAssertIntEquals (test, addr_mode, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_set_write_command_null (CuTest *test)
+static void spi_flash_test_suspend_write_register_write_rejected (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
+	uint8_t block_protect = 0x3c;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_init_with_suspend (test, &flash, &state, &mock);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0x75));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, TEST_ID, FLASH_ID_LEN,
+		FLASH_EXP_READ_REG (0x9f, FLASH_ID_LEN));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &block_protect, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
+	status = spi_flash_suspend_write (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_write_command (NULL, 0x38,
-		FLASH_FLAG_QUAD_ADDR | FLASH_FLAG_QUAD_DATA);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = spi_flash_clear_block_protect (&flash);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-
 TEST_SUITE_START (spi_flash);
 
 TEST (spi_flash_test_init);
+TEST (spi_flash_test_init_async_read);
 TEST (spi_flash_test_init_null);
 TEST (spi_flash_test_init_fast_read);
 TEST (spi_flash_test_init_fast_read_null);
@@ -25615,6 +27355,17 @@ TEST (spi_flash_test_read_error_in_progress);
 TEST (spi_flash_test_read_error_in_progress_flag_status_register);
 TEST (spi_flash_test_read_status_error);
 TEST (spi_flash_test_read_error);
+TEST (spi_flash_test_read_start);
+TEST (spi_flash_test_read_start_4byte);
+TEST (spi_flash_test_read_start_flash_api);
+TEST (spi_flash_test_read_start_null);
+TEST (spi_flash_test_read_start_not_supported);
+TEST (spi_flash_test_read_start_out_of_range);
+TEST (spi_flash_test_read_start_error_in_progress);
+TEST (spi_flash_test_read_start_error);
+TEST (spi_flash_test_read_wait_null);
+TEST (spi_flash_test_read_wait_no_read);
+TEST (spi_flash_test_read_wait_error);
 TEST (spi_flash_test_write);
 TEST (spi_flash_test_write_across_page);
 TEST (spi_flash_test_write_multiple_pages);
@@ -25907,5 +27658,40 @@ TEST (spi_flash_test_set_read_command);
 TEST (spi_flash_test_set_read_command_null);
 TEST (spi_flash_test_set_write_command);
 TEST (spi_flash_test_set_write_command_null);
+TEST (spi_flash_test_sector_erase_start);
+TEST (spi_flash_test_sector_erase_start_null);
+TEST (spi_flash_test_sector_erase_start_write_in_progress);
+TEST (spi_flash_test_block_erase_start);
+TEST (spi_flash_test_block_erase_start_null);
+TEST (spi_flash_test_chip_erase_start);
+TEST (spi_flash_test_chip_erase_start_null);
+TEST (spi_flash_test_write_page_start);
+TEST (spi_flash_test_write_page_start_across_page);
+TEST (spi_flash_test_write_page_start_null);
+TEST (spi_flash_test_write_page_start_out_of_range);
+TEST (spi_flash_test_write_page_start_write_in_progress);
+TEST (spi_flash_test_write_page_start_write_error);
+TEST (spi_flash_test_poll_write_complete);
+TEST (spi_flash_test_poll_write_complete_no_handler);
+TEST (spi_flash_test_poll_write_complete_handler_cleared);
+TEST (spi_flash_test_poll_write_complete_not_started);
+TEST (spi_flash_test_poll_write_complete_null);
+TEST (spi_flash_test_poll_write_complete_error);
+TEST (spi_flash_test_set_write_complete_handler_null);
+TEST (spi_flash_test_wait_for_write_async_complete);
+TEST (spi_flash_test_suspend_write);
+TEST (spi_flash_test_suspend_write_already_suspended);
+TEST (spi_flash_test_suspend_write_no_write_in_progress);
+TEST (spi_flash_test_suspend_write_not_supported);
+TEST (spi_flash_test_suspend_write_null);
+TEST (spi_flash_test_suspend_write_status_error);
+TEST (spi_flash_test_suspend_write_suspend_error);
+TEST (spi_flash_test_resume_write_null);
+TEST (spi_flash_test_resume_write_error);
+TEST (spi_flash_test_suspend_write_save_and_restore_device);
+TEST (spi_flash_test_suspend_write_restore_device_state);
+TEST (spi_flash_test_suspend_write_restore_device_version1);
+TEST (spi_flash_test_suspend_write_device_commands_rejected);
+TEST (spi_flash_test_suspend_write_register_write_rejected);
 
 TEST_SUITE_END;
@@ -10,6 +10,7 @@
 #include "flash/flash_common.h"
 #include "testing/mock/flash/flash_master_mock.h"
 #include "testing/mock/host_fw/host_control_mock.h"
+#include "testing/mock/host_fw/host_fw_verify_worker_mock.h"
 #include "testing/mock/manifest/pfm_mock.h"
 #include "testing/mock/manifest/pfm_manager_mock.h"
 #include "testing/mock/spi_filter/spi_filter_interface_mock.h"
@@ -544,6 +545,58 @@ static void host_flash_manager_dual_test_release_null (CuTest *test)
 	host_flash_manager_dual_release (NULL);
 }
 
+static void host_flash_manager_dual_test_set_verification_workers (CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct host_fw_verify_worker_mock worker;
+	struct host_fw_verify_worker *workers[1] = {&worker.base};
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init (test, &manager, false);
+
+	status = host_fw_verify_worker_mock_init (&worker);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_manager_dual_set_verification_workers (&manager.test, workers, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_manager_dual_set_verification_workers (&manager.test, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_mock_validate_and_release (&worker);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_validate_and_release (test, &manager);
+}
+
+static void host_flash_manager_dual_test_set_verification_workers_null (CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct host_fw_verify_worker_mock worker;
+	struct host_fw_verify_worker *workers[1] = {&worker.base};
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init (test, &manager, false);
+
+	status = host_fw_verify_worker_mock_init (&worker);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_manager_dual_set_verification_workers (NULL, workers, 1);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = host_flash_manager_dual_set_verification_workers (&manager.test, NULL, 1);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = host_fw_verify_worker_mock_validate_and_release (&worker);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_validate_and_release (test, &manager);
+}
+
 static void host_flash_manager_dual_test_get_read_only_flash_cs0 (CuTest *test)
 {
 	struct host_flash_manager_dual_testing manager;
@@ -2075,6 +2128,288 @@ static void host_flash_manager_dual_test_validate_read_only_flash_multiple_fw (C
 	host_flash_manager_dual_testing_validate_and_release (test, &manager);
 }
 
+static void host_flash_manager_dual_test_validate_read_only_flash_multiple_fw_parallel (
+	CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct pfm_firmware fw_list;
+	const char *fw_exp[3] = {"fw1", "fw2", "fw3"};
+	struct pfm_firmware_version version[3];
+	struct pfm_firmware_versions version_list[3];
+	const char *version_exp1 = "1234";
+	const char *version_exp2 = "5678";
+	const char *version_exp3 = "90ab";
+	struct flash_region img_region[3];
+	struct pfm_image_signature sig[3];
+	struct pfm_image_list img_list[3];
+	char *img_data1 = "Test";
+	char *img_data2 = "Test2";
+	char *img_data3 = "Nope";
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list[3];
+	struct host_flash_manager_rw_regions rw_output;
+	struct host_fw_verify_worker_mock worker[2];
+	struct host_fw_verify_worker *workers[2] = {&worker[0].base, &worker[1].base};
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init (test, &manager, false);
+
+	status = host_fw_verify_worker_mock_init (&worker[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_mock_init (&worker[1]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_manager_dual_set_verification_workers (&manager.test, workers, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	fw_list.ids = fw_exp;
+	fw_list.count = 3;
+
+	version[0].fw_version_id = version_exp1;
+	version[0].version_addr = 0x123;
+	version[1].fw_version_id = version_exp2;
+	version[1].version_addr = 0x456;
+	version[2].fw_version_id = version_exp3;
+	version[2].version_addr = 0x789;
+
+	version_list[0].versions = &version[0];
+	version_list[0].count = 1;
+	version_list[1].versions = &version[1];
+	version_list[1].count = 1;
+	version_list[2].versions = &version[2];
+	version_list[2].count = 1;
+
+	img_region[0].start_addr = 0;
+	img_region[0].length = strlen (img_data1);
+
+	sig[0].regions = &img_region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
+
+	img_list[0].images_sig = &sig[0];
+	img_list[0].images_hash = NULL;
+	img_list[0].count = 1;
+
+	img_region[1].start_addr = 0x300;
+	img_region[1].length = strlen (img_data2);
+
+	sig[1].regions = &img_region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
+
+	img_list[1].images_sig = &sig[1];
+	img_list[1].images_hash = NULL;
+	img_list[1].count = 1;
+
+	img_region[2].start_addr = 0x600;
+	img_region[2].length = strlen (img_data3);
+
+	sig[2].regions = &img_region[2];
+	sig[2].count = 1;
+	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
+	sig[2].sig_length = RSA_ENCRYPT_LEN;
+	sig[2].always_validate = 1;
+
+	img_list[2].images_sig = &sig[2];
+	img_list[2].images_hash = NULL;
+	img_list[2].count = 1;
+
+	rw_region[0].start_addr = 0x200;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0x500;
+	rw_region[1].length = 0x100;
+	rw_region[2].start_addr = 0x800;
+	rw_region[2].length = 0x100;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list[0].regions = &rw_region[0];
+	rw_list[0].properties = &rw_prop[0];
+	rw_list[0].count = 1;
+
+	rw_list[1].regions = &rw_region[1];
+	rw_list[1].properties = &rw_prop[1];
+	rw_list[1].count = 1;
+
+	rw_list[2].regions = &rw_region[2];
+	rw_list[2].properties = &rw_prop[2];
+	rw_list[2].count = 1;
+
+	status = spi_flash_set_device_size (&manager.flash0, 0x1000);
+	status |= spi_flash_set_device_size (&manager.flash1, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware, &manager.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 0, &fw_list, sizeof (fw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 0, 3);
+
+	/* FW 1 */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR_CONTAINS (fw_exp[0], strlen (fw_exp[0]) + 1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list[0], sizeof (version_list[0]),
+		-1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 0);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) version_exp1,
+		strlen (version_exp1), FLASH_EXP_READ_CMD (0x03, 0x123, 0, -1, strlen (version_exp1)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR_CONTAINS (fw_exp[0], strlen (fw_exp[0]) + 1),
+		MOCK_ARG_PTR_CONTAINS (version_exp1, strlen (version_exp1) + 1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list[0], sizeof (img_list[0]), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 1);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR_CONTAINS (fw_exp[0], strlen (fw_exp[0]) + 1),
+		MOCK_ARG_PTR_CONTAINS (version_exp1, strlen (version_exp1) + 1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list[0], sizeof (rw_list[0]), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 2);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (0));
+
+	/* FW 2 */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR_CONTAINS (fw_exp[1], strlen (fw_exp[1]) + 1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list[1], sizeof (version_list[1]),
+		-1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 4);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) version_exp2,
+		strlen (version_exp2), FLASH_EXP_READ_CMD (0x03, 0x456, 0, -1, strlen (version_exp2)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR_CONTAINS (fw_exp[1], strlen (fw_exp[1]) + 1),
+		MOCK_ARG_PTR_CONTAINS (version_exp2, strlen (version_exp2) + 1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list[1], sizeof (img_list[1]), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 5);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR_CONTAINS (fw_exp[1], strlen (fw_exp[1]) + 1),
+		MOCK_ARG_PTR_CONTAINS (version_exp2, strlen (version_exp2) + 1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list[1], sizeof (rw_list[1]), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 6);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (4));
+
+	/* FW 3 */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR_CONTAINS (fw_exp[2], strlen (fw_exp[2]) + 1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list[2], sizeof (version_list[2]),
+		-1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 7);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) version_exp3,
+		strlen (version_exp3), FLASH_EXP_READ_CMD (0x03, 0x789, 0, -1, strlen (version_exp3)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR_CONTAINS (fw_exp[2], strlen (fw_exp[2]) + 1),
+		MOCK_ARG_PTR_CONTAINS (version_exp3, strlen (version_exp3) + 1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list[2], sizeof (img_list[2]), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 8);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR_CONTAINS (fw_exp[2], strlen (fw_exp[2]) + 1),
+		MOCK_ARG_PTR_CONTAINS (version_exp3, strlen (version_exp3) + 1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list[2], sizeof (rw_list[2]), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 9);
+
+	status |= mock_expect (&worker[0].mock, worker[0].base.start_verification, &worker[0], 0,
+		MOCK_ARG (&manager.flash0), MOCK_ARG_PTR_CONTAINS (&img_list[1], sizeof (img_list[1])),
+		MOCK_ARG (0));
+	status |= mock_expect (&worker[1].mock, worker[1].base.start_verification, &worker[1], 0,
+		MOCK_ARG (&manager.flash0), MOCK_ARG_PTR_CONTAINS (&img_list[2], sizeof (img_list[2])),
+		MOCK_ARG (0));
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) img_data1,
+		strlen (img_data1), FLASH_EXP_READ_CMD (0x03, 0x000, 0, -1, strlen (img_data1)));
+
+	status |= mock_expect (&worker[0].mock, worker[0].base.get_verification_result, &worker[0], 0);
+	status |= mock_expect (&worker[1].mock, worker[1].base.get_verification_result, &worker[1], 0);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (7));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (1));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (5));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (8));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (3));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.validate_read_only_flash (&manager.test.base, &manager.pfm.base,
+		NULL, &manager.hash.base, &manager.rsa.base, false, &rw_output);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 3, rw_output.count);
+	CuAssertPtrNotNull (test, rw_output.writable);
+	CuAssertPtrEquals (test, &manager.pfm, rw_output.pfm);
+
+	CuAssertIntEquals (test, 1, rw_output.writable[0].count);
+	CuAssertPtrEquals (test, &rw_region[0], (void*) rw_output.writable[0].regions);
+	CuAssertPtrEquals (test, &rw_prop[0], (void*) rw_output.writable[0].properties);
+
+	CuAssertIntEquals (test, 1, rw_output.writable[1].count);
+	CuAssertPtrEquals (test, &rw_region[1], (void*) rw_output.writable[1].regions);
+	CuAssertPtrEquals (test, &rw_prop[1], (void*) rw_output.writable[1].properties);
+
+	CuAssertIntEquals (test, 1, rw_output.writable[2].count);
+	CuAssertPtrEquals (test, &rw_region[2], (void*) rw_output.writable[2].regions);
+	CuAssertPtrEquals (test, &rw_prop[2], (void*) rw_output.writable[2].properties);
+
+	status = mock_validate (&manager.flash_mock0.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manager.pfm.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (2));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions,
+		&manager.pfm, 0, MOCK_ARG_SAVED_ARG (6));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions,
+		&manager.pfm, 0, MOCK_ARG_SAVED_ARG (9));
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.test.base.free_read_write_regions (&manager.test.base, &rw_output);
+
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[1]);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_validate_and_release (test, &manager);
+}
+
 static void host_flash_manager_dual_test_validate_read_only_flash_cs0_full_validation (CuTest *test)
 {
 	struct host_flash_manager_dual_testing manager;
@@ -12671,6 +13006,8 @@ TEST (host_flash_manager_dual_test_init_null);
 TEST (host_flash_manager_dual_test_init_with_managed_flash_initialization);
 TEST (host_flash_manager_dual_test_init_with_managed_flash_initialization_null);
 TEST (host_flash_manager_dual_test_release_null);
+TEST (host_flash_manager_dual_test_set_verification_workers);
+TEST (host_flash_manager_dual_test_set_verification_workers_null);
 TEST (host_flash_manager_dual_test_get_read_only_flash_cs0);
 TEST (host_flash_manager_dual_test_get_read_only_flash_cs1);
 TEST (host_flash_manager_dual_test_get_read_only_flash_null);
@@ -12697,6 +13034,7 @@ TEST (host_flash_manager_dual_test_validate_read_only_flash_cs0);
 TEST (host_flash_manager_dual_test_validate_read_only_flash_cs1);
 TEST (host_flash_manager_dual_test_validate_read_only_flash_single_fw);
 TEST (host_flash_manager_dual_test_validate_read_only_flash_multiple_fw);
+TEST (host_flash_manager_dual_test_validate_read_only_flash_multiple_fw_parallel);
 TEST (host_flash_manager_dual_test_validate_read_only_flash_cs0_full_validation);
 TEST (host_flash_manager_dual_test_validate_read_only_flash_cs1_full_validation);
 TEST (host_flash_manager_dual_test_validate_read_only_flash_full_validation_not_blank_byte);
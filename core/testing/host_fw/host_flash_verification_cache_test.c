@@ -0,0 +1,1098 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "host_fw/host_flash_verification_cache.h"
+#include "testing/mock/flash/flash_store_mock.h"
+#include "testing/mock/manifest/pfm_mock.h"
+#include "testing/mock/crypto/hash_mock.h"
+#include "testing/engines/hash_testing_engine.h"
+#include "testing/crypto/hash_testing.h"
+
+
+TEST_SUITE_LABEL ("host_flash_verification_cache");
+
+
+/**
+ * Key used to authenticate verification records.
+ */
+static const uint8_t HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY[] = {
+	0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,
+	0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f
+};
+
+
+/**
+ * Generate the expected verification record.
+ *
+ * @param test The testing framework.
+ * @param hash The hash engine to use to generate the record.
+ * @param pfm_id The ID of the PFM.
+ * @param pfm_hash The digest of the PFM.
+ * @param hash_length Length of the PFM digest.
+ * @param ro The flash device that was verified.
+ * @param record Output for the expected record.
+ */
+static void host_flash_verification_cache_testing_generate_record (CuTest *test,
+	struct hash_engine *hash, uint32_t pfm_id, const uint8_t *pfm_hash, size_t hash_length,
+	spi_filter_cs ro, struct host_flash_verification_cache_record *record)
+{
+	int status;
+
+	memset (record, 0, sizeof (struct host_flash_verification_cache_record));
+
+	record->pfm_id = pfm_id;
+	memcpy (record->pfm_hash, pfm_hash, hash_length);
+	record->ro_flash = ro;
+
+	status = hash_generate_hmac (hash, HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY), (uint8_t*) record,
+		offsetof (struct host_flash_verification_cache_record, hmac), HMAC_SHA256, record->hmac,
+		sizeof (record->hmac));
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Set up expectations for generating a verification record.
+ *
+ * @param test The testing framework.
+ * @param pfm The mock for the PFM.
+ * @param hash The hash engine that will be used.
+ * @param pfm_id The ID of the PFM.
+ * @param pfm_hash The digest of the PFM.
+ * @param hash_length Length of the PFM digest.
+ */
+static void host_flash_verification_cache_testing_expect_record (CuTest *test,
+	struct pfm_mock *pfm, struct hash_engine *hash, uint32_t *pfm_id, const uint8_t *pfm_hash,
+	size_t hash_length)
+{
+	int status;
+
+	status = mock_expect (&pfm->mock, pfm->base.base.get_id, pfm, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&pfm->mock, 0, pfm_id, sizeof (uint32_t), -1);
+
+	status |= mock_expect (&pfm->mock, pfm->base.base.get_hash, pfm, hash_length, MOCK_ARG (hash),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (SHA512_HASH_LENGTH));
+	status |= mock_expect_output (&pfm->mock, 1, pfm_hash, hash_length, 2);
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void host_flash_verification_cache_test_init (CuTest *test)
+{
+	struct flash_store_mock store;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+}
+
+static void host_flash_verification_cache_test_init_null (CuTest *test)
+{
+	struct flash_store_mock store;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (NULL, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = host_flash_verification_cache_init (&cache, NULL, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2, NULL,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY, 0);
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void host_flash_verification_cache_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	host_flash_verification_cache_release (NULL);
+}
+
+static void host_flash_verification_cache_test_save (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_generate_record (test, &hash.base, pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH, SPI_FILTER_CS_0, &record);
+
+	host_flash_verification_cache_testing_expect_record (test, &pfm, &hash.base, &pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	status = mock_expect (&store.mock, store.base.write, &store, 0, MOCK_ARG (2),
+		MOCK_ARG_PTR_CONTAINS (&record, sizeof (record)), MOCK_ARG (sizeof (record)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_save (&cache, &pfm.base, &hash.base, SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_save_sha384_cs1 (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint32_t pfm_id = 0x20;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 5,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_generate_record (test, &hash.base, pfm_id,
+		SHA384_TEST_HASH, SHA384_HASH_LENGTH, SPI_FILTER_CS_1, &record);
+
+	host_flash_verification_cache_testing_expect_record (test, &pfm, &hash.base, &pfm_id,
+		SHA384_TEST_HASH, SHA384_HASH_LENGTH);
+
+	status = mock_expect (&store.mock, store.base.write, &store, 0, MOCK_ARG (5),
+		MOCK_ARG_PTR_CONTAINS (&record, sizeof (record)), MOCK_ARG (sizeof (record)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_save (&cache, &pfm.base, &hash.base, SPI_FILTER_CS_1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_save_null (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_save (NULL, &pfm.base, &hash.base, SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = host_flash_verification_cache_save (&cache, NULL, &hash.base, SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = host_flash_verification_cache_save (&cache, &pfm.base, NULL, SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_save_id_error (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&pfm.mock, pfm.base.base.get_id, &pfm, MANIFEST_GET_ID_FAILED,
+		MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_save (&cache, &pfm.base, &hash.base, SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, MANIFEST_GET_ID_FAILED, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_save_pfm_hash_error (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&pfm.mock, pfm.base.base.get_id, &pfm, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&pfm.mock, 0, &pfm_id, sizeof (pfm_id), -1);
+
+	status |= mock_expect (&pfm.mock, pfm.base.base.get_hash, &pfm, MANIFEST_GET_HASH_FAILED,
+		MOCK_ARG (&hash), MOCK_ARG_NOT_NULL, MOCK_ARG (SHA512_HASH_LENGTH));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_save (&cache, &pfm.base, &hash.base, SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, MANIFEST_GET_HASH_FAILED, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_save_hmac_error (CuTest *test)
+{
+	struct hash_engine_mock hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_expect_record (test, &pfm, &hash.base, &pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	status = mock_expect (&hash.mock, hash.base.start_sha256, &hash,
+		HASH_ENGINE_START_SHA256_FAILED);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_save (&cache, &pfm.base, &hash.base, SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, HASH_ENGINE_START_SHA256_FAILED, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_mock_validate_and_release (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+}
+
+static void host_flash_verification_cache_test_save_write_error (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_expect_record (test, &pfm, &hash.base, &pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	status = mock_expect (&store.mock, store.base.write, &store, FLASH_STORE_WRITE_FAILED,
+		MOCK_ARG (2), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (sizeof (struct host_flash_verification_cache_record)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_save (&cache, &pfm.base, &hash.base, SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, FLASH_STORE_WRITE_FAILED, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_generate_record (test, &hash.base, pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH, SPI_FILTER_CS_0, &record);
+
+	status = mock_expect (&store.mock, store.base.read, &store, sizeof (record), MOCK_ARG (2),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (record)));
+	status |= mock_expect_output (&store.mock, 1, &record, sizeof (record), 2);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_expect_record (test, &pfm, &hash.base, &pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, 1, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_no_record (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.mock, store.base.read, &store, FLASH_STORE_NO_DATA, MOCK_ARG (2),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (struct host_flash_verification_cache_record)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_corrupt_record (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.mock, store.base.read, &store, FLASH_STORE_CORRUPT_DATA,
+		MOCK_ARG (2), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (sizeof (struct host_flash_verification_cache_record)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_short_record (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_generate_record (test, &hash.base, pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH, SPI_FILTER_CS_0, &record);
+
+	status = mock_expect (&store.mock, store.base.read, &store, sizeof (record) - 1, MOCK_ARG (2),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (record)));
+	status |= mock_expect_output (&store.mock, 1, &record, sizeof (record) - 1, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_different_pfm (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_generate_record (test, &hash.base, pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH, SPI_FILTER_CS_0, &record);
+
+	status = mock_expect (&store.mock, store.base.read, &store, sizeof (record), MOCK_ARG (2),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (record)));
+	status |= mock_expect_output (&store.mock, 1, &record, sizeof (record), 2);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_expect_record (test, &pfm, &hash.base, &pfm_id,
+		SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_different_pfm_id (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint32_t pfm_id = 0x11;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_generate_record (test, &hash.base, 0x10,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH, SPI_FILTER_CS_0, &record);
+
+	status = mock_expect (&store.mock, store.base.read, &store, sizeof (record), MOCK_ARG (2),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (record)));
+	status |= mock_expect_output (&store.mock, 1, &record, sizeof (record), 2);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_expect_record (test, &pfm, &hash.base, &pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_different_flash (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_generate_record (test, &hash.base, pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH, SPI_FILTER_CS_0, &record);
+
+	status = mock_expect (&store.mock, store.base.read, &store, sizeof (record), MOCK_ARG (2),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (record)));
+	status |= mock_expect_output (&store.mock, 1, &record, sizeof (record), 2);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_expect_record (test, &pfm, &hash.base, &pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_bad_hmac (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_generate_record (test, &hash.base, pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH, SPI_FILTER_CS_0, &record);
+	record.hmac[0] ^= 0x55;
+
+	status = mock_expect (&store.mock, store.base.read, &store, sizeof (record), MOCK_ARG (2),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (record)));
+	status |= mock_expect_output (&store.mock, 1, &record, sizeof (record), 2);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_expect_record (test, &pfm, &hash.base, &pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_null (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_is_current (NULL, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = host_flash_verification_cache_is_current (&cache, NULL, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, NULL,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_read_error (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.mock, store.base.read, &store, FLASH_STORE_READ_FAILED,
+		MOCK_ARG (2), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (sizeof (struct host_flash_verification_cache_record)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, FLASH_STORE_READ_FAILED, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_is_current_pfm_hash_error (CuTest *test)
+{
+	HASH_TESTING_ENGINE hash;
+	struct flash_store_mock store;
+	struct pfm_mock pfm;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint32_t pfm_id = 0x10;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_testing_generate_record (test, &hash.base, pfm_id,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH, SPI_FILTER_CS_0, &record);
+
+	status = mock_expect (&store.mock, store.base.read, &store, sizeof (record), MOCK_ARG (2),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (record)));
+	status |= mock_expect_output (&store.mock, 1, &record, sizeof (record), 2);
+
+	status |= mock_expect (&pfm.mock, pfm.base.base.get_id, &pfm, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&pfm.mock, 0, &pfm_id, sizeof (pfm_id), -1);
+
+	status |= mock_expect (&pfm.mock, pfm.base.base.get_hash, &pfm, MANIFEST_GET_HASH_FAILED,
+		MOCK_ARG (&hash), MOCK_ARG_NOT_NULL, MOCK_ARG (SHA512_HASH_LENGTH));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_is_current (&cache, &pfm.base, &hash.base,
+		SPI_FILTER_CS_0);
+	CuAssertIntEquals (test, MANIFEST_GET_HASH_FAILED, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_validate_and_release (&pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+}
+
+static void host_flash_verification_cache_test_invalidate (CuTest *test)
+{
+	struct flash_store_mock store;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.mock, store.base.erase, &store, 0, MOCK_ARG (2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_invalidate (&cache);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+}
+
+static void host_flash_verification_cache_test_invalidate_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = host_flash_verification_cache_invalidate (NULL);
+	CuAssertIntEquals (test, HOST_FLASH_VERIFICATION_CACHE_INVALID_ARGUMENT, status);
+}
+
+static void host_flash_verification_cache_test_invalidate_erase_error (CuTest *test)
+{
+	struct flash_store_mock store;
+	struct host_flash_verification_cache cache;
+	int status;
+
+	TEST_START;
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 2,
+		HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY,
+		sizeof (HOST_FLASH_VERIFICATION_CACHE_TESTING_KEY));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.mock, store.base.erase, &store, FLASH_STORE_ERASE_FAILED,
+		MOCK_ARG (2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_invalidate (&cache);
+	CuAssertIntEquals (test, FLASH_STORE_ERASE_FAILED, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_verification_cache_release (&cache);
+}
+
+
+TEST_SUITE_START (host_flash_verification_cache);
+
+TEST (host_flash_verification_cache_test_init);
+TEST (host_flash_verification_cache_test_init_null);
+TEST (host_flash_verification_cache_test_release_null);
+TEST (host_flash_verification_cache_test_save);
+TEST (host_flash_verification_cache_test_save_sha384_cs1);
+TEST (host_flash_verification_cache_test_save_null);
+TEST (host_flash_verification_cache_test_save_id_error);
+TEST (host_flash_verification_cache_test_save_pfm_hash_error);
+TEST (host_flash_verification_cache_test_save_hmac_error);
+TEST (host_flash_verification_cache_test_save_write_error);
+TEST (host_flash_verification_cache_test_is_current);
+TEST (host_flash_verification_cache_test_is_current_no_record);
+TEST (host_flash_verification_cache_test_is_current_corrupt_record);
+TEST (host_flash_verification_cache_test_is_current_short_record);
+TEST (host_flash_verification_cache_test_is_current_different_pfm);
+TEST (host_flash_verification_cache_test_is_current_different_pfm_id);
+TEST (host_flash_verification_cache_test_is_current_different_flash);
+TEST (host_flash_verification_cache_test_is_current_bad_hmac);
+TEST (host_flash_verification_cache_test_is_current_null);
+TEST (host_flash_verification_cache_test_is_current_read_error);
+TEST (host_flash_verification_cache_test_is_current_pfm_hash_error);
+TEST (host_flash_verification_cache_test_invalidate);
+TEST (host_flash_verification_cache_test_invalidate_null);
+TEST (host_flash_verification_cache_test_invalidate_erase_error);
+
+TEST_SUITE_END;
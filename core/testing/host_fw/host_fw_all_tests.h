@@ -45,12 +45,24 @@ static void add_all_host_fw_tests (CuSuite *suite)
 	!defined TESTING_SKIP_HOST_FLASH_MANAGER_SINGLE_SUITE
 	TESTING_RUN_SUITE (host_flash_manager_single);
 #endif
+#if (defined TESTING_RUN_HOST_FLASH_VERIFICATION_CACHE_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_HOST_FLASH_VERIFICATION_CACHE_SUITE
+	TESTING_RUN_SUITE (host_flash_verification_cache);
+#endif
 #if (defined TESTING_RUN_HOST_FW_UTIL_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
 	!defined TESTING_SKIP_HOST_FW_UTIL_SUITE
 	TESTING_RUN_SUITE (host_fw_util);
 #endif
+#if (defined TESTING_RUN_HOST_FW_VERIFY_WORKER_ASYNC_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_HOST_FW_VERIFY_WORKER_ASYNC_SUITE
+	TESTING_RUN_SUITE (host_fw_verify_worker_async);
+#endif
 #if (defined TESTING_RUN_HOST_IRQ_HANDLER_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
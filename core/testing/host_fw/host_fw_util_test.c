@@ -8,6 +8,7 @@
 #include "host_fw/host_fw_util.h"
 #include "testing/mock/flash/flash_master_mock.h"
 #include "testing/mock/spi_filter/spi_filter_interface_mock.h"
+#include "testing/mock/host_fw/host_fw_verify_worker_mock.h"
 #include "testing/engines/hash_testing_engine.h"
 #include "testing/engines/rsa_testing_engine.h"
 #include "testing/crypto/rsa_testing.h"
@@ -373,12 +374,7 @@ static void host_fw_determine_version_test_same_address_different_lengths (CuTes
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp, 7,
-		FLASH_EXP_READ_CMD (0x03, 0x100, 0, -1, 4));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp, 7,
-		FLASH_EXP_READ_CMD (0x03, 0x104, 0, -1, 2));
+		FLASH_EXP_READ_CMD (0x03, 0x100, 0, -1, 7));
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -583,7 +579,7 @@ static void host_fw_determine_version_test_read_fail (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void host_fw_determine_version_test_read_fail_cache_update (CuTest *test)
+static void host_fw_determine_version_test_read_fail_same_address (CuTest *test)
 {
 	struct pfm_firmware_version version[4];
 	struct pfm_firmware_versions version_list;
@@ -591,7 +587,6 @@ static void host_fw_determine_version_test_read_fail_cache_update (CuTest *test)
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	int status;
-	const char *version_exp = "222222";
 	const struct pfm_firmware_version *version_out;
 
 	TEST_START;
@@ -605,12 +600,7 @@ static void host_fw_determine_version_test_read_fail_cache_update (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp, 7,
-		FLASH_EXP_READ_CMD (0x03, 0x100, 0, -1, 4));
-
-	status |= flash_master_mock_expect_xfer (&flash_mock, FLASH_MASTER_XFER_FAILED,
+	status = flash_master_mock_expect_xfer (&flash_mock, FLASH_MASTER_XFER_FAILED,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
@@ -988,12 +978,7 @@ static void host_fw_determine_offset_version_test_same_address_different_lengths
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp, 7,
-		FLASH_EXP_READ_CMD (0x03, 0x50100, 0, -1, 4));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp, 7,
-		FLASH_EXP_READ_CMD (0x03, 0x50104, 0, -1, 2));
+		FLASH_EXP_READ_CMD (0x03, 0x50100, 0, -1, 7));
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -1199,7 +1184,7 @@ static void host_fw_determine_offset_version_test_read_fail (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void host_fw_determine_offset_version_test_read_fail_cache_update (CuTest *test)
+static void host_fw_determine_offset_version_test_read_fail_same_address (CuTest *test)
 {
 	struct pfm_firmware_version version[4];
 	struct pfm_firmware_versions version_list;
@@ -1207,7 +1192,6 @@ static void host_fw_determine_offset_version_test_read_fail_cache_update (CuTest
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	int status;
-	const char *version_exp = "222222";
 	const struct pfm_firmware_version *version_out;
 
 	TEST_START;
@@ -1221,12 +1205,7 @@ static void host_fw_determine_offset_version_test_read_fail_cache_update (CuTest
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp, 7,
-		FLASH_EXP_READ_CMD (0x03, 0x50100, 0, -1, 4));
-
-	status |= flash_master_mock_expect_xfer (&flash_mock, FLASH_MASTER_XFER_FAILED,
+	status = flash_master_mock_expect_xfer (&flash_mock, FLASH_MASTER_XFER_FAILED,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
@@ -1252,27 +1231,19 @@ static void host_fw_determine_offset_version_test_read_fail_cache_update (CuTest
 	spi_flash_release (&flash);
 }
 
-static void host_fw_verify_images_test (CuTest *test)
+static void host_fw_determine_version_test_many_versions_same_address (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list list;
+	struct pfm_firmware_version version[8];
+	struct pfm_firmware_versions version_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	const char *version_exp = "1.2.10-rc";
+	const struct pfm_firmware_version *version_out;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -1284,57 +1255,55 @@ static void host_fw_verify_images_test (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x100, 0, -1, strlen (version_exp)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
-
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	version[0].fw_version_id = "1.2";
+	version[0].version_addr = 0x100;
+	version[1].fw_version_id = "1.2.10";
+	version[1].version_addr = 0x100;
+	version[2].fw_version_id = "1.2.1";
+	version[2].version_addr = 0x100;
+	version[3].fw_version_id = "1.2.10-rc";
+	version[3].version_addr = 0x100;
+	version[4].fw_version_id = "1.2.2";
+	version[4].version_addr = 0x100;
+	version[5].fw_version_id = "1.3";
+	version[5].version_addr = 0x100;
+	version[6].fw_version_id = "1.2.11";
+	version[6].version_addr = 0x100;
+	version[7].fw_version_id = "2";
+	version[7].version_addr = 0x100;
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	version_list.versions = version;
+	version_list.count = 8;
 
-	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
+	status = host_fw_determine_version (&flash, &version_list, &version_out);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &version[3], (void*) version_out);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
 	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_invalid (CuTest *test)
+static void host_fw_determine_version_test_many_versions_same_address_prefix_priority (
+	CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list list;
+	struct pfm_firmware_version version[4];
+	struct pfm_firmware_versions version_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	const char *version_exp = "ABCDEF";
+	const struct pfm_firmware_version *version_out;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -1346,57 +1315,49 @@ static void host_fw_verify_images_test_invalid (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x100, 0, -1, strlen (version_exp)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
-
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	/* Both "ABC" and "ABCDEF" match the flash contents, but the later entry has priority even
+	 * though it is shorter. */
+	version[0].fw_version_id = "ABCDEF";
+	version[0].version_addr = 0x100;
+	version[1].fw_version_id = "ABD";
+	version[1].version_addr = 0x100;
+	version[2].fw_version_id = "ABC";
+	version[2].version_addr = 0x100;
+	version[3].fw_version_id = "ABCDEG";
+	version[3].version_addr = 0x100;
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	version_list.versions = version;
+	version_list.count = 4;
 
-	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	status = host_fw_determine_version (&flash, &version_list, &version_out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &version[2], (void*) version_out);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
 	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_not_contiguous (CuTest *test)
+static void host_fw_determine_version_test_multiple_addresses_interleaved (CuTest *test)
 {
-	struct flash_region region[4];
-	struct pfm_image_signature sig;
-	struct pfm_image_list list;
+	struct pfm_firmware_version version[6];
+	struct pfm_firmware_versions version_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	const char *version_exp1 = "BBBBBB";
+	const char *version_exp2 = "AAAA";
+	const struct pfm_firmware_version *version_out;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -1408,80 +1369,57 @@ static void host_fw_verify_images_test_not_contiguous (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 1, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 2, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, 1));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp1,
+		strlen (version_exp1), FLASH_EXP_READ_CMD (0x03, 0x200, 0, -1, strlen (version_exp1)));
 
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 3, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x40000, 0, -1, 1));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp2,
+		strlen (version_exp2), FLASH_EXP_READ_CMD (0x03, 0x100, 0, -1, strlen (version_exp2)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = 1;
-	region[1].start_addr = 0x20000;
-	region[1].length = 1;
-	region[2].start_addr = 0x30000;
-	region[2].length = 1;
-	region[3].start_addr = 0x40000;
-	region[3].length = 1;
-
-	sig.regions = region;
-	sig.count = 4;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	version[0].fw_version_id = "AAAA";
+	version[0].version_addr = 0x100;
+	version[1].fw_version_id = "CCCCCC";
+	version[1].version_addr = 0x200;
+	version[2].fw_version_id = "AAAB";
+	version[2].version_addr = 0x100;
+	version[3].fw_version_id = "AAA";
+	version[3].version_addr = 0x100;
+	version[4].fw_version_id = "DDDDDD";
+	version[4].version_addr = 0x200;
+	version[5].fw_version_id = "EEEE";
+	version[5].version_addr = 0x200;
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	version_list.versions = version;
+	version_list.count = 6;
 
-	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
+	status = host_fw_determine_version (&flash, &version_list, &version_out);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &version[3], (void*) version_out);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
 	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_multiple (CuTest *test)
+static void host_fw_version_matcher_test_find_multiple_times (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_signature sig[3];
-	struct pfm_image_list list;
+	struct pfm_firmware_version version[3];
+	struct pfm_firmware_versions version_list;
+	struct host_fw_version_matcher matcher;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	const char *version_exp1 = "3333";
+	const char *version_exp2 = "1111";
+	const struct pfm_firmware_version *version_out;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -1491,242 +1429,141 @@ static void host_fw_verify_images_test_multiple (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
+	version[0].fw_version_id = "1111";
+	version[0].version_addr = 0x100;
+	version[1].fw_version_id = "2222";
+	version[1].version_addr = 0x100;
+	version[2].fw_version_id = "3333";
+	version[2].version_addr = 0x100;
 
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+	version_list.versions = version;
+	version_list.count = 3;
+
+	status = host_fw_version_matcher_init (&matcher, &version_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, matcher.group_count);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp1,
+		strlen (version_exp1), FLASH_EXP_READ_CMD (0x03, 0x100, 0, -1, strlen (version_exp1)));
 
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp2,
+		strlen (version_exp2), FLASH_EXP_READ_CMD (0x03, 0x10100, 0, -1, strlen (version_exp2)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	sig[0].regions = &region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
-
-	sig[1].regions = &region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
-
-	sig[2].regions = &region[2];
-	sig[2].count = 1;
-	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
-	sig[2].sig_length = RSA_ENCRYPT_LEN;
-	sig[2].always_validate = 1;
-
-	list.images_sig = sig;
-	list.images_hash = NULL;
-	list.count = 3;
+	status = host_fw_version_matcher_find (&matcher, &flash, 0, &version_out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &version[2], (void*) version_out);
 
-	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
+	status = host_fw_version_matcher_find (&matcher, &flash, 0x10000, &version_out);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &version[0], (void*) version_out);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
+	host_fw_version_matcher_release (&matcher);
 	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_multiple_one_invalid (CuTest *test)
+static void host_fw_version_matcher_test_init_null (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_signature sig[3];
-	struct pfm_image_list list;
-	struct flash_master_mock flash_mock;
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct pfm_firmware_version version;
+	struct pfm_firmware_versions version_list;
+	struct host_fw_version_matcher matcher;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
+	version.fw_version_id = "1234";
+	version.version_addr = 0x1234;
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
+	version_list.versions = &version;
+	version_list.count = 1;
 
-	status = flash_master_mock_init (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &flash_mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
-
-	CuAssertIntEquals (test, 0, status);
-
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	sig[0].regions = &region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
+	status = host_fw_version_matcher_init (NULL, &version_list);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	sig[1].regions = &region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
+	status = host_fw_version_matcher_init (&matcher, NULL);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+}
 
-	sig[2].regions = &region[2];
-	sig[2].count = 1;
-	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
-	sig[2].sig_length = RSA_ENCRYPT_LEN;
-	sig[2].always_validate = 1;
+static void host_fw_version_matcher_test_init_empty_list (CuTest *test)
+{
+	struct pfm_firmware_versions version_list;
+	struct host_fw_version_matcher matcher;
+	int status;
 
-	list.images_sig = sig;
-	list.images_hash = NULL;
-	list.count = 3;
+	TEST_START;
 
-	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	version_list.versions = NULL;
+	version_list.count = 0;
 
-	status = flash_master_mock_validate_and_release (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_version_matcher_init (&matcher, &version_list);
+	CuAssertIntEquals (test, HOST_FW_UTIL_UNSUPPORTED_VERSION, status);
 
-	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
+	host_fw_version_matcher_release (&matcher);
 }
 
-static void host_fw_verify_images_test_partial_validation (CuTest *test)
+static void host_fw_version_matcher_test_find_null (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_signature sig[3];
-	struct pfm_image_list list;
+	struct pfm_firmware_version version;
+	struct pfm_firmware_versions version_list;
+	struct host_fw_version_matcher matcher;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	const struct pfm_firmware_version *version_out;
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
-
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
+	version.fw_version_id = "1234";
+	version.version_addr = 0x1234;
 
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
+	version_list.versions = &version;
+	version_list.count = 1;
 
+	status = host_fw_version_matcher_init (&matcher, &version_list);
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	sig[0].regions = &region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
-
-	sig[1].regions = &region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 0;
-
-	sig[2].regions = &region[2];
-	sig[2].count = 1;
-	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
-	sig[2].sig_length = RSA_ENCRYPT_LEN;
-	sig[2].always_validate = 1;
+	status = host_fw_version_matcher_find (NULL, &flash, 0, &version_out);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	list.images_sig = sig;
-	list.images_hash = NULL;
-	list.count = 3;
+	status = host_fw_version_matcher_find (&matcher, NULL, 0, &version_out);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_version_matcher_find (&matcher, &flash, 0, NULL);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
+	host_fw_version_matcher_release (&matcher);
 	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_no_images (CuTest *test)
+static void host_fw_version_matcher_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	host_fw_version_matcher_release (NULL);
+}
+
+static void host_fw_verify_images_test (CuTest *test)
 {
+	struct flash_region region;
+	struct pfm_image_signature sig;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -1734,6 +1571,7 @@ static void host_fw_verify_images_test_no_images (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data = "Test";
 
 	TEST_START;
 
@@ -1752,9 +1590,26 @@ static void host_fw_verify_images_test_no_images (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	list.images_sig = NULL;
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
+
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	list.images_sig = &sig;
 	list.images_hash = NULL;
-	list.count = 0;
+	list.count = 1;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
@@ -1767,10 +1622,10 @@ static void host_fw_verify_images_test_no_images (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_sha256 (CuTest *test)
+static void host_fw_verify_images_test_invalid (CuTest *test)
 {
 	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct pfm_image_signature sig;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -1807,19 +1662,19 @@ static void host_fw_verify_images_test_hashes_sha256 (CuTest *test)
 	region.start_addr = 0x10000;
 	region.length = strlen (data);
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
-	img_hash.always_validate = 1;
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
+	list.images_sig = &sig;
+	list.images_hash = NULL;
 	list.count = 1;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -1829,10 +1684,10 @@ static void host_fw_verify_images_test_hashes_sha256 (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_sha384 (CuTest *test)
+static void host_fw_verify_images_test_not_contiguous (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct flash_region region[4];
+	struct pfm_image_signature sig;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -1862,22 +1717,43 @@ static void host_fw_verify_images_test_hashes_sha384 (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, 1));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 1, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, 1));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 2, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, 1));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 3, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x40000, 0, -1, 1));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	region[0].start_addr = 0x10000;
+	region[0].length = 1;
+	region[1].start_addr = 0x20000;
+	region[1].length = 1;
+	region[2].start_addr = 0x30000;
+	region[2].length = 1;
+	region[3].start_addr = 0x40000;
+	region[3].length = 1;
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA384_TEST_HASH, SHA384_HASH_LENGTH);
-	img_hash.hash_length = SHA384_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA384;
-	img_hash.always_validate = 1;
+	sig.regions = region;
+	sig.count = 4;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
+	list.images_sig = &sig;
+	list.images_hash = NULL;
 	list.count = 1;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
@@ -1891,10 +1767,10 @@ static void host_fw_verify_images_test_hashes_sha384 (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_sha512 (CuTest *test)
+static void host_fw_verify_images_test_multiple (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct flash_region region[3];
+	struct pfm_image_signature sig[3];
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -1902,7 +1778,9 @@ static void host_fw_verify_images_test_hashes_sha512 (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -1923,24 +1801,52 @@ static void host_fw_verify_images_test_hashes_sha512 (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA512_TEST_HASH, SHA512_HASH_LENGTH);
-	img_hash.hash_length = SHA512_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA512;
-	img_hash.always_validate = 1;
+	CuAssertIntEquals (test, 0, status);
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
+
+	sig[0].regions = &region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
+
+	sig[1].regions = &region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
+
+	sig[2].regions = &region[2];
+	sig[2].count = 1;
+	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
+	sig[2].sig_length = RSA_ENCRYPT_LEN;
+	sig[2].always_validate = 1;
+
+	list.images_sig = sig;
+	list.images_hash = NULL;
+	list.count = 3;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
@@ -1953,10 +1859,10 @@ static void host_fw_verify_images_test_hashes_sha512 (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_sha256_invalid (CuTest *test)
+static void host_fw_verify_images_test_multiple_one_invalid (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct flash_region region[3];
+	struct pfm_image_signature sig[3];
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -1964,7 +1870,9 @@ static void host_fw_verify_images_test_hashes_sha256_invalid (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -1985,27 +1893,50 @@ static void host_fw_verify_images_test_hashes_sha256_invalid (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
-	img_hash.always_validate = 1;
+	sig[0].regions = &region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
+	sig[1].regions = &region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
+
+	sig[2].regions = &region[2];
+	sig[2].count = 1;
+	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
+	sig[2].sig_length = RSA_ENCRYPT_LEN;
+	sig[2].always_validate = 1;
+
+	list.images_sig = sig;
+	list.images_hash = NULL;
+	list.count = 3;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -2015,10 +1946,10 @@ static void host_fw_verify_images_test_hashes_sha256_invalid (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_sha384_invalid (CuTest *test)
+static void host_fw_verify_images_test_partial_validation (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct flash_region region[3];
+	struct pfm_image_signature sig[3];
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2026,7 +1957,9 @@ static void host_fw_verify_images_test_hashes_sha384_invalid (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -2047,27 +1980,50 @@ static void host_fw_verify_images_test_hashes_sha384_invalid (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA384_EMPTY_BUFFER_HASH, SHA384_HASH_LENGTH);
-	img_hash.hash_length = SHA384_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA384;
-	img_hash.always_validate = 1;
+	sig[0].regions = &region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
+	sig[1].regions = &region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 0;
+
+	sig[2].regions = &region[2];
+	sig[2].count = 1;
+	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
+	sig[2].sig_length = RSA_ENCRYPT_LEN;
+	sig[2].always_validate = 1;
+
+	list.images_sig = sig;
+	list.images_hash = NULL;
+	list.count = 3;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -2077,10 +2033,8 @@ static void host_fw_verify_images_test_hashes_sha384_invalid (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_sha512_invalid (CuTest *test)
+static void host_fw_verify_images_test_no_images (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2088,7 +2042,6 @@ static void host_fw_verify_images_test_hashes_sha512_invalid (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
 
 	TEST_START;
 
@@ -2107,29 +2060,12 @@ static void host_fw_verify_images_test_hashes_sha512_invalid (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
-
-	CuAssertIntEquals (test, 0, status);
-
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
-
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA512_EMPTY_BUFFER_HASH, SHA512_HASH_LENGTH);
-	img_hash.hash_length = SHA512_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA512;
-	img_hash.always_validate = 1;
-
-	list.images_hash = &img_hash;
 	list.images_sig = NULL;
-	list.count = 1;
+	list.images_hash = NULL;
+	list.count = 0;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -2139,9 +2075,9 @@ static void host_fw_verify_images_test_hashes_sha512_invalid (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_not_contiguous (CuTest *test)
+static void host_fw_verify_images_test_hashes_sha256 (CuTest *test)
 {
-	struct flash_region region[4];
+	struct flash_region region;
 	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
@@ -2172,36 +2108,15 @@ static void host_fw_verify_images_test_hashes_not_contiguous (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 1, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 2, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 3, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x40000, 0, -1, 1));
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = 1;
-	region[1].start_addr = 0x20000;
-	region[1].length = 1;
-	region[2].start_addr = 0x30000;
-	region[2].length = 1;
-	region[3].start_addr = 0x40000;
-	region[3].length = 1;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	img_hash.regions = region;
-	img_hash.count = 4;
+	img_hash.regions = &region;
+	img_hash.count = 1;
 	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
 	img_hash.hash_length = SHA256_HASH_LENGTH;
 	img_hash.hash_type = HASH_TYPE_SHA256;
@@ -2222,10 +2137,10 @@ static void host_fw_verify_images_test_hashes_not_contiguous (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_multiple (CuTest *test)
+static void host_fw_verify_images_test_hashes_sha384 (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_hash img_hash[3];
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2233,9 +2148,7 @@ static void host_fw_verify_images_test_hashes_multiple (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -2256,52 +2169,24 @@ static void host_fw_verify_images_test_hashes_multiple (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	img_hash[0].regions = &region[0];
-	img_hash[0].count = 1;
-	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash[0].hash_length = SHA256_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA256;
-	img_hash[0].always_validate = 1;
-
-	img_hash[1].regions = &region[1];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 1;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	img_hash[2].regions = &region[2];
-	img_hash[2].count = 1;
-	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
-	img_hash[2].hash_length = SHA512_HASH_LENGTH;
-	img_hash[2].hash_type = HASH_TYPE_SHA512;
-	img_hash[2].always_validate = 1;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA384_TEST_HASH, SHA384_HASH_LENGTH);
+	img_hash.hash_length = SHA384_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA384;
+	img_hash.always_validate = 1;
 
-	list.images_hash = img_hash;
+	list.images_hash = &img_hash;
 	list.images_sig = NULL;
-	list.count = 3;
+	list.count = 1;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
@@ -2314,10 +2199,10 @@ static void host_fw_verify_images_test_hashes_multiple (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_multiple_one_invalid (CuTest *test)
+static void host_fw_verify_images_test_hashes_sha512 (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_hash img_hash[3];
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2325,9 +2210,7 @@ static void host_fw_verify_images_test_hashes_multiple_one_invalid (CuTest *test
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -2348,50 +2231,27 @@ static void host_fw_verify_images_test_hashes_multiple_one_invalid (CuTest *test
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	img_hash[0].regions = &region[0];
-	img_hash[0].count = 1;
-	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash[0].hash_length = SHA256_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA256;
-	img_hash[0].always_validate = 1;
-
-	img_hash[1].regions = &region[1];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_BAD_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 1;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	img_hash[2].regions = &region[2];
-	img_hash[2].count = 1;
-	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
-	img_hash[2].hash_length = SHA512_HASH_LENGTH;
-	img_hash[2].hash_type = HASH_TYPE_SHA512;
-	img_hash[2].always_validate = 1;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA512_TEST_HASH, SHA512_HASH_LENGTH);
+	img_hash.hash_length = SHA512_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA512;
+	img_hash.always_validate = 1;
 
-	list.images_hash = img_hash;
+	list.images_hash = &img_hash;
 	list.images_sig = NULL;
-	list.count = 3;
+	list.count = 1;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -2401,10 +2261,10 @@ static void host_fw_verify_images_test_hashes_multiple_one_invalid (CuTest *test
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_partial_validation (CuTest *test)
+static void host_fw_verify_images_test_hashes_sha256_invalid (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_hash img_hash[3];
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2412,9 +2272,7 @@ static void host_fw_verify_images_test_hashes_partial_validation (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -2435,50 +2293,27 @@ static void host_fw_verify_images_test_hashes_partial_validation (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	img_hash[0].regions = &region[0];
-	img_hash[0].count = 1;
-	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash[0].hash_length = SHA256_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA256;
-	img_hash[0].always_validate = 1;
-
-	img_hash[1].regions = &region[1];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 0;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	img_hash[2].regions = &region[2];
-	img_hash[2].count = 1;
-	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
-	img_hash[2].hash_length = SHA512_HASH_LENGTH;
-	img_hash[2].hash_type = HASH_TYPE_SHA512;
-	img_hash[2].always_validate = 1;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
 
-	list.images_hash = img_hash;
+	list.images_hash = &img_hash;
 	list.images_sig = NULL;
-	list.count = 3;
+	list.count = 1;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -2488,7 +2323,7 @@ static void host_fw_verify_images_test_hashes_partial_validation (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_hashes_hash_error (CuTest *test)
+static void host_fw_verify_images_test_hashes_sha384_invalid (CuTest *test)
 {
 	struct flash_region region;
 	struct pfm_image_hash img_hash;
@@ -2518,14 +2353,21 @@ static void host_fw_verify_images_test_hashes_hash_error (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
 	region.start_addr = 0x10000;
 	region.length = strlen (data);
 
 	img_hash.regions = &region;
 	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = (enum hash_type) 10;
+	memcpy (img_hash.hash, SHA384_EMPTY_BUFFER_HASH, SHA384_HASH_LENGTH);
+	img_hash.hash_length = SHA384_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA384;
 	img_hash.always_validate = 1;
 
 	list.images_hash = &img_hash;
@@ -2533,7 +2375,7 @@ static void host_fw_verify_images_test_hashes_hash_error (CuTest *test)
 	list.count = 1;
 
 	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HASH_ENGINE_UNKNOWN_HASH, status);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -2543,10 +2385,10 @@ static void host_fw_verify_images_test_hashes_hash_error (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_test_null (CuTest *test)
+static void host_fw_verify_images_test_hashes_sha512_invalid (CuTest *test)
 {
 	struct flash_region region;
-	struct pfm_image_signature sig;
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2573,31 +2415,29 @@ static void host_fw_verify_images_test_null (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
 	region.start_addr = 0x10000;
 	region.length = strlen (data);
 
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA512_EMPTY_BUFFER_HASH, SHA512_HASH_LENGTH);
+	img_hash.hash_length = SHA512_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA512;
+	img_hash.always_validate = 1;
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
+	list.images_hash = &img_hash;
+	list.images_sig = NULL;
 	list.count = 1;
 
-	status = host_fw_verify_images (NULL, &list, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
-	status = host_fw_verify_images (&flash, NULL, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
-	status = host_fw_verify_images (&flash, &list, NULL, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
-	status = host_fw_verify_images (&flash, &list, &hash.base, NULL);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -2607,10 +2447,10 @@ static void host_fw_verify_images_test_null (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test (CuTest *test)
+static void host_fw_verify_images_test_hashes_not_contiguous (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_signature sig;
+	struct flash_region region[4];
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2640,39 +2480,60 @@ static void host_fw_verify_offset_images_test (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
-
-	CuAssertIntEquals (test, 0, status);
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, 1));
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 1, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, 1));
 
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 2, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, 1));
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 3, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x40000, 0, -1, 1));
 
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
+	region[0].start_addr = 0x10000;
+	region[0].length = 1;
+	region[1].start_addr = 0x20000;
+	region[1].length = 1;
+	region[2].start_addr = 0x30000;
+	region[2].length = 1;
+	region[3].start_addr = 0x40000;
+	region[3].length = 1;
 
-	spi_flash_release (&flash);
+	img_hash.regions = region;
+	img_hash.count = 4;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
+
+	list.images_hash = &img_hash;
+	list.images_sig = NULL;
+	list.count = 1;
+
+	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_no_offset (CuTest *test)
+static void host_fw_verify_images_test_hashes_multiple (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_signature sig;
+	struct flash_region region[3];
+	struct pfm_image_hash img_hash[3];
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2680,7 +2541,9 @@ static void host_fw_verify_offset_images_test_no_offset (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -2701,26 +2564,54 @@ static void host_fw_verify_offset_images_test_no_offset (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	img_hash[0].regions = &region[0];
+	img_hash[0].count = 1;
+	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash[0].hash_length = SHA256_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA256;
+	img_hash[0].always_validate = 1;
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	img_hash[1].regions = &region[1];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 1;
 
-	status = host_fw_verify_offset_images (&flash, &list, 0, &hash.base, &rsa.base);
+	img_hash[2].regions = &region[2];
+	img_hash[2].count = 1;
+	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
+	img_hash[2].hash_length = SHA512_HASH_LENGTH;
+	img_hash[2].hash_type = HASH_TYPE_SHA512;
+	img_hash[2].always_validate = 1;
+
+	list.images_hash = img_hash;
+	list.images_sig = NULL;
+	list.count = 3;
+
+	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -2731,10 +2622,10 @@ static void host_fw_verify_offset_images_test_no_offset (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_invalid (CuTest *test)
+static void host_fw_verify_images_test_hashes_multiple_one_invalid (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_signature sig;
+	struct flash_region region[3];
+	struct pfm_image_hash img_hash[3];
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2742,7 +2633,9 @@ static void host_fw_verify_offset_images_test_invalid (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -2763,27 +2656,50 @@ static void host_fw_verify_offset_images_test_invalid (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x310000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	img_hash[0].regions = &region[0];
+	img_hash[0].count = 1;
+	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash[0].hash_length = SHA256_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA256;
+	img_hash[0].always_validate = 1;
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	img_hash[1].regions = &region[1];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_BAD_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 1;
 
-	status = host_fw_verify_offset_images (&flash, &list, 0x300000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	img_hash[2].regions = &region[2];
+	img_hash[2].count = 1;
+	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
+	img_hash[2].hash_length = SHA512_HASH_LENGTH;
+	img_hash[2].hash_type = HASH_TYPE_SHA512;
+	img_hash[2].always_validate = 1;
+
+	list.images_hash = img_hash;
+	list.images_sig = NULL;
+	list.count = 3;
+
+	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -2793,10 +2709,10 @@ static void host_fw_verify_offset_images_test_invalid (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_not_contiguous (CuTest *test)
+static void host_fw_verify_images_test_hashes_partial_validation (CuTest *test)
 {
-	struct flash_region region[4];
-	struct pfm_image_signature sig;
+	struct flash_region region[3];
+	struct pfm_image_hash img_hash[3];
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2804,7 +2720,9 @@ static void host_fw_verify_offset_images_test_not_contiguous (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -2825,47 +2743,49 @@ static void host_fw_verify_offset_images_test_not_contiguous (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 1, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 2, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, 1));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
 
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 3, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x440000, 0, -1, 1));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
 
 	CuAssertIntEquals (test, 0, status);
 
 	region[0].start_addr = 0x10000;
-	region[0].length = 1;
+	region[0].length = strlen (data1);
 	region[1].start_addr = 0x20000;
-	region[1].length = 1;
+	region[1].length = strlen (data2);
 	region[2].start_addr = 0x30000;
-	region[2].length = 1;
-	region[3].start_addr = 0x40000;
-	region[3].length = 1;
+	region[2].length = strlen (data3);
 
-	sig.regions = region;
-	sig.count = 4;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	img_hash[0].regions = &region[0];
+	img_hash[0].count = 1;
+	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash[0].hash_length = SHA256_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA256;
+	img_hash[0].always_validate = 1;
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	img_hash[1].regions = &region[1];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 0;
 
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
+	img_hash[2].regions = &region[2];
+	img_hash[2].count = 1;
+	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
+	img_hash[2].hash_length = SHA512_HASH_LENGTH;
+	img_hash[2].hash_type = HASH_TYPE_SHA512;
+	img_hash[2].always_validate = 1;
+
+	list.images_hash = img_hash;
+	list.images_sig = NULL;
+	list.count = 3;
+
+	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -2876,10 +2796,10 @@ static void host_fw_verify_offset_images_test_not_contiguous (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_multiple (CuTest *test)
+static void host_fw_verify_images_test_hashes_hash_error (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_signature sig[3];
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2887,9 +2807,7 @@ static void host_fw_verify_offset_images_test_multiple (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -2908,59 +2826,24 @@ static void host_fw_verify_offset_images_test_multiple (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = (enum hash_type) 10;
+	img_hash.always_validate = 1;
 
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
+	list.images_hash = &img_hash;
+	list.images_sig = NULL;
+	list.count = 1;
+
+	status = host_fw_verify_images (&flash, &list, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HASH_ENGINE_UNKNOWN_HASH, status);
 
-	CuAssertIntEquals (test, 0, status);
-
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	sig[0].regions = &region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
-
-	sig[1].regions = &region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
-
-	sig[2].regions = &region[2];
-	sig[2].count = 1;
-	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
-	sig[2].sig_length = RSA_ENCRYPT_LEN;
-	sig[2].always_validate = 1;
-
-	list.images_sig = sig;
-	list.images_hash = NULL;
-	list.count = 3;
-
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_validate_and_release (&flash_mock);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
 	spi_flash_release (&flash);
@@ -2968,10 +2851,10 @@ static void host_fw_verify_offset_images_test_multiple (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_multiple_one_invalid (CuTest *test)
+static void host_fw_verify_images_test_null (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_signature sig[3];
+	struct flash_region region;
+	struct pfm_image_signature sig;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -2979,9 +2862,7 @@ static void host_fw_verify_offset_images_test_multiple_one_invalid (CuTest *test
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -3000,52 +2881,31 @@ static void host_fw_verify_offset_images_test_multiple_one_invalid (CuTest *test
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
-
-	CuAssertIntEquals (test, 0, status);
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	sig[0].regions = &region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
+	list.images_sig = &sig;
+	list.images_hash = NULL;
+	list.count = 1;
 
-	sig[1].regions = &region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
+	status = host_fw_verify_images (NULL, &list, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	sig[2].regions = &region[2];
-	sig[2].count = 1;
-	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
-	sig[2].sig_length = RSA_ENCRYPT_LEN;
-	sig[2].always_validate = 1;
+	status = host_fw_verify_images (&flash, NULL, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	list.images_sig = sig;
-	list.images_hash = NULL;
-	list.count = 3;
+	status = host_fw_verify_images (&flash, &list, NULL, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	status = host_fw_verify_images (&flash, &list, &hash.base, NULL);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -3055,10 +2915,10 @@ static void host_fw_verify_offset_images_test_multiple_one_invalid (CuTest *test
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_partial_validation (CuTest *test)
+static void host_fw_verify_offset_images_test (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_signature sig[3];
+	struct flash_region region;
+	struct pfm_image_signature sig;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3066,9 +2926,7 @@ static void host_fw_verify_offset_images_test_partial_validation (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -3089,47 +2947,24 @@ static void host_fw_verify_offset_images_test_partial_validation (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	sig[0].regions = &region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
-
-	sig[1].regions = &region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 0;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	sig[2].regions = &region[2];
-	sig[2].count = 1;
-	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
-	sig[2].sig_length = RSA_ENCRYPT_LEN;
-	sig[2].always_validate = 1;
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	list.images_sig = sig;
+	list.images_sig = &sig;
 	list.images_hash = NULL;
-	list.count = 3;
+	list.count = 1;
 
 	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
@@ -3142,8 +2977,10 @@ static void host_fw_verify_offset_images_test_partial_validation (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_no_images (CuTest *test)
+static void host_fw_verify_offset_images_test_no_offset (CuTest *test)
 {
+	struct flash_region region;
+	struct pfm_image_signature sig;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3151,6 +2988,7 @@ static void host_fw_verify_offset_images_test_no_images (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data = "Test";
 
 	TEST_START;
 
@@ -3169,11 +3007,28 @@ static void host_fw_verify_offset_images_test_no_images (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	list.images_sig = NULL;
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
+
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	list.images_sig = &sig;
 	list.images_hash = NULL;
-	list.count = 0;
+	list.count = 1;
 
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
+	status = host_fw_verify_offset_images (&flash, &list, 0, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -3184,10 +3039,10 @@ static void host_fw_verify_offset_images_test_no_images (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_sha256 (CuTest *test)
+static void host_fw_verify_offset_images_test_invalid (CuTest *test)
 {
 	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct pfm_image_signature sig;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3217,26 +3072,26 @@ static void host_fw_verify_offset_images_test_hashes_sha256 (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
+		FLASH_EXP_READ_CMD (0x03, 0x310000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
 	region.start_addr = 0x10000;
 	region.length = strlen (data);
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
-	img_hash.always_validate = 1;
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
+	list.images_sig = &sig;
+	list.images_hash = NULL;
 	list.count = 1;
 
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_verify_offset_images (&flash, &list, 0x300000, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -3246,10 +3101,10 @@ static void host_fw_verify_offset_images_test_hashes_sha256 (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_sha384 (CuTest *test)
+static void host_fw_verify_offset_images_test_not_contiguous (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct flash_region region[4];
+	struct pfm_image_signature sig;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3279,39 +3134,60 @@ static void host_fw_verify_offset_images_test_hashes_sha384 (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
-
-	CuAssertIntEquals (test, 0, status);
-
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, 1));
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA384_TEST_HASH, SHA384_HASH_LENGTH);
-	img_hash.hash_length = SHA384_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA384;
-	img_hash.always_validate = 1;
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 1, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, 1));
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 2, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, 1));
 
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 3, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x440000, 0, -1, 1));
 
-	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
+	region[0].start_addr = 0x10000;
+	region[0].length = 1;
+	region[1].start_addr = 0x20000;
+	region[1].length = 1;
+	region[2].start_addr = 0x30000;
+	region[2].length = 1;
+	region[3].start_addr = 0x40000;
+	region[3].length = 1;
+
+	sig.regions = region;
+	sig.count = 4;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	list.images_sig = &sig;
+	list.images_hash = NULL;
+	list.count = 1;
+
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_sha512 (CuTest *test)
+static void host_fw_verify_offset_images_test_multiple (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct flash_region region[3];
+	struct pfm_image_signature sig[3];
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3319,7 +3195,9 @@ static void host_fw_verify_offset_images_test_hashes_sha512 (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -3340,24 +3218,52 @@ static void host_fw_verify_offset_images_test_hashes_sha512 (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA512_TEST_HASH, SHA512_HASH_LENGTH);
-	img_hash.hash_length = SHA512_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA512;
-	img_hash.always_validate = 1;
+	sig[0].regions = &region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
+	sig[1].regions = &region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
+
+	sig[2].regions = &region[2];
+	sig[2].count = 1;
+	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
+	sig[2].sig_length = RSA_ENCRYPT_LEN;
+	sig[2].always_validate = 1;
+
+	list.images_sig = sig;
+	list.images_hash = NULL;
+	list.count = 3;
 
 	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
@@ -3370,10 +3276,10 @@ static void host_fw_verify_offset_images_test_hashes_sha512 (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_no_offset (CuTest *test)
+static void host_fw_verify_offset_images_test_multiple_one_invalid (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct flash_region region[3];
+	struct pfm_image_signature sig[3];
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3381,7 +3287,9 @@ static void host_fw_verify_offset_images_test_hashes_no_offset (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -3402,27 +3310,50 @@ static void host_fw_verify_offset_images_test_hashes_no_offset (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
-	img_hash.always_validate = 1;
+	sig[0].regions = &region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
+	sig[1].regions = &region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
 
-	status = host_fw_verify_offset_images (&flash, &list, 0, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	sig[2].regions = &region[2];
+	sig[2].count = 1;
+	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
+	sig[2].sig_length = RSA_ENCRYPT_LEN;
+	sig[2].always_validate = 1;
+
+	list.images_sig = sig;
+	list.images_hash = NULL;
+	list.count = 3;
+
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -3432,10 +3363,10 @@ static void host_fw_verify_offset_images_test_hashes_no_offset (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_sha256_invalid (CuTest *test)
+static void host_fw_verify_offset_images_test_partial_validation (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct flash_region region[3];
+	struct pfm_image_signature sig[3];
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3443,7 +3374,9 @@ static void host_fw_verify_offset_images_test_hashes_sha256_invalid (CuTest *tes
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -3464,27 +3397,50 @@ static void host_fw_verify_offset_images_test_hashes_sha256_invalid (CuTest *tes
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
-	img_hash.always_validate = 1;
+	sig[0].regions = &region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
+	sig[1].regions = &region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 0;
+
+	sig[2].regions = &region[2];
+	sig[2].count = 1;
+	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
+	sig[2].sig_length = RSA_ENCRYPT_LEN;
+	sig[2].always_validate = 1;
+
+	list.images_sig = sig;
+	list.images_hash = NULL;
+	list.count = 3;
 
 	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -3494,10 +3450,8 @@ static void host_fw_verify_offset_images_test_hashes_sha256_invalid (CuTest *tes
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_sha384_invalid (CuTest *test)
+static void host_fw_verify_offset_images_test_no_images (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3505,7 +3459,6 @@ static void host_fw_verify_offset_images_test_hashes_sha384_invalid (CuTest *tes
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
 
 	TEST_START;
 
@@ -3524,29 +3477,12 @@ static void host_fw_verify_offset_images_test_hashes_sha384_invalid (CuTest *tes
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
-
-	CuAssertIntEquals (test, 0, status);
-
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
-
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA384_EMPTY_BUFFER_HASH, SHA384_HASH_LENGTH);
-	img_hash.hash_length = SHA384_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA384;
-	img_hash.always_validate = 1;
-
-	list.images_hash = &img_hash;
 	list.images_sig = NULL;
-	list.count = 1;
+	list.images_hash = NULL;
+	list.count = 0;
 
 	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -3556,7 +3492,7 @@ static void host_fw_verify_offset_images_test_hashes_sha384_invalid (CuTest *tes
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_sha512_invalid (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_sha256 (CuTest *test)
 {
 	struct flash_region region;
 	struct pfm_image_hash img_hash;
@@ -3598,9 +3534,9 @@ static void host_fw_verify_offset_images_test_hashes_sha512_invalid (CuTest *tes
 
 	img_hash.regions = &region;
 	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA512_EMPTY_BUFFER_HASH, SHA512_HASH_LENGTH);
-	img_hash.hash_length = SHA512_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA512;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
 	img_hash.always_validate = 1;
 
 	list.images_hash = &img_hash;
@@ -3608,7 +3544,7 @@ static void host_fw_verify_offset_images_test_hashes_sha512_invalid (CuTest *tes
 	list.count = 1;
 
 	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -3618,9 +3554,9 @@ static void host_fw_verify_offset_images_test_hashes_sha512_invalid (CuTest *tes
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_not_contiguous (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_sha384 (CuTest *test)
 {
-	struct flash_region region[4];
+	struct flash_region region;
 	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
@@ -3651,39 +3587,18 @@ static void host_fw_verify_offset_images_test_hashes_not_contiguous (CuTest *tes
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 1, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 2, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 3, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x440000, 0, -1, 1));
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = 1;
-	region[1].start_addr = 0x20000;
-	region[1].length = 1;
-	region[2].start_addr = 0x30000;
-	region[2].length = 1;
-	region[3].start_addr = 0x40000;
-	region[3].length = 1;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	img_hash.regions = region;
-	img_hash.count = 4;
-	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA384_TEST_HASH, SHA384_HASH_LENGTH);
+	img_hash.hash_length = SHA384_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA384;
 	img_hash.always_validate = 1;
 
 	list.images_hash = &img_hash;
@@ -3701,10 +3616,10 @@ static void host_fw_verify_offset_images_test_hashes_not_contiguous (CuTest *tes
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_multiple (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_sha512 (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_hash img_hash[3];
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3712,9 +3627,7 @@ static void host_fw_verify_offset_images_test_hashes_multiple (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -3735,52 +3648,24 @@ static void host_fw_verify_offset_images_test_hashes_multiple (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	img_hash[0].regions = &region[0];
-	img_hash[0].count = 1;
-	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash[0].hash_length = SHA256_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA256;
-	img_hash[0].always_validate = 1;
-
-	img_hash[1].regions = &region[1];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 1;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	img_hash[2].regions = &region[2];
-	img_hash[2].count = 1;
-	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
-	img_hash[2].hash_length = SHA512_HASH_LENGTH;
-	img_hash[2].hash_type = HASH_TYPE_SHA512;
-	img_hash[2].always_validate = 1;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA512_TEST_HASH, SHA512_HASH_LENGTH);
+	img_hash.hash_length = SHA512_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA512;
+	img_hash.always_validate = 1;
 
-	list.images_hash = img_hash;
+	list.images_hash = &img_hash;
 	list.images_sig = NULL;
-	list.count = 3;
+	list.count = 1;
 
 	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
@@ -3793,10 +3678,10 @@ static void host_fw_verify_offset_images_test_hashes_multiple (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_multiple_one_invalid (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_no_offset (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_hash img_hash[3];
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3804,9 +3689,7 @@ static void host_fw_verify_offset_images_test_hashes_multiple_one_invalid (CuTes
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -3827,50 +3710,27 @@ static void host_fw_verify_offset_images_test_hashes_multiple_one_invalid (CuTes
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	img_hash[0].regions = &region[0];
-	img_hash[0].count = 1;
-	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash[0].hash_length = SHA256_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA256;
-	img_hash[0].always_validate = 1;
-
-	img_hash[1].regions = &region[1];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_BAD_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 1;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	img_hash[2].regions = &region[2];
-	img_hash[2].count = 1;
-	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
-	img_hash[2].hash_length = SHA512_HASH_LENGTH;
-	img_hash[2].hash_type = HASH_TYPE_SHA512;
-	img_hash[2].always_validate = 1;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
 
-	list.images_hash = img_hash;
+	list.images_hash = &img_hash;
 	list.images_sig = NULL;
-	list.count = 3;
+	list.count = 1;
 
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	status = host_fw_verify_offset_images (&flash, &list, 0, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -3880,10 +3740,10 @@ static void host_fw_verify_offset_images_test_hashes_multiple_one_invalid (CuTes
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_partial_validation (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_sha256_invalid (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_hash img_hash[3];
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -3891,9 +3751,7 @@ static void host_fw_verify_offset_images_test_hashes_partial_validation (CuTest
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -3914,50 +3772,27 @@ static void host_fw_verify_offset_images_test_hashes_partial_validation (CuTest
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	img_hash[0].regions = &region[0];
-	img_hash[0].count = 1;
-	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash[0].hash_length = SHA256_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA256;
-	img_hash[0].always_validate = 1;
-
-	img_hash[1].regions = &region[1];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 0;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	img_hash[2].regions = &region[2];
-	img_hash[2].count = 1;
-	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
-	img_hash[2].hash_length = SHA512_HASH_LENGTH;
-	img_hash[2].hash_type = HASH_TYPE_SHA512;
-	img_hash[2].always_validate = 1;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
 
-	list.images_hash = img_hash;
+	list.images_hash = &img_hash;
 	list.images_sig = NULL;
-	list.count = 3;
+	list.count = 1;
 
 	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -3967,7 +3802,7 @@ static void host_fw_verify_offset_images_test_hashes_partial_validation (CuTest
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_test_hashes_hash_error (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_sha384_invalid (CuTest *test)
 {
 	struct flash_region region;
 	struct pfm_image_hash img_hash;
@@ -3997,14 +3832,21 @@ static void host_fw_verify_offset_images_test_hashes_hash_error (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
 	region.start_addr = 0x10000;
 	region.length = strlen (data);
 
 	img_hash.regions = &region;
 	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = (enum hash_type) 10;
+	memcpy (img_hash.hash, SHA384_EMPTY_BUFFER_HASH, SHA384_HASH_LENGTH);
+	img_hash.hash_length = SHA384_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA384;
 	img_hash.always_validate = 1;
 
 	list.images_hash = &img_hash;
@@ -4012,7 +3854,7 @@ static void host_fw_verify_offset_images_test_hashes_hash_error (CuTest *test)
 	list.count = 1;
 
 	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HASH_ENGINE_UNKNOWN_HASH, status);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -4022,11 +3864,10 @@ static void host_fw_verify_offset_images_test_hashes_hash_error (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-
-static void host_fw_verify_offset_images_test_null (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_sha512_invalid (CuTest *test)
 {
 	struct flash_region region;
-	struct pfm_image_signature sig;
+	struct pfm_image_hash img_hash;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -4053,31 +3894,29 @@ static void host_fw_verify_offset_images_test_null (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
 	region.start_addr = 0x10000;
 	region.length = strlen (data);
 
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA512_EMPTY_BUFFER_HASH, SHA512_HASH_LENGTH);
+	img_hash.hash_length = SHA512_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA512;
+	img_hash.always_validate = 1;
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
+	list.images_hash = &img_hash;
+	list.images_sig = NULL;
 	list.count = 1;
 
-	status = host_fw_verify_offset_images (NULL, &list, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
-	status = host_fw_verify_offset_images (&flash, NULL, 0x400000, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, NULL, &rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
-	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, NULL);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -4087,14 +3926,11 @@ static void host_fw_verify_offset_images_test_null (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_not_contiguous (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list img_list;
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
-	struct pfm_read_write_regions rw_list;
+	struct flash_region region[4];
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -4117,45 +3953,52 @@ static void host_fw_full_flash_verification_test (CuTest *test)
 	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
-
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
-		0x200 - strlen (data));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x1000 - 0x300);
-
-	CuAssertIntEquals (test, 0, status);
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, 1));
 
-	img_region.start_addr = 0;
-	img_region.length = strlen (data);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 1, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, 1));
 
-	sig.regions = &img_region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 2, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, 1));
 
-	img_list.images_sig = &sig;
-	img_list.images_hash = NULL;
-	img_list.count = 1;
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data + 3, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x440000, 0, -1, 1));
 
-	rw_region.start_addr = 0x200;
-	rw_region.length = 0x100;
+	CuAssertIntEquals (test, 0, status);
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	region[0].start_addr = 0x10000;
+	region[0].length = 1;
+	region[1].start_addr = 0x20000;
+	region[1].length = 1;
+	region[2].start_addr = 0x30000;
+	region[2].length = 1;
+	region[3].start_addr = 0x40000;
+	region[3].length = 1;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	img_hash.regions = region;
+	img_hash.count = 4;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
 
-	status = spi_flash_set_device_size (&flash, 0x1000);
-	CuAssertIntEquals (test, 0, status);
+	list.images_hash = &img_hash;
+	list.images_sig = NULL;
+	list.count = 1;
 
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
-		&rsa.base);
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -4166,21 +4009,20 @@ static void host_fw_full_flash_verification_test (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_not_blank_byte (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_multiple (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list img_list;
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
-	struct pfm_read_write_regions rw_list;
+	struct flash_region region[3];
+	struct pfm_image_hash img_hash[3];
+	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -4196,45 +4038,59 @@ static void host_fw_full_flash_verification_test_not_blank_byte (CuTest *test)
 	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
-
-	status |= flash_master_mock_expect_value_check (&flash_mock, 0 + strlen (data),
-		0x200 - strlen (data), 0x55);
-	status |= flash_master_mock_expect_value_check (&flash_mock, 0x300, 0x1000 - 0x300, 0x55);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
 
-	img_region.start_addr = 0;
-	img_region.length = strlen (data);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
 
-	sig.regions = &img_region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	CuAssertIntEquals (test, 0, status);
 
-	img_list.images_sig = &sig;
-	img_list.images_hash = NULL;
-	img_list.count = 1;
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	rw_region.start_addr = 0x200;
-	rw_region.length = 0x100;
+	img_hash[0].regions = &region[0];
+	img_hash[0].count = 1;
+	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash[0].hash_length = SHA256_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA256;
+	img_hash[0].always_validate = 1;
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	img_hash[1].regions = &region[1];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 1;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	img_hash[2].regions = &region[2];
+	img_hash[2].count = 1;
+	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
+	img_hash[2].hash_length = SHA512_HASH_LENGTH;
+	img_hash[2].hash_type = HASH_TYPE_SHA512;
+	img_hash[2].always_validate = 1;
 
-	status = spi_flash_set_device_size (&flash, 0x1000);
-	CuAssertIntEquals (test, 0, status);
+	list.images_hash = img_hash;
+	list.images_sig = NULL;
+	list.count = 3;
 
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0x55, &hash.base,
-		&rsa.base);
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -4245,21 +4101,20 @@ static void host_fw_full_flash_verification_test_not_blank_byte (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_multiple_rw_regions (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_multiple_one_invalid (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list img_list;
-	struct flash_region rw_region[2];
-	struct pfm_read_write rw_prop[2];
-	struct pfm_read_write_regions rw_list;
+	struct flash_region region[3];
+	struct pfm_image_hash img_hash[3];
+	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -4275,50 +4130,55 @@ static void host_fw_full_flash_verification_test_multiple_rw_regions (CuTest *te
 	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
-		0x200 - strlen (data));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x300);
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x700, 0x1000 - 0x700);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	img_region.start_addr = 0;
-	img_region.length = strlen (data);
-
-	sig.regions = &img_region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	img_list.images_sig = &sig;
-	img_list.images_hash = NULL;
-	img_list.count = 1;
+	img_hash[0].regions = &region[0];
+	img_hash[0].count = 1;
+	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash[0].hash_length = SHA256_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA256;
+	img_hash[0].always_validate = 1;
 
-	rw_region[0].start_addr = 0x200;
-	rw_region[0].length = 0x100;
-	rw_region[1].start_addr = 0x600;
-	rw_region[1].length = 0x100;
+	img_hash[1].regions = &region[1];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_BAD_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 1;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	img_hash[2].regions = &region[2];
+	img_hash[2].count = 1;
+	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
+	img_hash[2].hash_length = SHA512_HASH_LENGTH;
+	img_hash[2].hash_type = HASH_TYPE_SHA512;
+	img_hash[2].always_validate = 1;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 2;
-
-	status = spi_flash_set_device_size (&flash, 0x1000);
-	CuAssertIntEquals (test, 0, status);
+	list.images_hash = img_hash;
+	list.images_sig = NULL;
+	list.count = 3;
 
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -4328,21 +4188,20 @@ static void host_fw_full_flash_verification_test_multiple_rw_regions (CuTest *te
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_image_between_rw_regions (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_partial_validation (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list img_list;
-	struct flash_region rw_region[2];
-	struct pfm_read_write rw_prop[2];
-	struct pfm_read_write_regions rw_list;
+	struct flash_region region[3];
+	struct pfm_image_hash img_hash[3];
+	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
@@ -4358,49 +4217,54 @@ static void host_fw_full_flash_verification_test_image_between_rw_regions (CuTes
 	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x900, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0, 0x800);
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x900 + strlen (data),
-		0xb00 - (0x900 + strlen (data)));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xc00, 0x1000 - 0xc00);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	img_region.start_addr = 0x900;
-	img_region.length = strlen (data);
-
-	sig.regions = &img_region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
-
-	img_list.images_sig = &sig;
-	img_list.images_hash = NULL;
-	img_list.count = 1;
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	rw_region[0].start_addr = 0x800;
-	rw_region[0].length = 0x100;
-	rw_region[1].start_addr = 0xb00;
-	rw_region[1].length = 0x100;
+	img_hash[0].regions = &region[0];
+	img_hash[0].count = 1;
+	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash[0].hash_length = SHA256_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA256;
+	img_hash[0].always_validate = 1;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	img_hash[1].regions = &region[1];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 0;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 2;
+	img_hash[2].regions = &region[2];
+	img_hash[2].count = 1;
+	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
+	img_hash[2].hash_length = SHA512_HASH_LENGTH;
+	img_hash[2].hash_type = HASH_TYPE_SHA512;
+	img_hash[2].always_validate = 1;
 
-	status = spi_flash_set_device_size (&flash, 0x1000);
-	CuAssertIntEquals (test, 0, status);
+	list.images_hash = img_hash;
+	list.images_sig = NULL;
+	list.count = 3;
 
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
-		&rsa.base);
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -4411,22 +4275,18 @@ static void host_fw_full_flash_verification_test_image_between_rw_regions (CuTes
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_multiple_images (CuTest *test)
+static void host_fw_verify_offset_images_test_hashes_hash_error (CuTest *test)
 {
-	struct flash_region img_region[2];
-	struct pfm_image_signature sig[2];
-	struct pfm_image_list img_list;
-	struct flash_region rw_region[2];
-	struct pfm_read_write rw_prop[2];
-	struct pfm_read_write_regions rw_list;
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -4442,65 +4302,25 @@ static void host_fw_full_flash_verification_test_multiple_images (CuTest *test)
 	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x900, 0, -1, strlen (data2)));
-
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data1),
-		0x800 - strlen (data1));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x900 + strlen (data2),
-		0xc00 - (0x900 + strlen (data2)));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xd00, 0x1000 - 0xd00);
-
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	img_region[0].start_addr = 0;
-	img_region[0].length = strlen (data1);
-	img_region[1].start_addr = 0x900;
-	img_region[1].length = strlen (data2);
-
-	sig[0].regions = &img_region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
-
-	sig[1].regions = &img_region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
-
-	img_list.images_sig = sig;
-	img_list.images_hash = NULL;
-	img_list.count = 2;
-
-	rw_region[0].start_addr = 0x800;
-	rw_region[0].length = 0x100;
-	rw_region[1].start_addr = 0xc00;
-	rw_region[1].length = 0x100;
-
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 2;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = (enum hash_type) 10;
+	img_hash.always_validate = 1;
 
-	status = spi_flash_set_device_size (&flash, 0x1000);
-	CuAssertIntEquals (test, 0, status);
+	list.images_hash = &img_hash;
+	list.images_sig = NULL;
+	list.count = 1;
 
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HASH_ENGINE_UNKNOWN_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -4510,22 +4330,19 @@ static void host_fw_full_flash_verification_test_multiple_images (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_offset_image (CuTest *test)
+
+static void host_fw_verify_offset_images_test_null (CuTest *test)
 {
-	struct flash_region img_region[2];
-	struct pfm_image_signature sig[2];
-	struct pfm_image_list img_list;
-	struct flash_region rw_region[2];
-	struct pfm_read_write rw_prop[2];
-	struct pfm_read_write_regions rw_list;
+	struct flash_region region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -4541,395 +4358,340 @@ static void host_fw_full_flash_verification_test_offset_image (CuTest *test)
 	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0xb00, 0, -1, strlen (data2)));
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data1),
-		0x800 - strlen (data1));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x900, 0xb00 - 0x900);
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xb00 + strlen (data2),
-		0xd00 - (0xb00 + strlen (data2)));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xe00, 0x1000 - 0xe00);
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	CuAssertIntEquals (test, 0, status);
+	list.images_sig = &sig;
+	list.images_hash = NULL;
+	list.count = 1;
 
-	img_region[0].start_addr = 0;
-	img_region[0].length = strlen (data1);
-	img_region[1].start_addr = 0xb00;
-	img_region[1].length = strlen (data2);
+	status = host_fw_verify_offset_images (NULL, &list, 0x400000, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	sig[0].regions = &img_region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
+	status = host_fw_verify_offset_images (&flash, NULL, 0x400000, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	sig[1].regions = &img_region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, NULL, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	img_list.images_sig = sig;
-	img_list.images_hash = NULL;
-	img_list.count = 2;
+	status = host_fw_verify_offset_images (&flash, &list, 0x400000, &hash.base, NULL);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	rw_region[0].start_addr = 0x800;
-	rw_region[0].length = 0x100;
-	rw_region[1].start_addr = 0xd00;
-	rw_region[1].length = 0x100;
-
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 2;
-
-	status = spi_flash_set_device_size (&flash, 0x1000);
-	CuAssertIntEquals (test, 0, status);
-
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_validate_and_release (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
 
 	spi_flash_release (&flash);
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_first_region_rw (CuTest *test)
+static void host_fw_region_map_init_test (CuTest *test)
 {
 	struct flash_region img_region[2];
-	struct pfm_image_signature sig[2];
+	struct pfm_image_signature sig;
 	struct pfm_image_list img_list;
-	struct flash_region rw_region[2];
-	struct pfm_read_write rw_prop[2];
+	struct flash_region rw_region;
 	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock;
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct host_fw_region_map map;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
+	img_region[0].start_addr = 0x800;
+	img_region[0].length = 0x100;
+	img_region[1].start_addr = 0;
+	img_region[1].length = 4;
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
+	sig.regions = img_region;
+	sig.count = 2;
 
-	status = flash_master_mock_init (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
 
-	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
+
+	rw_list.regions = &rw_region;
+	rw_list.count = 1;
+
+	status = host_fw_region_map_init (&map, &img_list, &rw_list, 1, 0x1000);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 6, map.count);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x300, 0, -1, strlen (data1)));
+	CuAssertIntEquals (test, 0, map.spans[0].start_addr);
+	CuAssertIntEquals (test, 4, map.spans[0].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_SIGNED, map.spans[0].type);
 
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0xa00, 0, -1, strlen (data2)));
+	CuAssertIntEquals (test, 4, map.spans[1].start_addr);
+	CuAssertIntEquals (test, 0x200 - 4, map.spans[1].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_UNUSED, map.spans[1].type);
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x100, 0x200);
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300 + strlen (data1),
-		0xa00 - (0x300 + strlen (data1)));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xa00 + strlen (data2),
-		0xc00 - (0xa00 + strlen (data2)));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xd00, 0x1000 - 0xd00);
+	CuAssertIntEquals (test, 0x200, map.spans[2].start_addr);
+	CuAssertIntEquals (test, 0x100, map.spans[2].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_RW, map.spans[2].type);
 
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0x300, map.spans[3].start_addr);
+	CuAssertIntEquals (test, 0x500, map.spans[3].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_UNUSED, map.spans[3].type);
 
-	img_region[0].start_addr = 0x300;
-	img_region[0].length = strlen (data1);
-	img_region[1].start_addr = 0xa00;
-	img_region[1].length = strlen (data2);
+	CuAssertIntEquals (test, 0x800, map.spans[4].start_addr);
+	CuAssertIntEquals (test, 0x100, map.spans[4].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_SIGNED, map.spans[4].type);
 
-	sig[0].regions = &img_region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
+	CuAssertIntEquals (test, 0x900, map.spans[5].start_addr);
+	CuAssertIntEquals (test, 0x700, map.spans[5].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_UNUSED, map.spans[5].type);
 
-	sig[1].regions = &img_region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
+	host_fw_region_map_release (&map);
+}
 
-	img_list.images_sig = sig;
-	img_list.images_hash = NULL;
-	img_list.count = 2;
+static void host_fw_region_map_init_test_merge_adjacent_same_type (CuTest *test)
+{
+	struct flash_region rw_region[3];
+	struct pfm_read_write_regions rw_list;
+	struct host_fw_region_map map;
+	int status;
 
-	rw_region[0].start_addr = 0;
+	TEST_START;
+
+	rw_region[0].start_addr = 0x300;
 	rw_region[0].length = 0x100;
-	rw_region[1].start_addr = 0xc00;
+	rw_region[1].start_addr = 0x100;
 	rw_region[1].length = 0x100;
-
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_region[2].start_addr = 0x200;
+	rw_region[2].length = 0x100;
 
 	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 2;
+	rw_list.count = 3;
 
-	status = spi_flash_set_device_size (&flash, 0x1000);
+	status = host_fw_region_map_init (&map, NULL, &rw_list, 1, 0);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, map.count);
 
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, map.spans[0].start_addr);
+	CuAssertIntEquals (test, 0x100, map.spans[0].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_UNUSED, map.spans[0].type);
 
-	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0x100, map.spans[1].start_addr);
+	CuAssertIntEquals (test, 0x300, map.spans[1].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_RW, map.spans[1].type);
+
+	host_fw_region_map_release (&map);
+}
+
+static void host_fw_region_map_init_test_adjacent_different_types (CuTest *test)
+{
+	struct flash_region img_region;
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write_regions rw_list;
+	struct host_fw_region_map map;
+	int status;
+
+	TEST_START;
+
+	img_region.start_addr = 0;
+	img_region.length = 0x100;
+
+	img_hash.regions = &img_region;
+	img_hash.count = 1;
+
+	img_list.images_sig = NULL;
+	img_list.images_hash = &img_hash;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x100;
+	rw_region.length = 0x100;
+
+	rw_list.regions = &rw_region;
+	rw_list.count = 1;
+
+	status = host_fw_region_map_init (&map, &img_list, &rw_list, 1, 0x200);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, map.count);
 
-	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
+	CuAssertIntEquals (test, 0, map.spans[0].start_addr);
+	CuAssertIntEquals (test, 0x100, map.spans[0].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_SIGNED, map.spans[0].type);
+
+	CuAssertIntEquals (test, 0x100, map.spans[1].start_addr);
+	CuAssertIntEquals (test, 0x100, map.spans[1].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_RW, map.spans[1].type);
+
+	host_fw_region_map_release (&map);
 }
 
-static void host_fw_full_flash_verification_test_last_region_rw (CuTest *test)
+static void host_fw_region_map_init_test_overlapping_regions (CuTest *test)
 {
 	struct flash_region img_region[2];
-	struct pfm_image_signature sig[2];
+	struct pfm_image_signature sig;
 	struct pfm_image_list img_list;
-	struct flash_region rw_region[2];
-	struct pfm_read_write rw_prop[2];
+	struct flash_region rw_region;
 	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock;
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct host_fw_region_map map;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
+	img_region[0].start_addr = 0x100;
+	img_region[0].length = 0x200;
+	img_region[1].start_addr = 0x180;
+	img_region[1].length = 0x10;
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
+	sig.regions = img_region;
+	sig.count = 2;
 
-	status = flash_master_mock_init (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
 
-	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x200;
+
+	rw_list.regions = &rw_region;
+	rw_list.count = 1;
+
+	status = host_fw_region_map_init (&map, &img_list, &rw_list, 1, 0x1000);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 3, map.count);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
+	CuAssertIntEquals (test, 0, map.spans[0].start_addr);
+	CuAssertIntEquals (test, 0x100, map.spans[0].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_UNUSED, map.spans[0].type);
 
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0xa00, 0, -1, strlen (data2)));
+	CuAssertIntEquals (test, 0x100, map.spans[1].start_addr);
+	CuAssertIntEquals (test, 0x300, map.spans[1].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_SIGNED, map.spans[1].type);
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data1),
-		0x200 - strlen (data1));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0xa00 - 0x300);
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xa00 + strlen (data2),
-		0xf00 - (0xa00 + strlen (data2)));
+	CuAssertIntEquals (test, 0x400, map.spans[2].start_addr);
+	CuAssertIntEquals (test, 0xc00, map.spans[2].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_UNUSED, map.spans[2].type);
 
-	CuAssertIntEquals (test, 0, status);
+	host_fw_region_map_release (&map);
+}
 
-	img_region[0].start_addr = 0;
-	img_region[0].length = strlen (data1);
-	img_region[1].start_addr = 0xa00;
-	img_region[1].length = strlen (data2);
+static void host_fw_region_map_init_test_multiple_fw (CuTest *test)
+{
+	struct flash_region img_region[2];
+	struct pfm_image_signature sig[2];
+	struct pfm_image_list img_list[2];
+	struct flash_region rw_region[2];
+	struct pfm_read_write_regions rw_list[2];
+	struct host_fw_region_map map;
+	int status;
+
+	TEST_START;
+
+	img_region[0].start_addr = 0x1000;
+	img_region[0].length = 0x100;
+	img_region[1].start_addr = 0;
+	img_region[1].length = 0x100;
 
 	sig[0].regions = &img_region[0];
 	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
-
 	sig[1].regions = &img_region[1];
 	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
 
-	img_list.images_sig = sig;
-	img_list.images_hash = NULL;
-	img_list.count = 2;
+	img_list[0].images_sig = &sig[0];
+	img_list[0].images_hash = NULL;
+	img_list[0].count = 1;
+	img_list[1].images_sig = &sig[1];
+	img_list[1].images_hash = NULL;
+	img_list[1].count = 1;
 
-	rw_region[0].start_addr = 0x200;
+	rw_region[0].start_addr = 0x1100;
 	rw_region[0].length = 0x100;
-	rw_region[1].start_addr = 0xf00;
-	rw_region[1].length = 0x100;
-
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_region[1].start_addr = 0x100;
+	rw_region[1].length = 0;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 2;
+	rw_list[0].regions = &rw_region[0];
+	rw_list[0].count = 1;
+	rw_list[1].regions = &rw_region[1];
+	rw_list[1].count = 1;
 
-	status = spi_flash_set_device_size (&flash, 0x1000);
+	status = host_fw_region_map_init (&map, img_list, rw_list, 2, 0x1200);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 4, map.count);
 
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, map.spans[0].start_addr);
+	CuAssertIntEquals (test, 0x100, map.spans[0].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_SIGNED, map.spans[0].type);
 
-	status = flash_master_mock_validate_and_release (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0x100, map.spans[1].start_addr);
+	CuAssertIntEquals (test, 0xf00, map.spans[1].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_UNUSED, map.spans[1].type);
 
-	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
+	CuAssertIntEquals (test, 0x1000, map.spans[2].start_addr);
+	CuAssertIntEquals (test, 0x100, map.spans[2].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_SIGNED, map.spans[2].type);
+
+	CuAssertIntEquals (test, 0x1100, map.spans[3].start_addr);
+	CuAssertIntEquals (test, 0x100, map.spans[3].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_RW, map.spans[3].type);
+
+	host_fw_region_map_release (&map);
 }
 
-static void host_fw_full_flash_verification_test_multipart_image (CuTest *test)
+static void host_fw_region_map_init_test_no_regions (CuTest *test)
 {
-	struct flash_region img_region[4];
-	struct pfm_image_signature sig[2];
-	struct pfm_image_list img_list;
-	struct flash_region rw_region[2];
-	struct pfm_read_write rw_prop[2];
-	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock;
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
+	struct host_fw_region_map map;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
 
 	TEST_START;
 
-	status = HASH_TESTING_ENGINE_INIT (&hash);
+	status = host_fw_region_map_init (&map, NULL, NULL, 0, 0x1000);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, map.count);
 
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, map.spans[0].start_addr);
+	CuAssertIntEquals (test, 0x1000, map.spans[0].length);
+	CuAssertIntEquals (test, HOST_FW_REGION_UNUSED, map.spans[0].type);
 
-	status = flash_master_mock_init (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
+	host_fw_region_map_release (&map);
 
-	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	status = host_fw_region_map_init (&map, NULL, NULL, 0, 0);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, map.count);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1 + 1, 3,
-		FLASH_EXP_READ_CMD (0x03, 0x300, 0, -1, 2));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1 + 3, 1,
-		FLASH_EXP_READ_CMD (0x03, 0xe00, 0, -1, 1));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0xa00, 0, -1, strlen (data2)));
-
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x001, 0x1ff);
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300 + 2, 0xa00 - 0x302);
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xa00 + strlen (data2),
-		0xc00 - (0xa00 + strlen (data2)));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xd00, 0x100);
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xe01, 0x1000 - 0xe01);
-
-	CuAssertIntEquals (test, 0, status);
-
-	img_region[0].start_addr = 0;
-	img_region[0].length = 1;
-	img_region[1].start_addr = 0x300;
-	img_region[1].length = 2;
-	img_region[2].start_addr = 0xe00;
-	img_region[2].length = 1;
-	img_region[3].start_addr = 0xa00;
-	img_region[3].length = strlen (data2);
-
-	sig[0].regions = &img_region[0];
-	sig[0].count = 3;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
-
-	sig[1].regions = &img_region[3];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
-
-	img_list.images_sig = sig;
-	img_list.images_hash = NULL;
-	img_list.count = 2;
-
-	rw_region[0].start_addr = 0x200;
-	rw_region[0].length = 0x100;
-	rw_region[1].start_addr = 0xc00;
-	rw_region[1].length = 0x100;
-
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	host_fw_region_map_release (&map);
+}
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 2;
+static void host_fw_region_map_init_test_null (CuTest *test)
+{
+	int status;
 
-	status = spi_flash_set_device_size (&flash, 0x1000);
-	CuAssertIntEquals (test, 0, status);
+	TEST_START;
 
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_region_map_init (NULL, NULL, NULL, 0, 0x1000);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+}
 
-	status = flash_master_mock_validate_and_release (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
+static void host_fw_region_map_release_test_null (CuTest *test)
+{
+	TEST_START;
 
-	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
+	host_fw_region_map_release (NULL);
 }
 
-static void host_fw_full_flash_verification_test_partial_validation (CuTest *test)
+static void host_fw_full_flash_verification_test (CuTest *test)
 {
-	struct flash_region img_region[2];
-	struct pfm_image_signature sig[2];
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
 	struct pfm_image_list img_list;
-	struct flash_region rw_region[2];
-	struct pfm_read_write rw_prop[2];
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -4937,8 +4699,7 @@ static void host_fw_full_flash_verification_test_partial_validation (CuTest *tes
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -4956,56 +4717,37 @@ static void host_fw_full_flash_verification_test_partial_validation (CuTest *tes
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
-
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x900, 0, -1, strlen (data2)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data1),
-		0x800 - strlen (data1));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x900 + strlen (data2),
-		0xc00 - (0x900 + strlen (data2)));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xd00, 0x1000 - 0xd00);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
+		0x200 - strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x1000 - 0x300);
 
 	CuAssertIntEquals (test, 0, status);
 
-	img_region[0].start_addr = 0;
-	img_region[0].length = strlen (data1);
-	img_region[1].start_addr = 0x900;
-	img_region[1].length = strlen (data2);
-
-	sig[0].regions = &img_region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	sig[1].regions = &img_region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 0;
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	img_list.images_sig = sig;
+	img_list.images_sig = &sig;
 	img_list.images_hash = NULL;
-	img_list.count = 2;
+	img_list.count = 1;
 
-	rw_region[0].start_addr = 0x800;
-	rw_region[0].length = 0x100;
-	rw_region[1].start_addr = 0xc00;
-	rw_region[1].length = 0x100;
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 2;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
 	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
@@ -5022,13 +4764,13 @@ static void host_fw_full_flash_verification_test_partial_validation (CuTest *tes
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_invalid_image (CuTest *test)
+static void host_fw_full_flash_verification_test_not_blank_byte (CuTest *test)
 {
-	struct flash_region img_region[2];
-	struct pfm_image_signature sig[2];
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
 	struct pfm_image_list img_list;
-	struct flash_region rw_region[2];
-	struct pfm_read_write rw_prop[2];
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -5036,8 +4778,7 @@ static void host_fw_full_flash_verification_test_invalid_image (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -5055,52 +4796,44 @@ static void host_fw_full_flash_verification_test_invalid_image (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_value_check (&flash_mock, 0 + strlen (data),
+		0x200 - strlen (data), 0x55);
+	status |= flash_master_mock_expect_value_check (&flash_mock, 0x300, 0x1000 - 0x300, 0x55);
 
-	img_region[0].start_addr = 0;
-	img_region[0].length = strlen (data1);
-	img_region[1].start_addr = 0x900;
-	img_region[1].length = strlen (data2);
+	CuAssertIntEquals (test, 0, status);
 
-	sig[0].regions = &img_region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	sig[1].regions = &img_region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	img_list.images_sig = sig;
+	img_list.images_sig = &sig;
 	img_list.images_hash = NULL;
-	img_list.count = 2;
+	img_list.count = 1;
 
-	rw_region[0].start_addr = 0x800;
-	rw_region[0].length = 0x100;
-	rw_region[1].start_addr = 0xc00;
-	rw_region[1].length = 0x100;
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 2;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
 	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0x55, &hash.base,
 		&rsa.base);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -5110,13 +4843,13 @@ static void host_fw_full_flash_verification_test_invalid_image (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_not_blank (CuTest *test)
+static void host_fw_full_flash_verification_test_multiple_rw_regions (CuTest *test)
 {
 	struct flash_region img_region;
 	struct pfm_image_signature sig;
 	struct pfm_image_list img_list;
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -5145,10 +4878,10 @@ static void host_fw_full_flash_verification_test_not_blank (CuTest *test)
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
 		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
 
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN,
-		FLASH_EXP_READ_CMD (0x03, 0 + strlen (data), 0, -1, FLASH_VERIFICATION_BLOCK));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
+		0x200 - strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x300);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x700, 0x1000 - 0x700);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -5166,21 +4899,24 @@ static void host_fw_full_flash_verification_test_not_blank (CuTest *test)
 	img_list.images_hash = NULL;
 	img_list.count = 1;
 
-	rw_region.start_addr = 0x200;
-	rw_region.length = 0x100;
+	rw_region[0].start_addr = 0x200;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0x600;
+	rw_region[1].length = 0x100;
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 2;
 
 	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
 	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
 		&rsa.base);
-	CuAssertIntEquals (test, FLASH_UTIL_UNEXPECTED_VALUE, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -5190,13 +4926,13 @@ static void host_fw_full_flash_verification_test_not_blank (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_last_not_blank (CuTest *test)
+static void host_fw_full_flash_verification_test_image_between_rw_regions (CuTest *test)
 {
 	struct flash_region img_region;
 	struct pfm_image_signature sig;
 	struct pfm_image_list img_list;
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -5223,18 +4959,16 @@ static void host_fw_full_flash_verification_test_last_not_blank (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
+		FLASH_EXP_READ_CMD (0x03, 0x900, 0, -1, strlen (data)));
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
-		0x200 - strlen (data));
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN,
-		FLASH_EXP_READ_CMD (0x03, 0x300, 0, -1, FLASH_VERIFICATION_BLOCK));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0, 0x800);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x900 + strlen (data),
+		0xb00 - (0x900 + strlen (data)));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xc00, 0x1000 - 0xc00);
 
 	CuAssertIntEquals (test, 0, status);
 
-	img_region.start_addr = 0;
+	img_region.start_addr = 0x900;
 	img_region.length = strlen (data);
 
 	sig.regions = &img_region;
@@ -5248,21 +4982,24 @@ static void host_fw_full_flash_verification_test_last_not_blank (CuTest *test)
 	img_list.images_hash = NULL;
 	img_list.count = 1;
 
-	rw_region.start_addr = 0x200;
-	rw_region.length = 0x100;
+	rw_region[0].start_addr = 0x800;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0xb00;
+	rw_region[1].length = 0x100;
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 2;
 
 	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
 	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
 		&rsa.base);
-	CuAssertIntEquals (test, FLASH_UTIL_UNEXPECTED_VALUE, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -5272,13 +5009,13 @@ static void host_fw_full_flash_verification_test_last_not_blank (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_hashes_sha256 (CuTest *test)
+static void host_fw_full_flash_verification_test_multiple_images (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_hash img_hash;
+	struct flash_region img_region[2];
+	struct pfm_image_signature sig[2];
 	struct pfm_image_list img_list;
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -5286,7 +5023,8 @@ static void host_fw_full_flash_verification_test_hashes_sha256 (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
 
 	TEST_START;
 
@@ -5304,37 +5042,56 @@ static void host_fw_full_flash_verification_test_hashes_sha256 (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
-		0x200 - strlen (data));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x1000 - 0x300);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x900, 0, -1, strlen (data2)));
+
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data1),
+		0x800 - strlen (data1));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x900 + strlen (data2),
+		0xc00 - (0x900 + strlen (data2)));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xd00, 0x1000 - 0xd00);
 
 	CuAssertIntEquals (test, 0, status);
 
-	img_region.start_addr = 0;
-	img_region.length = strlen (data);
+	img_region[0].start_addr = 0;
+	img_region[0].length = strlen (data1);
+	img_region[1].start_addr = 0x900;
+	img_region[1].length = strlen (data2);
 
-	img_hash.regions = &img_region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
-	img_hash.always_validate = 1;
+	sig[0].regions = &img_region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	img_list.images_hash = &img_hash;
-	img_list.images_sig = NULL;
-	img_list.count = 1;
+	sig[1].regions = &img_region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
 
-	rw_region.start_addr = 0x200;
-	rw_region.length = 0x100;
+	img_list.images_sig = sig;
+	img_list.images_hash = NULL;
+	img_list.count = 2;
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	rw_region[0].start_addr = 0x800;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0xc00;
+	rw_region[1].length = 0x100;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 2;
 
 	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
@@ -5351,13 +5108,13 @@ static void host_fw_full_flash_verification_test_hashes_sha256 (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_hashes_sha384 (CuTest *test)
+static void host_fw_full_flash_verification_test_offset_image (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_hash img_hash;
+	struct flash_region img_region[2];
+	struct pfm_image_signature sig[2];
 	struct pfm_image_list img_list;
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -5365,7 +5122,8 @@ static void host_fw_full_flash_verification_test_hashes_sha384 (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
 
 	TEST_START;
 
@@ -5383,37 +5141,57 @@ static void host_fw_full_flash_verification_test_hashes_sha384 (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
-		0x200 - strlen (data));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x1000 - 0x300);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0xb00, 0, -1, strlen (data2)));
+
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data1),
+		0x800 - strlen (data1));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x900, 0xb00 - 0x900);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xb00 + strlen (data2),
+		0xd00 - (0xb00 + strlen (data2)));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xe00, 0x1000 - 0xe00);
 
 	CuAssertIntEquals (test, 0, status);
 
-	img_region.start_addr = 0;
-	img_region.length = strlen (data);
+	img_region[0].start_addr = 0;
+	img_region[0].length = strlen (data1);
+	img_region[1].start_addr = 0xb00;
+	img_region[1].length = strlen (data2);
 
-	img_hash.regions = &img_region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA384_TEST_HASH, SHA384_HASH_LENGTH);
-	img_hash.hash_length = SHA384_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA384;
-	img_hash.always_validate = 1;
+	sig[0].regions = &img_region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	img_list.images_hash = &img_hash;
-	img_list.images_sig = NULL;
-	img_list.count = 1;
+	sig[1].regions = &img_region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
 
-	rw_region.start_addr = 0x200;
-	rw_region.length = 0x100;
+	img_list.images_sig = sig;
+	img_list.images_hash = NULL;
+	img_list.count = 2;
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	rw_region[0].start_addr = 0x800;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0xd00;
+	rw_region[1].length = 0x100;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 2;
 
 	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
@@ -5430,13 +5208,13 @@ static void host_fw_full_flash_verification_test_hashes_sha384 (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_hashes_sha512 (CuTest *test)
+static void host_fw_full_flash_verification_test_first_region_rw (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_hash img_hash;
+	struct flash_region img_region[2];
+	struct pfm_image_signature sig[2];
 	struct pfm_image_list img_list;
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
@@ -5444,7 +5222,8 @@ static void host_fw_full_flash_verification_test_hashes_sha512 (CuTest *test)
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data = "Test";
+	char *data1 = "Test";
+	char *data2 = "Test2";
 
 	TEST_START;
 
@@ -5462,37 +5241,57 @@ static void host_fw_full_flash_verification_test_hashes_sha512 (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x300, 0, -1, strlen (data1)));
 
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
-		0x200 - strlen (data));
-	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x1000 - 0x300);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0xa00, 0, -1, strlen (data2)));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x100, 0x200);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300 + strlen (data1),
+		0xa00 - (0x300 + strlen (data1)));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xa00 + strlen (data2),
+		0xc00 - (0xa00 + strlen (data2)));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xd00, 0x1000 - 0xd00);
 
-	img_region.start_addr = 0;
-	img_region.length = strlen (data);
+	CuAssertIntEquals (test, 0, status);
 
-	img_hash.regions = &img_region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA512_TEST_HASH, SHA512_HASH_LENGTH);
-	img_hash.hash_length = SHA512_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA512;
-	img_hash.always_validate = 1;
+	img_region[0].start_addr = 0x300;
+	img_region[0].length = strlen (data1);
+	img_region[1].start_addr = 0xa00;
+	img_region[1].length = strlen (data2);
 
-	img_list.images_hash = &img_hash;
-	img_list.images_sig = NULL;
-	img_list.count = 1;
+	sig[0].regions = &img_region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	rw_region.start_addr = 0x200;
-	rw_region.length = 0x100;
+	sig[1].regions = &img_region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	img_list.images_sig = sig;
+	img_list.images_hash = NULL;
+	img_list.count = 2;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_region[0].start_addr = 0;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0xc00;
+	rw_region[1].length = 0x100;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 2;
 
 	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
@@ -5509,10 +5308,109 @@ static void host_fw_full_flash_verification_test_hashes_sha512 (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_hashes_multipart_image (CuTest *test)
+static void host_fw_full_flash_verification_test_last_region_rw (CuTest *test)
+{
+	struct flash_region img_region[2];
+	struct pfm_image_signature sig[2];
+	struct pfm_image_list img_list;
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
+	int status;
+	char *data1 = "Test";
+	char *data2 = "Test2";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0xa00, 0, -1, strlen (data2)));
+
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data1),
+		0x200 - strlen (data1));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0xa00 - 0x300);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xa00 + strlen (data2),
+		0xf00 - (0xa00 + strlen (data2)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region[0].start_addr = 0;
+	img_region[0].length = strlen (data1);
+	img_region[1].start_addr = 0xa00;
+	img_region[1].length = strlen (data2);
+
+	sig[0].regions = &img_region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
+
+	sig[1].regions = &img_region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
+
+	img_list.images_sig = sig;
+	img_list.images_hash = NULL;
+	img_list.count = 2;
+
+	rw_region[0].start_addr = 0x200;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0xf00;
+	rw_region[1].length = 0x100;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 2;
+
+	status = spi_flash_set_device_size (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+		&rsa.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
+}
+
+static void host_fw_full_flash_verification_test_multipart_image (CuTest *test)
 {
 	struct flash_region img_region[4];
-	struct pfm_image_hash img_hash[2];
+	struct pfm_image_signature sig[2];
 	struct pfm_image_list img_list;
 	struct flash_region rw_region[2];
 	struct pfm_read_write rw_prop[2];
@@ -5578,22 +5476,22 @@ static void host_fw_full_flash_verification_test_hashes_multipart_image (CuTest
 	img_region[3].start_addr = 0xa00;
 	img_region[3].length = strlen (data2);
 
-	img_hash[0].regions = &img_region[0];
-	img_hash[0].count = 3;
-	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash[0].hash_length = SHA256_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA256;
-	img_hash[0].always_validate = 1;
+	sig[0].regions = &img_region[0];
+	sig[0].count = 3;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	img_hash[1].regions = &img_region[3];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 1;
+	sig[1].regions = &img_region[3];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
 
-	img_list.images_hash = img_hash;
-	img_list.images_sig = NULL;
+	img_list.images_sig = sig;
+	img_list.images_hash = NULL;
 	img_list.count = 2;
 
 	rw_region[0].start_addr = 0x200;
@@ -5623,10 +5521,10 @@ static void host_fw_full_flash_verification_test_hashes_multipart_image (CuTest
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_hashes_partial_validation (CuTest *test)
+static void host_fw_full_flash_verification_test_partial_validation (CuTest *test)
 {
 	struct flash_region img_region[2];
-	struct pfm_image_hash img_hash[2];
+	struct pfm_image_signature sig[2];
 	struct pfm_image_list img_list;
 	struct flash_region rw_region[2];
 	struct pfm_read_write rw_prop[2];
@@ -5677,22 +5575,22 @@ static void host_fw_full_flash_verification_test_hashes_partial_validation (CuTe
 	img_region[1].start_addr = 0x900;
 	img_region[1].length = strlen (data2);
 
-	img_hash[0].regions = &img_region[0];
-	img_hash[0].count = 1;
-	memcpy (img_hash[0].hash, SHA512_TEST_HASH, SHA512_HASH_LENGTH);
-	img_hash[0].hash_length = SHA512_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA512;
-	img_hash[0].always_validate = 1;
+	sig[0].regions = &img_region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	img_hash[1].regions = &img_region[1];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 0;
+	sig[1].regions = &img_region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 0;
 
-	img_list.images_hash = img_hash;
-	img_list.images_sig = NULL;
+	img_list.images_sig = sig;
+	img_list.images_hash = NULL;
 	img_list.count = 2;
 
 	rw_region[0].start_addr = 0x800;
@@ -5722,10 +5620,10 @@ static void host_fw_full_flash_verification_test_hashes_partial_validation (CuTe
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_hashes_invalid_image (CuTest *test)
+static void host_fw_full_flash_verification_test_invalid_image (CuTest *test)
 {
 	struct flash_region img_region[2];
-	struct pfm_image_hash img_hash[2];
+	struct pfm_image_signature sig[2];
 	struct pfm_image_list img_list;
 	struct flash_region rw_region[2];
 	struct pfm_read_write rw_prop[2];
@@ -5765,22 +5663,22 @@ static void host_fw_full_flash_verification_test_hashes_invalid_image (CuTest *t
 	img_region[1].start_addr = 0x900;
 	img_region[1].length = strlen (data2);
 
-	img_hash[0].regions = &img_region[0];
-	img_hash[0].count = 1;
-	memcpy (img_hash[0].hash, SHA256_BAD_HASH, SHA256_HASH_LENGTH);
-	img_hash[0].hash_length = SHA256_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA256;
-	img_hash[0].always_validate = 1;
+	sig[0].regions = &img_region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	img_hash[1].regions = &img_region[1];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_TEST_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 1;
+	sig[1].regions = &img_region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
 
-	img_list.images_hash = img_hash;
-	img_list.images_sig = NULL;
+	img_list.images_sig = sig;
+	img_list.images_hash = NULL;
 	img_list.count = 2;
 
 	rw_region[0].start_addr = 0x800;
@@ -5800,7 +5698,7 @@ static void host_fw_full_flash_verification_test_hashes_invalid_image (CuTest *t
 
 	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
 		&rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -5810,7 +5708,7 @@ static void host_fw_full_flash_verification_test_hashes_invalid_image (CuTest *t
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_full_flash_verification_test_null (CuTest *test)
+static void host_fw_full_flash_verification_test_not_blank (CuTest *test)
 {
 	struct flash_region img_region;
 	struct pfm_image_signature sig;
@@ -5840,6 +5738,18 @@ static void host_fw_full_flash_verification_test_null (CuTest *test)
 	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN,
+		FLASH_EXP_READ_CMD (0x03, 0 + strlen (data), 0, -1, FLASH_VERIFICATION_BLOCK));
+
+	CuAssertIntEquals (test, 0, status);
+
 	img_region.start_addr = 0;
 	img_region.length = strlen (data);
 
@@ -5866,25 +5776,9 @@ static void host_fw_full_flash_verification_test_null (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_full_flash_verification (NULL, &img_list, &rw_list, 0xff, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
-	status = host_fw_full_flash_verification (&flash, NULL, &rw_list, 0xff, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
-	status = host_fw_full_flash_verification (&flash, &img_list, NULL, 0xff, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
-	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, NULL,
-		&rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
-
 	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
-		NULL);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+		&rsa.base);
+	CuAssertIntEquals (test, FLASH_UTIL_UNEXPECTED_VALUE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -5894,47 +5788,66 @@ static void host_fw_full_flash_verification_test_null (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_migrate_read_write_data_test (CuTest *test)
+static void host_fw_full_flash_verification_test_last_not_blank (CuTest *test)
 {
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
-	int status;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
+	int status;
+	char *data = "Test";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_init (&flash_mock2);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
+
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
+		0x200 - strlen (data));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, RSA_SIGNATURE_BAD, RSA_ENCRYPT_LEN,
+		FLASH_EXP_READ_CMD (0x03, 0x300, 0, -1, FLASH_VERIFICATION_BLOCK));
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
-		0x10000, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	CuAssertIntEquals (test, 0, status);
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = RSA_ENCRYPT_LEN;
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
 
 	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
@@ -5942,571 +5855,651 @@ static void host_fw_migrate_read_write_data_test (CuTest *test)
 	rw_list.properties = &rw_prop;
 	rw_list.count = 1;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, &rw_list);
+	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+		&rsa.base);
+	CuAssertIntEquals (test, FLASH_UTIL_UNEXPECTED_VALUE, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_migrate_read_write_data_test_multiple_regions (CuTest *test)
+static void host_fw_full_flash_verification_test_hashes_sha256 (CuTest *test)
 {
-	struct flash_region rw_region[3];
-	struct pfm_read_write rw_prop[3];
+	struct flash_region img_region;
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data = "Test";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_init (&flash_mock2);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
+
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
+		0x200 - strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x1000 - 0x300);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 16);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
-		0x10000, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x30000,
-		0x30000, RSA_ENCRYPT_TEST2, 16);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x50000,
-		0x50000, RSA_ENCRYPT_NOPE, 32);
+	img_hash.regions = &img_region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
 
-	CuAssertIntEquals (test, 0, status);
+	img_list.images_hash = &img_hash;
+	img_list.images_sig = NULL;
+	img_list.count = 1;
 
-	rw_region[0].start_addr = 0x10000;
-	rw_region[0].length = RSA_ENCRYPT_LEN;
-	rw_region[1].start_addr = 0x30000;
-	rw_region[1].length = 16;
-	rw_region[2].start_addr = 0x50000;
-	rw_region[2].length = 32;
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 3;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, &rw_list);
+	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_migrate_read_write_data_test_different_addresses (CuTest *test)
+static void host_fw_full_flash_verification_test_hashes_sha384 (CuTest *test)
 {
-	struct flash_region rw_region1;
-	struct pfm_read_write rw_prop1;
-	struct pfm_read_write_regions rw_list1;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_region rw_region2;
-	struct pfm_read_write rw_prop2;
-	struct pfm_read_write_regions rw_list2;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region img_region;
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data = "Test";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock2);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
+		0x200 - strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x1000 - 0x300);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region1.start_addr = 0x10000;
-	rw_region1.length = RSA_ENCRYPT_LEN;
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
+	img_hash.regions = &img_region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA384_TEST_HASH, SHA384_HASH_LENGTH);
+	img_hash.hash_length = SHA384_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA384;
+	img_hash.always_validate = 1;
 
-	rw_list1.regions = &rw_region1;
-	rw_list1.properties = &rw_prop1;
-	rw_list1.count = 1;
+	img_list.images_hash = &img_hash;
+	img_list.images_sig = NULL;
+	img_list.count = 1;
 
-	rw_region2.start_addr = 0x50000;
-	rw_region2.length = RSA_ENCRYPT_LEN;
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
 
-	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list2.regions = &rw_region2;
-	rw_list2.properties = &rw_prop2;
-	rw_list2.count = 1;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_ADDR, status);
+	status = spi_flash_set_device_size (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_migrate_read_write_data_test_multiple_diff_addresses (CuTest *test)
+static void host_fw_full_flash_verification_test_hashes_sha512 (CuTest *test)
 {
-	struct flash_region rw_region1[3];
-	struct pfm_read_write rw_prop1[3];
-	struct pfm_read_write_regions rw_list1;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
-	struct pfm_read_write_regions rw_list2;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region img_region;
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data = "Test";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock2);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data)));
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x40000, 16);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data),
+		0x200 - strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0x1000 - 0x300);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = RSA_ENCRYPT_LEN;
-	rw_region1[1].start_addr = 0x30000;
-	rw_region1[1].length = 16;
-	rw_region1[2].start_addr = 0x50000;
-	rw_region1[2].length = 32;
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+	img_hash.regions = &img_region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA512_TEST_HASH, SHA512_HASH_LENGTH);
+	img_hash.hash_length = SHA512_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA512;
+	img_hash.always_validate = 1;
 
-	rw_list1.regions = rw_region1;
-	rw_list1.properties = rw_prop1;
-	rw_list1.count = 3;
+	img_list.images_hash = &img_hash;
+	img_list.images_sig = NULL;
+	img_list.count = 1;
 
-	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = RSA_ENCRYPT_LEN;
-	rw_region2[1].start_addr = 0x40000;
-	rw_region2[1].length = 16;
-	rw_region2[2].start_addr = 0x50000;
-	rw_region2[2].length = 32;
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
 
-	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list2.regions = rw_region2;
-	rw_list2.properties = rw_prop2;
-	rw_list2.count = 3;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_ADDR, status);
+	status = spi_flash_set_device_size (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_migrate_read_write_data_test_dest_larger (CuTest *test)
+static void host_fw_full_flash_verification_test_hashes_multipart_image (CuTest *test)
 {
-	struct flash_region rw_region1;
-	struct pfm_read_write rw_prop1;
-	struct pfm_read_write_regions rw_list1;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_region rw_region2;
-	struct pfm_read_write rw_prop2;
-	struct pfm_read_write_regions rw_list2;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region img_region[4];
+	struct pfm_image_hash img_hash[2];
+	struct pfm_image_list img_list;
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data1 = "Test";
+	char *data2 = "Test2";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_init (&flash_mock2);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, 1));
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1 + 1, 3,
+		FLASH_EXP_READ_CMD (0x03, 0x300, 0, -1, 2));
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000,
-		RSA_ENCRYPT_LEN * 2);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1 + 3, 1,
+		FLASH_EXP_READ_CMD (0x03, 0xe00, 0, -1, 1));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0xa00, 0, -1, strlen (data2)));
+
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x001, 0x1ff);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300 + 2, 0xa00 - 0x302);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xa00 + strlen (data2),
+		0xc00 - (0xa00 + strlen (data2)));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xd00, 0x100);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xe01, 0x1000 - 0xe01);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region1.start_addr = 0x10000;
-	rw_region1.length = RSA_ENCRYPT_LEN;
+	img_region[0].start_addr = 0;
+	img_region[0].length = 1;
+	img_region[1].start_addr = 0x300;
+	img_region[1].length = 2;
+	img_region[2].start_addr = 0xe00;
+	img_region[2].length = 1;
+	img_region[3].start_addr = 0xa00;
+	img_region[3].length = strlen (data2);
 
-	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
+	img_hash[0].regions = &img_region[0];
+	img_hash[0].count = 3;
+	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash[0].hash_length = SHA256_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA256;
+	img_hash[0].always_validate = 1;
 
-	rw_list1.regions = &rw_region1;
-	rw_list1.properties = &rw_prop1;
-	rw_list1.count = 1;
+	img_hash[1].regions = &img_region[3];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 1;
 
-	rw_region2.start_addr = 0x10000;
-	rw_region2.length = RSA_ENCRYPT_LEN * 2;
+	img_list.images_hash = img_hash;
+	img_list.images_sig = NULL;
+	img_list.count = 2;
 
-	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
+	rw_region[0].start_addr = 0x200;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0xc00;
+	rw_region[1].length = 0x100;
 
-	rw_list2.regions = &rw_region2;
-	rw_list2.properties = &rw_prop2;
-	rw_list2.count = 1;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_SIZE, status);
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 2;
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_migrate_read_write_data_test_dest_smaller (CuTest *test)
+static void host_fw_full_flash_verification_test_hashes_partial_validation (CuTest *test)
 {
-	struct flash_region rw_region1;
-	struct pfm_read_write rw_prop1;
-	struct pfm_read_write_regions rw_list1;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_region rw_region2;
-	struct pfm_read_write rw_prop2;
-	struct pfm_read_write_regions rw_list2;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region img_region[2];
+	struct pfm_image_hash img_hash[2];
+	struct pfm_image_list img_list;
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data1 = "Test";
+	char *data2 = "Test2";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock2);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000,
-		RSA_ENCRYPT_LEN - 1);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x900, 0, -1, strlen (data2)));
+
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0 + strlen (data1),
+		0x800 - strlen (data1));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x900 + strlen (data2),
+		0xc00 - (0x900 + strlen (data2)));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0xd00, 0x1000 - 0xd00);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region1.start_addr = 0x10000;
-	rw_region1.length = RSA_ENCRYPT_LEN;
+	img_region[0].start_addr = 0;
+	img_region[0].length = strlen (data1);
+	img_region[1].start_addr = 0x900;
+	img_region[1].length = strlen (data2);
 
-	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
+	img_hash[0].regions = &img_region[0];
+	img_hash[0].count = 1;
+	memcpy (img_hash[0].hash, SHA512_TEST_HASH, SHA512_HASH_LENGTH);
+	img_hash[0].hash_length = SHA512_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA512;
+	img_hash[0].always_validate = 1;
 
-	rw_list1.regions = &rw_region1;
-	rw_list1.properties = &rw_prop1;
-	rw_list1.count = 1;
+	img_hash[1].regions = &img_region[1];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 0;
 
-	rw_region2.start_addr = 0x10000;
-	rw_region2.length = RSA_ENCRYPT_LEN - 1;
+	img_list.images_hash = img_hash;
+	img_list.images_sig = NULL;
+	img_list.count = 2;
 
-	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
+	rw_region[0].start_addr = 0x800;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0xc00;
+	rw_region[1].length = 0x100;
 
-	rw_list2.regions = &rw_region2;
-	rw_list2.properties = &rw_prop2;
-	rw_list2.count = 1;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_SIZE, status);
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 2;
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_migrate_read_write_data_test_multiple_one_smaller (CuTest *test)
+static void host_fw_full_flash_verification_test_hashes_invalid_image (CuTest *test)
 {
-	struct flash_region rw_region1[3];
-	struct pfm_read_write rw_prop1[3];
-	struct pfm_read_write_regions rw_list1;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
-	struct pfm_read_write_regions rw_list2;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region img_region[2];
+	struct pfm_image_hash img_hash[2];
+	struct pfm_image_list img_list;
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data1 = "Test";
+	char *data2 = "Test2";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock2);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 8);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (data1)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = RSA_ENCRYPT_LEN;
-	rw_region1[1].start_addr = 0x30000;
-	rw_region1[1].length = 16;
-	rw_region1[2].start_addr = 0x50000;
-	rw_region1[2].length = 32;
+	img_region[0].start_addr = 0;
+	img_region[0].length = strlen (data1);
+	img_region[1].start_addr = 0x900;
+	img_region[1].length = strlen (data2);
 
-	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+	img_hash[0].regions = &img_region[0];
+	img_hash[0].count = 1;
+	memcpy (img_hash[0].hash, SHA256_BAD_HASH, SHA256_HASH_LENGTH);
+	img_hash[0].hash_length = SHA256_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA256;
+	img_hash[0].always_validate = 1;
 
-	rw_list1.regions = rw_region1;
-	rw_list1.properties = rw_prop1;
-	rw_list1.count = 3;
+	img_hash[1].regions = &img_region[1];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_TEST_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 1;
 
-	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = RSA_ENCRYPT_LEN;
-	rw_region2[1].start_addr = 0x30000;
-	rw_region2[1].length = 8;
-	rw_region2[2].start_addr = 0x50000;
-	rw_region2[2].length = 32;
+	img_list.images_hash = img_hash;
+	img_list.images_sig = NULL;
+	img_list.count = 2;
 
-	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_region[0].start_addr = 0x800;
+	rw_region[0].length = 0x100;
+	rw_region[1].start_addr = 0xc00;
+	rw_region[1].length = 0x100;
 
-	rw_list2.regions = rw_region2;
-	rw_list2.properties = rw_prop2;
-	rw_list2.count = 3;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_SIZE, status);
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 2;
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	status = spi_flash_set_device_size (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+		&rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_migrate_read_write_data_test_dest_more_regions (CuTest *test)
+static void host_fw_full_flash_verification_test_null (CuTest *test)
 {
-	struct flash_region rw_region1[2];
-	struct pfm_read_write rw_prop1[2];
-	struct pfm_read_write_regions rw_list1;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
-	struct pfm_read_write_regions rw_list2;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data = "Test";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_init (&flash_mock2);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 16);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x60000, 32);
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
 
-	CuAssertIntEquals (test, 0, status);
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
 
-	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = RSA_ENCRYPT_LEN;
-	rw_region1[1].start_addr = 0x30000;
-	rw_region1[1].length = 16;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	rw_list1.regions = rw_region1;
-	rw_list1.properties = rw_prop1;
-	rw_list1.count = 2;
+	status = spi_flash_set_device_size (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = RSA_ENCRYPT_LEN;
-	rw_region2[1].start_addr = 0x30000;
-	rw_region2[1].length = 16;
-	rw_region2[2].start_addr = 0x60000;
-	rw_region2[2].length = 32;
+	status = host_fw_full_flash_verification (NULL, &img_list, &rw_list, 0xff, &hash.base,
+		&rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+	status = host_fw_full_flash_verification (&flash, NULL, &rw_list, 0xff, &hash.base,
+		&rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	rw_list2.regions = rw_region2;
-	rw_list2.properties = rw_prop2;
-	rw_list2.count = 3;
+	status = host_fw_full_flash_verification (&flash, &img_list, NULL, 0xff, &hash.base,
+		&rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_COUNT, status);
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, NULL,
+		&rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_full_flash_verification (&flash, &img_list, &rw_list, 0xff, &hash.base,
+		NULL);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_migrate_read_write_data_test_src_more_regions (CuTest *test)
+static void host_fw_migrate_read_write_data_test (CuTest *test)
 {
-	struct flash_region rw_region1[3];
-	struct pfm_read_write rw_prop1[3];
-	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
 	struct spi_flash flash1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
-	struct pfm_read_write_regions rw_list2;
 	struct flash_master_mock flash_mock2;
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
@@ -6533,39 +6526,22 @@ static void host_fw_migrate_read_write_data_test_src_more_regions (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 16);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
+		0x10000, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = RSA_ENCRYPT_LEN;
-	rw_region1[1].start_addr = 0x30000;
-	rw_region1[1].length = 16;
-	rw_region1[2].start_addr = 0x50000;
-	rw_region1[2].length = 32;
-
-	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list1.regions = rw_region1;
-	rw_list1.properties = rw_prop1;
-	rw_list1.count = 3;
-
-	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = RSA_ENCRYPT_LEN;
-	rw_region2[1].start_addr = 0x30000;
-	rw_region2[1].length = 16;
+	rw_region.start_addr = 0x10000;
+	rw_region.length = RSA_ENCRYPT_LEN;
 
-	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list2.regions = rw_region2;
-	rw_list2.properties = rw_prop2;
-	rw_list2.count = 2;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_COUNT, status);
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -6577,17 +6553,14 @@ static void host_fw_migrate_read_write_data_test_src_more_regions (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_migrate_read_write_data_test_diff_address_and_size (CuTest *test)
+static void host_fw_migrate_read_write_data_test_multiple_regions (CuTest *test)
 {
-	struct flash_region rw_region1[3];
-	struct pfm_read_write rw_prop1[3];
-	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
 	struct spi_flash flash1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
-	struct pfm_read_write_regions rw_list2;
 	struct flash_master_mock flash_mock2;
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
@@ -6614,43 +6587,35 @@ static void host_fw_migrate_read_write_data_test_diff_address_and_size (CuTest *
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x40000, 16);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 16);
-
-	CuAssertIntEquals (test, 0, status);
-
-	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = RSA_ENCRYPT_LEN;
-	rw_region1[1].start_addr = 0x30000;
-	rw_region1[1].length = 16;
-	rw_region1[2].start_addr = 0x50000;
-	rw_region1[2].length = 32;
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 16);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
 
-	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
+		0x10000, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x30000,
+		0x30000, RSA_ENCRYPT_TEST2, 16);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x50000,
+		0x50000, RSA_ENCRYPT_NOPE, 32);
 
-	rw_list1.regions = rw_region1;
-	rw_list1.properties = rw_prop1;
-	rw_list1.count = 3;
+	CuAssertIntEquals (test, 0, status);
 
-	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = RSA_ENCRYPT_LEN;
-	rw_region2[1].start_addr = 0x40000;
-	rw_region2[1].length = 16;
-	rw_region2[2].start_addr = 0x50000;
-	rw_region2[2].length = 16;
+	rw_region[0].start_addr = 0x10000;
+	rw_region[0].length = RSA_ENCRYPT_LEN;
+	rw_region[1].start_addr = 0x30000;
+	rw_region[1].length = 16;
+	rw_region[2].start_addr = 0x50000;
+	rw_region[2].length = 32;
 
-	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list2.regions = rw_region2;
-	rw_list2.properties = rw_prop2;
-	rw_list2.count = 3;
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 3;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_ADDR, status);
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -6662,16 +6627,16 @@ static void host_fw_migrate_read_write_data_test_diff_address_and_size (CuTest *
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_migrate_read_write_data_test_diff_size_and_address (CuTest *test)
+static void host_fw_migrate_read_write_data_test_different_addresses (CuTest *test)
 {
-	struct flash_region rw_region1[3];
-	struct pfm_read_write rw_prop1[3];
+	struct flash_region rw_region1;
+	struct pfm_read_write rw_prop1;
 	struct pfm_read_write_regions rw_list1;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
 	struct spi_flash flash1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
+	struct flash_region rw_region2;
+	struct pfm_read_write rw_prop2;
 	struct pfm_read_write_regions rw_list2;
 	struct flash_master_mock flash_mock2;
 	struct spi_flash_state state2;
@@ -6698,44 +6663,30 @@ static void host_fw_migrate_read_write_data_test_diff_size_and_address (CuTest *
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 8);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x60000, 32);
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, RSA_ENCRYPT_LEN);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = RSA_ENCRYPT_LEN;
-	rw_region1[1].start_addr = 0x30000;
-	rw_region1[1].length = 16;
-	rw_region1[2].start_addr = 0x50000;
-	rw_region1[2].length = 32;
+	rw_region1.start_addr = 0x10000;
+	rw_region1.length = RSA_ENCRYPT_LEN;
 
-	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list1.regions = rw_region1;
-	rw_list1.properties = rw_prop1;
-	rw_list1.count = 3;
+	rw_list1.regions = &rw_region1;
+	rw_list1.properties = &rw_prop1;
+	rw_list1.count = 1;
 
-	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = RSA_ENCRYPT_LEN;
-	rw_region2[1].start_addr = 0x30000;
-	rw_region2[1].length = 8;
-	rw_region2[2].start_addr = 0x60000;
-	rw_region2[2].length = 32;
+	rw_region2.start_addr = 0x50000;
+	rw_region2.length = RSA_ENCRYPT_LEN;
 
-	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list2.regions = rw_region2;
-	rw_list2.properties = rw_prop2;
-	rw_list2.count = 3;
+	rw_list2.regions = &rw_region2;
+	rw_list2.properties = &rw_prop2;
+	rw_list2.count = 1;
 
 	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_SIZE, status);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_ADDR, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -6747,7 +6698,7 @@ static void host_fw_migrate_read_write_data_test_diff_size_and_address (CuTest *
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_migrate_read_write_data_test_all_different (CuTest *test)
+static void host_fw_migrate_read_write_data_test_multiple_diff_addresses (CuTest *test)
 {
 	struct flash_region rw_region1[3];
 	struct pfm_read_write rw_prop1[3];
@@ -6783,8 +6734,9 @@ static void host_fw_migrate_read_write_data_test_all_different (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x20000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 8);
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x40000, 16);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -6803,20 +6755,23 @@ static void host_fw_migrate_read_write_data_test_all_different (CuTest *test)
 	rw_list1.properties = rw_prop1;
 	rw_list1.count = 3;
 
-	rw_region2[0].start_addr = 0x20000;
+	rw_region2[0].start_addr = 0x10000;
 	rw_region2[0].length = RSA_ENCRYPT_LEN;
-	rw_region2[1].start_addr = 0x30000;
-	rw_region2[1].length = 8;
+	rw_region2[1].start_addr = 0x40000;
+	rw_region2[1].length = 16;
+	rw_region2[2].start_addr = 0x50000;
+	rw_region2[2].length = 32;
 
 	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
 	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
 
 	rw_list2.regions = rw_region2;
 	rw_list2.properties = rw_prop2;
-	rw_list2.count = 2;
+	rw_list2.count = 3;
 
 	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_COUNT, status);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_ADDR, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -6828,16 +6783,16 @@ static void host_fw_migrate_read_write_data_test_all_different (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_migrate_read_write_data_test_multiple_diff_ordering (CuTest *test)
+static void host_fw_migrate_read_write_data_test_dest_larger (CuTest *test)
 {
-	struct flash_region rw_region1[3];
-	struct pfm_read_write rw_prop1[3];
+	struct flash_region rw_region1;
+	struct pfm_read_write rw_prop1;
 	struct pfm_read_write_regions rw_list1;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
 	struct spi_flash flash1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
+	struct flash_region rw_region2;
+	struct pfm_read_write rw_prop2;
 	struct pfm_read_write_regions rw_list2;
 	struct flash_master_mock flash_mock2;
 	struct spi_flash_state state2;
@@ -6864,51 +6819,31 @@ static void host_fw_migrate_read_write_data_test_multiple_diff_ordering (CuTest
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 16);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
-
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
-		0x10000, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x30000,
-		0x30000, RSA_ENCRYPT_TEST2, 16);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x50000,
-		0x50000, RSA_ENCRYPT_NOPE, 32);
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000,
+		RSA_ENCRYPT_LEN * 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = RSA_ENCRYPT_LEN;
-	rw_region1[1].start_addr = 0x30000;
-	rw_region1[1].length = 16;
-	rw_region1[2].start_addr = 0x50000;
-	rw_region1[2].length = 32;
+	rw_region1.start_addr = 0x10000;
+	rw_region1.length = RSA_ENCRYPT_LEN;
 
-	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list1.regions = rw_region1;
-	rw_list1.properties = rw_prop1;
-	rw_list1.count = 3;
+	rw_list1.regions = &rw_region1;
+	rw_list1.properties = &rw_prop1;
+	rw_list1.count = 1;
 
-	rw_region2[0].start_addr = 0x50000;
-	rw_region2[0].length = 32;
-	rw_region2[1].start_addr = 0x10000;
-	rw_region2[1].length = RSA_ENCRYPT_LEN;
-	rw_region2[2].start_addr = 0x30000;
-	rw_region2[2].length = 16;
+	rw_region2.start_addr = 0x10000;
+	rw_region2.length = RSA_ENCRYPT_LEN * 2;
 
-	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list2.regions = rw_region2;
-	rw_list2.properties = rw_prop2;
-	rw_list2.count = 3;
+	rw_list2.regions = &rw_region2;
+	rw_list2.properties = &rw_prop2;
+	rw_list2.count = 1;
 
 	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_SIZE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -6920,14 +6855,17 @@ static void host_fw_migrate_read_write_data_test_multiple_diff_ordering (CuTest
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_migrate_read_write_data_test_no_source_regions (CuTest *test)
+static void host_fw_migrate_read_write_data_test_dest_smaller (CuTest *test)
 {
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
-	struct pfm_read_write_regions rw_list;
+	struct flash_region rw_region1;
+	struct pfm_read_write rw_prop1;
+	struct pfm_read_write_regions rw_list1;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
 	struct spi_flash flash1;
+	struct flash_region rw_region2;
+	struct pfm_read_write rw_prop2;
+	struct pfm_read_write_regions rw_list2;
 	struct flash_master_mock flash_mock2;
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
@@ -6953,23 +6891,31 @@ static void host_fw_migrate_read_write_data_test_no_source_regions (CuTest *test
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
-		0x10000, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000,
+		RSA_ENCRYPT_LEN - 1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = RSA_ENCRYPT_LEN;
+	rw_region1.start_addr = 0x10000;
+	rw_region1.length = RSA_ENCRYPT_LEN;
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_list1.regions = &rw_region1;
+	rw_list1.properties = &rw_prop1;
+	rw_list1.count = 1;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, NULL);
-	CuAssertIntEquals (test, 0, status);
+	rw_region2.start_addr = 0x10000;
+	rw_region2.length = RSA_ENCRYPT_LEN - 1;
+
+	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = &rw_region2;
+	rw_list2.properties = &rw_prop2;
+	rw_list2.count = 1;
+
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_SIZE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -6981,14 +6927,17 @@ static void host_fw_migrate_read_write_data_test_no_source_regions (CuTest *test
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_migrate_read_write_data_test_null (CuTest *test)
+static void host_fw_migrate_read_write_data_test_multiple_one_smaller (CuTest *test)
 {
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
-	struct pfm_read_write_regions rw_list;
+	struct flash_region rw_region1[3];
+	struct pfm_read_write rw_prop1[3];
+	struct pfm_read_write_regions rw_list1;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
 	struct spi_flash flash1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
+	struct pfm_read_write_regions rw_list2;
 	struct flash_master_mock flash_mock2;
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
@@ -7014,23 +6963,44 @@ static void host_fw_migrate_read_write_data_test_null (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = RSA_ENCRYPT_LEN;
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 8);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	CuAssertIntEquals (test, 0, status);
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_region1[0].start_addr = 0x10000;
+	rw_region1[0].length = RSA_ENCRYPT_LEN;
+	rw_region1[1].start_addr = 0x30000;
+	rw_region1[1].length = 16;
+	rw_region1[2].start_addr = 0x50000;
+	rw_region1[2].length = 32;
 
-	status = host_fw_migrate_read_write_data (NULL, &rw_list, &flash1, &rw_list);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
 
-	status = host_fw_migrate_read_write_data (&flash2, NULL, &flash1, &rw_list);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 3;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list, NULL, &rw_list);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	rw_region2[0].start_addr = 0x10000;
+	rw_region2[0].length = RSA_ENCRYPT_LEN;
+	rw_region2[1].start_addr = 0x30000;
+	rw_region2[1].length = 8;
+	rw_region2[2].start_addr = 0x50000;
+	rw_region2[2].length = 32;
+
+	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 3;
+
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_SIZE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -7042,14 +7012,17 @@ static void host_fw_migrate_read_write_data_test_null (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_migrate_read_write_data_test_erase_error (CuTest *test)
+static void host_fw_migrate_read_write_data_test_dest_more_regions (CuTest *test)
 {
-	struct flash_region rw_region[3];
-	struct pfm_read_write rw_prop[3];
-	struct pfm_read_write_regions rw_list;
+	struct flash_region rw_region1[2];
+	struct pfm_read_write rw_prop1[2];
+	struct pfm_read_write_regions rw_list1;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
 	struct spi_flash flash1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
+	struct pfm_read_write_regions rw_list2;
 	struct flash_master_mock flash_mock2;
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
@@ -7075,28 +7048,41 @@ static void host_fw_migrate_read_write_data_test_erase_error (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_STATUS_REG);
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 16);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x60000, 32);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region[0].start_addr = 0x10000;
-	rw_region[0].length = RSA_ENCRYPT_LEN;
-	rw_region[1].start_addr = 0x30000;
-	rw_region[1].length = 16;
-	rw_region[2].start_addr = 0x50000;
-	rw_region[2].length = 32;
+	rw_region1[0].start_addr = 0x10000;
+	rw_region1[0].length = RSA_ENCRYPT_LEN;
+	rw_region1[1].start_addr = 0x30000;
+	rw_region1[1].length = 16;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 3;
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 2;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, &rw_list);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	rw_region2[0].start_addr = 0x10000;
+	rw_region2[0].length = RSA_ENCRYPT_LEN;
+	rw_region2[1].start_addr = 0x30000;
+	rw_region2[1].length = 16;
+	rw_region2[2].start_addr = 0x60000;
+	rw_region2[2].length = 32;
+
+	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 3;
+
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_COUNT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -7108,14 +7094,17 @@ static void host_fw_migrate_read_write_data_test_erase_error (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_migrate_read_write_data_test_copy_error (CuTest *test)
+static void host_fw_migrate_read_write_data_test_src_more_regions (CuTest *test)
 {
-	struct flash_region rw_region[3];
-	struct pfm_read_write rw_prop[3];
-	struct pfm_read_write_regions rw_list;
+	struct flash_region rw_region1[3];
+	struct pfm_read_write rw_prop1[3];
+	struct pfm_read_write_regions rw_list1;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
 	struct spi_flash flash1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
+	struct pfm_read_write_regions rw_list2;
 	struct flash_master_mock flash_mock2;
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
@@ -7143,30 +7132,38 @@ static void host_fw_migrate_read_write_data_test_copy_error (CuTest *test)
 
 	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
 	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 16);
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
-
-	status |= flash_master_mock_expect_xfer (&flash_mock1, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region[0].start_addr = 0x10000;
-	rw_region[0].length = RSA_ENCRYPT_LEN;
-	rw_region[1].start_addr = 0x30000;
-	rw_region[1].length = 16;
-	rw_region[2].start_addr = 0x50000;
-	rw_region[2].length = 32;
+	rw_region1[0].start_addr = 0x10000;
+	rw_region1[0].length = RSA_ENCRYPT_LEN;
+	rw_region1[1].start_addr = 0x30000;
+	rw_region1[1].length = 16;
+	rw_region1[2].start_addr = 0x50000;
+	rw_region1[2].length = 32;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 3;
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 3;
 
-	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, &rw_list);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	rw_region2[0].start_addr = 0x10000;
+	rw_region2[0].length = RSA_ENCRYPT_LEN;
+	rw_region2[1].start_addr = 0x30000;
+	rw_region2[1].length = 16;
+
+	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 2;
+
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_COUNT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -7178,122 +7175,50 @@ static void host_fw_migrate_read_write_data_test_copy_error (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_read_write_regions_different_test (CuTest *test)
+static void host_fw_migrate_read_write_data_test_diff_address_and_size (CuTest *test)
 {
-	struct flash_region rw_region1;
-	struct pfm_read_write rw_prop1;
+	struct flash_region rw_region1[3];
+	struct pfm_read_write rw_prop1[3];
 	struct pfm_read_write_regions rw_list1;
-	struct flash_region rw_region2;
-	struct pfm_read_write rw_prop2;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
 	struct pfm_read_write_regions rw_list2;
-	bool status;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
-	rw_region1.start_addr = 0x10000;
-	rw_region1.length = 0x100;
-
-	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list1.regions = &rw_region1;
-	rw_list1.properties = &rw_prop1;
-	rw_list1.count = 1;
-
-	rw_region2.start_addr = 0x10000;
-	rw_region2.length = 0x100;
-
-	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list2.regions = &rw_region2;
-	rw_list2.properties = &rw_prop2;
-	rw_list2.count = 1;
-
-	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
-	CuAssertIntEquals (test, false, status);
-}
-
-static void host_fw_are_read_write_regions_different_test_different_address (CuTest *test)
-{
-	struct flash_region rw_region1;
-	struct pfm_read_write rw_prop1;
-	struct pfm_read_write_regions rw_list1;
-	struct flash_region rw_region2;
-	struct pfm_read_write rw_prop2;
-	struct pfm_read_write_regions rw_list2;
-	bool status;
-
-	TEST_START;
-
-	rw_region1.start_addr = 0x10000;
-	rw_region1.length = 0x100;
-
-	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list1.regions = &rw_region1;
-	rw_list1.properties = &rw_prop1;
-	rw_list1.count = 1;
-
-	rw_region2.start_addr = 0x50000;
-	rw_region2.length = 0x100;
-
-	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list2.regions = &rw_region2;
-	rw_list2.properties = &rw_prop2;
-	rw_list2.count = 1;
-
-	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
-	CuAssertIntEquals (test, true, status);
-}
-
-static void host_fw_are_read_write_regions_different_test_different_size (CuTest *test)
-{
-	struct flash_region rw_region1;
-	struct pfm_read_write rw_prop1;
-	struct pfm_read_write_regions rw_list1;
-	struct flash_region rw_region2;
-	struct pfm_read_write rw_prop2;
-	struct pfm_read_write_regions rw_list2;
-	bool status;
-
-	TEST_START;
-
-	rw_region1.start_addr = 0x10000;
-	rw_region1.length = 0x100;
-
-	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_list1.regions = &rw_region1;
-	rw_list1.properties = &rw_prop1;
-	rw_list1.count = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_region2.start_addr = 0x10000;
-	rw_region2.length = 0x101;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_list2.regions = &rw_region2;
-	rw_list2.properties = &rw_prop2;
-	rw_list2.count = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
-	CuAssertIntEquals (test, true, status);
-}
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-static void host_fw_are_read_write_regions_different_test_multiple (CuTest *test)
-{
-	struct flash_region rw_region1[3];
-	struct pfm_read_write rw_prop1[3];
-	struct pfm_read_write_regions rw_list1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
-	struct pfm_read_write_regions rw_list2;
-	bool status;
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x40000, 16);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 16);
 
-	TEST_START;
+	CuAssertIntEquals (test, 0, status);
 
 	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = 0x100;
+	rw_region1[0].length = RSA_ENCRYPT_LEN;
 	rw_region1[1].start_addr = 0x30000;
 	rw_region1[1].length = 16;
 	rw_region1[2].start_addr = 0x50000;
@@ -7308,11 +7233,11 @@ static void host_fw_are_read_write_regions_different_test_multiple (CuTest *test
 	rw_list1.count = 3;
 
 	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = 0x100;
-	rw_region2[1].start_addr = 0x30000;
+	rw_region2[0].length = RSA_ENCRYPT_LEN;
+	rw_region2[1].start_addr = 0x40000;
 	rw_region2[1].length = 16;
 	rw_region2[2].start_addr = 0x50000;
-	rw_region2[2].length = 32;
+	rw_region2[2].length = 16;
 
 	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
 	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
@@ -7322,24 +7247,63 @@ static void host_fw_are_read_write_regions_different_test_multiple (CuTest *test
 	rw_list2.properties = rw_prop2;
 	rw_list2.count = 3;
 
-	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
-	CuAssertIntEquals (test, false, status);
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_ADDR, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_read_write_regions_different_test_multiple_diff_addr (CuTest *test)
+static void host_fw_migrate_read_write_data_test_diff_size_and_address (CuTest *test)
 {
 	struct flash_region rw_region1[3];
 	struct pfm_read_write rw_prop1[3];
 	struct pfm_read_write_regions rw_list1;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
 	struct flash_region rw_region2[3];
 	struct pfm_read_write rw_prop2[3];
 	struct pfm_read_write_regions rw_list2;
-	bool status;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 8);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x60000, 32);
+
+	CuAssertIntEquals (test, 0, status);
+
 	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = 0x100;
+	rw_region1[0].length = RSA_ENCRYPT_LEN;
 	rw_region1[1].start_addr = 0x30000;
 	rw_region1[1].length = 16;
 	rw_region1[2].start_addr = 0x50000;
@@ -7354,9 +7318,9 @@ static void host_fw_are_read_write_regions_different_test_multiple_diff_addr (Cu
 	rw_list1.count = 3;
 
 	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = 0x100;
+	rw_region2[0].length = RSA_ENCRYPT_LEN;
 	rw_region2[1].start_addr = 0x30000;
-	rw_region2[1].length = 16;
+	rw_region2[1].length = 8;
 	rw_region2[2].start_addr = 0x60000;
 	rw_region2[2].length = 32;
 
@@ -7368,24 +7332,62 @@ static void host_fw_are_read_write_regions_different_test_multiple_diff_addr (Cu
 	rw_list2.properties = rw_prop2;
 	rw_list2.count = 3;
 
-	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
-	CuAssertIntEquals (test, true, status);
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_SIZE, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_read_write_regions_different_test_multiple_diff_size (CuTest *test)
+static void host_fw_migrate_read_write_data_test_all_different (CuTest *test)
 {
 	struct flash_region rw_region1[3];
 	struct pfm_read_write rw_prop1[3];
 	struct pfm_read_write_regions rw_list1;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
 	struct flash_region rw_region2[3];
 	struct pfm_read_write rw_prop2[3];
 	struct pfm_read_write_regions rw_list2;
-	bool status;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x20000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 8);
+
+	CuAssertIntEquals (test, 0, status);
+
 	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = 0x100;
+	rw_region1[0].length = RSA_ENCRYPT_LEN;
 	rw_region1[1].start_addr = 0x30000;
 	rw_region1[1].length = 16;
 	rw_region1[2].start_addr = 0x50000;
@@ -7399,125 +7401,82 @@ static void host_fw_are_read_write_regions_different_test_multiple_diff_size (Cu
 	rw_list1.properties = rw_prop1;
 	rw_list1.count = 3;
 
-	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = 0x100;
+	rw_region2[0].start_addr = 0x20000;
+	rw_region2[0].length = RSA_ENCRYPT_LEN;
 	rw_region2[1].start_addr = 0x30000;
-	rw_region2[1].length = 24;
-	rw_region2[2].start_addr = 0x50000;
-	rw_region2[2].length = 32;
+	rw_region2[1].length = 8;
 
 	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
 	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
 
 	rw_list2.regions = rw_region2;
 	rw_list2.properties = rw_prop2;
-	rw_list2.count = 3;
+	rw_list2.count = 2;
 
-	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
-	CuAssertIntEquals (test, true, status);
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
+	CuAssertIntEquals (test, HOST_FW_UTIL_DIFF_REGION_COUNT, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_read_write_regions_different_test_second_fewer (CuTest *test)
+static void host_fw_migrate_read_write_data_test_multiple_diff_ordering (CuTest *test)
 {
 	struct flash_region rw_region1[3];
 	struct pfm_read_write rw_prop1[3];
 	struct pfm_read_write_regions rw_list1;
-	struct flash_region rw_region2[2];
-	struct pfm_read_write rw_prop2[2];
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
 	struct pfm_read_write_regions rw_list2;
-	bool status;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
-	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = 0x100;
-	rw_region1[1].start_addr = 0x30000;
-	rw_region1[1].length = 16;
-	rw_region1[2].start_addr = 0x50000;
-	rw_region1[2].length = 32;
-
-	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list1.regions = rw_region1;
-	rw_list1.properties = rw_prop1;
-	rw_list1.count = 3;
-
-	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = 0x100;
-	rw_region2[1].start_addr = 0x30000;
-	rw_region2[1].length = 16;
-
-	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list2.regions = rw_region2;
-	rw_list2.properties = rw_prop2;
-	rw_list2.count = 2;
-
-	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
-	CuAssertIntEquals (test, true, status);
-}
-
-static void host_fw_are_read_write_regions_different_test_first_fewer (CuTest *test)
-{
-	struct flash_region rw_region1[2];
-	struct pfm_read_write rw_prop1[2];
-	struct pfm_read_write_regions rw_list1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
-	struct pfm_read_write_regions rw_list2;
-	bool status;
-
-	TEST_START;
-
-	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = 0x100;
-	rw_region1[1].start_addr = 0x30000;
-	rw_region1[1].length = 16;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_list1.regions = rw_region1;
-	rw_list1.properties = rw_prop1;
-	rw_list1.count = 2;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_region2[0].start_addr = 0x10000;
-	rw_region2[0].length = 0x100;
-	rw_region2[1].start_addr = 0x30000;
-	rw_region2[1].length = 16;
-	rw_region2[2].start_addr = 0x50000;
-	rw_region2[2].length = 32;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_list2.regions = rw_region2;
-	rw_list2.properties = rw_prop2;
-	rw_list2.count = 3;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
-	CuAssertIntEquals (test, true, status);
-}
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 16);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
 
-static void host_fw_are_read_write_regions_different_test_multiple_reordered (CuTest *test)
-{
-	struct flash_region rw_region1[3];
-	struct pfm_read_write rw_prop1[3];
-	struct pfm_read_write_regions rw_list1;
-	struct flash_region rw_region2[3];
-	struct pfm_read_write rw_prop2[3];
-	struct pfm_read_write_regions rw_list2;
-	bool status;
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
+		0x10000, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x30000,
+		0x30000, RSA_ENCRYPT_TEST2, 16);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x50000,
+		0x50000, RSA_ENCRYPT_NOPE, 32);
 
-	TEST_START;
+	CuAssertIntEquals (test, 0, status);
 
 	rw_region1[0].start_addr = 0x10000;
-	rw_region1[0].length = 0x100;
+	rw_region1[0].length = RSA_ENCRYPT_LEN;
 	rw_region1[1].start_addr = 0x30000;
 	rw_region1[1].length = 16;
 	rw_region1[2].start_addr = 0x50000;
@@ -7534,7 +7493,7 @@ static void host_fw_are_read_write_regions_different_test_multiple_reordered (Cu
 	rw_region2[0].start_addr = 0x50000;
 	rw_region2[0].length = 32;
 	rw_region2[1].start_addr = 0x10000;
-	rw_region2[1].length = 0x100;
+	rw_region2[1].length = RSA_ENCRYPT_LEN;
 	rw_region2[2].start_addr = 0x30000;
 	rw_region2[2].length = 16;
 
@@ -7546,55 +7505,21 @@ static void host_fw_are_read_write_regions_different_test_multiple_reordered (Cu
 	rw_list2.properties = rw_prop2;
 	rw_list2.count = 3;
 
-	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
-	CuAssertIntEquals (test, false, status);
-}
-
-static void host_fw_are_read_write_regions_different_test_null (CuTest *test)
-{
-	struct flash_region rw_region1;
-	struct pfm_read_write rw_prop1;
-	struct pfm_read_write_regions rw_list1;
-	struct flash_region rw_region2;
-	struct pfm_read_write rw_prop2;
-	struct pfm_read_write_regions rw_list2;
-	bool status;
-
-	TEST_START;
-
-	rw_region1.start_addr = 0x10000;
-	rw_region1.length = 0x100;
-
-	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list1.regions = &rw_region1;
-	rw_list1.properties = &rw_prop1;
-	rw_list1.count = 1;
-
-	rw_region2.start_addr = 0x10000;
-	rw_region2.length = 0x100;
-
-	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list2.regions = &rw_region2;
-	rw_list2.properties = &rw_prop2;
-	rw_list2.count = 1;
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list2, &flash1, &rw_list1);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_read_write_regions_different (NULL, &rw_list2);
-	CuAssertIntEquals (test, true, status);
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_read_write_regions_different (&rw_list1, NULL);
-	CuAssertIntEquals (test, true, status);
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_read_write_regions_different (NULL, NULL);
-	CuAssertIntEquals (test, false, status);
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_flash_device_test (CuTest *test)
+static void host_fw_migrate_read_write_data_test_no_source_regions (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list img_list;
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
@@ -7605,7 +7530,6 @@ static void host_fw_restore_flash_device_test (CuTest *test)
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
-	char *data = "Test";
 
 	TEST_START;
 
@@ -7624,33 +7548,17 @@ static void host_fw_restore_flash_device_test (CuTest *test)
 	status = spi_flash_set_device_size (&flash1, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x30000);
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
-
-	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
-		(uint8_t*) data, strlen (data), 0);
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
+		0x10000, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
 
 	CuAssertIntEquals (test, 0, status);
 
-	img_region.start_addr = 0;
-	img_region.length = strlen (data);
-
-	sig.regions = &img_region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
-
-	img_list.images_sig = &sig;
-	img_list.images_hash = NULL;
-	img_list.count = 1;
-
 	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	rw_region.length = RSA_ENCRYPT_LEN;
 
 	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
@@ -7658,7 +7566,7 @@ static void host_fw_restore_flash_device_test (CuTest *test)
 	rw_list.properties = &rw_prop;
 	rw_list.count = 1;
 
-	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, NULL);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
@@ -7671,11 +7579,8 @@ static void host_fw_restore_flash_device_test (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_flash_device_test_multipart_image (CuTest *test)
+static void host_fw_migrate_read_write_data_test_null (CuTest *test)
 {
-	struct flash_region img_region[2];
-	struct pfm_image_signature sig;
-	struct pfm_image_list img_list;
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
@@ -7686,7 +7591,6 @@ static void host_fw_restore_flash_device_test_multipart_image (CuTest *test)
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
-	char *data = "Test";
 
 	TEST_START;
 
@@ -7705,37 +7609,11 @@ static void host_fw_restore_flash_device_test_multipart_image (CuTest *test)
 	status = spi_flash_set_device_size (&flash1, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x30000);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
-
-	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
-		(uint8_t*) data, 1, 0);
-	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0x20000, 0x20000,
-		(uint8_t*) data + 1, strlen (data) - 1, 0);
-
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	img_region[0].start_addr = 0;
-	img_region[0].length = 1;
-	img_region[1].start_addr = 0x20000;
-	img_region[1].length = strlen (data) - 1;
-
-	sig.regions = img_region;
-	sig.count = 2;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
-
-	img_list.images_sig = &sig;
-	img_list.images_hash = NULL;
-	img_list.count = 1;
-
 	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	rw_region.length = RSA_ENCRYPT_LEN;
 
 	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
@@ -7743,8 +7621,14 @@ static void host_fw_restore_flash_device_test_multipart_image (CuTest *test)
 	rw_list.properties = &rw_prop;
 	rw_list.count = 1;
 
-	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_migrate_read_write_data (NULL, &rw_list, &flash1, &rw_list);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+
+	status = host_fw_migrate_read_write_data (&flash2, NULL, &flash1, &rw_list);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list, NULL, &rw_list);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -7756,13 +7640,10 @@ static void host_fw_restore_flash_device_test_multipart_image (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_flash_device_test_multiple_images (CuTest *test)
+static void host_fw_migrate_read_write_data_test_erase_error (CuTest *test)
 {
-	struct flash_region img_region[2];
-	struct pfm_image_signature sig[2];
-	struct pfm_image_list img_list;
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
@@ -7771,8 +7652,6 @@ static void host_fw_restore_flash_device_test_multiple_images (CuTest *test)
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
 
 	TEST_START;
 
@@ -7791,54 +7670,31 @@ static void host_fw_restore_flash_device_test_multiple_images (CuTest *test)
 	status = spi_flash_set_device_size (&flash1, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x30000);
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
-
-	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
-		(uint8_t*) data1, strlen (data1), 0);
-	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0x20000, 0x20000,
-		(uint8_t*) data2, strlen (data2), 0);
+	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	img_region[0].start_addr = 0;
-	img_region[0].length = strlen (data1);
-
-	sig[0].regions = img_region;
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
-
-	img_region[1].start_addr = 0x20000;
-	img_region[1].length = strlen (data2);
-
-	sig[1].regions = &img_region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
-
-	img_list.images_sig = sig;
-	img_list.images_hash = NULL;
-	img_list.count = 2;
-
-	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	rw_region[0].start_addr = 0x10000;
+	rw_region[0].length = RSA_ENCRYPT_LEN;
+	rw_region[1].start_addr = 0x30000;
+	rw_region[1].length = 16;
+	rw_region[2].start_addr = 0x50000;
+	rw_region[2].length = 32;
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 3;
 
-	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, &rw_list);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -7850,11 +7706,8 @@ static void host_fw_restore_flash_device_test_multiple_images (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_flash_device_test_multiple_rw_regions (CuTest *test)
+static void host_fw_migrate_read_write_data_test_copy_error (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list img_list;
 	struct flash_region rw_region[3];
 	struct pfm_read_write rw_prop[3];
 	struct pfm_read_write_regions rw_list;
@@ -7865,7 +7718,6 @@ static void host_fw_restore_flash_device_test_multiple_rw_regions (CuTest *test)
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
-	char *data = "Test";
 
 	TEST_START;
 
@@ -7884,39 +7736,24 @@ static void host_fw_restore_flash_device_test_multiple_rw_regions (CuTest *test)
 	status = spi_flash_set_device_size (&flash1, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x70000);
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x60000);
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, RSA_ENCRYPT_LEN);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x30000, 16);
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x50000, 32);
 
-	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
-		(uint8_t*) data, strlen (data), 0);
+	status |= flash_master_mock_expect_xfer (&flash_mock1, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	img_region.start_addr = 0;
-	img_region.length = strlen (data);
-
-	sig.regions = &img_region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
-
-	img_list.images_sig = &sig;
-	img_list.images_hash = NULL;
-	img_list.count = 1;
-
 	rw_region[0].start_addr = 0x10000;
-	rw_region[0].length = 0x10000;
+	rw_region[0].length = RSA_ENCRYPT_LEN;
 	rw_region[1].start_addr = 0x30000;
-	rw_region[1].length = 0x10000;
+	rw_region[1].length = 16;
 	rw_region[2].start_addr = 0x50000;
-	rw_region[2].length = 0x10000;
+	rw_region[2].length = 32;
 
 	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
 	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
@@ -7926,8 +7763,8 @@ static void host_fw_restore_flash_device_test_multiple_rw_regions (CuTest *test)
 	rw_list.properties = rw_prop;
 	rw_list.count = 3;
 
-	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_migrate_read_write_data (&flash2, &rw_list, &flash1, &rw_list);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -7939,141 +7776,902 @@ static void host_fw_restore_flash_device_test_multiple_rw_regions (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_flash_device_test_rw_regions_not_ordered (CuTest *test)
+static void host_fw_are_read_write_regions_different_test (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list img_list;
-	struct flash_region rw_region[3];
-	struct pfm_read_write rw_prop[3];
-	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
-	int status;
-	char *data = "Test";
+	struct flash_region rw_region1;
+	struct pfm_read_write rw_prop1;
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2;
+	struct pfm_read_write rw_prop2;
+	struct pfm_read_write_regions rw_list2;
+	bool status;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock2);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
-	CuAssertIntEquals (test, 0, status);
+	rw_region1.start_addr = 0x10000;
+	rw_region1.length = 0x100;
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
 
-	status = spi_flash_set_device_size (&flash2, 0x70000);
-	CuAssertIntEquals (test, 0, status);
+	rw_list1.regions = &rw_region1;
+	rw_list1.properties = &rw_prop1;
+	rw_list1.count = 1;
 
-	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x60000);
+	rw_region2.start_addr = 0x10000;
+	rw_region2.length = 0x100;
 
-	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
-		(uint8_t*) data, strlen (data), 0);
+	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
 
-	CuAssertIntEquals (test, 0, status);
+	rw_list2.regions = &rw_region2;
+	rw_list2.properties = &rw_prop2;
+	rw_list2.count = 1;
 
-	img_region.start_addr = 0;
-	img_region.length = strlen (data);
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, false, status);
+}
 
-	sig.regions = &img_region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+static void host_fw_are_read_write_regions_different_test_different_address (CuTest *test)
+{
+	struct flash_region rw_region1;
+	struct pfm_read_write rw_prop1;
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2;
+	struct pfm_read_write rw_prop2;
+	struct pfm_read_write_regions rw_list2;
+	bool status;
 
-	img_list.images_sig = &sig;
-	img_list.images_hash = NULL;
-	img_list.count = 1;
+	TEST_START;
 
-	rw_region[0].start_addr = 0x50000;
-	rw_region[0].length = 0x10000;
-	rw_region[1].start_addr = 0x30000;
-	rw_region[1].length = 0x10000;
-	rw_region[2].start_addr = 0x10000;
-	rw_region[2].length = 0x10000;
+	rw_region1.start_addr = 0x10000;
+	rw_region1.length = 0x100;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 3;
+	rw_list1.regions = &rw_region1;
+	rw_list1.properties = &rw_prop1;
+	rw_list1.count = 1;
 
-	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	rw_region2.start_addr = 0x50000;
+	rw_region2.length = 0x100;
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
+	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
-	CuAssertIntEquals (test, 0, status);
+	rw_list2.regions = &rw_region2;
+	rw_list2.properties = &rw_prop2;
+	rw_list2.count = 1;
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_restore_flash_device_test_start_and_end_rw (CuTest *test)
+static void host_fw_are_read_write_regions_different_test_different_size (CuTest *test)
 {
-	struct flash_region img_region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list img_list;
-	struct flash_region rw_region[3];
-	struct pfm_read_write rw_prop[3];
-	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
-	int status;
-	char *data = "Test";
+	struct flash_region rw_region1;
+	struct pfm_read_write rw_prop1;
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2;
+	struct pfm_read_write rw_prop2;
+	struct pfm_read_write_regions rw_list2;
+	bool status;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock2);
-	CuAssertIntEquals (test, 0, status);
+	rw_region1.start_addr = 0x10000;
+	rw_region1.length = 0x100;
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
-	CuAssertIntEquals (test, 0, status);
+	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
-	CuAssertIntEquals (test, 0, status);
+	rw_list1.regions = &rw_region1;
+	rw_list1.properties = &rw_prop1;
+	rw_list1.count = 1;
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	rw_region2.start_addr = 0x10000;
+	rw_region2.length = 0x101;
 
-	status = spi_flash_set_device_size (&flash2, 0x70000);
-	CuAssertIntEquals (test, 0, status);
+	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
 
-	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0x10000);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000);
-	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x50000);
+	rw_list2.regions = &rw_region2;
+	rw_list2.properties = &rw_prop2;
+	rw_list2.count = 1;
 
-	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0x20000, 0x20000,
-		(uint8_t*) data, strlen (data), 0);
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, true, status);
+}
 
-	CuAssertIntEquals (test, 0, status);
+static void host_fw_are_read_write_regions_different_test_multiple (CuTest *test)
+{
+	struct flash_region rw_region1[3];
+	struct pfm_read_write rw_prop1[3];
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
+	struct pfm_read_write_regions rw_list2;
+	bool status;
+
+	TEST_START;
+
+	rw_region1[0].start_addr = 0x10000;
+	rw_region1[0].length = 0x100;
+	rw_region1[1].start_addr = 0x30000;
+	rw_region1[1].length = 16;
+	rw_region1[2].start_addr = 0x50000;
+	rw_region1[2].length = 32;
+
+	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 3;
+
+	rw_region2[0].start_addr = 0x10000;
+	rw_region2[0].length = 0x100;
+	rw_region2[1].start_addr = 0x30000;
+	rw_region2[1].length = 16;
+	rw_region2[2].start_addr = 0x50000;
+	rw_region2[2].length = 32;
+
+	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 3;
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, false, status);
+}
+
+static void host_fw_are_read_write_regions_different_test_multiple_diff_addr (CuTest *test)
+{
+	struct flash_region rw_region1[3];
+	struct pfm_read_write rw_prop1[3];
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
+	struct pfm_read_write_regions rw_list2;
+	bool status;
+
+	TEST_START;
+
+	rw_region1[0].start_addr = 0x10000;
+	rw_region1[0].length = 0x100;
+	rw_region1[1].start_addr = 0x30000;
+	rw_region1[1].length = 16;
+	rw_region1[2].start_addr = 0x50000;
+	rw_region1[2].length = 32;
+
+	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 3;
+
+	rw_region2[0].start_addr = 0x10000;
+	rw_region2[0].length = 0x100;
+	rw_region2[1].start_addr = 0x30000;
+	rw_region2[1].length = 16;
+	rw_region2[2].start_addr = 0x60000;
+	rw_region2[2].length = 32;
+
+	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 3;
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_read_write_regions_different_test_multiple_diff_size (CuTest *test)
+{
+	struct flash_region rw_region1[3];
+	struct pfm_read_write rw_prop1[3];
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
+	struct pfm_read_write_regions rw_list2;
+	bool status;
+
+	TEST_START;
+
+	rw_region1[0].start_addr = 0x10000;
+	rw_region1[0].length = 0x100;
+	rw_region1[1].start_addr = 0x30000;
+	rw_region1[1].length = 16;
+	rw_region1[2].start_addr = 0x50000;
+	rw_region1[2].length = 32;
+
+	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 3;
+
+	rw_region2[0].start_addr = 0x10000;
+	rw_region2[0].length = 0x100;
+	rw_region2[1].start_addr = 0x30000;
+	rw_region2[1].length = 24;
+	rw_region2[2].start_addr = 0x50000;
+	rw_region2[2].length = 32;
+
+	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 3;
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_read_write_regions_different_test_second_fewer (CuTest *test)
+{
+	struct flash_region rw_region1[3];
+	struct pfm_read_write rw_prop1[3];
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2[2];
+	struct pfm_read_write rw_prop2[2];
+	struct pfm_read_write_regions rw_list2;
+	bool status;
+
+	TEST_START;
+
+	rw_region1[0].start_addr = 0x10000;
+	rw_region1[0].length = 0x100;
+	rw_region1[1].start_addr = 0x30000;
+	rw_region1[1].length = 16;
+	rw_region1[2].start_addr = 0x50000;
+	rw_region1[2].length = 32;
+
+	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 3;
+
+	rw_region2[0].start_addr = 0x10000;
+	rw_region2[0].length = 0x100;
+	rw_region2[1].start_addr = 0x30000;
+	rw_region2[1].length = 16;
+
+	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 2;
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_read_write_regions_different_test_first_fewer (CuTest *test)
+{
+	struct flash_region rw_region1[2];
+	struct pfm_read_write rw_prop1[2];
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
+	struct pfm_read_write_regions rw_list2;
+	bool status;
+
+	TEST_START;
+
+	rw_region1[0].start_addr = 0x10000;
+	rw_region1[0].length = 0x100;
+	rw_region1[1].start_addr = 0x30000;
+	rw_region1[1].length = 16;
+
+	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 2;
+
+	rw_region2[0].start_addr = 0x10000;
+	rw_region2[0].length = 0x100;
+	rw_region2[1].start_addr = 0x30000;
+	rw_region2[1].length = 16;
+	rw_region2[2].start_addr = 0x50000;
+	rw_region2[2].length = 32;
+
+	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 3;
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_read_write_regions_different_test_multiple_reordered (CuTest *test)
+{
+	struct flash_region rw_region1[3];
+	struct pfm_read_write rw_prop1[3];
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2[3];
+	struct pfm_read_write rw_prop2[3];
+	struct pfm_read_write_regions rw_list2;
+	bool status;
+
+	TEST_START;
+
+	rw_region1[0].start_addr = 0x10000;
+	rw_region1[0].length = 0x100;
+	rw_region1[1].start_addr = 0x30000;
+	rw_region1[1].length = 16;
+	rw_region1[2].start_addr = 0x50000;
+	rw_region1[2].length = 32;
+
+	rw_prop1[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop1[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 3;
+
+	rw_region2[0].start_addr = 0x50000;
+	rw_region2[0].length = 32;
+	rw_region2[1].start_addr = 0x10000;
+	rw_region2[1].length = 0x100;
+	rw_region2[2].start_addr = 0x30000;
+	rw_region2[2].length = 16;
+
+	rw_prop2[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop2[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 3;
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, false, status);
+}
+
+static void host_fw_are_read_write_regions_different_test_null (CuTest *test)
+{
+	struct flash_region rw_region1;
+	struct pfm_read_write rw_prop1;
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2;
+	struct pfm_read_write rw_prop2;
+	struct pfm_read_write_regions rw_list2;
+	bool status;
+
+	TEST_START;
+
+	rw_region1.start_addr = 0x10000;
+	rw_region1.length = 0x100;
+
+	rw_prop1.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list1.regions = &rw_region1;
+	rw_list1.properties = &rw_prop1;
+	rw_list1.count = 1;
+
+	rw_region2.start_addr = 0x10000;
+	rw_region2.length = 0x100;
+
+	rw_prop2.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list2.regions = &rw_region2;
+	rw_list2.properties = &rw_prop2;
+	rw_list2.count = 1;
+
+	status = host_fw_are_read_write_regions_different (NULL, &rw_list2);
+	CuAssertIntEquals (test, true, status);
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, NULL);
+	CuAssertIntEquals (test, true, status);
+
+	status = host_fw_are_read_write_regions_different (NULL, NULL);
+	CuAssertIntEquals (test, false, status);
+}
+
+static void host_fw_restore_flash_device_test (CuTest *test)
+{
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x30000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
+
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, strlen (data), 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_flash_device_test_multipart_image (CuTest *test)
+{
+	struct flash_region img_region[2];
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x30000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
+
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, 1, 0);
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0x20000, 0x20000,
+		(uint8_t*) data + 1, strlen (data) - 1, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region[0].start_addr = 0;
+	img_region[0].length = 1;
+	img_region[1].start_addr = 0x20000;
+	img_region[1].length = strlen (data) - 1;
+
+	sig.regions = img_region;
+	sig.count = 2;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_flash_device_test_multiple_images (CuTest *test)
+{
+	struct flash_region img_region[2];
+	struct pfm_image_signature sig[2];
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data1 = "Test";
+	char *data2 = "Test2";
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x30000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
+
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data1, strlen (data1), 0);
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0x20000, 0x20000,
+		(uint8_t*) data2, strlen (data2), 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region[0].start_addr = 0;
+	img_region[0].length = strlen (data1);
+
+	sig[0].regions = img_region;
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
+
+	img_region[1].start_addr = 0x20000;
+	img_region[1].length = strlen (data2);
+
+	sig[1].regions = &img_region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
+
+	img_list.images_sig = sig;
+	img_list.images_hash = NULL;
+	img_list.count = 2;
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_flash_device_test_multiple_rw_regions (CuTest *test)
+{
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x70000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x60000);
+
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, strlen (data), 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region[0].start_addr = 0x10000;
+	rw_region[0].length = 0x10000;
+	rw_region[1].start_addr = 0x30000;
+	rw_region[1].length = 0x10000;
+	rw_region[2].start_addr = 0x50000;
+	rw_region[2].length = 0x10000;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 3;
+
+	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_flash_device_test_rw_regions_not_ordered (CuTest *test)
+{
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x70000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x60000);
+
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, strlen (data), 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region[0].start_addr = 0x50000;
+	rw_region[0].length = 0x10000;
+	rw_region[1].start_addr = 0x30000;
+	rw_region[1].length = 0x10000;
+	rw_region[2].start_addr = 0x10000;
+	rw_region[2].length = 0x10000;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 3;
+
+	status = host_fw_restore_flash_device (&flash2, &flash1, &img_list, &rw_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_flash_device_test_start_and_end_rw (CuTest *test)
+{
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x70000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash (&flash_mock2, 0x10000);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x20000);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000);
+	status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x50000);
+
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0x20000, 0x20000,
+		(uint8_t*) data, strlen (data), 0);
+
+	CuAssertIntEquals (test, 0, status);
 
 	img_region.start_addr = 0x20000;
 	img_region.length = strlen (data);
@@ -10699,10 +11297,54 @@ static void host_fw_are_images_different_test_hashes_different_hash (CuTest *tes
 
 	hash2.regions = &region2;
 	hash2.count = 1;
-	memcpy (hash2.hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	memcpy (hash2.hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2.hash_length = SHA256_HASH_LENGTH;
+	hash2.hash_type = HASH_TYPE_SHA256;
+	hash2.always_validate = 1;
+
+	list2.images_hash = &hash2;
+	list2.images_sig = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_hashes_different_validate_flag (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_hash hash1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_hash hash2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	hash1.regions = &region1;
+	hash1.count = 1;
+	memcpy (hash1.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1.hash_length = SHA256_HASH_LENGTH;
+	hash1.hash_type = HASH_TYPE_SHA256;
+	hash1.always_validate = 1;
+
+	list1.images_hash = &hash1;
+	list1.images_sig = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	hash2.regions = &region2;
+	hash2.count = 1;
+	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
 	hash2.hash_length = SHA256_HASH_LENGTH;
 	hash2.hash_type = HASH_TYPE_SHA256;
-	hash2.always_validate = 1;
+	hash2.always_validate = 0;
 
 	list2.images_hash = &hash2;
 	list2.images_sig = NULL;
@@ -10712,7 +11354,7 @@ static void host_fw_are_images_different_test_hashes_different_hash (CuTest *tes
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_hashes_different_validate_flag (CuTest *test)
+static void host_fw_are_images_different_test_hashes_different_region_addr (CuTest *test)
 {
 	struct flash_region region1;
 	struct pfm_image_hash hash1;
@@ -10738,7 +11380,7 @@ static void host_fw_are_images_different_test_hashes_different_validate_flag (Cu
 	list1.images_sig = NULL;
 	list1.count = 1;
 
-	region2.start_addr = 0x10000;
+	region2.start_addr = 0x20000;
 	region2.length = 0x100;
 
 	hash2.regions = &region2;
@@ -10746,7 +11388,7 @@ static void host_fw_are_images_different_test_hashes_different_validate_flag (Cu
 	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
 	hash2.hash_length = SHA256_HASH_LENGTH;
 	hash2.hash_type = HASH_TYPE_SHA256;
-	hash2.always_validate = 0;
+	hash2.always_validate = 1;
 
 	list2.images_hash = &hash2;
 	list2.images_sig = NULL;
@@ -10756,7 +11398,7 @@ static void host_fw_are_images_different_test_hashes_different_validate_flag (Cu
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_hashes_different_region_addr (CuTest *test)
+static void host_fw_are_images_different_test_hashes_different_region_length (CuTest *test)
 {
 	struct flash_region region1;
 	struct pfm_image_hash hash1;
@@ -10782,8 +11424,8 @@ static void host_fw_are_images_different_test_hashes_different_region_addr (CuTe
 	list1.images_sig = NULL;
 	list1.count = 1;
 
-	region2.start_addr = 0x20000;
-	region2.length = 0x100;
+	region2.start_addr = 0x10000;
+	region2.length = 0x200;
 
 	hash2.regions = &region2;
 	hash2.count = 1;
@@ -10800,51 +11442,273 @@ static void host_fw_are_images_different_test_hashes_different_region_addr (CuTe
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_hashes_different_region_length (CuTest *test)
+static void host_fw_are_images_different_test_multiple_images_hashes (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_hash hash1;
+	struct flash_region region11;
+	struct flash_region region12;
+	struct flash_region region13;
+	struct pfm_image_hash hash1[3];
 	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_hash hash2;
+	struct flash_region region21;
+	struct flash_region region22;
+	struct flash_region region23;
+	struct pfm_image_hash hash2[3];
 	struct pfm_image_list list2;
 	bool status;
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	region11.start_addr = 0x10000;
+	region11.length = 0x100;
 
-	hash1.regions = &region1;
-	hash1.count = 1;
-	memcpy (hash1.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1.hash_length = SHA256_HASH_LENGTH;
-	hash1.hash_type = HASH_TYPE_SHA256;
-	hash1.always_validate = 1;
+	hash1[0].regions = &region11;
+	hash1[0].count = 1;
+	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1[0].hash_length = SHA256_HASH_LENGTH;
+	hash1[0].hash_type = HASH_TYPE_SHA256;
+	hash1[0].always_validate = 1;
+
+	region12.start_addr = 0x30000;
+	region12.length = 32;
+
+	hash1[1].regions = &region12;
+	hash1[1].count = 1;
+	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[1].hash_length = SHA256_HASH_LENGTH;
+	hash1[1].hash_type = HASH_TYPE_SHA256;
+	hash1[1].always_validate = 1;
+
+	region13.start_addr = 0x50000;
+	region13.length = 16;
+
+	hash1[2].regions = &region13;
+	hash1[2].count = 1;
+	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[2].hash_length = SHA256_HASH_LENGTH;
+	hash1[2].hash_type = HASH_TYPE_SHA256;
+	hash1[2].always_validate = 1;
+
+	list1.images_hash = hash1;
+	list1.images_sig = NULL;
+	list1.count = 3;
+
+	region21.start_addr = 0x10000;
+	region21.length = 0x100;
+
+	hash2[0].regions = &region21;
+	hash2[0].count = 1;
+	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash2[0].hash_length = SHA256_HASH_LENGTH;
+	hash2[0].hash_type = HASH_TYPE_SHA256;
+	hash2[0].always_validate = 1;
+
+	region22.start_addr = 0x30000;
+	region22.length = 32;
+
+	hash2[1].regions = &region22;
+	hash2[1].count = 1;
+	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[1].hash_length = SHA256_HASH_LENGTH;
+	hash2[1].hash_type = HASH_TYPE_SHA256;
+	hash2[1].always_validate = 1;
+
+	region23.start_addr = 0x50000;
+	region23.length = 16;
+
+	hash2[2].regions = &region23;
+	hash2[2].count = 1;
+	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[2].hash_length = SHA256_HASH_LENGTH;
+	hash2[2].hash_type = HASH_TYPE_SHA256;
+	hash2[2].always_validate = 1;
+
+	list2.images_hash = hash2;
+	list2.images_sig = NULL;
+	list2.count = 3;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, false, status);
+}
+
+static void host_fw_are_images_different_test_multiple_images_hashes_different_hash_length (
+	CuTest *test)
+{
+	struct flash_region region11;
+	struct flash_region region12;
+	struct flash_region region13;
+	struct pfm_image_hash hash1[3];
+	struct pfm_image_list list1;
+	struct flash_region region21;
+	struct flash_region region22;
+	struct flash_region region23;
+	struct pfm_image_hash hash2[3];
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region11.start_addr = 0x10000;
+	region11.length = 0x100;
+
+	hash1[0].regions = &region11;
+	hash1[0].count = 1;
+	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1[0].hash_length = SHA256_HASH_LENGTH;
+	hash1[0].hash_type = HASH_TYPE_SHA256;
+	hash1[0].always_validate = 1;
+
+	region12.start_addr = 0x30000;
+	region12.length = 32;
+
+	hash1[1].regions = &region12;
+	hash1[1].count = 1;
+	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[1].hash_length = SHA256_HASH_LENGTH;
+	hash1[1].hash_type = HASH_TYPE_SHA256;
+	hash1[1].always_validate = 1;
+
+	region13.start_addr = 0x50000;
+	region13.length = 16;
+
+	hash1[2].regions = &region13;
+	hash1[2].count = 1;
+	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[2].hash_length = SHA256_HASH_LENGTH;
+	hash1[2].hash_type = HASH_TYPE_SHA256;
+	hash1[2].always_validate = 1;
+
+	list1.images_hash = hash1;
+	list1.images_sig = NULL;
+	list1.count = 3;
+
+	region21.start_addr = 0x10000;
+	region21.length = 0x100;
+
+	hash2[0].regions = &region21;
+	hash2[0].count = 1;
+	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash2[0].hash_length = SHA256_HASH_LENGTH;
+	hash2[0].hash_type = HASH_TYPE_SHA256;
+	hash2[0].always_validate = 1;
+
+	region22.start_addr = 0x30000;
+	region22.length = 32;
+
+	hash2[1].regions = &region22;
+	hash2[1].count = 1;
+	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[1].hash_length = SHA256_HASH_LENGTH;
+	hash2[1].hash_type = HASH_TYPE_SHA256;
+	hash2[1].always_validate = 1;
+
+	region23.start_addr = 0x50000;
+	region23.length = 16;
+
+	hash2[2].regions = &region23;
+	hash2[2].count = 1;
+	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[2].hash_length = SHA256_HASH_LENGTH - 1;
+	hash2[2].hash_type = HASH_TYPE_SHA256;
+	hash2[2].always_validate = 1;
+
+	list2.images_hash = hash2;
+	list2.images_sig = NULL;
+	list2.count = 3;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_multiple_images_hashes_different_hash_type (
+	CuTest *test)
+{
+	struct flash_region region11;
+	struct flash_region region12;
+	struct flash_region region13;
+	struct pfm_image_hash hash1[3];
+	struct pfm_image_list list1;
+	struct flash_region region21;
+	struct flash_region region22;
+	struct flash_region region23;
+	struct pfm_image_hash hash2[3];
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region11.start_addr = 0x10000;
+	region11.length = 0x100;
+
+	hash1[0].regions = &region11;
+	hash1[0].count = 1;
+	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1[0].hash_length = SHA256_HASH_LENGTH;
+	hash1[0].hash_type = HASH_TYPE_SHA256;
+	hash1[0].always_validate = 1;
+
+	region12.start_addr = 0x30000;
+	region12.length = 32;
+
+	hash1[1].regions = &region12;
+	hash1[1].count = 1;
+	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[1].hash_length = SHA256_HASH_LENGTH;
+	hash1[1].hash_type = HASH_TYPE_SHA256;
+	hash1[1].always_validate = 1;
+
+	region13.start_addr = 0x50000;
+	region13.length = 16;
+
+	hash1[2].regions = &region13;
+	hash1[2].count = 1;
+	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[2].hash_length = SHA256_HASH_LENGTH;
+	hash1[2].hash_type = HASH_TYPE_SHA256;
+	hash1[2].always_validate = 1;
+
+	list1.images_hash = hash1;
+	list1.images_sig = NULL;
+	list1.count = 3;
+
+	region21.start_addr = 0x10000;
+	region21.length = 0x100;
+
+	hash2[0].regions = &region21;
+	hash2[0].count = 1;
+	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash2[0].hash_length = SHA256_HASH_LENGTH;
+	hash2[0].hash_type = HASH_TYPE_SHA256;
+	hash2[0].always_validate = 1;
 
-	list1.images_hash = &hash1;
-	list1.images_sig = NULL;
-	list1.count = 1;
+	region22.start_addr = 0x30000;
+	region22.length = 32;
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x200;
+	hash2[1].regions = &region22;
+	hash2[1].count = 1;
+	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[1].hash_length = SHA256_HASH_LENGTH;
+	hash2[1].hash_type = HASH_TYPE_SHA384;
+	hash2[1].always_validate = 1;
 
-	hash2.regions = &region2;
-	hash2.count = 1;
-	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2.hash_length = SHA256_HASH_LENGTH;
-	hash2.hash_type = HASH_TYPE_SHA256;
-	hash2.always_validate = 1;
+	region23.start_addr = 0x50000;
+	region23.length = 16;
 
-	list2.images_hash = &hash2;
+	hash2[2].regions = &region23;
+	hash2[2].count = 1;
+	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[2].hash_length = SHA256_HASH_LENGTH;
+	hash2[2].hash_type = HASH_TYPE_SHA256;
+	hash2[2].always_validate = 1;
+
+	list2.images_hash = hash2;
 	list2.images_sig = NULL;
-	list2.count = 1;
+	list2.count = 3;
 
 	status = host_fw_are_images_different (&list1, &list2);
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes (CuTest *test)
+static void host_fw_are_images_different_test_multiple_images_hashes_different_hash (CuTest *test)
 {
 	struct flash_region region11;
 	struct flash_region region12;
@@ -10919,7 +11783,7 @@ static void host_fw_are_images_different_test_multiple_images_hashes (CuTest *te
 
 	hash2[2].regions = &region23;
 	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	memcpy (hash2[2].hash, SHA384_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
 	hash2[2].hash_length = SHA256_HASH_LENGTH;
 	hash2[2].hash_type = HASH_TYPE_SHA256;
 	hash2[2].always_validate = 1;
@@ -10929,10 +11793,10 @@ static void host_fw_are_images_different_test_multiple_images_hashes (CuTest *te
 	list2.count = 3;
 
 	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, false, status);
+	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_hash_length (
+static void host_fw_are_images_different_test_multiple_images_hashes_different_validate_flash (
 	CuTest *test)
 {
 	struct flash_region region11;
@@ -11001,7 +11865,7 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
 	hash2[1].hash_length = SHA256_HASH_LENGTH;
 	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 1;
+	hash2[1].always_validate = 0;
 
 	region23.start_addr = 0x50000;
 	region23.length = 16;
@@ -11009,7 +11873,7 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	hash2[2].regions = &region23;
 	hash2[2].count = 1;
 	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH - 1;
+	hash2[2].hash_length = SHA256_HASH_LENGTH;
 	hash2[2].hash_type = HASH_TYPE_SHA256;
 	hash2[2].always_validate = 1;
 
@@ -11021,7 +11885,7 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_hash_type (
+static void host_fw_are_images_different_test_multiple_images_hashes_different_region_addr (
 	CuTest *test)
 {
 	struct flash_region region11;
@@ -11089,10 +11953,10 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	hash2[1].count = 1;
 	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
 	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA384;
+	hash2[1].hash_type = HASH_TYPE_SHA256;
 	hash2[1].always_validate = 1;
 
-	region23.start_addr = 0x50000;
+	region23.start_addr = 0x80000;
 	region23.length = 16;
 
 	hash2[2].regions = &region23;
@@ -11110,7 +11974,8 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_hash (CuTest *test)
+static void host_fw_are_images_different_test_multiple_images_hashes_different_region_length (
+	CuTest *test)
 {
 	struct flash_region region11;
 	struct flash_region region12;
@@ -11170,440 +12035,544 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	hash2[0].hash_type = HASH_TYPE_SHA256;
 	hash2[0].always_validate = 1;
 
-	region22.start_addr = 0x30000;
-	region22.length = 32;
+	region22.start_addr = 0x30000;
+	region22.length = 48;
+
+	hash2[1].regions = &region22;
+	hash2[1].count = 1;
+	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[1].hash_length = SHA256_HASH_LENGTH;
+	hash2[1].hash_type = HASH_TYPE_SHA256;
+	hash2[1].always_validate = 1;
+
+	region23.start_addr = 0x50000;
+	region23.length = 16;
+
+	hash2[2].regions = &region23;
+	hash2[2].count = 1;
+	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[2].hash_length = SHA256_HASH_LENGTH;
+	hash2[2].hash_type = HASH_TYPE_SHA256;
+	hash2[2].always_validate = 1;
+
+	list2.images_hash = hash2;
+	list2.images_sig = NULL;
+	list2.count = 3;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_auth_types (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_hash hash2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	hash2.regions = &region2;
+	hash2.count = 1;
+	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash2.hash_length = SHA256_HASH_LENGTH;
+	hash2.hash_type = HASH_TYPE_SHA256;
+	hash2.always_validate = 1;
+
+	list2.images_hash = &hash2;
+	list2.images_sig = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_auth_types_hash_first (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_hash hash1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	hash1.regions = &region1;
+	hash1.count = 1;
+	memcpy (hash1.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1.hash_length = SHA256_HASH_LENGTH;
+	hash1.hash_type = HASH_TYPE_SHA256;
+	hash1.always_validate = 1;
+
+	list1.images_hash = &hash1;
+	list1.images_sig = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_null (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, NULL);
+	CuAssertIntEquals (test, true, status);
+
+	status = host_fw_are_images_different (NULL, &list2);
+	CuAssertIntEquals (test, true, status);
+
+	status = host_fw_are_images_different (NULL, NULL);
+	CuAssertIntEquals (test, false, status);
+}
+
+static void host_fw_restore_read_write_data_test_do_nothing (CuTest *test)
+{
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	hash2[1].regions = &region22;
-	hash2[1].count = 1;
-	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 1;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	region23.start_addr = 0x50000;
-	region23.length = 16;
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[2].regions = &region23;
-	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA384_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH;
-	hash2[2].hash_type = HASH_TYPE_SHA256;
-	hash2[2].always_validate = 1;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = hash2;
-	list2.images_sig = NULL;
-	list2.count = 3;
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_validate_flash (
-	CuTest *test)
+static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
 {
-	struct flash_region region11;
-	struct flash_region region12;
-	struct flash_region region13;
-	struct pfm_image_hash hash1[3];
-	struct pfm_image_list list1;
-	struct flash_region region21;
-	struct flash_region region22;
-	struct flash_region region23;
-	struct pfm_image_hash hash2[3];
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
-	region11.start_addr = 0x10000;
-	region11.length = 0x100;
-
-	hash1[0].regions = &region11;
-	hash1[0].count = 1;
-	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1[0].hash_length = SHA256_HASH_LENGTH;
-	hash1[0].hash_type = HASH_TYPE_SHA256;
-	hash1[0].always_validate = 1;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	region12.start_addr = 0x30000;
-	region12.length = 32;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[1].regions = &region12;
-	hash1[1].count = 1;
-	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[1].hash_length = SHA256_HASH_LENGTH;
-	hash1[1].hash_type = HASH_TYPE_SHA256;
-	hash1[1].always_validate = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	region13.start_addr = 0x50000;
-	region13.length = 16;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[2].regions = &region13;
-	hash1[2].count = 1;
-	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[2].hash_length = SHA256_HASH_LENGTH;
-	hash1[2].hash_type = HASH_TYPE_SHA256;
-	hash1[2].always_validate = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_hash = hash1;
-	list1.images_sig = NULL;
-	list1.count = 3;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	region21.start_addr = 0x10000;
-	region21.length = 0x100;
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[0].regions = &region21;
-	hash2[0].count = 1;
-	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2[0].hash_length = SHA256_HASH_LENGTH;
-	hash2[0].hash_type = HASH_TYPE_SHA256;
-	hash2[0].always_validate = 1;
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
 
-	region22.start_addr = 0x30000;
-	region22.length = 32;
+	rw_prop.on_failure = PFM_RW_ERASE;
 
-	hash2[1].regions = &region22;
-	hash2[1].count = 1;
-	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 0;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	region23.start_addr = 0x50000;
-	region23.length = 16;
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[2].regions = &region23;
-	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH;
-	hash2[2].hash_type = HASH_TYPE_SHA256;
-	hash2[2].always_validate = 1;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = hash2;
-	list2.images_sig = NULL;
-	list2.count = 3;
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_region_addr (
-	CuTest *test)
+static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 {
-	struct flash_region region11;
-	struct flash_region region12;
-	struct flash_region region13;
-	struct pfm_image_hash hash1[3];
-	struct pfm_image_list list1;
-	struct flash_region region21;
-	struct flash_region region22;
-	struct flash_region region23;
-	struct pfm_image_hash hash2[3];
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	uint8_t data[0x10000];
+	size_t i;
 
 	TEST_START;
 
-	region11.start_addr = 0x10000;
-	region11.length = 0x100;
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
 
-	hash1[0].regions = &region11;
-	hash1[0].count = 1;
-	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1[0].hash_length = SHA256_HASH_LENGTH;
-	hash1[0].hash_type = HASH_TYPE_SHA256;
-	hash1[0].always_validate = 1;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	region12.start_addr = 0x30000;
-	region12.length = 32;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[1].regions = &region12;
-	hash1[1].count = 1;
-	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[1].hash_length = SHA256_HASH_LENGTH;
-	hash1[1].hash_type = HASH_TYPE_SHA256;
-	hash1[1].always_validate = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	region13.start_addr = 0x50000;
-	region13.length = 16;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[2].regions = &region13;
-	hash1[2].count = 1;
-	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[2].hash_length = SHA256_HASH_LENGTH;
-	hash1[2].hash_type = HASH_TYPE_SHA256;
-	hash1[2].always_validate = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_hash = hash1;
-	list1.images_sig = NULL;
-	list1.count = 3;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	region21.start_addr = 0x10000;
-	region21.length = 0x100;
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, 0x10000);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
+		0x10000, data, sizeof (data));
 
-	hash2[0].regions = &region21;
-	hash2[0].count = 1;
-	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2[0].hash_length = SHA256_HASH_LENGTH;
-	hash2[0].hash_type = HASH_TYPE_SHA256;
-	hash2[0].always_validate = 1;
+	CuAssertIntEquals (test, 0, status);
 
-	region22.start_addr = 0x30000;
-	region22.length = 32;
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
 
-	hash2[1].regions = &region22;
-	hash2[1].count = 1;
-	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 1;
+	rw_prop.on_failure = PFM_RW_RESTORE;
 
-	region23.start_addr = 0x80000;
-	region23.length = 16;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	hash2[2].regions = &region23;
-	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH;
-	hash2[2].hash_type = HASH_TYPE_SHA256;
-	hash2[2].always_validate = 1;
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = hash2;
-	list2.images_sig = NULL;
-	list2.count = 3;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_region_length (
-	CuTest *test)
+static void host_fw_restore_read_write_data_test_restore_flash_no_source_device (CuTest *test)
 {
-	struct flash_region region11;
-	struct flash_region region12;
-	struct flash_region region13;
-	struct pfm_image_hash hash1[3];
-	struct pfm_image_list list1;
-	struct flash_region region21;
-	struct flash_region region22;
-	struct flash_region region23;
-	struct pfm_image_hash hash2[3];
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
-	region11.start_addr = 0x10000;
-	region11.length = 0x100;
-
-	hash1[0].regions = &region11;
-	hash1[0].count = 1;
-	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1[0].hash_length = SHA256_HASH_LENGTH;
-	hash1[0].hash_type = HASH_TYPE_SHA256;
-	hash1[0].always_validate = 1;
-
-	region12.start_addr = 0x30000;
-	region12.length = 32;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[1].regions = &region12;
-	hash1[1].count = 1;
-	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[1].hash_length = SHA256_HASH_LENGTH;
-	hash1[1].hash_type = HASH_TYPE_SHA256;
-	hash1[1].always_validate = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	region13.start_addr = 0x50000;
-	region13.length = 16;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[2].regions = &region13;
-	hash1[2].count = 1;
-	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[2].hash_length = SHA256_HASH_LENGTH;
-	hash1[2].hash_type = HASH_TYPE_SHA256;
-	hash1[2].always_validate = 1;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_hash = hash1;
-	list1.images_sig = NULL;
-	list1.count = 3;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	region21.start_addr = 0x10000;
-	region21.length = 0x100;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[0].regions = &region21;
-	hash2[0].count = 1;
-	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2[0].hash_length = SHA256_HASH_LENGTH;
-	hash2[0].hash_type = HASH_TYPE_SHA256;
-	hash2[0].always_validate = 1;
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
 
-	region22.start_addr = 0x30000;
-	region22.length = 48;
+	rw_prop.on_failure = PFM_RW_RESTORE;
 
-	hash2[1].regions = &region22;
-	hash2[1].count = 1;
-	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 1;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	region23.start_addr = 0x50000;
-	region23.length = 16;
+	status = host_fw_restore_read_write_data (&flash2, NULL, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[2].regions = &region23;
-	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH;
-	hash2[2].hash_type = HASH_TYPE_SHA256;
-	hash2[2].always_validate = 1;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = hash2;
-	list2.images_sig = NULL;
-	list2.count = 3;
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_different_auth_types (CuTest *test)
+static void host_fw_restore_read_write_data_test_reserved (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_hash hash2;
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2.regions = &region2;
-	hash2.count = 1;
-	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2.hash_length = SHA256_HASH_LENGTH;
-	hash2.hash_type = HASH_TYPE_SHA256;
-	hash2.always_validate = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = &hash2;
-	list2.images_sig = NULL;
-	list2.count = 1;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_RESERVED;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_different_auth_types_hash_first (CuTest *test)
+static void host_fw_restore_read_write_data_test_multiple_regions (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_hash hash1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region[4];
+	struct pfm_read_write rw_prop[4];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	uint8_t data[0x10000];
+	size_t i;
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
-
-	hash1.regions = &region1;
-	hash1.count = 1;
-	memcpy (hash1.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1.hash_length = SHA256_HASH_LENGTH;
-	hash1.hash_type = HASH_TYPE_SHA256;
-	hash1.always_validate = 1;
-
-	list1.images_hash = &hash1;
-	list1.images_sig = NULL;
-	list1.count = 1;
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
-}
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-static void host_fw_are_images_different_test_null (CuTest *test)
-{
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	TEST_START;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	for (i = 0; i < 3; i++) {
+		status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000 + (0x10000 * i));
+	}
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x40000, 0x30000);
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x100000, 0x10000);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x100000,
+		0x100000, data, sizeof (data));
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	CuAssertIntEquals (test, 0, status);
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	rw_region[0].start_addr = 0;
+	rw_region[0].length = 0x10000;
+	rw_region[1].start_addr = 0x40000;
+	rw_region[1].length = 0x30000;
+	rw_region[2].start_addr = 0x100000;
+	rw_region[2].length = 0x10000;
+	rw_region[3].start_addr = 0x500000;
+	rw_region[3].length = 0x100000;
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_ERASE;
+	rw_prop[2].on_failure = PFM_RW_RESTORE;
+	rw_prop[3].on_failure = PFM_RW_RESERVED;
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 4;
 
-	status = host_fw_are_images_different (&list1, NULL);
-	CuAssertIntEquals (test, true, status);
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (NULL, &list2);
-	CuAssertIntEquals (test, true, status);
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (NULL, NULL);
-	CuAssertIntEquals (test, false, status);
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_do_nothing (CuTest *test)
+static void host_fw_restore_read_write_data_test_null (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -11645,8 +12614,11 @@ static void host_fw_restore_read_write_data_test_do_nothing (CuTest *test)
 	rw_list.properties = &rw_prop;
 	rw_list.count = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_restore_read_write_data (NULL, &flash1, &rw_list);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+
+	status = host_fw_restore_read_write_data (&flash2, &flash1, NULL);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -11658,7 +12630,7 @@ static void host_fw_restore_read_write_data_test_do_nothing (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
+static void host_fw_restore_read_write_data_test_erase_flash_error (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -11691,7 +12663,8 @@ static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, 0x10000);
+	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
 	CuAssertIntEquals (test, 0, status);
 
 	rw_region.start_addr = 0x10000;
@@ -11704,7 +12677,7 @@ static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
 	rw_list.count = 1;
 
 	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -11716,7 +12689,7 @@ static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
+static void host_fw_restore_read_write_data_test_restore_flash_error (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -11728,15 +12701,9 @@ static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
-	uint8_t data[0x10000];
-	size_t i;
 
 	TEST_START;
 
-	for (i = 0; i < sizeof (data); i++) {
-		data[i] = i;
-	}
-
 	status = flash_master_mock_init (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
@@ -11755,10 +12722,8 @@ static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, 0x10000);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
-		0x10000, data, sizeof (data));
-
+	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
 	CuAssertIntEquals (test, 0, status);
 
 	rw_region.start_addr = 0x10000;
@@ -11771,7 +12736,7 @@ static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 	rw_list.count = 1;
 
 	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -11783,10 +12748,10 @@ static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_restore_flash_no_source_device (CuTest *test)
+static void host_fw_restore_read_write_data_test_multiple_regions_error (CuTest *test)
 {
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
+	struct flash_region rw_region[4];
+	struct pfm_read_write rw_prop[4];
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
@@ -11816,17 +12781,30 @@ static void host_fw_restore_read_write_data_test_restore_flash_no_source_device
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_prop.on_failure = PFM_RW_RESTORE;
+	rw_region[0].start_addr = 0;
+	rw_region[0].length = 0x10000;
+	rw_region[1].start_addr = 0x40000;
+	rw_region[1].length = 0x30000;
+	rw_region[2].start_addr = 0x100000;
+	rw_region[2].length = 0x10000;
+	rw_region[3].start_addr = 0x500000;
+	rw_region[3].length = 0x100000;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_ERASE;
+	rw_prop[2].on_failure = PFM_RW_RESTORE;
+	rw_prop[3].on_failure = PFM_RW_RESERVED;
 
-	status = host_fw_restore_read_write_data (&flash2, NULL, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 4;
+
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -11838,387 +12816,582 @@ static void host_fw_restore_read_write_data_test_restore_flash_no_source_device
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_reserved (CuTest *test)
+static void host_fw_verify_images_multiple_fw_test (CuTest *test)
+{
+	struct flash_region region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
+
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	list.images_sig = &sig;
+	list.images_hash = NULL;
+	list.count = 1;
+
+	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
+}
+
+static void host_fw_verify_images_multiple_fw_test_invalid (CuTest *test)
+{
+	struct flash_region region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
+
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	list.images_sig = &sig;
+	list.images_hash = NULL;
+	list.count = 1;
+
+	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
+}
+
+static void host_fw_verify_images_multiple_fw_test_multiple (CuTest *test)
 {
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
-	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region region[3];
+	struct pfm_image_signature sig[3];
+	struct pfm_image_list list[3];
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_init (&flash_mock2);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
+
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	rw_prop.on_failure = PFM_RW_RESERVED;
+	sig[0].regions = &region[0];
+	sig[0].count = 1;
+	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig[0].sig_length = RSA_ENCRYPT_LEN;
+	sig[0].always_validate = 1;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	sig[1].regions = &region[1];
+	sig[1].count = 1;
+	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig[1].sig_length = RSA_ENCRYPT_LEN;
+	sig[1].always_validate = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	sig[2].regions = &region[2];
+	sig[2].count = 1;
+	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
+	sig[2].sig_length = RSA_ENCRYPT_LEN;
+	sig[2].always_validate = 1;
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	list[0].images_sig = &sig[0];
+	list[0].images_hash = NULL;
+	list[0].count = 1;
+
+	list[1].images_sig = &sig[1];
+	list[1].images_hash = NULL;
+	list[1].count = 1;
+
+	list[2].images_sig = &sig[2];
+	list[2].images_hash = NULL;
+	list[2].count = 1;
+
+	status = host_fw_verify_images_multiple_fw (&flash, list, 3, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_restore_read_write_data_test_multiple_regions (CuTest *test)
+static void host_fw_verify_images_multiple_fw_test_hashes (CuTest *test)
 {
-	struct flash_region rw_region[4];
-	struct pfm_read_write rw_prop[4];
-	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
-	uint8_t data[0x10000];
-	size_t i;
+	char *data = "Test";
 
 	TEST_START;
 
-	for (i = 0; i < sizeof (data); i++) {
-		data[i] = i;
-	}
-
-	status = flash_master_mock_init (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock2);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	for (i = 0; i < 3; i++) {
-		status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000 + (0x10000 * i));
-	}
-	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x40000, 0x30000);
-
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x100000, 0x10000);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x100000,
-		0x100000, data, sizeof (data));
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region[0].start_addr = 0;
-	rw_region[0].length = 0x10000;
-	rw_region[1].start_addr = 0x40000;
-	rw_region[1].length = 0x30000;
-	rw_region[2].start_addr = 0x100000;
-	rw_region[2].length = 0x10000;
-	rw_region[3].start_addr = 0x500000;
-	rw_region[3].length = 0x100000;
-
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_ERASE;
-	rw_prop[2].on_failure = PFM_RW_RESTORE;
-	rw_prop[3].on_failure = PFM_RW_RESERVED;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 4;
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	list.images_hash = &img_hash;
+	list.images_sig = NULL;
+	list.count = 1;
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_restore_read_write_data_test_null (CuTest *test)
+static void host_fw_verify_images_multiple_fw_test_hashes_invalid (CuTest *test)
 {
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
-	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data = "Test";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock2);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	CuAssertIntEquals (test, 0, status);
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	status = host_fw_restore_read_write_data (NULL, &flash1, &rw_list);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, NULL);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	list.images_hash = &img_hash;
+	list.images_sig = NULL;
+	list.count = 1;
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_restore_read_write_data_test_erase_flash_error (CuTest *test)
+static void host_fw_verify_images_multiple_fw_test_hashes_multiple (CuTest *test)
 {
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
-	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region region[3];
+	struct pfm_image_hash img_hash[3];
+	struct pfm_image_list list[3];
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data1 = "Test";
+	char *data2 = "Test2";
+	char *data3 = "Nope";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_init (&flash_mock2);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
 
-	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
+
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	region[0].start_addr = 0x10000;
+	region[0].length = strlen (data1);
+	region[1].start_addr = 0x20000;
+	region[1].length = strlen (data2);
+	region[2].start_addr = 0x30000;
+	region[2].length = strlen (data3);
 
-	rw_prop.on_failure = PFM_RW_ERASE;
+	img_hash[0].regions = &region[0];
+	img_hash[0].count = 1;
+	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash[0].hash_length = SHA256_HASH_LENGTH;
+	img_hash[0].hash_type = HASH_TYPE_SHA256;
+	img_hash[0].always_validate = 1;
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	img_hash[1].regions = &region[1];
+	img_hash[1].count = 1;
+	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
+	img_hash[1].hash_length = SHA384_HASH_LENGTH;
+	img_hash[1].hash_type = HASH_TYPE_SHA384;
+	img_hash[1].always_validate = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	img_hash[2].regions = &region[2];
+	img_hash[2].count = 1;
+	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
+	img_hash[2].hash_length = SHA512_HASH_LENGTH;
+	img_hash[2].hash_type = HASH_TYPE_SHA512;
+	img_hash[2].always_validate = 1;
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	list[0].images_hash = &img_hash[0];
+	list[0].images_sig = NULL;
+	list[0].count = 1;
+
+	list[1].images_hash = &img_hash[1];
+	list[1].images_sig = NULL;
+	list[1].count = 1;
+
+	list[2].images_hash = &img_hash[2];
+	list[2].images_sig = NULL;
+	list[2].count = 1;
+
+	status = host_fw_verify_images_multiple_fw (&flash, list, 3, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_restore_read_write_data_test_restore_flash_error (CuTest *test)
+static void host_fw_verify_images_multiple_fw_test_null (CuTest *test)
 {
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
-	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data = "Test";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_init (&flash_mock2);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_STATUS_REG);
-	CuAssertIntEquals (test, 0, status);
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	list.images_sig = &sig;
+	list.images_hash = NULL;
+	list.count = 1;
 
-	rw_prop.on_failure = PFM_RW_RESTORE;
+	status = host_fw_verify_images_multiple_fw (NULL, &list, 1, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	status = host_fw_verify_images_multiple_fw (&flash, NULL, 1, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, NULL, &rsa.base);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, NULL);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_restore_read_write_data_test_multiple_regions_error (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_test (CuTest *test)
 {
-	struct flash_region rw_region[4];
-	struct pfm_read_write rw_prop[4];
-	struct pfm_read_write_regions rw_list;
-	struct flash_master_mock flash_mock1;
-	struct spi_flash_state state1;
-	struct spi_flash flash1;
-	struct flash_master_mock flash_mock2;
-	struct spi_flash_state state2;
-	struct spi_flash flash2;
+	struct flash_region region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
 	int status;
+	char *data = "Test";
 
 	TEST_START;
 
-	status = flash_master_mock_init (&flash_mock1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock2);
+	status = HASH_TESTING_ENGINE_INIT (&hash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	CuAssertIntEquals (test, 0, status);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
-	rw_region[0].start_addr = 0;
-	rw_region[0].length = 0x10000;
-	rw_region[1].start_addr = 0x40000;
-	rw_region[1].length = 0x30000;
-	rw_region[2].start_addr = 0x100000;
-	rw_region[2].length = 0x10000;
-	rw_region[3].start_addr = 0x500000;
-	rw_region[3].length = 0x100000;
+	CuAssertIntEquals (test, 0, status);
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_ERASE;
-	rw_prop[2].on_failure = PFM_RW_RESTORE;
-	rw_prop[3].on_failure = PFM_RW_RESERVED;
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 4;
+	sig.regions = &region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	list.images_sig = &sig;
+	list.images_hash = NULL;
+	list.count = 1;
 
-	status = flash_master_mock_validate_and_release (&flash_mock1);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock2);
+	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_release (&flash1);
-	spi_flash_release (&flash2);
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_multiple_fw_test (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_test_no_offset (CuTest *test)
 {
 	struct flash_region region;
 	struct pfm_image_signature sig;
@@ -12269,7 +13442,7 @@ static void host_fw_verify_images_multiple_fw_test (CuTest *test)
 	list.images_hash = NULL;
 	list.count = 1;
 
-	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, &rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -12280,7 +13453,7 @@ static void host_fw_verify_images_multiple_fw_test (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_multiple_fw_test_invalid (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_test_invalid (CuTest *test)
 {
 	struct flash_region region;
 	struct pfm_image_signature sig;
@@ -12313,7 +13486,7 @@ static void host_fw_verify_images_multiple_fw_test_invalid (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -12331,7 +13504,8 @@ static void host_fw_verify_images_multiple_fw_test_invalid (CuTest *test)
 	list.images_hash = NULL;
 	list.count = 1;
 
-	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, &rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -12342,7 +13516,7 @@ static void host_fw_verify_images_multiple_fw_test_invalid (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_multiple_fw_test_multiple (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_test_multiple (CuTest *test)
 {
 	struct flash_region region[3];
 	struct pfm_image_signature sig[3];
@@ -12377,17 +13551,17 @@ static void host_fw_verify_images_multiple_fw_test_multiple (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
 
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
+		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
 
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
+		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -12431,7 +13605,8 @@ static void host_fw_verify_images_multiple_fw_test_multiple (CuTest *test)
 	list[2].images_hash = NULL;
 	list[2].count = 1;
 
-	status = host_fw_verify_images_multiple_fw (&flash, list, 3, &hash.base, &rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, list, 3, 0x400000, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -12442,7 +13617,7 @@ static void host_fw_verify_images_multiple_fw_test_multiple (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_multiple_fw_test_hashes (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_test_hashes (CuTest *test)
 {
 	struct flash_region region;
 	struct pfm_image_hash img_hash;
@@ -12475,7 +13650,7 @@ static void host_fw_verify_images_multiple_fw_test_hashes (CuTest *test)
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -12493,7 +13668,8 @@ static void host_fw_verify_images_multiple_fw_test_hashes (CuTest *test)
 	list.images_sig = NULL;
 	list.count = 1;
 
-	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, &rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -12504,7 +13680,7 @@ static void host_fw_verify_images_multiple_fw_test_hashes (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_multiple_fw_test_hashes_invalid (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_test_hashes_no_offset (CuTest *test)
 {
 	struct flash_region region;
 	struct pfm_image_hash img_hash;
@@ -12544,6 +13720,68 @@ static void host_fw_verify_images_multiple_fw_test_hashes_invalid (CuTest *test)
 	region.start_addr = 0x10000;
 	region.length = strlen (data);
 
+	img_hash.regions = &region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
+
+	list.images_hash = &img_hash;
+	list.images_sig = NULL;
+	list.count = 1;
+
+	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0, &hash.base, &rsa.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
+}
+
+static void host_fw_verify_offset_images_multiple_fw_test_hashes_invalid (CuTest *test)
+{
+	struct flash_region region;
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	region.start_addr = 0x10000;
+	region.length = strlen (data);
+
 	img_hash.regions = &region;
 	img_hash.count = 1;
 	memcpy (img_hash.hash, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
@@ -12555,7 +13793,8 @@ static void host_fw_verify_images_multiple_fw_test_hashes_invalid (CuTest *test)
 	list.images_sig = NULL;
 	list.count = 1;
 
-	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, &rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -12566,7 +13805,7 @@ static void host_fw_verify_images_multiple_fw_test_hashes_invalid (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_multiple_fw_test_hashes_multiple (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_test_hashes_multiple (CuTest *test)
 {
 	struct flash_region region[3];
 	struct pfm_image_hash img_hash[3];
@@ -12601,17 +13840,17 @@ static void host_fw_verify_images_multiple_fw_test_hashes_multiple (CuTest *test
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data1)));
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
 
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x20000, 0, -1, strlen (data2)));
+		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
 
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x30000, 0, -1, strlen (data3)));
+		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -12655,7 +13894,8 @@ static void host_fw_verify_images_multiple_fw_test_hashes_multiple (CuTest *test
 	list[2].images_sig = NULL;
 	list[2].count = 1;
 
-	status = host_fw_verify_images_multiple_fw (&flash, list, 3, &hash.base, &rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, list, 3, 0x400000, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -12666,7 +13906,7 @@ static void host_fw_verify_images_multiple_fw_test_hashes_multiple (CuTest *test
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_images_multiple_fw_test_null (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_test_null (CuTest *test)
 {
 	struct flash_region region;
 	struct pfm_image_signature sig;
@@ -12710,16 +13950,20 @@ static void host_fw_verify_images_multiple_fw_test_null (CuTest *test)
 	list.images_hash = NULL;
 	list.count = 1;
 
-	status = host_fw_verify_images_multiple_fw (NULL, &list, 1, &hash.base, &rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw (NULL, &list, 1, 0x400000, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_verify_images_multiple_fw (&flash, NULL, 1, &hash.base, &rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, NULL, 1, 0x400000, &hash.base,
+		&rsa.base);
 	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, NULL, &rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, NULL,
+		&rsa.base);
 	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_verify_images_multiple_fw (&flash, &list, 1, &hash.base, NULL);
+	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
+		NULL);
 	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -12730,79 +13974,49 @@ static void host_fw_verify_images_multiple_fw_test_null (CuTest *test)
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_multiple_fw_test (CuTest *test)
+/**
+ * Initialize a list of firmware components that each contain a single signed image.
+ *
+ * @param region Regions for each image.
+ * @param sig Signature information for each image.
+ * @param list The list of firmware components to initialize.
+ * @param count The number of firmware components.
+ * @param data The data contained in each image.
+ */
+static void host_fw_util_testing_init_image_list (struct flash_region *region,
+	struct pfm_image_signature *sig, struct pfm_image_list *list, size_t count, const char *data)
 {
-	struct flash_region region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list list;
-	struct flash_master_mock flash_mock;
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
-	int status;
-	char *data = "Test";
-
-	TEST_START;
-
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_init (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &flash_mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
-
-	CuAssertIntEquals (test, 0, status);
-
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
-
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
-
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	size_t i;
 
-	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, 0, status);
+	for (i = 0; i < count; i++) {
+		region[i].start_addr = 0x10000 * (i + 1);
+		region[i].length = strlen (data);
 
-	status = flash_master_mock_validate_and_release (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
+		sig[i].regions = &region[i];
+		sig[i].count = 1;
+		memcpy (&sig[i].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+		memcpy (&sig[i].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+		sig[i].sig_length = RSA_ENCRYPT_LEN;
+		sig[i].always_validate = 1;
 
-	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
+		list[i].images_sig = &sig[i];
+		list[i].images_hash = NULL;
+		list[i].count = 1;
+	}
 }
 
-static void host_fw_verify_offset_images_multiple_fw_test_no_offset (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_parallel_test (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list list;
+	struct flash_region region[5];
+	struct pfm_image_signature sig[5];
+	struct pfm_image_list list[5];
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
+	struct host_fw_verify_worker_mock worker[2];
+	struct host_fw_verify_worker *workers[2] = {&worker[0].base, &worker[1].base};
 	int status;
 	char *data = "Test";
 
@@ -12823,115 +14037,69 @@ static void host_fw_verify_offset_images_multiple_fw_test_no_offset (CuTest *tes
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
-
-	CuAssertIntEquals (test, 0, status);
-
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
-
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
-
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
-
-	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0, &hash.base, &rsa.base);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_master_mock_validate_and_release (&flash_mock);
-	CuAssertIntEquals (test, 0, status);
-
-	spi_flash_release (&flash);
-	HASH_TESTING_ENGINE_RELEASE (&hash);
-	RSA_TESTING_ENGINE_RELEASE (&rsa);
-}
-
-static void host_fw_verify_offset_images_multiple_fw_test_invalid (CuTest *test)
-{
-	struct flash_region region;
-	struct pfm_image_signature sig;
-	struct pfm_image_list list;
-	struct flash_master_mock flash_mock;
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	HASH_TESTING_ENGINE hash;
-	RSA_TESTING_ENGINE rsa;
-	int status;
-	char *data = "Test";
-
-	TEST_START;
-
-	status = HASH_TESTING_ENGINE_INIT (&hash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	status = host_fw_verify_worker_mock_init (&worker[0]);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_init (&flash_mock);
+	status = host_fw_verify_worker_mock_init (&worker[1]);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init (&flash, &state, &flash_mock.base);
-	CuAssertIntEquals (test, 0, status);
+	host_fw_util_testing_init_image_list (region, sig, list, 5, data);
 
-	status = spi_flash_set_device_size (&flash, 0x1000000);
-	CuAssertIntEquals (test, 0, status);
+	status = mock_expect (&worker[0].mock, worker[0].base.start_verification, &worker[0], 0,
+		MOCK_ARG (&flash), MOCK_ARG (&list[1]), MOCK_ARG (0x400000));
+	status |= mock_expect (&worker[1].mock, worker[1].base.start_verification, &worker[1], 0,
+		MOCK_ARG (&flash), MOCK_ARG (&list[2]), MOCK_ARG (0x400000));
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
 		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&worker[0].mock, worker[0].base.get_verification_result, &worker[0], 0);
+	status |= mock_expect (&worker[1].mock, worker[1].base.get_verification_result, &worker[1], 0);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	status |= mock_expect (&worker[0].mock, worker[0].base.start_verification, &worker[0], 0,
+		MOCK_ARG (&flash), MOCK_ARG (&list[4]), MOCK_ARG (0x400000));
 
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x440000, 0, -1, strlen (data)));
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	status |= mock_expect (&worker[0].mock, worker[0].base.get_verification_result, &worker[0], 0);
 
-	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_offset_images_multiple_fw_parallel (&flash, list, 5, 0x400000,
+		&hash.base, &rsa.base, workers, 2);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[1]);
+	CuAssertIntEquals (test, 0, status);
+
 	spi_flash_release (&flash);
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_multiple_fw_test_multiple (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_parallel_test_no_workers (CuTest *test)
 {
-	struct flash_region region[3];
-	struct pfm_image_signature sig[3];
-	struct pfm_image_list list[3];
+	struct flash_region region[2];
+	struct pfm_image_signature sig[2];
+	struct pfm_image_list list[2];
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -12950,65 +14118,22 @@ static void host_fw_verify_offset_images_multiple_fw_test_multiple (CuTest *test
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
+	host_fw_util_testing_init_image_list (region, sig, list, 2, data);
 
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	sig[0].regions = &region[0];
-	sig[0].count = 1;
-	memcpy (&sig[0].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig[0].sig_length = RSA_ENCRYPT_LEN;
-	sig[0].always_validate = 1;
-
-	sig[1].regions = &region[1];
-	sig[1].count = 1;
-	memcpy (&sig[1].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[1].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig[1].sig_length = RSA_ENCRYPT_LEN;
-	sig[1].always_validate = 1;
-
-	sig[2].regions = &region[2];
-	sig[2].count = 1;
-	memcpy (&sig[2].key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig[2].signature, RSA_SIGNATURE_NOPE, RSA_ENCRYPT_LEN);
-	sig[2].sig_length = RSA_ENCRYPT_LEN;
-	sig[2].always_validate = 1;
-
-	list[0].images_sig = &sig[0];
-	list[0].images_hash = NULL;
-	list[0].count = 1;
-
-	list[1].images_sig = &sig[1];
-	list[1].images_hash = NULL;
-	list[1].count = 1;
-
-	list[2].images_sig = &sig[2];
-	list[2].images_hash = NULL;
-	list[2].count = 1;
-
-	status = host_fw_verify_offset_images_multiple_fw (&flash, list, 3, 0x400000, &hash.base,
-		&rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw_parallel (&flash, list, 2, 0x400000,
+		&hash.base, &rsa.base, NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -13019,16 +14144,18 @@ static void host_fw_verify_offset_images_multiple_fw_test_multiple (CuTest *test
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_multiple_fw_test_hashes (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_parallel_test_single_fw (CuTest *test)
 {
 	struct flash_region region;
-	struct pfm_image_hash img_hash;
+	struct pfm_image_signature sig;
 	struct pfm_image_list list;
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
+	struct host_fw_verify_worker_mock worker;
+	struct host_fw_verify_worker *workers[1] = {&worker.base};
 	int status;
 	char *data = "Test";
 
@@ -13049,6 +14176,11 @@ static void host_fw_verify_offset_images_multiple_fw_test_hashes (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = host_fw_verify_worker_mock_init (&worker);
+	CuAssertIntEquals (test, 0, status);
+
+	host_fw_util_testing_init_image_list (&region, &sig, &list, 1, data);
+
 	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
@@ -13056,42 +14188,33 @@ static void host_fw_verify_offset_images_multiple_fw_test_hashes (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
-
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
-	img_hash.always_validate = 1;
-
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
-
-	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
-		&rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw_parallel (&flash, &list, 1, 0x400000,
+		&hash.base, &rsa.base, workers, 1);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
+	status = host_fw_verify_worker_mock_validate_and_release (&worker);
+	CuAssertIntEquals (test, 0, status);
+
 	spi_flash_release (&flash);
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_multiple_fw_test_hashes_no_offset (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_parallel_test_invalid (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
-	struct pfm_image_list list;
+	struct flash_region region[3];
+	struct pfm_image_signature sig[3];
+	struct pfm_image_list list[3];
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
+	struct host_fw_verify_worker_mock worker[2];
+	struct host_fw_verify_worker *workers[2] = {&worker[0].base, &worker[1].base};
 	int status;
 	char *data = "Test";
 
@@ -13112,48 +14235,61 @@ static void host_fw_verify_offset_images_multiple_fw_test_hashes_no_offset (CuTe
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, strlen (data)));
+	status = host_fw_verify_worker_mock_init (&worker[0]);
+	CuAssertIntEquals (test, 0, status);
 
+	status = host_fw_verify_worker_mock_init (&worker[1]);
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	host_fw_util_testing_init_image_list (region, sig, list, 3, data);
+	memcpy (&sig[0].signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
-	img_hash.always_validate = 1;
+	status = mock_expect (&worker[0].mock, worker[0].base.start_verification, &worker[0], 0,
+		MOCK_ARG (&flash), MOCK_ARG (&list[1]), MOCK_ARG (0x400000));
+	status |= mock_expect (&worker[1].mock, worker[1].base.start_verification, &worker[1], 0,
+		MOCK_ARG (&flash), MOCK_ARG (&list[2]), MOCK_ARG (0x400000));
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
+
+	status |= mock_expect (&worker[0].mock, worker[0].base.get_verification_result, &worker[0],
+		HOST_FW_UTIL_BAD_IMAGE_HASH);
+	status |= mock_expect (&worker[1].mock, worker[1].base.get_verification_result, &worker[1], 0);
 
-	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0, &hash.base, &rsa.base);
 	CuAssertIntEquals (test, 0, status);
 
+	status = host_fw_verify_offset_images_multiple_fw_parallel (&flash, list, 3, 0x400000,
+		&hash.base, &rsa.base, workers, 2);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[1]);
+	CuAssertIntEquals (test, 0, status);
+
 	spi_flash_release (&flash);
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_multiple_fw_test_hashes_invalid (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_parallel_test_worker_invalid (CuTest *test)
 {
-	struct flash_region region;
-	struct pfm_image_hash img_hash;
-	struct pfm_image_list list;
+	struct flash_region region[5];
+	struct pfm_image_signature sig[5];
+	struct pfm_image_list list[5];
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
+	struct host_fw_verify_worker_mock worker[2];
+	struct host_fw_verify_worker *workers[2] = {&worker[0].base, &worker[1].base};
 	int status;
 	char *data = "Test";
 
@@ -13174,32 +14310,42 @@ static void host_fw_verify_offset_images_multiple_fw_test_hashes_invalid (CuTest
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+	status = host_fw_verify_worker_mock_init (&worker[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_mock_init (&worker[1]);
+	CuAssertIntEquals (test, 0, status);
+
+	host_fw_util_testing_init_image_list (region, sig, list, 5, data);
+
+	status = mock_expect (&worker[0].mock, worker[0].base.start_verification, &worker[0], 0,
+		MOCK_ARG (&flash), MOCK_ARG (&list[1]), MOCK_ARG (0x400000));
+	status |= mock_expect (&worker[1].mock, worker[1].base.start_verification, &worker[1], 0,
+		MOCK_ARG (&flash), MOCK_ARG (&list[2]), MOCK_ARG (0x400000));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
 		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&worker[0].mock, worker[0].base.get_verification_result, &worker[0],
+		RSA_ENGINE_BAD_SIGNATURE);
+	status |= mock_expect (&worker[1].mock, worker[1].base.get_verification_result, &worker[1],
+		HOST_FW_UTIL_BAD_IMAGE_HASH);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
+	CuAssertIntEquals (test, 0, status);
 
-	img_hash.regions = &region;
-	img_hash.count = 1;
-	memcpy (img_hash.hash, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
-	img_hash.hash_length = SHA256_HASH_LENGTH;
-	img_hash.hash_type = HASH_TYPE_SHA256;
-	img_hash.always_validate = 1;
+	status = host_fw_verify_offset_images_multiple_fw_parallel (&flash, list, 5, 0x400000,
+		&hash.base, &rsa.base, workers, 2);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
 
-	list.images_hash = &img_hash;
-	list.images_sig = NULL;
-	list.count = 1;
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
-		&rsa.base);
-	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[0]);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock);
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[1]);
 	CuAssertIntEquals (test, 0, status);
 
 	spi_flash_release (&flash);
@@ -13207,20 +14353,20 @@ static void host_fw_verify_offset_images_multiple_fw_test_hashes_invalid (CuTest
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_multiple_fw_test_hashes_multiple (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_parallel_test_start_error (CuTest *test)
 {
 	struct flash_region region[3];
-	struct pfm_image_hash img_hash[3];
+	struct pfm_image_signature sig[3];
 	struct pfm_image_list list[3];
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
+	struct host_fw_verify_worker_mock worker[2];
+	struct host_fw_verify_worker *workers[2] = {&worker[0].base, &worker[1].base};
 	int status;
-	char *data1 = "Test";
-	char *data2 = "Test2";
-	char *data3 = "Nope";
+	char *data = "Test";
 
 	TEST_START;
 
@@ -13239,68 +14385,46 @@ static void host_fw_verify_offset_images_multiple_fw_test_hashes_multiple (CuTes
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data1, strlen (data1),
-		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data1)));
+	status = host_fw_verify_worker_mock_init (&worker[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_mock_init (&worker[1]);
+	CuAssertIntEquals (test, 0, status);
+
+	host_fw_util_testing_init_image_list (region, sig, list, 3, data);
+
+	status = mock_expect (&worker[0].mock, worker[0].base.start_verification, &worker[0], 0,
+		MOCK_ARG (&flash), MOCK_ARG (&list[1]), MOCK_ARG (0x400000));
+	status |= mock_expect (&worker[1].mock, worker[1].base.start_verification, &worker[1],
+		HOST_FW_VERIFY_WORKER_START_FAILED, MOCK_ARG (&flash), MOCK_ARG (&list[2]),
+		MOCK_ARG (0x400000));
 
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data2, strlen (data2),
-		FLASH_EXP_READ_CMD (0x03, 0x420000, 0, -1, strlen (data2)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x410000, 0, -1, strlen (data)));
+
+	status |= mock_expect (&worker[0].mock, worker[0].base.get_verification_result, &worker[0], 0);
 
+	/* The component that could not be started on a worker is verified by the caller. */
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data3, strlen (data3),
-		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data3)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x430000, 0, -1, strlen (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	region[0].start_addr = 0x10000;
-	region[0].length = strlen (data1);
-	region[1].start_addr = 0x20000;
-	region[1].length = strlen (data2);
-	region[2].start_addr = 0x30000;
-	region[2].length = strlen (data3);
-
-	img_hash[0].regions = &region[0];
-	img_hash[0].count = 1;
-	memcpy (img_hash[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	img_hash[0].hash_length = SHA256_HASH_LENGTH;
-	img_hash[0].hash_type = HASH_TYPE_SHA256;
-	img_hash[0].always_validate = 1;
-
-	img_hash[1].regions = &region[1];
-	img_hash[1].count = 1;
-	memcpy (img_hash[1].hash, SHA384_TEST2_HASH, SHA384_HASH_LENGTH);
-	img_hash[1].hash_length = SHA384_HASH_LENGTH;
-	img_hash[1].hash_type = HASH_TYPE_SHA384;
-	img_hash[1].always_validate = 1;
-
-	img_hash[2].regions = &region[2];
-	img_hash[2].count = 1;
-	memcpy (img_hash[2].hash, SHA512_NOPE_HASH, SHA512_HASH_LENGTH);
-	img_hash[2].hash_length = SHA512_HASH_LENGTH;
-	img_hash[2].hash_type = HASH_TYPE_SHA512;
-	img_hash[2].always_validate = 1;
-
-	list[0].images_hash = &img_hash[0];
-	list[0].images_sig = NULL;
-	list[0].count = 1;
-
-	list[1].images_hash = &img_hash[1];
-	list[1].images_sig = NULL;
-	list[1].count = 1;
+	status = host_fw_verify_offset_images_multiple_fw_parallel (&flash, list, 3, 0x400000,
+		&hash.base, &rsa.base, workers, 2);
+	CuAssertIntEquals (test, 0, status);
 
-	list[2].images_hash = &img_hash[2];
-	list[2].images_sig = NULL;
-	list[2].count = 1;
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_verify_offset_images_multiple_fw (&flash, list, 3, 0x400000, &hash.base,
-		&rsa.base);
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[0]);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&flash_mock);
+	status = host_fw_verify_worker_mock_validate_and_release (&worker[1]);
 	CuAssertIntEquals (test, 0, status);
 
 	spi_flash_release (&flash);
@@ -13308,7 +14432,7 @@ static void host_fw_verify_offset_images_multiple_fw_test_hashes_multiple (CuTes
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
-static void host_fw_verify_offset_images_multiple_fw_test_null (CuTest *test)
+static void host_fw_verify_offset_images_multiple_fw_parallel_test_null (CuTest *test)
 {
 	struct flash_region region;
 	struct pfm_image_signature sig;
@@ -13318,8 +14442,9 @@ static void host_fw_verify_offset_images_multiple_fw_test_null (CuTest *test)
 	struct spi_flash flash;
 	HASH_TESTING_ENGINE hash;
 	RSA_TESTING_ENGINE rsa;
+	struct host_fw_verify_worker_mock worker;
+	struct host_fw_verify_worker *workers[1] = {&worker.base};
 	int status;
-	char *data = "Test";
 
 	TEST_START;
 
@@ -13338,39 +14463,33 @@ static void host_fw_verify_offset_images_multiple_fw_test_null (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	region.start_addr = 0x10000;
-	region.length = strlen (data);
-
-	sig.regions = &region;
-	sig.count = 1;
-	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig.sig_length = RSA_ENCRYPT_LEN;
-	sig.always_validate = 1;
+	status = host_fw_verify_worker_mock_init (&worker);
+	CuAssertIntEquals (test, 0, status);
 
-	list.images_sig = &sig;
-	list.images_hash = NULL;
-	list.count = 1;
+	host_fw_util_testing_init_image_list (&region, &sig, &list, 1, "Test");
 
-	status = host_fw_verify_offset_images_multiple_fw (NULL, &list, 1, 0x400000, &hash.base,
-		&rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw_parallel (NULL, &list, 1, 0x400000,
+		&hash.base, &rsa.base, workers, 1);
 	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_verify_offset_images_multiple_fw (&flash, NULL, 1, 0x400000, &hash.base,
-		&rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw_parallel (&flash, NULL, 1, 0x400000,
+		&hash.base, &rsa.base, workers, 1);
 	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, NULL,
-		&rsa.base);
+	status = host_fw_verify_offset_images_multiple_fw_parallel (&flash, &list, 1, 0x400000,
+		NULL, &rsa.base, workers, 1);
 	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_verify_offset_images_multiple_fw (&flash, &list, 1, 0x400000, &hash.base,
-		NULL);
+	status = host_fw_verify_offset_images_multiple_fw_parallel (&flash, &list, 1, 0x400000,
+		&hash.base, NULL, workers, 1);
 	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
+	status = host_fw_verify_worker_mock_validate_and_release (&worker);
+	CuAssertIntEquals (test, 0, status);
+
 	spi_flash_release (&flash);
 	HASH_TESTING_ENGINE_RELEASE (&hash);
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
@@ -15373,7 +16492,7 @@ TEST (host_fw_determine_version_test_same_address_different_lengths_shorter);
 TEST (host_fw_determine_version_test_null);
 TEST (host_fw_determine_version_test_empty_list);
 TEST (host_fw_determine_version_test_read_fail);
-TEST (host_fw_determine_version_test_read_fail_cache_update);
+TEST (host_fw_determine_version_test_read_fail_same_address);
 TEST (host_fw_determine_offset_version_test);
 TEST (host_fw_determine_offset_version_test_no_match);
 TEST (host_fw_determine_offset_version_test_check_multiple);
@@ -15385,7 +16504,15 @@ TEST (host_fw_determine_offset_version_test_same_address_different_lengths_short
 TEST (host_fw_determine_offset_version_test_null);
 TEST (host_fw_determine_offset_version_test_empty_list);
 TEST (host_fw_determine_offset_version_test_read_fail);
-TEST (host_fw_determine_offset_version_test_read_fail_cache_update);
+TEST (host_fw_determine_offset_version_test_read_fail_same_address);
+TEST (host_fw_determine_version_test_many_versions_same_address);
+TEST (host_fw_determine_version_test_many_versions_same_address_prefix_priority);
+TEST (host_fw_determine_version_test_multiple_addresses_interleaved);
+TEST (host_fw_version_matcher_test_find_multiple_times);
+TEST (host_fw_version_matcher_test_init_null);
+TEST (host_fw_version_matcher_test_init_empty_list);
+TEST (host_fw_version_matcher_test_find_null);
+TEST (host_fw_version_matcher_test_release_null);
 TEST (host_fw_verify_images_test);
 TEST (host_fw_verify_images_test_invalid);
 TEST (host_fw_verify_images_test_not_contiguous);
@@ -15426,6 +16553,14 @@ TEST (host_fw_verify_offset_images_test_hashes_multiple_one_invalid);
 TEST (host_fw_verify_offset_images_test_hashes_partial_validation);
 TEST (host_fw_verify_offset_images_test_hashes_hash_error);
 TEST (host_fw_verify_offset_images_test_null);
+TEST (host_fw_region_map_init_test);
+TEST (host_fw_region_map_init_test_merge_adjacent_same_type);
+TEST (host_fw_region_map_init_test_adjacent_different_types);
+TEST (host_fw_region_map_init_test_overlapping_regions);
+TEST (host_fw_region_map_init_test_multiple_fw);
+TEST (host_fw_region_map_init_test_no_regions);
+TEST (host_fw_region_map_init_test_null);
+TEST (host_fw_region_map_release_test_null);
 TEST (host_fw_full_flash_verification_test);
 TEST (host_fw_full_flash_verification_test_not_blank_byte);
 TEST (host_fw_full_flash_verification_test_multiple_rw_regions);
@@ -15559,6 +16694,13 @@ TEST (host_fw_verify_offset_images_multiple_fw_test_hashes_no_offset);
 TEST (host_fw_verify_offset_images_multiple_fw_test_hashes_invalid);
 TEST (host_fw_verify_offset_images_multiple_fw_test_hashes_multiple);
 TEST (host_fw_verify_offset_images_multiple_fw_test_null);
+TEST (host_fw_verify_offset_images_multiple_fw_parallel_test);
+TEST (host_fw_verify_offset_images_multiple_fw_parallel_test_no_workers);
+TEST (host_fw_verify_offset_images_multiple_fw_parallel_test_single_fw);
+TEST (host_fw_verify_offset_images_multiple_fw_parallel_test_invalid);
+TEST (host_fw_verify_offset_images_multiple_fw_parallel_test_worker_invalid);
+TEST (host_fw_verify_offset_images_multiple_fw_parallel_test_start_error);
+TEST (host_fw_verify_offset_images_multiple_fw_parallel_test_null);
 TEST (host_fw_full_flash_verification_multiple_fw_test);
 TEST (host_fw_full_flash_verification_multiple_fw_test_multiple);
 TEST (host_fw_full_flash_verification_multiple_fw_test_hashes);
@@ -0,0 +1,592 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "host_fw/host_fw_verify_worker_async.h"
+#include "host_fw/host_fw_util.h"
+#include "testing/mock/flash/flash_master_mock.h"
+#include "testing/engines/hash_testing_engine.h"
+#include "testing/engines/rsa_testing_engine.h"
+#include "testing/crypto/rsa_testing.h"
+
+
+TEST_SUITE_LABEL ("host_fw_verify_worker_async");
+
+
+/**
+ * Dependencies for testing the asynchronous verification worker.
+ */
+struct host_fw_verify_worker_async_testing {
+	HASH_TESTING_ENGINE hash;					/**< Hash engine for the worker. */
+	struct hash_engine *engines[1];				/**< Engine list for the hash pool. */
+	struct hash_pool pool;						/**< Pool of hash engines for the worker. */
+	RSA_TESTING_ENGINE rsa;						/**< RSA engine for the worker. */
+	struct flash_master_mock flash_mock;		/**< Mock for the SPI flash master. */
+	struct spi_flash_state state;				/**< Context for the flash device. */
+	struct spi_flash flash;						/**< Flash containing the images. */
+	struct flash_region region;					/**< Region for the image to verify. */
+	struct pfm_image_signature sig;				/**< Signature for the image to verify. */
+	struct pfm_image_list list;					/**< The image to verify. */
+	struct host_fw_verify_worker_async test;	/**< The worker being tested. */
+};
+
+
+/**
+ * Initialize all dependencies for testing.
+ *
+ * @param test The test framework.
+ * @param worker Testing dependencies to initialize.
+ * @param data The data contained in the image.
+ */
+static void host_fw_verify_worker_async_testing_init_dependencies (CuTest *test,
+	struct host_fw_verify_worker_async_testing *worker, const char *data)
+{
+	int status;
+
+	status = HASH_TESTING_ENGINE_INIT (&worker->hash);
+	CuAssertIntEquals (test, 0, status);
+
+	worker->engines[0] = &worker->hash.base;
+
+	status = hash_pool_init (&worker->pool, worker->engines, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&worker->rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&worker->flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&worker->flash, &worker->state, &worker->flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&worker->flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	worker->region.start_addr = 0x10000;
+	worker->region.length = strlen (data);
+
+	worker->sig.regions = &worker->region;
+	worker->sig.count = 1;
+	memcpy (&worker->sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&worker->sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	worker->sig.sig_length = RSA_ENCRYPT_LEN;
+	worker->sig.always_validate = 1;
+
+	worker->list.images_sig = &worker->sig;
+	worker->list.images_hash = NULL;
+	worker->list.count = 1;
+}
+
+/**
+ * Initialize a worker for testing.
+ *
+ * @param test The test framework.
+ * @param worker Testing components to initialize.
+ * @param data The data contained in the image.
+ */
+static void host_fw_verify_worker_async_testing_init (CuTest *test,
+	struct host_fw_verify_worker_async_testing *worker, const char *data)
+{
+	int status;
+
+	host_fw_verify_worker_async_testing_init_dependencies (test, worker, data);
+
+	status = host_fw_verify_worker_async_init (&worker->test, &worker->hash.base,
+		&worker->rsa.base);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize a worker that acquires hash engines from a pool for testing.
+ *
+ * @param test The test framework.
+ * @param worker Testing components to initialize.
+ * @param data The data contained in the image.
+ */
+static void host_fw_verify_worker_async_testing_init_pool (CuTest *test,
+	struct host_fw_verify_worker_async_testing *worker, const char *data)
+{
+	int status;
+
+	host_fw_verify_worker_async_testing_init_dependencies (test, worker, data);
+
+	status = host_fw_verify_worker_async_init_pool (&worker->test, &worker->pool,
+		&worker->rsa.base);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release test dependencies and validate all mocks.
+ *
+ * @param test The test framework.
+ * @param worker Testing dependencies to release.
+ */
+static void host_fw_verify_worker_async_testing_release_dependencies (CuTest *test,
+	struct host_fw_verify_worker_async_testing *worker)
+{
+	int status;
+
+	status = flash_master_mock_validate_and_release (&worker->flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&worker->flash);
+	hash_pool_release (&worker->pool);
+	HASH_TESTING_ENGINE_RELEASE (&worker->hash);
+	RSA_TESTING_ENGINE_RELEASE (&worker->rsa);
+}
+
+/**
+ * Release a test instance and validate all mocks.
+ *
+ * @param test The test framework.
+ * @param worker Testing components to release.
+ */
+static void host_fw_verify_worker_async_testing_release (CuTest *test,
+	struct host_fw_verify_worker_async_testing *worker)
+{
+	host_fw_verify_worker_async_release (&worker->test);
+	host_fw_verify_worker_async_testing_release_dependencies (test, worker);
+}
+
+/**
+ * Set up expectations for reading the image data from flash.
+ *
+ * @param test The test framework.
+ * @param worker Testing components to update.
+ * @param data The data contained in the image.
+ * @param offset The offset applied to the image address.
+ */
+static void host_fw_verify_worker_async_testing_expect_read (CuTest *test,
+	struct host_fw_verify_worker_async_testing *worker, const char *data, uint32_t offset)
+{
+	int status;
+
+	status = flash_master_mock_expect_rx_xfer (&worker->flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&worker->flash_mock, 0, (uint8_t*) data,
+		strlen (data), FLASH_EXP_READ_CMD (0x03, 0x10000 + offset, 0, -1, strlen (data)));
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void host_fw_verify_worker_async_test_init (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, "Test");
+
+	CuAssertPtrNotNull (test, worker.test.base.start_verification);
+	CuAssertPtrNotNull (test, worker.test.base.get_verification_result);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_init_null (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init_dependencies (test, &worker, "Test");
+
+	status = host_fw_verify_worker_async_init (NULL, &worker.hash.base, &worker.rsa.base);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	status = host_fw_verify_worker_async_init (&worker.test, NULL, &worker.rsa.base);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	status = host_fw_verify_worker_async_init (&worker.test, &worker.hash.base, NULL);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	host_fw_verify_worker_async_testing_release_dependencies (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_init_pool (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init_pool (test, &worker, "Test");
+
+	CuAssertPtrNotNull (test, worker.test.base.start_verification);
+	CuAssertPtrNotNull (test, worker.test.base.get_verification_result);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_init_pool_null (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init_dependencies (test, &worker, "Test");
+
+	status = host_fw_verify_worker_async_init_pool (NULL, &worker.pool, &worker.rsa.base);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	status = host_fw_verify_worker_async_init_pool (&worker.test, NULL, &worker.rsa.base);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	status = host_fw_verify_worker_async_init_pool (&worker.test, &worker.pool, NULL);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	host_fw_verify_worker_async_testing_release_dependencies (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	host_fw_verify_worker_async_release (NULL);
+}
+
+static void host_fw_verify_worker_async_test_verify (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	char *data = "Test";
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, data);
+	host_fw_verify_worker_async_testing_expect_read (test, &worker, data, 0x400000);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0x400000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_async_wait_for_work (&worker.test, 100);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_verify_bad_signature (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	char *data = "Test";
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, data);
+	memcpy (&worker.sig.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+
+	host_fw_verify_worker_async_testing_expect_read (test, &worker, data, 0);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_verify_multiple (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	char *data = "Test";
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, data);
+	host_fw_verify_worker_async_testing_expect_read (test, &worker, data, 0x400000);
+	host_fw_verify_worker_async_testing_expect_read (test, &worker, data, 0x300000);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0x400000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0x300000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_verify_pool (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	struct hash_engine *engine;
+	struct hash_pool_stats stats;
+	char *data = "Test";
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init_pool (test, &worker, data);
+	host_fw_verify_worker_async_testing_expect_read (test, &worker, data, 0x400000);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0x400000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_get_stats (&worker.pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.acquired);
+
+	/* The engine must have been returned to the pool. */
+	status = hash_pool_try_acquire_engine (&worker.pool, &engine);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &worker.hash.base, engine);
+
+	status = hash_pool_release_engine (&worker.pool, engine);
+	CuAssertIntEquals (test, 0, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_verify_pool_bad_signature (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	struct hash_engine *engine;
+	char *data = "Test";
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init_pool (test, &worker, data);
+	memcpy (&worker.sig.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+
+	host_fw_verify_worker_async_testing_expect_read (test, &worker, data, 0);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
+	status = hash_pool_try_acquire_engine (&worker.pool, &engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_pool_release_engine (&worker.pool, engine);
+	CuAssertIntEquals (test, 0, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_start_verification_null (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, "Test");
+
+	status = worker.test.base.start_verification (NULL, &worker.flash, &worker.list, 0);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	status = worker.test.base.start_verification (&worker.test.base, NULL, &worker.list, 0);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, NULL, 0);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_NOT_STARTED, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_start_verification_busy (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	char *data = "Test";
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, data);
+	host_fw_verify_worker_async_testing_expect_read (test, &worker, data, 0);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0x400000);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_BUSY, status);
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The worker stays busy until the result has been retrieved. */
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0x400000);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_BUSY, status);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_get_verification_result_null (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, "Test");
+
+	status = worker.test.base.get_verification_result (NULL);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_get_verification_result_not_started (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	char *data = "Test";
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, data);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_NOT_STARTED, status);
+
+	host_fw_verify_worker_async_testing_expect_read (test, &worker, data, 0);
+
+	status = worker.test.base.start_verification (&worker.test.base, &worker.flash, &worker.list,
+		0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = worker.test.base.get_verification_result (&worker.test.base);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_NOT_STARTED, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_wait_for_work_timeout (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, "Test");
+
+	status = host_fw_verify_worker_async_wait_for_work (&worker.test, 10);
+	CuAssertIntEquals (test, 1, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_wait_for_work_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = host_fw_verify_worker_async_wait_for_work (NULL, 10);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+}
+
+static void host_fw_verify_worker_async_test_process_no_request (CuTest *test)
+{
+	struct host_fw_verify_worker_async_testing worker;
+	int status;
+
+	TEST_START;
+
+	host_fw_verify_worker_async_testing_init (test, &worker, "Test");
+
+	status = host_fw_verify_worker_async_process (&worker.test);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_NOT_STARTED, status);
+
+	host_fw_verify_worker_async_testing_release (test, &worker);
+}
+
+static void host_fw_verify_worker_async_test_process_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = host_fw_verify_worker_async_process (NULL);
+	CuAssertIntEquals (test, HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT, status);
+}
+
+
+TEST_SUITE_START (host_fw_verify_worker_async);
+
+TEST (host_fw_verify_worker_async_test_init);
+TEST (host_fw_verify_worker_async_test_init_null);
+TEST (host_fw_verify_worker_async_test_init_pool);
+TEST (host_fw_verify_worker_async_test_init_pool_null);
+TEST (host_fw_verify_worker_async_test_release_null);
+TEST (host_fw_verify_worker_async_test_verify);
+TEST (host_fw_verify_worker_async_test_verify_bad_signature);
+TEST (host_fw_verify_worker_async_test_verify_multiple);
+TEST (host_fw_verify_worker_async_test_verify_pool);
+TEST (host_fw_verify_worker_async_test_verify_pool_bad_signature);
+TEST (host_fw_verify_worker_async_test_start_verification_null);
+TEST (host_fw_verify_worker_async_test_start_verification_busy);
+TEST (host_fw_verify_worker_async_test_get_verification_result_null);
+TEST (host_fw_verify_worker_async_test_get_verification_result_not_started);
+TEST (host_fw_verify_worker_async_test_wait_for_work_timeout);
+TEST (host_fw_verify_worker_async_test_wait_for_work_null);
+TEST (host_fw_verify_worker_async_test_process_no_request);
+TEST (host_fw_verify_worker_async_test_process_null);
+
+TEST_SUITE_END;
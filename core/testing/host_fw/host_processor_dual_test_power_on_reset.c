@@ -7,6 +7,8 @@
 #include "testing.h"
 #include "testing/crypto/rsa_testing.h"
 #include "testing/host_fw/host_processor_dual_testing.h"
+#include "testing/mock/flash/flash_store_mock.h"
+#include "testing/crypto/hash_testing.h"
 
 
 TEST_SUITE_LABEL ("host_processor_dual");
@@ -814,6 +816,125 @@ static void host_processor_dual_test_power_on_reset_active_pfm_not_dirty_multipl
 	host_processor_dual_testing_validate_and_release (test, &host);
 }
 
+static void host_processor_dual_test_power_on_reset_active_pfm_verification_cache_not_used (
+	CuTest *test)
+{
+	struct host_processor_dual_testing host;
+	struct flash_store_mock store;
+	struct host_flash_verification_cache cache;
+	struct host_flash_verification_cache_record record;
+	uint8_t key[SHA256_HASH_LENGTH] = {0};
+	uint32_t pfm_id = 0x10;
+	int status;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct host_flash_manager_rw_regions rw_host;
+
+	TEST_START;
+
+	host_processor_dual_testing_init (test, &host);
+
+	status = flash_store_mock_init (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_verification_cache_init (&cache, &store.base, 0, key, sizeof (key));
+	CuAssertIntEquals (test, 0, status);
+
+	host_processor_filtered_set_verification_cache (&host.test, &cache);
+
+	memset (&record, 0, sizeof (record));
+	record.pfm_id = pfm_id;
+	memcpy (record.pfm_hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	record.ro_flash = SPI_FILTER_CS_0;
+
+	status = hash_generate_hmac (&host.hash.base, key, sizeof (key), (uint8_t*) &record,
+		offsetof (struct host_flash_verification_cache_record, hmac), HMAC_SHA256, record.hmac,
+		sizeof (record.hmac));
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	rw_host.pfm = &host.pfm.base;
+	rw_host.writable = &rw_list;
+	rw_host.count = 1;
+
+	status = mock_expect (&host.flash_mgr.mock, host.flash_mgr.base.base.set_flash_for_rot_access,
+		&host.flash_mgr, 0, MOCK_ARG (&host.control));
+	status |= mock_expect (&host.flash_mgr.mock,
+		host.flash_mgr.base.base.config_spi_filter_flash_type, &host.flash_mgr, 0);
+
+	status |= mock_expect (&host.pfm_mgr.mock, host.pfm_mgr.base.get_active_pfm, &host.pfm_mgr,
+		(intptr_t) &host.pfm);
+	status |= mock_expect (&host.pfm_mgr.mock, host.pfm_mgr.base.get_pending_pfm, &host.pfm_mgr,
+		(intptr_t) NULL);
+
+	/* A valid cached result is never used on power-on, since the SPI filter has been reset. */
+	status |= mock_expect (&store.mock, store.base.erase, &store, 0, MOCK_ARG (0));
+
+	status |= mock_expect (&host.flash_mgr.mock, host.flash_mgr.base.base.validate_read_only_flash,
+		&host.flash_mgr, 0, MOCK_ARG (&host.pfm), MOCK_ARG (NULL), MOCK_ARG (&host.hash),
+		MOCK_ARG (&host.rsa), MOCK_ARG (false), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&host.flash_mgr.mock, 5, &rw_host, sizeof (rw_host), -1);
+	status |= mock_expect_save_arg (&host.flash_mgr.mock, 5, 0);
+
+	status |= mock_expect (&host.filter.mock, host.filter.base.clear_filter_rw_regions,
+		&host.filter, 0);
+	status |= mock_expect (&host.filter.mock, host.filter.base.set_filter_rw_region,
+		&host.filter, 0, MOCK_ARG (1), MOCK_ARG (0x200), MOCK_ARG (0x300));
+
+	status |= mock_expect (&host.flash_mgr.mock,
+		host.flash_mgr.base.base.config_spi_filter_flash_devices, &host.flash_mgr, 0);
+
+	status |= mock_expect (&host.observer.mock, host.observer.base.on_active_mode, &host.observer,
+		0);
+
+	status |= mock_expect (&host.pfm.mock, host.pfm.base.base.get_id, &host.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&host.pfm.mock, 0, &pfm_id, sizeof (pfm_id), -1);
+
+	status |= mock_expect (&host.pfm.mock, host.pfm.base.base.get_hash, &host.pfm,
+		SHA256_HASH_LENGTH, MOCK_ARG (&host.hash), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (SHA512_HASH_LENGTH));
+	status |= mock_expect_output (&host.pfm.mock, 1, SHA256_TEST_HASH, SHA256_HASH_LENGTH, 2);
+
+	status |= mock_expect (&store.mock, store.base.write, &store, 0, MOCK_ARG (0),
+		MOCK_ARG_PTR_CONTAINS (&record, sizeof (record)), MOCK_ARG (sizeof (record)));
+
+	status |= mock_expect (&host.flash_mgr.mock, host.flash_mgr.base.base.free_read_write_regions,
+		&host.flash_mgr, 0, MOCK_ARG_SAVED_ARG (0));
+
+	status |= mock_expect (&host.pfm_mgr.mock, host.pfm_mgr.base.free_pfm, &host.pfm_mgr, 0,
+		MOCK_ARG (&host.pfm));
+
+	status |= mock_expect (&host.flash_mgr.mock, host.flash_mgr.base.base.set_flash_for_host_access,
+		&host.flash_mgr, 0, MOCK_ARG (&host.control));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = host.test.base.power_on_reset (&host.test.base, &host.hash.base, &host.rsa.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_state_manager_is_inactive_dirty (&host.host_state);
+	CuAssertIntEquals (test, false, status);
+
+	status = host_state_manager_is_bypass_mode (&host.host_state);
+	CuAssertIntEquals (test, false, status);
+
+	status = flash_store_mock_validate_and_release (&store);
+	CuAssertIntEquals (test, 0, status);
+
+	host_processor_dual_testing_validate_and_release (test, &host);
+	host_flash_verification_cache_release (&cache);
+}
+
 static void host_processor_dual_test_power_on_reset_active_pfm_not_dirty_no_observer (CuTest *test)
 {
 	struct host_processor_dual_testing host;
@@ -17737,6 +17858,7 @@ TEST (host_processor_dual_test_power_on_reset_no_pfm_dirty_checked);
 TEST (host_processor_dual_test_power_on_reset_no_pfm_dirty_checked_bypass);
 TEST (host_processor_dual_test_power_on_reset_active_pfm_not_dirty);
 TEST (host_processor_dual_test_power_on_reset_active_pfm_not_dirty_multiple_fw);
+TEST (host_processor_dual_test_power_on_reset_active_pfm_verification_cache_not_used);
 TEST (host_processor_dual_test_power_on_reset_active_pfm_not_dirty_no_observer);
 TEST (host_processor_dual_test_power_on_reset_active_pfm_not_dirty_bypass);
 TEST (host_processor_dual_test_power_on_reset_active_pfm_not_dirty_checked);
@@ -1239,7 +1239,7 @@ static void cfm_flash_testing_init (CuTest *test, struct cfm_flash_testing *cfm,
 
 	status = cfm_flash_init (&cfm->test, &cfm->manifest.flash.base, &cfm->manifest.hash.base,
 		address, cfm->manifest.signature, sizeof (cfm->manifest.signature),
-		cfm->manifest.platform_id, sizeof (cfm->manifest.platform_id));
+		cfm->manifest.platform_id, sizeof (cfm->manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&cfm->manifest.flash.mock);
@@ -1322,7 +1322,7 @@ static void cfm_flash_test_init (CuTest *test)
 
 	status = cfm_flash_init (&cfm.test, &cfm.manifest.flash.base, &cfm.manifest.hash.base,
 		0x10000, cfm.manifest.signature, sizeof (cfm.manifest.signature),
-		cfm.manifest.platform_id, sizeof (cfm.manifest.platform_id));
+		cfm.manifest.platform_id, sizeof (cfm.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	CuAssertPtrNotNull (test, cfm.test.base.base.verify);
@@ -1356,6 +1356,30 @@ static void cfm_flash_test_init (CuTest *test)
 	cfm_flash_testing_validate_and_release (test, &cfm);
 }
 
+static void cfm_flash_test_init_toc_cache (CuTest *test)
+{
+	struct cfm_flash_testing cfm;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+
+	TEST_START;
+
+	cfm_flash_testing_init_dependencies (test, &cfm, 0x10000);
+	manifest_flash_v2_testing_init_common (test, &cfm.manifest, 0x1000);
+
+	status = cfm_flash_init (&cfm.test, &cfm.manifest.flash.base, &cfm.manifest.hash.base,
+		0x10000, cfm.manifest.signature, sizeof (cfm.manifest.signature),
+		cfm.manifest.platform_id, sizeof (cfm.manifest.platform_id), toc_cache,
+		sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, toc_cache, cfm.test.base_flash.toc_cache);
+	CuAssertIntEquals (test, sizeof (toc_cache), cfm.test.base_flash.max_toc_cache);
+	CuAssertIntEquals (test, false, cfm.test.base_flash.toc_cache_valid);
+
+	cfm_flash_testing_validate_and_release (test, &cfm);
+}
+
 static void cfm_flash_test_init_null (CuTest *test)
 {
 	struct cfm_flash_testing cfm;
@@ -1367,22 +1391,22 @@ static void cfm_flash_test_init_null (CuTest *test)
 
 	status = cfm_flash_init (NULL, &cfm.manifest.flash.base, &cfm.manifest.hash.base, 0x10000,
 		cfm.manifest.signature, sizeof (cfm.manifest.signature), cfm.manifest.platform_id,
-		sizeof (cfm.manifest.platform_id));
+		sizeof (cfm.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, CFM_INVALID_ARGUMENT, status);
 
 	status = cfm_flash_init (&cfm.test, NULL, &cfm.manifest.hash.base, 0x10000,
 		cfm.manifest.signature, sizeof (cfm.manifest.signature), cfm.manifest.platform_id,
-		sizeof (cfm.manifest.platform_id));
+		sizeof (cfm.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
 
 	status = cfm_flash_init (&cfm.test, &cfm.manifest.flash.base, &cfm.manifest.hash.base,
 		0x10000, NULL, sizeof (cfm.manifest.signature), cfm.manifest.platform_id,
-		sizeof (cfm.manifest.platform_id));
+		sizeof (cfm.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, CFM_INVALID_ARGUMENT, status);
 
 	status = cfm_flash_init (&cfm.test, &cfm.manifest.flash.base, &cfm.manifest.hash.base,
 		0x10000, cfm.manifest.signature, sizeof (cfm.manifest.signature), NULL,
-		sizeof (cfm.manifest.platform_id));
+		sizeof (cfm.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, CFM_INVALID_ARGUMENT, status);
 
 	cfm_flash_testing_validate_and_release_dependencies (test, &cfm);
@@ -1400,7 +1424,7 @@ static void cfm_flash_test_init_manifest_flash_init_fail (CuTest *test)
 
 	status = cfm_flash_init (&cfm.test, &cfm.manifest.flash.base, &cfm.manifest.hash.base,
 		0x10001, cfm.manifest.signature, sizeof (cfm.manifest.signature),
-		cfm.manifest.platform_id, sizeof (cfm.manifest.platform_id));
+		cfm.manifest.platform_id, sizeof (cfm.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_STORAGE_NOT_ALIGNED, status);
 
 	cfm_flash_testing_validate_and_release_dependencies (test, &cfm);
@@ -2961,6 +2985,50 @@ static void cfm_flash_test_get_component_device (CuTest *test)
 	cfm_flash_testing_validate_and_release (test, &cfm);
 }
 
+static void cfm_flash_test_get_component_device_query_arena (CuTest *test)
+{
+	struct cfm_component_device component;
+	struct cfm_flash_testing cfm;
+	struct arena arena;
+	uint8_t buffer[64];
+	int status;
+
+	TEST_START;
+
+	cfm_flash_testing_init_and_verify (test, &cfm, 0x10000, &CFM_TESTING, 0);
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest,
+		CFM_TESTING.component_device1_entry, 0, CFM_TESTING.component_device1_hash,
+		CFM_TESTING.component_device1_offset, CFM_TESTING.component_device1_len,
+		CFM_TESTING.component_device1_len, 0);
+
+	manifest_flash_v2_testing_get_num_child_elements (test, &cfm.manifest, &CFM_TESTING.manifest, 2,
+		26);
+
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 5, 2, 5,
+		0x70c, 0x44, sizeof (struct cfm_pmr_digest_element), 0);
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 6, 6, 6,
+		0x750, 0x44, sizeof (struct cfm_pmr_digest_element), 0);
+
+	status = cfm_flash_get_component_device_arena (&cfm.test, &arena, "Component1", &component);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertStrEquals (test, "Component1", (const char*) component.type);
+	CuAssertIntEquals (test, 0, component.pmr_id_list[0]);
+	CuAssertIntEquals (test, 4, component.pmr_id_list[1]);
+	CuAssertIntEquals (test, 2, component.num_pmr_digest);
+
+	CuAssertIntEquals (test, true, arena_contains (&arena, component.type));
+	CuAssertIntEquals (test, true, arena_contains (&arena, component.pmr_id_list));
+
+	cfm.test.base.free_component_device (&cfm.test.base, &component);
+	arena_reset (&arena);
+
+	cfm_flash_testing_validate_and_release (test, &cfm);
+}
+
 static void cfm_flash_test_get_component_device_second_component (CuTest *test)
 {
 	struct cfm_component_device component;
@@ -6661,6 +6729,7 @@ static void cfm_flash_test_free_manifest_null (CuTest *test)
 TEST_SUITE_START (cfm_flash);
 
 TEST (cfm_flash_test_init);
+TEST (cfm_flash_test_init_toc_cache);
 TEST (cfm_flash_test_init_null);
 TEST (cfm_flash_test_init_manifest_flash_init_fail);
 TEST (cfm_flash_test_release_null);
@@ -6723,6 +6792,7 @@ TEST (cfm_flash_test_buffer_supported_components_null);
 TEST (cfm_flash_test_buffer_supported_components_verify_never_run);
 TEST (cfm_flash_test_buffer_supported_components_component_read_fail);
 TEST (cfm_flash_test_get_component_device);
+TEST (cfm_flash_test_get_component_device_query_arena);
 TEST (cfm_flash_test_get_component_device_second_component);
 TEST (cfm_flash_test_get_component_device_null);
 TEST (cfm_flash_test_get_component_device_component_read_fail);
@@ -644,6 +644,175 @@ static void manifest_flash_test_verify_read_error_with_hash_out (CuTest *test)
 	manifest_flash_testing_validate_and_release (test, &manifest);
 }
 
+static void manifest_flash_test_verify_precomputed_hash (CuTest *test)
+{
+	struct manifest_flash_testing manifest;
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM);
+
+	status = manifest_flash_set_verification_hash (&manifest.test, PFM_HASH, PFM_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&manifest.flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manifest.flash_mock, 0, PFM_DATA, PFM_HEADER_SIZE,
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, PFM_HEADER_SIZE));
+
+	status |= flash_master_mock_expect_rx_xfer (&manifest.flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manifest.flash_mock, 0, PFM_SIGNATURE,
+		PFM_SIGNATURE_LEN,
+		FLASH_EXP_READ_CMD (0x03, 0x10000 + PFM_SIGNATURE_OFFSET, 0, -1, PFM_SIGNATURE_LEN));
+
+	status |= mock_expect (&manifest.verification.mock,
+		manifest.verification.base.verify_signature, &manifest.verification, 0,
+		MOCK_ARG_PTR_CONTAINS (PFM_HASH, PFM_HASH_LEN), MOCK_ARG (PFM_HASH_LEN),
+		MOCK_ARG_PTR_CONTAINS (PFM_SIGNATURE, PFM_SIGNATURE_LEN), MOCK_ARG (PFM_SIGNATURE_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (PFM_HASH, hash_out, PFM_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manifest.flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The precomputed hash is only used once. */
+	manifest_flash_testing_verify_manifest (test, &manifest, PFM_DATA, PFM_DATA_LEN, PFM_SIGNATURE,
+		PFM_SIGNATURE_OFFSET, PFM_SIGNATURE_LEN, PFM_HASH, 0);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_test_verify_precomputed_hash_bad_signature (CuTest *test)
+{
+	struct manifest_flash_testing manifest;
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM);
+
+	status = manifest_flash_set_verification_hash (&manifest.test, PFM_HASH, PFM_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&manifest.flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manifest.flash_mock, 0, PFM_DATA, PFM_HEADER_SIZE,
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, PFM_HEADER_SIZE));
+
+	status |= flash_master_mock_expect_rx_xfer (&manifest.flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manifest.flash_mock, 0, PFM_SIGNATURE,
+		PFM_SIGNATURE_LEN,
+		FLASH_EXP_READ_CMD (0x03, 0x10000 + PFM_SIGNATURE_OFFSET, 0, -1, PFM_SIGNATURE_LEN));
+
+	status |= mock_expect (&manifest.verification.mock,
+		manifest.verification.base.verify_signature, &manifest.verification,
+		RSA_ENGINE_BAD_SIGNATURE, MOCK_ARG_PTR_CONTAINS (PFM_HASH, PFM_HASH_LEN),
+		MOCK_ARG (PFM_HASH_LEN), MOCK_ARG_PTR_CONTAINS (PFM_SIGNATURE, PFM_SIGNATURE_LEN),
+		MOCK_ARG (PFM_SIGNATURE_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+
+	status = testing_validate_array (PFM_HASH, hash_out, PFM_HASH_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_test_verify_precomputed_hash_wrong_length (CuTest *test)
+{
+	struct manifest_flash_testing manifest;
+	uint8_t bad_hash[SHA384_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM);
+
+	memset (bad_hash, 0x55, sizeof (bad_hash));
+
+	status = manifest_flash_set_verification_hash (&manifest.test, bad_hash, sizeof (bad_hash));
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_testing_verify_manifest (test, &manifest, PFM_DATA, PFM_DATA_LEN, PFM_SIGNATURE,
+		PFM_SIGNATURE_OFFSET, PFM_SIGNATURE_LEN, PFM_HASH, 0);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_test_verify_precomputed_hash_cleared (CuTest *test)
+{
+	struct manifest_flash_testing manifest;
+	uint8_t bad_hash[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM);
+
+	memset (bad_hash, 0x55, sizeof (bad_hash));
+
+	status = manifest_flash_set_verification_hash (&manifest.test, bad_hash, sizeof (bad_hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_set_verification_hash (&manifest.test, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_testing_verify_manifest (test, &manifest, PFM_DATA, PFM_DATA_LEN, PFM_SIGNATURE,
+		PFM_SIGNATURE_OFFSET, PFM_SIGNATURE_LEN, PFM_HASH, 0);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_test_set_verification_hash_null (CuTest *test)
+{
+	struct manifest_flash_testing manifest;
+	uint8_t hash[SHA512_HASH_LENGTH + 1];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM);
+
+	status = manifest_flash_set_verification_hash (NULL, PFM_HASH, PFM_HASH_LEN);
+	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
+
+	status = manifest_flash_set_verification_hash (&manifest.test, PFM_HASH, 0);
+	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
+
+	status = manifest_flash_set_verification_hash (&manifest.test, hash, sizeof (hash));
+	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
+
+	manifest_flash_testing_validate_and_release (test, &manifest);
+}
+
 static void manifest_flash_test_get_id (CuTest *test)
 {
 	struct manifest_flash_testing manifest;
@@ -2175,6 +2344,11 @@ TEST (manifest_flash_test_verify_bad_signature_with_hash_out);
 TEST (manifest_flash_test_verify_bad_signature_ecc_with_hash_out);
 TEST (manifest_flash_test_verify_read_error);
 TEST (manifest_flash_test_verify_read_error_with_hash_out);
+TEST (manifest_flash_test_verify_precomputed_hash);
+TEST (manifest_flash_test_verify_precomputed_hash_bad_signature);
+TEST (manifest_flash_test_verify_precomputed_hash_wrong_length);
+TEST (manifest_flash_test_verify_precomputed_hash_cleared);
+TEST (manifest_flash_test_set_verification_hash_null);
 TEST (manifest_flash_test_get_id);
 TEST (manifest_flash_test_get_id_null);
 TEST (manifest_flash_test_get_id_verify_never_run);
@@ -374,6 +374,127 @@ void manifest_flash_v2_testing_verify_manifest_mocked_hash (CuTest *test,
 	CuAssertIntEquals (test, 0, status);
 }
 
+/**
+ * Set expectations on mocks for v2 manifest verification when the table of contents is being
+ * loaded into a cache.
+ *
+ * @param test The testing framework.
+ * @param manifest The components for the test.
+ * @param data Manifest data for the test.
+ * @param toc Table of contents data to return when loading the cache.
+ * @param sig_result Result of the signature verification call.
+ */
+static void manifest_flash_v2_testing_verify_manifest_toc_cache (CuTest *test,
+	struct manifest_flash_v2_testing *manifest, const struct manifest_v2_testing_data *data,
+	const uint8_t *toc, int sig_result)
+{
+	uint32_t toc_entry_offset = MANIFEST_V2_TOC_ENTRY_OFFSET;
+	const uint8_t *plat_id = data->raw + data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE;
+	uint32_t validate_start = data->toc_hash_offset + data->toc_hash_len;
+	uint32_t validate_end = data->plat_id_offset;
+	uint32_t validate_resume =
+		data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE + data->plat_id_str_len;
+	int status;
+
+	/* Read manifest header. */
+	status = mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr), MOCK_ARG_NOT_NULL, MOCK_ARG (MANIFEST_V2_HEADER_SIZE));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->raw, data->length, 2);
+
+	/* Read manifest signature. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + data->sig_offset), MOCK_ARG_NOT_NULL, MOCK_ARG (data->sig_len));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->signature, data->sig_len, 2);
+
+	/* Read table of contents header. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + MANIFEST_V2_TOC_HDR_OFFSET), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_TOC_HEADER_SIZE));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->toc,
+		data->length - MANIFEST_V2_TOC_HDR_OFFSET, 2);
+
+	/* Load the table of contents into the cache. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + toc_entry_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (data->toc_hash_offset - toc_entry_offset));
+	status |= mock_expect_output (&manifest->flash.mock, 1, toc,
+		data->toc_hash_offset - toc_entry_offset, 2);
+
+	/* Read table of contents hash. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + data->toc_hash_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (data->toc_hash_len));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->toc_hash,
+		data->length - data->toc_hash_offset, 2);
+
+	status |= flash_mock_expect_verify_flash (&manifest->flash, manifest->addr + validate_start,
+		data->raw + validate_start, validate_end - validate_start);
+
+	/* Read the platform ID header. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + data->plat_id_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_PLATFORM_HEADER_SIZE));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->plat_id,
+		data->length - data->plat_id_offset, 2);
+
+	/* Read the platform ID string. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (data->plat_id_str_len));
+	status |= mock_expect_output (&manifest->flash.mock, 1, plat_id,
+		data->length - data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE, 2);
+
+	status |= flash_mock_expect_verify_flash (&manifest->flash, manifest->addr + validate_resume,
+		data->raw + validate_resume, data->sig_offset - validate_resume);
+
+	status |= mock_expect (&manifest->verification.mock,
+		manifest->verification.base.verify_signature, &manifest->verification, sig_result,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (data->hash_len),
+		MOCK_ARG_PTR_CONTAINS (data->signature, data->sig_len), MOCK_ARG (data->sig_len));
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize a manifest for testing with a table of contents cache.  Run verification to load the
+ * manifest information.
+ *
+ * @param test The testing framework.
+ * @param manifest The testing components to initialize.
+ * @param address The base address for the manifest data.
+ * @param magic_v1 The manifest v1 type identifier.
+ * @param magic_v2 The manifest v2 type identifier.
+ * @param data Manifest data for the test.
+ * @param toc_cache Buffer to use for the table of contents cache.
+ * @param max_toc_cache Length of the cache buffer.
+ */
+static void manifest_flash_v2_testing_init_and_verify_toc_cache (CuTest *test,
+	struct manifest_flash_v2_testing *manifest, uint32_t address, uint16_t magic_v1,
+	uint16_t magic_v2, const struct manifest_v2_testing_data *data, uint8_t *toc_cache,
+	size_t max_toc_cache)
+{
+	int status;
+
+	manifest_flash_v2_testing_init (test, manifest, address, magic_v1, magic_v2);
+
+	status = manifest_flash_enable_toc_cache (&manifest->test, toc_cache, max_toc_cache);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_verify_manifest_toc_cache (test, manifest, data,
+		data->raw + MANIFEST_V2_TOC_ENTRY_OFFSET, 0);
+
+	status = manifest_flash_verify (&manifest->test, &manifest->hash.base,
+		&manifest->verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, true, manifest->test.toc_cache_valid);
+
+	status = mock_validate (&manifest->flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manifest->verification.mock);
+	CuAssertIntEquals (test, 0, status);
+}
+
 /**
  * Initialize a manifest for testing.  Run verification to load the manifest information.
  *
@@ -911,6 +1032,90 @@ static void manifest_flash_v2_test_verify_with_mock_hash (CuTest *test)
 	manifest_flash_v2_testing_validate_and_release (test, &manifest);
 }
 
+static void manifest_flash_v2_test_verify_precomputed_hash (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	const struct manifest_v2_testing_data *data = &PFM_V2.manifest;
+	uint32_t toc_entry_offset = MANIFEST_V2_TOC_ENTRY_OFFSET;
+	const struct manifest_toc_entry *toc_entries =
+		(struct manifest_toc_entry*) (data->raw + toc_entry_offset);
+	const uint8_t *plat_id = data->raw + data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE;
+	uint8_t hash_out[SHA512_HASH_LENGTH];
+	int status;
+	int i;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_set_verification_hash (&manifest.test, data->hash, data->hash_len);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Read manifest header. */
+	status = mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr), MOCK_ARG_NOT_NULL, MOCK_ARG (MANIFEST_V2_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->raw, data->length, 2);
+
+	/* Read manifest signature. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + data->sig_offset), MOCK_ARG_NOT_NULL, MOCK_ARG (data->sig_len));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->signature, data->sig_len, 2);
+
+	/* Read table of contents header. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + MANIFEST_V2_TOC_HDR_OFFSET), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_TOC_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->toc,
+		data->length - MANIFEST_V2_TOC_HDR_OFFSET, 2);
+
+	/* Find the platform ID TOC entry. */
+	for (i = 0; i <= data->plat_id_entry; i++) {
+		status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash,
+			0, MOCK_ARG (manifest.addr + toc_entry_offset + (i * MANIFEST_V2_TOC_ENTRY_SIZE)),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (MANIFEST_V2_TOC_ENTRY_SIZE));
+		status |= mock_expect_output (&manifest.flash.mock, 1, &toc_entries[i],
+			MANIFEST_V2_TOC_ENTRY_SIZE, 2);
+	}
+
+	/* Read table of contents hash. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + data->toc_hash_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (data->toc_hash_len));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->toc_hash,
+		data->length - data->toc_hash_offset, 2);
+
+	/* Read the platform ID header. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + data->plat_id_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_PLATFORM_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->plat_id,
+		data->length - data->plat_id_offset, 2);
+
+	/* Read the platform ID string. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (data->plat_id_str_len));
+	status |= mock_expect_output (&manifest.flash.mock, 1, plat_id,
+		data->length - data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE, 2);
+
+	status |= mock_expect (&manifest.verification.mock,
+		manifest.verification.base.verify_signature, &manifest.verification, 0,
+		MOCK_ARG_PTR_CONTAINS (data->hash, data->hash_len), MOCK_ARG (data->hash_len),
+		MOCK_ARG_PTR_CONTAINS (data->signature, data->sig_len), MOCK_ARG (data->sig_len));
+
+	CuAssertIntEquals (test, 0, status);
+
+	/* No manifest data should be hashed. */
+	status = manifest_flash_verify (&manifest.test, &manifest.hash_mock.base,
+		&manifest.verification.base, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data->hash, hash_out, data->hash_len);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
 static void manifest_flash_v2_test_verify_platform_id_first (CuTest *test)
 {
 	struct manifest_flash_v2_testing manifest;
@@ -4401,117 +4606,665 @@ static void manifest_flash_v2_test_read_element_data (CuTest *test)
 	manifest_flash_v2_testing_validate_and_release (test, &manifest);
 }
 
-static void manifest_flash_v2_test_read_element_data_no_found_output (CuTest *test)
+static void manifest_flash_v2_test_enable_toc_cache_null (CuTest *test)
 {
 	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
 	int status;
-	uint8_t buffer[PFM_V2.manifest.plat_id_len];
-	uint8_t *element = buffer;
-	size_t total = 0;
-	uint8_t format = 0xff;
 
 	TEST_START;
 
-	manifest_flash_v2_testing_init_and_verify (test, &manifest, 0x10000, PFM_MAGIC_NUM,
-		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0, false, 0);
-
-	manifest_flash_v2_testing_read_element (test, &manifest, &PFM_V2.manifest,
-		PFM_V2.manifest.plat_id_entry, 0, PFM_V2.manifest.plat_id_hash,
-		PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len, sizeof (buffer), 0);
-
-	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
-		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, NULL, &format, &total, &element,
-		sizeof (buffer));
-	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
-	CuAssertIntEquals (test, 1, format);
-	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, total);
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
 
-	status = testing_validate_array (PFM_V2.manifest.plat_id, buffer, status);
-	CuAssertIntEquals (test, 0, status);
+	status = manifest_flash_enable_toc_cache (NULL, toc_cache, sizeof (toc_cache));
+	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
 
 	manifest_flash_v2_testing_validate_and_release (test, &manifest);
 }
 
-static void manifest_flash_v2_test_read_element_data_no_format_output (CuTest *test)
+static void manifest_flash_v2_test_alloc_query_arena (CuTest *test)
 {
-	struct manifest_flash_v2_testing manifest;
+	struct arena arena;
+	uint64_t buffer[8];
+	uint8_t *mem;
+	char *str;
 	int status;
-	uint8_t buffer[PFM_V2.manifest.plat_id_len];
-	uint8_t *element = buffer;
-	size_t total = 0;
-	uint8_t found = 0xff;
 
 	TEST_START;
 
-	manifest_flash_v2_testing_init_and_verify (test, &manifest, 0x10000, PFM_MAGIC_NUM,
-		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0, false, 0);
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
 
-	manifest_flash_v2_testing_read_element (test, &manifest, &PFM_V2.manifest,
-		PFM_V2.manifest.plat_id_entry, 0, PFM_V2.manifest.plat_id_hash,
-		PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len, sizeof (buffer), 0);
+	mem = manifest_flash_alloc_query (&arena, 4);
+	CuAssertPtrNotNull (test, mem);
+	CuAssertIntEquals (test, true, arena_contains (&arena, mem));
+	CuAssertIntEquals (test, 0, ((uintptr_t) mem) % ARENA_ALIGNMENT);
 
-	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
-		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, &found, NULL, &total, &element,
-		sizeof (buffer));
-	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
-	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_entry, found);
-	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, total);
+	manifest_flash_free_query (mem);
 
-	status = testing_validate_array (PFM_V2.manifest.plat_id, buffer, status);
-	CuAssertIntEquals (test, 0, status);
+	mem = manifest_flash_calloc_query (&arena, 2, 4);
+	CuAssertPtrNotNull (test, mem);
+	CuAssertIntEquals (test, true, arena_contains (&arena, mem));
+	CuAssertIntEquals (test, 0, mem[0]);
+	CuAssertIntEquals (test, 0, mem[7]);
 
-	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+	str = manifest_flash_strdup_query (&arena, "Test");
+	CuAssertPtrNotNull (test, str);
+	CuAssertIntEquals (test, true, arena_contains (&arena, str));
+	CuAssertStrEquals (test, "Test", str);
+
+	/* Freeing arena allocations should have no effect. */
+	manifest_flash_free_query (str);
+	manifest_flash_free_query (mem);
+
+	CuAssertIntEquals (test, (ARENA_ALIGNMENT * 5) + 5, arena.used);
 }
 
-static void manifest_flash_v2_test_read_element_data_no_total_length_output (CuTest *test)
+static void manifest_flash_v2_test_alloc_query_arena_full (CuTest *test)
 {
-	struct manifest_flash_v2_testing manifest;
+	struct arena arena;
+	uint64_t buffer[4];
+	uint8_t *mem;
+	uint8_t *heap;
+	char *str;
 	int status;
-	uint8_t buffer[PFM_V2.manifest.plat_id_len];
-	uint8_t *element = buffer;
-	uint8_t format = 0xff;
-	uint8_t found = 0xff;
 
 	TEST_START;
 
-	manifest_flash_v2_testing_init_and_verify (test, &manifest, 0x10000, PFM_MAGIC_NUM,
-		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0, false, 0);
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
 
-	manifest_flash_v2_testing_read_element (test, &manifest, &PFM_V2.manifest,
-		PFM_V2.manifest.plat_id_entry, 0, PFM_V2.manifest.plat_id_hash,
-		PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len, sizeof (buffer), 0);
+	mem = manifest_flash_alloc_query (&arena, 8);
+	CuAssertPtrNotNull (test, mem);
+	CuAssertIntEquals (test, true, arena_contains (&arena, mem));
 
-	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
-		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, &found, &format, NULL, &element,
-		sizeof (buffer));
-	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
-	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_entry, found);
-	CuAssertIntEquals (test, 1, format);
+	/* Allocations that don't fit in the arena come from the heap. */
+	heap = manifest_flash_calloc_query (&arena, 4, 4);
+	CuAssertPtrNotNull (test, heap);
+	CuAssertIntEquals (test, false, arena_contains (&arena, heap));
+	CuAssertIntEquals (test, 0, heap[0]);
+	CuAssertIntEquals (test, 0, heap[15]);
 
-	status = testing_validate_array (PFM_V2.manifest.plat_id, buffer, status);
-	CuAssertIntEquals (test, 0, status);
+	str = manifest_flash_strdup_query (&arena, "Test");
+	CuAssertPtrNotNull (test, str);
+	CuAssertIntEquals (test, true, arena_contains (&arena, str));
+	CuAssertStrEquals (test, "Test", str);
 
-	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+	CuAssertIntEquals (test, (ARENA_ALIGNMENT * 3) + 5, arena.used);
+
+	manifest_flash_free_query (str);
+	manifest_flash_free_query (heap);
+	manifest_flash_free_query (mem);
 }
 
-static void manifest_flash_v2_test_read_element_data_dynamic_allocation (CuTest *test)
+static void manifest_flash_v2_test_alloc_query_no_arena (CuTest *test)
 {
-	struct manifest_flash_v2_testing manifest;
-	int status;
-	uint8_t *element = NULL;
-	size_t total = 0;
-	uint8_t format = 0xff;
-	uint8_t found = 0xff;
+	uint8_t *mem;
+	char *str;
 
 	TEST_START;
 
-	manifest_flash_v2_testing_init_and_verify (test, &manifest, 0x10000, PFM_MAGIC_NUM,
-		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0, false, 0);
+	mem = manifest_flash_alloc_query (NULL, 4);
+	CuAssertPtrNotNull (test, mem);
+	CuAssertIntEquals (test, 0, ((uintptr_t) mem) % ARENA_ALIGNMENT);
 
-	manifest_flash_v2_testing_read_element (test, &manifest, &PFM_V2.manifest,
-		PFM_V2.manifest.plat_id_entry, 0, PFM_V2.manifest.plat_id_hash,
-		PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len, PFM_V2.manifest.plat_id_len,
-		0);
+	manifest_flash_free_query (mem);
+
+	mem = manifest_flash_calloc_query (NULL, 2, 4);
+	CuAssertPtrNotNull (test, mem);
+	CuAssertIntEquals (test, 0, mem[0]);
+	CuAssertIntEquals (test, 0, mem[7]);
+
+	str = manifest_flash_strdup_query (NULL, "Test");
+	CuAssertPtrNotNull (test, str);
+	CuAssertStrEquals (test, "Test", str);
+
+	manifest_flash_free_query (str);
+	manifest_flash_free_query (mem);
+}
+
+static void manifest_flash_v2_test_alloc_query_too_large (CuTest *test)
+{
+	struct arena arena;
+	uint64_t buffer[8];
+	void *mem;
+	int status;
+
+	TEST_START;
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	mem = manifest_flash_alloc_query (&arena, SIZE_MAX);
+	CuAssertPtrEquals (test, NULL, mem);
+
+	mem = manifest_flash_calloc_query (&arena, SIZE_MAX, 2);
+	CuAssertPtrEquals (test, NULL, mem);
+
+	mem = manifest_flash_calloc_query (NULL, 2, SIZE_MAX);
+	CuAssertPtrEquals (test, NULL, mem);
+
+	CuAssertIntEquals (test, 0, arena.used);
+}
+
+static void manifest_flash_v2_test_free_query_null (CuTest *test)
+{
+	TEST_START;
+
+	manifest_flash_free_query (NULL);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	uint8_t hash_out[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, toc_cache, sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_verify_manifest_toc_cache (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.raw + MANIFEST_V2_TOC_ENTRY_OFFSET, 0);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, hash_out, sizeof (hash_out));
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, true, manifest.test.toc_cache_valid);
+
+	status = testing_validate_array (PFM_V2.manifest.hash, hash_out, PFM_V2.manifest.hash_len);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (PFM_V2.manifest.raw + MANIFEST_V2_TOC_ENTRY_OFFSET, toc_cache,
+		PFM_V2.manifest.toc_hash_offset - MANIFEST_V2_TOC_ENTRY_OFFSET);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_exact_size (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[PFM_V2.manifest.toc_hash_offset - MANIFEST_V2_TOC_ENTRY_OFFSET];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, toc_cache, sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_verify_manifest_toc_cache (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.raw + MANIFEST_V2_TOC_ENTRY_OFFSET, 0);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, true, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_too_small (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[PFM_V2.manifest.toc_hash_offset - MANIFEST_V2_TOC_ENTRY_OFFSET - 1];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, toc_cache, sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_verify_manifest (test, &manifest, &PFM_V2.manifest, 0);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_disabled (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, toc_cache, sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, NULL, sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_verify_manifest (test, &manifest, &PFM_V2.manifest, 0);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_bad_signature (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, toc_cache, sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_verify_manifest_toc_cache (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.raw + MANIFEST_V2_TOC_ENTRY_OFFSET, RSA_ENGINE_BAD_SIGNATURE);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, RSA_ENGINE_BAD_SIGNATURE, status);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_precomputed_hash (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	const struct manifest_v2_testing_data *data = &PFM_V2.manifest;
+	uint32_t toc_entry_offset = MANIFEST_V2_TOC_ENTRY_OFFSET;
+	const uint8_t *plat_id = data->raw + data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, toc_cache, sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_set_verification_hash (&manifest.test, data->hash, data->hash_len);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Read manifest header. */
+	status = mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr), MOCK_ARG_NOT_NULL, MOCK_ARG (MANIFEST_V2_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->raw, data->length, 2);
+
+	/* Read manifest signature. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + data->sig_offset), MOCK_ARG_NOT_NULL, MOCK_ARG (data->sig_len));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->signature, data->sig_len, 2);
+
+	/* Read table of contents header. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + MANIFEST_V2_TOC_HDR_OFFSET), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_TOC_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->toc,
+		data->length - MANIFEST_V2_TOC_HDR_OFFSET, 2);
+
+	/* Load the table of contents into the cache. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + toc_entry_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (data->toc_hash_offset - toc_entry_offset));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->raw + toc_entry_offset,
+		data->toc_hash_offset - toc_entry_offset, 2);
+
+	/* Read table of contents hash. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + data->toc_hash_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (data->toc_hash_len));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->toc_hash,
+		data->length - data->toc_hash_offset, 2);
+
+	/* Read the platform ID header. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + data->plat_id_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_PLATFORM_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, data->plat_id,
+		data->length - data->plat_id_offset, 2);
+
+	/* Read the platform ID string. */
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (data->plat_id_str_len));
+	status |= mock_expect_output (&manifest.flash.mock, 1, plat_id,
+		data->length - data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE, 2);
+
+	status |= mock_expect (&manifest.verification.mock,
+		manifest.verification.base.verify_signature, &manifest.verification, 0,
+		MOCK_ARG_PTR_CONTAINS (data->hash, data->hash_len), MOCK_ARG (data->hash_len),
+		MOCK_ARG_PTR_CONTAINS (data->signature, data->sig_len), MOCK_ARG (data->sig_len));
+
+	CuAssertIntEquals (test, 0, status);
+
+	/* The cached data was not part of the precomputed hash, so it is not used. */
+	status = manifest_flash_verify (&manifest.test, &manifest.hash_mock.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_toc_read_error (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, toc_cache, sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr), MOCK_ARG_NOT_NULL, MOCK_ARG (MANIFEST_V2_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, PFM_V2.manifest.raw,
+		PFM_V2.manifest.length, 2);
+
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + PFM_V2.manifest.sig_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (PFM_V2.manifest.sig_len));
+	status |= mock_expect_output (&manifest.flash.mock, 1, PFM_V2.manifest.signature,
+		PFM_V2.manifest.sig_len, 2);
+
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + MANIFEST_V2_TOC_HDR_OFFSET), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_TOC_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, PFM_V2.manifest.toc,
+		PFM_V2.manifest.length - MANIFEST_V2_TOC_HDR_OFFSET, 2);
+
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash,
+		FLASH_READ_FAILED, MOCK_ARG (manifest.addr + MANIFEST_V2_TOC_ENTRY_OFFSET),
+		MOCK_ARG_NOT_NULL,
+		MOCK_ARG (PFM_V2.manifest.toc_hash_offset - MANIFEST_V2_TOC_ENTRY_OFFSET));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+	size_t total = 0;
+	uint8_t format = 0xff;
+	uint8_t found = 0xff;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, toc_cache, sizeof (toc_cache));
+
+	/* Only the element data should be read from flash. */
+	status = mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + PFM_V2.manifest.plat_id_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (sizeof (buffer)));
+	status |= mock_expect_output (&manifest.flash.mock, 1, PFM_V2.manifest.plat_id,
+		PFM_V2.manifest.plat_id_len, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, &found, &format, &total, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_entry, found);
+	CuAssertIntEquals (test, 1, format);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, total);
+
+	status = testing_validate_array (PFM_V2.manifest.plat_id, buffer, status);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_with_start_offset (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+	uint8_t found = 0xff;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, toc_cache, sizeof (toc_cache));
+
+	status = mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + PFM_V2.manifest.plat_id_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (sizeof (buffer)));
+	status |= mock_expect_output (&manifest.flash.mock, 1, PFM_V2.manifest.plat_id,
+		PFM_V2.manifest.plat_id_len, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, PFM_V2.manifest.plat_id_entry, MANIFEST_NO_PARENT, 0, &found, NULL,
+		NULL, &element, sizeof (buffer));
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_entry, found);
+
+	status = testing_validate_array (PFM_V2.manifest.plat_id, buffer, status);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_element_not_found (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, toc_cache, sizeof (toc_cache));
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, PFM_V2.manifest.plat_id_entry + 1, MANIFEST_NO_PARENT, 0, NULL, NULL,
+		NULL, &element, sizeof (buffer));
+	CuAssertIntEquals (test, MANIFEST_ELEMENT_NOT_FOUND, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_child_not_found (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, toc_cache, sizeof (toc_cache));
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, PFM_FIRMWARE, 0, NULL, NULL, NULL, &element, sizeof (buffer));
+	CuAssertIntEquals (test, MANIFEST_CHILD_NOT_FOUND, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_element_invalid (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t bad_data[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+
+	TEST_START;
+
+	memcpy (bad_data, PFM_V2.manifest.plat_id, sizeof (bad_data));
+	bad_data[sizeof (bad_data) - 1] ^= 0x55;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, toc_cache, sizeof (toc_cache));
+
+	status = mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + PFM_V2.manifest.plat_id_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (sizeof (buffer)));
+	status |= mock_expect_output (&manifest.flash.mock, 1, bad_data, sizeof (bad_data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, NULL, NULL, NULL, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, MANIFEST_ELEMENT_INVALID, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_no_found_output (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+	size_t total = 0;
+	uint8_t format = 0xff;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0, false, 0);
+
+	manifest_flash_v2_testing_read_element (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.plat_id_entry, 0, PFM_V2.manifest.plat_id_hash,
+		PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len, sizeof (buffer), 0);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, NULL, &format, &total, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
+	CuAssertIntEquals (test, 1, format);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, total);
+
+	status = testing_validate_array (PFM_V2.manifest.plat_id, buffer, status);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_no_format_output (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+	size_t total = 0;
+	uint8_t found = 0xff;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0, false, 0);
+
+	manifest_flash_v2_testing_read_element (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.plat_id_entry, 0, PFM_V2.manifest.plat_id_hash,
+		PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len, sizeof (buffer), 0);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, &found, NULL, &total, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_entry, found);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, total);
+
+	status = testing_validate_array (PFM_V2.manifest.plat_id, buffer, status);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_no_total_length_output (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+	uint8_t format = 0xff;
+	uint8_t found = 0xff;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0, false, 0);
+
+	manifest_flash_v2_testing_read_element (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.plat_id_entry, 0, PFM_V2.manifest.plat_id_hash,
+		PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len, sizeof (buffer), 0);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, &found, &format, NULL, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_entry, found);
+	CuAssertIntEquals (test, 1, format);
+
+	status = testing_validate_array (PFM_V2.manifest.plat_id, buffer, status);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_dynamic_allocation (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t *element = NULL;
+	size_t total = 0;
+	uint8_t format = 0xff;
+	uint8_t found = 0xff;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0, false, 0);
+
+	manifest_flash_v2_testing_read_element (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.plat_id_entry, 0, PFM_V2.manifest.plat_id_hash,
+		PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len, PFM_V2.manifest.plat_id_len,
+		0);
 
 	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
 		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, &found, &format, &total, &element, 0);
@@ -7665,6 +8418,26 @@ static void manifest_flash_v2_test_get_num_child_elements_no_child_len (CuTest *
 	manifest_flash_v2_testing_validate_and_release (test, &manifest);
 }
 
+static void manifest_flash_v2_test_get_num_child_elements_toc_cache (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	size_t child_len;
+	int status = 0;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, CFM_MAGIC_NUM,
+		CFM_V2_MAGIC_NUM, &CFM_TESTING.manifest, toc_cache, sizeof (toc_cache));
+
+	status = manifest_flash_get_num_child_elements (&manifest.test, &manifest.hash.base, 2,
+		CFM_COMPONENT_DEVICE, MANIFEST_NO_PARENT, CFM_PMR_DIGEST, &child_len);
+	CuAssertIntEquals (test, 2, status);
+	CuAssertIntEquals (test, 0x88, child_len);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
 static void manifest_flash_v2_test_get_num_child_elements_first_child (CuTest *test)
 {
 	struct manifest_flash_v2_testing manifest;
@@ -8251,8 +9024,15 @@ TEST (manifest_flash_v2_test_init);
 TEST (manifest_flash_v2_test_init_null);
 TEST (manifest_flash_v2_test_init_not_aligned);
 TEST (manifest_flash_v2_test_init_block_size_error);
+TEST (manifest_flash_v2_test_enable_toc_cache_null);
+TEST (manifest_flash_v2_test_alloc_query_arena);
+TEST (manifest_flash_v2_test_alloc_query_arena_full);
+TEST (manifest_flash_v2_test_alloc_query_no_arena);
+TEST (manifest_flash_v2_test_alloc_query_too_large);
+TEST (manifest_flash_v2_test_free_query_null);
 TEST (manifest_flash_v2_test_verify);
 TEST (manifest_flash_v2_test_verify_with_mock_hash);
+TEST (manifest_flash_v2_test_verify_precomputed_hash);
 TEST (manifest_flash_v2_test_verify_platform_id_first);
 TEST (manifest_flash_v2_test_verify_ecc_signature);
 TEST (manifest_flash_v2_test_verify_sha384);
@@ -8303,6 +9083,13 @@ TEST (manifest_flash_v2_test_verify_platform_id_hash_error);
 TEST (manifest_flash_v2_test_verify_manifest_part2_read_error);
 TEST (manifest_flash_v2_test_verify_finish_hash_error);
 TEST (manifest_flash_v2_test_verify_finish_hash_error_with_hash_out);
+TEST (manifest_flash_v2_test_verify_toc_cache);
+TEST (manifest_flash_v2_test_verify_toc_cache_exact_size);
+TEST (manifest_flash_v2_test_verify_toc_cache_too_small);
+TEST (manifest_flash_v2_test_verify_toc_cache_disabled);
+TEST (manifest_flash_v2_test_verify_toc_cache_bad_signature);
+TEST (manifest_flash_v2_test_verify_toc_cache_precomputed_hash);
+TEST (manifest_flash_v2_test_verify_toc_cache_toc_read_error);
 TEST (manifest_flash_v2_test_get_id);
 TEST (manifest_flash_v2_test_get_id_null);
 TEST (manifest_flash_v2_test_get_id_verify_never_run);
@@ -8355,6 +9142,11 @@ TEST (manifest_flash_v2_test_get_signature_sig_same_length_as_manifest);
 TEST (manifest_flash_v2_test_get_signature_sig_length_into_header);
 TEST (manifest_flash_v2_test_get_signature_read_error);
 TEST (manifest_flash_v2_test_read_element_data);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_with_start_offset);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_element_not_found);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_child_not_found);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_element_invalid);
 TEST (manifest_flash_v2_test_read_element_data_no_found_output);
 TEST (manifest_flash_v2_test_read_element_data_no_format_output);
 TEST (manifest_flash_v2_test_read_element_data_no_total_length_output);
@@ -8426,6 +9218,7 @@ TEST (manifest_flash_v2_test_compare_platform_id_null_manifest2);
 TEST (manifest_flash_v2_test_compare_platform_id_both_null);
 TEST (manifest_flash_v2_test_get_num_child_elements_no_child_len);
 TEST (manifest_flash_v2_test_get_num_child_elements_first_child);
+TEST (manifest_flash_v2_test_get_num_child_elements_toc_cache);
 TEST (manifest_flash_v2_test_get_num_child_elements_not_first_child);
 TEST (manifest_flash_v2_test_get_num_child_elements_entry_with_nested_child);
 TEST (manifest_flash_v2_test_get_num_child_elements_get_nested_child_count);
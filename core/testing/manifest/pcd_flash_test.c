@@ -1625,7 +1625,7 @@ static void pcd_flash_testing_init (CuTest *test, struct pcd_flash_testing *pcd,
 
 	status = pcd_flash_init (&pcd->test, &pcd->manifest.flash.base, &pcd->manifest.hash.base,
 		address, pcd->manifest.signature, sizeof (pcd->manifest.signature),
-		pcd->manifest.platform_id, sizeof (pcd->manifest.platform_id));
+		pcd->manifest.platform_id, sizeof (pcd->manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&pcd->manifest.flash.mock);
@@ -1707,7 +1707,7 @@ static void pcd_flash_test_init (CuTest *test)
 
 	status = pcd_flash_init (&pcd.test, &pcd.manifest.flash.base, &pcd.manifest.hash.base, 0x10000,
 		pcd.manifest.signature, sizeof (pcd.manifest.signature), pcd.manifest.platform_id,
-		sizeof (pcd.manifest.platform_id));
+		sizeof (pcd.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	CuAssertPtrNotNull (test, pcd.test.base.base.verify);
@@ -1729,6 +1729,29 @@ static void pcd_flash_test_init (CuTest *test)
 	pcd_flash_testing_validate_and_release (test, &pcd);
 }
 
+static void pcd_flash_test_init_toc_cache (CuTest *test)
+{
+	struct pcd_flash_testing pcd;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+
+	TEST_START;
+
+	pcd_flash_testing_init_dependencies (test, &pcd, 0x10000);
+	manifest_flash_v2_testing_init_common (test, &pcd.manifest, 0x1000);
+
+	status = pcd_flash_init (&pcd.test, &pcd.manifest.flash.base, &pcd.manifest.hash.base, 0x10000,
+		pcd.manifest.signature, sizeof (pcd.manifest.signature), pcd.manifest.platform_id,
+		sizeof (pcd.manifest.platform_id), toc_cache, sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, toc_cache, pcd.test.base_flash.toc_cache);
+	CuAssertIntEquals (test, sizeof (toc_cache), pcd.test.base_flash.max_toc_cache);
+	CuAssertIntEquals (test, false, pcd.test.base_flash.toc_cache_valid);
+
+	pcd_flash_testing_validate_and_release (test, &pcd);
+}
+
 static void pcd_flash_test_init_null (CuTest *test)
 {
 	struct pcd_flash_testing pcd;
@@ -1740,27 +1763,27 @@ static void pcd_flash_test_init_null (CuTest *test)
 
 	status = pcd_flash_init (NULL, &pcd.manifest.flash.base, &pcd.manifest.hash.base, 0x10000,
 		pcd.manifest.signature, sizeof (pcd.manifest.signature), pcd.manifest.platform_id,
-		sizeof (pcd.manifest.platform_id));
+		sizeof (pcd.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, PCD_INVALID_ARGUMENT, status);
 
 	status = pcd_flash_init (&pcd.test, NULL, &pcd.manifest.hash.base, 0x10000,
 		pcd.manifest.signature, sizeof (pcd.manifest.signature), pcd.manifest.platform_id,
-		sizeof (pcd.manifest.platform_id));
+		sizeof (pcd.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
 
 	status = pcd_flash_init (&pcd.test, &pcd.manifest.flash.base, NULL, 0x10000,
 		pcd.manifest.signature, sizeof (pcd.manifest.signature), pcd.manifest.platform_id,
-		sizeof (pcd.manifest.platform_id));
+		sizeof (pcd.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
 
 	status = pcd_flash_init (&pcd.test, &pcd.manifest.flash.base, &pcd.manifest.hash.base, 0x10000,
 		NULL, sizeof (pcd.manifest.signature), pcd.manifest.platform_id,
-		sizeof (pcd.manifest.platform_id));
+		sizeof (pcd.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, PCD_INVALID_ARGUMENT, status);
 
 	status = pcd_flash_init (&pcd.test, NULL, &pcd.manifest.hash.base, 0x10000,
 		pcd.manifest.signature, sizeof (pcd.manifest.signature), NULL,
-		sizeof (pcd.manifest.platform_id));
+		sizeof (pcd.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, PCD_INVALID_ARGUMENT, status);
 
 	pcd_flash_testing_validate_and_release_dependencies (test, &pcd);
@@ -1778,7 +1801,7 @@ static void pcd_flash_test_init_manifest_flash_init_fail (CuTest *test)
 
 	status = pcd_flash_init (&pcd.test, &pcd.manifest.flash.base, &pcd.manifest.hash.base, 0x10001,
 		pcd.manifest.signature, sizeof (pcd.manifest.signature), pcd.manifest.platform_id,
-		sizeof (pcd.manifest.platform_id));
+		sizeof (pcd.manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_STORAGE_NOT_ALIGNED, status);
 
 	pcd_flash_testing_validate_and_release_dependencies (test, &pcd);
@@ -3353,6 +3376,7 @@ static void pcd_flash_test_is_empty_verify_never_run (CuTest *test)
 TEST_SUITE_START (pcd_flash);
 
 TEST (pcd_flash_test_init);
+TEST (pcd_flash_test_init_toc_cache);
 TEST (pcd_flash_test_init_null);
 TEST (pcd_flash_test_init_manifest_flash_init_fail);
 TEST (pcd_flash_test_release_null);
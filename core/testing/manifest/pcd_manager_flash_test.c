@@ -127,12 +127,12 @@ static void pcd_manager_flash_testing_init_dependencies (CuTest *test,
 
 	status = pcd_flash_init (&manager->pcd1, &manager->flash.base, &manager->hash.base, addr1,
 		manager->signature1, sizeof (manager->signature1), manager->platform_id1,
-		sizeof (manager->platform_id1));
+		sizeof (manager->platform_id1), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = pcd_flash_init (&manager->pcd2, &manager->flash.base, &manager->hash.base, addr2,
 		manager->signature2, sizeof (manager->signature2), manager->platform_id2,
-		sizeof (manager->platform_id2));
+		sizeof (manager->platform_id2), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = pcd_observer_mock_init (&manager->observer);
@@ -295,7 +295,7 @@ static void pfm_flash_testing_init (CuTest *test, struct pfm_flash_testing *pfm,
 	pfm_flash_testing_init_dependencies (test, pfm, address);
 
 	status = pfm_flash_init (&pfm->test, &pfm->flash.base, &pfm->hash.base, address, pfm->signature,
-		sizeof (pfm->signature), pfm->platform_id, sizeof (pfm->platform_id));
+		sizeof (pfm->signature), pfm->platform_id, sizeof (pfm->platform_id), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&pfm->flash_mock.mock);
@@ -453,7 +453,7 @@ static void pfm_flash_test_init (CuTest *test)
 	pfm_flash_testing_init_dependencies (test, &pfm, 0x10000);
 
 	status = pfm_flash_init (&pfm.test, &pfm.flash.base, &pfm.hash.base, 0x10000, pfm.signature,
-		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id));
+		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	CuAssertPtrNotNull (test, pfm.test.base.base.verify);
@@ -480,6 +480,28 @@ static void pfm_flash_test_init (CuTest *test)
 	pfm_flash_testing_validate_and_release (test, &pfm);
 }
 
+static void pfm_flash_test_init_toc_cache (CuTest *test)
+{
+	struct pfm_flash_testing pfm;
+	uint8_t toc_cache[MANIFEST_FLASH_TOC_CACHE_MAX_SIZE];
+	int status;
+
+	TEST_START;
+
+	pfm_flash_testing_init_dependencies (test, &pfm, 0x10000);
+
+	status = pfm_flash_init (&pfm.test, &pfm.flash.base, &pfm.hash.base, 0x10000, pfm.signature,
+		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id), toc_cache,
+		sizeof (toc_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, toc_cache, pfm.test.base_flash.toc_cache);
+	CuAssertIntEquals (test, sizeof (toc_cache), pfm.test.base_flash.max_toc_cache);
+	CuAssertIntEquals (test, false, pfm.test.base_flash.toc_cache_valid);
+
+	pfm_flash_testing_validate_and_release (test, &pfm);
+}
+
 static void pfm_flash_test_init_null (CuTest *test)
 {
 	struct pfm_flash_testing pfm;
@@ -490,23 +512,23 @@ static void pfm_flash_test_init_null (CuTest *test)
 	pfm_flash_testing_init_dependencies (test, &pfm, 0x10000);
 
 	status = pfm_flash_init (NULL, &pfm.flash.base, &pfm.hash.base, 0x10000, pfm.signature,
-		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id));
+		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id), NULL, 0);
 	CuAssertIntEquals (test, PFM_INVALID_ARGUMENT, status);
 
 	status = pfm_flash_init (&pfm.test, NULL, &pfm.hash.base, 0x10000, pfm.signature,
-		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id));
+		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
 
 	status = pfm_flash_init (&pfm.test, &pfm.flash.base, NULL, 0x10000, pfm.signature,
-		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id));
+		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
 
 	status = pfm_flash_init (&pfm.test, &pfm.flash.base, &pfm.hash.base, 0x10000, NULL,
-		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id));
+		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
 
 	status = pfm_flash_init (&pfm.test, &pfm.flash.base, &pfm.hash.base, 0x10000, pfm.signature,
-		sizeof (pfm.signature), NULL, sizeof (pfm.platform_id));
+		sizeof (pfm.signature), NULL, sizeof (pfm.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
 
 	pfm_flash_testing_validate_and_release_dependencies (test, &pfm);
@@ -522,7 +544,7 @@ static void pfm_flash_test_init_not_block_aligned (CuTest *test)
 	pfm_flash_testing_init_dependencies (test, &pfm, 0x10001);
 
 	status = pfm_flash_init (&pfm.test, &pfm.flash.base, &pfm.hash.base, 0x10001, pfm.signature,
-		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id));
+		sizeof (pfm.signature), pfm.platform_id, sizeof (pfm.platform_id), NULL, 0);
 	CuAssertIntEquals (test, MANIFEST_STORAGE_NOT_ALIGNED, status);
 
 	pfm_flash_testing_validate_and_release_dependencies (test, &pfm);
@@ -618,7 +640,7 @@ static void pfm_flash_test_verify_minimum_platform_id_buffer_length (CuTest *tes
 	pfm_flash_testing_init_dependencies (test, &pfm, 0x10000);
 
 	status = pfm_flash_init (&pfm.test, &pfm.flash.base, &pfm.hash.base, 0x10000, pfm.signature,
-		sizeof (pfm.signature), pfm.platform_id, strlen (PFM_PLATFORM_ID) + 1);
+		sizeof (pfm.signature), pfm.platform_id, strlen (PFM_PLATFORM_ID) + 1, NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&pfm.flash_mock.mock);
@@ -840,7 +862,7 @@ static void pfm_flash_test_verify_platform_id_too_long (CuTest *test)
 	pfm_flash_testing_init_dependencies (test, &pfm, 0x10000);
 
 	status = pfm_flash_init (&pfm.test, &pfm.flash.base, &pfm.hash.base, 0x10000, pfm.signature,
-		sizeof (pfm.signature), pfm.platform_id, strlen (PFM_PLATFORM_ID));
+		sizeof (pfm.signature), pfm.platform_id, strlen (PFM_PLATFORM_ID), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&pfm.flash_mock, 0, &WIP_STATUS, 1,
@@ -1953,7 +1975,7 @@ static void pfm_flash_test_get_id_after_verify_platform_id_too_long (CuTest *tes
 	pfm_flash_testing_init_dependencies (test, &pfm, 0x10000);
 
 	status = pfm_flash_init (&pfm.test, &pfm.flash.base, &pfm.hash.base, 0x10000, pfm.signature,
-		sizeof (pfm.signature), pfm.platform_id, strlen (PFM_PLATFORM_ID) + 1);
+		sizeof (pfm.signature), pfm.platform_id, strlen (PFM_PLATFORM_ID) + 1, NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	pfm_flash_testing_verify_pfm (test, &pfm, PFM_DATA, PFM_DATA_LEN, PFM_HASH, PFM_SIGNATURE,
@@ -8969,6 +8991,7 @@ static void pfm_flash_test_is_empty_bad_magic_num (CuTest *test)
 TEST_SUITE_START (pfm_flash);
 
 TEST (pfm_flash_test_init);
+TEST (pfm_flash_test_init_toc_cache);
 TEST (pfm_flash_test_init_null);
 TEST (pfm_flash_test_init_not_block_aligned);
 TEST (pfm_flash_test_release_null);
@@ -2634,7 +2634,7 @@ static const struct pfm_v2_testing_data_image PFM_V2_FW_IMG_MULTIPLE_12[] = {
 		.hash = PFM_V2_MULTIPLE_DATA + 0x0414,
 		.hash_len = 32,
 		.hash_type = HASH_TYPE_SHA256,
-		.flags = 0,
+		.flags = 1,
 		.region_count = 1,
 		.region = PFM_V2_IMG1_22_REGION
 	}
@@ -5935,7 +5935,7 @@ static void pfm_flash_v2_testing_init (CuTest *test, struct pfm_flash_v2_testing
 
 	status = pfm_flash_init (&pfm->test, &pfm->manifest.flash.base, &pfm->manifest.hash.base,
 		0x10000, pfm->manifest.signature, sizeof (pfm->manifest.signature),
-		pfm->manifest.platform_id, sizeof (pfm->manifest.platform_id));
+		pfm->manifest.platform_id, sizeof (pfm->manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 }
 
@@ -5956,7 +5956,7 @@ static void pfm_flash_v2_testing_init_mocked_hash (CuTest *test, struct pfm_flas
 
 	status = pfm_flash_init (&pfm->test, &pfm->manifest.flash.base, &pfm->manifest.hash_mock.base,
 		0x10000, pfm->manifest.signature, sizeof (pfm->manifest.signature),
-		pfm->manifest.platform_id, sizeof (pfm->manifest.platform_id));
+		pfm->manifest.platform_id, sizeof (pfm->manifest.platform_id), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 }
 
@@ -6179,6 +6179,141 @@ static void pfm_flash_v2_testing_find_version_entry_mocked_hash (CuTest *test,
 	}
 }
 
+/**
+ * Set up expectations for building the in-memory index of a v2 PFM.  Building the index will read
+ * all firmware components, versions, read/write regions, and images from the PFM.
+ *
+ * @param test The testing framework.
+ * @param pfm The components for testing.
+ * @param data Manifest data for the test.
+ */
+static void pfm_flash_v2_testing_build_index (CuTest *test, struct pfm_flash_v2_testing *pfm,
+	const struct pfm_v2_testing_data *data)
+{
+	int i;
+	int j;
+
+	if (data->fw_count == 0) {
+		return;
+	}
+
+	/* Get the list of all FW entries. */
+	pfm_flash_v2_testing_find_firmware_entry (test, pfm, data, data->fw_count - 1);
+
+	for (i = 0; i < data->fw_count; i++) {
+		/* Read all versions for each firmware component. */
+		if (data->fw[i].version_count == 0) {
+			pfm_flash_v2_testing_find_firmware_entry (test, pfm, data, i);
+		}
+		else {
+			pfm_flash_v2_testing_find_version_entry (test, pfm, data, i,
+				data->fw[i].version_count - 1);
+		}
+
+		/* Read the R/W regions and images for each version. */
+		for (j = 0; j < data->fw[i].version_count; j++) {
+			pfm_flash_v2_testing_find_version_entry (test, pfm, data, i, j);
+			pfm_flash_v2_testing_find_version_entry (test, pfm, data, i, j);
+		}
+	}
+}
+
+/**
+ * Check the information reported by the PFM against the expected PFM data.  The PFM must have been
+ * indexed, since no flash accesses are expected.
+ *
+ * @param test The testing framework.
+ * @param pfm The components for testing.
+ * @param data Manifest data for the test.
+ */
+static void pfm_flash_v2_testing_check_index (CuTest *test, struct pfm_flash_v2_testing *pfm,
+	const struct pfm_v2_testing_data *data)
+{
+	const struct pfm_v2_testing_data_fw_ver *version;
+	struct pfm_firmware fw;
+	struct pfm_firmware_versions ver_list;
+	struct pfm_read_write_regions writable;
+	struct pfm_image_list img_list;
+	int status;
+	int i;
+	int j;
+	int k;
+	int m;
+
+	status = pfm->test.base.get_firmware (&pfm->test.base, &fw);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, data->fw_count, fw.count);
+	CuAssertPtrEquals (test, (void*) pfm->test.index->fw.ids, (void*) fw.ids);
+
+	for (i = 0; i < data->fw_count; i++) {
+		CuAssertStrEquals (test, data->fw[i].fw_id_str, fw.ids[i]);
+
+		status = pfm->test.base.get_supported_versions (&pfm->test.base, data->fw[i].fw_id_str,
+			&ver_list);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertIntEquals (test, data->fw[i].version_count, ver_list.count);
+
+		for (j = 0; j < data->fw[i].version_count; j++) {
+			version = &data->fw[i].version[j];
+
+			CuAssertStrEquals (test, version->version_str, ver_list.versions[j].fw_version_id);
+			CuAssertIntEquals (test, version->version_addr, ver_list.versions[j].version_addr);
+			CuAssertIntEquals (test, data->blank_byte, ver_list.versions[j].blank_byte);
+
+			status = pfm->test.base.get_read_write_regions (&pfm->test.base,
+				data->fw[i].fw_id_str, version->version_str, &writable);
+			CuAssertIntEquals (test, 0, status);
+			CuAssertIntEquals (test, version->rw_count, writable.count);
+
+			for (k = 0; k < version->rw_count; k++) {
+				CuAssertIntEquals (test, version->rw[k].start_addr, writable.regions[k].start_addr);
+				CuAssertIntEquals (test, PFM_V2_TESTING_REGION_LENGTH (&version->rw[k]),
+					writable.regions[k].length);
+				CuAssertIntEquals (test, version->rw[k].flags, writable.properties[k].on_failure);
+			}
+
+			pfm->test.base.free_read_write_regions (&pfm->test.base, &writable);
+
+			status = pfm->test.base.get_firmware_images (&pfm->test.base, data->fw[i].fw_id_str,
+				version->version_str, &img_list);
+			CuAssertIntEquals (test, 0, status);
+			CuAssertIntEquals (test, version->img_count, img_list.count);
+			CuAssertPtrEquals (test, NULL, (void*) img_list.images_sig);
+
+			for (k = 0; k < version->img_count; k++) {
+				CuAssertIntEquals (test, version->img[k].region_count,
+					img_list.images_hash[k].count);
+				for (m = 0; m < version->img[k].region_count; m++) {
+					CuAssertIntEquals (test, version->img[k].region[m].start_addr,
+						img_list.images_hash[k].regions[m].start_addr);
+					CuAssertIntEquals (test,
+						PFM_V2_TESTING_REGION_LENGTH (&version->img[k].region[m]),
+						img_list.images_hash[k].regions[m].length);
+				}
+
+				CuAssertIntEquals (test, version->img[k].hash_type,
+					img_list.images_hash[k].hash_type);
+				CuAssertIntEquals (test, version->img[k].hash_len,
+					img_list.images_hash[k].hash_length);
+
+				status = testing_validate_array (version->img[k].hash,
+					img_list.images_hash[k].hash, img_list.images_hash[k].hash_length);
+				CuAssertIntEquals (test, 0, status);
+
+				CuAssertIntEquals (test, version->img[k].flags & 0x01,
+					img_list.images_hash[k].always_validate);
+			}
+
+			pfm->test.base.free_firmware_images (&pfm->test.base, &img_list);
+		}
+
+		pfm->test.base.free_fw_versions (&pfm->test.base, &ver_list);
+	}
+
+	pfm->test.base.free_firmware (&pfm->test.base, &fw);
+	CuAssertIntEquals (test, 0, pfm->test.index->refs);
+}
+
 /*******************
  * Test cases
  *******************/
@@ -12466,6 +12601,836 @@ static void pfm_flash_v2_test_is_empty_verify_never_run (CuTest *test)
 	pfm_flash_v2_testing_validate_and_release (test, &pfm);
 }
 
+static void pfm_flash_v2_test_build_index (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	status = mock_validate (&pfm.manifest.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_check_index (test, &pfm, test_pfm);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_multiple_firmware (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_TWO_FW;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	status = mock_validate (&pfm.manifest.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_check_index (test, &pfm, test_pfm);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_multiple_versions (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_MULTIPLE;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	status = mock_validate (&pfm.manifest.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_check_index (test, &pfm, test_pfm);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_no_versions (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_THREE_FW_NO_VER;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	status = mock_validate (&pfm.manifest.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_check_index (test, &pfm, test_pfm);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_no_flash_dev_element (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_NO_FLASH_DEV;
+	int status;
+	struct pfm_firmware fw;
+	struct pfm_firmware_versions ver_list;
+	struct pfm_read_write_regions writable;
+	struct pfm_image_list img_list;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	status = pfm.test.base.get_firmware (&pfm.test.base, &fw);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, fw.count);
+	CuAssertPtrEquals (test, NULL, (void*) fw.ids);
+
+	pfm.test.base.free_firmware (&pfm.test.base, &fw);
+
+	status = pfm.test.base.get_supported_versions (&pfm.test.base, NULL, &ver_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, ver_list.count);
+	CuAssertPtrEquals (test, NULL, (void*) ver_list.versions);
+
+	status = pfm.test.base.get_supported_versions (&pfm.test.base, "Firmware", &ver_list);
+	CuAssertIntEquals (test, PFM_UNKNOWN_FIRMWARE, status);
+
+	status = pfm.test.base.get_read_write_regions (&pfm.test.base, NULL, "1234", &writable);
+	CuAssertIntEquals (test, PFM_UNKNOWN_FIRMWARE, status);
+
+	status = pfm.test.base.get_firmware_images (&pfm.test.base, NULL, "1234", &img_list);
+	CuAssertIntEquals (test, PFM_UNKNOWN_FIRMWARE, status);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_null_firmware_id (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_TWO_FW;
+	int status;
+	struct pfm_firmware_versions ver_list;
+	struct pfm_read_write_regions writable;
+	struct pfm_image_list img_list;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.get_supported_versions (&pfm.test.base, NULL, &ver_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[0].version_count, ver_list.count);
+	CuAssertStrEquals (test, test_pfm->fw[0].version[0].version_str,
+		ver_list.versions[0].fw_version_id);
+
+	pfm.test.base.free_fw_versions (&pfm.test.base, &ver_list);
+
+	status = pfm.test.base.get_read_write_regions (&pfm.test.base, NULL,
+		test_pfm->fw[0].version[0].version_str, &writable);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[0].version[0].rw_count, writable.count);
+
+	pfm.test.base.free_read_write_regions (&pfm.test.base, &writable);
+
+	status = pfm.test.base.get_firmware_images (&pfm.test.base, NULL,
+		test_pfm->fw[0].version[0].version_str, &img_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[0].version[0].img_count, img_list.count);
+
+	pfm.test.base.free_firmware_images (&pfm.test.base, &img_list);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_unknown_firmware (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_TWO_FW;
+	int status;
+	struct pfm_firmware_versions ver_list;
+	struct pfm_read_write_regions writable;
+	struct pfm_image_list img_list;
+	uint8_t buffer[256];
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.get_supported_versions (&pfm.test.base, "Bad", &ver_list);
+	CuAssertIntEquals (test, PFM_UNKNOWN_FIRMWARE, status);
+
+	status = pfm.test.base.buffer_supported_versions (&pfm.test.base, "Bad", 0, sizeof (buffer),
+		buffer);
+	CuAssertIntEquals (test, PFM_UNKNOWN_FIRMWARE, status);
+
+	status = pfm.test.base.get_read_write_regions (&pfm.test.base, "Bad",
+		test_pfm->fw[0].version[0].version_str, &writable);
+	CuAssertIntEquals (test, PFM_UNKNOWN_FIRMWARE, status);
+
+	status = pfm.test.base.get_firmware_images (&pfm.test.base, "Bad",
+		test_pfm->fw[0].version[0].version_str, &img_list);
+	CuAssertIntEquals (test, PFM_UNKNOWN_FIRMWARE, status);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_unknown_version (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_TWO_FW;
+	int status;
+	struct pfm_read_write_regions writable;
+	struct pfm_image_list img_list;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.get_read_write_regions (&pfm.test.base, test_pfm->fw[1].fw_id_str,
+		"Bad", &writable);
+	CuAssertIntEquals (test, PFM_UNSUPPORTED_VERSION, status);
+
+	status = pfm.test.base.get_firmware_images (&pfm.test.base, test_pfm->fw[1].fw_id_str, "Bad",
+		&img_list);
+	CuAssertIntEquals (test, PFM_UNSUPPORTED_VERSION, status);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_buffer_supported_versions (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_MULTIPLE;
+	int fw_index = 2;
+	int status;
+	uint8_t ver_list[256];
+	uint8_t expected[256];
+	int expected_len = 0;
+	int i;
+
+	TEST_START;
+
+	for (i = 0; i < test_pfm->fw[fw_index].version_count; i++) {
+		strcpy ((char*) &expected[expected_len], test_pfm->fw[fw_index].version[i].version_str);
+		expected_len += test_pfm->fw[fw_index].version[i].version_str_len + 1;
+	}
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.buffer_supported_versions (&pfm.test.base,
+		test_pfm->fw[fw_index].fw_id_str, 0, sizeof (ver_list), ver_list);
+	CuAssertIntEquals (test, expected_len, status);
+
+	status = testing_validate_array (expected, ver_list, status);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Partial read from the middle of the list. */
+	status = pfm.test.base.buffer_supported_versions (&pfm.test.base,
+		test_pfm->fw[fw_index].fw_id_str, 3, 4, ver_list);
+	CuAssertIntEquals (test, 4, status);
+
+	status = testing_validate_array (&expected[3], ver_list, status);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_buffer_supported_versions_null_firmware_id (
+	CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_MULTIPLE;
+	int status;
+	uint8_t ver_list[256];
+	uint8_t expected[256];
+	int expected_len = 0;
+	int i;
+	int j;
+
+	TEST_START;
+
+	for (i = 0; i < test_pfm->fw_count; i++) {
+		strcpy ((char*) &expected[expected_len], test_pfm->fw[i].fw_id_str);
+		expected_len += test_pfm->fw[i].fw_id_str_len + 1;
+
+		for (j = 0; j < test_pfm->fw[i].version_count; j++) {
+			strcpy ((char*) &expected[expected_len], test_pfm->fw[i].version[j].version_str);
+			expected_len += test_pfm->fw[i].version[j].version_str_len + 1;
+		}
+	}
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.buffer_supported_versions (&pfm.test.base, NULL, 0, sizeof (ver_list),
+		ver_list);
+	CuAssertIntEquals (test, expected_len, status);
+
+	status = testing_validate_array (expected, ver_list, status);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Partial read spanning multiple firmware components. */
+	status = pfm.test.base.buffer_supported_versions (&pfm.test.base, NULL, 5,
+		expected_len - 10, ver_list);
+	CuAssertIntEquals (test, expected_len - 10, status);
+
+	status = testing_validate_array (&expected[5], ver_list, status);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_is_empty (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.base.is_empty (&pfm.test.base.base);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_twice (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_TWO_FW;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	status = mock_validate (&pfm.manifest.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_check_index (test, &pfm, test_pfm);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_verify_discards_index (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	pfm_flash_v2_testing_verify_pfm (test, &pfm, test_pfm, 0);
+
+	status = pfm.test.base.base.verify (&pfm.test.base.base, &pfm.manifest.hash.base,
+		&pfm.manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, pfm.test.index);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_query_before_index_free_after (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	int status;
+	struct pfm_firmware_versions ver_list;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	/* Lists allocated before the index was built must still be freed correctly. */
+	pfm_flash_v2_testing_find_version_entry (test, &pfm, test_pfm, 0,
+		test_pfm->fw[0].version_count - 1);
+
+	status = pfm.test.base.get_supported_versions (&pfm.test.base, test_pfm->fw[0].fw_id_str,
+		&ver_list);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm.test.base.free_fw_versions (&pfm.test.base, &ver_list);
+	CuAssertIntEquals (test, 0, ver_list.count);
+	CuAssertPtrEquals (test, NULL, (void*) ver_list.versions);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_query_then_discard_index (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	const struct pfm_v2_testing_data_fw_ver *version = &test_pfm->fw[0].version[0];
+	int status;
+	struct pfm_firmware fw;
+	struct pfm_firmware_versions ver_list;
+	struct pfm_read_write_regions writable;
+	struct pfm_image_list img_list;
+	struct pfm_flash_index *index;
+	int i;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	status = pfm.test.base.get_firmware (&pfm.test.base, &fw);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.get_supported_versions (&pfm.test.base, test_pfm->fw[0].fw_id_str,
+		&ver_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.get_read_write_regions (&pfm.test.base, test_pfm->fw[0].fw_id_str,
+		version->version_str, &writable);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.get_firmware_images (&pfm.test.base, test_pfm->fw[0].fw_id_str,
+		version->version_str, &img_list);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 4, pfm.test.index->refs);
+	index = pfm.test.index;
+
+	/* Query results reference the index, so it must not be freed until the results are. */
+	pfm_flash_discard_index (&pfm.test);
+	CuAssertPtrEquals (test, NULL, pfm.test.index);
+	CuAssertPtrEquals (test, index, pfm.test.retired);
+
+	CuAssertIntEquals (test, test_pfm->fw_count, fw.count);
+	CuAssertStrEquals (test, test_pfm->fw[0].fw_id_str, fw.ids[0]);
+
+	CuAssertIntEquals (test, test_pfm->fw[0].version_count, ver_list.count);
+	CuAssertStrEquals (test, version->version_str, ver_list.versions[0].fw_version_id);
+	CuAssertIntEquals (test, version->version_addr, ver_list.versions[0].version_addr);
+
+	CuAssertIntEquals (test, version->rw_count, writable.count);
+	for (i = 0; i < version->rw_count; i++) {
+		CuAssertIntEquals (test, version->rw[i].start_addr, writable.regions[i].start_addr);
+		CuAssertIntEquals (test, version->rw[i].flags, writable.properties[i].on_failure);
+	}
+
+	CuAssertIntEquals (test, version->img_count, img_list.count);
+	for (i = 0; i < version->img_count; i++) {
+		CuAssertIntEquals (test, version->img[i].region_count, img_list.images_hash[i].count);
+		CuAssertIntEquals (test, version->img[i].region[0].start_addr,
+			img_list.images_hash[i].regions[0].start_addr);
+
+		status = testing_validate_array (version->img[i].hash, img_list.images_hash[i].hash,
+			img_list.images_hash[i].hash_length);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	pfm.test.base.free_firmware_images (&pfm.test.base, &img_list);
+	pfm.test.base.free_read_write_regions (&pfm.test.base, &writable);
+	pfm.test.base.free_fw_versions (&pfm.test.base, &ver_list);
+	CuAssertPtrEquals (test, index, pfm.test.retired);
+	CuAssertIntEquals (test, 1, index->refs);
+
+	pfm.test.base.free_firmware (&pfm.test.base, &fw);
+	CuAssertPtrEquals (test, NULL, pfm.test.retired);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_query_then_rebuild_index (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	struct pfm_flash_index *index;
+	int status;
+	struct pfm_firmware fw1;
+	struct pfm_firmware fw2;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.get_firmware (&pfm.test.base, &fw1);
+	CuAssertIntEquals (test, 0, status);
+
+	index = pfm.test.index;
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+	CuAssertPtrEquals (test, index, pfm.test.retired);
+
+	status = pfm.test.base.get_firmware (&pfm.test.base, &fw2);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, (void*) pfm.test.index->fw.ids, (void*) fw2.ids);
+
+	CuAssertIntEquals (test, test_pfm->fw_count, fw1.count);
+	CuAssertStrEquals (test, test_pfm->fw[0].fw_id_str, fw1.ids[0]);
+
+	pfm.test.base.free_firmware (&pfm.test.base, &fw2);
+	CuAssertIntEquals (test, 0, pfm.test.index->refs);
+	CuAssertPtrEquals (test, index, pfm.test.retired);
+
+	pfm.test.base.free_firmware (&pfm.test.base, &fw1);
+	CuAssertPtrEquals (test, NULL, pfm.test.retired);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_query_then_release (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	int status;
+	struct pfm_firmware fw;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm.test.base.get_firmware (&pfm.test.base, &fw);
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_discard_index (&pfm.test);
+	CuAssertPtrNotNull (test, pfm.test.retired);
+
+	/* Releasing the PFM frees discarded indexes that are still referenced. */
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = pfm_flash_build_index (NULL);
+	CuAssertIntEquals (test, PFM_INVALID_ARGUMENT, status);
+}
+
+static void pfm_flash_v2_test_build_index_verify_never_run (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init (test, &pfm, 0x10000);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, MANIFEST_NO_MANIFEST, status);
+	CuAssertPtrEquals (test, NULL, pfm.test.index);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_read_error (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	status = mock_expect (&pfm.manifest.flash.mock, pfm.manifest.flash.base.read,
+		&pfm.manifest.flash, FLASH_READ_FAILED,
+		MOCK_ARG (pfm.manifest.addr + MANIFEST_V2_TOC_ENTRY_OFFSET), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_TOC_ENTRY_SIZE));
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	CuAssertPtrEquals (test, NULL, pfm.test.index);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_build_index_version_read_error (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	/* Get the list of all FW entries. */
+	pfm_flash_v2_testing_find_firmware_entry (test, &pfm, test_pfm, test_pfm->fw_count - 1);
+
+	/* Fail to find the firmware component for the version list. */
+	status = mock_expect (&pfm.manifest.flash.mock, pfm.manifest.flash.base.read,
+		&pfm.manifest.flash, FLASH_READ_FAILED,
+		MOCK_ARG (pfm.manifest.addr + MANIFEST_V2_TOC_ENTRY_OFFSET), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_TOC_ENTRY_SIZE));
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	CuAssertPtrEquals (test, NULL, pfm.test.index);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_query_arena (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	struct arena arena;
+	uint8_t buffer[1024];
+	struct pfm_firmware fw;
+	struct pfm_firmware_versions ver_list;
+	struct pfm_read_write_regions writable;
+	struct pfm_image_list img_list;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_find_firmware_entry (test, &pfm, test_pfm, test_pfm->fw_count - 1);
+
+	status = pfm_flash_get_firmware_arena (&pfm.test, &arena, &fw);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw_count, fw.count);
+	CuAssertIntEquals (test, true, arena_contains (&arena, fw.ids));
+	CuAssertIntEquals (test, true, arena_contains (&arena, fw.ids[0]));
+	CuAssertStrEquals (test, test_pfm->fw[0].fw_id_str, fw.ids[0]);
+
+	pfm_flash_v2_testing_find_version_entry (test, &pfm, test_pfm, 0,
+		test_pfm->fw[0].version_count - 1);
+
+	status = pfm_flash_get_supported_versions_arena (&pfm.test, &arena, test_pfm->fw[0].fw_id_str,
+		&ver_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[0].version_count, ver_list.count);
+	CuAssertIntEquals (test, true, arena_contains (&arena, ver_list.versions));
+	CuAssertIntEquals (test, true, arena_contains (&arena, ver_list.versions[0].fw_version_id));
+	CuAssertStrEquals (test, test_pfm->fw[0].version[0].version_str,
+		ver_list.versions[0].fw_version_id);
+
+	pfm_flash_v2_testing_find_version_entry (test, &pfm, test_pfm, 0, 0);
+
+	status = pfm_flash_get_read_write_regions_arena (&pfm.test, &arena, test_pfm->fw[0].fw_id_str,
+		test_pfm->fw[0].version[0].version_str, &writable);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[0].version[0].rw_count, writable.count);
+	CuAssertIntEquals (test, true, arena_contains (&arena, writable.regions));
+	CuAssertIntEquals (test, true, arena_contains (&arena, writable.properties));
+	CuAssertIntEquals (test, test_pfm->fw[0].version[0].rw[0].start_addr,
+		writable.regions[0].start_addr);
+
+	pfm_flash_v2_testing_find_version_entry (test, &pfm, test_pfm, 0, 0);
+
+	status = pfm_flash_get_firmware_images_arena (&pfm.test, &arena, test_pfm->fw[0].fw_id_str,
+		test_pfm->fw[0].version[0].version_str, &img_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[0].version[0].img_count, img_list.count);
+	CuAssertIntEquals (test, true, arena_contains (&arena, img_list.images_hash));
+	CuAssertIntEquals (test, true, arena_contains (&arena, img_list.images_hash[0].regions));
+	CuAssertIntEquals (test, test_pfm->fw[0].version[0].img[0].region[0].start_addr,
+		img_list.images_hash[0].regions[0].start_addr);
+
+	status = mock_validate (&pfm.manifest.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Freeing the results must not try to release arena memory to the heap. */
+	pfm.test.base.free_firmware_images (&pfm.test.base, &img_list);
+	pfm.test.base.free_read_write_regions (&pfm.test.base, &writable);
+	pfm.test.base.free_fw_versions (&pfm.test.base, &ver_list);
+	pfm.test.base.free_firmware (&pfm.test.base, &fw);
+
+	CuAssertTrue (test, (arena.used != 0));
+	arena_reset (&arena);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_query_arena_no_space (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	const struct pfm_v2_testing_data_fw_ver *version = &test_pfm->fw[0].version[0];
+	struct arena arena;
+	uint64_t buffer[(ARENA_ALIGNMENT + sizeof (struct pfm_image_hash)) / sizeof (uint64_t)];
+	struct pfm_image_list img_list;
+	int status;
+	int i;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_find_version_entry (test, &pfm, test_pfm, 0, 0);
+
+	/* The arena only has space for the image list, so the regions come from the heap. */
+	status = pfm_flash_get_firmware_images_arena (&pfm.test, &arena, test_pfm->fw[0].fw_id_str,
+		version->version_str, &img_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, version->img_count, img_list.count);
+	CuAssertIntEquals (test, true, arena_contains (&arena, img_list.images_hash));
+	CuAssertIntEquals (test, false, arena_contains (&arena, img_list.images_hash[0].regions));
+
+	for (i = 0; i < version->img_count; i++) {
+		CuAssertIntEquals (test, version->img[i].region[0].start_addr,
+			img_list.images_hash[i].regions[0].start_addr);
+	}
+
+	pfm.test.base.free_firmware_images (&pfm.test.base, &img_list);
+	arena_reset (&arena);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
+
+static void pfm_flash_v2_test_query_arena_build_index (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	struct arena arena;
+	uint8_t buffer[sizeof (struct pfm_image_hash)];
+	struct pfm_image_list img_list;
+	int status;
+
+	TEST_START;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	status = arena_init (&arena, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, 0, status);
+
+	pfm_flash_v2_testing_build_index (test, &pfm, test_pfm);
+
+	status = pfm_flash_build_index (&pfm.test);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, pfm.test.index);
+
+	status = mock_validate (&pfm.manifest.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Queries served from the index don't allocate anything from the arena. */
+	status = pfm_flash_get_firmware_images_arena (&pfm.test, &arena, test_pfm->fw[0].fw_id_str,
+		test_pfm->fw[0].version[0].version_str, &img_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, arena.used);
+	CuAssertIntEquals (test, 1, pfm.test.index->refs);
+
+	pfm.test.base.free_firmware_images (&pfm.test.base, &img_list);
+	CuAssertIntEquals (test, 0, pfm.test.index->refs);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+}
 
 TEST_SUITE_START (pfm_flash_v2);
 
@@ -12625,5 +13590,29 @@ TEST (pfm_flash_v2_test_is_empty_no_flash_dev_element);
 TEST (pfm_flash_v2_test_is_empty_no_firmware_entries);
 TEST (pfm_flash_v2_test_is_empty_null);
 TEST (pfm_flash_v2_test_is_empty_verify_never_run);
+TEST (pfm_flash_v2_test_build_index);
+TEST (pfm_flash_v2_test_build_index_multiple_firmware);
+TEST (pfm_flash_v2_test_build_index_multiple_versions);
+TEST (pfm_flash_v2_test_build_index_no_versions);
+TEST (pfm_flash_v2_test_build_index_no_flash_dev_element);
+TEST (pfm_flash_v2_test_build_index_null_firmware_id);
+TEST (pfm_flash_v2_test_build_index_unknown_firmware);
+TEST (pfm_flash_v2_test_build_index_unknown_version);
+TEST (pfm_flash_v2_test_build_index_buffer_supported_versions);
+TEST (pfm_flash_v2_test_build_index_buffer_supported_versions_null_firmware_id);
+TEST (pfm_flash_v2_test_build_index_is_empty);
+TEST (pfm_flash_v2_test_build_index_twice);
+TEST (pfm_flash_v2_test_build_index_verify_discards_index);
+TEST (pfm_flash_v2_test_build_index_query_before_index_free_after);
+TEST (pfm_flash_v2_test_build_index_query_then_discard_index);
+TEST (pfm_flash_v2_test_build_index_query_then_rebuild_index);
+TEST (pfm_flash_v2_test_build_index_query_then_release);
+TEST (pfm_flash_v2_test_build_index_null);
+TEST (pfm_flash_v2_test_build_index_verify_never_run);
+TEST (pfm_flash_v2_test_build_index_read_error);
+TEST (pfm_flash_v2_test_build_index_version_read_error);
+TEST (pfm_flash_v2_test_query_arena);
+TEST (pfm_flash_v2_test_query_arena_no_space);
+TEST (pfm_flash_v2_test_query_arena_build_index);
 
 TEST_SUITE_END;
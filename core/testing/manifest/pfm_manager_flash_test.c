@@ -285,12 +285,12 @@ static void pfm_manager_flash_testing_init_dependencies (CuTest *test,
 
 	status = pfm_flash_init (&manager->pfm1, &manager->flash.base, &manager->hash.base, addr1,
 		manager->signature1, sizeof (manager->signature1), manager->platform_id1,
-		sizeof (manager->platform_id1));
+		sizeof (manager->platform_id1), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = pfm_flash_init (&manager->pfm2, &manager->flash.base, &manager->hash.base, addr2,
 		manager->signature2, sizeof (manager->signature2), manager->platform_id2,
-		sizeof (manager->platform_id2));
+		sizeof (manager->platform_id2), NULL, 0);
 	CuAssertIntEquals (test, 0, status);
 
 	status = pfm_observer_mock_init (&manager->observer);
@@ -348,12 +348,13 @@ void pfm_manager_flash_testing_validate_and_release_dependencies (CuTest *test,
  * @param hash The PFM hash.
  * @param signature The PFM signature.
  * @param address The base address of the PFM.
+ * @param read_back Flag indicating if the PFM data will be read from flash to calculate the hash.
  *
  * @return 0 if the expectations were set up successfully or an error code.
  */
-static int pfm_manager_flash_testing_verify_pfm (struct pfm_manager_flash_testing *manager,
+static int pfm_manager_flash_testing_verify_pfm_ext (struct pfm_manager_flash_testing *manager,
 	const uint8_t *pfm, size_t length, const uint8_t *hash, const uint8_t *signature,
-	uint32_t address)
+	uint32_t address, bool read_back)
 {
 	int status;
 
@@ -368,8 +369,10 @@ static int pfm_manager_flash_testing_verify_pfm (struct pfm_manager_flash_testin
 		PFM_SIGNATURE_LEN,
 		FLASH_EXP_READ_CMD (0x03, address + PFM_SIGNATURE_OFFSET, 0, -1, PFM_SIGNATURE_LEN));
 
-	status |= flash_master_mock_expect_verify_flash (&manager->flash_mock, address, pfm,
-		length - PFM_SIGNATURE_LEN);
+	if (read_back) {
+		status |= flash_master_mock_expect_verify_flash (&manager->flash_mock, address, pfm,
+			length - PFM_SIGNATURE_LEN);
+	}
 
 	status |= mock_expect (&manager->verification.mock, manager->verification.base.verify_signature,
 		&manager->verification, 0, MOCK_ARG_PTR_CONTAINS (hash, PFM_HASH_LEN),
@@ -406,6 +409,26 @@ static int pfm_manager_flash_testing_verify_pfm (struct pfm_manager_flash_testin
 	return status;
 }
 
+/**
+ * Set up expectations for verifying a PFM on flash.
+ *
+ * @param manager The testing components.
+ * @param pfm The PFM data to read.
+ * @param length The length of the PFM data.
+ * @param hash The PFM hash.
+ * @param signature The PFM signature.
+ * @param address The base address of the PFM.
+ *
+ * @return 0 if the expectations were set up successfully or an error code.
+ */
+static int pfm_manager_flash_testing_verify_pfm (struct pfm_manager_flash_testing *manager,
+	const uint8_t *pfm, size_t length, const uint8_t *hash, const uint8_t *signature,
+	uint32_t address)
+{
+	return pfm_manager_flash_testing_verify_pfm_ext (manager, pfm, length, hash, signature,
+		address, true);
+}
+
 /**
  * Set up expectations for verifying an empty PFM on flash.
  *
@@ -3859,6 +3882,231 @@ static void pfm_manager_flash_test_verify_pending_pfm_extra_data_written (CuTest
 	pfm_manager_flash_testing_validate_and_release (test, &manager);
 }
 
+static void pfm_manager_flash_test_verify_pending_pfm_stream_verification (CuTest *test)
+{
+	struct pfm_manager_flash_testing manager;
+	HASH_TESTING_ENGINE stream_hash;
+	size_t offset;
+	size_t length;
+	int status;
+
+	TEST_START;
+
+	pfm_manager_flash_testing_init (test, &manager, 0x10000, 0x20000, NULL, 0, NULL, NULL, NULL, 0,
+		NULL, NULL, true);
+
+	status = HASH_TESTING_ENGINE_INIT (&stream_hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_manager_flash_enable_stream_verification (&manager.test.manifest_manager,
+		&stream_hash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_verify (&manager.flash_mock, 0x20000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.base.clear_pending_region (&manager.test.base.base, PFM_DATA_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	for (offset = 0; offset < PFM_DATA_LEN; offset += length) {
+		length = ((PFM_DATA_LEN - offset) > FLASH_PAGE_SIZE) ?
+			FLASH_PAGE_SIZE : (PFM_DATA_LEN - offset);
+
+		status = flash_master_mock_expect_write_ext (&manager.flash_mock, 0x20000 + offset,
+			PFM_DATA + offset, length, true, 0);
+		status |= flash_master_mock_expect_verify_flash (&manager.flash_mock, 0x20000 + offset,
+			PFM_DATA + offset, length);
+		CuAssertIntEquals (test, 0, status);
+
+		status = manager.test.base.base.write_pending_data (&manager.test.base.base,
+			PFM_DATA + offset, length);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mock_validate (&manager.flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The PFM data is not read back from flash. */
+	status = pfm_manager_flash_testing_verify_pfm_ext (&manager, PFM_DATA, PFM_DATA_LEN, PFM_HASH,
+		PFM_SIGNATURE, 0x20000, false);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.base.verify_pending_manifest (&manager.test.base.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, NULL, manager.test.base.get_active_pfm (&manager.test.base));
+	CuAssertPtrEquals (test, &manager.pfm2, manager.test.base.get_pending_pfm (&manager.test.base));
+
+	pfm_manager_flash_testing_validate_and_release (test, &manager);
+
+	HASH_TESTING_ENGINE_RELEASE (&stream_hash);
+}
+
+static void pfm_manager_flash_test_verify_pending_pfm_stream_verification_write_error (
+	CuTest *test)
+{
+	struct pfm_manager_flash_testing manager;
+	HASH_TESTING_ENGINE stream_hash;
+	size_t offset;
+	size_t length;
+	int status;
+
+	TEST_START;
+
+	pfm_manager_flash_testing_init (test, &manager, 0x10000, 0x20000, NULL, 0, NULL, NULL, NULL, 0,
+		NULL, NULL, true);
+
+	status = HASH_TESTING_ENGINE_INIT (&stream_hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_manager_flash_enable_stream_verification (&manager.test.manifest_manager,
+		&stream_hash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_verify (&manager.flash_mock, 0x20000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.base.clear_pending_region (&manager.test.base.base, PFM_DATA_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	for (offset = 0; offset < PFM_DATA_LEN; offset += length) {
+		length = ((PFM_DATA_LEN - offset) > FLASH_PAGE_SIZE) ?
+			FLASH_PAGE_SIZE : (PFM_DATA_LEN - offset);
+
+		if (offset == FLASH_PAGE_SIZE) {
+			/* Fail the first attempt to write the second chunk. */
+			status = flash_master_mock_expect_rx_xfer (&manager.flash_mock, 0, &WIP_STATUS, 1,
+				FLASH_EXP_READ_STATUS_REG);
+			status |= flash_master_mock_expect_xfer (&manager.flash_mock,
+				FLASH_MASTER_XFER_FAILED, FLASH_EXP_WRITE_ENABLE);
+			CuAssertIntEquals (test, 0, status);
+
+			status = manager.test.base.base.write_pending_data (&manager.test.base.base,
+				PFM_DATA + offset, length);
+			CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+		}
+
+		status = flash_master_mock_expect_write_ext (&manager.flash_mock, 0x20000 + offset,
+			PFM_DATA + offset, length, true, 0);
+		if (offset < FLASH_PAGE_SIZE) {
+			/* Data is only read back while the stream is still valid. */
+			status |= flash_master_mock_expect_verify_flash (&manager.flash_mock, 0x20000 + offset,
+				PFM_DATA + offset, length);
+		}
+		CuAssertIntEquals (test, 0, status);
+
+		status = manager.test.base.base.write_pending_data (&manager.test.base.base,
+			PFM_DATA + offset, length);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mock_validate (&manager.flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The written data was not hashed contiguously, so the PFM is read back from flash. */
+	status = pfm_manager_flash_testing_verify_pfm (&manager, PFM_DATA, PFM_DATA_LEN, PFM_HASH,
+		PFM_SIGNATURE, 0x20000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.base.verify_pending_manifest (&manager.test.base.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, NULL, manager.test.base.get_active_pfm (&manager.test.base));
+	CuAssertPtrEquals (test, &manager.pfm2, manager.test.base.get_pending_pfm (&manager.test.base));
+
+	pfm_manager_flash_testing_validate_and_release (test, &manager);
+
+	HASH_TESTING_ENGINE_RELEASE (&stream_hash);
+}
+
+static void pfm_manager_flash_test_verify_pending_pfm_stream_verification_read_back_mismatch (
+	CuTest *test)
+{
+	struct pfm_manager_flash_testing manager;
+	HASH_TESTING_ENGINE stream_hash;
+	uint8_t bad_data[FLASH_PAGE_SIZE];
+	size_t offset;
+	size_t length;
+	int status;
+
+	TEST_START;
+
+	pfm_manager_flash_testing_init (test, &manager, 0x10000, 0x20000, NULL, 0, NULL, NULL, NULL, 0,
+		NULL, NULL, true);
+
+	status = HASH_TESTING_ENGINE_INIT (&stream_hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_manager_flash_enable_stream_verification (&manager.test.manifest_manager,
+		&stream_hash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_verify (&manager.flash_mock, 0x20000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.base.clear_pending_region (&manager.test.base.base, PFM_DATA_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	for (offset = 0; offset < PFM_DATA_LEN; offset += length) {
+		length = ((PFM_DATA_LEN - offset) > FLASH_PAGE_SIZE) ?
+			FLASH_PAGE_SIZE : (PFM_DATA_LEN - offset);
+
+		status = flash_master_mock_expect_write_ext (&manager.flash_mock, 0x20000 + offset,
+			PFM_DATA + offset, length, true, 0);
+		if (offset == 0) {
+			status |= flash_master_mock_expect_verify_flash (&manager.flash_mock, 0x20000,
+				PFM_DATA, length);
+		}
+		else if (offset == FLASH_PAGE_SIZE) {
+			/* The second chunk does not match the flash contents when it is read back. */
+			memcpy (bad_data, PFM_DATA + offset, length);
+			bad_data[0] ^= 0x55;
+
+			status |= flash_master_mock_expect_verify_flash (&manager.flash_mock,
+				0x20000 + offset, bad_data, length);
+		}
+		CuAssertIntEquals (test, 0, status);
+
+		status = manager.test.base.base.write_pending_data (&manager.test.base.base,
+			PFM_DATA + offset, length);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mock_validate (&manager.flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The written data could not be confirmed, so the PFM is read back from flash. */
+	status = pfm_manager_flash_testing_verify_pfm (&manager, PFM_DATA, PFM_DATA_LEN, PFM_HASH,
+		PFM_SIGNATURE, 0x20000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.base.verify_pending_manifest (&manager.test.base.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, NULL, manager.test.base.get_active_pfm (&manager.test.base));
+	CuAssertPtrEquals (test, &manager.pfm2, manager.test.base.get_pending_pfm (&manager.test.base));
+
+	pfm_manager_flash_testing_validate_and_release (test, &manager);
+
+	HASH_TESTING_ENGINE_RELEASE (&stream_hash);
+}
+
+static void pfm_manager_flash_test_enable_stream_verification_null (CuTest *test)
+{
+	HASH_TESTING_ENGINE stream_hash;
+	int status;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&stream_hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_manager_flash_enable_stream_verification (NULL, &stream_hash.base);
+	CuAssertIntEquals (test, MANIFEST_MANAGER_INVALID_ARGUMENT, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&stream_hash);
+}
+
 static void pfm_manager_flash_test_verify_pending_pfm_null (CuTest *test)
 {
 	struct pfm_manager_flash_testing manager;
@@ -5094,6 +5342,10 @@ TEST (pfm_manager_flash_test_verify_pending_pfm_different_platform_id);
 TEST (pfm_manager_flash_test_verify_pending_pfm_no_clear_region2);
 TEST (pfm_manager_flash_test_verify_pending_pfm_no_clear_region1);
 TEST (pfm_manager_flash_test_verify_pending_pfm_extra_data_written);
+TEST (pfm_manager_flash_test_verify_pending_pfm_stream_verification);
+TEST (pfm_manager_flash_test_verify_pending_pfm_stream_verification_write_error);
+TEST (pfm_manager_flash_test_verify_pending_pfm_stream_verification_read_back_mismatch);
+TEST (pfm_manager_flash_test_enable_stream_verification_null);
 TEST (pfm_manager_flash_test_verify_pending_pfm_null);
 TEST (pfm_manager_flash_test_verify_pending_pfm_verify_error_region2);
 TEST (pfm_manager_flash_test_verify_pending_pfm_verify_error_region1);
@@ -206,6 +206,139 @@ static void mctp_interface_testing_generate_and_issue_request (CuTest *test,
 	CuAssertIntEquals (test, issue_request_status, status);
 }
 
+/**
+ * Helper function that generates an MCTP request and sends it without waiting for the response.
+ *
+ * @param test The test framework.
+ * @param mctp The testing instances to utilize.
+ * @param dest_eid The EID to send the request to.
+ * @param msg_tag The message tag expected to be used for the request.
+ * @param send_status The status the command channel should return when sending the request.
+ */
+static void mctp_interface_testing_generate_and_send_request (CuTest *test,
+	struct mctp_interface_testing *mctp, uint8_t dest_eid, uint8_t msg_tag, int send_status)
+{
+ 	uint8_t buf[6] = {0};
+ 	uint8_t msg_buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN] = {0};
+	struct cmd_packet tx_packet;
+	struct mctp_base_protocol_transport_header *header =
+		(struct mctp_base_protocol_transport_header*) tx_packet.data;
+	int status;
+
+	buf[0] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+
+	memset (&tx_packet, 0, sizeof (tx_packet));
+
+	header->cmd_code = SMBUS_CMD_CODE_MCTP;
+	header->byte_count = 11;
+	header->source_addr = 0xBB;
+	header->rsvd = 0;
+	header->header_version = 1;
+	header->destination_eid = dest_eid;
+	header->source_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	header->som = 1;
+	header->eom = 1;
+	header->tag_owner = MCTP_BASE_PROTOCOL_TO_REQUEST;
+	header->msg_tag = msg_tag;
+	header->packet_seq = 0;
+
+	memcpy (&tx_packet.data[7], buf, sizeof (buf));
+
+	tx_packet.data[13] = checksum_crc8 (0xAA, tx_packet.data, 13);
+	tx_packet.pkt_size = 14;
+	tx_packet.state = CMD_VALID_PACKET;
+	tx_packet.dest_addr = 0x55;
+	tx_packet.timeout_valid = false;
+
+	status = mock_expect (&mctp->channel.mock, mctp->channel.base.send_packet, &mctp->channel,
+		send_status,
+		MOCK_ARG_VALIDATOR_TMP (cmd_channel_mock_validate_packet, &tx_packet, sizeof (tx_packet)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_send_request (&mctp->mctp, &mctp->channel.base, 0x55, dest_eid, buf,
+		sizeof (buf), msg_buf, sizeof (msg_buf));
+	CuAssertIntEquals (test, send_status, status);
+}
+
+/**
+ * Helper function to generate a single packet response message.
+ *
+ * @param rx The packet to generate.
+ * @param src_eid The EID of the device sending the response.
+ * @param msg_tag The message tag for the response.
+ */
+static void mctp_interface_testing_generate_response_packet (struct cmd_packet *rx,
+	uint8_t src_eid, uint8_t msg_tag)
+{
+	struct mctp_base_protocol_transport_header *header =
+		(struct mctp_base_protocol_transport_header*) rx->data;
+
+	memset (rx, 0, sizeof (struct cmd_packet));
+
+	header->cmd_code = SMBUS_CMD_CODE_MCTP;
+	header->byte_count = 15;
+	header->source_addr = 0xAB;
+	header->rsvd = 0;
+	header->header_version = 1;
+	header->destination_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	header->source_eid = src_eid;
+	header->som = 1;
+	header->eom = 1;
+	header->tag_owner = MCTP_BASE_PROTOCOL_TO_RESPONSE;
+	header->msg_tag = msg_tag;
+	header->packet_seq = 0;
+
+	rx->data[7] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	rx->data[8] = 0x00;
+	rx->data[9] = 0x00;
+	rx->data[10] = 0x00;
+	rx->data[11] = 0x01;
+	rx->data[12] = 0x02;
+	rx->data[13] = 0x03;
+	rx->data[14] = 0x04;
+	rx->data[15] = 0x05;
+	rx->data[16] = 0x06;
+	rx->data[17] = checksum_crc8 (0xBA, rx->data, 17);
+	rx->pkt_size = 18;
+	rx->dest_addr = 0x5D;
+	rx->timeout_valid = true;
+	platform_init_timeout (10, &rx->pkt_timeout);
+}
+
+/**
+ * Helper function to set up the expectation for processing a response message.
+ *
+ * @param test The test framework.
+ * @param mctp The testing instances to utilize.
+ * @param rx The response packet that will be processed.
+ * @param response Container for the expected response message.
+ * @param data Buffer for the expected response data.  This must be 10 bytes.
+ */
+static void mctp_interface_testing_expect_response (CuTest *test,
+	struct mctp_interface_testing *mctp, struct cmd_packet *rx, struct cmd_interface_msg *response,
+	uint8_t *data)
+{
+	struct mctp_base_protocol_transport_header *header =
+		(struct mctp_base_protocol_transport_header*) rx->data;
+	int status;
+
+	response->data = data;
+	response->length = 10;
+	memcpy (response->data, &rx->data[7], response->length);
+	response->source_eid = header->source_eid;
+	response->target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	response->crypto_timeout = false;
+	response->channel_id = 0;
+	response->max_response = 0;
+
+	status = mock_expect (&mctp->cmd_cerberus.mock, mctp->cmd_cerberus.base.process_response,
+		&mctp->cmd_cerberus, 0,
+		MOCK_ARG_VALIDATOR_DEEP_COPY (cmd_interface_mock_validate_request, response,
+			sizeof (struct cmd_interface_msg), cmd_interface_mock_save_request,
+			cmd_interface_mock_free_request));
+	CuAssertIntEquals (test, 0, status);
+}
+
 /*******************
  * Test cases
  *******************/
@@ -6303,6 +6436,384 @@ static void mctp_interface_test_issue_request_request_payload_too_large (CuTest
 }
 
 
+static void mctp_interface_test_send_request_then_process_packet_response (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	struct cmd_interface_msg response;
+	uint8_t data[10];
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	mctp_interface_testing_generate_and_send_request (test, &mctp, MCTP_BASE_PROTOCOL_BMC_EID, 1,
+		0);
+
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 1);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response, data);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_multiple_devices (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	struct cmd_interface_msg response[3];
+	uint8_t data[3][10];
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	mctp_interface_testing_generate_and_send_request (test, &mctp, MCTP_BASE_PROTOCOL_BMC_EID, 1,
+		0);
+	mctp_interface_testing_generate_and_send_request (test, &mctp, 0x0C, 1, 0);
+	mctp_interface_testing_generate_and_send_request (test, &mctp, 0x0D, 1, 0);
+
+	mctp_interface_testing_generate_response_packet (&rx, 0x0D, 1);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response[0], data[0]);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 1);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response[1], data[1]);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_generate_response_packet (&rx, 0x0C, 1);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response[2], data[2]);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_then_process_packet_duplicate_response (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	struct cmd_interface_msg response;
+	uint8_t data[10];
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	mctp_interface_testing_generate_and_send_request (test, &mctp, MCTP_BASE_PROTOCOL_BMC_EID, 1,
+		0);
+
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 1);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response, data);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_UNEXPECTED_PKT, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_interleaved_response_packets (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	struct mctp_base_protocol_transport_header *header =
+		(struct mctp_base_protocol_transport_header*) rx.data;
+	struct cmd_interface_msg response[2];
+	uint8_t data[2][10];
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	mctp_interface_testing_generate_and_send_request (test, &mctp, MCTP_BASE_PROTOCOL_BMC_EID, 1,
+		0);
+	mctp_interface_testing_generate_and_send_request (test, &mctp, 0x0C, 1, 0);
+
+	/* First packet of a two packet response from the first device. */
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 1);
+	header->eom = 0;
+	rx.data[17] = checksum_crc8 (0xBA, rx.data, 17);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* A complete response from the second device restarts message assembly. */
+	mctp_interface_testing_generate_response_packet (&rx, 0x0C, 1);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response[0], data[0]);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* The rest of the first response is dropped. */
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 1);
+	header->som = 0;
+	header->packet_seq = 1;
+	rx.data[17] = checksum_crc8 (0xBA, rx.data, 17);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* The first request is still waiting for a complete response. */
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 1);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response[1], data[1]);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_response_to_previous_request (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	struct cmd_interface_msg response;
+	uint8_t data[10];
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	mctp_interface_testing_generate_and_send_request (test, &mctp, MCTP_BASE_PROTOCOL_BMC_EID, 1,
+		0);
+	mctp_interface_testing_generate_and_send_request (test, &mctp, MCTP_BASE_PROTOCOL_BMC_EID, 2,
+		0);
+
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 1);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_UNEXPECTED_PKT, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 2);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response, data);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_then_issue_request (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct mctp_interface_test_callback_context context;
+	struct cmd_packet rx;
+	struct cmd_packet rx_pending;
+	struct cmd_message *tx;
+	struct cmd_interface_msg response;
+	struct cmd_interface_msg response_pending;
+	uint8_t data[10];
+	uint8_t data_pending[10];
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	mctp_interface_testing_generate_and_send_request (test, &mctp, 0x0C, 1, 0);
+
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 0);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response, data);
+
+	context.expected_status = 0;
+	context.rsp_packet = &rx;
+	context.test = test;
+	context.testing = &mctp;
+
+	mctp_interface_testing_generate_and_issue_request (test, &mctp, &context, 0,
+		MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF);
+
+	mctp_interface_testing_generate_response_packet (&rx_pending, 0x0C, 1);
+	mctp_interface_testing_expect_response (test, &mctp, &rx_pending, &response_pending,
+		data_pending);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx_pending, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_too_many_requests (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+ 	uint8_t buf[6] = {0};
+ 	uint8_t msg_buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN] = {0};
+	int i;
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_PENDING_REQUESTS; i++) {
+		mctp_interface_testing_generate_and_send_request (test, &mctp, 0x20 + i, 1, 0);
+	}
+
+	buf[0] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+
+	status = mctp_interface_send_request (&mctp.mctp, &mctp.channel.base, 0x55,
+		MCTP_BASE_PROTOCOL_BMC_EID, buf, sizeof (buf), msg_buf, sizeof (msg_buf));
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_TOO_MANY_REQUESTS, status);
+
+	/* Cancelling a request makes space for another. */
+	mctp_interface_cancel_request (&mctp.mctp, 0x20);
+
+	mctp_interface_testing_generate_and_send_request (test, &mctp, MCTP_BASE_PROTOCOL_BMC_EID, 2,
+		0);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_send_error (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	mctp_interface_testing_generate_and_send_request (test, &mctp, MCTP_BASE_PROTOCOL_BMC_EID, 1,
+		CMD_CHANNEL_TX_FAILED);
+
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 1);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_UNEXPECTED_PKT, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_invalid_arg (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+ 	uint8_t buf[6] = {0};
+ 	uint8_t msg_buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN] = {0};
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	status = mctp_interface_send_request (NULL, &mctp.channel.base, 0x55,
+		MCTP_BASE_PROTOCOL_BMC_EID, buf, sizeof (buf), msg_buf, sizeof (msg_buf));
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_INVALID_ARGUMENT, status);
+
+	status = mctp_interface_send_request (&mctp.mctp, NULL, 0x55,
+		MCTP_BASE_PROTOCOL_BMC_EID, buf, sizeof (buf), msg_buf, sizeof (msg_buf));
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_INVALID_ARGUMENT, status);
+
+	status = mctp_interface_send_request (&mctp.mctp, &mctp.channel.base, 0x55,
+		MCTP_BASE_PROTOCOL_BMC_EID, NULL, sizeof (buf), msg_buf, sizeof (msg_buf));
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_INVALID_ARGUMENT, status);
+
+	status = mctp_interface_send_request (&mctp.mctp, &mctp.channel.base, 0x55,
+		MCTP_BASE_PROTOCOL_BMC_EID, buf, 0, msg_buf, sizeof (msg_buf));
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_INVALID_ARGUMENT, status);
+
+	status = mctp_interface_send_request (&mctp.mctp, &mctp.channel.base, 0x55,
+		MCTP_BASE_PROTOCOL_BMC_EID, buf, sizeof (buf), NULL, sizeof (msg_buf));
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_INVALID_ARGUMENT, status);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_output_buf_too_small (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+ 	uint8_t buf[6] = {0};
+ 	uint8_t msg_buf[6] = {0};
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	status = mctp_interface_send_request (&mctp.mctp, &mctp.channel.base, 0x55,
+		MCTP_BASE_PROTOCOL_BMC_EID, buf, sizeof (buf), msg_buf, sizeof (msg_buf));
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_BUF_TOO_SMALL, status);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_cancel_request (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	struct cmd_interface_msg response;
+	uint8_t data[10];
+	int status;
+
+	TEST_START;
+
+	setup_mctp_interface_with_interface_mock_test (test, &mctp);
+
+	mctp_interface_testing_generate_and_send_request (test, &mctp, MCTP_BASE_PROTOCOL_BMC_EID, 1,
+		0);
+	mctp_interface_testing_generate_and_send_request (test, &mctp, 0x0C, 1, 0);
+
+	mctp_interface_cancel_request (&mctp.mctp, MCTP_BASE_PROTOCOL_BMC_EID);
+
+	mctp_interface_testing_generate_response_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 1);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_UNEXPECTED_PKT, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_generate_response_packet (&rx, 0x0C, 1);
+	mctp_interface_testing_expect_response (test, &mctp, &rx, &response, data);
+
+	status = mctp_interface_process_packet (&mctp.mctp, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	complete_mctp_interface_with_interface_mock_test (test, &mctp);
+}
+
+static void mctp_interface_test_cancel_request_null (CuTest *test)
+{
+	TEST_START;
+
+	mctp_interface_cancel_request (NULL, MCTP_BASE_PROTOCOL_BMC_EID);
+}
+
+
 TEST_SUITE_START (mctp_interface);
 
 TEST (mctp_interface_test_init);
@@ -6375,5 +6886,17 @@ TEST (mctp_interface_test_issue_request_cmd_channel_fail);
 TEST (mctp_interface_test_issue_request_invalid_arg);
 TEST (mctp_interface_test_issue_request_output_buf_too_small);
 TEST (mctp_interface_test_issue_request_request_payload_too_large);
+TEST (mctp_interface_test_send_request_then_process_packet_response);
+TEST (mctp_interface_test_send_request_multiple_devices);
+TEST (mctp_interface_test_send_request_then_process_packet_duplicate_response);
+TEST (mctp_interface_test_send_request_interleaved_response_packets);
+TEST (mctp_interface_test_send_request_response_to_previous_request);
+TEST (mctp_interface_test_send_request_then_issue_request);
+TEST (mctp_interface_test_send_request_too_many_requests);
+TEST (mctp_interface_test_send_request_send_error);
+TEST (mctp_interface_test_send_request_invalid_arg);
+TEST (mctp_interface_test_send_request_output_buf_too_small);
+TEST (mctp_interface_test_cancel_request);
+TEST (mctp_interface_test_cancel_request_null);
 
 TEST_SUITE_END;
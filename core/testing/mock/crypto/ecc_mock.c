@@ -125,6 +125,34 @@ static int ecc_mock_sign (struct ecc_engine *engine, struct ecc_private_key *key
 		MOCK_ARG_CALL (length), MOCK_ARG_CALL (signature), MOCK_ARG_CALL (sig_length));
 }
 
+static int ecc_mock_generate_ecdsa_nonce (struct ecc_engine *engine, struct ecc_private_key *key,
+	struct ecc_ecdsa_nonce *nonce)
+{
+	struct ecc_engine_mock *mock = (struct ecc_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, ecc_mock_generate_ecdsa_nonce, engine, MOCK_ARG_CALL (key),
+		MOCK_ARG_CALL (nonce));
+}
+
+static int ecc_mock_sign_with_nonce (struct ecc_engine *engine, struct ecc_private_key *key,
+	struct ecc_ecdsa_nonce *nonce, const uint8_t *digest, size_t length, uint8_t *signature,
+	size_t sig_length)
+{
+	struct ecc_engine_mock *mock = (struct ecc_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, ecc_mock_sign_with_nonce, engine, MOCK_ARG_CALL (key),
+		MOCK_ARG_CALL (nonce), MOCK_ARG_CALL (digest), MOCK_ARG_CALL (length),
+		MOCK_ARG_CALL (signature), MOCK_ARG_CALL (sig_length));
+}
+
 static int ecc_mock_verify (struct ecc_engine *engine, struct ecc_public_key *key,
 	const uint8_t *digest, size_t length, const uint8_t *signature, size_t sig_length)
 {
@@ -166,7 +194,10 @@ static int ecc_mock_compute_shared_secret (struct ecc_engine *engine,
 
 static int ecc_mock_func_arg_count (void *func)
 {
-	if ((func == ecc_mock_sign) || (func == ecc_mock_verify)) {
+	if (func == ecc_mock_sign_with_nonce) {
+		return 6;
+	}
+	else if ((func == ecc_mock_sign) || (func == ecc_mock_verify)) {
 		return 5;
 	}
 	else if ((func == ecc_mock_init_key_pair) || (func == ecc_mock_generate_derived_key_pair) ||
@@ -177,7 +208,7 @@ static int ecc_mock_func_arg_count (void *func)
 		(func == ecc_mock_get_private_key_der) || (func == ecc_mock_get_public_key_der)) {
 		return 3;
 	}
-	else if (func == ecc_mock_release_key_pair) {
+	else if ((func == ecc_mock_release_key_pair) || (func == ecc_mock_generate_ecdsa_nonce)) {
 		return 2;
 	}
 	else if ((func == ecc_mock_get_signature_max_length) ||
@@ -218,6 +249,12 @@ static const char* ecc_mock_func_name_map (void *func)
 	else if (func == ecc_mock_sign) {
 		return "sign";
 	}
+	else if (func == ecc_mock_generate_ecdsa_nonce) {
+		return "generate_ecdsa_nonce";
+	}
+	else if (func == ecc_mock_sign_with_nonce) {
+		return "sign_with_nonce";
+	}
 	else if (func == ecc_mock_verify) {
 		return "verify";
 	}
@@ -345,6 +382,36 @@ static const char* ecc_mock_arg_name_map (void *func, int arg)
 				return "sig_length";
 		}
 	}
+	else if (func == ecc_mock_generate_ecdsa_nonce) {
+		switch (arg) {
+			case 0:
+				return "key";
+
+			case 1:
+				return "nonce";
+		}
+	}
+	else if (func == ecc_mock_sign_with_nonce) {
+		switch (arg) {
+			case 0:
+				return "key";
+
+			case 1:
+				return "nonce";
+
+			case 2:
+				return "digest";
+
+			case 3:
+				return "length";
+
+			case 4:
+				return "signature";
+
+			case 5:
+				return "sig_length";
+		}
+	}
 	else if (func == ecc_mock_verify) {
 		switch (arg) {
 			case 0:
@@ -421,6 +488,8 @@ int ecc_mock_init (struct ecc_engine_mock *mock)
 	mock->base.get_private_key_der = ecc_mock_get_private_key_der;
 	mock->base.get_public_key_der = ecc_mock_get_public_key_der;
 	mock->base.sign = ecc_mock_sign;
+	mock->base.generate_ecdsa_nonce = ecc_mock_generate_ecdsa_nonce;
+	mock->base.sign_with_nonce = ecc_mock_sign_with_nonce;
 	mock->base.verify = ecc_mock_verify;
 	mock->base.get_shared_secret_max_length = ecc_mock_get_shared_secret_max_length;
 	mock->base.compute_shared_secret = ecc_mock_compute_shared_secret;
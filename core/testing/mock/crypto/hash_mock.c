@@ -138,6 +138,29 @@ static void hash_mock_cancel (struct hash_engine *engine)
 	MOCK_VOID_RETURN_NO_ARGS (&mock->mock, hash_mock_cancel, engine);
 }
 
+static int hash_mock_save_state (struct hash_engine *engine, struct hash_engine_state *state)
+{
+	struct hash_engine_mock *mock = (struct hash_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, hash_mock_save_state, engine, MOCK_ARG_CALL (state));
+}
+
+static int hash_mock_restore_state (struct hash_engine *engine,
+	const struct hash_engine_state *state)
+{
+	struct hash_engine_mock *mock = (struct hash_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, hash_mock_restore_state, engine, MOCK_ARG_CALL (state));
+}
+
 static int hash_mock_func_arg_count (void *func)
 {
 	if ((func == hash_mock_calculate_sha1) || (func == hash_mock_calculate_sha256) ||
@@ -147,6 +170,9 @@ static int hash_mock_func_arg_count (void *func)
 	else if ((func == hash_mock_update) || (func == hash_mock_finish)) {
 		return 2;
 	}
+	else if ((func == hash_mock_save_state) || (func == hash_mock_restore_state)) {
+		return 1;
+	}
 	else {
 		return 0;
 	}
@@ -187,6 +213,12 @@ static const char* hash_mock_func_name_map (void *func)
 	else if (func == hash_mock_cancel) {
 		return "cancel";
 	}
+	else if (func == hash_mock_save_state) {
+		return "save_state";
+	}
+	else if (func == hash_mock_restore_state) {
+		return "restore_state";
+	}
 	else {
 		return "unknown";
 	}
@@ -272,6 +304,12 @@ static const char* hash_mock_arg_name_map (void *func, int arg)
 				return "hash_length";
 		}
 	}
+	else if ((func == hash_mock_save_state) || (func == hash_mock_restore_state)) {
+		switch (arg) {
+			case 0:
+				return "state";
+		}
+	}
 
 	return "unknown";
 }
@@ -311,6 +349,8 @@ int hash_mock_init (struct hash_engine_mock *mock)
 	mock->base.update = hash_mock_update;
 	mock->base.finish = hash_mock_finish;
 	mock->base.cancel = hash_mock_cancel;
+	mock->base.save_state = hash_mock_save_state;
+	mock->base.restore_state = hash_mock_restore_state;
 
 	mock->mock.func_arg_count = hash_mock_func_arg_count;
 	mock->mock.func_name_map = hash_mock_func_name_map;
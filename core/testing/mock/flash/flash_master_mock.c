@@ -59,9 +59,35 @@ static int flash_master_mock_set_spi_clock_frequency (const struct flash_master
 	MOCK_RETURN (&mock->mock, flash_master_mock_set_spi_clock_frequency, spi, MOCK_ARG_CALL (freq));
 }
 
+static int flash_master_mock_xfer_start (const struct flash_master *spi,
+	const struct flash_xfer *xfer)
+{
+	struct flash_master_mock *mock = (struct flash_master_mock*) spi;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, flash_master_mock_xfer_start, spi, MOCK_ARG_CALL (xfer->cmd),
+		MOCK_ARG_CALL (xfer->address), MOCK_ARG_CALL (xfer->dummy_bytes),
+		MOCK_ARG_CALL (xfer->mode_bytes), MOCK_ARG_CALL (xfer->data), MOCK_ARG_CALL (xfer->length),
+		MOCK_ARG_CALL (xfer->flags));
+}
+
+static int flash_master_mock_xfer_wait (const struct flash_master *spi)
+{
+	struct flash_master_mock *mock = (struct flash_master_mock*) spi;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN_NO_ARGS (&mock->mock, flash_master_mock_xfer_wait, spi);
+}
+
 static int flash_master_mock_func_arg_count (void *func)
 {
-	if (func == flash_master_mock_xfer) {
+	if ((func == flash_master_mock_xfer) || (func == flash_master_mock_xfer_start)) {
 		return 7;
 	}
 	else if (func == flash_master_mock_set_spi_clock_frequency) {
@@ -89,6 +115,12 @@ static const char* flash_master_mock_func_name_map (void *func)
 	else if (func == flash_master_mock_set_spi_clock_frequency) {
 		return "set_spi_clock_frequency";
 	}
+	else if (func == flash_master_mock_xfer_start) {
+		return "xfer_start";
+	}
+	else if (func == flash_master_mock_xfer_wait) {
+		return "xfer_wait";
+	}
 	else {
 		return "unknown";
 	}
@@ -99,7 +131,7 @@ static const char* flash_master_mock_func_name_map (void *func)
  */
 static const char* flash_master_mock_arg_name_map (void *func, int arg)
 {
-	if (func == flash_master_mock_xfer) {
+	if ((func == flash_master_mock_xfer) || (func == flash_master_mock_xfer_start)) {
 		switch (arg) {
 			case 0:
 				return "xfer.cmd";
@@ -171,6 +203,20 @@ int flash_master_mock_init (struct flash_master_mock *mock)
 	return 0;
 }
 
+/**
+ * Enable the optional asynchronous transfer API on a flash master mock.  The mock must already be
+ * initialized.
+ *
+ * @param mock The mock to update.
+ */
+void flash_master_mock_enable_async_xfer (struct flash_master_mock *mock)
+{
+	if (mock != NULL) {
+		mock->base.xfer_start = flash_master_mock_xfer_start;
+		mock->base.xfer_wait = flash_master_mock_xfer_wait;
+	}
+}
+
 /**
  * Release the resources used by a flash master mock instance.
  *
@@ -332,6 +378,55 @@ int flash_master_mock_expect_rx_xfer_ext (struct flash_master_mock *mock, intptr
 	}
 }
 
+/**
+ * Add a mock expectation for an asynchronous flash transfer that will receive data.
+ *
+ * @param mock The mock to update.
+ * @param return_val The value to return for starting the transfer.
+ * @param rx_data The data to return for the transfer.
+ * @param rx_length The length of the data.
+ * @param xfer The transfer to expect.
+ *
+ * @return 0 if the expectation was added successfully or an error code.
+ */
+int flash_master_mock_expect_rx_xfer_start (struct flash_master_mock *mock, intptr_t return_val,
+	const uint8_t *rx_data, size_t rx_length, struct flash_xfer xfer)
+{
+	struct mock_expect_arg data =
+		(xfer.data != (void*) -1) ? MOCK_ARG (xfer.data) : MOCK_ARG_NOT_NULL;
+	int status;
+
+	if ((mock == NULL) || (rx_data == NULL) || (rx_length == 0)) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	status = mock_expect (&mock->mock, flash_master_mock_xfer_start, mock, return_val,
+		MOCK_ARG (xfer.cmd), MOCK_ARG (xfer.address), MOCK_ARG (xfer.dummy_bytes),
+		MOCK_ARG (xfer.mode_bytes), data, MOCK_ARG (xfer.length), MOCK_ARG (xfer.flags));
+	if (status != 0) {
+		return status;
+	}
+
+	return mock_expect_output (&mock->mock, 4, rx_data, rx_length, 5);
+}
+
+/**
+ * Add a mock expectation for waiting on an asynchronous flash transfer.
+ *
+ * @param mock The mock to update.
+ * @param return_val The value to return for the transfer.
+ *
+ * @return 0 if the expectation was added successfully or an error code.
+ */
+int flash_master_mock_expect_xfer_wait (struct flash_master_mock *mock, intptr_t return_val)
+{
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	return mock_expect (&mock->mock, flash_master_mock_xfer_wait, mock, return_val);
+}
+
 /**
  * Add the expectations for blank checking a region of flash.
  *
@@ -32,6 +32,8 @@ void flash_master_mock_release (struct flash_master_mock *mock);
 
 int flash_master_mock_validate_and_release (struct flash_master_mock *mock);
 
+void flash_master_mock_enable_async_xfer (struct flash_master_mock *mock);
+
 int flash_master_mock_expect_xfer (struct flash_master_mock *mock, intptr_t return_val,
 	struct flash_xfer xfer);
 int flash_master_mock_expect_tx_xfer (struct flash_master_mock *mock, intptr_t return_val,
@@ -42,6 +44,9 @@ int flash_master_mock_expect_rx_xfer (struct flash_master_mock *mock, intptr_t r
 	const uint8_t *rx_data, size_t rx_length, struct flash_xfer xfer);
 int flash_master_mock_expect_rx_xfer_ext (struct flash_master_mock *mock, intptr_t return_val,
 	const uint8_t *rx_data, size_t rx_length, bool is_tmp, struct flash_xfer xfer);
+int flash_master_mock_expect_rx_xfer_start (struct flash_master_mock *mock, intptr_t return_val,
+	const uint8_t *rx_data, size_t rx_length, struct flash_xfer xfer);
+int flash_master_mock_expect_xfer_wait (struct flash_master_mock *mock, intptr_t return_val);
 
 int flash_master_mock_expect_blank_check (struct flash_master_mock *mock, uint32_t start,
 	size_t length);
@@ -123,9 +123,34 @@ static int flash_mock_chip_erase (const struct flash *flash)
 	MOCK_RETURN_NO_ARGS (&mock->mock, flash_mock_chip_erase, flash);
 }
 
+static int flash_mock_read_start (const struct flash *flash, uint32_t address, uint8_t *data,
+	size_t length)
+{
+	struct flash_mock *mock = (struct flash_mock*) flash;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, flash_mock_read_start, flash, MOCK_ARG_CALL (address),
+		MOCK_ARG_CALL (data), MOCK_ARG_CALL (length));
+}
+
+static int flash_mock_read_wait (const struct flash *flash)
+{
+	struct flash_mock *mock = (struct flash_mock*) flash;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN_NO_ARGS (&mock->mock, flash_mock_read_wait, flash);
+}
+
 static int flash_mock_func_arg_count (void *func)
 {
-	if ((func == flash_mock_read) || (func == flash_mock_write)) {
+	if ((func == flash_mock_read) || (func == flash_mock_write) ||
+		(func == flash_mock_read_start)) {
 		return 3;
 	}
 	else if ((func == flash_mock_get_device_size) || (func == flash_mock_get_page_size) ||
@@ -171,6 +196,12 @@ static const char* flash_mock_func_name_map (void *func)
 	else if (func == flash_mock_chip_erase) {
 		return "chip_erase";
 	}
+	else if (func == flash_mock_read_start) {
+		return "read_start";
+	}
+	else if (func == flash_mock_read_wait) {
+		return "read_wait";
+	}
 	else {
 		return "unknown";
 	}
@@ -244,6 +275,18 @@ static const char* flash_mock_arg_name_map (void *func, int arg)
 				return "block_addr";
 		}
 	}
+	else if (func == flash_mock_read_start) {
+		switch (arg) {
+			case 0:
+				return "address";
+
+			case 1:
+				return "data";
+
+			case 2:
+				return "length";
+		}
+	}
 
 	return "unknown";
 }
@@ -292,6 +335,19 @@ int flash_mock_init (struct flash_mock *mock)
 	return 0;
 }
 
+/**
+ * Enable the optional asynchronous read API on a flash mock.  The mock must already be initialized.
+ *
+ * @param mock The mock to update.
+ */
+void flash_mock_enable_async_read (struct flash_mock *mock)
+{
+	if (mock) {
+		mock->base.read_start = flash_mock_read_start;
+		mock->base.read_wait = flash_mock_read_wait;
+	}
+}
+
 /**
  * Release the resources used by a flash mock.
  *
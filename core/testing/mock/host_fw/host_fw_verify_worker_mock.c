@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "host_fw_verify_worker_mock.h"
+
+
+static int host_fw_verify_worker_mock_start_verification (struct host_fw_verify_worker *worker,
+	struct spi_flash *flash, const struct pfm_image_list *img_list, uint32_t offset)
+{
+	struct host_fw_verify_worker_mock *mock = (struct host_fw_verify_worker_mock*) worker;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, host_fw_verify_worker_mock_start_verification, worker,
+		MOCK_ARG_CALL (flash), MOCK_ARG_CALL (img_list), MOCK_ARG_CALL (offset));
+}
+
+static int host_fw_verify_worker_mock_get_verification_result (
+	struct host_fw_verify_worker *worker)
+{
+	struct host_fw_verify_worker_mock *mock = (struct host_fw_verify_worker_mock*) worker;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN_NO_ARGS (&mock->mock, host_fw_verify_worker_mock_get_verification_result, worker);
+}
+
+static int host_fw_verify_worker_mock_func_arg_count (void *func)
+{
+	if (func == host_fw_verify_worker_mock_start_verification) {
+		return 3;
+	}
+	else {
+		return 0;
+	}
+}
+
+static const char* host_fw_verify_worker_mock_func_name_map (void *func)
+{
+	if (func == host_fw_verify_worker_mock_start_verification) {
+		return "start_verification";
+	}
+	else if (func == host_fw_verify_worker_mock_get_verification_result) {
+		return "get_verification_result";
+	}
+	else {
+		return "unknown";
+	}
+}
+
+static const char* host_fw_verify_worker_mock_arg_name_map (void *func, int arg)
+{
+	if (func == host_fw_verify_worker_mock_start_verification) {
+		switch (arg) {
+			case 0:
+				return "flash";
+
+			case 1:
+				return "img_list";
+
+			case 2:
+				return "offset";
+		}
+	}
+
+	return "unknown";
+}
+
+/**
+ * Initialize a mock for a host firmware verification worker.
+ *
+ * @param mock The mock to initialize.
+ *
+ * @return 0 if the mock was successfully initialized or an error code.
+ */
+int host_fw_verify_worker_mock_init (struct host_fw_verify_worker_mock *mock)
+{
+	int status;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	memset (mock, 0, sizeof (struct host_fw_verify_worker_mock));
+
+	status = mock_init (&mock->mock);
+	if (status != 0) {
+		return status;
+	}
+
+	mock_set_name (&mock->mock, "host_fw_verify_worker");
+
+	mock->base.start_verification = host_fw_verify_worker_mock_start_verification;
+	mock->base.get_verification_result = host_fw_verify_worker_mock_get_verification_result;
+
+	mock->mock.func_arg_count = host_fw_verify_worker_mock_func_arg_count;
+	mock->mock.func_name_map = host_fw_verify_worker_mock_func_name_map;
+	mock->mock.arg_name_map = host_fw_verify_worker_mock_arg_name_map;
+
+	return 0;
+}
+
+/**
+ * Release the resources used by a verification worker mock.
+ *
+ * @param mock The mock to release.
+ */
+void host_fw_verify_worker_mock_release (struct host_fw_verify_worker_mock *mock)
+{
+	if (mock) {
+		mock_release (&mock->mock);
+	}
+}
+
+/**
+ * Validate all mock expectations were called and release the mock instance.
+ *
+ * @param mock The mock to validate.
+ *
+ * @return 0 if the expectations were met or 1 if not.
+ */
+int host_fw_verify_worker_mock_validate_and_release (struct host_fw_verify_worker_mock *mock)
+{
+	int status = 1;
+
+	if (mock != NULL) {
+		status = mock_validate (&mock->mock);
+		host_fw_verify_worker_mock_release (mock);
+	}
+
+	return status;
+}
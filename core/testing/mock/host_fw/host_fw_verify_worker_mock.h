@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef HOST_FW_VERIFY_WORKER_MOCK_H_
+#define HOST_FW_VERIFY_WORKER_MOCK_H_
+
+#include "host_fw/host_fw_verify_worker.h"
+#include "mock.h"
+
+
+/**
+ * A mock for a host firmware verification worker.
+ */
+struct host_fw_verify_worker_mock {
+	struct host_fw_verify_worker base;		/**< The base worker instance. */
+	struct mock mock;						/**< The base mock interface. */
+};
+
+
+int host_fw_verify_worker_mock_init (struct host_fw_verify_worker_mock *mock);
+void host_fw_verify_worker_mock_release (struct host_fw_verify_worker_mock *mock);
+
+int host_fw_verify_worker_mock_validate_and_release (struct host_fw_verify_worker_mock *mock);
+
+
+#endif /* HOST_FW_VERIFY_WORKER_MOCK_H_ */
@@ -52,6 +52,8 @@ static void ecc_riot_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, engine.base.get_private_key_der);
 	CuAssertPtrNotNull (test, engine.base.get_public_key_der);
 	CuAssertPtrNotNull (test, engine.base.sign);
+	CuAssertPtrNotNull (test, engine.base.generate_ecdsa_nonce);
+	CuAssertPtrNotNull (test, engine.base.sign_with_nonce);
 	CuAssertPtrNotNull (test, engine.base.verify);
 	CuAssertPtrEquals (test, NULL, engine.base.get_shared_secret_max_length);
 	CuAssertPtrEquals (test, NULL, engine.base.compute_shared_secret);
@@ -965,6 +967,194 @@ static void ecc_riot_test_sign_unsupported_hash (CuTest *test)
 	ecc_riot_release (&engine);
 }
 
+static void ecc_riot_test_sign_with_nonce_and_verify (CuTest *test)
+{
+	struct ecc_engine_riot engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	struct ecc_ecdsa_nonce zero;
+	int status;
+	int out_len;
+	uint8_t out[ECC256_DSA_MAX_LENGTH * 2];
+	RNG_TESTING_ENGINE rng;
+
+	TEST_START;
+
+	memset (&zero, 0, sizeof (zero));
+
+	status = RNG_TESTING_ENGINE_INIT (&rng);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_riot_init (&engine, &rng.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, ECC_KEY_LENGTH_256, nonce.length);
+
+	out_len = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, sizeof (out));
+	CuAssertTrue (test, !ROT_IS_ERROR (out_len));
+
+	status = testing_validate_array ((uint8_t*) &zero, (uint8_t*) &nonce, sizeof (nonce));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.verify (&engine.base, &pub_key, SIG_HASH_TEST, SIG_HASH_LEN, out, out_len);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	RNG_TESTING_ENGINE_RELEASE (&rng);
+	ecc_riot_release (&engine);
+}
+
+static void ecc_riot_test_generate_ecdsa_nonce_null (CuTest *test)
+{
+	struct ecc_engine_riot engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+	RNG_TESTING_ENGINE rng;
+
+	TEST_START;
+
+	status = RNG_TESTING_ENGINE_INIT (&rng);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_riot_init (&engine, &rng.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (NULL, &priv_key, &nonce);
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, NULL, &nonce);
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, NULL);
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	RNG_TESTING_ENGINE_RELEASE (&rng);
+	ecc_riot_release (&engine);
+}
+
+static void ecc_riot_test_sign_with_nonce_null (CuTest *test)
+{
+	struct ecc_engine_riot engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	struct ecc_ecdsa_nonce zero;
+	int status;
+	uint8_t out[ECC256_DSA_MAX_LENGTH * 2];
+	RNG_TESTING_ENGINE rng;
+
+	TEST_START;
+
+	memset (&zero, 0, sizeof (zero));
+
+	status = RNG_TESTING_ENGINE_INIT (&rng);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_riot_init (&engine, &rng.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, NULL, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (NULL, &priv_key, &nonce, SIG_HASH_TEST, SIG_HASH_LEN,
+		out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	/* The nonce must never be used again, even if the signature was not generated. */
+	status = testing_validate_array ((uint8_t*) &zero, (uint8_t*) &nonce, sizeof (nonce));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, NULL, &nonce, SIG_HASH_TEST, SIG_HASH_LEN,
+		out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, NULL, SIG_HASH_LEN,
+		out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST, 0,
+		out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, NULL, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	RNG_TESTING_ENGINE_RELEASE (&rng);
+	ecc_riot_release (&engine);
+}
+
+static void ecc_riot_test_sign_with_nonce_bad_nonce (CuTest *test)
+{
+	struct ecc_engine_riot engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+	uint8_t out[ECC256_DSA_MAX_LENGTH * 2];
+	RNG_TESTING_ENGINE rng;
+
+	TEST_START;
+
+	status = RNG_TESTING_ENGINE_INIT (&rng);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc_riot_init (&engine, &rng.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, 0, status);
+
+	nonce.length = ECC_KEY_LENGTH_384;
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_BAD_NONCE, status);
+
+	/* A nonce that has already been used is rejected. */
+	nonce.length = ECC_KEY_LENGTH_256;
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_SIGN_FAILED, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	RNG_TESTING_ENGINE_RELEASE (&rng);
+	ecc_riot_release (&engine);
+}
+
 static void ecc_riot_test_verify_null (CuTest *test)
 {
 	struct ecc_engine_riot engine;
@@ -1408,6 +1598,10 @@ TEST (ecc_riot_test_generate_derived_key_pair_unsupported_key_length);
 TEST (ecc_riot_test_sign_null);
 TEST (ecc_riot_test_sign_small_buffer);
 TEST (ecc_riot_test_sign_unsupported_hash);
+TEST (ecc_riot_test_sign_with_nonce_and_verify);
+TEST (ecc_riot_test_generate_ecdsa_nonce_null);
+TEST (ecc_riot_test_sign_with_nonce_null);
+TEST (ecc_riot_test_sign_with_nonce_bad_nonce);
 TEST (ecc_riot_test_verify_null);
 TEST (ecc_riot_test_verify_corrupt_signature);
 TEST (ecc_riot_test_get_signature_max_length);
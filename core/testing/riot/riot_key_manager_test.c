@@ -2561,6 +2561,13 @@ static void riot_key_manager_test_get_intermediate_ca_null (CuTest *test)
 	CuAssertPtrEquals (test, NULL, (struct der_cert*) int_ca);
 }
 
+static void riot_key_manager_test_get_certificate_version_null (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, riot_key_manager_get_certificate_version (NULL));
+}
+
 static void riot_key_manager_test_verify_stored_certs_no_signed_device_id (CuTest *test)
 {
 	X509_TESTING_ENGINE x509;
@@ -2735,6 +2742,7 @@ static void riot_key_manager_test_verify_stored_certs_signed_device_id (CuTest *
 	const struct riot_keys *dev_keys;
 	const struct der_cert *root_ca;
 	const struct der_cert *int_ca;
+	uint32_t version;
 	uint8_t *dev_id_der = NULL;
 	uint8_t *ca_der = NULL;
 	uint8_t *int_der = NULL;
@@ -2788,9 +2796,13 @@ static void riot_key_manager_test_verify_stored_certs_signed_device_id (CuTest *
 
 	CuAssertIntEquals (test, 0, status);
 
+	version = riot_key_manager_get_certificate_version (&manager);
+
 	status = riot_key_manager_verify_stored_certs (&manager);
 	CuAssertIntEquals (test, 0, status);
 
+	CuAssertTrue (test, (version != riot_key_manager_get_certificate_version (&manager)));
+
 	dev_keys = riot_key_manager_get_riot_keys (&manager);
 	CuAssertTrue (test, (&keys != dev_keys));
 
@@ -7187,6 +7199,7 @@ TEST (riot_key_manager_test_release_null);
 TEST (riot_key_manager_test_get_riot_keys_null);
 TEST (riot_key_manager_test_get_root_ca_null);
 TEST (riot_key_manager_test_get_intermediate_ca_null);
+TEST (riot_key_manager_test_get_certificate_version_null);
 TEST (riot_key_manager_test_verify_stored_certs_no_signed_device_id);
 TEST (riot_key_manager_test_verify_stored_certs_bad_signed_device_id);
 TEST (riot_key_manager_test_verify_stored_certs_signed_device_id);
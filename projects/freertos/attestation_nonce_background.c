@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "attestation_nonce_background.h"
+#include "platform.h"
+
+
+/**
+ * Runs the background task to refill the attestation nonce pool.
+ *
+ * @param nonce The nonce task to run.
+ */
+static void attestation_nonce_background_task (struct attestation_nonce_background *nonce)
+{
+	while (1) {
+		platform_msleep (nonce->period_ms);
+
+		xSemaphoreTake (nonce->lock, portMAX_DELAY);
+		attestation_slave_refill_nonce_pool (nonce->attestation);
+		xSemaphoreGive (nonce->lock);
+	}
+}
+
+/**
+ * Initialize the background task to precompute nonces for signing attestation challenge responses.
+ * The nonce pool must be enabled on the attestation manager for any nonces to be generated.
+ *
+ * @param nonce The background nonce task to initialize.
+ * @param attestation The attestation manager to generate nonces for.
+ * @param period_ms The time to wait between each refill of the nonce pool.
+ * @param priority The priority level for running the nonce task.  This should be a low priority so
+ * nonces are only generated when the system would otherwise be idle.
+ * @param stack_words The size of the nonce task stack.  The stack size is measured in words.
+ *
+ * @return 0 if the nonce task was initialized or an error code.
+ */
+int attestation_nonce_background_init (struct attestation_nonce_background *nonce,
+	struct attestation_slave *attestation, uint32_t period_ms, int priority, uint16_t stack_words)
+{
+	int status;
+
+	if ((nonce == NULL) || (attestation == NULL) || (period_ms == 0)) {
+		return ATTESTATION_INVALID_ARGUMENT;
+	}
+
+	memset (nonce, 0, sizeof (struct attestation_nonce_background));
+
+	nonce->attestation = attestation;
+	nonce->period_ms = period_ms;
+
+	nonce->lock = xSemaphoreCreateMutex ();
+	if (nonce->lock == NULL) {
+		return ATTESTATION_NO_MEMORY;
+	}
+
+	status = xTaskCreate ((TaskFunction_t) attestation_nonce_background_task, "AttNonce",
+		stack_words, nonce, priority, &nonce->task);
+	if (status != pdPASS) {
+		vSemaphoreDelete (nonce->lock);
+		return ATTESTATION_NO_MEMORY;
+	}
+
+	return 0;
+}
+
+/**
+ * Release resources for a background nonce task instance.
+ *
+ * @param nonce The nonce task to release.
+ */
+void attestation_nonce_background_release (struct attestation_nonce_background *nonce)
+{
+	if (nonce) {
+		xSemaphoreTake (nonce->lock, portMAX_DELAY);
+		vTaskDelete (nonce->task);
+		vSemaphoreDelete (nonce->lock);
+	}
+}
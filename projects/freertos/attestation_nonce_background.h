@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef ATTESTATION_NONCE_BACKGROUND_H_
+#define ATTESTATION_NONCE_BACKGROUND_H_
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "attestation/attestation_slave.h"
+
+
+/**
+ * Background task for precomputing the nonces used to sign attestation challenge responses.
+ */
+struct attestation_nonce_background {
+	struct attestation_slave *attestation;	/**< The attestation manager to generate nonces for. */
+	uint32_t period_ms;						/**< Time between checks for nonces that need to be refilled. */
+	TaskHandle_t task;						/**< The nonce background task. */
+	SemaphoreHandle_t lock;					/**< Synchronization to protect task deletion. */
+};
+
+
+int attestation_nonce_background_init (struct attestation_nonce_background *nonce,
+	struct attestation_slave *attestation, uint32_t period_ms, int priority, uint16_t stack_words);
+void attestation_nonce_background_release (struct attestation_nonce_background *nonce);
+
+
+#endif /* ATTESTATION_NONCE_BACKGROUND_H_ */
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "attestation_scheduler_background.h"
+#include "platform.h"
+
+
+/**
+ * Runs the background task to send attestation requests.
+ *
+ * @param poll The poll task to run.
+ */
+static void attestation_scheduler_background_poll_task (
+	struct attestation_scheduler_background_task *poll)
+{
+	while (1) {
+		attestation_scheduler_wait_for_work (poll->scheduler, poll->poll_ms);
+
+		xSemaphoreTake (poll->lock, portMAX_DELAY);
+		attestation_scheduler_poll (poll->scheduler);
+		xSemaphoreGive (poll->lock);
+	}
+}
+
+/**
+ * Runs the background task to verify challenge responses.
+ *
+ * @param verify The verification task to run.
+ */
+static void attestation_scheduler_background_verify_task (
+	struct attestation_scheduler_background_task *verify)
+{
+	int status;
+
+	while (1) {
+		attestation_scheduler_wait_for_verify (verify->scheduler, 0);
+
+		do {
+			xSemaphoreTake (verify->lock, portMAX_DELAY);
+			status = attestation_scheduler_verify_next (verify->scheduler);
+			xSemaphoreGive (verify->lock);
+		} while (status == 0);
+	}
+}
+
+/**
+ * Create a single background task for the attestation scheduler.
+ *
+ * @param task The task to create.
+ * @param scheduler The scheduler the task will run.
+ * @param poll_ms Maximum time between polls of the scheduler.
+ * @param function The function to execute in the task.
+ * @param name The name of the task.
+ * @param priority The priority level for running the task.
+ *
+ * @return 0 if the task was created or an error code.
+ */
+static int attestation_scheduler_background_create_task (
+	struct attestation_scheduler_background_task *task, struct attestation_scheduler *scheduler,
+	uint32_t poll_ms, TaskFunction_t function, const char *name, int priority)
+{
+	int status;
+
+	task->scheduler = scheduler;
+	task->poll_ms = poll_ms;
+
+	task->lock = xSemaphoreCreateMutex ();
+	if (task->lock == NULL) {
+		return ATTESTATION_SCHEDULER_NO_MEMORY;
+	}
+
+	status = xTaskCreate (function, name, 4 * 256, task, priority, &task->task);
+	if (status != pdPASS) {
+		vSemaphoreDelete (task->lock);
+		task->lock = NULL;
+		return ATTESTATION_SCHEDULER_NO_MEMORY;
+	}
+
+	return 0;
+}
+
+/**
+ * Stop a background task for the attestation scheduler.
+ *
+ * @param task The task to stop.
+ */
+static void attestation_scheduler_background_delete_task (
+	struct attestation_scheduler_background_task *task)
+{
+	if (task->lock != NULL) {
+		xSemaphoreTake (task->lock, portMAX_DELAY);
+		vTaskDelete (task->task);
+		vSemaphoreDelete (task->lock);
+		task->lock = NULL;
+	}
+}
+
+/**
+ * Initialize the background tasks to attest devices with the attestation scheduler.  The tasks
+ * only send requests once a sweep has been started on the scheduler.
+ *
+ * @param background The background tasks to initialize.
+ * @param scheduler The scheduler to run.
+ * @param poll_ms The maximum time to wait between polls of the scheduler.  This determines how
+ * quickly request timeouts will be detected.
+ * @param priority The priority level for running the scheduler tasks.
+ *
+ * @return 0 if the scheduler tasks were initialized or an error code.
+ */
+int attestation_scheduler_background_init (struct attestation_scheduler_background *background,
+	struct attestation_scheduler *scheduler, uint32_t poll_ms, int priority)
+{
+	int status;
+
+	if ((background == NULL) || (scheduler == NULL) || (poll_ms == 0)) {
+		return ATTESTATION_SCHEDULER_INVALID_ARGUMENT;
+	}
+
+	memset (background, 0, sizeof (struct attestation_scheduler_background));
+
+	status = attestation_scheduler_background_create_task (&background->verify, scheduler, 0,
+		(TaskFunction_t) attestation_scheduler_background_verify_task, "AttVerify", priority);
+	if (status != 0) {
+		return status;
+	}
+
+	status = attestation_scheduler_background_create_task (&background->poll, scheduler, poll_ms,
+		(TaskFunction_t) attestation_scheduler_background_poll_task, "AttPoll", priority);
+	if (status != 0) {
+		goto error;
+	}
+
+	return 0;
+
+error:
+	attestation_scheduler_background_release (background);
+	return status;
+}
+
+/**
+ * Release resources for the attestation scheduler background tasks.
+ *
+ * @param background The background tasks to release.
+ */
+void attestation_scheduler_background_release (struct attestation_scheduler_background *background)
+{
+	if (background) {
+		attestation_scheduler_background_delete_task (&background->poll);
+		attestation_scheduler_background_delete_task (&background->verify);
+	}
+}
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef ATTESTATION_SCHEDULER_BACKGROUND_H_
+#define ATTESTATION_SCHEDULER_BACKGROUND_H_
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "attestation/attestation_scheduler.h"
+
+
+/**
+ * A single background task used by the attestation scheduler.
+ */
+struct attestation_scheduler_background_task {
+	struct attestation_scheduler *scheduler;	/**< The scheduler to run. */
+	uint32_t poll_ms;							/**< Maximum time between polls of the scheduler. */
+	TaskHandle_t task;							/**< The background task. */
+	SemaphoreHandle_t lock;						/**< Synchronization to protect task deletion. */
+};
+
+/**
+ * Background tasks for attesting devices with the attestation scheduler.  One task sends requests
+ * to devices, and another verifies challenge responses.
+ */
+struct attestation_scheduler_background {
+	struct attestation_scheduler_background_task poll;		/**< The task sending requests. */
+	struct attestation_scheduler_background_task verify;	/**< The task verifying responses. */
+};
+
+
+int attestation_scheduler_background_init (struct attestation_scheduler_background *background,
+	struct attestation_scheduler *scheduler, uint32_t poll_ms, int priority);
+void attestation_scheduler_background_release (struct attestation_scheduler_background *background);
+
+
+#endif /* ATTESTATION_SCHEDULER_BACKGROUND_H_ */
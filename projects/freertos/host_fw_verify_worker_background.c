@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "host_fw_verify_worker_background.h"
+
+
+/**
+ * Runs the background task to execute host firmware verification requests.
+ *
+ * @param background The verification task to run.
+ */
+static void host_fw_verify_worker_background_task (
+	struct host_fw_verify_worker_background *background)
+{
+	while (1) {
+		if (host_fw_verify_worker_async_wait_for_work (background->worker, 0) == 0) {
+			xSemaphoreTake (background->lock, portMAX_DELAY);
+			host_fw_verify_worker_async_process (background->worker);
+			xSemaphoreGive (background->lock);
+		}
+	}
+}
+
+/**
+ * Initialize a task to run host firmware verification requests in parallel with the caller.
+ *
+ * @param background The verification task to initialize.
+ * @param worker The worker that will receive verification requests.
+ * @param priority The priority level for running the verification task.
+ * @param stack_words The size of the verification task stack.  The stack size is measured in
+ * words.
+ *
+ * @return 0 if the verification task was initialized or an error code.
+ */
+int host_fw_verify_worker_background_init (struct host_fw_verify_worker_background *background,
+	struct host_fw_verify_worker_async *worker, int priority, uint16_t stack_words)
+{
+	int status;
+
+	if ((background == NULL) || (worker == NULL)) {
+		return HOST_FW_VERIFY_WORKER_INVALID_ARGUMENT;
+	}
+
+	memset (background, 0, sizeof (struct host_fw_verify_worker_background));
+
+	background->worker = worker;
+
+	background->lock = xSemaphoreCreateMutex ();
+	if (background->lock == NULL) {
+		return HOST_FW_VERIFY_WORKER_NO_MEMORY;
+	}
+
+	status = xTaskCreate ((TaskFunction_t) host_fw_verify_worker_background_task, "FwVerify",
+		stack_words, background, priority, &background->task);
+	if (status != pdPASS) {
+		vSemaphoreDelete (background->lock);
+		return HOST_FW_VERIFY_WORKER_NO_MEMORY;
+	}
+
+	return 0;
+}
+
+/**
+ * Release resources for a host firmware verification task.
+ *
+ * @param background The verification task to release.
+ */
+void host_fw_verify_worker_background_release (
+	struct host_fw_verify_worker_background *background)
+{
+	if (background) {
+		xSemaphoreTake (background->lock, portMAX_DELAY);
+		vTaskDelete (background->task);
+		vSemaphoreDelete (background->lock);
+	}
+}
@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef HOST_FW_VERIFY_WORKER_BACKGROUND_H_
+#define HOST_FW_VERIFY_WORKER_BACKGROUND_H_
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "host_fw/host_fw_verify_worker_async.h"
+
+
+/**
+ * Task context for running host firmware verification requests in the background.
+ */
+struct host_fw_verify_worker_background {
+	struct host_fw_verify_worker_async *worker;		/**< The worker to run verification for. */
+	TaskHandle_t task;								/**< The verification worker task. */
+	SemaphoreHandle_t lock;							/**< Synchronization to protect task deletion. */
+};
+
+
+int host_fw_verify_worker_background_init (struct host_fw_verify_worker_background *background,
+	struct host_fw_verify_worker_async *worker, int priority, uint16_t stack_words);
+void host_fw_verify_worker_background_release (
+	struct host_fw_verify_worker_background *background);
+
+
+#endif /* HOST_FW_VERIFY_WORKER_BACKGROUND_H_ */
@@ -0,0 +1,640 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+#include <openssl/evp.h>
+#include <openssl/rsa.h>
+#include <openssl/x509.h>
+#include "platform.h"
+#include "crypto/hash_openssl.h"
+#include "crypto/rsa_openssl.h"
+#include "flash/flash_master_mmap.h"
+#include "flash/flash_common.h"
+#include "flash/flash_util.h"
+#include "flash/spi_flash.h"
+
+
+/**
+ * Size of the simulated flash device used for benchmarking.  The lower half of the device holds
+ * source data and the upper half is used as the destination for copies.
+ */
+#define	FLASH_UTIL_BENCH_DEVICE_SIZE	(32 * 1024 * 1024)
+
+/**
+ * Base address of the destination region for copy benchmarks.
+ */
+#define	FLASH_UTIL_BENCH_DEST_BASE		(FLASH_UTIL_BENCH_DEVICE_SIZE / 2)
+
+/**
+ * Maximum number of region or chunk sizes that can be specified.
+ */
+#define	FLASH_UTIL_BENCH_MAX_SIZES		16
+
+/**
+ * Alignment required for chunk sizes.  The flash is filled with a pattern that repeats on this
+ * boundary so every chunk of a region has the same contents and signature.
+ */
+#define	FLASH_UTIL_BENCH_PATTERN_LEN	FLASH_PAGE_SIZE
+
+
+/**
+ * Output formats supported by the benchmark.
+ */
+enum flash_util_bench_format {
+	FLASH_UTIL_BENCH_FORMAT_CSV,	/**< Comma separated values with a header row. */
+	FLASH_UTIL_BENCH_FORMAT_JSON,	/**< A single JSON object containing all results. */
+};
+
+/**
+ * Context for running flash utility benchmarks.
+ */
+struct flash_util_bench {
+	struct flash_master_mmap sim;			/**< The simulated flash device. */
+	struct spi_flash_state state;			/**< Variable context for the flash driver. */
+	struct spi_flash flash;					/**< Flash driver for the simulated device. */
+	struct hash_engine_openssl hash;		/**< Hash engine for hashing and verification. */
+	struct rsa_engine_openssl rsa;			/**< RSA engine for signature verification. */
+	struct rsa_public_key pub_key;			/**< Public key for signature verification. */
+	EVP_PKEY *priv_key;						/**< Private key for signing the test data. */
+	uint8_t signature[RSA_KEY_LENGTH_2K];	/**< Signature for a single chunk of test data. */
+	size_t sig_length;						/**< Length of the chunk signature. */
+	uint8_t *data;							/**< Test data for a single chunk of flash. */
+	enum flash_util_bench_format format;	/**< Output format for results. */
+	int result_count;						/**< Number of results that have been reported. */
+};
+
+/**
+ * Definition for a single benchmark.
+ */
+struct flash_util_bench_test {
+	const char *name;		/**< Name of the operation being measured. */
+	bool sector_chunks;		/**< Flag indicating chunks must be a multiple of the sector size. */
+
+	/**
+	 * Prepare flash contents before each timed iteration.
+	 *
+	 * @param bench The benchmark context.
+	 * @param region The size of the region being tested.
+	 */
+	void (*setup) (struct flash_util_bench *bench, size_t region);
+
+	/**
+	 * Prepare for a specific chunk size before any iterations are run.
+	 *
+	 * @param bench The benchmark context.
+	 * @param chunk The size of each chunk.
+	 *
+	 * @return 0 if the preparation was successful or an error code.
+	 */
+	int (*prepare) (struct flash_util_bench *bench, size_t chunk);
+
+	/**
+	 * Execute the operation being measured on a single chunk of flash.
+	 *
+	 * @param bench The benchmark context.
+	 * @param offset Offset of the chunk within the region.
+	 * @param chunk The size of the chunk.
+	 *
+	 * @return 0 if the operation completed successfully or an error code.
+	 */
+	int (*run) (struct flash_util_bench *bench, uint32_t offset, size_t chunk);
+};
+
+
+/**
+ * Get the current time from a monotonic clock.
+ *
+ * @return The current time, in nanoseconds.
+ */
+static uint64_t flash_util_bench_get_time (void)
+{
+	struct timespec now;
+
+	clock_gettime (CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+/**
+ * Fill a region of flash with the test pattern.  This updates the simulated flash directly, so it
+ * is not subject to the timing model.
+ */
+static void flash_util_bench_fill_pattern (struct flash_util_bench *bench, size_t region)
+{
+	size_t i;
+
+	for (i = 0; i < region; i += FLASH_UTIL_BENCH_PATTERN_LEN) {
+		memcpy (&bench->sim.data[i], bench->data, FLASH_UTIL_BENCH_PATTERN_LEN);
+	}
+}
+
+/**
+ * Erase a region of flash without using the timing model.
+ */
+static void flash_util_bench_fill_erased (struct flash_util_bench *bench, size_t region)
+{
+	memset (bench->sim.data, 0xff, region);
+}
+
+/**
+ * Fill a region of flash with non-erased data without using the timing model.
+ */
+static void flash_util_bench_fill_zero (struct flash_util_bench *bench, size_t region)
+{
+	memset (bench->sim.data, 0, region);
+}
+
+/**
+ * Generate the signature for a single chunk of test data.
+ */
+static int flash_util_bench_sign_chunk (struct flash_util_bench *bench, size_t chunk)
+{
+	EVP_PKEY_CTX *ctx;
+	uint8_t digest[SHA256_HASH_LENGTH];
+	int status;
+
+	status = hash_calculate (&bench->hash.base, HASH_TYPE_SHA256, bench->data, chunk, digest,
+		sizeof (digest));
+	if (ROT_IS_ERROR (status)) {
+		return status;
+	}
+
+	ctx = EVP_PKEY_CTX_new (bench->priv_key, NULL);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	bench->sig_length = sizeof (bench->signature);
+	if ((EVP_PKEY_sign_init (ctx) <= 0) ||
+		(EVP_PKEY_CTX_set_rsa_padding (ctx, RSA_PKCS1_PADDING) <= 0) ||
+		(EVP_PKEY_CTX_set_signature_md (ctx, EVP_sha256 ()) <= 0) ||
+		(EVP_PKEY_sign (ctx, bench->signature, &bench->sig_length, digest, sizeof (digest)) <= 0)) {
+		status = -1;
+	}
+	else {
+		status = 0;
+	}
+
+	EVP_PKEY_CTX_free (ctx);
+	return status;
+}
+
+static int flash_util_bench_run_hash (struct flash_util_bench *bench, uint32_t offset,
+	size_t chunk)
+{
+	uint8_t digest[SHA256_HASH_LENGTH];
+
+	return flash_hash_contents (&bench->flash.base, offset, chunk, &bench->hash.base,
+		HASH_TYPE_SHA256, digest, sizeof (digest));
+}
+
+static int flash_util_bench_run_verify (struct flash_util_bench *bench, uint32_t offset,
+	size_t chunk)
+{
+	return flash_verify_contents (&bench->flash.base, offset, chunk, &bench->hash.base,
+		HASH_TYPE_SHA256, &bench->rsa.base, bench->signature, bench->sig_length, &bench->pub_key,
+		NULL, 0);
+}
+
+static int flash_util_bench_run_copy (struct flash_util_bench *bench, uint32_t offset,
+	size_t chunk)
+{
+	return flash_copy_ext_and_verify (&bench->flash.base, FLASH_UTIL_BENCH_DEST_BASE + offset,
+		&bench->flash.base, offset, chunk);
+}
+
+static int flash_util_bench_run_blank_check (struct flash_util_bench *bench, uint32_t offset,
+	size_t chunk)
+{
+	return flash_blank_check (&bench->flash.base, offset, chunk);
+}
+
+static int flash_util_bench_run_erase (struct flash_util_bench *bench, uint32_t offset,
+	size_t chunk)
+{
+	return flash_erase_region_and_verify (&bench->flash.base, offset, chunk);
+}
+
+static int flash_util_bench_run_program (struct flash_util_bench *bench, uint32_t offset,
+	size_t chunk)
+{
+	return flash_program_and_verify (&bench->flash.base, offset, bench->data, chunk);
+}
+
+/**
+ * The list of operations to benchmark.
+ */
+static const struct flash_util_bench_test flash_util_bench_tests[] = {
+	{"flash_hash_contents", false, flash_util_bench_fill_pattern, NULL, flash_util_bench_run_hash},
+	{"flash_verify_contents", false, flash_util_bench_fill_pattern, flash_util_bench_sign_chunk,
+		flash_util_bench_run_verify},
+	{"flash_copy_ext_and_verify", false, flash_util_bench_fill_pattern, NULL,
+		flash_util_bench_run_copy},
+	{"flash_blank_check", false, flash_util_bench_fill_erased, NULL,
+		flash_util_bench_run_blank_check},
+	{"flash_erase_region_and_verify", true, flash_util_bench_fill_zero, NULL,
+		flash_util_bench_run_erase},
+	{"flash_program_and_verify", false, flash_util_bench_fill_erased, NULL,
+		flash_util_bench_run_program},
+};
+
+/**
+ * Report the result of a single benchmark.
+ */
+static void flash_util_bench_report (struct flash_util_bench *bench, const char *name,
+	size_t region, size_t chunk, int iterations, uint64_t total_ns, uint64_t min_ns, int status)
+{
+	uint64_t avg_ns = total_ns / iterations;
+	uint64_t throughput = (avg_ns != 0) ? ((region * 1000000000ULL) / avg_ns) : 0;
+
+	if (bench->format == FLASH_UTIL_BENCH_FORMAT_JSON) {
+		printf ("%s\n    {\"operation\": \"%s\", \"region_size\": %zu, \"chunk_size\": %zu, "
+			"\"iterations\": %d, \"avg_ns\": %llu, \"min_ns\": %llu, \"bytes_per_sec\": %llu, "
+			"\"status\": %d}", (bench->result_count != 0) ? "," : "", name, region, chunk,
+			iterations, (unsigned long long) avg_ns, (unsigned long long) min_ns,
+			(unsigned long long) throughput, status);
+	}
+	else {
+		printf ("%s,%zu,%zu,%d,%llu,%llu,%llu,%d\n", name, region, chunk, iterations,
+			(unsigned long long) avg_ns, (unsigned long long) min_ns,
+			(unsigned long long) throughput, status);
+	}
+
+	fflush (stdout);
+	bench->result_count++;
+}
+
+/**
+ * Run a single benchmark for one region and chunk size.
+ *
+ * @return 0 if the benchmark completed successfully or an error code.
+ */
+static int flash_util_bench_run_test (struct flash_util_bench *bench,
+	const struct flash_util_bench_test *test, size_t region, size_t chunk, int iterations)
+{
+	uint64_t total_ns = 0;
+	uint64_t min_ns = UINT64_MAX;
+	uint64_t start;
+	uint64_t elapsed;
+	uint32_t offset;
+	int i;
+	int status = 0;
+
+	if (test->prepare) {
+		status = test->prepare (bench, chunk);
+	}
+
+	for (i = 0; (i < iterations) && (status == 0); i++) {
+		test->setup (bench, region);
+
+		start = flash_util_bench_get_time ();
+		for (offset = 0; (offset < region) && (status == 0); offset += chunk) {
+			status = test->run (bench, offset, chunk);
+		}
+		elapsed = flash_util_bench_get_time () - start;
+
+		total_ns += elapsed;
+		if (elapsed < min_ns) {
+			min_ns = elapsed;
+		}
+	}
+
+	if (status != 0) {
+		total_ns = 0;
+		min_ns = 0;
+		fprintf (stderr, "%s failed for region %zu, chunk %zu: 0x%x\n", test->name, region, chunk,
+			status);
+	}
+
+	flash_util_bench_report (bench, test->name, region, chunk, iterations, total_ns, min_ns,
+		status);
+
+	return status;
+}
+
+/**
+ * Create the key used to sign test data for verification benchmarks.
+ *
+ * @return 0 if the key was created successfully or an error code.
+ */
+static int flash_util_bench_init_key (struct flash_util_bench *bench)
+{
+	struct rsa_private_key key;
+	const uint8_t *der_ptr;
+	uint8_t *der;
+	size_t length;
+	int status;
+
+	status = bench->rsa.base.generate_key (&bench->rsa.base, &key, 2048);
+	if (status != 0) {
+		return status;
+	}
+
+	status = bench->rsa.base.get_private_key_der (&bench->rsa.base, &key, &der, &length);
+	if (status != 0) {
+		goto release_key;
+	}
+
+	der_ptr = der;
+	bench->priv_key = d2i_AutoPrivateKey (NULL, &der_ptr, length);
+	platform_free (der);
+	if (bench->priv_key == NULL) {
+		status = -1;
+		goto release_key;
+	}
+
+	status = bench->rsa.base.get_public_key_der (&bench->rsa.base, &key, &der, &length);
+	if (status != 0) {
+		goto release_key;
+	}
+
+	status = bench->rsa.base.init_public_key (&bench->rsa.base, &bench->pub_key, der, length);
+	platform_free (der);
+
+release_key:
+	bench->rsa.base.release_key (&bench->rsa.base, &key);
+	return status;
+}
+
+/**
+ * Initialize the benchmark context.
+ *
+ * @param bench The benchmark context to initialize.
+ * @param path Optional file to back the simulated flash.
+ * @param latency Flag to enable a typical NOR flash timing model.
+ * @param max_chunk The largest chunk size that will be benchmarked.
+ *
+ * @return 0 if the context was initialized successfully or an error code.
+ */
+static int flash_util_bench_init (struct flash_util_bench *bench, const char *path, bool latency,
+	size_t max_chunk)
+{
+	struct flash_master_mmap_config config = {
+		.device_size = FLASH_UTIL_BENCH_DEVICE_SIZE,
+		.page_size = FLASH_PAGE_SIZE,
+		.sector_size = FLASH_SECTOR_SIZE,
+		.block_size = FLASH_BLOCK_SIZE,
+		.device_id = {0xc2, 0x20, 0x19},
+		.capabilities = FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR,
+	};
+	size_t i;
+	int status;
+
+	if (latency) {
+		/* Approximate timing for a 50MHz quad SPI NOR device. */
+		config.read.latency_us = 1;
+		config.read.bytes_per_sec = 25 * 1000 * 1000;
+		config.program.latency_us = 50;
+		config.program.bytes_per_sec = 400 * 1000;
+		config.erase.latency_us = 1000;
+		config.erase.bytes_per_sec = 100 * 1000;
+	}
+
+	bench->data = platform_malloc (max_chunk);
+	if (bench->data == NULL) {
+		return -1;
+	}
+
+	for (i = 0; i < max_chunk; i++) {
+		bench->data[i] = ((i % FLASH_UTIL_BENCH_PATTERN_LEN) * 31) + 7;
+	}
+
+	status = flash_master_mmap_init (&bench->sim, path, &config);
+	if (status != 0) {
+		return status;
+	}
+
+	status = spi_flash_init (&bench->flash, &bench->state, &bench->sim.base);
+	if (status != 0) {
+		return status;
+	}
+
+	status = spi_flash_set_device_size (&bench->flash, config.device_size);
+	if (status != 0) {
+		return status;
+	}
+
+	status = hash_openssl_init (&bench->hash);
+	if (status != 0) {
+		return status;
+	}
+
+	status = rsa_openssl_init (&bench->rsa);
+	if (status != 0) {
+		return status;
+	}
+
+	return flash_util_bench_init_key (bench);
+}
+
+/**
+ * Release the benchmark context.
+ *
+ * @param bench The benchmark context to release.
+ */
+static void flash_util_bench_release (struct flash_util_bench *bench)
+{
+	EVP_PKEY_free (bench->priv_key);
+	rsa_openssl_release (&bench->rsa);
+	hash_openssl_release (&bench->hash);
+	spi_flash_release (&bench->flash);
+	flash_master_mmap_release (&bench->sim);
+	platform_free (bench->data);
+}
+
+/**
+ * Parse a comma separated list of sizes.  Sizes can use a 'k' or 'm' suffix.
+ *
+ * @return The number of sizes parsed or -1 if the list is not valid.
+ */
+static int flash_util_bench_parse_sizes (const char *list, size_t *sizes)
+{
+	char *end;
+	int count = 0;
+
+	while (*list != '\0') {
+		if (count == FLASH_UTIL_BENCH_MAX_SIZES) {
+			return -1;
+		}
+
+		sizes[count] = strtoul (list, &end, 0);
+		if (end == list) {
+			return -1;
+		}
+
+		if ((*end == 'k') || (*end == 'K')) {
+			sizes[count] *= 1024;
+			end++;
+		}
+		else if ((*end == 'm') || (*end == 'M')) {
+			sizes[count] *= 1024 * 1024;
+			end++;
+		}
+
+		if ((sizes[count] == 0) || ((*end != ',') && (*end != '\0'))) {
+			return -1;
+		}
+
+		count++;
+		list = (*end == ',') ? end + 1 : end;
+	}
+
+	return count;
+}
+
+/**
+ * Print the command usage.
+ */
+static void flash_util_bench_usage (const char *name)
+{
+	fprintf (stderr,
+		"Usage: %s [options]\n"
+		"  -f <csv|json>  Output format.  Default: csv\n"
+		"  -r <sizes>     Comma separated region sizes.  Default: 4k,64k,1m\n"
+		"  -c <sizes>     Comma separated chunk sizes.  Default: 256,4k,64k\n"
+		"  -i <count>     Iterations per measurement.  Default: 3\n"
+		"  -o <test>      Only run the named operation.\n"
+		"  -b <file>      Back the simulated flash with a file instead of RAM.\n"
+		"  -l             Apply a typical NOR flash timing model.\n", name);
+}
+
+int main (int argc, char *argv[])
+{
+	struct flash_util_bench bench;
+	size_t regions[FLASH_UTIL_BENCH_MAX_SIZES] = {4 * 1024, 64 * 1024, 1024 * 1024};
+	size_t chunks[FLASH_UTIL_BENCH_MAX_SIZES] = {256, 4 * 1024, 64 * 1024};
+	int region_count = 3;
+	int chunk_count = 3;
+	int iterations = 3;
+	const char *only = NULL;
+	const char *path = NULL;
+	bool latency = false;
+	size_t max_chunk = 0;
+	size_t t;
+	int r;
+	int c;
+	int opt;
+	int failures = 0;
+	int status;
+
+	memset (&bench, 0, sizeof (bench));
+	bench.format = FLASH_UTIL_BENCH_FORMAT_CSV;
+
+	while ((opt = getopt (argc, argv, "f:r:c:i:o:b:lh")) != -1) {
+		switch (opt) {
+			case 'f':
+				if (strcmp (optarg, "json") == 0) {
+					bench.format = FLASH_UTIL_BENCH_FORMAT_JSON;
+				}
+				else if (strcmp (optarg, "csv") != 0) {
+					flash_util_bench_usage (argv[0]);
+					return 1;
+				}
+				break;
+
+			case 'r':
+				region_count = flash_util_bench_parse_sizes (optarg, regions);
+				break;
+
+			case 'c':
+				chunk_count = flash_util_bench_parse_sizes (optarg, chunks);
+				break;
+
+			case 'i':
+				iterations = atoi (optarg);
+				break;
+
+			case 'o':
+				only = optarg;
+				break;
+
+			case 'b':
+				path = optarg;
+				break;
+
+			case 'l':
+				latency = true;
+				break;
+
+			default:
+				flash_util_bench_usage (argv[0]);
+				return 1;
+		}
+	}
+
+	if ((region_count <= 0) || (chunk_count <= 0) || (iterations <= 0)) {
+		flash_util_bench_usage (argv[0]);
+		return 1;
+	}
+
+	for (r = 0; r < region_count; r++) {
+		if ((regions[r] > FLASH_UTIL_BENCH_DEST_BASE) ||
+			(regions[r] % FLASH_UTIL_BENCH_PATTERN_LEN)) {
+			fprintf (stderr, "Region sizes must be a multiple of %d and no larger than %d.\n",
+				FLASH_UTIL_BENCH_PATTERN_LEN, FLASH_UTIL_BENCH_DEST_BASE);
+			return 1;
+		}
+	}
+
+	for (c = 0; c < chunk_count; c++) {
+		if (chunks[c] % FLASH_UTIL_BENCH_PATTERN_LEN) {
+			fprintf (stderr, "Chunk sizes must be a multiple of %d.\n",
+				FLASH_UTIL_BENCH_PATTERN_LEN);
+			return 1;
+		}
+
+		if (chunks[c] > max_chunk) {
+			max_chunk = chunks[c];
+		}
+	}
+
+	status = flash_util_bench_init (&bench, path, latency, max_chunk);
+	if (status != 0) {
+		fprintf (stderr, "Failed to initialize the benchmark: 0x%x\n", status);
+		return 1;
+	}
+
+	if (bench.format == FLASH_UTIL_BENCH_FORMAT_JSON) {
+		printf ("{\n  \"benchmark\": \"flash_util\",\n  \"device_size\": %d,\n"
+			"  \"timing_model\": %s,\n  \"results\": [", FLASH_UTIL_BENCH_DEVICE_SIZE,
+			latency ? "true" : "false");
+	}
+	else {
+		printf ("operation,region_size,chunk_size,iterations,avg_ns,min_ns,bytes_per_sec,status\n");
+	}
+
+	for (t = 0; t < sizeof (flash_util_bench_tests) / sizeof (flash_util_bench_tests[0]); t++) {
+		if (only && (strcmp (only, flash_util_bench_tests[t].name) != 0)) {
+			continue;
+		}
+
+		for (r = 0; r < region_count; r++) {
+			for (c = 0; c < chunk_count; c++) {
+				if ((chunks[c] > regions[r]) || (regions[r] % chunks[c]) ||
+					(flash_util_bench_tests[t].sector_chunks &&
+						(chunks[c] % FLASH_SECTOR_SIZE))) {
+					continue;
+				}
+
+				status = flash_util_bench_run_test (&bench, &flash_util_bench_tests[t],
+					regions[r], chunks[c], iterations);
+				if (status != 0) {
+					failures++;
+				}
+			}
+		}
+	}
+
+	if (bench.format == FLASH_UTIL_BENCH_FORMAT_JSON) {
+		printf ("\n  ]\n}\n");
+	}
+
+	flash_util_bench_release (&bench);
+
+	return (failures != 0);
+}
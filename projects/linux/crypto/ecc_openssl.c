@@ -11,6 +11,7 @@
 #include <openssl/ecdsa.h>
 #include <openssl/obj_mac.h>
 #include <openssl/err.h>
+#include <openssl/crypto.h>
 #include "crypto/ecc_openssl.h"
 #include "common/unused.h"
 
@@ -434,6 +435,103 @@ static int ecc_openssl_sign (struct ecc_engine *engine, struct ecc_private_key *
 	return (status == 1) ? out_len : -ERR_get_error ();
 }
 
+static int ecc_openssl_generate_ecdsa_nonce (struct ecc_engine *engine,
+	struct ecc_private_key *key, struct ecc_ecdsa_nonce *nonce)
+{
+	BIGNUM *kinv = NULL;
+	BIGNUM *r = NULL;
+	int length;
+	int status;
+
+	if ((engine == NULL) || (key == NULL) || (nonce == NULL)) {
+		return ECC_ENGINE_INVALID_ARGUMENT;
+	}
+
+	length = (EC_GROUP_order_bits (EC_KEY_get0_group ((EC_KEY*) key->context)) + 7) / 8;
+	if ((length <= 0) || (length > ECC_MAX_KEY_LENGTH)) {
+		return ECC_ENGINE_UNSUPPORTED_KEY_LENGTH;
+	}
+
+	ERR_clear_error ();
+
+	status = ECDSA_sign_setup ((EC_KEY*) key->context, NULL, &kinv, &r);
+	if (status != 1) {
+		return -ERR_get_error ();
+	}
+
+	if ((BN_bn2binpad (kinv, nonce->k, length) != length) ||
+		(BN_bn2binpad (r, nonce->r, length) != length)) {
+		OPENSSL_cleanse (nonce, sizeof (struct ecc_ecdsa_nonce));
+		status = ECC_ENGINE_NONCE_FAILED;
+		goto exit;
+	}
+
+	nonce->length = length;
+	status = 0;
+
+exit:
+	BN_clear_free (kinv);
+	BN_free (r);
+	return status;
+}
+
+static int ecc_openssl_sign_with_nonce (struct ecc_engine *engine, struct ecc_private_key *key,
+	struct ecc_ecdsa_nonce *nonce, const uint8_t *digest, size_t length, uint8_t *signature,
+	size_t sig_length)
+{
+	BIGNUM *kinv = NULL;
+	BIGNUM *r = NULL;
+	ECDSA_SIG *sig = NULL;
+	uint8_t *der = signature;
+	int status;
+
+	if ((engine == NULL) || (key == NULL) || (nonce == NULL) || (digest == NULL) ||
+		(signature == NULL) || (length == 0)) {
+		status = ECC_ENGINE_INVALID_ARGUMENT;
+		goto exit;
+	}
+
+	if ((int) sig_length < ecc_openssl_get_signature_max_length (engine, key)) {
+		status = ECC_ENGINE_SIG_BUFFER_TOO_SMALL;
+		goto exit;
+	}
+
+	if ((int) nonce->length !=
+		((EC_GROUP_order_bits (EC_KEY_get0_group ((EC_KEY*) key->context)) + 7) / 8)) {
+		status = ECC_ENGINE_BAD_NONCE;
+		goto exit;
+	}
+
+	ERR_clear_error ();
+
+	kinv = BN_bin2bn (nonce->k, nonce->length, NULL);
+	r = BN_bin2bn (nonce->r, nonce->length, NULL);
+	if ((kinv == NULL) || (r == NULL)) {
+		status = -ERR_get_error ();
+		goto exit;
+	}
+
+	sig = ECDSA_do_sign_ex (digest, length, kinv, r, (EC_KEY*) key->context);
+	if (sig == NULL) {
+		status = -ERR_get_error ();
+		goto exit;
+	}
+
+	status = i2d_ECDSA_SIG (sig, &der);
+	if (status <= 0) {
+		status = ECC_ENGINE_SIGN_FAILED;
+	}
+
+exit:
+	ECDSA_SIG_free (sig);
+	BN_clear_free (kinv);
+	BN_free (r);
+	if (nonce != NULL) {
+		OPENSSL_cleanse (nonce, sizeof (struct ecc_ecdsa_nonce));
+	}
+	return status;
+}
+
 static int ecc_openssl_verify (struct ecc_engine *engine, struct ecc_public_key *key,
 	const uint8_t *digest, size_t length, const uint8_t *signature, size_t sig_length)
 {
@@ -514,6 +612,8 @@ int ecc_openssl_init (struct ecc_engine_openssl *engine)
 	engine->base.get_public_key_der = ecc_openssl_get_public_key_der;
 #endif
 	engine->base.sign = ecc_openssl_sign;
+	engine->base.generate_ecdsa_nonce = ecc_openssl_generate_ecdsa_nonce;
+	engine->base.sign_with_nonce = ecc_openssl_sign_with_nonce;
 	engine->base.verify = ecc_openssl_verify;
 #ifdef ECC_ENABLE_ECDH
 	engine->base.get_shared_secret_max_length = ecc_openssl_get_shared_secret_max_length;
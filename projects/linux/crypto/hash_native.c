@@ -0,0 +1,1240 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "hash_native.h"
+
+#if (defined __x86_64__ || defined __i386__) && defined __GNUC__
+#define	HASH_NATIVE_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+
+/**
+ * Initial hash value for SHA-256.
+ */
+static const uint32_t HASH_NATIVE_SHA256_IV[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+/**
+ * Round constants for SHA-256.
+ */
+static const uint32_t HASH_NATIVE_SHA256_K[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#if defined HASH_ENABLE_SHA384 || defined HASH_ENABLE_SHA512
+/**
+ * Round constants for SHA-384 and SHA-512.
+ */
+static const uint64_t HASH_NATIVE_SHA512_K[80] = {
+	0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+	0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+	0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+	0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+	0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+	0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+	0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+	0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+	0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+	0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+	0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+	0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+	0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+	0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+	0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+	0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+	0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+	0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+	0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+	0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+#endif
+
+#ifdef HASH_ENABLE_SHA384
+/**
+ * Initial hash value for SHA-384.
+ */
+static const uint64_t HASH_NATIVE_SHA384_IV[8] = {
+	0xcbbb9d5dc1059ed8ULL, 0x629a292a367cd507ULL, 0x9159015a3070dd17ULL, 0x152fecd8f70e5939ULL,
+	0x67332667ffc00b31ULL, 0x8eb44a8768581511ULL, 0xdb0c2e0d64f98fa7ULL, 0x47b5481dbefa4fa4ULL
+};
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+/**
+ * Initial hash value for SHA-512.
+ */
+static const uint64_t HASH_NATIVE_SHA512_IV[8] = {
+	0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+	0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+#endif
+
+
+#define	HASH_NATIVE_ROTR32(x, n)		(((x) >> (n)) | ((x) << (32 - (n))))
+#define	HASH_NATIVE_ROTR64(x, n)		(((x) >> (n)) | ((x) << (64 - (n))))
+
+#define	HASH_NATIVE_CH(x, y, z)			(((x) & (y)) ^ (~(x) & (z)))
+#define	HASH_NATIVE_MAJ(x, y, z)		(((x) & (y)) | ((z) & ((x) | (y))))
+
+
+/**
+ * Load a big endian 32-bit value.
+ *
+ * @param data The data to load.
+ *
+ * @return The loaded value.
+ */
+static uint32_t hash_native_load_be32 (const uint8_t *data)
+{
+	return ((uint32_t) data[0] << 24) | ((uint32_t) data[1] << 16) | ((uint32_t) data[2] << 8) |
+		data[3];
+}
+
+/**
+ * Store a big endian 32-bit value.
+ *
+ * @param data Output for the value.
+ * @param value The value to store.
+ */
+static void hash_native_store_be32 (uint8_t *data, uint32_t value)
+{
+	data[0] = value >> 24;
+	data[1] = value >> 16;
+	data[2] = value >> 8;
+	data[3] = value;
+}
+
+/**
+ * Store a big endian 64-bit value.
+ *
+ * @param data Output for the value.
+ * @param value The value to store.
+ */
+static void hash_native_store_be64 (uint8_t *data, uint64_t value)
+{
+	hash_native_store_be32 (data, value >> 32);
+	hash_native_store_be32 (&data[4], value);
+}
+
+/**
+ * Portable implementation for processing SHA-256 blocks.
+ *
+ * @param state The hash state to update.
+ * @param data The blocks to process.
+ * @param blocks The number of blocks to process.
+ */
+static void hash_native_sha256_blocks_portable (uint32_t *state, const uint8_t *data,
+	size_t blocks)
+{
+	uint32_t w[64];
+	uint32_t a, b, c, d, e, f, g, h;
+	uint32_t t1;
+	uint32_t t2;
+	int i;
+
+	while (blocks--) {
+		for (i = 0; i < 16; i++) {
+			w[i] = hash_native_load_be32 (&data[i * 4]);
+		}
+
+		for (i = 16; i < 64; i++) {
+			t1 = HASH_NATIVE_ROTR32 (w[i - 2], 17) ^ HASH_NATIVE_ROTR32 (w[i - 2], 19) ^
+				(w[i - 2] >> 10);
+			t2 = HASH_NATIVE_ROTR32 (w[i - 15], 7) ^ HASH_NATIVE_ROTR32 (w[i - 15], 18) ^
+				(w[i - 15] >> 3);
+			w[i] = t1 + w[i - 7] + t2 + w[i - 16];
+		}
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+
+		for (i = 0; i < 64; i++) {
+			t1 = h + (HASH_NATIVE_ROTR32 (e, 6) ^ HASH_NATIVE_ROTR32 (e, 11) ^
+				HASH_NATIVE_ROTR32 (e, 25)) + HASH_NATIVE_CH (e, f, g) +
+				HASH_NATIVE_SHA256_K[i] + w[i];
+			t2 = (HASH_NATIVE_ROTR32 (a, 2) ^ HASH_NATIVE_ROTR32 (a, 13) ^
+				HASH_NATIVE_ROTR32 (a, 22)) + HASH_NATIVE_MAJ (a, b, c);
+
+			h = g;
+			g = f;
+			f = e;
+			e = d + t1;
+			d = c;
+			c = b;
+			b = a;
+			a = t1 + t2;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+
+		data += 64;
+	}
+}
+
+#ifdef HASH_NATIVE_X86
+/**
+ * Process SHA-256 blocks using the x86 SHA extensions.
+ *
+ * @param state The hash state to update.
+ * @param data The blocks to process.
+ * @param blocks The number of blocks to process.
+ */
+__attribute__((target ("sha,sse4.1")))
+static void hash_native_sha256_blocks_sha_ni (uint32_t *state, const uint8_t *data, size_t blocks)
+{
+	const __m128i mask = _mm_set_epi64x (0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i state0;
+	__m128i state1;
+	__m128i abef;
+	__m128i cdgh;
+	__m128i msg[4];
+	__m128i tmp;
+	int i;
+
+	/* Arrange the state as ABEF and CDGH, as expected by the SHA instructions. */
+	tmp = _mm_loadu_si128 ((const __m128i*) &state[0]);
+	state1 = _mm_loadu_si128 ((const __m128i*) &state[4]);
+
+	tmp = _mm_shuffle_epi32 (tmp, 0xb1);
+	state1 = _mm_shuffle_epi32 (state1, 0x1b);
+	state0 = _mm_alignr_epi8 (tmp, state1, 8);
+	state1 = _mm_blend_epi16 (state1, tmp, 0xf0);
+
+	while (blocks--) {
+		abef = state0;
+		cdgh = state1;
+
+		for (i = 0; i < 16; i++) {
+			if (i < 4) {
+				msg[i] = _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i*) &data[i * 16]), mask);
+			}
+			else {
+				tmp = _mm_sha256msg1_epu32 (msg[i & 3], msg[(i + 1) & 3]);
+				tmp = _mm_add_epi32 (tmp, _mm_alignr_epi8 (msg[(i + 3) & 3], msg[(i + 2) & 3], 4));
+				msg[i & 3] = _mm_sha256msg2_epu32 (tmp, msg[(i + 3) & 3]);
+			}
+
+			tmp = _mm_add_epi32 (msg[i & 3],
+				_mm_loadu_si128 ((const __m128i*) &HASH_NATIVE_SHA256_K[i * 4]));
+			state1 = _mm_sha256rnds2_epu32 (state1, state0, tmp);
+			tmp = _mm_shuffle_epi32 (tmp, 0x0e);
+			state0 = _mm_sha256rnds2_epu32 (state0, state1, tmp);
+		}
+
+		state0 = _mm_add_epi32 (state0, abef);
+		state1 = _mm_add_epi32 (state1, cdgh);
+
+		data += 64;
+	}
+
+	tmp = _mm_shuffle_epi32 (state0, 0x1b);
+	state1 = _mm_shuffle_epi32 (state1, 0xb1);
+	state0 = _mm_blend_epi16 (tmp, state1, 0xf0);
+	state1 = _mm_alignr_epi8 (state1, tmp, 8);
+
+	_mm_storeu_si128 ((__m128i*) &state[0], state0);
+	_mm_storeu_si128 ((__m128i*) &state[4], state1);
+}
+
+#define	HASH_NATIVE_AVX2_ROTR(x, n)		\
+	_mm256_or_si256 (_mm256_srli_epi32 (x, n), _mm256_slli_epi32 (x, 32 - (n)))
+
+/**
+ * Process SHA-256 blocks for multiple independent buffers in parallel using AVX2.  Every buffer
+ * processes the same number of blocks.
+ *
+ * @param state The hash state for each buffer, arranged so each state word holds the value for
+ * all buffers.
+ * @param data The blocks to process for each buffer.
+ * @param blocks The number of blocks to process from each buffer.
+ */
+__attribute__((target ("avx2")))
+static void hash_native_sha256_blocks_x8_avx2 (uint32_t state[8][HASH_NATIVE_MULTI_BUFFER_LANES],
+	const uint8_t *const *data, size_t blocks)
+{
+	__m256i s[8];
+	__m256i w[16];
+	__m256i a, b, c, d, e, f, g, h;
+	__m256i t1;
+	__m256i t2;
+	size_t pos = 0;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		s[i] = _mm256_loadu_si256 ((const __m256i*) state[i]);
+	}
+
+	while (blocks--) {
+		for (i = 0; i < 16; i++) {
+			w[i] = _mm256_set_epi32 (hash_native_load_be32 (&data[7][pos + (i * 4)]),
+				hash_native_load_be32 (&data[6][pos + (i * 4)]),
+				hash_native_load_be32 (&data[5][pos + (i * 4)]),
+				hash_native_load_be32 (&data[4][pos + (i * 4)]),
+				hash_native_load_be32 (&data[3][pos + (i * 4)]),
+				hash_native_load_be32 (&data[2][pos + (i * 4)]),
+				hash_native_load_be32 (&data[1][pos + (i * 4)]),
+				hash_native_load_be32 (&data[0][pos + (i * 4)]));
+		}
+
+		a = s[0];
+		b = s[1];
+		c = s[2];
+		d = s[3];
+		e = s[4];
+		f = s[5];
+		g = s[6];
+		h = s[7];
+
+		for (i = 0; i < 64; i++) {
+			if (i >= 16) {
+				t1 = _mm256_xor_si256 (HASH_NATIVE_AVX2_ROTR (w[(i - 2) & 15], 17),
+					_mm256_xor_si256 (HASH_NATIVE_AVX2_ROTR (w[(i - 2) & 15], 19),
+						_mm256_srli_epi32 (w[(i - 2) & 15], 10)));
+				t2 = _mm256_xor_si256 (HASH_NATIVE_AVX2_ROTR (w[(i - 15) & 15], 7),
+					_mm256_xor_si256 (HASH_NATIVE_AVX2_ROTR (w[(i - 15) & 15], 18),
+						_mm256_srli_epi32 (w[(i - 15) & 15], 3)));
+				w[i & 15] = _mm256_add_epi32 (_mm256_add_epi32 (t1, w[(i - 7) & 15]),
+					_mm256_add_epi32 (t2, w[i & 15]));
+			}
+
+			t1 = _mm256_xor_si256 (HASH_NATIVE_AVX2_ROTR (e, 6),
+				_mm256_xor_si256 (HASH_NATIVE_AVX2_ROTR (e, 11), HASH_NATIVE_AVX2_ROTR (e, 25)));
+			t1 = _mm256_add_epi32 (_mm256_add_epi32 (h, t1),
+				_mm256_xor_si256 (_mm256_and_si256 (e, f), _mm256_andnot_si256 (e, g)));
+			t1 = _mm256_add_epi32 (t1,
+				_mm256_add_epi32 (_mm256_set1_epi32 (HASH_NATIVE_SHA256_K[i]), w[i & 15]));
+
+			t2 = _mm256_xor_si256 (HASH_NATIVE_AVX2_ROTR (a, 2),
+				_mm256_xor_si256 (HASH_NATIVE_AVX2_ROTR (a, 13), HASH_NATIVE_AVX2_ROTR (a, 22)));
+			t2 = _mm256_add_epi32 (t2, _mm256_or_si256 (_mm256_and_si256 (a, b),
+				_mm256_and_si256 (c, _mm256_or_si256 (a, b))));
+
+			h = g;
+			g = f;
+			f = e;
+			e = _mm256_add_epi32 (d, t1);
+			d = c;
+			c = b;
+			b = a;
+			a = _mm256_add_epi32 (t1, t2);
+		}
+
+		s[0] = _mm256_add_epi32 (s[0], a);
+		s[1] = _mm256_add_epi32 (s[1], b);
+		s[2] = _mm256_add_epi32 (s[2], c);
+		s[3] = _mm256_add_epi32 (s[3], d);
+		s[4] = _mm256_add_epi32 (s[4], e);
+		s[5] = _mm256_add_epi32 (s[5], f);
+		s[6] = _mm256_add_epi32 (s[6], g);
+		s[7] = _mm256_add_epi32 (s[7], h);
+
+		pos += 64;
+	}
+
+	for (i = 0; i < 8; i++) {
+		_mm256_storeu_si256 ((__m256i*) state[i], s[i]);
+	}
+}
+
+/**
+ * Determine the SHA-256 acceleration supported by the CPU.
+ *
+ * @param sha_ni Output indicating support for the SHA extensions.
+ * @param avx2 Output indicating support for AVX2.
+ */
+static void hash_native_detect_cpu (bool *sha_ni, bool *avx2)
+{
+	unsigned int eax;
+	unsigned int ebx;
+	unsigned int ecx;
+	unsigned int edx;
+	unsigned int xcr0_lo;
+	unsigned int xcr0_hi;
+	bool sse41;
+	bool os_avx;
+
+	*sha_ni = false;
+	*avx2 = false;
+
+	if (!__get_cpuid (1, &eax, &ebx, &ecx, &edx)) {
+		return;
+	}
+
+	sse41 = !!(ecx & bit_SSE4_1);
+	os_avx = false;
+	if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX)) {
+		/* AVX registers can only be used if the OS saves them on context switches. */
+		__asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+		os_avx = ((xcr0_lo & 0x6) == 0x6);
+	}
+
+	if (__get_cpuid_max (0, NULL) < 7) {
+		return;
+	}
+
+	__cpuid_count (7, 0, eax, ebx, ecx, edx);
+
+	*sha_ni = sse41 && (ebx & bit_SHA);
+	*avx2 = os_avx && (ebx & bit_AVX2);
+}
+#endif
+
+/**
+ * Start a new SHA-256 hash.
+ *
+ * @param context The context to initialize.
+ */
+static void hash_native_sha256_start (struct hash_native_sha256_context *context)
+{
+	memcpy (context->state, HASH_NATIVE_SHA256_IV, sizeof (context->state));
+	context->total = 0;
+}
+
+/**
+ * Add data to a SHA-256 hash.  Complete blocks are passed directly from the input to the kernel,
+ * so only partial blocks at the beginning or end of the data need to be copied.
+ *
+ * @param blocks The kernel to use for processing blocks.
+ * @param context The hash context to update.
+ * @param data The data to add to the hash.
+ * @param length The length of the data.
+ */
+static void hash_native_sha256_update (hash_native_sha256_blocks blocks,
+	struct hash_native_sha256_context *context, const uint8_t *data, size_t length)
+{
+	size_t used = context->total & 63;
+	size_t copy;
+
+	if (length == 0) {
+		return;
+	}
+
+	context->total += length;
+
+	if (used != 0) {
+		copy = 64 - used;
+		if (length < copy) {
+			memcpy (&context->buffer[used], data, length);
+			return;
+		}
+
+		memcpy (&context->buffer[used], data, copy);
+		blocks (context->state, context->buffer, 1);
+
+		data += copy;
+		length -= copy;
+	}
+
+	if (length >= 64) {
+		blocks (context->state, data, length / 64);
+
+		data += length & ~((size_t) 63);
+		length &= 63;
+	}
+
+	if (length != 0) {
+		memcpy (context->buffer, data, length);
+	}
+}
+
+/**
+ * Complete a SHA-256 hash.
+ *
+ * @param blocks The kernel to use for processing blocks.
+ * @param context The hash context to finish.
+ * @param hash Output for the hash.  This must be large enough for a SHA-256 digest.
+ */
+static void hash_native_sha256_finish (hash_native_sha256_blocks blocks,
+	struct hash_native_sha256_context *context, uint8_t *hash)
+{
+	size_t used = context->total & 63;
+	int i;
+
+	context->buffer[used++] = 0x80;
+	if (used > 56) {
+		memset (&context->buffer[used], 0, 64 - used);
+		blocks (context->state, context->buffer, 1);
+		used = 0;
+	}
+
+	memset (&context->buffer[used], 0, 56 - used);
+	hash_native_store_be64 (&context->buffer[56], context->total << 3);
+	blocks (context->state, context->buffer, 1);
+
+	for (i = 0; i < 8; i++) {
+		hash_native_store_be32 (&hash[i * 4], context->state[i]);
+	}
+}
+
+/**
+ * Calculate a SHA-256 hash of a complete buffer.
+ *
+ * @param blocks The kernel to use for processing blocks.
+ * @param data The data to hash.
+ * @param length The length of the data.
+ * @param hash Output for the hash.  This must be large enough for a SHA-256 digest.
+ */
+static void hash_native_sha256_digest (hash_native_sha256_blocks blocks, const uint8_t *data,
+	size_t length, uint8_t *hash)
+{
+	struct hash_native_sha256_context context;
+
+	hash_native_sha256_start (&context);
+	hash_native_sha256_update (blocks, &context, data, length);
+	hash_native_sha256_finish (blocks, &context, hash);
+}
+
+#if defined HASH_ENABLE_SHA384 || defined HASH_ENABLE_SHA512
+/**
+ * Process SHA-384 or SHA-512 blocks.
+ *
+ * @param state The hash state to update.
+ * @param data The blocks to process.
+ * @param blocks The number of 128-byte blocks to process.
+ */
+static void hash_native_sha512_blocks (uint64_t *state, const uint8_t *data, size_t blocks)
+{
+	uint64_t w[80];
+	uint64_t a, b, c, d, e, f, g, h;
+	uint64_t t1;
+	uint64_t t2;
+	int i;
+
+	while (blocks--) {
+		for (i = 0; i < 16; i++) {
+			w[i] = ((uint64_t) hash_native_load_be32 (&data[i * 8]) << 32) |
+				hash_native_load_be32 (&data[(i * 8) + 4]);
+		}
+
+		for (i = 16; i < 80; i++) {
+			t1 = HASH_NATIVE_ROTR64 (w[i - 2], 19) ^ HASH_NATIVE_ROTR64 (w[i - 2], 61) ^
+				(w[i - 2] >> 6);
+			t2 = HASH_NATIVE_ROTR64 (w[i - 15], 1) ^ HASH_NATIVE_ROTR64 (w[i - 15], 8) ^
+				(w[i - 15] >> 7);
+			w[i] = t1 + w[i - 7] + t2 + w[i - 16];
+		}
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+
+		for (i = 0; i < 80; i++) {
+			t1 = h + (HASH_NATIVE_ROTR64 (e, 14) ^ HASH_NATIVE_ROTR64 (e, 18) ^
+				HASH_NATIVE_ROTR64 (e, 41)) + HASH_NATIVE_CH (e, f, g) +
+				HASH_NATIVE_SHA512_K[i] + w[i];
+			t2 = (HASH_NATIVE_ROTR64 (a, 28) ^ HASH_NATIVE_ROTR64 (a, 34) ^
+				HASH_NATIVE_ROTR64 (a, 39)) + HASH_NATIVE_MAJ (a, b, c);
+
+			h = g;
+			g = f;
+			f = e;
+			e = d + t1;
+			d = c;
+			c = b;
+			b = a;
+			a = t1 + t2;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+
+		data += 128;
+	}
+}
+
+/**
+ * Start a new SHA-384 or SHA-512 hash.
+ *
+ * @param context The context to initialize.
+ * @param iv The initial hash value for the algorithm.
+ */
+static void hash_native_sha512_start (struct hash_native_sha512_context *context,
+	const uint64_t *iv)
+{
+	memcpy (context->state, iv, sizeof (context->state));
+	context->total = 0;
+}
+
+/**
+ * Add data to a SHA-384 or SHA-512 hash.
+ *
+ * @param context The hash context to update.
+ * @param data The data to add to the hash.
+ * @param length The length of the data.
+ */
+static void hash_native_sha512_update (struct hash_native_sha512_context *context,
+	const uint8_t *data, size_t length)
+{
+	size_t used = context->total & 127;
+	size_t copy;
+
+	if (length == 0) {
+		return;
+	}
+
+	context->total += length;
+
+	if (used != 0) {
+		copy = 128 - used;
+		if (length < copy) {
+			memcpy (&context->buffer[used], data, length);
+			return;
+		}
+
+		memcpy (&context->buffer[used], data, copy);
+		hash_native_sha512_blocks (context->state, context->buffer, 1);
+
+		data += copy;
+		length -= copy;
+	}
+
+	if (length >= 128) {
+		hash_native_sha512_blocks (context->state, data, length / 128);
+
+		data += length & ~((size_t) 127);
+		length &= 127;
+	}
+
+	if (length != 0) {
+		memcpy (context->buffer, data, length);
+	}
+}
+
+/**
+ * Complete a SHA-384 or SHA-512 hash.
+ *
+ * @param context The hash context to finish.
+ * @param hash Output for the hash.
+ * @param hash_length The length of the digest to output.
+ */
+static void hash_native_sha512_finish (struct hash_native_sha512_context *context, uint8_t *hash,
+	size_t hash_length)
+{
+	size_t used = context->total & 127;
+	size_t i;
+
+	context->buffer[used++] = 0x80;
+	if (used > 112) {
+		memset (&context->buffer[used], 0, 128 - used);
+		hash_native_sha512_blocks (context->state, context->buffer, 1);
+		used = 0;
+	}
+
+	memset (&context->buffer[used], 0, 112 - used);
+	hash_native_store_be64 (&context->buffer[112], context->total >> 61);
+	hash_native_store_be64 (&context->buffer[120], context->total << 3);
+	hash_native_sha512_blocks (context->state, context->buffer, 1);
+
+	for (i = 0; i < (hash_length / 8); i++) {
+		hash_native_store_be64 (&hash[i * 8], context->state[i]);
+	}
+}
+
+/**
+ * Calculate a SHA-384 or SHA-512 hash of a complete buffer.
+ *
+ * @param iv The initial hash value for the algorithm.
+ * @param data The data to hash.
+ * @param length The length of the data.
+ * @param hash Output for the hash.
+ * @param hash_length The length of the digest to output.
+ */
+static void hash_native_sha512_digest (const uint64_t *iv, const uint8_t *data, size_t length,
+	uint8_t *hash, size_t hash_length)
+{
+	struct hash_native_sha512_context context;
+
+	hash_native_sha512_start (&context, iv);
+	hash_native_sha512_update (&context, data, length);
+	hash_native_sha512_finish (&context, hash, hash_length);
+}
+#endif
+
+#ifdef HASH_ENABLE_SHA1
+static int hash_native_calculate_sha1 (struct hash_engine *engine, const uint8_t *data,
+	size_t length, uint8_t *hash, size_t hash_length)
+{
+	return HASH_ENGINE_UNSUPPORTED_HASH;
+}
+
+static int hash_native_start_sha1 (struct hash_engine *engine)
+{
+	return HASH_ENGINE_UNSUPPORTED_HASH;
+}
+#endif
+
+static int hash_native_calculate_sha256 (struct hash_engine *engine, const uint8_t *data,
+	size_t length, uint8_t *hash, size_t hash_length)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+
+	if ((native == NULL) || ((data == NULL) && (length != 0)) || (hash == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (native->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	if (hash_length < SHA256_HASH_LENGTH) {
+		return HASH_ENGINE_HASH_BUFFER_TOO_SMALL;
+	}
+
+	hash_native_sha256_digest (native->sha256_blocks, data, length, hash);
+
+	return 0;
+}
+
+static int hash_native_start_sha256 (struct hash_engine *engine)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+
+	if (native == NULL) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (native->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	hash_native_sha256_start (&native->context.sha256);
+	native->active = HASH_ACTIVE_SHA256;
+
+	return 0;
+}
+
+#ifdef HASH_ENABLE_SHA384
+static int hash_native_calculate_sha384 (struct hash_engine *engine, const uint8_t *data,
+	size_t length, uint8_t *hash, size_t hash_length)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+
+	if ((native == NULL) || ((data == NULL) && (length != 0)) || (hash == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (native->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	if (hash_length < SHA384_HASH_LENGTH) {
+		return HASH_ENGINE_HASH_BUFFER_TOO_SMALL;
+	}
+
+	hash_native_sha512_digest (HASH_NATIVE_SHA384_IV, data, length, hash, SHA384_HASH_LENGTH);
+
+	return 0;
+}
+
+static int hash_native_start_sha384 (struct hash_engine *engine)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+
+	if (native == NULL) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (native->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	hash_native_sha512_start (&native->context.sha512, HASH_NATIVE_SHA384_IV);
+	native->active = HASH_ACTIVE_SHA384;
+
+	return 0;
+}
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+static int hash_native_calculate_sha512 (struct hash_engine *engine, const uint8_t *data,
+	size_t length, uint8_t *hash, size_t hash_length)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+
+	if ((native == NULL) || ((data == NULL) && (length != 0)) || (hash == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (native->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	if (hash_length < SHA512_HASH_LENGTH) {
+		return HASH_ENGINE_HASH_BUFFER_TOO_SMALL;
+	}
+
+	hash_native_sha512_digest (HASH_NATIVE_SHA512_IV, data, length, hash, SHA512_HASH_LENGTH);
+
+	return 0;
+}
+
+static int hash_native_start_sha512 (struct hash_engine *engine)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+
+	if (native == NULL) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (native->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	hash_native_sha512_start (&native->context.sha512, HASH_NATIVE_SHA512_IV);
+	native->active = HASH_ACTIVE_SHA512;
+
+	return 0;
+}
+#endif
+
+static int hash_native_update (struct hash_engine *engine, const uint8_t *data, size_t length)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+
+	if ((native == NULL) || ((data == NULL) && (length != 0))) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	switch (native->active) {
+		case HASH_ACTIVE_SHA256:
+			hash_native_sha256_update (native->sha256_blocks, &native->context.sha256, data,
+				length);
+			break;
+
+#ifdef HASH_ENABLE_SHA384
+		case HASH_ACTIVE_SHA384:
+#endif
+#ifdef HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA512:
+#endif
+#if defined HASH_ENABLE_SHA384 || defined HASH_ENABLE_SHA512
+			hash_native_sha512_update (&native->context.sha512, data, length);
+			break;
+#endif
+
+		default:
+			return HASH_ENGINE_NO_ACTIVE_HASH;
+	}
+
+	return 0;
+}
+
+static int hash_native_finish (struct hash_engine *engine, uint8_t *hash, size_t hash_length)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+
+	if ((native == NULL) || (hash == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	switch (native->active) {
+		case HASH_ACTIVE_SHA256:
+			if (hash_length < SHA256_HASH_LENGTH) {
+				return HASH_ENGINE_HASH_BUFFER_TOO_SMALL;
+			}
+
+			hash_native_sha256_finish (native->sha256_blocks, &native->context.sha256, hash);
+			break;
+
+#ifdef HASH_ENABLE_SHA384
+		case HASH_ACTIVE_SHA384:
+			if (hash_length < SHA384_HASH_LENGTH) {
+				return HASH_ENGINE_HASH_BUFFER_TOO_SMALL;
+			}
+
+			hash_native_sha512_finish (&native->context.sha512, hash, SHA384_HASH_LENGTH);
+			break;
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA512:
+			if (hash_length < SHA512_HASH_LENGTH) {
+				return HASH_ENGINE_HASH_BUFFER_TOO_SMALL;
+			}
+
+			hash_native_sha512_finish (&native->context.sha512, hash, SHA512_HASH_LENGTH);
+			break;
+#endif
+
+		default:
+			return HASH_ENGINE_NO_ACTIVE_HASH;
+	}
+
+	native->active = HASH_ACTIVE_NONE;
+	return 0;
+}
+
+static void hash_native_cancel (struct hash_engine *engine)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+
+	if (native) {
+		native->active = HASH_ACTIVE_NONE;
+	}
+}
+
+/**
+ * Get the length of the hash context used for a type of hash.
+ *
+ * @param active The type of hash.
+ *
+ * @return The length of the hash context or 0 if the hash type is not supported.
+ */
+static size_t hash_native_get_context_length (uint8_t active)
+{
+	switch (active) {
+		case HASH_ACTIVE_SHA256:
+			return sizeof (struct hash_native_sha256_context);
+
+#ifdef HASH_ENABLE_SHA384
+		case HASH_ACTIVE_SHA384:
+			return sizeof (struct hash_native_sha512_context);
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA512:
+			return sizeof (struct hash_native_sha512_context);
+#endif
+
+		default:
+			return 0;
+	}
+}
+
+static int hash_native_save_state (struct hash_engine *engine, struct hash_engine_state *state)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+	size_t length;
+
+	if ((native == NULL) || (state == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	length = hash_native_get_context_length (native->active);
+	if (length == 0) {
+		return HASH_ENGINE_NO_ACTIVE_HASH;
+	}
+
+	if (length > sizeof (state->context)) {
+		return HASH_ENGINE_STATE_TOO_LARGE;
+	}
+
+	memcpy (state->context, &native->context, length);
+	state->active = native->active;
+
+	return 0;
+}
+
+static int hash_native_restore_state (struct hash_engine *engine,
+	const struct hash_engine_state *state)
+{
+	struct hash_engine_native *native = (struct hash_engine_native*) engine;
+	size_t length;
+
+	if ((native == NULL) || (state == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (native->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	length = hash_native_get_context_length (state->active);
+	if (length == 0) {
+		return HASH_ENGINE_UNSUPPORTED_HASH;
+	}
+
+	if (length > sizeof (state->context)) {
+		return HASH_ENGINE_STATE_TOO_LARGE;
+	}
+
+	memcpy (&native->context, state->context, length);
+	native->active = state->active;
+
+	return 0;
+}
+
+/**
+ * Determine if a hash kernel can be used on the current CPU.
+ *
+ * @param kernel The kernel to check.
+ *
+ * @return true if the kernel is supported or false if not.
+ */
+bool hash_native_is_kernel_supported (enum hash_native_kernel kernel)
+{
+#ifdef HASH_NATIVE_X86
+	bool sha_ni;
+	bool avx2;
+#endif
+
+	switch (kernel) {
+		case HASH_NATIVE_KERNEL_AUTO:
+		case HASH_NATIVE_KERNEL_PORTABLE:
+			return true;
+
+#ifdef HASH_NATIVE_X86
+		case HASH_NATIVE_KERNEL_AVX2:
+			hash_native_detect_cpu (&sha_ni, &avx2);
+			return avx2;
+
+		case HASH_NATIVE_KERNEL_SHA_NI:
+			hash_native_detect_cpu (&sha_ni, &avx2);
+			return sha_ni;
+#endif
+
+		default:
+			return false;
+	}
+}
+
+/**
+ * Initialize a native hash engine using a specific kernel.
+ *
+ * When using the AVX2 kernel, single buffer hashes use the portable kernel and only
+ * multi-buffer hashes are accelerated.
+ *
+ * @param engine The hash engine to initialize.
+ * @param kernel The kernel to use for hashing.  If automatic selection is requested, the SHA
+ * extensions will be used if they are available, followed by AVX2.
+ *
+ * @return 0 if the hash engine was successfully initialized or an error code.  If the requested
+ * kernel is not supported on the CPU, HASH_ENGINE_UNSUPPORTED_HASH is returned.
+ */
+int hash_native_init_with_kernel (struct hash_engine_native *engine,
+	enum hash_native_kernel kernel)
+{
+	if (engine == NULL) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (kernel == HASH_NATIVE_KERNEL_AUTO) {
+		if (hash_native_is_kernel_supported (HASH_NATIVE_KERNEL_SHA_NI)) {
+			kernel = HASH_NATIVE_KERNEL_SHA_NI;
+		}
+		else if (hash_native_is_kernel_supported (HASH_NATIVE_KERNEL_AVX2)) {
+			kernel = HASH_NATIVE_KERNEL_AVX2;
+		}
+		else {
+			kernel = HASH_NATIVE_KERNEL_PORTABLE;
+		}
+	}
+	else if (!hash_native_is_kernel_supported (kernel)) {
+		return HASH_ENGINE_UNSUPPORTED_HASH;
+	}
+
+	memset (engine, 0, sizeof (struct hash_engine_native));
+
+#ifdef HASH_ENABLE_SHA1
+	engine->base.calculate_sha1 = hash_native_calculate_sha1;
+	engine->base.start_sha1 = hash_native_start_sha1;
+#endif
+	engine->base.calculate_sha256 = hash_native_calculate_sha256;
+	engine->base.start_sha256 = hash_native_start_sha256;
+#ifdef HASH_ENABLE_SHA384
+	engine->base.calculate_sha384 = hash_native_calculate_sha384;
+	engine->base.start_sha384 = hash_native_start_sha384;
+#endif
+#ifdef HASH_ENABLE_SHA512
+	engine->base.calculate_sha512 = hash_native_calculate_sha512;
+	engine->base.start_sha512 = hash_native_start_sha512;
+#endif
+	engine->base.update = hash_native_update;
+	engine->base.finish = hash_native_finish;
+	engine->base.cancel = hash_native_cancel;
+	engine->base.save_state = hash_native_save_state;
+	engine->base.restore_state = hash_native_restore_state;
+
+	engine->kernel = kernel;
+#ifdef HASH_NATIVE_X86
+	if (kernel == HASH_NATIVE_KERNEL_SHA_NI) {
+		engine->sha256_blocks = hash_native_sha256_blocks_sha_ni;
+	}
+	else
+#endif
+	{
+		engine->sha256_blocks = hash_native_sha256_blocks_portable;
+	}
+
+	engine->active = HASH_ACTIVE_NONE;
+
+	return 0;
+}
+
+/**
+ * Initialize a native hash engine using the best kernel supported by the CPU.
+ *
+ * @param engine The hash engine to initialize.
+ *
+ * @return 0 if the hash engine was successfully initialized or an error code.
+ */
+int hash_native_init (struct hash_engine_native *engine)
+{
+	return hash_native_init_with_kernel (engine, HASH_NATIVE_KERNEL_AUTO);
+}
+
+/**
+ * Release the resources used by a native hash engine.
+ *
+ * @param engine The hash engine to release.
+ */
+void hash_native_release (struct hash_engine_native *engine)
+{
+
+}
+
+#ifdef HASH_NATIVE_X86
+/**
+ * Calculate SHA-256 hashes for a group of buffers using the AVX2 kernel.  Blocks common to all
+ * buffers are processed in parallel, and any remaining data in each buffer is processed
+ * individually.
+ *
+ * @param data The buffers to hash.
+ * @param length The length of each buffer.
+ * @param count The number of buffers to hash.  This must not be more than the number of lanes.
+ * @param hash Output for the hash of each buffer.
+ */
+static void hash_native_sha256_multi_avx2 (const uint8_t *const *data, const size_t *length,
+	size_t count, uint8_t *hash)
+{
+	uint32_t state[8][HASH_NATIVE_MULTI_BUFFER_LANES];
+	const uint8_t *lane[HASH_NATIVE_MULTI_BUFFER_LANES];
+	struct hash_native_sha256_context context;
+	size_t blocks = SIZE_MAX;
+	size_t offset;
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < HASH_NATIVE_MULTI_BUFFER_LANES; i++) {
+		if (i < count) {
+			lane[i] = data[i];
+			if ((length[i] / 64) < blocks) {
+				blocks = length[i] / 64;
+			}
+		}
+		else {
+			/* Unused lanes duplicate the first buffer and the results are discarded. */
+			lane[i] = data[0];
+		}
+
+		for (j = 0; j < 8; j++) {
+			state[j][i] = HASH_NATIVE_SHA256_IV[j];
+		}
+	}
+
+	if (blocks != 0) {
+		hash_native_sha256_blocks_x8_avx2 (state, lane, blocks);
+	}
+
+	offset = blocks * 64;
+	for (i = 0; i < count; i++) {
+		for (j = 0; j < 8; j++) {
+			context.state[j] = state[j][i];
+		}
+		context.total = offset;
+
+		if (length[i] != offset) {
+			hash_native_sha256_update (hash_native_sha256_blocks_portable, &context,
+				&data[i][offset], length[i] - offset);
+		}
+		hash_native_sha256_finish (hash_native_sha256_blocks_portable, &context,
+			&hash[i * SHA256_HASH_LENGTH]);
+	}
+}
+#endif
+
+/**
+ * Calculate SHA-256 hashes for multiple independent buffers.  With the AVX2 kernel, up to
+ * HASH_NATIVE_MULTI_BUFFER_LANES buffers are hashed in parallel.  Other kernels hash each buffer in
+ * turn.
+ *
+ * This does not use or affect any hash that is in progress on the engine.
+ *
+ * @param engine The hash engine to use.
+ * @param data The list of buffers to hash.
+ * @param length The length of each buffer.
+ * @param count The number of buffers to hash.
+ * @param hash Output for the hashes.  The hash for each buffer will be written consecutively, in
+ * the same order as the buffer list.
+ * @param hash_length Length of the hash output buffer.
+ *
+ * @return 0 if the hashes were calculated successfully or an error code.
+ */
+int hash_native_calculate_sha256_multi (struct hash_engine_native *engine,
+	const uint8_t *const *data, const size_t *length, size_t count, uint8_t *hash,
+	size_t hash_length)
+{
+	size_t i;
+
+	if ((engine == NULL) || (data == NULL) || (length == NULL) || (count == 0) ||
+		(hash == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	for (i = 0; i < count; i++) {
+		if ((data[i] == NULL) && (length[i] != 0)) {
+			return HASH_ENGINE_INVALID_ARGUMENT;
+		}
+	}
+
+	if ((hash_length / SHA256_HASH_LENGTH) < count) {
+		return HASH_ENGINE_HASH_BUFFER_TOO_SMALL;
+	}
+
+#ifdef HASH_NATIVE_X86
+	if (engine->kernel == HASH_NATIVE_KERNEL_AVX2) {
+		for (i = 0; i < count; i += HASH_NATIVE_MULTI_BUFFER_LANES) {
+			hash_native_sha256_multi_avx2 (&data[i], &length[i],
+				((count - i) < HASH_NATIVE_MULTI_BUFFER_LANES) ?
+					(count - i) : HASH_NATIVE_MULTI_BUFFER_LANES,
+				&hash[i * SHA256_HASH_LENGTH]);
+		}
+
+		return 0;
+	}
+#endif
+
+	for (i = 0; i < count; i++) {
+		hash_native_sha256_digest (engine->sha256_blocks, data[i], length[i],
+			&hash[i * SHA256_HASH_LENGTH]);
+	}
+
+	return 0;
+}
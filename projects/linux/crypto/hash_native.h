@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef HASH_NATIVE_H_
+#define HASH_NATIVE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "crypto/hash.h"
+
+
+/**
+ * The maximum number of buffers that are processed in parallel by a multi-buffer hash.
+ */
+#define	HASH_NATIVE_MULTI_BUFFER_LANES		8
+
+
+/**
+ * Implementations for processing hash blocks.  The best kernel supported by the CPU is selected at
+ * run-time.
+ */
+enum hash_native_kernel {
+	HASH_NATIVE_KERNEL_AUTO = 0,		/**< Use the best kernel supported by the CPU. */
+	HASH_NATIVE_KERNEL_PORTABLE,		/**< Portable C implementation. */
+	HASH_NATIVE_KERNEL_AVX2,			/**< AVX2 kernel for multi-buffer SHA-256. */
+	HASH_NATIVE_KERNEL_SHA_NI,			/**< x86 SHA extensions for SHA-256. */
+};
+
+/**
+ * Process complete SHA-256 blocks.
+ *
+ * @param state The hash state to update.
+ * @param data The blocks to process.
+ * @param blocks The number of 64-byte blocks to process.
+ */
+typedef void (*hash_native_sha256_blocks) (uint32_t *state, const uint8_t *data, size_t blocks);
+
+/**
+ * Context for an in-progress SHA-256 hash.
+ */
+struct hash_native_sha256_context {
+	uint32_t state[8];					/**< The intermediate hash state. */
+	uint8_t buffer[64];					/**< Data that does not fill a complete block. */
+	uint64_t total;						/**< The total number of bytes hashed. */
+};
+
+/**
+ * Context for an in-progress SHA-384 or SHA-512 hash.
+ */
+struct hash_native_sha512_context {
+	uint64_t state[8];					/**< The intermediate hash state. */
+	uint8_t buffer[128];				/**< Data that does not fill a complete block. */
+	uint64_t total;						/**< The total number of bytes hashed. */
+};
+
+/**
+ * A hash engine using native block kernels for the host CPU.  SHA-1 is not supported.
+ */
+struct hash_engine_native {
+	struct hash_engine base;								/**< The base hash engine. */
+	union {
+		struct hash_native_sha256_context sha256;			/**< Context for SHA-256 hashes. */
+		struct hash_native_sha512_context sha512;			/**< Context for SHA-384/512 hashes. */
+	} context;												/**< The hashing contexts. */
+	uint8_t active;											/**< The active hash context. */
+	enum hash_native_kernel kernel;							/**< The kernel used by the engine. */
+	hash_native_sha256_blocks sha256_blocks;				/**< Single buffer SHA-256 kernel. */
+};
+
+
+int hash_native_init (struct hash_engine_native *engine);
+int hash_native_init_with_kernel (struct hash_engine_native *engine,
+	enum hash_native_kernel kernel);
+void hash_native_release (struct hash_engine_native *engine);
+
+bool hash_native_is_kernel_supported (enum hash_native_kernel kernel);
+
+int hash_native_calculate_sha256_multi (struct hash_engine_native *engine,
+	const uint8_t *const *data, const size_t *length, size_t count, uint8_t *hash,
+	size_t hash_length);
+
+
+#endif /* HASH_NATIVE_H_ */
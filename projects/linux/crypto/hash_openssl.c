@@ -306,6 +306,101 @@ static void hash_openssl_cancel (struct hash_engine *engine)
 	}
 }
 
+/**
+ * Get the hash context used for a type of hash.
+ *
+ * @param openssl The hash engine to query.
+ * @param active The type of hash.
+ * @param length Output for the length of the hash context.
+ *
+ * @return The hash context or null if the hash type is not supported.
+ */
+static void* hash_openssl_get_context (struct hash_engine_openssl *openssl, int active,
+	size_t *length)
+{
+	switch (active) {
+#ifdef HASH_ENABLE_SHA1
+		case HASH_ACTIVE_SHA1:
+			*length = sizeof (openssl->sha1);
+			return &openssl->sha1;
+#endif
+
+		case HASH_ACTIVE_SHA256:
+			*length = sizeof (openssl->sha256);
+			return &openssl->sha256;
+
+#ifdef HASH_ENABLE_SHA384
+		case HASH_ACTIVE_SHA384:
+			*length = sizeof (openssl->sha512);
+			return &openssl->sha512;
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA512:
+			*length = sizeof (openssl->sha512);
+			return &openssl->sha512;
+#endif
+
+		default:
+			return NULL;
+	}
+}
+
+static int hash_openssl_save_state (struct hash_engine *engine, struct hash_engine_state *state)
+{
+	struct hash_engine_openssl *openssl = (struct hash_engine_openssl*) engine;
+	void *context;
+	size_t length;
+
+	if ((openssl == NULL) || (state == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	context = hash_openssl_get_context (openssl, openssl->active, &length);
+	if (context == NULL) {
+		return HASH_ENGINE_NO_ACTIVE_HASH;
+	}
+
+	if (length > sizeof (state->context)) {
+		return HASH_ENGINE_STATE_TOO_LARGE;
+	}
+
+	memcpy (state->context, context, length);
+	state->active = openssl->active;
+
+	return 0;
+}
+
+static int hash_openssl_restore_state (struct hash_engine *engine,
+	const struct hash_engine_state *state)
+{
+	struct hash_engine_openssl *openssl = (struct hash_engine_openssl*) engine;
+	void *context;
+	size_t length;
+
+	if ((openssl == NULL) || (state == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (openssl->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	context = hash_openssl_get_context (openssl, state->active, &length);
+	if (context == NULL) {
+		return HASH_ENGINE_UNSUPPORTED_HASH;
+	}
+
+	if (length > sizeof (state->context)) {
+		return HASH_ENGINE_STATE_TOO_LARGE;
+	}
+
+	memcpy (context, state->context, length);
+	openssl->active = state->active;
+
+	return 0;
+}
+
 /**
  * Initialize an OpenSSL engine for calculating hashes.
  *
@@ -338,6 +433,8 @@ int hash_openssl_init (struct hash_engine_openssl *engine)
 	engine->base.update = hash_openssl_update;
 	engine->base.finish = hash_openssl_finish;
 	engine->base.cancel = hash_openssl_cancel;
+	engine->base.save_state = hash_openssl_save_state;
+	engine->base.restore_state = hash_openssl_restore_state;
 
 	engine->active = HASH_ACTIVE_NONE;
 
@@ -0,0 +1,612 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "flash_master_mmap.h"
+#include "flash/flash_common.h"
+
+
+/**
+ * Get the current time from a monotonic clock.
+ *
+ * @return The current time, in nanoseconds.
+ */
+static uint64_t flash_master_mmap_get_time (void)
+{
+	struct timespec now;
+
+	clock_gettime (CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+/**
+ * Determine how long an operation would take based on a timing model.
+ *
+ * @param timing The timing model for the operation.
+ * @param length The number of bytes processed by the operation.
+ *
+ * @return The operation time, in nanoseconds.
+ */
+static uint64_t flash_master_mmap_get_duration (const struct flash_master_mmap_timing *timing,
+	uint64_t length)
+{
+	uint64_t duration = (uint64_t) timing->latency_us * 1000;
+
+	if (timing->bytes_per_sec != 0) {
+		duration += (length * 1000000000ULL) / timing->bytes_per_sec;
+	}
+
+	return duration;
+}
+
+/**
+ * Block the calling thread for a specified amount of time.
+ *
+ * @param duration The amount of time to wait, in nanoseconds.
+ */
+static void flash_master_mmap_delay (uint64_t duration)
+{
+	struct timespec delay;
+
+	if (duration != 0) {
+		delay.tv_sec = duration / 1000000000ULL;
+		delay.tv_nsec = duration % 1000000000ULL;
+
+		while (nanosleep (&delay, &delay) != 0);
+	}
+}
+
+/**
+ * Check if the device is currently executing a program or erase operation.
+ *
+ * @param spi The simulated device to check.
+ *
+ * @return true if the device is busy or false if it is idle.
+ */
+static bool flash_master_mmap_is_busy (const struct flash_master_mmap *spi)
+{
+	return (flash_master_mmap_get_time () < spi->busy_until);
+}
+
+/**
+ * Start a program or erase operation on the device.
+ *
+ * @param spi The simulated device executing the operation.
+ * @param timing The timing model for the operation.
+ * @param length The number of bytes affected by the operation.
+ */
+static void flash_master_mmap_start_write (struct flash_master_mmap *spi,
+	const struct flash_master_mmap_timing *timing, uint64_t length)
+{
+	spi->busy_until = flash_master_mmap_get_time () +
+		flash_master_mmap_get_duration (timing, length);
+	spi->write_enable = false;
+}
+
+/**
+ * Copy data out of the flash.  Reads wrap to the beginning of the device when the end of flash is
+ * reached.
+ *
+ * @param spi The simulated device to read.
+ * @param xfer The read transfer.
+ */
+static void flash_master_mmap_read_data (struct flash_master_mmap *spi,
+	const struct flash_xfer *xfer)
+{
+	uint32_t addr = xfer->address % spi->config.device_size;
+	uint32_t remaining = xfer->length;
+	uint32_t read_len;
+	uint8_t *out = xfer->data;
+
+	while (remaining) {
+		read_len = spi->config.device_size - addr;
+		if (read_len > remaining) {
+			read_len = remaining;
+		}
+
+		memcpy (out, &spi->data[addr], read_len);
+
+		out += read_len;
+		remaining -= read_len;
+		addr = 0;
+	}
+
+	spi->stats.read_count++;
+	spi->stats.read_bytes += xfer->length;
+}
+
+/**
+ * Program data into a page of flash.  Programming can only clear bits, and the data wraps to the
+ * start of the page if it would cross the page boundary.
+ *
+ * @param spi The simulated device to program.
+ * @param xfer The page program transfer.
+ */
+static void flash_master_mmap_program_data (struct flash_master_mmap *spi,
+	const struct flash_xfer *xfer)
+{
+	uint32_t addr = xfer->address % spi->config.device_size;
+	uint32_t page = addr - (addr % spi->config.page_size);
+	uint32_t offset = addr - page;
+	uint32_t length = xfer->length;
+	uint32_t i;
+
+	if (length > spi->config.page_size) {
+		/* Only the last page worth of data is retained by the device. */
+		i = length - spi->config.page_size;
+		offset = (offset + i) % spi->config.page_size;
+	}
+	else {
+		i = 0;
+	}
+
+	for (; i < length; i++) {
+		spi->data[page + offset] &= xfer->data[i];
+		offset = (offset + 1) % spi->config.page_size;
+	}
+
+	spi->stats.program_count++;
+	spi->stats.program_bytes += length;
+	flash_master_mmap_start_write (spi, &spi->config.program, length);
+}
+
+/**
+ * Erase a region of flash.
+ *
+ * @param spi The simulated device to erase.
+ * @param addr An address within the region to erase.
+ * @param size The size of the erase region.
+ */
+static void flash_master_mmap_erase_data (struct flash_master_mmap *spi, uint32_t addr,
+	uint32_t size)
+{
+	addr %= spi->config.device_size;
+	addr -= (addr % size);
+
+	memset (&spi->data[addr], 0xff, size);
+
+	spi->stats.erase_count++;
+	spi->stats.erase_bytes += size;
+	flash_master_mmap_start_write (spi, &spi->config.erase, size);
+}
+
+/**
+ * Fill a register read transfer with a single value.
+ *
+ * @param xfer The register read transfer.
+ * @param value The register value to report.
+ */
+static void flash_master_mmap_read_reg (const struct flash_xfer *xfer, uint8_t value)
+{
+	memset (xfer->data, value, xfer->length);
+}
+
+/**
+ * Execute a transfer against the simulated device.  The device lock must be held by the caller.
+ *
+ * @param sim The simulated device.
+ * @param xfer The transfer to execute.
+ * @param read_time Output for the amount of bus time needed to complete the transfer.
+ *
+ * @return 0 if the transfer was executed successfully or an error code.
+ */
+static int flash_master_mmap_execute (struct flash_master_mmap *sim, const struct flash_xfer *xfer,
+	uint64_t *read_time)
+{
+	bool busy = flash_master_mmap_is_busy (sim);
+	int status = 0;
+
+	*read_time = 0;
+
+	switch (xfer->cmd) {
+		case FLASH_CMD_RDID:
+			memset (xfer->data, 0xff, xfer->length);
+			memcpy (xfer->data, sim->config.device_id,
+				(xfer->length < sizeof (sim->config.device_id)) ?
+					xfer->length : sizeof (sim->config.device_id));
+			break;
+
+		case FLASH_CMD_RDSR:
+			flash_master_mmap_read_reg (xfer,
+				(busy ? FLASH_STATUS_WIP : 0) | (sim->write_enable ? FLASH_STATUS_WEL : 0));
+			sim->stats.status_count++;
+			break;
+
+		case FLASH_CMD_RDSR_FLAG:
+			flash_master_mmap_read_reg (xfer, busy ? 0 : FLASH_FLAG_STATUS_READY);
+			sim->stats.status_count++;
+			break;
+
+		case FLASH_CMD_RDSR2:
+		case FLASH_CMD_ALT_RDSR2:
+		case FLASH_CMD_RDSR3:
+			flash_master_mmap_read_reg (xfer, 0);
+			break;
+
+		case FLASH_CMD_RD_NV_CFG:
+			flash_master_mmap_read_reg (xfer, 0xff);
+			break;
+
+		case FLASH_CMD_WREN:
+			if (!busy) {
+				sim->write_enable = true;
+			}
+			break;
+
+		case FLASH_CMD_WRDI:
+			if (!busy) {
+				sim->write_enable = false;
+			}
+			break;
+
+		case FLASH_CMD_WRSR:
+		case FLASH_CMD_WRSR2:
+		case FLASH_CMD_ALT_WRSR2:
+		case FLASH_CMD_WR_NV_CFG:
+			/* Register contents are not modeled, but the write enable latch is consumed. */
+			if (!busy) {
+				sim->write_enable = false;
+			}
+			break;
+
+		case FLASH_CMD_READ:
+		case FLASH_CMD_FAST_READ:
+		case FLASH_CMD_DUAL_READ:
+		case FLASH_CMD_DIO_READ:
+		case FLASH_CMD_QUAD_READ:
+		case FLASH_CMD_QIO_READ:
+		case FLASH_CMD_4BYTE_READ:
+		case FLASH_CMD_4BYTE_FAST_READ:
+		case FLASH_CMD_4BYTE_DUAL_READ:
+		case FLASH_CMD_4BYTE_DIO_READ:
+		case FLASH_CMD_4BYTE_QUAD_READ:
+		case FLASH_CMD_4BYTE_QIO_READ:
+			if (busy) {
+				/* The device does not respond while a write is in progress. */
+				memset (xfer->data, 0xff, xfer->length);
+			}
+			else {
+				flash_master_mmap_read_data (sim, xfer);
+			}
+
+			*read_time = flash_master_mmap_get_duration (&sim->config.read, xfer->length);
+			break;
+
+		case FLASH_CMD_PP:
+		case FLASH_CMD_4BYTE_PP:
+			if (!busy && sim->write_enable) {
+				flash_master_mmap_program_data (sim, xfer);
+			}
+			break;
+
+		case FLASH_CMD_4K_ERASE:
+		case FLASH_CMD_4BYTE_4K_ERASE:
+			if (!busy && sim->write_enable) {
+				flash_master_mmap_erase_data (sim, xfer->address, sim->config.sector_size);
+			}
+			break;
+
+		case FLASH_CMD_64K_ERASE:
+		case FLASH_CMD_4BYTE_64K_ERASE:
+			if (!busy && sim->write_enable) {
+				flash_master_mmap_erase_data (sim, xfer->address, sim->config.block_size);
+			}
+			break;
+
+		case FLASH_CMD_CE:
+		case FLASH_CMD_ALT_CE:
+			if (!busy && sim->write_enable) {
+				flash_master_mmap_erase_data (sim, 0, sim->config.device_size);
+			}
+			break;
+
+		case FLASH_CMD_NOOP:
+		case FLASH_CMD_VOLATILE_WREN:
+		case FLASH_CMD_GBULK:
+		case FLASH_CMD_RSTEN:
+		case FLASH_CMD_RST:
+		case FLASH_CMD_ALT_RST:
+		case FLASH_CMD_EN4B:
+		case FLASH_CMD_EX4B:
+		case FLASH_CMD_DP:
+		case FLASH_CMD_RDP:
+			break;
+
+		default:
+			status = FLASH_MASTER_UNSUPPORTED_XFER;
+			break;
+	}
+
+	return status;
+}
+
+static int flash_master_mmap_xfer (const struct flash_master *spi, const struct flash_xfer *xfer)
+{
+	struct flash_master_mmap *sim = (struct flash_master_mmap*) spi;
+	uint64_t read_time = 0;
+	int status;
+
+	if ((sim == NULL) || (xfer == NULL) || ((xfer->length != 0) && (xfer->data == NULL))) {
+		return FLASH_MASTER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&sim->lock);
+
+	if (sim->xfer_active) {
+		status = FLASH_MASTER_XFER_IN_PROGRESS;
+	}
+	else {
+		status = flash_master_mmap_execute (sim, xfer, &read_time);
+	}
+
+	platform_mutex_unlock (&sim->lock);
+
+	/* Model the bus time for reads outside the lock so status polling is not blocked. */
+	flash_master_mmap_delay (read_time);
+
+	return status;
+}
+
+static int flash_master_mmap_xfer_start (const struct flash_master *spi,
+	const struct flash_xfer *xfer)
+{
+	struct flash_master_mmap *sim = (struct flash_master_mmap*) spi;
+	uint64_t read_time;
+	int status;
+
+	if ((sim == NULL) || (xfer == NULL) || ((xfer->length != 0) && (xfer->data == NULL))) {
+		return FLASH_MASTER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&sim->lock);
+
+	if (sim->xfer_active) {
+		status = FLASH_MASTER_XFER_IN_PROGRESS;
+		goto exit;
+	}
+
+	/* The data is transferred immediately, but the transfer is not reported as complete until the
+	 * modeled bus time has elapsed. */
+	status = flash_master_mmap_execute (sim, xfer, &read_time);
+	if (status == 0) {
+		sim->xfer_done = flash_master_mmap_get_time () + read_time;
+		sim->xfer_active = true;
+	}
+
+exit:
+	platform_mutex_unlock (&sim->lock);
+	return status;
+}
+
+static int flash_master_mmap_xfer_wait (const struct flash_master *spi)
+{
+	struct flash_master_mmap *sim = (struct flash_master_mmap*) spi;
+	uint64_t now;
+	uint64_t remaining = 0;
+
+	if (sim == NULL) {
+		return FLASH_MASTER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&sim->lock);
+
+	if (sim->xfer_active) {
+		now = flash_master_mmap_get_time ();
+		if (sim->xfer_done > now) {
+			remaining = sim->xfer_done - now;
+		}
+
+		sim->xfer_active = false;
+	}
+
+	platform_mutex_unlock (&sim->lock);
+
+	flash_master_mmap_delay (remaining);
+
+	return 0;
+}
+
+static uint32_t flash_master_mmap_capabilities (const struct flash_master *spi)
+{
+	const struct flash_master_mmap *sim = (const struct flash_master_mmap*) spi;
+
+	if (sim == NULL) {
+		return 0;
+	}
+
+	return sim->config.capabilities;
+}
+
+static int flash_master_mmap_get_spi_clock_frequency (const struct flash_master *spi)
+{
+	const struct flash_master_mmap *sim = (const struct flash_master_mmap*) spi;
+
+	if (sim == NULL) {
+		return FLASH_MASTER_INVALID_ARGUMENT;
+	}
+
+	return sim->frequency;
+}
+
+static int flash_master_mmap_set_spi_clock_frequency (const struct flash_master *spi,
+	uint32_t freq)
+{
+	struct flash_master_mmap *sim = (struct flash_master_mmap*) spi;
+
+	if (sim == NULL) {
+		return FLASH_MASTER_INVALID_ARGUMENT;
+	}
+
+	sim->frequency = freq;
+	return freq;
+}
+
+/**
+ * Map the storage for the simulated flash contents.
+ *
+ * @param spi The simulated device being initialized.
+ * @param path Path to the file that will back the flash contents.  If this is null, the contents
+ * will only exist in memory.
+ *
+ * @return 0 if the storage was mapped successfully or an error code.
+ */
+static int flash_master_mmap_map_storage (struct flash_master_mmap *spi, const char *path)
+{
+	struct stat file_info;
+	size_t size = spi->config.device_size;
+	off_t existing = 0;
+
+	if (path == NULL) {
+		spi->fd = -1;
+		spi->data = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (spi->data == MAP_FAILED) {
+			return FLASH_MASTER_NO_MEMORY;
+		}
+
+		memset (spi->data, 0xff, size);
+		return 0;
+	}
+
+	spi->fd = open (path, O_RDWR | O_CREAT, 0644);
+	if (spi->fd < 0) {
+		return FLASH_MASTER_HW_NOT_INIT;
+	}
+
+	if (fstat (spi->fd, &file_info) != 0) {
+		goto error;
+	}
+
+	existing = file_info.st_size;
+	if ((size_t) existing < size) {
+		if (ftruncate (spi->fd, size) != 0) {
+			goto error;
+		}
+	}
+
+	spi->data = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, spi->fd, 0);
+	if (spi->data == MAP_FAILED) {
+		goto error;
+	}
+
+	if ((size_t) existing < size) {
+		/* New storage starts in the erased state. */
+		memset (&spi->data[existing], 0xff, size - existing);
+	}
+
+	return 0;
+
+error:
+	close (spi->fd);
+	return FLASH_MASTER_HW_NOT_INIT;
+}
+
+/**
+ * Initialize a simulated SPI flash device.
+ *
+ * @param spi The simulated device to initialize.
+ * @param path Path to a file that will hold the flash contents.  The file will be created if it
+ * doesn't exist and extended with erased data if it is smaller than the device.  If this is null,
+ * the flash contents will only be stored in memory and start fully erased.
+ * @param config Configuration for the simulated device.
+ *
+ * @return 0 if the device was successfully initialized or an error code.
+ */
+int flash_master_mmap_init (struct flash_master_mmap *spi, const char *path,
+	const struct flash_master_mmap_config *config)
+{
+	int status;
+
+	if ((spi == NULL) || (config == NULL)) {
+		return FLASH_MASTER_INVALID_ARGUMENT;
+	}
+
+	if ((config->device_size == 0) || (config->page_size == 0) || (config->sector_size == 0) ||
+		(config->block_size == 0) || (config->sector_size % config->page_size) ||
+		(config->block_size % config->sector_size) ||
+		(config->device_size % config->block_size)) {
+		return FLASH_MASTER_INVALID_ARGUMENT;
+	}
+
+	memset (spi, 0, sizeof (struct flash_master_mmap));
+
+	spi->config = *config;
+
+	status = platform_mutex_init (&spi->lock);
+	if (status != 0) {
+		return status;
+	}
+
+	status = flash_master_mmap_map_storage (spi, path);
+	if (status != 0) {
+		platform_mutex_free (&spi->lock);
+		return status;
+	}
+
+	spi->base.xfer = flash_master_mmap_xfer;
+	spi->base.capabilities = flash_master_mmap_capabilities;
+	spi->base.get_spi_clock_frequency = flash_master_mmap_get_spi_clock_frequency;
+	spi->base.set_spi_clock_frequency = flash_master_mmap_set_spi_clock_frequency;
+	spi->base.xfer_start = flash_master_mmap_xfer_start;
+	spi->base.xfer_wait = flash_master_mmap_xfer_wait;
+
+	return 0;
+}
+
+/**
+ * Release the resources used by a simulated SPI flash device.  Any file backing the flash contents
+ * will be synchronized before it is closed.
+ *
+ * @param spi The simulated device to release.
+ */
+void flash_master_mmap_release (struct flash_master_mmap *spi)
+{
+	if (spi) {
+		if (spi->fd >= 0) {
+			msync (spi->data, spi->config.device_size, MS_SYNC);
+		}
+
+		munmap (spi->data, spi->config.device_size);
+
+		if (spi->fd >= 0) {
+			close (spi->fd);
+		}
+
+		platform_mutex_free (&spi->lock);
+	}
+}
+
+/**
+ * Get the operation counters for a simulated SPI flash device.
+ *
+ * @param spi The simulated device to query.
+ * @param stats Output for the current operation counters.
+ */
+void flash_master_mmap_get_stats (struct flash_master_mmap *spi,
+	struct flash_master_mmap_stats *stats)
+{
+	if ((spi != NULL) && (stats != NULL)) {
+		platform_mutex_lock (&spi->lock);
+		*stats = spi->stats;
+		platform_mutex_unlock (&spi->lock);
+	}
+}
+
+/**
+ * Clear the operation counters for a simulated SPI flash device.
+ *
+ * @param spi The simulated device to update.
+ */
+void flash_master_mmap_reset_stats (struct flash_master_mmap *spi)
+{
+	if (spi != NULL) {
+		platform_mutex_lock (&spi->lock);
+		memset (&spi->stats, 0, sizeof (spi->stats));
+		platform_mutex_unlock (&spi->lock);
+	}
+}
@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef FLASH_MASTER_MMAP_H_
+#define FLASH_MASTER_MMAP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "platform.h"
+#include "flash/flash_master.h"
+
+
+/**
+ * Timing model for a single type of flash operation.  The time taken to complete an operation is
+ * the fixed latency plus the time needed to process the data at the specified throughput.
+ */
+struct flash_master_mmap_timing {
+	uint32_t latency_us;			/**< Fixed time added to every operation, in microseconds. */
+	uint32_t bytes_per_sec;			/**< Data throughput.  Set to 0 for no throughput limit. */
+};
+
+/**
+ * Configuration for a simulated SPI flash device.
+ */
+struct flash_master_mmap_config {
+	uint32_t device_size;						/**< Total size of the flash device. */
+	uint32_t page_size;							/**< Size of a single program page. */
+	uint32_t sector_size;						/**< Size of the smallest erase unit. */
+	uint32_t block_size;						/**< Size of the large erase block. */
+	uint8_t device_id[3];						/**< Value to report for the device ID. */
+	uint32_t capabilities;						/**< SPI master capabilities to report. */
+	struct flash_master_mmap_timing read;		/**< Timing for read commands. */
+	struct flash_master_mmap_timing program;	/**< Timing for page program commands. */
+	struct flash_master_mmap_timing erase;		/**< Timing for sector, block, and chip erase. */
+};
+
+/**
+ * Counters for the operations executed against a simulated flash device.
+ */
+struct flash_master_mmap_stats {
+	uint32_t read_count;			/**< Number of read commands. */
+	uint64_t read_bytes;			/**< Total number of bytes read. */
+	uint32_t program_count;			/**< Number of page program commands. */
+	uint64_t program_bytes;			/**< Total number of bytes programmed. */
+	uint32_t erase_count;			/**< Number of erase commands. */
+	uint64_t erase_bytes;			/**< Total number of bytes erased. */
+	uint32_t status_count;			/**< Number of status register reads. */
+};
+
+/**
+ * A SPI master that simulates a NOR flash device.  The flash contents are stored in a memory
+ * mapped file, or in anonymous memory if no file is provided.
+ *
+ * Program and erase commands follow NOR flash semantics:  programming can only clear bits, page
+ * programs wrap at the page boundary, and each operation requires the write enable latch to be set.
+ * The time for program and erase operations is modeled by reporting the device as busy in the
+ * status register until the operation would have completed.  Reads block for the modeled duration.
+ * Asynchronous transfers are supported, in which case the modeled read time elapses in the
+ * background until the caller waits for the transfer to complete.
+ *
+ * SFDP is not provided by the simulated device, so it should be used with spi_flash_init and
+ * spi_flash_set_device_size instead of parameter discovery.
+ */
+struct flash_master_mmap {
+	struct flash_master base;				/**< Base SPI master interface. */
+	struct flash_master_mmap_config config;	/**< Configuration for the simulated device. */
+	struct flash_master_mmap_stats stats;	/**< Operation counters for the device. */
+	platform_mutex lock;					/**< Synchronization for device state. */
+	uint8_t *data;							/**< Mapped flash contents. */
+	int fd;									/**< Backing file for the flash contents. */
+	bool write_enable;						/**< Current state of the write enable latch. */
+	uint64_t busy_until;					/**< Time at which the current write completes. */
+	uint32_t frequency;						/**< Configured SPI clock frequency. */
+	bool xfer_active;						/**< Flag indicating an asynchronous transfer is active. */
+	uint64_t xfer_done;						/**< Time at which the asynchronous transfer completes. */
+};
+
+
+int flash_master_mmap_init (struct flash_master_mmap *spi, const char *path,
+	const struct flash_master_mmap_config *config);
+void flash_master_mmap_release (struct flash_master_mmap *spi);
+
+void flash_master_mmap_get_stats (struct flash_master_mmap *spi,
+	struct flash_master_mmap_stats *stats);
+void flash_master_mmap_reset_stats (struct flash_master_mmap *spi);
+
+
+#endif /* FLASH_MASTER_MMAP_H_ */
@@ -163,25 +163,16 @@ uint32_t platform_get_duration (const platform_clock *start, const platform_cloc
 		return 0;
 	}
 
-	if (start->tv_sec > end->tv_sec) {
+	if ((start->tv_sec > end->tv_sec) ||
+		((start->tv_sec == end->tv_sec) && (start->tv_nsec > end->tv_nsec))) {
 		return 0;
 	}
-	else if (start->tv_sec == end->tv_sec) {
-		if (start->tv_nsec > end->tv_nsec) {
-			return 0;
-		}
-		else {
-			return (end->tv_nsec - start->tv_nsec) / 1000000ULL;
-		}
-	}
-	else {
-		uint32_t duration = end->tv_nsec / 1000000ULL;
-
-		duration += (1000000000ULL - start->tv_nsec) / 1000000ULL;
-		duration += (end->tv_sec - start->tv_sec) * 1000;
 
-		return duration;
-	}
+	/* The nanosecond difference is negative when the end time is in a later second but earlier in
+	 * that second than the start time.  That second is already included in the seconds
+	 * difference. */
+	return (((int64_t) (end->tv_sec - start->tv_sec) * 1000000000LL) +
+		(end->tv_nsec - start->tv_nsec)) / 1000000LL;
 }
 
 /**
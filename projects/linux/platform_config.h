@@ -34,6 +34,28 @@
 // #define	ECC_MAX_KEY_LENGTH		ECC_KEY_LENGTH_521
 
 
+/************
+ * Flash
+ ************/
+
+/**
+ * The block size used when hashing flash contents on a device that supports asynchronous reads.
+ * Two buffers of this size are allocated on the stack of the hashing context in place of the
+ * single FLASH_VERIFICATION_BLOCK buffer used for devices without asynchronous reads.
+ */
+// #define	FLASH_HASH_PIPELINE_BLOCK			1024
+
+/**
+ * The block size read from flash when verifying or blank checking a region.  This buffer is
+ * allocated on the stack.  Larger blocks reduce the number of flash reads and let the data
+ * comparison run over longer spans.  Unit tests build with 256-byte blocks to match their test
+ * data.
+ */
+#ifndef FLASH_VERIFICATION_BLOCK
+#define	FLASH_VERIFICATION_BLOCK			4096
+#endif
+
+
 /********************
  * MCTP protocol
  ********************/
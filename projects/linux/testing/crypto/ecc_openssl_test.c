@@ -47,6 +47,8 @@ static void ecc_openssl_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, engine.base.get_private_key_der);
 	CuAssertPtrNotNull (test, engine.base.get_public_key_der);
 	CuAssertPtrNotNull (test, engine.base.sign);
+	CuAssertPtrNotNull (test, engine.base.generate_ecdsa_nonce);
+	CuAssertPtrNotNull (test, engine.base.sign_with_nonce);
 	CuAssertPtrNotNull (test, engine.base.verify);
 	CuAssertPtrNotNull (test, engine.base.get_shared_secret_max_length);
 	CuAssertPtrNotNull (test, engine.base.compute_shared_secret);
@@ -1445,6 +1447,234 @@ static void ecc_openssl_test_sign_small_buffer (CuTest *test)
 	ecc_openssl_release (&engine);
 }
 
+static void ecc_openssl_test_sign_with_nonce_and_verify (CuTest *test)
+{
+	struct ecc_engine_openssl engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	struct ecc_ecdsa_nonce zero;
+	int status;
+	int out_len;
+	uint8_t out[ECC256_DSA_MAX_LENGTH * 2];
+
+	TEST_START;
+
+	memset (&zero, 0, sizeof (zero));
+
+	status = ecc_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, ECC_KEY_LENGTH_256, nonce.length);
+
+	out_len = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, sizeof (out));
+	CuAssertTrue (test, !ROT_IS_ERROR (out_len));
+	CuAssertTrue (test, (out_len <= ECC256_DSA_MAX_LENGTH));
+
+	status = testing_validate_array ((uint8_t*) &zero, (uint8_t*) &nonce, sizeof (nonce));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.verify (&engine.base, &pub_key, SIG_HASH_TEST, SIG_HASH_LEN, out, out_len);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	ecc_openssl_release (&engine);
+}
+
+static void ecc_openssl_test_sign_with_nonce_and_verify_p384 (CuTest *test)
+{
+	struct ecc_engine_openssl engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+	int out_len;
+	uint8_t out[ECC384_DSA_MAX_LENGTH * 2];
+
+	TEST_START;
+
+	status = ecc_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC384_PRIVKEY_DER, ECC384_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, ECC_KEY_LENGTH_384, nonce.length);
+
+	out_len = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SHA384_TEST_HASH,
+		SHA384_HASH_LENGTH, out, sizeof (out));
+	CuAssertTrue (test, !ROT_IS_ERROR (out_len));
+
+	status = engine.base.verify (&engine.base, &pub_key, SHA384_TEST_HASH, SHA384_HASH_LENGTH, out,
+		out_len);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	ecc_openssl_release (&engine);
+}
+
+static void ecc_openssl_test_generate_ecdsa_nonce_null (CuTest *test)
+{
+	struct ecc_engine_openssl engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+
+	TEST_START;
+
+	status = ecc_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (NULL, &priv_key, &nonce);
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, NULL, &nonce);
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, NULL);
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	ecc_openssl_release (&engine);
+}
+
+static void ecc_openssl_test_sign_with_nonce_null (CuTest *test)
+{
+	struct ecc_engine_openssl engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	struct ecc_ecdsa_nonce zero;
+	int status;
+	uint8_t out[ECC256_DSA_MAX_LENGTH * 2];
+
+	TEST_START;
+
+	memset (&zero, 0, sizeof (zero));
+
+	status = ecc_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, NULL, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (NULL, &priv_key, &nonce, SIG_HASH_TEST, SIG_HASH_LEN,
+		out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	/* The nonce must never be used again, even if the signature was not generated. */
+	status = testing_validate_array ((uint8_t*) &zero, (uint8_t*) &nonce, sizeof (nonce));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, NULL, &nonce, SIG_HASH_TEST, SIG_HASH_LEN,
+		out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, NULL, SIG_HASH_LEN,
+		out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST, 0,
+		out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, NULL, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_INVALID_ARGUMENT, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	ecc_openssl_release (&engine);
+}
+
+static void ecc_openssl_test_sign_with_nonce_small_buffer (CuTest *test)
+{
+	struct ecc_engine_openssl engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+	uint8_t out[ECC256_DSA_MAX_LENGTH * 2];
+
+	TEST_START;
+
+	status = ecc_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, ECC256_DSA_MAX_LENGTH - 1);
+	CuAssertIntEquals (test, ECC_ENGINE_SIG_BUFFER_TOO_SMALL, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	ecc_openssl_release (&engine);
+}
+
+static void ecc_openssl_test_sign_with_nonce_bad_nonce (CuTest *test)
+{
+	struct ecc_engine_openssl engine;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_ecdsa_nonce nonce;
+	int status;
+	uint8_t out[ECC256_DSA_MAX_LENGTH * 2];
+
+	TEST_START;
+
+	status = ecc_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.init_key_pair (&engine.base, ECC_PRIVKEY_DER, ECC_PRIVKEY_DER_LEN,
+		&priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.generate_ecdsa_nonce (&engine.base, &priv_key, &nonce);
+	CuAssertIntEquals (test, 0, status);
+
+	nonce.length = ECC_KEY_LENGTH_384;
+
+	status = engine.base.sign_with_nonce (&engine.base, &priv_key, &nonce, SIG_HASH_TEST,
+		SIG_HASH_LEN, out, sizeof (out));
+	CuAssertIntEquals (test, ECC_ENGINE_BAD_NONCE, status);
+
+	engine.base.release_key_pair (&engine.base, &priv_key, &pub_key);
+
+	ecc_openssl_release (&engine);
+}
+
 static void ecc_openssl_test_verify_null (CuTest *test)
 {
 	struct ecc_engine_openssl engine;
@@ -2634,6 +2864,12 @@ TEST (ecc_openssl_test_generate_key_pair_null);
 TEST (ecc_openssl_test_generate_key_pair_unsupported_key_length);
 TEST (ecc_openssl_test_sign_null);
 TEST (ecc_openssl_test_sign_small_buffer);
+TEST (ecc_openssl_test_sign_with_nonce_and_verify);
+TEST (ecc_openssl_test_sign_with_nonce_and_verify_p384);
+TEST (ecc_openssl_test_generate_ecdsa_nonce_null);
+TEST (ecc_openssl_test_sign_with_nonce_null);
+TEST (ecc_openssl_test_sign_with_nonce_small_buffer);
+TEST (ecc_openssl_test_sign_with_nonce_bad_nonce);
 TEST (ecc_openssl_test_verify_null);
 TEST (ecc_openssl_test_verify_corrupt_signature);
 TEST (ecc_openssl_test_get_signature_max_length);
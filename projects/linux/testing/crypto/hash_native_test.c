@@ -0,0 +1,782 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <openssl/sha.h>
+#include "testing.h"
+#include "crypto/hash_native.h"
+#include "testing/crypto/hash_testing.h"
+
+
+TEST_SUITE_LABEL ("hash_native");
+
+
+/**
+ * Length of the data used to compare hashes against OpenSSL.
+ */
+#define	HASH_NATIVE_TESTING_DATA_LEN		4160
+
+
+/**
+ * Fill a buffer with test data that does not repeat on block boundaries.
+ *
+ * @param data The buffer to fill.
+ * @param length The length of the buffer.
+ */
+static void hash_native_testing_fill_data (uint8_t *data, size_t length)
+{
+	size_t i;
+
+	for (i = 0; i < length; i++) {
+		data[i] = (i * 7) + (i >> 8) + 3;
+	}
+}
+
+/**
+ * Hash data with a native engine, split into fixed-size updates.
+ *
+ * @param test The test framework.
+ * @param engine The engine to use.
+ * @param start The start function for the hash algorithm.
+ * @param data The data to hash.
+ * @param length The length of the data.
+ * @param chunk The size of each update.
+ * @param hash Output for the hash.
+ * @param hash_length The length of the hash buffer.
+ */
+static void hash_native_testing_hash_chunks (CuTest *test, struct hash_engine_native *engine,
+	int (*start) (struct hash_engine*), const uint8_t *data, size_t length, size_t chunk,
+	uint8_t *hash, size_t hash_length)
+{
+	size_t offset = 0;
+	size_t update;
+	int status;
+
+	status = start (&engine->base);
+	CuAssertIntEquals (test, 0, status);
+
+	while (offset < length) {
+		update = ((length - offset) < chunk) ? (length - offset) : chunk;
+
+		status = engine->base.update (&engine->base, &data[offset], update);
+		CuAssertIntEquals (test, 0, status);
+
+		offset += update;
+	}
+
+	status = engine->base.finish (&engine->base, hash, hash_length);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Compare SHA-256 hashes from a native engine against OpenSSL for a range of data lengths and
+ * update sizes.
+ *
+ * @param test The test framework.
+ * @param kernel The kernel to test.
+ */
+static void hash_native_testing_sha256_kernel (CuTest *test, enum hash_native_kernel kernel)
+{
+	struct hash_engine_native engine;
+	uint8_t data[HASH_NATIVE_TESTING_DATA_LEN];
+	uint8_t hash[SHA256_HASH_LENGTH];
+	uint8_t expected[SHA256_HASH_LENGTH];
+	const size_t lengths[] = {0, 1, 55, 56, 63, 64, 65, 119, 120, 127, 128, 255, 256, 1000, 4096,
+		HASH_NATIVE_TESTING_DATA_LEN};
+	const size_t chunks[] = {1, 13, 64, 256, 4096};
+	size_t i;
+	size_t j;
+	int status;
+
+	if (!hash_native_is_kernel_supported (kernel)) {
+		return;
+	}
+
+	hash_native_testing_fill_data (data, sizeof (data));
+
+	status = hash_native_init_with_kernel (&engine, kernel);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < (sizeof (lengths) / sizeof (lengths[0])); i++) {
+		SHA256 (data, lengths[i], expected);
+
+		status = engine.base.calculate_sha256 (&engine.base, data, lengths[i], hash, sizeof (hash));
+		CuAssertIntEquals (test, 0, status);
+
+		status = testing_validate_array (expected, hash, sizeof (hash));
+		CuAssertIntEquals (test, 0, status);
+
+		for (j = 0; j < (sizeof (chunks) / sizeof (chunks[0])); j++) {
+			hash_native_testing_hash_chunks (test, &engine, engine.base.start_sha256, data,
+				lengths[i], chunks[j], hash, sizeof (hash));
+
+			status = testing_validate_array (expected, hash, sizeof (hash));
+			CuAssertIntEquals (test, 0, status);
+		}
+	}
+
+	hash_native_release (&engine);
+}
+
+/**
+ * Compare SHA-256 multi-buffer hashes from a native engine against OpenSSL.
+ *
+ * @param test The test framework.
+ * @param kernel The kernel to test.
+ */
+static void hash_native_testing_sha256_multi_kernel (CuTest *test, enum hash_native_kernel kernel)
+{
+	struct hash_engine_native engine;
+	uint8_t data[HASH_NATIVE_TESTING_DATA_LEN];
+	const uint8_t *buffers[11];
+	const size_t lengths[11] = {256, 4096, 0, 64, 1000, 1, 512, 2048, 4096, 63, 4160};
+	uint8_t hash[SHA256_HASH_LENGTH * 11];
+	uint8_t expected[SHA256_HASH_LENGTH];
+	size_t i;
+	int status;
+
+	if (!hash_native_is_kernel_supported (kernel)) {
+		return;
+	}
+
+	hash_native_testing_fill_data (data, sizeof (data));
+
+	for (i = 0; i < 11; i++) {
+		buffers[i] = &data[(i * 5) % 64];
+	}
+	buffers[2] = NULL;
+	buffers[10] = data;
+
+	status = hash_native_init_with_kernel (&engine, kernel);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_native_calculate_sha256_multi (&engine, buffers, lengths, 11, hash,
+		sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 11; i++) {
+		SHA256 ((buffers[i] != NULL) ? buffers[i] : data, lengths[i], expected);
+
+		status = testing_validate_array (expected, &hash[i * SHA256_HASH_LENGTH],
+			SHA256_HASH_LENGTH);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* Every buffer in a group has multiple blocks. */
+	status = hash_native_calculate_sha256_multi (&engine, &buffers[6], &lengths[6], 3, hash,
+		sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 3; i++) {
+		SHA256 (buffers[i + 6], lengths[i + 6], expected);
+
+		status = testing_validate_array (expected, &hash[i * SHA256_HASH_LENGTH],
+			SHA256_HASH_LENGTH);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	hash_native_release (&engine);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void hash_native_test_init (CuTest *test)
+{
+	struct hash_engine_native engine;
+	int status;
+
+	TEST_START;
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+#ifdef HASH_ENABLE_SHA1
+	CuAssertPtrNotNull (test, engine.base.calculate_sha1);
+	CuAssertPtrNotNull (test, engine.base.start_sha1);
+#endif
+	CuAssertPtrNotNull (test, engine.base.calculate_sha256);
+	CuAssertPtrNotNull (test, engine.base.start_sha256);
+#ifdef HASH_ENABLE_SHA384
+	CuAssertPtrNotNull (test, engine.base.calculate_sha384);
+	CuAssertPtrNotNull (test, engine.base.start_sha384);
+#endif
+#ifdef HASH_ENABLE_SHA512
+	CuAssertPtrNotNull (test, engine.base.calculate_sha512);
+	CuAssertPtrNotNull (test, engine.base.start_sha512);
+#endif
+	CuAssertPtrNotNull (test, engine.base.update);
+	CuAssertPtrNotNull (test, engine.base.finish);
+	CuAssertPtrNotNull (test, engine.base.cancel);
+	CuAssertPtrNotNull (test, engine.base.save_state);
+	CuAssertPtrNotNull (test, engine.base.restore_state);
+
+	CuAssertTrue (test, (engine.kernel != HASH_NATIVE_KERNEL_AUTO));
+	CuAssertIntEquals (test, true, hash_native_is_kernel_supported (engine.kernel));
+
+	if (hash_native_is_kernel_supported (HASH_NATIVE_KERNEL_SHA_NI)) {
+		CuAssertIntEquals (test, HASH_NATIVE_KERNEL_SHA_NI, engine.kernel);
+	}
+
+	hash_native_release (&engine);
+}
+
+static void hash_native_test_init_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = hash_native_init (NULL);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = hash_native_init_with_kernel (NULL, HASH_NATIVE_KERNEL_PORTABLE);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+}
+
+static void hash_native_test_init_with_kernel (CuTest *test)
+{
+	struct hash_engine_native engine;
+	enum hash_native_kernel kernels[] = {
+		HASH_NATIVE_KERNEL_PORTABLE, HASH_NATIVE_KERNEL_AVX2, HASH_NATIVE_KERNEL_SHA_NI
+	};
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < (sizeof (kernels) / sizeof (kernels[0])); i++) {
+		status = hash_native_init_with_kernel (&engine, kernels[i]);
+		if (hash_native_is_kernel_supported (kernels[i])) {
+			CuAssertIntEquals (test, 0, status);
+			CuAssertIntEquals (test, kernels[i], engine.kernel);
+
+			hash_native_release (&engine);
+		}
+		else {
+			CuAssertIntEquals (test, HASH_ENGINE_UNSUPPORTED_HASH, status);
+		}
+	}
+}
+
+static void hash_native_test_init_with_kernel_unknown (CuTest *test)
+{
+	struct hash_engine_native engine;
+	int status;
+
+	TEST_START;
+
+	status = hash_native_init_with_kernel (&engine, (enum hash_native_kernel) 99);
+	CuAssertIntEquals (test, HASH_ENGINE_UNSUPPORTED_HASH, status);
+}
+
+static void hash_native_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	hash_native_release (NULL);
+}
+
+static void hash_native_test_sha256_portable (CuTest *test)
+{
+	TEST_START;
+
+	hash_native_testing_sha256_kernel (test, HASH_NATIVE_KERNEL_PORTABLE);
+}
+
+static void hash_native_test_sha256_avx2 (CuTest *test)
+{
+	TEST_START;
+
+	hash_native_testing_sha256_kernel (test, HASH_NATIVE_KERNEL_AVX2);
+}
+
+static void hash_native_test_sha256_sha_ni (CuTest *test)
+{
+	TEST_START;
+
+	hash_native_testing_sha256_kernel (test, HASH_NATIVE_KERNEL_SHA_NI);
+}
+
+static void hash_native_test_sha256_incremental (CuTest *test)
+{
+	struct hash_engine_native engine;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The engine can start a new hash after finishing. */
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, HASH_TESTING_FULL_BLOCK_512,
+		HASH_TESTING_FULL_BLOCK_512_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_FULL_BLOCK_512_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_native_release (&engine);
+}
+
+static void hash_native_test_sha256_incremental_cancel (CuTest *test)
+{
+	struct hash_engine_native engine;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	hash_native_release (&engine);
+}
+
+static void hash_native_test_sha256_start_without_finish (CuTest *test)
+{
+	struct hash_engine_native engine;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_IN_PROGRESS, status);
+
+	status = engine.base.calculate_sha256 (&engine.base, (uint8_t*) message, strlen (message),
+		hash, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_IN_PROGRESS, status);
+
+	engine.base.cancel (&engine.base);
+
+	hash_native_release (&engine);
+}
+
+static void hash_native_test_sha256_finish_small_hash_buffer (CuTest *test)
+{
+	struct hash_engine_native engine;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.calculate_sha256 (&engine.base, (uint8_t*) message, strlen (message),
+		hash, sizeof (hash) - 1);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_BUFFER_TOO_SMALL, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash) - 1);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_BUFFER_TOO_SMALL, status);
+
+	/* The hash is still active after a failed finish. */
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_native_release (&engine);
+}
+
+static void hash_native_test_sha256_null (CuTest *test)
+{
+	struct hash_engine_native engine;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.calculate_sha256 (NULL, (uint8_t*) message, strlen (message), hash,
+		sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.calculate_sha256 (&engine.base, NULL, strlen (message), hash,
+		sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.calculate_sha256 (&engine.base, (uint8_t*) message, strlen (message),
+		NULL, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.start_sha256 (NULL);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (NULL, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.update (&engine.base, NULL, strlen (message));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.finish (NULL, hash, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.finish (&engine.base, NULL, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	engine.base.cancel (NULL);
+	engine.base.cancel (&engine.base);
+
+	hash_native_release (&engine);
+}
+
+#ifdef HASH_ENABLE_SHA1
+static void hash_native_test_sha1_unsupported (CuTest *test)
+{
+	struct hash_engine_native engine;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA1_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.calculate_sha1 (&engine.base, (uint8_t*) message, strlen (message), hash,
+		sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_UNSUPPORTED_HASH, status);
+
+	status = engine.base.start_sha1 (&engine.base);
+	CuAssertIntEquals (test, HASH_ENGINE_UNSUPPORTED_HASH, status);
+
+	hash_native_release (&engine);
+}
+#endif
+
+#ifdef HASH_ENABLE_SHA384
+static void hash_native_test_sha384 (CuTest *test)
+{
+	struct hash_engine_native engine;
+	uint8_t data[HASH_NATIVE_TESTING_DATA_LEN];
+	uint8_t hash[SHA384_HASH_LENGTH];
+	uint8_t expected[SHA384_HASH_LENGTH];
+	const size_t lengths[] = {0, 1, 111, 112, 127, 128, 129, 239, 240, 256, 1000, 4096};
+	const size_t chunks[] = {1, 13, 128, 256, 4096};
+	size_t i;
+	size_t j;
+	int status;
+
+	TEST_START;
+
+	hash_native_testing_fill_data (data, sizeof (data));
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < (sizeof (lengths) / sizeof (lengths[0])); i++) {
+		SHA384 (data, lengths[i], expected);
+
+		status = engine.base.calculate_sha384 (&engine.base, data, lengths[i], hash, sizeof (hash));
+		CuAssertIntEquals (test, 0, status);
+
+		status = testing_validate_array (expected, hash, sizeof (hash));
+		CuAssertIntEquals (test, 0, status);
+
+		for (j = 0; j < (sizeof (chunks) / sizeof (chunks[0])); j++) {
+			hash_native_testing_hash_chunks (test, &engine, engine.base.start_sha384, data,
+				lengths[i], chunks[j], hash, sizeof (hash));
+
+			status = testing_validate_array (expected, hash, sizeof (hash));
+			CuAssertIntEquals (test, 0, status);
+		}
+	}
+
+	status = engine.base.calculate_sha384 (&engine.base, (uint8_t*) "Test", 4, hash,
+		sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA384_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.calculate_sha384 (&engine.base, data, 4, hash, sizeof (hash) - 1);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_BUFFER_TOO_SMALL, status);
+
+	hash_native_release (&engine);
+}
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+static void hash_native_test_sha512 (CuTest *test)
+{
+	struct hash_engine_native engine;
+	uint8_t data[HASH_NATIVE_TESTING_DATA_LEN];
+	uint8_t hash[SHA512_HASH_LENGTH];
+	uint8_t expected[SHA512_HASH_LENGTH];
+	const size_t lengths[] = {0, 1, 111, 112, 127, 128, 129, 239, 240, 256, 1000, 4096};
+	const size_t chunks[] = {1, 13, 128, 256, 4096};
+	size_t i;
+	size_t j;
+	int status;
+
+	TEST_START;
+
+	hash_native_testing_fill_data (data, sizeof (data));
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < (sizeof (lengths) / sizeof (lengths[0])); i++) {
+		SHA512 (data, lengths[i], expected);
+
+		status = engine.base.calculate_sha512 (&engine.base, data, lengths[i], hash, sizeof (hash));
+		CuAssertIntEquals (test, 0, status);
+
+		status = testing_validate_array (expected, hash, sizeof (hash));
+		CuAssertIntEquals (test, 0, status);
+
+		for (j = 0; j < (sizeof (chunks) / sizeof (chunks[0])); j++) {
+			hash_native_testing_hash_chunks (test, &engine, engine.base.start_sha512, data,
+				lengths[i], chunks[j], hash, sizeof (hash));
+
+			status = testing_validate_array (expected, hash, sizeof (hash));
+			CuAssertIntEquals (test, 0, status);
+		}
+	}
+
+	status = engine.base.calculate_sha512 (&engine.base, (uint8_t*) "Test", 4, hash,
+		sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA512_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.calculate_sha512 (&engine.base, data, 4, hash, sizeof (hash) - 1);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_BUFFER_TOO_SMALL, status);
+
+	hash_native_release (&engine);
+}
+#endif
+
+static void hash_native_test_save_restore_state (CuTest *test)
+{
+	struct hash_engine_native engine;
+	struct hash_engine_state state;
+	uint8_t data[HASH_NATIVE_TESTING_DATA_LEN];
+	uint8_t hash[SHA256_HASH_LENGTH];
+	uint8_t expected[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	hash_native_testing_fill_data (data, sizeof (data));
+	SHA256 (data, 1000, expected);
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, data, 300);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_IN_PROGRESS, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, &data[300], 700);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (expected, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_state (NULL, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.restore_state (&engine.base, NULL);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	state.active = HASH_ACTIVE_NONE;
+	status = engine.base.restore_state (&engine.base, &state);
+	CuAssertIntEquals (test, HASH_ENGINE_UNSUPPORTED_HASH, status);
+
+	hash_native_release (&engine);
+}
+
+static void hash_native_test_sha256_multi_portable (CuTest *test)
+{
+	TEST_START;
+
+	hash_native_testing_sha256_multi_kernel (test, HASH_NATIVE_KERNEL_PORTABLE);
+}
+
+static void hash_native_test_sha256_multi_avx2 (CuTest *test)
+{
+	TEST_START;
+
+	hash_native_testing_sha256_multi_kernel (test, HASH_NATIVE_KERNEL_AVX2);
+}
+
+static void hash_native_test_sha256_multi_sha_ni (CuTest *test)
+{
+	TEST_START;
+
+	hash_native_testing_sha256_multi_kernel (test, HASH_NATIVE_KERNEL_SHA_NI);
+}
+
+static void hash_native_test_sha256_multi_null (CuTest *test)
+{
+	struct hash_engine_native engine;
+	uint8_t data[64];
+	const uint8_t *buffers[2] = {data, NULL};
+	size_t lengths[2] = {sizeof (data), sizeof (data)};
+	uint8_t hash[SHA256_HASH_LENGTH * 2];
+	int status;
+
+	TEST_START;
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_native_calculate_sha256_multi (NULL, buffers, lengths, 1, hash, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = hash_native_calculate_sha256_multi (&engine, NULL, lengths, 1, hash, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = hash_native_calculate_sha256_multi (&engine, buffers, NULL, 1, hash, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = hash_native_calculate_sha256_multi (&engine, buffers, lengths, 0, hash,
+		sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = hash_native_calculate_sha256_multi (&engine, buffers, lengths, 1, NULL,
+		sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = hash_native_calculate_sha256_multi (&engine, buffers, lengths, 2, hash,
+		sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	hash_native_release (&engine);
+}
+
+static void hash_native_test_sha256_multi_small_hash_buffer (CuTest *test)
+{
+	struct hash_engine_native engine;
+	uint8_t data[64];
+	const uint8_t *buffers[2] = {data, data};
+	size_t lengths[2] = {sizeof (data), sizeof (data)};
+	uint8_t hash[SHA256_HASH_LENGTH * 2];
+	int status;
+
+	TEST_START;
+
+	status = hash_native_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_native_calculate_sha256_multi (&engine, buffers, lengths, 2, hash,
+		sizeof (hash) - 1);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_BUFFER_TOO_SMALL, status);
+
+	hash_native_release (&engine);
+}
+
+
+TEST_SUITE_START (hash_native);
+
+TEST (hash_native_test_init);
+TEST (hash_native_test_init_null);
+TEST (hash_native_test_init_with_kernel);
+TEST (hash_native_test_init_with_kernel_unknown);
+TEST (hash_native_test_release_null);
+TEST (hash_native_test_sha256_portable);
+TEST (hash_native_test_sha256_avx2);
+TEST (hash_native_test_sha256_sha_ni);
+TEST (hash_native_test_sha256_incremental);
+TEST (hash_native_test_sha256_incremental_cancel);
+TEST (hash_native_test_sha256_start_without_finish);
+TEST (hash_native_test_sha256_finish_small_hash_buffer);
+TEST (hash_native_test_sha256_null);
+#ifdef HASH_ENABLE_SHA1
+TEST (hash_native_test_sha1_unsupported);
+#endif
+#ifdef HASH_ENABLE_SHA384
+TEST (hash_native_test_sha384);
+#endif
+#ifdef HASH_ENABLE_SHA512
+TEST (hash_native_test_sha512);
+#endif
+TEST (hash_native_test_save_restore_state);
+TEST (hash_native_test_sha256_multi_portable);
+TEST (hash_native_test_sha256_multi_avx2);
+TEST (hash_native_test_sha256_multi_sha_ni);
+TEST (hash_native_test_sha256_multi_null);
+TEST (hash_native_test_sha256_multi_small_hash_buffer);
+
+TEST_SUITE_END;
@@ -0,0 +1,959 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "testing.h"
+#include "flash/flash_master_mmap.h"
+#include "flash/flash_common.h"
+#include "flash/spi_flash.h"
+
+
+TEST_SUITE_LABEL ("flash_master_mmap");
+
+
+/**
+ * Default configuration for a simulated 1MB flash device.
+ */
+static const struct flash_master_mmap_config FLASH_MASTER_MMAP_TESTING_CONFIG = {
+	.device_size = 0x100000,
+	.page_size = FLASH_PAGE_SIZE,
+	.sector_size = FLASH_SECTOR_SIZE,
+	.block_size = FLASH_BLOCK_SIZE,
+	.device_id = {0xc2, 0x20, 0x14},
+	.capabilities = FLASH_CAP_3BYTE_ADDR | FLASH_CAP_DUAL_1_1_2 | FLASH_CAP_QUAD_1_1_4,
+};
+
+/**
+ * Initialize a SPI flash driver on top of a simulated device.
+ *
+ * @param test The test framework.
+ * @param flash The SPI flash driver to initialize.
+ * @param state Variable context for the SPI flash driver.
+ * @param sim The simulated flash device.
+ */
+static void flash_master_mmap_testing_init_spi_flash (CuTest *test, struct spi_flash *flash,
+	struct spi_flash_state *state, struct flash_master_mmap *sim)
+{
+	int status;
+
+	status = spi_flash_init (flash, state, &sim->base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (flash, sim->config.device_size);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Get the path to a new temporary file to back a simulated flash device.
+ *
+ * @param test The test framework.
+ * @param path Output for the file path.
+ * @param length Length of the path buffer.
+ */
+static void flash_master_mmap_testing_temp_file (CuTest *test, char *path, size_t length)
+{
+	int fd;
+
+	snprintf (path, length, "/tmp/flash_master_mmap_XXXXXX");
+	fd = mkstemp (path);
+	CuAssertTrue (test, (fd >= 0));
+
+	close (fd);
+	unlink (path);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void flash_master_mmap_test_init (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, sim.base.xfer);
+	CuAssertPtrNotNull (test, sim.base.capabilities);
+	CuAssertPtrNotNull (test, sim.base.get_spi_clock_frequency);
+	CuAssertPtrNotNull (test, sim.base.set_spi_clock_frequency);
+	CuAssertPtrNotNull (test, sim.base.xfer_start);
+	CuAssertPtrNotNull (test, sim.base.xfer_wait);
+
+	for (i = 0; i < FLASH_MASTER_MMAP_TESTING_CONFIG.device_size; i++) {
+		if (sim.data[i] != 0xff) {
+			CuFail (test, "Flash not erased");
+		}
+	}
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_init_null (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (NULL, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	status = flash_master_mmap_init (&sim, NULL, NULL);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+}
+
+static void flash_master_mmap_test_init_bad_geometry (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_master_mmap_config config;
+	int status;
+
+	TEST_START;
+
+	config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	config.device_size = 0;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	config.page_size = 0;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	config.sector_size = 0;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	config.block_size = 0;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	config.sector_size = FLASH_PAGE_SIZE * 3 / 2;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	config.block_size = FLASH_SECTOR_SIZE * 3 / 2;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	config.device_size = FLASH_BLOCK_SIZE + FLASH_SECTOR_SIZE;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+}
+
+static void flash_master_mmap_test_init_bad_file (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, "/nonexistent/flash.bin",
+		&FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, FLASH_MASTER_HW_NOT_INIT, status);
+}
+
+static void flash_master_mmap_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	flash_master_mmap_release (NULL);
+}
+
+static void flash_master_mmap_test_capabilities (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	status = sim.base.capabilities (&sim.base);
+	CuAssertIntEquals (test, FLASH_MASTER_MMAP_TESTING_CONFIG.capabilities, status);
+
+	status = sim.base.capabilities (NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_spi_clock_frequency (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	status = sim.base.get_spi_clock_frequency (&sim.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = sim.base.set_spi_clock_frequency (&sim.base, 50000000);
+	CuAssertIntEquals (test, 50000000, status);
+
+	status = sim.base.get_spi_clock_frequency (&sim.base);
+	CuAssertIntEquals (test, 50000000, status);
+
+	status = sim.base.get_spi_clock_frequency (NULL);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	status = sim.base.set_spi_clock_frequency (NULL, 50000000);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_xfer_null (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_xfer xfer;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_READ (xfer, FLASH_CMD_READ, 0, 0, 0, NULL, 16, 0);
+
+	status = sim.base.xfer (NULL, &xfer);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	status = sim.base.xfer (&sim.base, NULL);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_xfer_unsupported_command (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_xfer xfer;
+	uint8_t data[16];
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_READ (xfer, FLASH_CMD_SFDP, 0, 1, 0, data, sizeof (data), 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, FLASH_MASTER_UNSUPPORTED_XFER, status);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_read_device_id (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	uint8_t vendor;
+	uint16_t device;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	status = spi_flash_get_device_id (&flash, &vendor, &device);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0xc2, vendor);
+	CuAssertIntEquals (test, 0x2014, device);
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_write_read (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	uint8_t data[FLASH_PAGE_SIZE * 3];
+	uint8_t out[sizeof (data)];
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i * 7;
+	}
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	status = spi_flash_write (&flash, 0x10080, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = spi_flash_read (&flash, 0x10080, out, sizeof (out));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data, out, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0xff, sim.data[0x1007f]);
+	CuAssertIntEquals (test, 0xff, sim.data[0x10080 + sizeof (data)]);
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_read_wrap (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_xfer xfer;
+	uint8_t out[4];
+	uint8_t expected[] = {0x11, 0x22, 0x33, 0x44};
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	sim.data[0xffffe] = 0x11;
+	sim.data[0xfffff] = 0x22;
+	sim.data[0] = 0x33;
+	sim.data[1] = 0x44;
+
+	FLASH_XFER_INIT_READ (xfer, FLASH_CMD_READ, 0xffffe, 0, 0, out, sizeof (out), 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (expected, out, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_program_only_clears_bits (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	uint8_t first[] = {0xf0, 0xf0, 0xaa, 0xff};
+	uint8_t second[] = {0x0f, 0xff, 0x55, 0x3c};
+	uint8_t expected[] = {0x00, 0xf0, 0x00, 0x3c};
+	uint8_t out[sizeof (expected)];
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	status = spi_flash_write (&flash, 0x2000, first, sizeof (first));
+	CuAssertIntEquals (test, sizeof (first), status);
+
+	status = spi_flash_write (&flash, 0x2000, second, sizeof (second));
+	CuAssertIntEquals (test, sizeof (second), status);
+
+	status = spi_flash_read (&flash, 0x2000, out, sizeof (out));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (expected, out, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_program_page_wrap (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_xfer xfer;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_CMD_ONLY (xfer, FLASH_CMD_WREN, 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_WRITE (xfer, FLASH_CMD_PP, 0x10fe, 0, data, sizeof (data), 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0x01, sim.data[0x10fe]);
+	CuAssertIntEquals (test, 0x02, sim.data[0x10ff]);
+	CuAssertIntEquals (test, 0x03, sim.data[0x1000]);
+	CuAssertIntEquals (test, 0x04, sim.data[0x1001]);
+	CuAssertIntEquals (test, 0xff, sim.data[0x1100]);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_program_without_write_enable (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_xfer xfer;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t reg;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_WRITE (xfer, FLASH_CMD_PP, 0x1000, 0, data, sizeof (data), 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0xff, sim.data[0x1000]);
+
+	FLASH_XFER_INIT_CMD_ONLY (xfer, FLASH_CMD_WREN, 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_READ_REG (xfer, FLASH_CMD_RDSR, &reg, 1, 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_STATUS_WEL, reg);
+
+	FLASH_XFER_INIT_CMD_ONLY (xfer, FLASH_CMD_WRDI, 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_WRITE (xfer, FLASH_CMD_PP, 0x1000, 0, data, sizeof (data), 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0xff, sim.data[0x1000]);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_sector_erase (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	memset (sim.data, 0, FLASH_MASTER_MMAP_TESTING_CONFIG.device_size);
+
+	status = spi_flash_sector_erase (&flash, 0x3456);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0x00, sim.data[0x2fff]);
+	CuAssertIntEquals (test, 0xff, sim.data[0x3000]);
+	CuAssertIntEquals (test, 0xff, sim.data[0x3fff]);
+	CuAssertIntEquals (test, 0x00, sim.data[0x4000]);
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_block_erase (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	memset (sim.data, 0, FLASH_MASTER_MMAP_TESTING_CONFIG.device_size);
+
+	status = spi_flash_block_erase (&flash, 0x23456);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0x00, sim.data[0x1ffff]);
+	CuAssertIntEquals (test, 0xff, sim.data[0x20000]);
+	CuAssertIntEquals (test, 0xff, sim.data[0x2ffff]);
+	CuAssertIntEquals (test, 0x00, sim.data[0x30000]);
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_chip_erase (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	memset (sim.data, 0, FLASH_MASTER_MMAP_TESTING_CONFIG.device_size);
+
+	status = spi_flash_chip_erase (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < FLASH_MASTER_MMAP_TESTING_CONFIG.device_size; i++) {
+		if (sim.data[i] != 0xff) {
+			CuFail (test, "Flash not erased");
+		}
+	}
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_file_backed (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	char path[64];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+	uint8_t out[sizeof (data)];
+	int status;
+
+	TEST_START;
+
+	flash_master_mmap_testing_temp_file (test, path, sizeof (path));
+
+	status = flash_master_mmap_init (&sim, path, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0xff, sim.data[0]);
+	CuAssertIntEquals (test, 0xff, sim.data[FLASH_MASTER_MMAP_TESTING_CONFIG.device_size - 1]);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	status = spi_flash_write (&flash, 0x40000, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+
+	status = flash_master_mmap_init (&sim, path, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	status = spi_flash_read (&flash, 0x40000, out, sizeof (out));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data, out, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+
+	unlink (path);
+}
+
+static void flash_master_mmap_test_program_latency (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_master_mmap_config config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	struct flash_xfer xfer;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t reg;
+	int status;
+
+	TEST_START;
+
+	config.program.latency_us = 20000;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_CMD_ONLY (xfer, FLASH_CMD_WREN, 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_WRITE (xfer, FLASH_CMD_PP, 0x1000, 0, data, sizeof (data), 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_READ_REG (xfer, FLASH_CMD_RDSR, &reg, 1, 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_STATUS_WIP, reg);
+
+	/* Commands that modify flash are ignored while the device is busy. */
+	FLASH_XFER_INIT_CMD_ONLY (xfer, FLASH_CMD_WREN, 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_READ_REG (xfer, FLASH_CMD_RDSR, &reg, 1, 0);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_STATUS_WIP, reg);
+
+	platform_msleep (30);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, reg);
+
+	CuAssertIntEquals (test, 0x01, sim.data[0x1000]);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_erase_latency (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_master_mmap_config config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	platform_clock start;
+	platform_clock end;
+	int status;
+
+	TEST_START;
+
+	config.erase.latency_us = 1000;
+	config.erase.bytes_per_sec = FLASH_SECTOR_SIZE * 50;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	platform_init_current_tick (&start);
+
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_init_current_tick (&end);
+
+	/* 1ms of latency plus 20ms to erase one sector. */
+	CuAssertTrue (test, (platform_get_duration (&start, &end) >= 21));
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_read_latency (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_master_mmap_config config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	uint8_t out[1024];
+	platform_clock start;
+	platform_clock end;
+	int status;
+
+	TEST_START;
+
+	config.read.latency_us = 5000;
+	config.read.bytes_per_sec = sizeof (out) * 100;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	platform_init_current_tick (&start);
+
+	status = spi_flash_read (&flash, 0, out, sizeof (out));
+	CuAssertIntEquals (test, 0, status);
+
+	platform_init_current_tick (&end);
+
+	/* 5ms of latency plus 10ms to transfer the data. */
+	CuAssertTrue (test, (platform_get_duration (&start, &end) >= 15));
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_async_read (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	uint8_t data[FLASH_PAGE_SIZE];
+	uint8_t out[sizeof (data)];
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i * 3;
+	}
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	CuAssertPtrNotNull (test, flash.base.read_start);
+	CuAssertPtrNotNull (test, flash.base.read_wait);
+
+	status = spi_flash_write (&flash, 0x2000, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = flash.base.read_start (&flash.base, 0x2000, out, sizeof (out));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash.base.read_wait (&flash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data, out, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_async_xfer_in_progress (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_xfer xfer;
+	uint8_t data[16];
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_READ (xfer, FLASH_CMD_READ, 0, 0, 0, data, sizeof (data), 0);
+
+	status = sim.base.xfer_start (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	status = sim.base.xfer_start (&sim.base, &xfer);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_IN_PROGRESS, status);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_IN_PROGRESS, status);
+
+	status = sim.base.xfer_wait (&sim.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = sim.base.xfer (&sim.base, &xfer);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_async_xfer_null (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_xfer xfer;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	FLASH_XFER_INIT_READ (xfer, FLASH_CMD_READ, 0, 0, 0, NULL, 16, 0);
+
+	status = sim.base.xfer_start (NULL, &xfer);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	status = sim.base.xfer_start (&sim.base, NULL);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	status = sim.base.xfer_start (&sim.base, &xfer);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	status = sim.base.xfer_wait (NULL);
+	CuAssertIntEquals (test, FLASH_MASTER_INVALID_ARGUMENT, status);
+
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_async_read_latency (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_master_mmap_config config = FLASH_MASTER_MMAP_TESTING_CONFIG;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	uint8_t out[1024];
+	platform_clock start;
+	platform_clock end;
+	int status;
+
+	TEST_START;
+
+	config.read.latency_us = 5000;
+	config.read.bytes_per_sec = sizeof (out) * 100;
+
+	status = flash_master_mmap_init (&sim, NULL, &config);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	platform_init_current_tick (&start);
+
+	status = spi_flash_read_start (&flash, 0, out, sizeof (out));
+	CuAssertIntEquals (test, 0, status);
+
+	platform_init_current_tick (&end);
+
+	/* Starting the read does not wait for the transfer. */
+	CuAssertTrue (test, (platform_get_duration (&start, &end) < 15));
+
+	status = spi_flash_read_wait (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_init_current_tick (&end);
+
+	/* 5ms of latency plus 10ms to transfer the data. */
+	CuAssertTrue (test, (platform_get_duration (&start, &end) >= 15));
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+static void flash_master_mmap_test_stats (CuTest *test)
+{
+	struct flash_master_mmap sim;
+	struct flash_master_mmap_stats stats;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	uint8_t data[FLASH_PAGE_SIZE + 16];
+	int status;
+
+	TEST_START;
+
+	memset (data, 0x55, sizeof (data));
+
+	status = flash_master_mmap_init (&sim, NULL, &FLASH_MASTER_MMAP_TESTING_CONFIG);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_testing_init_spi_flash (test, &flash, &state, &sim);
+
+	status = spi_flash_sector_erase (&flash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = spi_flash_read (&flash, 0, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mmap_get_stats (&sim, &stats);
+	CuAssertIntEquals (test, 1, stats.erase_count);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE, stats.erase_bytes);
+	CuAssertIntEquals (test, 2, stats.program_count);
+	CuAssertIntEquals (test, sizeof (data), stats.program_bytes);
+	CuAssertIntEquals (test, 1, stats.read_count);
+	CuAssertIntEquals (test, sizeof (data), stats.read_bytes);
+	CuAssertTrue (test, (stats.status_count != 0));
+
+	flash_master_mmap_reset_stats (&sim);
+
+	flash_master_mmap_get_stats (&sim, &stats);
+	CuAssertIntEquals (test, 0, stats.erase_count);
+	CuAssertIntEquals (test, 0, stats.erase_bytes);
+	CuAssertIntEquals (test, 0, stats.program_count);
+	CuAssertIntEquals (test, 0, stats.program_bytes);
+	CuAssertIntEquals (test, 0, stats.read_count);
+	CuAssertIntEquals (test, 0, stats.read_bytes);
+	CuAssertIntEquals (test, 0, stats.status_count);
+
+	spi_flash_release (&flash);
+	flash_master_mmap_release (&sim);
+}
+
+
+TEST_SUITE_START (flash_master_mmap);
+
+TEST (flash_master_mmap_test_init);
+TEST (flash_master_mmap_test_init_null);
+TEST (flash_master_mmap_test_init_bad_geometry);
+TEST (flash_master_mmap_test_init_bad_file);
+TEST (flash_master_mmap_test_release_null);
+TEST (flash_master_mmap_test_capabilities);
+TEST (flash_master_mmap_test_spi_clock_frequency);
+TEST (flash_master_mmap_test_xfer_null);
+TEST (flash_master_mmap_test_xfer_unsupported_command);
+TEST (flash_master_mmap_test_read_device_id);
+TEST (flash_master_mmap_test_write_read);
+TEST (flash_master_mmap_test_read_wrap);
+TEST (flash_master_mmap_test_program_only_clears_bits);
+TEST (flash_master_mmap_test_program_page_wrap);
+TEST (flash_master_mmap_test_program_without_write_enable);
+TEST (flash_master_mmap_test_sector_erase);
+TEST (flash_master_mmap_test_block_erase);
+TEST (flash_master_mmap_test_chip_erase);
+TEST (flash_master_mmap_test_file_backed);
+TEST (flash_master_mmap_test_program_latency);
+TEST (flash_master_mmap_test_erase_latency);
+TEST (flash_master_mmap_test_read_latency);
+TEST (flash_master_mmap_test_async_read);
+TEST (flash_master_mmap_test_async_xfer_in_progress);
+TEST (flash_master_mmap_test_async_xfer_null);
+TEST (flash_master_mmap_test_async_read_latency);
+TEST (flash_master_mmap_test_stats);
+
+TEST_SUITE_END;
@@ -52,12 +52,24 @@ void add_all_linux_tests (CuSuite *suite)
 	!defined TESTING_SKIP_HASH_OPENSSL_SUITE
 	TESTING_RUN_SUITE (hash_openssl);
 #endif
+#if (defined TESTING_RUN_HASH_NATIVE_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_LINUX_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_LINUX_TESTS)) && \
+	!defined TESTING_SKIP_HASH_NATIVE_SUITE
+	TESTING_RUN_SUITE (hash_native);
+#endif
 #if (defined TESTING_RUN_ECC_OPENSSL_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_LINUX_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_LINUX_TESTS)) && \
 	!defined TESTING_SKIP_ECC_OPENSSL_SUITE
 	TESTING_RUN_SUITE (ecc_openssl);
 #endif
+#if (defined TESTING_RUN_FLASH_MASTER_MMAP_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_LINUX_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_LINUX_TESTS)) && \
+	!defined TESTING_SKIP_FLASH_MASTER_MMAP_SUITE
+	TESTING_RUN_SUITE (flash_master_mmap);
+#endif
 #if (defined TESTING_RUN_RNG_OPENSSL_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_LINUX_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_LINUX_TESTS)) && \